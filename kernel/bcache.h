@@ -0,0 +1,27 @@
+#ifndef BCACHE_H
+#define BCACHE_H
+
+#include "types.h"
+
+/*
+*   Buffer cache statistics, filled in by bcachestat().
+*   Member nbuf, maxbuf: Buffers now, and the most the cache may grow to.
+*   Member hits, misses: Block lookups that found the block cached, and
+*   that did not.
+*   Member grows, shrinks: Pages of buffers added, and given back
+*   because memory ran out.
+*   Member nhot, nmeta: Buffers holding data used more than once, and
+*   holding file system metadata (see bvictim in bio.c).
+*/
+struct bcachestat {
+  uint nbuf;
+  uint maxbuf;
+  uint hits;
+  uint misses;
+  uint grows;
+  uint shrinks;
+  uint nhot;
+  uint nmeta;
+};
+
+#endif // BCACHE_H
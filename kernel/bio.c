@@ -1,13 +1,31 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a set of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
 //
+// Buffers are found through a hash table on (dev, blockno).
+// Each bucket has its own lock, which protects the bucket's
+// chain and the refcnt of the buffers on it, so a cache hit
+// only takes one bucket lock and CPUs looking up different
+// blocks don't contend.  Misses are serialized by bcache.lock,
+// which is the only lock under which a buffer changes identity
+// (dev, blockno) and so moves between buckets.  Unused buffers
+// are also kept on replacement lists, so a miss finds its victim
+// without looking at the whole cache, and victims are chosen so
+// that a long sequential read doesn't flush the blocks in regular
+// use (see bvictim).
+//
+// Buffers live in pages taken from kalloc(), so the cache can
+// grow while memory is plentiful and give pages back under
+// memory pressure (see bshrink).
+//
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
+// * To read the blocks after it too if it isn't cached, call breadn.
 // * After changing buffer data, call bwrite to write it to disk.
+// * bwritev writes several buffers, in as few disk requests as can be.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
@@ -17,91 +35,520 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// A transfer the disk fails leaves the buffer neither, with
+// B_ERROR set, so bad data is never cached.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
+#include "proc.h"
 #include "fs.h"
 #include "buf.h"
+#include "bcache.h"
 
-struct {
+#define NBUCKET 1021
+
+// Replacement classes, in the order they are evicted.
+#define BCOLD 0   // data used once
+#define BHOT  1   // data used again after release
+#define BMETA 2   // file system metadata
+#define NBCLASS 3
+
+// Each class has a replacement list of unused buffers, and so do
+// buffers that hold no block.
+#define BFREE NBCLASS
+#define NLRU (NBCLASS+1)
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;
+  uint hits;                  // Lookups that found their block here
+};
+
+// Buffers are carved out of whole pages from kalloc().
+#define BUFPERPAGE ((PGSIZE - sizeof(struct bufpage*)) / sizeof(struct buf))
+
+struct bufpage {
+  struct bufpage *next;
+  struct buf buf[BUFPERPAGE];
+};
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+struct {
+  struct spinlock lock;       // Held while replacing a buffer or resizing
+  struct bufpage *pages;      // Every page of buffers
+  uint npages;
+  uint misses;
+  uint grows;                 // Pages added
+  uint shrinks;               // Pages given back to kalloc()
+  struct spinlock lrulock;    // Protects the replacement lists
+  struct {
+    struct buf *head;         // Least recently used
+    struct buf *tail;
+    uint n;
+  } lru[NLRU];
+  struct bucket bucket[NBUCKET];
 } bcache;
 
+// The cache starts with room for NBUF buffers and never shrinks
+// below that.  It grows by a page on a miss while it is smaller
+// than a quarter of memory and more than an eighth of memory is
+// still free, and gives pages back when kalloc() runs out.
+#define MINPAGES ((NBUF + BUFPERPAGE - 1) / BUFPERPAGE)
+
+static struct bucket*
+bhash(uint dev, uint blockno) {
+  return &bcache.bucket[(dev * 131 + blockno) % NBUCKET];
+}
+
+// Take b off its replacement list.  Caller holds bcache.lrulock.
+static void
+lruremove(struct buf *b) {
+  if(b->lprev)
+    b->lprev->lnext = b->lnext;
+  else
+    bcache.lru[b->lru].head = b->lnext;
+  if(b->lnext)
+    b->lnext->lprev = b->lprev;
+  else
+    bcache.lru[b->lru].tail = b->lprev;
+  bcache.lru[b->lru].n--;
+  b->lru = -1;
+}
+
+// Put b on replacement list l as the most recently used buffer,
+// taking it off the one it is on first.
+// Caller holds bcache.lrulock.
+static void
+lruappend(struct buf *b, int l) {
+  if(b->lru >= 0)
+    lruremove(b);
+  b->lru = l;
+  b->lnext = 0;
+  b->lprev = bcache.lru[l].tail;
+  if(b->lprev)
+    b->lprev->lnext = b;
+  else
+    bcache.lru[l].head = b;
+  bcache.lru[l].tail = b;
+  bcache.lru[l].n++;
+}
+
+// Add a page of empty buffers.  They go in the bucket for
+// block 0 of no device; B_VALID is clear, so none of them
+// will be mistaken for a cached block.  They are on the free
+// replacement list, to be used first.
+// Caller holds bcache.lock.  Returns -1 if out of memory.
+static int
+bgrow(void) {
+  struct bufpage *pg;
+  struct buf *b;
+  struct bucket *bk = bhash(0, 0);
+
+  if((pg = (struct bufpage*)kalloc()) == 0)
+    return -1;
+  memset(pg, 0, PGSIZE);
+  for(b = pg->buf; b < pg->buf+BUFPERPAGE; b++){
+    initsleeplock(&b->lock, "buffer");
+    b->lru = -1;
+  }
+  acquire(&bk->lock);
+  for(b = pg->buf; b < pg->buf+BUFPERPAGE; b++){
+    b->hnext = bk->head;
+    bk->head = b;
+  }
+  release(&bk->lock);
+  acquire(&bcache.lrulock);
+  for(b = pg->buf; b < pg->buf+BUFPERPAGE; b++)
+    lruappend(b, BFREE);
+  release(&bcache.lrulock);
+  pg->next = bcache.pages;
+  bcache.pages = pg;
+  bcache.npages++;
+  bcache.grows++;
+  return 0;
+}
+
+// Should a miss add a page rather than recycle a buffer?
+static int
+bshouldgrow(void) {
+  uint total = ktotalpages();
+
+  return bcache.npages < total/4 && kfreepages() > total/8;
+}
+
 void
 binit(void) {
-  struct buf *b;
+  struct bucket *bk;
 
   initlock(&bcache.lock, "bcache");
+  initlock(&bcache.lrulock, "bcache.lru");
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+    initlock(&bk->lock, "bcache.bucket");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  acquire(&bcache.lock);
+  while(bcache.npages < MINPAGES)
+    if(bgrow() < 0)
+      panic("binit");
+  release(&bcache.lock);
+}
+
+// Return the buffer for (dev, blockno) in bucket bk, or 0 if
+// it is not cached.  Caller holds bk->lock.
+static struct buf*
+blookup(struct bucket *bk, uint dev, uint blockno) {
+  struct buf *b;
+
+  for(b = bk->head; b; b = b->hnext)
+    if(b->dev == dev && b->blockno == blockno && (b->flags & B_VALID || b->refcnt > 0))
+      return b;
+  return 0;
+}
+
+// Was b last released by the system call in progress?  One call
+// can look a block up several times, as bmap() does the indirect
+// block for each block of a file.
+static int
+bsameop(struct buf *b) {
+  struct proc *p = myproc();
+
+  return p && b->lastpid == p->pid && b->lastop == p->nsyscall;
+}
+
+// Return the buffer for (dev, blockno) in bucket bk with a new
+// reference, or 0 if it is not cached.  Caller holds bk->lock.
+static struct buf*
+bfind(struct bucket *bk, uint dev, uint blockno) {
+  struct buf *b;
+
+  if((b = blookup(bk, dev, blockno)) == 0)
+    return 0;
+  // Used again since it was released, and not by the same
+  // system call.  The first use of a block read ahead doesn't
+  // count.
+  if(b->hot < 0)
+    b->hot = 0;
+  else if(b->refcnt == 0 && (b->flags & B_VALID) && !bsameop(b))
+    b->hot = 1;
+  b->refcnt++;
+  return b;
+}
+
+// Take unused buffer b out of its bucket.  Returns 0 if it is
+// in use after all.  Even if refcnt==0, B_DIRTY indicates a
+// buffer is in use because log.c has modified it but not yet
+// committed it.  Caller holds bcache.lock, so b stays in its
+// bucket until we lock it.
+static int
+bunhash(struct buf *b) {
+  struct buf **pp;
+  struct bucket *bk = bhash(b->dev, b->blockno);
+
+  acquire(&bk->lock);
+  if(b->refcnt != 0 || (b->flags & B_DIRTY)){
+    release(&bk->lock);
+    return 0;
+  }
+  for(pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+    ;
+  *pp = b->hnext;
+  release(&bk->lock);
+  return 1;
+}
+
+// Put b, which is not in any bucket, in the one for its block.
+static void
+bhashin(struct buf *b) {
+  struct bucket *bk = bhash(b->dev, b->blockno);
+
+  acquire(&bk->lock);
+  b->hnext = bk->head;
+  bk->head = b;
+  release(&bk->lock);
+}
+
+static int
+bclass(struct buf *b) {
+  if(b->flags & B_META)
+    return BMETA;
+  return b->hot > 0 ? BHOT : BCOLD;
+}
+
+// The least recently used buffer on replacement list l that can
+// be recycled, or 0.  A buffer stays on its list when it is looked
+// up again (bfind only takes the bucket lock), so drop the ones in
+// use as we come to them: brelse() puts them back.  Dirty ones
+// wait for log.c to write them.  Caller holds bcache.lrulock.
+static struct buf*
+lrufirst(int l) {
+  struct buf *b, *next;
+
+  for(b = bcache.lru[l].head; b; b = next){
+    next = b->lnext;
+    if(b->refcnt != 0)
+      lruremove(b);
+    else if((b->flags & B_DIRTY) == 0)
+      return b;
   }
+  return 0;
+}
+
+// Pick an unused buffer to recycle and take it out of its bucket.
+//
+// Replacement is a simplified 2Q.  A block starts out cold, and
+// becomes hot when it is looked up again after being released.
+// Once unused cold blocks fill a quarter of the cache the oldest
+// cold one is the victim, so a scan that reads each block once
+// just recycles its own buffers; below that the least recently
+// used hot one goes, giving newly read blocks a chance to be used
+// again.  Metadata (inode, bitmap and directory blocks, the log
+// header; see breadmeta) is only recycled when no data buffer
+// is unused, so lookups stay cached through bulk I/O.
+//
+// A buffer that holds no block at all is taken first.  refcnt is
+// read without the bucket lock to choose, then checked again with
+// it.  Caller holds bcache.lock.
+static struct buf*
+bvictim(void) {
+  static int coldfirst[NLRU] = { BFREE, BCOLD, BHOT, BMETA };
+  static int hotfirst[NLRU] = { BFREE, BHOT, BCOLD, BMETA };
+  struct buf *victim;
+  int *order, i;
+
+  for(;;){
+    victim = 0;
+    acquire(&bcache.lrulock);
+    if(bcache.lru[BCOLD].n >= bcache.npages*BUFPERPAGE/4)
+      order = coldfirst;
+    else
+      order = hotfirst;
+    for(i = 0; i < NLRU && victim == 0; i++)
+      victim = lrufirst(order[i]);
+    if(victim)
+      lruremove(victim);
+    release(&bcache.lrulock);
+    // Every buffer is in use: make more rather than give up.
+    if(victim == 0){
+      if(bgrow() < 0)
+        panic("bget: no buffers");
+      continue;
+    }
+    if(bunhash(victim))
+      return victim;
+    // Taken while we looked; brelse() puts it back on a list.
+  }
+}
+
+// Give up to n pages of unused buffers back to kalloc(), for when
+// memory runs out.  Skipped if the cache is busy resizing, which
+// includes when the caller is bgrow() itself, out of memory.
+// Returns the number of pages freed.
+int
+bshrink(int n) {
+  struct bufpage *pg, **pp;
+  struct buf *b;
+  int freed = 0, mine;
+
+  pushcli();
+  mine = holding(&bcache.lock);
+  popcli();
+  if(mine || !tryacquire(&bcache.lock))
+    return 0;
+  pp = &bcache.pages;
+  while((pg = *pp) != 0 && freed < n && bcache.npages > MINPAGES){
+    // Unhash every buffer on the page, or put back the
+    // ones taken if any is in use.
+    for(b = pg->buf; b < pg->buf+BUFPERPAGE; b++)
+      if(!bunhash(b))
+        break;
+    if(b < pg->buf+BUFPERPAGE){
+      while(--b >= pg->buf)
+        bhashin(b);
+      pp = &pg->next;
+      continue;
+    }
+    acquire(&bcache.lrulock);
+    for(b = pg->buf; b < pg->buf+BUFPERPAGE; b++)
+      if(b->lru >= 0)
+        lruremove(b);
+    release(&bcache.lrulock);
+    *pp = pg->next;
+    bcache.npages--;
+    bcache.shrinks++;
+    kfree((char*)pg);
+    freed++;
+  }
+  release(&bcache.lock);
+  return freed;
 }
 
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
+// With missonly, return 0 instead if the block is cached: the
+// buffer returned is then one no other process can be holding.
 static struct buf*
-bget(uint dev, uint blockno) {
+bget(uint dev, uint blockno, int missonly) {
   struct buf *b;
-
-  acquire(&bcache.lock);
+  struct bucket *bk = bhash(dev, blockno);
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
-    if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
-    }
+  acquire(&bk->lock);
+  if(missonly && blookup(bk, dev, blockno)){
+    release(&bk->lock);
+    return 0;
+  }
+  if((b = bfind(bk, dev, blockno)) != 0)
+    bk->hits++;
+  release(&bk->lock);
+  if(b){
+    acquiresleep(&b->lock);
+    return b;
   }
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+  // Not cached; recycle an unused buffer.  Look again once
+  // misses are serialized: another process may have brought
+  // the block in since.
+  acquire(&bcache.lock);
+  acquire(&bk->lock);
+  if(missonly && blookup(bk, dev, blockno)){
+    release(&bk->lock);
+    release(&bcache.lock);
+    return 0;
+  }
+  b = bfind(bk, dev, blockno);
+  release(&bk->lock);
+  if(b == 0){
+    bcache.misses++;
+    // Only worth a page if no buffer is free (a hint: read
+    // without bcache.lrulock).
+    if(bcache.lru[BFREE].n == 0 && bshouldgrow())
+      bgrow();
+    b = bvictim();
+    b->dev = dev;
+    b->blockno = blockno;
+    b->flags = 0;
+    b->hot = 0;
+    b->refcnt = 1;
+    bhashin(b);
+  }
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
+}
+
+// Fill in cache statistics.
+void
+bcachestat(struct bcachestat *st) {
+  struct bucket *bk;
+  struct bufpage *pg;
+  struct buf *b;
+
+  st->hits = 0;
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+    st->hits += bk->hits;
+  st->nbuf = bcache.npages * BUFPERPAGE;
+  st->maxbuf = ktotalpages()/4 * BUFPERPAGE;
+  st->misses = bcache.misses;
+  st->grows = bcache.grows;
+  st->shrinks = bcache.shrinks;
+  st->nhot = st->nmeta = 0;
+  acquire(&bcache.lock);
+  for(pg = bcache.pages; pg; pg = pg->next){
+    for(b = pg->buf; b < pg->buf+BUFPERPAGE; b++){
+      if((b->flags & B_VALID) == 0)
+        continue;
+      if(bclass(b) == BHOT)
+        st->nhot++;
+      else if(bclass(b) == BMETA)
+        st->nmeta++;
     }
   }
-  panic("bget: no buffers");
+  release(&bcache.lock);
 }
 
 // Return a locked buf with the contents of the indicated block.
+// A block read this way is file data until breadmeta() says
+// otherwise: blocks are freed and reused for other purposes.
 struct buf*
 bread(uint dev, uint blockno) {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
+  b->flags &= ~B_META;
   if((b->flags & B_VALID) == 0) {
     iderw(b);
+    if(b->flags & B_ERROR)
+      panic("bread: disk error");
   }
   return b;
 }
 
+// Like bread, but if the block has to come from disk, also read
+// those of the nra blocks in ra (typically the ones after it in
+// a file) that aren't cached, and leave them in the cache.
+// Blocks adjacent on disk go in one disk request.
+// Returns 0 if the disk fails to read the block.
+struct buf*
+breadn(uint dev, uint blockno, uint *ra, int nra) {
+  struct buf *b, *bufs[1+NREADAHEAD];
+  struct bucket *bk;
+  int i, n;
+
+  b = bget(dev, blockno, 0);
+  b->flags &= ~B_META;
+  if(b->flags & B_VALID)
+    return b;
+  bufs[0] = b;
+  n = 1;
+  for(i = 0; i < nra && n < NELEM(bufs); i++)
+    if((bufs[n] = bget(dev, ra[i], 1)) != 0)
+      n++;
+  iderwv(bufs, n);
+  for(i = 1; i < n; i++){
+    // Not used yet, unless someone is already waiting for it.
+    bk = bhash(dev, bufs[i]->blockno);
+    acquire(&bk->lock);
+    if(bufs[i]->refcnt == 1)
+      bufs[i]->hot = -1;
+    release(&bk->lock);
+    brelse(bufs[i]);
+  }
+  if(b->flags & B_ERROR){
+    brelse(b);
+    return 0;
+  }
+  return b;
+}
+
+// Is block blockno of dev cached?  Only a hint: it may be
+// read in or recycled as soon as this returns.
+int
+bcached(uint dev, uint blockno) {
+  struct bucket *bk = bhash(dev, blockno);
+  int r;
+
+  acquire(&bk->lock);
+  r = blookup(bk, dev, blockno) != 0;
+  release(&bk->lock);
+  return r;
+}
+
+// Like bread, for a block of file system metadata, which the
+// cache keeps in preference to file data until it is next read
+// with bread.
+struct buf*
+breadmeta(uint dev, uint blockno) {
+  struct buf *b;
+
+  b = bread(dev, blockno);
+  b->flags |= B_META;
+  return b;
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b) {
@@ -111,28 +558,47 @@ bwrite(struct buf *b) {
   iderw(b);
 }
 
+// Write the contents of n locked buffers to disk, as bwrite,
+// queueing them together so adjacent blocks go in one request.
+void
+bwritev(struct buf **bufs, int n) {
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bufs[i]->lock))
+      panic("bwritev");
+    bufs[i]->flags |= B_DIRTY;
+  }
+  iderwv(bufs, n);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
+// Put it at the most recently used end of the replacement list
+// for its class, for choosing the least recently used victim.
 void
 brelse(struct buf *b) {
+  struct bucket *bk;
+  struct proc *p = myproc();
+
   if(!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  // b can't change bucket while we hold a reference.
+  bk = bhash(b->dev, b->blockno);
+  acquire(&bk->lock);
   b->refcnt--;
   if (b->refcnt == 0) {
     // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    b->lastpid = p ? p->pid : 0;
+    b->lastop = p ? p->nsyscall : 0;
+    acquire(&bcache.lrulock);
+    lruappend(b, (b->flags & B_VALID) ? bclass(b) : BFREE);
+    release(&bcache.lrulock);
   }
   
-  release(&bcache.lock);
+  release(&bk->lock);
 }
 //PAGEBREAK!
 // Blank page.
@@ -10,13 +10,21 @@ struct buf {
   struct sleeplock lock;
   struct semaphore sem;
   uint refcnt;
-  struct buf *prev; // LRU cache list
-  struct buf *next;
+  struct buf *lprev; // replacement list (see bvictim)
+  struct buf *lnext;
+  int lru;          // which replacement list it is on, or -1
+  int lastpid;      // process and system call that last
+  uint lastop;      //   released it (see bfind)
+  int hot;          // used again after release (see bvictim)
+  struct buf *hnext; // hash bucket chain
   struct buf *qnext; // disk queue
+  uint64 qtime;     // nsecs() when queued for disk
   uchar data[BSIZE];
 };
 
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_META  0x8  // buffer holds file system metadata
+#define B_ERROR 0x10 // the disk failed the last transfer
 
 #endif
@@ -6,3 +6,10 @@ struct rtcdate {
   uint month;
   uint year;
 };
+
+#define CLOCK_MONOTONIC 1  // Time since boot, from the calibrated TSC
+
+struct timespec {
+  uint tv_sec;
+  uint tv_nsec;
+};
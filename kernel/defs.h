@@ -3,6 +3,10 @@
 
 #include "types.h"
 
+struct bcachestat;
+struct pcidev;
+struct ioq;
+struct diskstat;
 struct buf;
 struct context;
 struct file;
@@ -15,13 +19,23 @@ struct sleeplock;
 struct stat;
 struct superblock;
 struct semaphore;
+struct timer;
+struct work;
+struct lockstat;
+struct waitq;
 struct input;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+struct buf*     breadmeta(uint, uint);
+struct buf*     breadn(uint, uint, uint*, int);
+int             bcached(uint, uint);
+void            bwritev(struct buf**, int);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+int             bshrink(int);
+void            bcachestat(struct bcachestat*);
 
 // console.c
 void            consoleinit(void);
@@ -72,6 +86,16 @@ int             unmount(char *);
 void            ideinit(void);
 void            ideintr(uint, uint);
 void            iderw(struct buf*);
+void            iderwv(struct buf**, int);
+
+// iosched.c
+void            ioqadd(struct ioq*, struct buf*);
+struct buf*     ioqnext(struct ioq*, int);
+void            ioqueued(struct buf*);
+void            iocmd(uint);
+void            iodone(struct buf*);
+int             iosched(char*);
+int             diskstat(struct diskstat*, int);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -83,6 +107,8 @@ char*           kalloc(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+uint            kfreepages(void);
+uint            ktotalpages(void);
 
 // kbd.c
 void            kbdintr(void);
@@ -94,6 +120,12 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(int, int);
+int             lapictimer(void);
+void            lapicdeadline(uint64);
+void            lapicnexttick(uint64);
+void            lapictickstart(void);
+uint64          nsecs(void);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -107,6 +139,12 @@ void            end_op();
 extern int      ismp;
 void            mpinit(void);
 
+// pci.c
+void            pciinit(void);
+struct pcidev*  pcifind(int, int, int);
+struct pcidev*  pcifindid(int, int, int);
+void            pcienable(struct pcidev*);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -122,19 +160,30 @@ int             pipewrite(struct pipe*, char*, int);
 int             cpuid(void);
 void            exit(int);
 int             fork(void);
+int             getaffinity(int);
 int             growproc(int);
 int             kill(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
 void            procdump(void);
+int             procinfo(uint, int);
+int             cpuinfo(uint, int);
+int             schedstat(uint, int);
+void            cpuacct(int);
+int             proclimit(int);
 void            idle(void) __attribute__((noreturn));
 void            reschedule(void);
+int             setaffinity(int, uint);
 void            setproc(struct proc*);
+int             tickstop(void);
 void            sleep(void*, struct spinlock*);
+int             sleeptimeout(void*, struct spinlock*, uint);
 void            userinit(void);
 int             wait(int *);
 void            wakeup(void*);
+void            sleepq(struct waitq*, struct spinlock*);
+void            wakeone(struct waitq*);
 void            yield(void);
 int             getdate(struct rtcdate *);
 int             setdate(struct rtcdate *);
@@ -152,6 +201,7 @@ void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
 void            release(struct spinlock*);
+int             tryacquire(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
@@ -168,6 +218,7 @@ void*           memset(void*, int, uint);
 char*           safestrcpy(char*, const char*, int);
 int             strlen(const char*);
 int             strncmp(const char*, const char*, uint);
+uint64          udiv64(uint64, uint, uint*);
 char*           strncpy(char*, const char*, int);
 
 // syscall.c
@@ -182,10 +233,18 @@ void            syscall(void);
 
 // timer.c
 void            timerinit(void);
+void            timeradd(struct timer*, uint, void (*)(void*), void*);
+int             timerdel(struct timer*);
+void            timertick(void);
+uint            timernext(void);
+int             sleepticks(uint);
+uint64          hrtimerrun(uint64);
+int             nanosleep(uint64);
 
 // trap.c
 void            idtinit(void);
 extern uint     ticks;
+int             tickupdate(void);
 void            tvinit(void);
 extern struct spinlock tickslock;
 
@@ -193,6 +252,13 @@ extern struct spinlock tickslock;
 void            uartinit(void);
 void            uartintr(int);
 
+// virtioblk.c
+void            virtioinit(void);
+int             virtiodisk(uint);
+uint            virtiosize(uint);
+void            virtiorw(uint, struct buf**, int);
+int             virtiointr(int);
+
 // vm.c
 void            seginit(void);
 void            kvmalloc(void);
@@ -210,6 +276,18 @@ void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
 
+// workqueue.c
+void            workinit(void);
+void            workstart(void);
+void            initwork(struct work*, void (*)(void*), void*);
+int             queuework(struct work*);
+
+// lockstat.c
+struct lockstat* lockclass(char*, int);
+void            lockacquired(struct lockstat*, int, uint64);
+void            lockreleased(struct lockstat*, uint64);
+int             lockstat(uint, int);
+
 // semaphore.c
 void            sem_init(struct semaphore*, int);
 void            sem_P(struct semaphore*);
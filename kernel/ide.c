@@ -1,4 +1,7 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code.  Transfers use bus-master DMA when the PCI IDE
+// controller and the disk support it, and PIO otherwise.
+// Block devices 0 to DISK_NUM-1 are the IDE disks; iderw() passes
+// requests for the ones after them to the virtio driver.
 
 #include "types.h"
 #include "defs.h"
@@ -13,29 +16,117 @@
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
+#include "workqueue.h"
+#include "pci.h"
+#include "iosched.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
 #define IDE_DRDY      0x40
 #define IDE_DF        0x20
+#define IDE_DRQ       0x08
 #define IDE_ERR       0x01
 
 #define IDE_CMD_READ  0x20
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+#define IDE_CMD_IDENT 0xec
+
+/* Bus master IDE registers, from the channel's bmbase */
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4     /* physical address of the PRD table */
+
+#define BM_START      0x01  /* BM_CMD: start transfer */
+#define BM_READ       0x08  /* BM_CMD: disk to memory */
+#define BM_ERR        0x02  /* BM_STATUS: write 1 to clear */
+#define BM_INTR       0x04  /* BM_STATUS: write 1 to clear */
+#define BM_SIMPLEX    0x80  /* BM_STATUS: one channel at a time */
+
+/* Most sectors in one command: the sector count register */
+/* holds 0 for 256 */
+#define IDE_MAXSECT   256
 
 #define DISK_NUM      4
 
-static struct spinlock idelock;
+/*
+*   Physical region descriptor: one piece of a DMA transfer.
+*   Member addr: Physical address.
+*   Member len: Byte count (0 means 64K).
+*   Member flags: PRD_EOT on the last entry of a table.
+*/
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+
+#define PRD_EOT       0x8000
 
-/* idequeue points to the buf now being read/written to the disk */
-/* idequeue->qnext points to the next buf to be processed */
-/* idelock must be held while manipulating queue */
-static struct buf *idequeue;
+/* One PRD table per channel, one entry per block.  A 2K table */
+/* aligned this way can't cross a 64K boundary, which the */
+/* controller doesn't allow. */
+static struct prd prdtab[2][IDE_MAXSECT] __attribute__((aligned(2*IDE_MAXSECT*sizeof(struct prd))));
+
+/*
+*   IDE channel.  Each channel has its own queue and lock, so the
+*   primary and secondary controllers transfer in parallel.
+*   Member lock: Protects the queue and the active command.
+*   Completed requests are finished by a workqueue thread, which
+*   may sleep, so it is a sleeplock rather than a spinlock.
+*   Member queue: The buf now being read/written to the disk (the
+*   first of several, linked by qnext, if the command covers
+*   adjacent blocks).
+*   Member q: Requests waiting for the disks on the channel, in
+*   the order the I/O scheduler picks (see iosched.c).
+*   Member base: Command block registers.
+*   Member ctl: Control register.
+*   Member done: Finishes the active request (see idedone).
+*   Member nsect, ndone: Sectors in the active command, and
+*   transferred so far.
+*   Member cur: Buf the next sector goes to or comes from.
+*   Member bmbase: Bus master registers; 0 if there are none.
+*   Member dma: Non-zero if the active command uses DMA.
+*   Member prd: PRD table for DMA commands.
+*/
+static struct idechan {
+  struct sleeplock lock;
+  struct buf *queue;
+  struct ioq q;
+  uint base;
+  uint ctl;
+  struct work done;
+  int nsect;
+  int ndone;
+  struct buf *cur;
+  uint bmbase;
+  int dma;
+  struct prd *prd;
+} idechan[2] = {
+  { .base = BASE_ADDR1, .ctl = BASE_ADDR2 },
+  { .base = BASE_ADDR3, .ctl = BASE_ADDR4 }
+};
 
 static int havedisk[DISK_NUM];
-static void idestart(struct buf*, uint, uint);
+/* Sectors moved per interrupt (SET MULTIPLE MODE); 1 if the */
+/* disk can't do multiple-sector transfers */
+static int multsect[DISK_NUM];
+/* Blocks on the disk, from IDENTIFY */
+static uint disksize[DISK_NUM];
+/* Disk does DMA */
+static int dmadisk[DISK_NUM];
+static void idestart(struct idechan*);
+static void idedone(void*);
+
+/* Channel of the disk b is on */
+static struct idechan*
+idechanof(struct buf *b) {
+  return &idechan[b->dev < 2 ? 0 : 1];
+}
 
 /* Wait for IDE controllers to become ready */
 static int
@@ -50,6 +141,31 @@ idewait(int checkerr, uint ba) {
   return 0;
 }
 
+/* Wait for the disk to be ready to move data */
+static int
+idewaitdrq(uint ba) {
+  int r;
+
+  while(((r = inb(ba + 7)) & (IDE_BSY|IDE_DRQ)) != IDE_DRQ)
+    if(!(r & IDE_BSY) && (r & (IDE_DF|IDE_ERR)))
+      return -1;
+  return 0;
+}
+
+/* Is there a disk with block device number dev? */
+static int
+diskok(uint dev) {
+  return dev < DISK_NUM ? havedisk[dev] : virtiodisk(dev - DISK_NUM);
+}
+
+/* Blocks of disk dev its device node can reach */
+static uint
+diskblocks(uint dev) {
+  uint n = dev < DISK_NUM ? disksize[dev] : virtiosize(dev - DISK_NUM);
+
+  return n < DSIZE ? n : DSIZE;
+}
+
 /* Check if disk is present */
 static void
 diskp(uint dnum, uint ba, uint d) {
@@ -62,13 +178,50 @@ diskp(uint dnum, uint ba, uint d) {
   }
 }
 
+/* Record the size of disk dnum and whether it does DMA, and */
+/* turn on multiple-sector transfers for PIO with as many */
+/* sectors per interrupt as IDENTIFY says it can do */
+static void
+ideidentify(uint dnum, uint ba, uint ctl, uint d) {
+  ushort id[SECTOR_SIZE/2];
+  int max;
+
+  multsect[dnum] = 1;
+  disksize[dnum] = FSSIZE;
+  /* Poll: an interrupt now would look like a finished request */
+  outb(ctl, 2);
+  outb(ba + 6, 0xe0 | (d<<4));
+  outb(ba + 7, IDE_CMD_IDENT);
+  if(idewaitdrq(ba) >= 0){
+    insl(ba, id, sizeof(id)/4);
+    /* Word 49, bit 8: DMA supported */
+    dmadisk[dnum] = (id[49] & (1<<8)) != 0;
+    /* Words 60-61: sectors addressable with 28-bit LBA */
+    disksize[dnum] = (id[60] | (uint)id[61] << 16) / (BSIZE/SECTOR_SIZE);
+    /* Word 47: maximum sectors per interrupt for READ/WRITE MULTIPLE */
+    max = id[47] & 0xff;
+    if(max > 1){
+      outb(ba + 2, max);
+      outb(ba + 7, IDE_CMD_SETMUL);
+      if(idewait(1, ba) >= 0)
+        multsect[dnum] = max;
+    }
+  }
+  outb(ctl, 0);
+}
+
 int
 ideread(struct inode *ip, char *dst, int n, uint off) { 
-  uint block_addr, total, n_bytes;
+  uint block_addr, total, n_bytes, ra[NREADAHEAD], size;
+  int nra;
   struct buf *b;
 
+  if(!diskok(ip->minor))
+    return -1;
+
   /* Test for End of File */
-  if((off > (DSIZE*BSIZE)) || (off+n > (DSIZE*BSIZE)))
+  size = diskblocks(ip->minor);
+  if((off > (size*BSIZE)) || (off+n > (size*BSIZE)))
     return -1;
 
   iunlock(ip);
@@ -77,8 +230,13 @@ ideread(struct inode *ip, char *dst, int n, uint off) {
   for(total = 0; total < n; total+=n_bytes, off+=n_bytes, dst+=n_bytes) {
     /* Calculate disk block address */ 
     block_addr = ((off/BSIZE) % DSIZE);
-    /* Read associated block */
-    b = bread(ip->minor, block_addr);
+    /* Read associated block, and the ones after it if it isn't cached */
+    for(nra = 0; nra < NREADAHEAD && block_addr+1+nra < size; ++nra)
+      ra[nra] = block_addr+1+nra;
+    if((b = breadn(ip->minor, block_addr, ra, nra)) == 0) {
+      ilock(ip);
+      return -1;
+    }
     /* Determine hfow many bytes to read next */
     n_bytes = min(n - total, BSIZE - off%BSIZE);
     /* Read and update data buffer from block */
@@ -94,17 +252,21 @@ ideread(struct inode *ip, char *dst, int n, uint off) {
 
 int
 idewrite(struct inode *ip, char *buf, int n, uint off) { 
-  uint block_addr, total, n_bytes;
+  uint block_addr, total, n_bytes, size;
   struct buf *b;
 
-  /* Test for End of File */
-  if((off > (DSIZE*BSIZE)) || (off+n > (DSIZE*BSIZE)))
-    return -1;
-
   /* Prevent Writing to disk 0 or disk 1*/
   if(ip->minor == 0 || ip->minor == 1) 
     return -1;
 
+  if(!diskok(ip->minor))
+    return -1;
+
+  /* Test for End of File */
+  size = diskblocks(ip->minor);
+  if((off > (size*BSIZE)) || (off+n > (size*BSIZE)))
+    return -1;
+
   iunlock(ip);
 
   /* Read n bytes from disk and write to Source */
@@ -127,9 +289,38 @@ idewrite(struct inode *ip, char *buf, int n, uint off) {
   return n;
 }
 
+/* Find the PCI IDE controller's bus master registers and let */
+/* it do DMA.  Without one, every transfer is PIO. */
+static void
+idedmainit(void) {
+  struct pcidev *pd;
+  uint bm;
+
+  if((pd = pcifind(PCI_CLASS_STORAGE, PCI_SUBCLASS_IDE, 0)) == 0)
+    return;
+  /* Bit 7 of the programming interface: bus master capable; */
+  /* BAR 4 is an I/O range for it */
+  if(!(pd->progif & 0x80) || !(pd->bar[4] & 1))
+    return;
+  bm = pd->bar[4] & ~3;
+  pcienable(pd);
+  for(int i = 0; i < 2; ++i) {
+    idechan[i].bmbase = bm + 8*i;
+    idechan[i].prd = prdtab[i];
+    /* A simplex controller can't DMA on both channels at once, */
+    /* and the channels run independently: PIO on the second */
+    if(inb(bm + BM_STATUS) & BM_SIMPLEX)
+      break;
+  }
+}
+
 void
 ideinit(void) {
-  initlock(&idelock, "ide");
+  for(int i = 0; i < 2; ++i) {
+    initsleeplock(&idechan[i].lock, "ide");
+    initwork(&idechan[i].done, idedone, &idechan[i]);
+  }
+  idedmainit();
   
   /* Initialize IDE Device Switch entry */
   devsw[IDE].write = idewrite;
@@ -143,8 +334,10 @@ ideinit(void) {
   /* Check if disk 1 is present */
   diskp(1, BASE_ADDR1, 1);
   
-  /* Enable IRQ 15 & wait for Secondary IDE controller to be ready */
-  ioapicenable(IRQ_IDE_S, ncpu - 1);
+  /* Enable IRQ 15 & wait for Secondary IDE controller to be ready. */
+  /* Its interrupts go to another CPU, so both channels' workqueue */
+  /* threads can run at once. */
+  ioapicenable(IRQ_IDE_S, ncpu > 1 ? ncpu - 2 : 0);
   idewait(0, BASE_ADDR3);
   
   /* Check if disk 2 is present */
@@ -152,38 +345,99 @@ ideinit(void) {
   /* Check if disk 3 is present */
   diskp(3, BASE_ADDR3, 1);
 
+  for(uint i = 0; i < DISK_NUM; ++i)
+    if(havedisk[i])
+      ideidentify(i, i < 2 ? BASE_ADDR1 : BASE_ADDR3,
+                  i < 2 ? BASE_ADDR2 : BASE_ADDR4, i & 1);
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Move the next sectors of the active command on channel ch,
+// as many as the disk transfers per interrupt, between the
+// disk and the queued bufs.  Caller must hold ch->lock.
+static void
+idexfer(struct idechan *ch, int write) {
+  int n, sector_per_block = BSIZE/SECTOR_SIZE;
+  uchar *p;
+
+  n = min(multsect[ch->cur->dev], ch->nsect - ch->ndone);
+  while(n-- > 0){
+    p = ch->cur->data + (ch->ndone % sector_per_block) * SECTOR_SIZE;
+    if(write)
+      outsl(ch->base, p, SECTOR_SIZE/4);
+    else
+      insl(ch->base, p, SECTOR_SIZE/4);
+    if(++ch->ndone % sector_per_block == 0)
+      ch->cur = ch->cur->qnext;
+  }
+}
+
+// Point channel ch's PRD table at the data of the nblock bufs
+// queued from b, for a DMA command, and set the engine up for
+// the transfer.  Caller must hold ch->lock.
+static void
+idedmasetup(struct idechan *ch, struct buf *b, int nblock) {
+  int i;
+
+  for(i = 0; i < nblock; ++i, b = b->qnext) {
+    ch->prd[i].addr = V2P(b->data);
+    ch->prd[i].len = BSIZE;
+    ch->prd[i].flags = 0;
+  }
+  ch->prd[nblock-1].flags = PRD_EOT;
+  outl(ch->bmbase + BM_PRDT, V2P(ch->prd));
+  outb(ch->bmbase + BM_STATUS, BM_ERR | BM_INTR);
+}
+
+// Start the next request the I/O scheduler picks from channel
+// ch's waiting requests, together with those that continue it on
+// disk, in one command of up to IDE_MAXSECT sectors.  Does
+// nothing if none are waiting.  Caller must hold ch->lock.
 static void
-idestart(struct buf *b, uint channel, uint channelctr) {
-  if(b == 0)
-    panic("idestart");
-  if(b->blockno >= FSSIZE)
+idestart(struct idechan *ch) {
+  struct buf *b, *last;
+  int nblock;
+  int sector_per_block =  BSIZE/SECTOR_SIZE;
+
+  if((b = ch->queue = ioqnext(&ch->q, IDE_MAXSECT/sector_per_block)) == 0)
+    return;
+  if(b->blockno >= disksize[b->dev])
     panic("incorrect blockno");
     
-  int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
-
-  if (sector_per_block > 7) 
-    panic("idestart");
-
-  idewait(0, channel);
-  outb(channelctr, 0);                  // generate interrupt
-  outb(channel + 2, sector_per_block);  // number of sectors
-  outb(channel + 3, sector & 0xff);
-  outb(channel + 4, (sector >> 8) & 0xff);
-  outb(channel + 5, (sector >> 16) & 0xff);
-  outb(channel + 6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
-    outb(channel + 7, write_cmd);
-    outsl(channel, b->data, BSIZE/4);
+  int read_cmd = (multsect[b->dev] == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (multsect[b->dev] == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+
+  for(nblock = 1, last = b; last->qnext; last = last->qnext)
+    nblock++;
+
+  ch->nsect = nblock * sector_per_block;
+  ch->ndone = 0;
+  ch->cur = b;
+  ch->dma = ch->bmbase && dmadisk[b->dev];
+  if(ch->dma)
+    idedmasetup(ch, b, nblock);
+
+  idewait(0, ch->base);
+  outb(ch->ctl, 0);                          // generate interrupt
+  outb(ch->base + 2, ch->nsect & 0xff);      // number of sectors
+  outb(ch->base + 3, sector & 0xff);
+  outb(ch->base + 4, (sector >> 8) & 0xff);
+  outb(ch->base + 5, (sector >> 16) & 0xff);
+  outb(ch->base + 6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+  if(ch->dma){
+    // The controller moves everything and interrupts once.
+    outb(ch->base + 7, (b->flags & B_DIRTY) ? IDE_CMD_WRDMA : IDE_CMD_RDDMA);
+    outb(ch->bmbase + BM_CMD, ((b->flags & B_DIRTY) ? 0 : BM_READ) | BM_START);
+  } else if(b->flags & B_DIRTY){
+    outb(ch->base + 7, write_cmd);
+    // The first sectors go now; the disk interrupts for the rest.
+    if(idewaitdrq(ch->base) >= 0)
+      idexfer(ch, 1);
   } else {
-    outb(channel + 7, read_cmd);
+    outb(ch->base + 7, read_cmd);
   }
 }
 
@@ -194,36 +448,87 @@ idestart(struct buf *b, uint channel, uint channelctr) {
   Controller Determined by parameters:
     channel - primary/secondary channel
     channelctrl - primary/secondary channel control port
+  Moving the data and starting the next request are left
+  to idedone(), which runs in a workqueue thread.
 */
 void
 ideintr(uint channel, uint channelctr) {
+  queuework(channel == BASE_ADDR1 ? &idechan[0].done : &idechan[1].done);
+}
+
+/*
+  Continue the active command on channel arg: the disk interrupts
+  each time it has a block of sectors ready (read) or wants the
+  next one (write), and once more when a write is done.  When the
+  command is over, finish its requests and start the next.
+  Runs in a workqueue thread after ideintr().
+*/
+static void
+idedone(void *arg) {
+  struct idechan *ch = arg;
   struct buf *b;
-  // First queued buffer is the active request.
-  acquire(&idelock);
+  int write, st, err = 0;
+  // First buffer of the active command.
+  acquiresleep(&ch->lock);
 
-  // If idequeue is empty (no disk access requests)
-  if((b = idequeue) == 0){
-    release(&idelock);
+  // If no command is active (spurious interrupt)
+  if((b = ch->queue) == 0){
+    releasesleep(&ch->lock);
     return;
   }
-  // Whatever was at the top of the queue has been serviced, so move to next entry in queue
-  idequeue = b->qnext;
-
-  // Read data if needed
-  if(!(b->flags & B_DIRTY) && idewait(1, channel) >= 0)
-    insl(channel, b->data, BSIZE/4);
-
-  // Wake process waiting for this buf
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  sem_V(&b->sem);
-
-  // Start disk on next buf in queue.
-  // If idequeue is not empty (more requests to service)
-  if(idequeue != 0)
-    idestart(idequeue, channel, channelctr);
+
+  write = b->flags & B_DIRTY;
+  if(ch->dma){
+    // One interrupt at the end of the whole transfer.
+    st = inb(ch->bmbase + BM_STATUS);
+    if(!(st & BM_INTR)){
+      releasesleep(&ch->lock);
+      return;
+    }
+    outb(ch->bmbase + BM_CMD, 0);
+    outb(ch->bmbase + BM_STATUS, BM_ERR | BM_INTR);
+    // The bus master or the disk may have failed it.
+    if((st & BM_ERR) || idewait(1, ch->base) < 0)
+      err = 1;
+  } else if(idewait(1, ch->base) < 0){
+    // An error ends the command early.
+    err = 1;
+  } else if(ch->ndone < ch->nsect){
+    // Move the next sectors.
+    idexfer(ch, write);
+    // A read is done once the last sectors are in, a write
+    // when the disk interrupts again after taking them.
+    if(write || ch->ndone < ch->nsect){
+      releasesleep(&ch->lock);
+      return;
+    }
+  }
+
+  if(err)
+    cprintf("ide: disk %d: %s error at block %d\n",
+            b->dev, write ? "write" : "read", b->blockno);
+
+  // The active requests have been serviced.  After an error
+  // none of their data can be trusted, so don't cache it.
+  while((b = ch->queue) != 0){
+    ch->queue = b->qnext;
+
+    // Wake process waiting for this buf
+    iodone(b);
+    if(err){
+      b->flags &= ~(B_VALID|B_DIRTY);
+      b->flags |= B_ERROR;
+    } else {
+      b->flags |= B_VALID;
+      b->flags &= ~B_DIRTY;
+    }
+    sem_V(&b->sem);
+  }
+
+  // Start disk on the next waiting request, if any
+  idestart(ch);
   
-  release(&idelock);
+  releasesleep(&ch->lock);
 }
 
 //PAGEBREAK!
@@ -234,43 +539,60 @@ ideintr(uint channel, uint channelctr) {
 */
 void
 iderw(struct buf *b) {
-  struct buf **pp; 
-
-  if(!holdingsleep(&b->lock))
-    panic("iderw: buf not locked");
-  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID) // If B_VALID set & B_DIRT NOT SET
-    panic("iderw: nothing to do");
-  for(uint i = 0; i < DISK_NUM; ++i) {
-    if(b->dev != 0 && !havedisk[i])
-      panic("iderw: an ide disk is not present");
+  iderwv(&b, 1);
+}
+
+/*
+  Sync n bufs with disk, as iderw().  They are all queued before
+  waiting for any, so adjacent blocks go in one command.
+*/
+void
+iderwv(struct buf **bufs, int n) {
+  struct idechan *ch;
+  struct buf *b;
+  int i;
+
+  // Disks after the IDE ones are virtio disks.
+  if(n > 0 && bufs[0]->dev >= DISK_NUM) {
+    virtiorw(bufs[0]->dev - DISK_NUM, bufs, n);
+    return;
   }
 
-  // Initialize semaphore
-  sem_init(&b->sem, 0);
+  for(i = 0; i < n; ++i) {
+    b = bufs[i];
+    if(!holdingsleep(&b->lock))
+      panic("iderw: buf not locked");
+    if((b->flags & (B_VALID|B_DIRTY)) == B_VALID) // If B_VALID set & B_DIRT NOT SET
+      panic("iderw: nothing to do");
+    for(uint j = 0; j < DISK_NUM; ++j) {
+      if(b->dev != 0 && !havedisk[j])
+        panic("iderw: an ide disk is not present");
+    }
 
-  acquire(&idelock);  //DOC:acquire-lock
+    // Initialize semaphore
+    b->flags &= ~B_ERROR;
+    sem_init(&b->sem, 0);
+  }
 
-  // Append b to corresponding idequeue.
-  b->qnext = 0;
-  // idequeue is FIFO. Iterate to end of queue and append buf. 
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext);
-  *pp = b;
+  for(ch = idechan; ch < idechan+2; ++ch) {
+    acquiresleep(&ch->lock);  //DOC:acquire-lock
 
-  // If first request to access disk
-  // If only one buffer in idequeue (first element in queue), execute its request
-  if(idequeue == b) {
-    if(b->dev < 2) {
-      idestart(b, BASE_ADDR1, BASE_ADDR2);
-    } else {
-      idestart(b, BASE_ADDR3, BASE_ADDR4);
-    }
+    // Hand the bufs for this channel's disks to the I/O scheduler.
+    for(i = 0; i < n; ++i)
+      if(idechanof(bufs[i]) == ch)
+        ioqadd(&ch->q, bufs[i]);
+
+    // If the channel is idle, start the first request.
+    // Otherwise idedone() starts the next one when the
+    // active command finishes.
+    if(ch->queue == 0)
+      idestart(ch);
+
+    releasesleep(&ch->lock);
   }
   
-  // If ^ failed... idequeue not empty
-  // disk already started taking requests from queue. No need to start again.
-  release(&idelock);
-  
   // sem_P will put Processes asking for disk access to sleep until 
   // request has been fulfilled (B_VALID is set)
-  sem_P(&b->sem);
+  for(i = 0; i < n; ++i)
+    sem_P(&bufs[i]->sem);
 }
@@ -0,0 +1,242 @@
+// I/O scheduling.
+//
+// Disk drivers queue requests in a struct ioq and ask ioqnext()
+// for the next one to start.  Which one that is depends on the
+// scheduler chosen with the iosched() system call:
+//
+// * fifo: the oldest request.
+// * cscan: the elevator.  Requests are served in increasing block
+//   order from where the disk head is; past the last one, it
+//   goes back to the lowest block.
+// * deadline (the default): cscan, except that a read waiting
+//   longer than READ_EXPIRE (or a write, WRITE_EXPIRE) goes first,
+//   so the sweep can't starve requests far behind it.
+//
+// Whatever the scheduler, ioqnext() adds the requests that
+// continue the chosen one on disk, so the driver can start them
+// all with one command.
+//
+// This file also keeps per-disk queue depth and latency
+// statistics, which drivers report to with ioqueued(), iocmd()
+// and iodone().  Each disk's counters are only updated under its
+// driver's queue lock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iosched.h"
+#include "iostat.h"
+
+#define READ_EXPIRE  50000000ULL     // ns
+#define WRITE_EXPIRE 500000000ULL    // ns
+
+struct iosched {
+  char *name;
+  struct buf* (*pick)(struct ioq*);   // Next request to start
+};
+
+static struct buf* fifopick(struct ioq*);
+static struct buf* cscanpick(struct ioq*);
+static struct buf* deadlinepick(struct ioq*);
+
+static struct iosched ioscheds[] = {
+  { "fifo", fifopick },
+  { "cscan", cscanpick },
+  { "deadline", deadlinepick },
+};
+
+static struct iosched *cursched = &ioscheds[2];
+
+static struct {
+  uint depth;
+  uint maxdepth;
+  uint nreq;
+  uint ncmd;
+  uint64 latus;               // Total latency, microseconds
+  uint maxus;
+  int sched;                  // Queued through an ioq
+} dstat[NDISK];
+
+static struct buf*
+fifopick(struct ioq *q) {
+  return q->head;
+}
+
+// Position of b in the elevator's sweep, relative to the head.
+// Blocks behind the head come after all those ahead of it.
+static uint64
+cscankey(struct ioq *q, struct buf *b) {
+  uint64 key = (uint64)b->dev << 32 | b->blockno;
+  uint64 pos = (uint64)q->dev << 32 | q->pos;
+
+  return key >= pos ? key - pos : key + ((uint64)1 << 40) - pos;
+}
+
+static struct buf*
+cscanpick(struct ioq *q) {
+  struct buf *b, *best = 0;
+
+  for(b = q->head; b; b = b->qnext)
+    if(best == 0 || cscankey(q, b) < cscankey(q, best))
+      best = b;
+  return best;
+}
+
+static struct buf*
+deadlinepick(struct ioq *q) {
+  struct buf *b;
+  uint64 now = nsecs();
+  int seenread = 0, seenwrite = 0;
+
+  // The list is in arrival order: the first read and the
+  // first write found are the ones waiting longest.
+  for(b = q->head; b && !(seenread && seenwrite); b = b->qnext){
+    if(b->flags & B_DIRTY){
+      if(!seenwrite && now - b->qtime > WRITE_EXPIRE)
+        return b;
+      seenwrite = 1;
+    } else {
+      if(!seenread && now - b->qtime > READ_EXPIRE)
+        return b;
+      seenread = 1;
+    }
+  }
+  return cscanpick(q);
+}
+
+// Take b off q.  Returns 0 if it isn't there.
+static int
+ioqremove(struct ioq *q, struct buf *b) {
+  struct buf **pp;
+
+  for(pp = &q->head; *pp; pp = &(*pp)->qnext){
+    if(*pp == b){
+      *pp = b->qnext;
+      b->qnext = 0;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Find the request on q that continues b on disk: same disk,
+// same direction, next block.
+static struct buf*
+ioqfollower(struct ioq *q, struct buf *b) {
+  struct buf *n;
+
+  for(n = q->head; n; n = n->qnext)
+    if(n->dev == b->dev && n->blockno == b->blockno + 1 &&
+       (n->flags & B_DIRTY) == (b->flags & B_DIRTY))
+      return n;
+  return 0;
+}
+
+// A request for b was queued: note the time and queue depth.
+void
+ioqueued(struct buf *b) {
+  b->qtime = nsecs();
+  if(b->dev >= NDISK)
+    return;
+  if(++dstat[b->dev].depth > dstat[b->dev].maxdepth)
+    dstat[b->dev].maxdepth = dstat[b->dev].depth;
+}
+
+// A command was sent to disk dev.
+void
+iocmd(uint dev) {
+  if(dev < NDISK)
+    dstat[dev].ncmd++;
+}
+
+// The request for b is done.
+void
+iodone(struct buf *b) {
+  uint us;
+
+  if(b->dev >= NDISK)
+    return;
+  us = udiv64(nsecs() - b->qtime, 1000, 0);
+  dstat[b->dev].depth--;
+  dstat[b->dev].nreq++;
+  dstat[b->dev].latus += us;
+  if(us > dstat[b->dev].maxus)
+    dstat[b->dev].maxus = us;
+}
+
+// Add a request for b to q.
+void
+ioqadd(struct ioq *q, struct buf *b) {
+  struct buf **pp;
+
+  ioqueued(b);
+  b->qnext = 0;
+  for(pp = &q->head; *pp; pp = &(*pp)->qnext)
+    ;
+  *pp = b;
+}
+
+// Take the request to start next off q, along with up to max-1
+// more that continue it on disk, linked in block order through
+// qnext.  Returns 0 if q is empty.
+struct buf*
+ioqnext(struct ioq *q, int max) {
+  struct buf *first, *last, *n;
+
+  if((first = cursched->pick(q)) == 0)
+    return 0;
+  ioqremove(q, first);
+  for(last = first; --max > 0 && (n = ioqfollower(q, last)) != 0; last = n){
+    ioqremove(q, n);
+    last->qnext = n;
+  }
+  q->dev = last->dev;
+  q->pos = last->blockno + 1;
+  iocmd(first->dev);
+  if(first->dev < NDISK)
+    dstat[first->dev].sched = 1;
+  return first;
+}
+
+// Use the I/O scheduler called name from now on.
+// Returns -1 if there is none.
+int
+iosched(char *name) {
+  int i;
+
+  for(i = 0; i < NELEM(ioscheds); i++){
+    if(strncmp(ioscheds[i].name, name, 16) == 0){
+      cursched = &ioscheds[i];
+      return 0;
+    }
+  }
+  return -1;
+}
+
+// Fill in statistics for up to n disks that have been used.
+// Returns the number filled in.
+int
+diskstat(struct diskstat *st, int n) {
+  int dev, i = 0;
+
+  for(dev = 0; dev < NDISK && i < n; dev++){
+    if(dstat[dev].nreq == 0 && dstat[dev].depth == 0)
+      continue;
+    memset(&st[i], 0, sizeof(st[i]));
+    st[i].dev = dev;
+    // Disks that queue requests themselves (virtio) have no scheduler.
+    safestrcpy(st[i].sched, dstat[dev].sched ? cursched->name : "-", sizeof(st[i].sched));
+    st[i].depth = dstat[dev].depth;
+    st[i].maxdepth = dstat[dev].maxdepth;
+    st[i].nreq = dstat[dev].nreq;
+    st[i].ncmd = dstat[dev].ncmd;
+    st[i].avgus = dstat[dev].nreq ? udiv64(dstat[dev].latus, dstat[dev].nreq, 0) : 0;
+    st[i].maxus = dstat[dev].maxus;
+    i++;
+  }
+  return i;
+}
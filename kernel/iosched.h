@@ -0,0 +1,22 @@
+#ifndef IOSCHED_H
+#define IOSCHED_H
+
+#include "types.h"
+
+/*
+*   Requests waiting for a disk (or a channel's disks).  The
+*   driver adds requests with ioqadd() and takes the next one to
+*   start with ioqnext(); the I/O scheduler in use decides which.
+*   Protected by the driver's lock.
+*   Member head: Waiting requests, in arrival order, linked
+*   through qnext.
+*   Member dev, pos: Disk and block just after the last request
+*   started: where the disk head is.
+*/
+struct ioq {
+  struct buf *head;
+  uint dev;
+  uint pos;
+};
+
+#endif // IOSCHED_H
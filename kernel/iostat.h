@@ -0,0 +1,29 @@
+#ifndef IOSTAT_H
+#define IOSTAT_H
+
+#include "types.h"
+
+/*
+*   Statistics for one disk, filled in by diskstat().
+*   Member dev: Block device number.
+*   Member sched: I/O scheduler ordering its queue, or "-".
+*   Member depth, maxdepth: Requests queued or in progress now,
+*   and the most there have been at once.
+*   Member nreq: Requests (buffers) completed.
+*   Member ncmd: Commands sent to the disk; fewer than nreq when
+*   adjacent requests are merged.
+*   Member avgus, maxus: Average and longest time from queueing a
+*   request to its completion, in microseconds.
+*/
+struct diskstat {
+  uint dev;
+  char sched[16];
+  uint depth;
+  uint maxdepth;
+  uint nreq;
+  uint ncmd;
+  uint avgus;
+  uint maxus;
+};
+
+#endif // IOSTAT_H
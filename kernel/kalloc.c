@@ -21,6 +21,8 @@ struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  uint nfree;       // Pages on the free list
+  uint npages;      // Pages handed to the allocator at boot
 } kmem;
 
 // Initialization happens in two phases.
@@ -45,8 +47,10 @@ void
 freerange(void *vstart, void *vend) {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
     kfree(p);  // Add memory to the free list via kfree
+    kmem.npages++;
+  }
 }
 //PAGEBREAK: 21
 // Free the page of physical memory pointed at by v,
@@ -71,6 +75,7 @@ kfree(char *v) {
   r = (struct run*)v;
   r->next = kmem.freelist;  // Ool start of free list
   kmem.freelist = r;
+  kmem.nfree++;
   if(kmem.use_lock)
     release(&kmem.lock);
 }
@@ -79,19 +84,43 @@ kfree(char *v) {
 // first element in the free list
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated
+// If memory has run out, the buffer cache is asked to give
+// some back first.
 char*
 kalloc(void) {
   struct run *r;
+  int retry = kmem.use_lock;
   
+again:
   if(kmem.use_lock)
     acquire(&kmem.lock);
 
   r = kmem.freelist;
-  if(r)
+  if(r){
     kmem.freelist = r->next;
+    kmem.nfree--;
+  }
     
   if(kmem.use_lock)
     release(&kmem.lock);
+
+  if(r == 0 && retry){
+    retry = 0;
+    if(bshrink(16) > 0)
+      goto again;
+  }
     
   return (char*)r;
 }
+
+// Number of free pages.  Only a hint: no lock is taken.
+uint
+kfreepages(void) {
+  return kmem.nfree;
+}
+
+// Number of pages the allocator manages.
+uint
+ktotalpages(void) {
+  return kmem.npages;
+}
@@ -9,6 +9,7 @@
 #include "traps.h"
 #include "mmu.h"
 #include "x86.h"
+#include "proc.h"
 
 // Local APIC registers, divided by 4 for use as uint[] indices.
 #define ID      (0x0020/4)   // ID
@@ -31,6 +32,7 @@
 #define ICRHI   (0x0310/4)   // Interrupt Command [63:32]
 #define TIMER   (0x0320/4)   // Local Vector Table 0 (TIMER)
   #define X1         0x0000000B   // divide counts by 1
+  #define ONESHOT    0x00000000   // One-shot
   #define PERIODIC   0x00020000   // Periodic
 #define PCINT   (0x0340/4)   // Performance Counter LVT
 #define LINT0   (0x0350/4)   // Local Vector Table 1 (LINT0)
@@ -43,6 +45,23 @@
 
 volatile uint *lapic;  // Initialized in mp.c
 
+// PIT channel 2, used to calibrate the LAPIC timer and the TSC.
+#define PIT_HZ     1193182     // PIT input clock frequency
+#define PIT_CH2    0x42        // Channel 2 data port
+#define PIT_MODE   0x43        // Mode/command register
+#define PIT_GATE   0x61        // Channel 2 gate (bit 0) and output (bit 5)
+#define CALMS      10          // Calibration interval (milliseconds)
+
+#define TICKNS     (1000000000/HZ)  // Nanoseconds per clock tick
+#define MAXSLEEPNS 1000000000ULL    // Longest a tickless CPU goes without a tick
+#define CLKSHIFT   20               // Fixed-point shift for conversions
+
+static uint lapickhz;    // LAPIC timer counts per millisecond
+static uint tsckhz;      // TSC cycles per millisecond
+static uint tscmult;     // ns = (cycles * tscmult) >> CLKSHIFT
+static uint lapicmult;   // counts = (ns * lapicmult) >> CLKSHIFT
+static uint64 tsc0;      // TSC at time zero of nsecs()
+
 //PAGEBREAK!
 static void
 lapicw(int index, int value)
@@ -51,6 +70,50 @@ lapicw(int index, int value)
   lapic[ID];  // wait for write to finish, by reading
 }
 
+// Measure the LAPIC timer and TSC rates against a CALMS
+// millisecond one-shot count of PIT channel 2.
+static void
+lapiccalibrate(void)
+{
+  uint latch, count, n;
+  uint64 t0, t1;
+
+  // Let the LAPIC timer count down without interrupting.
+  lapicw(TDCR, X1);
+  lapicw(TIMER, MASKED | ONESHOT | (T_IRQ0 + IRQ_TIMER));
+
+  // Gate channel 2 on with the speaker off, and have it
+  // count down once from latch (mode 0).
+  latch = PIT_HZ * CALMS / 1000;
+  outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);
+  outb(PIT_MODE, 0xB0);
+  outb(PIT_CH2, latch & 0xFF);
+  outb(PIT_CH2, latch >> 8);
+  t0 = rdtsc();
+  lapicw(TICR, 0xFFFFFFFF);
+
+  // The channel 2 output goes high when the count reaches zero.
+  for(n = 0; (inb(PIT_GATE) & 0x20) == 0 && n < 100000000; n++)
+    ;
+  t1 = rdtsc();
+  count = 0xFFFFFFFF - lapic[TCCR];
+  lapicw(TICR, 0);
+
+  if(n == 100000000 || count == 0 || t1 == t0){
+    // No usable PIT: fall back to the 1GHz bus that the
+    // old hard-coded TICR of 10000000 per tick assumed.
+    cprintf("lapic: timer calibration failed\n");
+    lapickhz = 1000000;
+    tsckhz = 1000000;
+  } else {
+    lapickhz = count / CALMS;
+    tsckhz = (uint)(t1 - t0) / CALMS;
+  }
+  tscmult = udiv64(1000000ULL << CLKSHIFT, tsckhz, 0);
+  lapicmult = udiv64((uint64)lapickhz << CLKSHIFT, 1000000, 0);
+  tsc0 = t1;
+}
+
 void
 lapicinit(void)
 {
@@ -60,13 +123,16 @@ lapicinit(void)
   // Enable local APIC; set spurious interrupt vector.
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
-  // The timer repeatedly counts down at bus frequency
-  // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
+  // The timer counts down at bus frequency from lapic[TICR]
+  // and then issues an interrupt.  The first CPU calibrates it
+  // against the PIT.  It runs in one-shot mode: lapictimer()
+  // programs each next interrupt for the next clock tick or an
+  // earlier nanosleep() deadline.
+  if(lapickhz == 0)
+    lapiccalibrate();
   lapicw(TDCR, X1);
-  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TIMER, ONESHOT | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, lapickhz * (1000/HZ));
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -113,6 +179,121 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Nanoseconds since the clock was calibrated at boot, from the TSC.
+uint64
+nsecs(void)
+{
+  uint64 c;
+
+  // (c * tscmult) >> CLKSHIFT, without overflowing 64 bits.
+  c = rdtsc() - tsc0;
+  return (((c >> 32) * tscmult) << (32 - CLKSHIFT)) +
+         (((c & 0xFFFFFFFF) * tscmult) >> CLKSHIFT);
+}
+
+// Set this CPU's LAPIC timer to fire at time deadline (ns).
+// The deadline is never more than MAXSLEEPNS away.
+static void
+lapicarm(struct cpu *c, uint64 deadline, uint64 now)
+{
+  uint count;
+
+  c->deadline = deadline;
+  count = 1;
+  if(deadline > now)
+    count = ((deadline - now) * lapicmult) >> CLKSHIFT;
+  lapicw(TICR, count ? count : 1);
+}
+
+// Handle a LAPIC timer interrupt on this CPU: run expired
+// high-resolution timers and program the next interrupt.
+// Returns 1 if a clock tick is due, 0 if the interrupt was
+// only for a nanosleep() deadline.
+int
+lapictimer(void)
+{
+  struct cpu *c = mycpu();
+  uint64 now, next;
+  int tick;
+
+  now = nsecs();
+  tick = 0;
+  if(now >= c->nexttick){
+    tick = 1;
+    c->nexttick += TICKNS;
+    if(c->nexttick <= now)
+      c->nexttick = now + TICKNS;
+  }
+  next = hrtimerrun(now);
+
+  // Dynamic tick: if no process is waiting for a CPU, there is
+  // nothing to preempt for, so stop the periodic tick and take
+  // the next one only when the timer wheel needs it.  Publish
+  // c->tickless before looking at the run queue; kickidle()
+  // does the opposite and restarts our tick if it loses the race.
+  if(TICKLESS && tick){
+    xchg(&c->tickless, 1);
+    if(tickstop()){
+      c->nexttick = (uint64)timernext() * TICKNS;
+      if(c->nexttick > now + MAXSLEEPNS)
+        c->nexttick = now + MAXSLEEPNS;
+      if(c->nexttick <= now)
+        c->nexttick = now + TICKNS;
+    } else
+      c->tickless = 0;
+  }
+
+  if(next > c->nexttick)
+    next = c->nexttick;
+  lapicarm(c, next, now);
+  return tick;
+}
+
+// Make sure this CPU's LAPIC timer fires no later than
+// deadline (ns).  Must be called with interrupts disabled.
+void
+lapicdeadline(uint64 deadline)
+{
+  struct cpu *c = mycpu();
+
+  if(deadline < c->deadline)
+    lapicarm(c, deadline, nsecs());
+}
+
+// Make sure this CPU takes a clock tick no later than
+// deadline (ns).  Must be called with interrupts disabled.
+void
+lapicnexttick(uint64 deadline)
+{
+  struct cpu *c = mycpu();
+
+  if(deadline < c->nexttick)
+    c->nexttick = deadline;
+  lapicdeadline(deadline);
+}
+
+// Restart this CPU's periodic clock tick if it was stopped.
+// Must be called with interrupts disabled.
+void
+lapictickstart(void)
+{
+  mycpu()->tickless = 0;
+  lapicnexttick(nsecs() + TICKNS);
+}
+
+// Send a fixed interrupt with the given vector to the
+// processor whose local APIC ID is apicid.
+void
+lapicipi(int apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
@@ -0,0 +1,124 @@
+// Lock statistics.
+//
+// Locks are grouped into classes by name: every struct proc lock
+// is counted in class "proc", every buffer lock in "buffer", and
+// so on.  initlock() and initsleeplock() look the class up (or add
+// it) with lockclass(); acquire(), release() and their sleeplock
+// counterparts then report to it.  Counters are kept per CPU and
+// only updated with interrupts off, so no lock is needed to
+// update them; lockstat() adds them up.
+//
+// Everything is compiled out when LOCKSTAT (param.h) is 0,
+// e.g. with "make FAST=1".
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "lockstat.h"
+
+struct lockstat {
+  char *name;
+  int sleep;
+  struct {
+    uint nacq;                // Acquisitions
+    uint ncont;               // Acquisitions that had to wait
+    uint64 spin;              // Cycles spent waiting
+    uint64 maxhold;           // Longest hold (cycles)
+  } cpu[NCPU];
+};
+
+static struct lockstat classes[NLOCKCLASS];
+static int nclass;
+static volatile uint classlock;  // Not a spinlock: initlock() takes it
+
+// Return the class for locks named name, adding it if
+// there is none yet.  Returns 0 if the table is full.
+struct lockstat*
+lockclass(char *name, int sleep) {
+  struct lockstat *ls;
+  uint eflags;
+
+  // Called before the per-CPU %gs is set up (kinit1), so
+  // disable interrupts by hand rather than with pushcli().
+  eflags = readeflags();
+  cli();
+  while(xchg(&classlock, 1) != 0)
+    pause();
+  for(ls = classes; ls < classes+nclass; ls++)
+    if(ls->sleep == sleep && strncmp(ls->name, name, 16) == 0)
+      goto done;
+  if(nclass == NLOCKCLASS){
+    ls = 0;
+    goto done;
+  }
+  ls = &classes[nclass++];
+  ls->name = name;
+  ls->sleep = sleep;
+done:
+  xchg(&classlock, 0);
+  if(eflags & FL_IF)
+    sti();
+  return ls;
+}
+
+// A lock of class ls was acquired, after spinning or
+// sleeping for wait cycles if contended.
+// Interrupts must be off.
+void
+lockacquired(struct lockstat *ls, int contended, uint64 wait) {
+  int id = mycpu() - cpus;
+
+  ls->cpu[id].nacq++;
+  if(contended){
+    ls->cpu[id].ncont++;
+    ls->cpu[id].spin += wait;
+  }
+}
+
+// A lock of class ls is being released after being
+// held for held cycles.  Interrupts must be off.
+void
+lockreleased(struct lockstat *ls, uint64 held) {
+  int id = mycpu() - cpus;
+
+  if(held > ls->cpu[id].maxhold)
+    ls->cpu[id].maxhold = held;
+}
+
+// Copy statistics for up to n lock classes to the array
+// of struct lockinfo at user address va.
+// Returns the number of classes copied, or -1.
+int
+lockstat(uint va, int n) {
+  struct lockstat *ls;
+  struct lockinfo li;
+  uint64 spin, maxhold;
+  int i, c;
+
+  if(!LOCKSTAT)
+    return -1;
+  for(i = 0; i < n && i < nclass; i++){
+    ls = &classes[i];
+    memset(&li, 0, sizeof(li));
+    safestrcpy(li.name, ls->name, sizeof(li.name));
+    li.sleep = ls->sleep;
+    spin = maxhold = 0;
+    for(c = 0; c < ncpu; c++){
+      li.nacq += ls->cpu[c].nacq;
+      li.ncont += ls->cpu[c].ncont;
+      spin += ls->cpu[c].spin;
+      if(ls->cpu[c].maxhold > maxhold)
+        maxhold = ls->cpu[c].maxhold;
+    }
+    li.spin = udiv64(spin, 1000, 0);
+    li.maxhold = udiv64(maxhold, 1000, 0);
+    if(copyout(myproc()->pgdir, va + i*sizeof(li), &li, sizeof(li)) < 0)
+      return -1;
+  }
+  return i;
+}
@@ -0,0 +1,27 @@
+#ifndef LOCKSTAT_H
+#define LOCKSTAT_H
+
+#include "types.h"
+
+// Maximum number of lock classes (distinct lock names)
+#define NLOCKCLASS 64
+
+/*
+*   Statistics for one lock class, filled in by lockstat().
+*   Locks initialized with the same name (every struct proc lock,
+*   every buffer lock, ...) share a class.
+*   Member sleep: Non-zero for sleeplocks.
+*   Member nacq, ncont: Acquisitions, and how many had to wait.
+*   Member spin: Thousands of cycles spent waiting for the lock.
+*   Member maxhold: Longest time the lock was held, thousands of cycles.
+*/
+struct lockinfo {
+  char name[16];
+  int sleep;
+  uint nacq;
+  uint ncont;
+  uint spin;
+  uint maxhold;
+};
+
+#endif // LOCKSTAT_H
@@ -65,25 +65,35 @@ initlog(int dev)
   recover_from_log();
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks from log to their home location.
+// The writes are queued together, so runs of adjacent blocks
+// each go to disk in one request.
 static void
 install_trans(void) {
+  struct buf *dbuf[LOGSIZE];
+  uint ra[LOGSIZE];
   int tail;
 
+  for (tail = 0; tail < log.lh.n; tail++)
+    ra[tail] = log.start+tail+2;
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
+    // read log block, and the rest of the log with it if not cached
+    struct buf *lbuf = breadn(log.dev, log.start+tail+1, ra+tail, log.lh.n-tail-1);
+    if(lbuf == 0)
+      panic("install_trans: disk error");
+    dbuf[tail] = bread(log.dev, log.lh.block[tail]); // read dst
+    memmove(dbuf[tail]->data, lbuf->data, BSIZE);  // copy block to dst
     brelse(lbuf);
-    brelse(dbuf);
   }
+  bwritev(dbuf, log.lh.n);  // write dsts to disk
+  for (tail = 0; tail < log.lh.n; tail++)
+    brelse(dbuf[tail]);
 }
 
 // Read the log header from disk into the in-memory log header
 static void
 read_head(void) {
-  struct buf *buf = bread(log.dev, log.start);
+  struct buf *buf = breadmeta(log.dev, log.start);
   struct logheader *lh = (struct logheader *) (buf->data);
   int i;
   log.lh.n = lh->n;
@@ -98,7 +108,7 @@ read_head(void) {
 // current transaction commits.
 static void
 write_head(void) {
-  struct buf *buf = bread(log.dev, log.start);
+  struct buf *buf = breadmeta(log.dev, log.start);
   struct logheader *hb = (struct logheader *) (buf->data);
   int i;
   hb->n = log.lh.n;
@@ -170,19 +180,27 @@ end_op(void)
   }
 }
 
-// Copy modified blocks from cache to log.
+// Copy modified blocks from cache to log.  The log blocks
+// are consecutive, so they go to disk in a single request.
 static void
 write_log(void) {
+  struct buf *to[LOGSIZE];
+  uint ra[LOGSIZE];
   int tail;
 
+  for (tail = 0; tail < log.lh.n; tail++)
+    ra[tail] = log.start+tail+2;
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+    to[tail] = breadn(log.dev, log.start+tail+1, ra+tail, log.lh.n-tail-1); // log block
+    if(to[tail] == 0)
+      panic("write_log: disk error");
     struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
+    memmove(to[tail]->data, from->data, BSIZE);
     brelse(from);
-    brelse(to);
   }
+  bwritev(to, log.lh.n);  // write the log
+  for (tail = 0; tail < log.lh.n; tail++)
+    brelse(to[tail]);
 }
 
 static void
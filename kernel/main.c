@@ -19,17 +19,21 @@ main(void) {
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
   kvmalloc();      // kernel page table
   mpinit();        // detect other processors
+  seginit();       // segment descriptors, per-CPU %gs
   lapicinit();     // interrupt controller
-  seginit();       // segment descriptors
   picinit();       // disable pic
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
   pinit();         // process table
   tvinit();        // trap vectors
+  timerinit();     // kernel timer wheel
+  workinit();      // deferred-work queues
   binit();         // buffer cache
   fileinit();      // file table
+  pciinit();       // PCI devices
   ideinit();       // disk 
+  virtioinit();    // virtio disks
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
   /* Kernel all set to start user processes */
@@ -52,6 +56,7 @@ static void
 mpmain(void) {
   cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
   idtinit();       // load idt register
+  mycpu()->tstamp = nsecs(); // start CPU time accounting
   xchg(&(mycpu()->started), 1); // tell startothers() we're up
   idle();          // enter idle loop
 }
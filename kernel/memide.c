@@ -56,3 +56,12 @@ iderw(struct buf *b) {
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+// Sync n bufs with disk, as iderw.
+void
+iderwv(struct buf **bufs, int n) {
+  int i;
+
+  for(i = 0; i < n; i++)
+    iderw(bufs[i]);
+}
@@ -1,6 +1,11 @@
-#define NPROC        64  // maximum number of processes
+#define NPROC        64  // default limit on number of processes (see proclimit)
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define HZ          100  // clock ticks per second
+#define TICKLESS      1  // stop the clock tick on CPUs that don't need it
+#ifndef LOCKSTAT
+#define LOCKSTAT      1  // collect lock statistics (0 with make FAST=1)
+#endif
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
@@ -9,7 +14,9 @@
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define NBUF         (MAXOPBLOCKS*3)  // minimum size of disk block cache (it grows; see bio.c)
+#define NREADAHEAD   16  // max blocks read ahead on a file read miss
+#define NDISK        6   // block devices: 4 IDE disks, then virtio disks
 #define FSSIZE       1000 // size of file system in blocks
 #define DSIZE        10000 // Disk device size in blocks
 
@@ -0,0 +1,126 @@
+// PCI bus enumeration.
+//
+// pciinit() walks every bus, device and function through
+// configuration mechanism #1 (ports 0xCF8/0xCFC) and remembers
+// what it finds; drivers then look their hardware up with
+// pcifind().  Configuration space is only touched during
+// boot, on one CPU, so there is no lock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "pci.h"
+
+#define PCI_CONFIG_ADDR 0xCF8
+#define PCI_CONFIG_DATA 0xCFC
+
+// Configuration space registers
+#define PCI_ID        0x00    // vendor (low), device (high)
+#define PCI_COMMAND   0x04
+#define PCI_CLASSREG  0x08    // revision, prog if, subclass, class
+#define PCI_HEADER    0x0C    // bits 16-23: header type
+#define PCI_BAR0      0x10
+#define PCI_INTR      0x3C    // bits 0-7: interrupt line
+
+// Command register bits
+#define PCI_CMD_IO     0x1
+#define PCI_CMD_MEM    0x2
+#define PCI_CMD_MASTER 0x4
+
+static struct pcidev pcidevs[NPCIDEV];
+static int npcidev;
+
+static uint
+pciread(uint bus, uint dev, uint func, uint reg) {
+  outl(PCI_CONFIG_ADDR, 0x80000000 | bus<<16 | dev<<11 | func<<8 | (reg & 0xfc));
+  return inl(PCI_CONFIG_DATA);
+}
+
+static void
+pciwrite(uint bus, uint dev, uint func, uint reg, uint v) {
+  outl(PCI_CONFIG_ADDR, 0x80000000 | bus<<16 | dev<<11 | func<<8 | (reg & 0xfc));
+  outl(PCI_CONFIG_DATA, v);
+}
+
+// Remember the function at bus/dev/func, if there is one.
+// Returns its header type, or -1 if there is none.
+static int
+pciprobe(uint bus, uint dev, uint func) {
+  struct pcidev *pd;
+  uint id, class;
+  int i;
+
+  id = pciread(bus, dev, func, PCI_ID);
+  if((id & 0xffff) == 0xffff)
+    return -1;
+  if(npcidev == NPCIDEV){
+    cprintf("pci: too many devices\n");
+    return -1;
+  }
+  pd = &pcidevs[npcidev++];
+  pd->bus = bus;
+  pd->dev = dev;
+  pd->func = func;
+  pd->vendor = id & 0xffff;
+  pd->device = id >> 16;
+  class = pciread(bus, dev, func, PCI_CLASSREG);
+  pd->class = class >> 24;
+  pd->subclass = class >> 16;
+  pd->progif = class >> 8;
+  pd->irq = pciread(bus, dev, func, PCI_INTR);
+  for(i = 0; i < 6; i++)
+    pd->bar[i] = pciread(bus, dev, func, PCI_BAR0 + 4*i);
+  return (pciread(bus, dev, func, PCI_HEADER) >> 16) & 0xff;
+}
+
+void
+pciinit(void) {
+  uint bus, dev, func;
+  int hdr;
+
+  for(bus = 0; bus < 256; bus++){
+    for(dev = 0; dev < 32; dev++){
+      if((hdr = pciprobe(bus, dev, 0)) < 0)
+        continue;
+      // Bit 7 of the header type: a multi-function device.
+      if(hdr & 0x80)
+        for(func = 1; func < 8; func++)
+          pciprobe(bus, dev, func);
+    }
+  }
+}
+
+// Return the n'th function (from 0) of the given class and
+// subclass, or 0 if there are not that many.
+struct pcidev*
+pcifind(int class, int subclass, int n) {
+  struct pcidev *pd;
+
+  for(pd = pcidevs; pd < pcidevs+npcidev; pd++)
+    if(pd->class == class && pd->subclass == subclass && n-- == 0)
+      return pd;
+  return 0;
+}
+
+// Return the n'th function (from 0) with the given vendor and
+// device IDs, or 0 if there are not that many.
+struct pcidev*
+pcifindid(int vendor, int device, int n) {
+  struct pcidev *pd;
+
+  for(pd = pcidevs; pd < pcidevs+npcidev; pd++)
+    if(pd->vendor == vendor && pd->device == device && n-- == 0)
+      return pd;
+  return 0;
+}
+
+// Let pd decode its I/O and memory BARs and master the bus (DMA).
+void
+pcienable(struct pcidev *pd) {
+  uint cmd;
+
+  cmd = pciread(pd->bus, pd->dev, pd->func, PCI_COMMAND) & 0xffff;
+  cmd |= PCI_CMD_IO | PCI_CMD_MEM | PCI_CMD_MASTER;
+  pciwrite(pd->bus, pd->dev, pd->func, PCI_COMMAND, cmd);
+}
@@ -0,0 +1,35 @@
+#ifndef PCI_H
+#define PCI_H
+
+#include "types.h"
+
+// Maximum number of PCI functions remembered by pciinit()
+#define NPCIDEV 32
+
+// Class codes
+#define PCI_CLASS_STORAGE 0x01
+#define PCI_SUBCLASS_IDE  0x01
+
+/*
+*   PCI function found by pciinit().
+*   Member bus, dev, func: Configuration space address.
+*   Member vendor, device: Identify the hardware.
+*   Member class, subclass, progif: What kind of device it is.
+*   Member irq: Interrupt line, as set up by the BIOS.
+*   Member bar: Base address registers.  Bit 0 is set for I/O
+*   space; mask with ~3 (I/O) or ~0xf (memory) for the address.
+*/
+struct pcidev {
+  uchar bus;
+  uchar dev;
+  uchar func;
+  ushort vendor;
+  ushort device;
+  uchar class;
+  uchar subclass;
+  uchar progif;
+  uchar irq;
+  uint bar[6];
+};
+
+#endif // PCI_H
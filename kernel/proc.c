@@ -4,16 +4,42 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
+#include "traps.h"
 #include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "date.h"
 #include "fs.h"
 #include "buf.h"
-
+#include "timer.h"
+#include "procinfo.h"
+#include "waitq.h"
+
+#define NPIDHASH 256
+#define PIDHASH(pid) ((uint)(pid) % NPIDHASH)
+#define PROCPERPAGE (PGSIZE / sizeof(struct proc))
+
+// Each process's own p->lock protects its state and scheduling
+// fields (state, chan, context, killed, cpumask).  ptable.lock only
+// protects parent/child linkage (p->parent and the children lists),
+// the PID hash and the free list, and the ZOMBIE hand-off between
+// exit() and wait().  Lock order: ptable.lock, then p->lock.
+//
+// struct procs are carved out of pages from kalloc() as they are
+// needed, and are never given back: an exited process's slot goes
+// on the free list for the next fork.  Since a slot always stays a
+// struct proc, code that scans ptable.procs without ptable.lock
+// (roundrobin, wakeup) may look at a slot while it is being freed
+// or reused, and only has to recheck under p->lock.
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct proc *procs;         // Every slot, linked through p->allnext
+  int nproc;                  // Number of slots on ptable.procs
+  int nused;                  // Number of slots that are not UNUSED
+  int maxproc;                // Soft limit on nused (see proclimit)
+  struct proc *freelist;      // UNUSED slots, linked through p->nextfree
+  struct proc *pidhash[NPIDHASH]; // Allocated slots by pid, through p->hashnext
+  int nrunnable;              // Number of RUNNABLE processes waiting for a CPU
 } ptable;
 
 static struct proc *initproc;
@@ -22,14 +48,157 @@ int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
+static void kickidle(struct proc*);
+static void setrunnable(struct proc*);
 static void sched(void);
-static struct proc *roundrobin(void);
+static void finishswitch(void);
+static void kforkret(void);
+static struct proc *roundrobin(struct cpu*, int*);
+static void schedwait(struct cpu*, struct proc*);
+static int trypick(struct cpu*, struct proc*, int*);
 struct spinlock swaplock;
 
 void
 pinit(void) {
   initlock(&ptable.lock, "ptable");
+  ptable.maxproc = NPROC;
+}
+
+// Add a page worth of UNUSED slots to the process table.
+// Returns -1 if there is no memory.
+// The caller must hold ptable.lock.
+static int
+procgrow(void) {
+  struct proc *p, *procs;
+  int i;
+
+  if((procs = (struct proc*)kalloc()) == 0)
+    return -1;
+  memset(procs, 0, PGSIZE);
+  for(i = 0; i < PROCPERPAGE; i++){
+    p = &procs[i];
+    initlock(&p->lock, "proc");
+    p->nextfree = ptable.freelist;
+    ptable.freelist = p;
+    p->allnext = i+1 < PROCPERPAGE ? &procs[i+1] : ptable.procs;
+  }
+  // Publish the new slots to lock-free scanners only
+  // once they are initialized.
+  __sync_synchronize();
+  ptable.procs = procs;
+  ptable.nproc += PROCPERPAGE;
+  return 0;
+}
+
+// Get or set the soft limit on the number of processes.
+// If n > 0 the limit becomes n.  Returns the previous limit.
+int
+proclimit(int n) {
+  int old;
+
+  acquire(&ptable.lock);
+  old = ptable.maxproc;
+  if(n > 0)
+    ptable.maxproc = n;
+  release(&ptable.lock);
+  return old;
+}
+
+// Take a slot off the free list, mark it EMBRYO with a new
+// pid, and enter it in the pid hash.  Returns 0 if the process
+// limit has been reached or there is no memory for more slots.
+// The caller must hold ptable.lock.
+static struct proc*
+allocslot(void) {
+  struct proc *p;
+
+  if(ptable.nused >= ptable.maxproc)
+    return 0;
+  if(ptable.freelist == 0 && procgrow() < 0)
+    return 0;
+  p = ptable.freelist;
+  ptable.freelist = p->nextfree;
+  ptable.nused++;
+
+  acquire(&p->lock);
+  p->state = EMBRYO;
+  p->pid = nextpid++;
+  p->cpumask = ~0;
+  p->lastcpu = -1;
+  p->utime = 0;
+  p->preempted = 0;
+  p->handoff = 0;
+  p->stime = 0;
+  release(&p->lock);
+
+  p->hashnext = ptable.pidhash[PIDHASH(p->pid)];
+  ptable.pidhash[PIDHASH(p->pid)] = p;
+  return p;
+}
+
+// Return slot p to the free list.  p must already be unlinked
+// from its parent's children.  The caller must hold ptable.lock.
+static void
+freeslot(struct proc *p) {
+  struct proc **pp;
+
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp; pp = &(*pp)->hashnext){
+    if(*pp == p){
+      *pp = p->hashnext;
+      break;
+    }
+  }
+  p->hashnext = 0;
+  p->pid = 0;
+  p->parent = 0;
+  p->state = UNUSED;
+  p->nextfree = ptable.freelist;
+  ptable.freelist = p;
+  ptable.nused--;
+}
+
+// Look up a pid in the pid hash.  The caller must hold ptable.lock.
+static struct proc*
+findpid(int pid) {
+  struct proc *p;
+
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->hashnext)
+    if(p->pid == pid)
+      return p;
+  return 0;
+}
+
+// Make p a child of parent.  The caller must hold ptable.lock.
+static void
+addchild(struct proc *parent, struct proc *p) {
+  p->parent = parent;
+  p->sibling = parent->children;
+  parent->children = p;
+}
+
+// Pass the children of an exiting process to init, waking
+// init if any of them have already exited.
+// The caller must hold ptable.lock.
+static void
+reparent(struct proc *curproc) {
+  struct proc *p;
+  int zombies = 0;
+
+  if((p = curproc->children) == 0)
+    return;
+  for(;;){
+    p->parent = initproc;
+    if(p->state == ZOMBIE)
+      zombies = 1;
+    if(p->sibling == 0)
+      break;
+    p = p->sibling;
+  }
+  p->sibling = initproc->children;
+  initproc->children = curproc->children;
+  curproc->children = 0;
+  if(zombies)
+    wakeup(initproc);
 }
 
 // Must be called with interrupts disabled
@@ -38,40 +207,46 @@ cpuid() {
   return mycpu()-cpus;
 }
 
-// Must be called with interrupts disabled to avoid the caller being
-// rescheduled between reading lapicid and running through the loop.
+// Must be called with interrupts disabled, or the caller could be
+// rescheduled onto another CPU and keep using this one's struct.
+// %gs holds this CPU's struct cpu (see seginit), so this is one load.
 struct cpu*
 mycpu(void) {
-  int apicid, i;
-  
+  struct cpu *c;
+
   if(readeflags()&FL_IF)
     panic("mycpu called with interrupts enabled\n");
-  
-  apicid = lapicid();
-  // APIC IDs are not guaranteed to be contiguous. Maybe we should have
-  // a reverse map, or reserve a register to store &cpus[i].
-  for (i = 0; i < ncpu; ++i) {
-    if (cpus[i].apicid == apicid)
-      return &cpus[i];
-  }
-  panic("unknown apicid\n");
+
+  asm volatile("movl %%gs:%c1, %0" : "=r" (c) : "i" (__builtin_offsetof(struct cpu, self)));
+  return c;
 }
 
-// Disable interrupts so that we are not rescheduled
-// while reading proc from the cpu structure
+// Read proc straight from this CPU's struct through %gs.
+// A single load can't be split by a reschedule, and the running
+// process is the same whichever CPU it is on, so interrupts need
+// not be disabled.
 struct proc*
 myproc(void) {
-  struct cpu *c;
   struct proc *p;
+
+  asm volatile("movl %%gs:%c1, %0" : "=r" (p) : "i" (__builtin_offsetof(struct cpu, proc)));
+  return p;
+}
+
+// Is this CPU running an interrupt handler?  Then myproc() is
+// the process it interrupted, not one acting on its own behalf.
+static int
+inintr(void) {
+  int r;
+
   pushcli();
-  c = mycpu();
-  p = c->proc;
+  r = mycpu()->inintr;
   popcli();
-  return p;
+  return r;
 }
 
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
+// Take an UNUSED proc off the free list.
 // If found, change state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise return 0.
@@ -81,24 +256,16 @@ allocproc(void) {
   char *sp;
 
   acquire(&ptable.lock);
-
-  // Find unsused process slot in ptable
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-
-  release(&ptable.lock);
-  return 0;
-
-found:
-  p->state = EMBRYO;
-  p->pid = nextpid++;
-
+  p = allocslot();
   release(&ptable.lock);
+  if(p == 0)
+    return 0;
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeslot(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -153,11 +320,11 @@ userinit(void) {
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  acquire(&p->lock);
 
-  p->state = RUNNABLE;
+  setrunnable(p);
 
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
@@ -206,12 +373,14 @@ fork(void) {
   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz, curproc->stack_sz)) == 0){
     kfree(np->kstack);
     np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&ptable.lock);
+    freeslot(np);
+    release(&ptable.lock);
     return -1;
   }
   np->sz = curproc->sz; 
   np->stack_sz = curproc->stack_sz;
-  np->parent = curproc;
+  np->cpumask = curproc->cpumask;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
@@ -227,11 +396,14 @@ fork(void) {
   pid = np->pid;
 
   acquire(&ptable.lock);
-
-  np->state = RUNNABLE;
-
+  addchild(curproc, np);
   release(&ptable.lock);
 
+  acquire(&np->lock);
+  setrunnable(np);
+  release(&np->lock);
+  kickidle(np);
+
   return pid;
 }
 
@@ -241,7 +413,6 @@ fork(void) {
 void
 exit(int estatus) {
   struct proc *curproc = myproc();
-  struct proc *p;
   int fd;
 
   estatus = estatus & 0x7FFFFFFF; // Mask out the sign bit (32nd bit (MSB))
@@ -267,19 +438,17 @@ exit(int estatus) {
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait() (waiting for child to finish (exit())).
-  wakeup1(curproc->parent);
+  wakeup(curproc->parent);
 
   // Pass abandoned children to init process
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
-  }
+  reparent(curproc);
 
-  // Jump into the scheduler, never to return.
+  // Jump into the scheduler, never to return.  Our own lock stays
+  // held until another context has switched off our kernel stack
+  // (see finishswitch), so wait() cannot free it under us.
+  acquire(&curproc->lock);
   curproc->state = ZOMBIE;
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
@@ -288,18 +457,17 @@ exit(int estatus) {
 // Return -1 if this process has no children.
 int
 wait(int *estatus) {
-  struct proc *p;
+  struct proc *p, **pp;
   int havekids, pid;
   struct proc *curproc = myproc();
 
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for exited children.
+    // Scan through our children looking for exited ones.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
-        continue;
+    for(pp = &curproc->children; (p = *pp) != 0; pp = &p->sibling){
       havekids = 1;
+      acquire(&p->lock);
       if(p->state == ZOMBIE){
         // Found child process. Clean up & release resources (free memory)
         if(estatus) {
@@ -314,14 +482,16 @@ wait(int *estatus) {
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
         p->name[0] = 0;
         p->killed = 0;
-        p->state = UNUSED;
+        *pp = p->sibling;
+        p->sibling = 0;
+        freeslot(p);
+        release(&p->lock);
         release(&ptable.lock);
         return pid;
       }
+      release(&p->lock);
     }
 
     // No point waiting if we don't have any children.
@@ -334,7 +504,7 @@ wait(int *estatus) {
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in exit.)
     sleep(curproc, &ptable.lock);  //DOC: wait-sleep
   }
 }
@@ -359,7 +529,9 @@ idle(void) {
 
 // The process scheduler.
 //
-// Assumes ptable.lock is held, and no other locks.
+// Assumes the current process's p->lock is held (or, on an idle
+// CPU, that pushcli() has been called in its place), and no other
+// locks.
 // Assumes interrupts are disabled on this CPU.
 // Assumes proc->state != RUNNING (a process must have changed its
 // state before calling the scheduler).
@@ -370,20 +542,23 @@ idle(void) {
 // places where a lock is held but there's no process.)
 //
 // When invoked, does the following:
-//  - choose a process to run
+//  - choose a process to run, taking its p->lock
 //  - swtch to start running that process (or idle, if none)
+//  - the new context calls finishswitch(), which releases the
+//    lock of the process we switched away from
 //  - eventually that process transfers control
 //      via swtch back to the scheduler.
 
 static void
 sched(void) {
-  int intena;
-  struct proc *p;
+  int intena, busy;
+  struct proc *p, *prev;
   struct context **oldcontext;
   struct cpu *c = mycpu();
-  
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+
+  prev = c->proc;
+  if(prev && !holding(&prev->lock))
+    panic("sched p->lock");
   if(c->ncli != 1)
     panic("sched locks");
   if(readeflags()&FL_IF)
@@ -391,95 +566,326 @@ sched(void) {
 
   // Determine the current context, which is what we are switching from.
   // c->proc is NULL if CPU is idle. Pointer to process struct otherwise.
-  if(c->proc) { 
+  if(prev) { 
     // If there is a process currently running on this CPU
-    if(c->proc->state == RUNNING)
+    if(prev->state == RUNNING)
       panic("sched running");
-    oldcontext = &c->proc->context;
+    oldcontext = &prev->context;
   } else { 
     // If CPU is idle
     oldcontext = &(c->scheduler);
   }
 
-  // Choose next process to run.
-  if((p = roundrobin()) != 0) {
+  // Charge the time since the last trap or switch to prev.
+  cpuacct(0);
+
+  // Choose next process to run.  Returns with p->lock held.
+  // A process that gives up the CPU right after waking another
+  // (say, a pipe writer now waiting for the reply) hands the CPU
+  // straight to it, so a synchronous exchange costs one switch
+  // rather than a scan of the run queue.
+  p = 0;
+  if(prev) {
+    if(prev->handoff && prev->state != RUNNABLE && trypick(c, prev->handoff, &busy)) {
+      p = prev->handoff;
+      c->nhandoff++;
+    }
+    prev->handoff = 0;
+  }
+  // Deferred interrupt work comes before other processes.
+  if(p == 0 && c->worker && c->worker->state == RUNNABLE && trypick(c, c->worker, &busy))
+    p = c->worker;
+  if(p == 0)
+    p = roundrobin(c, &busy);
+
+  if(prev && prev != p) {
+    if(prev->preempted)
+      c->nivcsw++;
+    else
+      c->nvcsw++;
+  }
+  if(prev)
+    prev->preempted = 0;
+
+  if(p != 0) {
     // Switch to chosen process.  It is the process's job
-    // to release ptable.lock and then reacquire it
-    // before jumping back to us.
+    // to release p->lock (and, through finishswitch, prev's
+    // lock) before jumping back to us.
+    schedwait(c, p);
     p->state = RUNNING;
+    p->lastcpu = c - cpus;
+    __sync_fetch_and_sub(&ptable.nrunnable, 1);
     switchuvm(p);
-    if(c->proc != p) { 
+    if(prev != p) { 
       // If selected process is different from the one 
       // currently being run on this CPU
       c->proc = p;
+      c->prev = prev;
       intena = c->intena;
       swtch(oldcontext, p->context);
       // This code is reached when the process that was swapped is chosen
       // to run again. Might come back on another CPU v
       mycpu()->intena = intena;  // We might return on a different CPU.
+      finishswitch();
     }
   } else {
     // No process to run -- switch to the idle loop.
+    // A runnable process whose lock was busy may have been
+    // skipped; interrupt ourselves to look again once
+    // interrupts are back on.
+    if(busy && xchg(&c->kicked, 1) == 0)
+      lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
     switchkvm();
-    if(oldcontext != &(c->scheduler)) {
+    if(prev) {
+      pushcli();  // Stands in for a process lock while idle
       c->proc = 0;
+      c->prev = prev;
       intena = c->intena;
       swtch(oldcontext, c->scheduler);
       mycpu()->intena = intena;
+      finishswitch();
     }
   }
 }
 
+// Called on the new stack after sched() switches contexts.
+// The process we switched away from stays locked until we are
+// off its stack; now no other CPU can be using it, so release
+// it.  Coming from the idle loop, undo its pushcli() instead.
+static void
+finishswitch(void) {
+  struct cpu *c = mycpu();
+  struct proc *prev = c->prev;
+  int kick;
+
+  c->prev = 0;
+  if(prev == 0) {
+    popcli();
+    return;
+  }
+  // If prev was preempted it is still runnable, and
+  // another CPU may be idle and able to pick it up right away.
+  kick = prev->state == RUNNABLE;
+  release(&prev->lock);
+  if(kick)
+    kickidle(prev);
+}
+
 // Round-robin scheduler.
-// The same variable is used by all CPUs to determine the starting index.
-// It is protected by the process table lock, so no additional lock is
-// required.
-static int rrindex;
+// The same variable is used by all CPUs to determine where to start
+// looking.  It is only a hint, so CPUs update it without a lock.
+static struct proc *rrproc;
+
+// Try to lock p as the next process for CPU c.
+// Fails without spinning if p's lock is held elsewhere;
+// *busy is set so the caller knows to look again later.
+static int
+trypick(struct cpu *c, struct proc *p, int *busy) {
+  if(p == c->proc)
+    return p->state == RUNNABLE;  // Already locked by sched()
+  if(!tryacquire(&p->lock)) {
+    *busy = 1;
+    return 0;
+  }
+  if(p->state == RUNNABLE && CPUALLOWED(p, c - cpus))
+    return 1;
+  release(&p->lock);
+  return 0;
+}
 
+// Pick the next process for CPU c, and return it locked.
+// Only processes whose affinity mask includes c are considered.
+// Processes that last ran on c (or have never run) are preferred,
+// since their cache state is likely still warm there; any other
+// process is only migrated to c if c would otherwise go idle.
+// Candidates are locked with tryacquire(): c may be holding its
+// current process's lock, and another CPU may be holding that
+// candidate's lock while looking at ours.
 static struct proc *
-roundrobin() {
-  // Loop over process table looking for process to run.
-  for(int i = 0; i < NPROC; i++) {
-    struct proc *p = &ptable.proc[(i + rrindex + 1) % NPROC];
-    if(p->state != RUNNABLE)
-      continue;
-    rrindex = p - ptable.proc;
-    return p;
+roundrobin(struct cpu *c, int *busy) {
+  int id = c - cpus;
+  int i, migrate, n = ptable.nproc;
+  struct proc *p, *start = rrproc;
+
+  *busy = 0;
+  for(migrate = 0; migrate < 2; migrate++) {
+    // Loop over process table looking for process to run,
+    // starting after the last one picked and wrapping around.
+    p = start;
+    for(i = 0; i < n; i++) {
+      p = (p && p->allnext) ? p->allnext : ptable.procs;
+      if(p->state != RUNNABLE || !CPUALLOWED(p, id))
+        continue;
+      if(!migrate && p->lastcpu != id && p->lastcpu >= 0)
+        continue;
+      if(!trypick(c, p, busy))
+        continue;
+      rrproc = p;
+      return p;
+    }
   }
   return 0;
 }
 
-// Called from timer interrupt to reschedule the CPU.
+// Mark p runnable and count it as waiting for a CPU.
+// Every path onto the run queue (wakeup, yield, preemption,
+// fork) comes through here, so this is where the wait for a
+// CPU starts; sched() measures it when p is picked.
+// p->lock must be held.
+static void
+setrunnable(struct proc *p) {
+  p->readyat = nsecs();
+  p->state = RUNNABLE;
+  __sync_fetch_and_add(&ptable.nrunnable, 1);
+}
+
+// Record the time p spent RUNNABLE before CPU c picked it, and
+// whether it moved here from another CPU.  c->tstamp was just
+// set by cpuacct() in sched().
+static void
+schedwait(struct cpu *c, struct proc *p) {
+  uint64 wait;
+  uint us;
+  int i;
+
+  if(p->lastcpu >= 0 && p->lastcpu != c - cpus)
+    c->nmigrate++;
+  // Clocks on different CPUs may be slightly apart.
+  wait = c->tstamp > p->readyat ? c->tstamp - p->readyat : 0;
+  c->nwait++;
+  c->waitns += wait;
+  if(wait > c->maxwait)
+    c->maxwait = wait;
+  us = udiv64(wait, 1000, 0);
+  for(i = 0; us && i < NWAITHIST-1; i++)
+    us >>= 1;
+  c->waithist[i]++;
+}
+
+// Send a reschedule IPI to one idle CPU that p may run on, if
+// there is one, so that p does not wait for that CPU's next timer
+// interrupt.  The CPU p last ran on is tried first.  If every
+// such CPU is busy, kick one that has stopped its clock tick (see
+// lapictimer), so that it starts ticking again and p gets a turn.
+// A CPU that has already been kicked is skipped until it has
+// handled the IPI.
+// Called after p->lock is released, so that the CPU we kick
+// can lock p.
+static void
+kickidle(struct proc *p) {
+  struct cpu *c, *me;
+
+  pushcli();
+  me = mycpu();
+
+  // Order the nrunnable update before reading c->tickless and
+  // c->kicked; lapictimer() and reschedule() order them the
+  // other way around.
+  __sync_synchronize();
+
+  // There is now something to preempt for on this CPU too.
+  if(me->tickless)
+    lapictickstart();
+
+  if(p->lastcpu >= 0 && p->lastcpu < ncpu && CPUALLOWED(p, p->lastcpu)) {
+    c = &cpus[p->lastcpu];
+    if(c != me && c->started && !c->proc && !c->kicked) {
+      if(xchg(&c->kicked, 1) == 0)
+        lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+      goto done;
+    }
+  }
+  for(c = cpus; c < cpus+ncpu; c++) {
+    if(c == me || !c->started || c->proc || c->kicked || !CPUALLOWED(p, c - cpus))
+      continue;
+    if(xchg(&c->kicked, 1) == 0)
+      lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+    goto done;
+  }
+  for(c = cpus; c < cpus+ncpu; c++) {
+    if(c == me || !c->started || !c->tickless || c->kicked || !CPUALLOWED(p, c - cpus))
+      continue;
+    if(xchg(&c->kicked, 1) == 0)
+      lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+    goto done;
+  }
+done:
+  popcli();
+}
+
+// Charge the time on this CPU since the last accounting point
+// to the current process as user (user != 0) or kernel time, or
+// to idle if there is no current process.  Called on every trap
+// from user mode, return to user mode and context switch, so
+// the time between two calls is all of one kind.
+void
+cpuacct(int user) {
+  struct cpu *c;
+  struct proc *p;
+  uint64 now, d;
+
+  pushcli();
+  c = mycpu();
+  p = c->proc;
+  now = nsecs();
+  d = now - c->tstamp;
+  c->tstamp = now;
+  if(p == 0)
+    c->idle += d;
+  else if(user){
+    p->utime += d;
+    c->utime += d;
+  } else {
+    p->stime += d;
+    c->stime += d;
+  }
+  popcli();
+}
+
+// Can this CPU stop its periodic clock tick?  Only if no
+// process is waiting for a CPU: then there is nothing to
+// preempt for, and nothing for an idle CPU to pick up.
+int
+tickstop(void) {
+  return ptable.nrunnable == 0;
+}
+
+// Called from timer interrupt or reschedule IPI to reschedule the CPU.
 void
 reschedule(void) {
   struct cpu *c = mycpu();
+  struct proc *p = c->proc;
 
-  acquire(&ptable.lock);
-  if(c->proc) {
-    if(c->proc->state != RUNNING)
+  xchg(&c->kicked, 0);
+  if(p) {
+    acquire(&p->lock);
+    if(p->state != RUNNING)
       panic("current process not in running state");
-    c->proc->state = RUNNABLE;
-  }
+    p->preempted = 1;
+    setrunnable(p);
+  } else
+    pushcli();
   sched();
-  // NOTE: there is a race here.  We need to release the process
-  // table lock before idling the CPU, but as soon as we do, it
-  // is possible that an an event on another CPU could cause a process
-  // to become ready to run.  The undesirable (but non-catastrophic)
-  // consequence of such an occurrence is that this CPU will idle until
-  // the next timer interrupt, when in fact it could have been doing
-  // useful work.  To do better than this, we would need to arrange
-  // for a CPU releasing the process table lock to interrupt all other
-  // CPUs if there could be any runnable processes.
-  release(&ptable.lock);
+  // We drop our lock before idling the CPU, so an event on another
+  // CPU may make a process runnable before we halt.  That CPU sees
+  // c->proc == 0 and sends us a reschedule IPI (see kickidle),
+  // which the local APIC holds pending until interrupts are enabled
+  // again, so the wakeup is not lost.
+  if(p)
+    release(&p->lock);
+  else
+    popcli();
 }
 
 // Give up the CPU for one scheduling round.
 void
 yield(void) {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct proc *p = myproc();
+
+  acquire(&p->lock);  //DOC: yieldlock
+  setrunnable(p);
   sched();
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -487,8 +893,9 @@ yield(void) {
 void
 forkret(void) {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding p->lock from scheduler.
+  finishswitch();
+  release(&myproc()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -502,6 +909,18 @@ forkret(void) {
   // Return to "caller", actually trapret (see allocproc).
 }
 
+// A kernel thread's very first scheduling will swtch here.
+// "Return" to the thread's function (see kfork).
+static void
+kforkret(void) {
+  // Still holding p->lock from scheduler.
+  finishswitch();
+  release(&myproc()->lock);
+  // We may have been switched to from an interrupt handler;
+  // kernel threads run with interrupts on.
+  sti();
+}
+
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void
@@ -514,50 +933,188 @@ sleep(void *chan, struct spinlock *lk) {
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
+  // Must acquire p->lock in order to
   // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
+  // Once we hold p->lock, we can be
   // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
-  // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1 // wakeup() race impossible with ptable.lock held
-    release(lk);
-  }
+  // (wakeup locks p->lock), so it's okay to release lk.
+  acquire(&p->lock);  //DOC: sleeplock1
+  release(lk);
+
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
 
-  sched(); // Returns with ptable.lock held
+  sched(); // Returns with p->lock held
 
   // Tidy up.
   p->chan = 0;
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  release(&p->lock);  //DOC: sleeplock2
+  acquire(lk);
 }
 
-//PAGEBREAK!
-// Wake up all processes sleeping on chan.
-// The ptable lock must be held.
+// Timer function for sleeptimeout(): the time is up,
+// so wake the process whether or not chan was signalled.
 static void
-wakeup1(void *chan) {
+timeout(void *arg) {
+  struct proc *p = arg;
+  int woken = 0;
+
+  acquire(&p->lock);
+  p->timedout = 1;
+  if(p->state == SLEEPING) {
+    setrunnable(p);
+    woken = 1;
+  }
+  release(&p->lock);
+  if(woken)
+    kickidle(p);
+}
+
+// Like sleep(), but give up after n clock ticks.
+// For blocking system calls that need a timeout.
+// Returns 0 if woken up, -1 if the time ran out.
+int
+sleeptimeout(void *chan, struct spinlock *lk, uint n) {
+  struct proc *p = myproc();
+  struct timer t;
+
+  if(p == 0)
+    panic("sleeptimeout");
+  if(lk == 0)
+    panic("sleeptimeout lk");
+
+  p->timedout = 0;
+  t.pending = 0;
+  timeradd(&t, n, timeout, p);
+
+  acquire(&p->lock);
+  release(lk);
+  // The timer may have fired before we got p->lock.
+  if(!p->timedout){
+    p->chan = chan;
+    p->state = SLEEPING;
+    sched();
+    p->chan = 0;
+  }
+  release(&p->lock);
+
+  // Disarm the timer before reacquiring lk: the timer wheel lock
+  // is taken before p->lock when a timer fires.
+  timerdel(&t);
+  acquire(lk);
+  return p->timedout ? -1 : 0;
+}
+
+// Find the process with the given pid
+// and return it locked, or 0 if there is none.
+static struct proc*
+lockpid(int pid) {
   struct proc *p;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  acquire(&ptable.lock);
+  if((p = findpid(pid)) != 0)
+    acquire(&p->lock);
+  release(&ptable.lock);
+  return p;
 }
 
+//PAGEBREAK!
 // Wake up all processes sleeping on chan.
+// The caller holds the lock that protects the condition slept
+// on, so a process on its way to sleep on chan holds its p->lock
+// and is still RUNNING until it is off its CPU.  Processes in any
+// other state cannot be sleeping on chan and are skipped without
+// taking their lock.
 void
 wakeup(void *chan) {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  struct proc *p, *me = myproc();
+  int woken, intr = inintr();
+
+  for(p = ptable.procs; p; p = p->allnext) {
+    if(p->state != SLEEPING && p->state != RUNNING)
+      continue;
+    if(p == me)
+      continue;
+    acquire(&p->lock);
+    woken = p->state == SLEEPING && p->chan == chan;
+    if(woken)
+      setrunnable(p);
+    release(&p->lock);
+    if(woken) {
+      // If we are about to sleep, run p next (see sched).
+      // Not from an interrupt handler: me is just whoever
+      // it interrupted.
+      if(me && !intr)
+        me->handoff = p;
+      kickidle(p);
+    }
+  }
+}
+
+// Sleep on wait queue q, behind the processes already there.
+// lk is released while asleep and protects q.  Returns when
+// woken by wakeone(), or early if killed; either way the caller
+// must check its condition again.
+void
+sleepq(struct waitq *q, struct spinlock *lk) {
+  struct waiter w, *prev, *x;
+
+  w.proc = myproc();
+  w.woken = 0;
+  w.next = 0;
+  if(q->tail)
+    q->tail->next = &w;
+  else
+    q->head = &w;
+  q->tail = &w;
+
+  sleep(&w, lk);
+
+  // Woken by something other than wakeone(): leave the queue.
+  if(!w.woken){
+    prev = 0;
+    for(x = q->head; x != &w; x = x->next)
+      prev = x;
+    if(prev)
+      prev->next = w.next;
+    else
+      q->head = w.next;
+    if(q->tail == &w)
+      q->tail = prev;
+  }
+}
+
+// Wake the process that has waited longest on q, if any.
+// Unlike wakeup(), wakes just the one process, so that waiters
+// for a single resource don't all run only to sleep again.
+// The caller must hold the lock passed to sleepq().
+void
+wakeone(struct waitq *q) {
+  struct waiter *w;
+  struct proc *p, *me = myproc();
+  int woken;
+
+  if((w = q->head) == 0)
+    return;
+  q->head = w->next;
+  if(q->head == 0)
+    q->tail = 0;
+  w->woken = 1;
+
+  p = w->proc;
+  acquire(&p->lock);
+  woken = p->state == SLEEPING && p->chan == w;
+  if(woken)
+    setrunnable(p);
+  release(&p->lock);
+  if(woken){
+    if(me && !inintr())
+      me->handoff = p;
+    kickidle(p);
+  }
 }
 
 // Kill the process with the given pid.
@@ -566,21 +1123,153 @@ wakeup(void *chan) {
 int
 kill(int pid) {
   struct proc *p;
+  int woken;
+
+  if((p = lockpid(pid)) == 0)
+    return -1;
+  p->killed = 1;
+  p->exit_status = -1;
+  // Wake process from sleep if necessary.
+  woken = p->state == SLEEPING;
+  if(woken)
+    setrunnable(p);
+  release(&p->lock);
+  if(woken)
+    kickidle(p);
+  return 0;
+}
+
+// Restrict the process with the given pid (0 for the current
+// process) to the CPUs in mask.  Bits for CPUs that don't exist
+// are ignored.  If the process is running on a CPU it may no
+// longer use, it moves at its next scheduling point: right away
+// for the current process, at the next clock tick otherwise.
+int
+setaffinity(int pid, uint mask) {
+  struct proc *p;
+  struct cpu *c;
+  int moved = 0;
+
+  mask &= (1 << ncpu) - 1;
+  if(mask == 0)
+    return -1;
+
+  if((p = lockpid(pid ? pid : myproc()->pid)) == 0)
+    return -1;
+  p->cpumask = mask;
+  // Don't let a stale preference for a CPU p may no longer
+  // use make every other CPU treat p as a migration.
+  if(p->lastcpu >= 0 && !CPUALLOWED(p, p->lastcpu))
+    p->lastcpu = -1;
+  if(p->state == RUNNING){
+    for(c = cpus; c < cpus+ncpu; c++){
+      if(c->proc != p || CPUALLOWED(p, c - cpus))
+        continue;
+      if(p == myproc())
+        moved = 1;
+      else
+        lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED); // restart its clock tick
+    }
+  }
+  release(&p->lock);
+  if(moved)
+    yield();
+  return 0;
+}
+
+// Return the affinity mask of the process with the given pid
+// (0 for the current process), or -1 if there is no such process.
+int
+getaffinity(int pid) {
+  struct proc *p;
+  int mask;
+
+  if((p = lockpid(pid ? pid : myproc()->pid)) == 0)
+    return -1;
+  mask = p->cpumask & ((1 << ncpu) - 1);
+  release(&p->lock);
+  return mask;
+}
+
+// Copy CPU usage for up to n processes to the array of
+// struct procinfo at user address va.
+// Returns the number of processes copied, or -1.
+int
+procinfo(uint va, int n) {
+  struct proc *p;
+  struct procinfo pi;
+  int i = 0;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      p->exit_status = -1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+  for(p = ptable.procs; p && i < n; p = p->allnext){
+    if(p->state == UNUSED)
+      continue;
+    pi.pid = p->pid;
+    pi.ppid = p->parent ? p->parent->pid : 0;
+    pi.state = p->state;
+    pi.cpu = p->lastcpu;
+    pi.utime = udiv64(p->utime, 1000000, 0);
+    pi.stime = udiv64(p->stime, 1000000, 0);
+    pi.sz = p->sz;
+    safestrcpy(pi.name, p->name, sizeof(pi.name));
+    if(copyout(myproc()->pgdir, va + i*sizeof(pi), &pi, sizeof(pi)) < 0){
       release(&ptable.lock);
-      return 0;
+      return -1;
     }
+    i++;
   }
   release(&ptable.lock);
-  return -1;
+  return i;
+}
+
+// Copy CPU usage for up to n CPUs to the array of
+// struct cpuinfo at user address va.
+// Returns the number of CPUs copied, or -1.
+int
+cpuinfo(uint va, int n) {
+  struct cpu *c;
+  struct proc *p;
+  struct cpuinfo ci;
+  int i;
+
+  for(i = 0; i < n && i < ncpu; i++){
+    c = &cpus[i];
+    p = c->proc;
+    ci.cpu = i;
+    ci.utime = udiv64(c->utime, 1000000, 0);
+    ci.stime = udiv64(c->stime, 1000000, 0);
+    ci.idle = udiv64(c->idle, 1000000, 0);
+    ci.pid = p ? p->pid : 0;
+    if(copyout(myproc()->pgdir, va + i*sizeof(ci), &ci, sizeof(ci)) < 0)
+      return -1;
+  }
+  return i;
+}
+
+// Copy scheduler statistics for up to n CPUs to the array of
+// struct schedstat at user address va.
+// Returns the number of CPUs copied, or -1.
+int
+schedstat(uint va, int n) {
+  struct cpu *c;
+  struct schedstat ss;
+  int i, j;
+
+  for(i = 0; i < n && i < ncpu; i++){
+    c = &cpus[i];
+    ss.cpu = i;
+    ss.nvcsw = c->nvcsw;
+    ss.nivcsw = c->nivcsw;
+    ss.nmigrate = c->nmigrate;
+    ss.nwait = c->nwait;
+    ss.waitus = udiv64(c->waitns, 1000, 0);
+    ss.maxwaitus = udiv64(c->maxwait, 1000, 0);
+    for(j = 0; j < NWAITHIST; j++)
+      ss.waithist[j] = c->waithist[j];
+    if(copyout(myproc()->pgdir, va + i*sizeof(ss), &ss, sizeof(ss)) < 0)
+      return -1;
+  }
+  return i;
 }
 
 //PAGEBREAK: 36
@@ -602,14 +1291,15 @@ procdump(void) {
   char *state;
   uint pc[10];
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.procs; p; p = p->allnext){
     if(p->state == UNUSED)
       continue;
     if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %s %dms/%dms", p->pid, state, p->name,
+            (uint)udiv64(p->utime, 1000000, 0), (uint)udiv64(p->stime, 1000000, 0));
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
@@ -684,7 +1374,6 @@ validate_time(struct rtcdate *r) {
 void
 daemonexit(void) {
   struct proc *curproc = myproc();
-  struct proc *p;
   int fd;
 
   // Close all open files.
@@ -698,19 +1387,15 @@ daemonexit(void) {
   acquire(&ptable.lock);
 
   /* Init process might be sleeping in wait() (waiting for its children to exit) */
-  wakeup1(curproc->parent);
+  wakeup(curproc->parent);
 
   // Pass abandoned children to init process
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
-  }
+  reparent(curproc);
 
-  // Jump into the scheduler, never to return.
+  // Jump into the scheduler, never to return (see exit).
+  acquire(&curproc->lock);
   curproc->state = ZOMBIE;
+  release(&ptable.lock);
   sched();
   panic("zombie daemonexit");
 }
@@ -725,25 +1410,18 @@ kfork(void (*func)(void)) {
   struct proc *p;
   char *sp;
 
+  /* Take an unused process slot off the free list */
   acquire(&ptable.lock);
-
-  /* Find unsused process slot in ptable */
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-
-  release(&ptable.lock);
-  return;
-
-/* Unsused process table entry found */
-found:
-  p->pid = nextpid++;
-  p->parent = initproc;
+  p = allocslot();
   release(&ptable.lock);
+  if(p == 0)
+    return;
 
   /* Allocate kernel stack */
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeslot(p);
+    release(&ptable.lock);
     return;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -753,26 +1431,32 @@ found:
   sp -= sizeof *p->tf;
   p->tf = (struct trapframe*)sp;
 
-  // Set up new context to start executing at forkret,
-  // which returns to trapret.
+  // Set up new context to start executing at kforkret,
+  // which returns to func, which returns to daemonexit.
   sp -= 4;
   *(uint*)sp = (uint)daemonexit;
+  sp -= 4;
+  *(uint*)sp = (uint)func;
 
   sp -= sizeof *p->context;
   p->context = (struct context*)sp;
   memset(p->context, 0, sizeof *p->context);
-  p->context->eip = (uint)func;
+  p->context->eip = (uint)kforkret;
 
   /* Allocate kernel Page Table */
   if((p->pgdir = setupkvm()) == 0)
     panic("kfork");
 
-  /* Allow process to be scheduled */
+  /* Init process reaps the thread if it returns */
   acquire(&ptable.lock);
-
-  p->state = RUNNABLE;
-
+  addchild(initproc, p);
   release(&ptable.lock);
+
+  /* Allow process to be scheduled */
+  acquire(&p->lock);
+  setrunnable(p);
+  release(&p->lock);
+  kickidle(p);
 }
 
 /* ---------- DAEMONS ---------- */
@@ -1044,6 +1728,8 @@ do_nothing:
 */
 void
 daemonsinit(void) {
+  /* One workqueue thread per CPU */
+  workstart();
   /* Alerts console every 100 ticks */
   //kfork(ticktock);
   /* Manages movement of Processes between RAM and Disk */
@@ -1,9 +1,12 @@
 #ifndef PROC_H
 #define PROC_H
 #include "mmap.h"
+#include "spinlock.h"
+#include "procinfo.h"
 
 // Per-CPU state
 struct cpu {
+  struct cpu *self;            // This struct, read through %gs by mycpu()
   uchar apicid;                // Local APIC ID
   struct context *scheduler;   // Context used by scheduler and idle loop
   struct taskstate ts;         // Used by x86 to find stack for interrupt
@@ -12,6 +15,25 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  volatile uint kicked;        // Reschedule IPI sent but not yet handled
+  struct proc *prev;           // Process switched away from, unlocked by finishswitch()
+  struct proc *worker;         // Workqueue thread, run ahead of other processes
+  int inintr;                  // In a device or timer interrupt handler?
+  uint64 nexttick;             // Time (ns) of this CPU's next clock tick
+  uint64 deadline;             // Time (ns) the LAPIC timer is set to fire
+  volatile uint tickless;      // Is the periodic clock tick stopped?
+  uint64 tstamp;               // Time (ns) of the last CPU time accounting
+  uint64 utime;                // Time (ns) spent running user code
+  uint64 stime;                // Time (ns) spent in the kernel for a process
+  uint64 idle;                 // Time (ns) spent idle
+  uint nvcsw;                  // Voluntary context switches
+  uint nivcsw;                 // Involuntary context switches (preemptions)
+  uint nmigrate;               // Processes picked that last ran on another CPU
+  uint nhandoff;               // Switches handed straight to a woken process
+  uint nwait;                  // Processes picked from the run queue
+  uint64 waitns;               // Total time (ns) they were RUNNABLE first
+  uint64 maxwait;              // Longest of those waits (ns)
+  uint waithist[NWAITHIST];    // Wait time histogram (see struct schedstat)
 };
 
 extern struct cpu cpus[NCPU];
@@ -58,6 +80,7 @@ struct mapList {
 
 // Per-process state
 struct proc {
+  struct spinlock lock;        // Protects state, chan, killed, context, cpumask
   uint sz;                     // Size of process memory (bytes)
   uint stack_sz;               // Size of stack (Number of pages)
   struct mapList m;            // Memory Map List
@@ -69,15 +92,32 @@ struct proc {
   int pid;                     // Process ID
   int exit_status;             // Process exit status
   struct proc *parent;         // Parent process
+  struct proc *children;       // First child (list linked through sibling)
+  struct proc *sibling;        // Next child of the same parent
+  struct proc *hashnext;       // Next process in the same pid hash chain
+  struct proc *nextfree;       // Next UNUSED slot on the free list
+  struct proc *allnext;        // Next slot in the process table
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
+  int timedout;                // If non-zero, sleeptimeout() timer fired
+  uint cpumask;                // CPUs this process may run on (bit i = cpus[i])
+  int lastcpu;                 // CPU this process last ran on, -1 if none
+  uint64 utime;                // Time (ns) spent in user mode
+  uint64 stime;                // Time (ns) spent in the kernel
+  uint64 readyat;              // Time (ns) the process last became RUNNABLE
+  int preempted;               // Set by reschedule() while switching it out
+  struct proc *handoff;        // Last process this one woke; run it next if we sleep
+  uint nsyscall;               // System calls made; numbers the current one
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
 };
 
+// May process p run on cpus[id]?
+#define CPUALLOWED(p, id) ((p)->cpumask & (1 << (id)))
+
 // Process memory is laid out contiguously, low addresses first:
 //   text
 //   original data and bss
@@ -0,0 +1,72 @@
+#ifndef PROCINFO_H
+#define PROCINFO_H
+
+#include "types.h"
+
+// Process states, as reported in procinfo.state
+// (the same values as enum procstate in proc.h).
+#define PI_UNUSED   0
+#define PI_EMBRYO   1
+#define PI_SLEEPING 2
+#define PI_RUNNABLE 3
+#define PI_RUNNING  4
+#define PI_ZOMBIE   5
+
+/*
+*   Per-process CPU usage, filled in by procinfo().
+*   Member utime, stime: Milliseconds spent in user and kernel mode.
+*   Member cpu: CPU the process last ran on (-1 if it never has).
+*/
+struct procinfo {
+  int pid;
+  int ppid;
+  int state;
+  int cpu;
+  uint utime;
+  uint stime;
+  uint sz;
+  char name[16];
+};
+
+/*
+*   Per-CPU usage, filled in by cpuinfo().
+*   Member utime, stime, idle: Milliseconds spent running user code,
+*   running kernel code for a process, and idle.
+*   Member pid: Process running on the CPU, 0 if idle.
+*/
+struct cpuinfo {
+  int cpu;
+  uint utime;
+  uint stime;
+  uint idle;
+  int pid;
+};
+
+// Buckets in the run-queue wait histogram
+#define NWAITHIST 20
+
+/*
+*   Per-CPU scheduler statistics, filled in by schedstat().
+*   Member nvcsw, nivcsw: Switches away from a process that gave up
+*   the CPU (slept, yielded or exited) and that was preempted.
+*   Member nmigrate: Processes picked that last ran on another CPU.
+*   Member nhandoff: Switches made straight to a process the outgoing
+*   one had just woken, without a round-robin scan.
+*   Member nwait, waitus, maxwaitus: Processes picked, and the total
+*   and longest time (microseconds) they were RUNNABLE beforehand.
+*   Member waithist: waithist[0] counts waits under 1us, waithist[i]
+*   waits of 2^(i-1) to 2^i us; the last bucket counts every longer wait.
+*/
+struct schedstat {
+  int cpu;
+  uint nvcsw;
+  uint nivcsw;
+  uint nmigrate;
+  uint nhandoff;
+  uint nwait;
+  uint waitus;
+  uint maxwaitus;
+  uint waithist[NWAITHIST];
+};
+
+#endif // PROCINFO_H
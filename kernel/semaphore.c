@@ -6,12 +6,14 @@
 */
 void sem_init(struct semaphore *sp, int val) {
     sp->val = val;
+    sp->waiters.head = 0;
+    sp->waiters.tail = 0;
 }
 
 /*
 *   Allows processes to access shared resources. Puts the process
-*   to sleep if not yet allowed. Processes wait until sem_V calls wakeup()
-*   to try again.
+*   to sleep if not yet allowed. Processes wait in FIFO order until
+*   sem_V wakes them to try again.
 *   Sleep until sp->val becomes positive. 
 *   Decrements the Semaphore value and returns.
 *   *** Atomic ***
@@ -20,20 +22,21 @@ void sem_init(struct semaphore *sp, int val) {
 void sem_P(struct semaphore *sp) {
     acquire(&sp->semlock);
     while(sp->val <= 0)
-        sleep(sp, &sp->semlock);
+        sleepq(&sp->waiters, &sp->semlock);
     sp->val -= 1;
     release(&sp->semlock);
 }
 
 /*
-*   Increments the Semaphore value and calls wakeup() to wakeup any
-*   processes that are waiting on the current semaphore.
+*   Increments the Semaphore value and wakes up the process that
+*   has waited longest on the current semaphore.  Only one unit was
+*   added, so waking the others would only send them back to sleep.
 *   *** Atomic ***
 *   Atomicity is accomplished using a spinlock. 
 */
 void sem_V(struct semaphore *sp) {
     acquire(&sp->semlock);
     sp->val += 1;
-    wakeup(sp);`
+    wakeone(&sp->waiters);
     release(&sp->semlock);
 }
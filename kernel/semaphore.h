@@ -2,15 +2,18 @@
 #define SEMAPHORE_H
 
 #include "spinlock.h"
+#include "waitq.h"
 
 /*
 *   Initializes a semaphore.
 *   Member val: Semaphore value.
 *   Member semlock: Used to ensure ssemaphore functions are atomic.
+*   Member waiters: Processes waiting in sem_P, woken one at a time.
 */
 struct semaphore {
     int val;
     struct spinlock semlock;
+    struct waitq waiters;
 };
 
 /*
@@ -29,7 +32,8 @@ void sem_init(struct semaphore *sp, int val);
 void sem_P(struct semaphore *sp);
 
 /*
-*   If a process is sleeping on the current semaphore, wake it up.
+*   If processes are sleeping on the current semaphore, wake up
+*   the one that has waited longest.
 *   Paramater sp: Semaphore to be updated.
 */
 void sem_V(struct semaphore *sp);
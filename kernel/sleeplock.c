@@ -1,4 +1,13 @@
 // Sleeping locks
+//
+// Sleeplocks are adaptive: a process that finds the lock held by
+// a process running on another CPU spins until it is released,
+// since the holder is probably about to release it (inode and
+// buffer locks are often held for just a memmove).  Sleeping
+// would cost a wakeup and two trips through the scheduler.  Only
+// if the holder is not running (it is waiting for the disk, say)
+// does the process sleep.  Sleepers queue in FIFO order, and
+// releasesleep() wakes only the first of them.
 
 #include "types.h"
 #include "defs.h"
@@ -16,25 +25,70 @@ initsleeplock(struct sleeplock *lk, char *name) {
   lk->name = name;
   lk->locked = 0;
   lk->pid = 0;
+  lk->owner = 0;
+  lk->waiters.head = 0;
+  lk->waiters.tail = 0;
+  lk->stat = LOCKSTAT ? lockclass(name, 1) : 0;
+}
+
+// Is the holder of lk running on another CPU?  Process slots
+// are never freed, so owner can be looked at without locks;
+// the answer is only a hint.
+static int
+ownerrunning(struct proc *owner) {
+  return owner && owner != myproc() && owner->state == RUNNING;
 }
 
 void
 acquiresleep(struct sleeplock *lk) {
+  uint64 t0 = 0;
+  int contended;
+  struct proc *owner;
+
   acquire(&lk->lk);
+  contended = lk->locked;
+  if(LOCKSTAT && contended)
+    t0 = rdtsc();
   while (lk->locked) {
-    sleep(lk, &lk->lk);
+    owner = lk->owner;
+    if(ownerrunning(owner)){
+      // Spin, with interrupts on, until the lock is
+      // released or its holder stops running.
+      release(&lk->lk);
+      while(*(volatile uint*)&lk->locked && lk->owner == owner && ownerrunning(owner))
+        pause();
+      acquire(&lk->lk);
+      continue;
+    }
+    sleepq(&lk->waiters, &lk->lk);
   }
   lk->locked = 1;
   lk->pid = myproc()->pid;
+  lk->owner = myproc();
+  if(LOCKSTAT && lk->stat){
+    // Holding lk->lk, so interrupts are off.
+    lk->tacq = rdtsc();
+    lockacquired(lk->stat, contended, lk->tacq - t0);
+  }
   release(&lk->lk);
 }
 
 void
 releasesleep(struct sleeplock *lk) {
+  uint64 now;
+
   acquire(&lk->lk);
+  if(LOCKSTAT && lk->stat){
+    // The lock may have been taken on another CPU,
+    // whose TSC may be slightly ahead of ours.
+    now = rdtsc();
+    if(now > lk->tacq)
+      lockreleased(lk->stat, now - lk->tacq);
+  }
   lk->locked = 0;
   lk->pid = 0;
-  wakeup(lk);
+  lk->owner = 0;
+  wakeone(&lk->waiters);
   release(&lk->lk);
 }
 
@@ -3,15 +3,22 @@
 
 #include "types.h"
 #include "spinlock.h"
+#include "waitq.h"
 
 // Long-term locks for processes
 struct sleeplock {
   uint locked;       // Is the lock held?
   struct spinlock lk; // spinlock protecting this sleep lock
+  struct waitq waiters; // Processes sleeping for the lock, in FIFO order
   
   // For debugging:
   char *name;        // Name of lock.
   int pid;           // Process holding lock
+  struct proc *owner; // Process holding lock (see acquiresleep)
+
+  // Lock statistics (see lockstat.c):
+  struct lockstat *stat; // Class of this lock, 0 if not counted
+  uint64 tacq;       // When (TSC) the lock was acquired
 };
 
 #endif
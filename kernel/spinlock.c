@@ -1,4 +1,11 @@
 // Mutual exclusion spin locks.
+//
+// Ticket locks: acquire() takes the next ticket with an atomic
+// add and waits until the low half of lk->ticket (the ticket
+// being served) reaches it; release() serves the next ticket.
+// CPUs get the lock in the order they asked for it, and waiters
+// only read the lock's cache line until it is their turn,
+// instead of all hammering it with xchg.
 
 #include "types.h"
 #include "defs.h"
@@ -13,7 +20,9 @@ void
 initlock(struct spinlock *lk, char *name) {
   lk->name = name;
   lk->locked = 0;
+  lk->ticket = 0;
   lk->cpu = 0;
+  lk->stat = LOCKSTAT ? lockclass(name, 0) : 0;
 }
 
 // Acquire the lock.
@@ -22,13 +31,23 @@ initlock(struct spinlock *lk, char *name) {
 // other CPUs to waste time spinning to acquire it.
 void
 acquire(struct spinlock *lk) {
+  uint64 t0 = 0;
+  int contended;
+  ushort t;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
   
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // Take a ticket.  The add is atomic; only the high
+  // half changes, so it cannot disturb the low half.
+  t = __sync_fetch_and_add(&lk->ticket, 1 << 16) >> 16;
+  contended = (ushort)lk->ticket != t;
+  if(LOCKSTAT && contended)
+    t0 = rdtsc();
+  while((ushort)lk->ticket != t)
+    pause();
+  lk->locked = 1;
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -40,6 +59,43 @@ acquire(struct spinlock *lk) {
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
   getcallerpcs(&lk, lk->pcs);
+
+  if(LOCKSTAT && lk->stat){
+    lk->tacq = rdtsc();
+    lockacquired(lk->stat, contended, lk->tacq - t0);
+  }
+}
+
+// Acquire the lock only if it is free right now.
+// Returns 1 if the lock was acquired, 0 if another CPU holds it.
+// For callers that already hold a lock that the holder of lk
+// might be waiting for.
+int
+tryacquire(struct spinlock *lk) {
+  uint t;
+
+  pushcli();
+  if(holding(lk))
+    panic("tryacquire");
+
+  // Free only if no ticket is outstanding; take the
+  // next one only if that is still the case.
+  t = lk->ticket;
+  if((t >> 16) != (t & 0xffff) ||
+     !__sync_bool_compare_and_swap(&lk->ticket, t, t + (1 << 16))){
+    popcli();
+    return 0;
+  }
+  lk->locked = 1;
+  __sync_synchronize();
+
+  lk->cpu = mycpu();
+  getcallerpcs(&lk, lk->pcs);
+  if(LOCKSTAT && lk->stat){
+    lk->tacq = rdtsc();
+    lockacquired(lk->stat, 0, 0);
+  }
+  return 1;
 }
 
 // Release the lock.
@@ -49,8 +105,12 @@ release(struct spinlock *lk)
   if(!holding(lk))
     panic("release");
 
+  if(LOCKSTAT && lk->stat)
+    lockreleased(lk->stat, rdtsc() - lk->tacq);
+
   lk->pcs[0] = 0;
   lk->cpu = 0;
+  lk->locked = 0;
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that all the stores in the critical
@@ -59,10 +119,10 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+  // Serve the next ticket.  Only the holder writes the low
+  // half, so a plain 16-bit increment is enough; it leaves the
+  // high half alone for CPUs taking tickets concurrently.
+  asm volatile("incw %0" : "+m" (*(volatile ushort*)&lk->ticket) : );
 
   popcli();
 }
@@ -4,14 +4,21 @@
 #include "types.h"
 
 // Mutual exclusion lock.
+// A ticket lock: CPUs get the lock in the order they asked for it.
 struct spinlock {
   uint locked;       // Is the lock held?
+  volatile uint ticket; // Next ticket to hand out (high 16 bits)
+                        // and ticket now served (low 16 bits)
 
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+
+  // Lock statistics (see lockstat.c):
+  struct lockstat *stat; // Class of this lock, 0 if not counted
+  uint64 tacq;       // When (TSC) the lock was acquired
 };
 
 #endif
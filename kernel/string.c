@@ -12,6 +12,23 @@ memset(void *dst, int c, uint n)
   return dst;
 }
 
+// Divide the 64-bit n by d and return the quotient, storing the
+// remainder in *rem if rem is not null.  The kernel is not linked
+// with libgcc, so C's 64-bit division is not available.
+uint64
+udiv64(uint64 n, uint d, uint *rem)
+{
+  uint hi, lo, qlo, r;
+
+  hi = n >> 32;
+  lo = n;
+  r = hi % d;
+  asm("divl %4" : "=a" (qlo), "=d" (r) : "a" (lo), "d" (r), "rm" (d));
+  if(rem)
+    *rem = r;
+  return ((uint64)(hi / d) << 32) | qlo;
+}
+
 int
 memcmp(const void *v1, const void *v2, uint n)
 {
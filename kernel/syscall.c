@@ -160,6 +160,18 @@ extern int sys_unmount(void);
 extern int sys_lseek(void);
 extern int sys_mmap(void);
 extern int sys_munmap(void);
+extern int sys_clock_gettime(void);
+extern int sys_nanosleep(void);
+extern int sys_sched_setaffinity(void);
+extern int sys_sched_getaffinity(void);
+extern int sys_proclimit(void);
+extern int sys_procinfo(void);
+extern int sys_cpuinfo(void);
+extern int sys_schedstat(void);
+extern int sys_lockstat(void);
+extern int sys_bcachestat(void);
+extern int sys_diskstat(void);
+extern int sys_iosched(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -189,7 +201,19 @@ static int (*syscalls[])(void) = {
 [SYS_unmount] sys_unmount,
 [SYS_lseek]   sys_lseek,
 [SYS_mmap]    sys_mmap,
-[SYS_munmap]  sys_munmap
+[SYS_munmap]  sys_munmap,
+[SYS_clock_gettime] sys_clock_gettime,
+[SYS_nanosleep] sys_nanosleep,
+[SYS_sched_setaffinity] sys_sched_setaffinity,
+[SYS_sched_getaffinity] sys_sched_getaffinity,
+[SYS_proclimit] sys_proclimit,
+[SYS_procinfo] sys_procinfo,
+[SYS_cpuinfo] sys_cpuinfo,
+[SYS_schedstat] sys_schedstat,
+[SYS_lockstat] sys_lockstat,
+[SYS_bcachestat] sys_bcachestat,
+[SYS_diskstat] sys_diskstat,
+[SYS_iosched] sys_iosched
 };
 
 void
@@ -198,6 +222,7 @@ syscall(void) {
   struct proc *curproc = myproc();
 
   num = curproc->tf->eax; // Syscall number
+  curproc->nsyscall++;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
     curproc->tf->eax = syscalls[num]();
   } else {
@@ -30,5 +30,17 @@
 #define SYS_lseek   26
 #define SYS_mmap    27
 #define SYS_munmap  28
+#define SYS_clock_gettime 29
+#define SYS_nanosleep 30
+#define SYS_sched_setaffinity 31
+#define SYS_sched_getaffinity 32
+#define SYS_proclimit 33
+#define SYS_procinfo 34
+#define SYS_cpuinfo 35
+#define SYS_schedstat 36
+#define SYS_lockstat 37
+#define SYS_bcachestat 38
+#define SYS_diskstat 39
+#define SYS_iosched 40
 
 #endif // SYSCALL_H
@@ -16,6 +16,8 @@
 #include "file.h"
 #include "fcntl.h"
 #include "mmap.h"
+#include "bcache.h"
+#include "iostat.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -237,6 +239,42 @@ sys_fstat(void) {
   return filestat(f, st);
 }
 
+// Fill in buffer cache statistics.
+int
+sys_bcachestat(void) {
+  struct bcachestat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st), 0) < 0)
+    return -1;
+  bcachestat(st);
+  return 0;
+}
+
+// Fill in statistics for up to n disks.
+int
+sys_diskstat(void) {
+  struct diskstat *st;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NDISK)
+    n = NDISK;
+  if(argptr(0, (void*)&st, n*sizeof(*st), 0) < 0)
+    return -1;
+  return diskstat(st, n);
+}
+
+// Choose the I/O scheduler for the disk queues.
+int
+sys_iosched(void) {
+  char *name;
+
+  if(argstr(0, &name) < 0)
+    return -1;
+  return iosched(name);
+}
+
 // Create the path new as a link to the same inode as old.
 int
 sys_link(void) {
@@ -6,6 +6,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "procinfo.h"
+#include "lockstat.h"
 
 int
 sys_fork(void) {
@@ -59,21 +61,12 @@ sys_sbrk(void) {
 int
 sys_sleep(void) {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
-  return 0;
+  if(n <= 0)
+    return 0;
+  return sleepticks(n);
 }
 
 // return how many clock tick interrupts have occurred
@@ -82,6 +75,8 @@ int
 sys_uptime(void) {
   uint xticks;
 
+  // No CPU may have taken a clock tick lately.
+  tickupdate();
   acquire(&tickslock);
   xticks = ticks;
   release(&tickslock);
@@ -107,3 +102,113 @@ sys_setdate(void) {
 
   return setdate(r);
 }
+
+// Read a clock with nanosecond resolution.
+// Only CLOCK_MONOTONIC (time since boot) is supported.
+int
+sys_clock_gettime(void) {
+  int clk;
+  struct timespec *ts;
+  uint64 ns;
+
+  if(argint(0, &clk) < 0 || argptr(1, (char **) &ts, sizeof(*ts), 0) < 0)
+    return -1;
+  if(clk != CLOCK_MONOTONIC)
+    return -1;
+
+  ns = nsecs();
+  ts->tv_sec = udiv64(ns, 1000000000, &ts->tv_nsec);
+  return 0;
+}
+
+int
+sys_nanosleep(void) {
+  struct timespec *ts;
+
+  if(argptr(0, (char **) &ts, sizeof(*ts), 0) < 0)
+    return -1;
+  if(ts->tv_nsec >= 1000000000)
+    return -1;
+
+  return nanosleep((uint64)ts->tv_sec * 1000000000 + ts->tv_nsec);
+}
+
+// Restrict a process to a set of CPUs (bit i = CPU i).
+// pid 0 means the calling process.
+int
+sys_sched_setaffinity(void) {
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+int
+sys_sched_getaffinity(void) {
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getaffinity(pid);
+}
+
+// Get or set the soft limit on the number of processes.
+// n > 0 sets the limit; returns the previous limit.
+int
+sys_proclimit(void) {
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  return proclimit(n);
+}
+
+// Fill in CPU usage for up to n processes.
+// Returns the number of processes.
+int
+sys_procinfo(void) {
+  struct procinfo *pi;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || argptr(0, (char **) &pi, n*sizeof(*pi), 0) < 0)
+    return -1;
+  return procinfo((uint)pi, n);
+}
+
+// Fill in CPU usage for up to n CPUs.
+// Returns the number of CPUs.
+int
+sys_cpuinfo(void) {
+  struct cpuinfo *ci;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || argptr(0, (char **) &ci, n*sizeof(*ci), 0) < 0)
+    return -1;
+  return cpuinfo((uint)ci, n);
+}
+
+// Fill in scheduler statistics for up to n CPUs.
+// Returns the number of CPUs.
+int
+sys_schedstat(void) {
+  struct schedstat *ss;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || argptr(0, (char **) &ss, n*sizeof(*ss), 0) < 0)
+    return -1;
+  return schedstat((uint)ss, n);
+}
+
+// Fill in statistics for up to n lock classes.
+// Returns the number of classes, or -1 if lock
+// statistics are compiled out.
+int
+sys_lockstat(void) {
+  struct lockinfo *li;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || argptr(0, (char **) &li, n*sizeof(*li), 0) < 0)
+    return -1;
+  return lockstat((uint)li, n);
+}
@@ -0,0 +1,286 @@
+// Kernel timers.
+//
+// A timer calls a function once the clock tick count reaches
+// its expiry time.  Pending timers are kept in a two-level
+// timer wheel, so the clock interrupt only looks at timers
+// that are actually due instead of waking every sleeper:
+// * wheel.near[] has one slot per tick for the next NEAR ticks.
+// * wheel.far[] has one slot per NEAR ticks after that.  When the
+//   clock enters a new NEAR-tick window, the far slot for that
+//   window is cascaded down into near[].
+// Timers further away than the far wheel reaches are parked in the
+// far slot that cascades last and are filed again when it does.
+//
+// Interface:
+// * timeradd() arms a timer to fire n ticks from now.
+// * timerdel() disarms a timer that has not fired yet.
+// * sleepticks() puts the current process to sleep for n ticks.
+// Timer functions run from the clock interrupt with the wheel
+// lock held; they may call wakeup() but must not sleep.
+//
+// Sleeps shorter than a tick use nanosleep(), which keeps a sorted
+// list of nanosecond deadlines.  Each CPU checks the list from its
+// LAPIC timer interrupt (see lapictimer), and the CPU that adds a
+// deadline programs its LAPIC timer to fire at it.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "timer.h"
+
+#define NEARBITS  8
+#define FARBITS   6
+#define NEAR      (1 << NEARBITS)
+#define FAR       (1 << FARBITS)
+#define NEARMASK  (NEAR - 1)
+#define FARMASK   (FAR - 1)
+
+struct {
+  struct spinlock lock;
+  uint clk;                   // Last tick processed by timertick()
+  struct timer *near[NEAR];
+  struct timer *far[FAR];
+} wheel;
+
+struct {
+  struct spinlock lock;
+  struct hrtimer *head;       // Pending nanosleep() deadlines, earliest first
+} hr;
+
+void
+timerinit(void) {
+  initlock(&wheel.lock, "timer");
+  wheel.clk = ticks;
+  initlock(&hr.lock, "hrtimer");
+}
+
+// File t in the slot for its expiry time.
+// Caller must hold wheel.lock.
+static void
+timerinsert(struct timer *t) {
+  struct timer **slot;
+  uint delta;
+
+  if((int)(t->expires - wheel.clk) <= 0)
+    t->expires = wheel.clk + 1;
+  delta = t->expires - wheel.clk;
+
+  if(delta < NEAR)
+    slot = &wheel.near[t->expires & NEARMASK];
+  else if(delta < NEAR*FAR)
+    slot = &wheel.far[(t->expires >> NEARBITS) & FARMASK];
+  else
+    slot = &wheel.far[(wheel.clk >> NEARBITS) & FARMASK];
+
+  t->next = *slot;
+  if(t->next)
+    t->next->pprev = &t->next;
+  t->pprev = slot;
+  *slot = t;
+  t->pending = 1;
+}
+
+// Unlink t from its slot.  Caller must hold wheel.lock.
+static void
+timerremove(struct timer *t) {
+  *t->pprev = t->next;
+  if(t->next)
+    t->next->pprev = t->pprev;
+  t->next = 0;
+  t->pprev = 0;
+  t->pending = 0;
+}
+
+static void timercatchup(void);
+
+// Arm t to call func(arg) n ticks from now.
+static void
+timeradd1(struct timer *t, uint n, void (*func)(void*), void *arg) {
+  if(t->pending)
+    panic("timeradd");
+  // With every CPU tickless, neither ticks nor the wheel may have
+  // moved for a while: count n from the current time.
+  tickupdate();
+  timercatchup();
+  t->func = func;
+  t->arg = arg;
+  t->expires = wheel.clk + n;
+  timerinsert(t);
+  // This CPU's clock tick may be stopped; make sure
+  // it ticks in time to run the timer.
+  lapicnexttick((uint64)t->expires * (1000000000/HZ));
+}
+
+void
+timeradd(struct timer *t, uint n, void (*func)(void*), void *arg) {
+  acquire(&wheel.lock);
+  timeradd1(t, n, func, arg);
+  release(&wheel.lock);
+}
+
+// Disarm t.  Returns 1 if the timer was still pending,
+// 0 if it had already fired (or was never armed).
+int
+timerdel(struct timer *t) {
+  int pending;
+
+  acquire(&wheel.lock);
+  pending = t->pending;
+  if(pending)
+    timerremove(t);
+  release(&wheel.lock);
+  return pending;
+}
+
+// Move every timer in far slot i to where it now belongs.
+static void
+cascade(uint i) {
+  struct timer *t, *next;
+
+  t = wheel.far[i];
+  wheel.far[i] = 0;
+  for(; t; t = next){
+    next = t->next;
+    timerinsert(t);
+  }
+}
+
+// Advance the wheel to ticks, running every timer that has
+// expired on the way.  Caller must hold wheel.lock.
+static void
+timercatchup(void) {
+  struct timer *t;
+
+  while(wheel.clk != ticks){
+    wheel.clk++;
+    if((wheel.clk & NEARMASK) == 0)
+      cascade((wheel.clk >> NEARBITS) & FARMASK);
+    while((t = wheel.near[wheel.clk & NEARMASK]) != 0){
+      timerremove(t);
+      t->func(t->arg);
+    }
+  }
+}
+
+// Called from the clock interrupt after updating ticks.
+// Runs every timer that has expired since the last call.
+void
+timertick(void) {
+  // Unlocked check: most ticks have nothing to catch up on.
+  if(wheel.clk == ticks)
+    return;
+  acquire(&wheel.lock);
+  timercatchup();
+  release(&wheel.lock);
+}
+
+// Return the tick at which the next timer expires.  Timers in the
+// far wheel are only looked at when they cascade, so report the
+// next cascade if nothing is due sooner.  Used by tickless CPUs to
+// decide when they next need a clock tick.
+uint
+timernext(void) {
+  uint i, next;
+
+  acquire(&wheel.lock);
+  next = (wheel.clk | NEARMASK) + 1;
+  for(i = wheel.clk + 1; i != next; i++){
+    if(wheel.near[i & NEARMASK]){
+      next = i;
+      break;
+    }
+  }
+  release(&wheel.lock);
+  return next;
+}
+
+// Sleep for n clock ticks.
+// Only this process is woken when its timer fires.
+// Returns -1 if the process is killed before the time is up.
+int
+sleepticks(uint n) {
+  struct timer t;
+
+  acquire(&wheel.lock);
+  t.pending = 0;
+  timeradd1(&t, n, wakeup, &t);
+  while(t.pending){
+    if(myproc()->killed){
+      timerremove(&t);
+      release(&wheel.lock);
+      return -1;
+    }
+    sleep(&t, &wheel.lock);
+  }
+  release(&wheel.lock);
+  return 0;
+}
+
+// Remove t from the high-resolution list.  Caller must hold hr.lock.
+static void
+hrtimerremove(struct hrtimer *t) {
+  struct hrtimer **pp;
+
+  for(pp = &hr.head; *pp; pp = &(*pp)->next){
+    if(*pp == t){
+      *pp = t->next;
+      break;
+    }
+  }
+  t->pending = 0;
+}
+
+// Sleep for ns nanoseconds, without rounding up to a clock tick.
+// Returns -1 if the process is killed before the time is up.
+int
+nanosleep(uint64 ns) {
+  struct hrtimer t, **pp;
+
+  acquire(&hr.lock);
+  t.expires = nsecs() + ns;
+  for(pp = &hr.head; *pp && (*pp)->expires <= t.expires; pp = &(*pp)->next)
+    ;
+  t.next = *pp;
+  *pp = &t;
+  t.pending = 1;
+  lapicdeadline(t.expires);
+  while(t.pending){
+    if(myproc()->killed){
+      hrtimerremove(&t);
+      release(&hr.lock);
+      return -1;
+    }
+    sleep(&t, &hr.lock);
+  }
+  release(&hr.lock);
+  return 0;
+}
+
+// Called from the LAPIC timer interrupt.  Wakes every nanosleep()
+// whose deadline has passed and returns the next deadline
+// (~0 if there is none).
+uint64
+hrtimerrun(uint64 now) {
+  struct hrtimer *t;
+  uint64 next;
+
+  // Peek without the lock: a deadline added concurrently by
+  // another CPU is covered by that CPU's own LAPIC timer.
+  if(hr.head == 0)
+    return ~0ULL;
+
+  acquire(&hr.lock);
+  while((t = hr.head) != 0 && t->expires <= now){
+    hr.head = t->next;
+    t->pending = 0;
+    wakeup(t);
+  }
+  next = hr.head ? hr.head->expires : ~0ULL;
+  release(&hr.lock);
+  return next;
+}
@@ -0,0 +1,34 @@
+#ifndef TIMER_H
+#define TIMER_H
+
+#include "types.h"
+
+/*
+*   Kernel timer.
+*   Member expires: Clock tick at which the timer fires.
+*   Member func: Called with arg when the timer fires (timer wheel lock held).
+*   Member pending: Non-zero while the timer is in the timer wheel.
+*   Member next, pprev: Timer wheel slot list.
+*/
+struct timer {
+  uint expires;
+  void (*func)(void*);
+  void *arg;
+  int pending;
+  struct timer *next;
+  struct timer **pprev;
+};
+
+/*
+*   High-resolution timer for nanosleep().
+*   Member expires: Time (ns since boot) at which the timer fires.
+*   Member pending: Non-zero while the timer is on the list.
+*   Member next: List of pending timers, sorted by expires.
+*/
+struct hrtimer {
+  uint64 expires;
+  int pending;
+  struct hrtimer *next;
+};
+
+#endif // TIMER_H
@@ -18,6 +18,31 @@ extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
 
+// Bring ticks up to date with the clock.  Returns 1 if it advanced.
+// Any CPU taking a clock tick may be the one to do this: with
+// tickless idle, CPU 0 is not necessarily taking clock interrupts,
+// and every CPU may go up to MAXSLEEPNS without one, so readers
+// that need the current value call this first.
+int
+tickupdate(void) {
+  uint now;
+  int advanced;
+
+  now = udiv64(nsecs(), 1000000000/HZ, 0);
+  if(now == ticks)
+    return 0;
+  acquire(&tickslock);
+  advanced = (int)(now - ticks) > 0;
+  if(advanced)
+    ticks = now;
+  /* Wakeup swap daemon every 100 ticks */
+  //if((ticks % 100) == 0)
+    //cprintf("wake up swap - from trap\n");
+    //wakeup(&swapp);
+  release(&tickslock);
+  return advanced;
+}
+
 void
 tvinit(void) {
   int i;
@@ -133,9 +158,23 @@ mmap_pgfault(struct trapframe *tf) {
   return 0;
 }
 
+// Called by alltraps after trap() on the way back out.
+// Time since the trap was kernel time.
+void
+trapexit(struct trapframe *tf) {
+  if((tf->cs&3) == DPL_USER)
+    cpuacct(0);
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf) {
+  int resched = 0;
+
+  // Time since we last returned to user space was user time.
+  if((tf->cs&3) == DPL_USER)
+    cpuacct(1);
+
   if(tf->trapno == T_SYSCALL){
     if(myproc()->killed)
       exit(1);
@@ -166,18 +205,31 @@ trap(struct trapframe *tf) {
     }
   }
 
+  // Interrupt handlers run on behalf of no process (see wakeup).
+  if(tf->trapno >= T_IRQ0)
+    mycpu()->inintr = 1;
+
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
-    if(cpuid() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks); // Notify any processes that are sleeping waiting for the value of ticks to change
-      /* Wakeup swap daemon every 100 ticks */
-      //if((ticks % 100) == 0)
-        //cprintf("wake up swap - from trap\n");
-        //wakeup(&swapp);
-      release(&tickslock);
+    // The LAPIC timer also fires for nanosleep() deadlines
+    // between ticks; only a clock tick reschedules.
+    if(!lapictimer()){
+      lapiceoi();
+      break;
     }
+    resched = 1;
+    // Run expired timers (wakes only the sleepers that are due),
+    // including any due since tickupdate() was last called.
+    tickupdate();
+    timertick();
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_RESCHED:
+    /* Another CPU made a process runnable: pick it up if we are
+       idle, and restart our clock tick if it was stopped */
+    lapictickstart();
+    if(myproc() == 0)
+      resched = 1;
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE_P:
@@ -211,6 +263,12 @@ trap(struct trapframe *tf) {
 
   //PAGEBREAK: 13
   default:
+    /* PCI devices interrupt on whichever line the BIOS gave them */
+    if(tf->trapno >= T_IRQ0 && tf->trapno < T_IRQ0 + IRQ_ERROR &&
+       virtiointr(tf->trapno - T_IRQ0)){
+      lapiceoi();
+      break;
+    }
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
@@ -227,14 +285,22 @@ kill:
     myproc()->exit_status = -1;
   }
 
+  if(tf->trapno >= T_IRQ0)
+    mycpu()->inintr = 0;
+
   // Force process exit if it has been killed and is in user space.
   // (If it is still executing in the kernel, let it keep running
   // until it gets to the regular system call return.)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit(0);
 
-  // Invoke the scheduler on clock tick.
-  if(tf->trapno == T_IRQ0+IRQ_TIMER)
+  // Let this CPU's workqueue thread run work queued by the
+  // interrupt handler right away.
+  if(mycpu()->worker && mycpu()->worker->state == RUNNABLE)
+    resched = 1;
+
+  // Invoke the scheduler on clock tick or reschedule IPI.
+  if(resched)
     reschedule();
 
   // Check if the process has been killed since we yielded
@@ -38,6 +38,7 @@
 #define IRQ_IDE_P        14     // Triggered when primary disk drive has completed a request
 #define IRQ_IDE_S        15     // Triggered when secondary disk drive has completed a request
 #define IRQ_ERROR        19
+#define IRQ_RESCHED      20     // Inter-processor interrupt: a process became runnable
 #define IRQ_SPURIOUS     31
 
 #endif // TRAPS_H
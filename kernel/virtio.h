@@ -0,0 +1,90 @@
+#ifndef VIRTIO_H
+#define VIRTIO_H
+
+#include "types.h"
+
+// Legacy ("transitional") virtio PCI interface.  The registers
+// are in the I/O space of BAR 0.
+
+#define VIRTIO_VENDOR         0x1af4
+#define VIRTIO_DEV_BLK        0x1001   // block device, legacy interface
+
+#define VIRTIO_PCI_HOST_FEATURES  0x00   // 32 bits, device's features
+#define VIRTIO_PCI_GUEST_FEATURES 0x04   // 32 bits, features we use
+#define VIRTIO_PCI_QUEUE_PFN      0x08   // 32 bits, physical page of queue
+#define VIRTIO_PCI_QUEUE_SIZE     0x0c   // 16 bits, entries in queue
+#define VIRTIO_PCI_QUEUE_SEL      0x0e   // 16 bits, queue to configure
+#define VIRTIO_PCI_QUEUE_NOTIFY   0x10   // 16 bits, queue with new requests
+#define VIRTIO_PCI_STATUS         0x12   // 8 bits, see below
+#define VIRTIO_PCI_ISR            0x13   // 8 bits, read to acknowledge interrupt
+#define VIRTIO_PCI_CONFIG         0x14   // device specific (without MSI-X)
+
+// Device status bits
+#define VIRTIO_STAT_ACK       1
+#define VIRTIO_STAT_DRIVER    2
+#define VIRTIO_STAT_DRIVER_OK 4
+#define VIRTIO_STAT_FAILED    128
+
+// Legacy virtqueues are aligned to a page
+#define VIRTIO_QALIGN         4096
+
+/*
+*   Virtqueue descriptor: one buffer of a request.
+*   Member addr, len: Physical address and size.
+*   Member flags: VRING_DESC_F_*.
+*   Member next: Next descriptor of the request, if F_NEXT.
+*/
+struct vring_desc {
+  uint64 addr;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+
+#define VRING_DESC_F_NEXT     1   // request continues in next
+#define VRING_DESC_F_WRITE    2   // device writes (vs reads) the buffer
+
+/*
+*   Ring of requests for the device (driver writes).
+*   Member idx: Where the driver puts the next entry (mod size).
+*   Member ring: Head descriptors of requests.
+*/
+struct vring_avail {
+  ushort flags;
+  ushort idx;
+  ushort ring[];
+};
+
+struct vring_used_elem {
+  uint id;    // head descriptor of a finished request
+  uint len;   // bytes written into the request's buffers
+};
+
+/*
+*   Ring of finished requests (device writes).
+*   Member idx: Where the device puts the next entry (mod size).
+*/
+struct vring_used {
+  ushort flags;
+  ushort idx;
+  struct vring_used_elem ring[];
+};
+
+// Block device
+
+#define VIRTIO_BLK_CAPACITY   0   // config: 64 bits, size in sectors
+
+#define VIRTIO_BLK_T_IN       0   // read
+#define VIRTIO_BLK_T_OUT      1   // write
+
+/*
+*   First (device-readable) buffer of a block request.
+*   The data follows, then a one byte status (0 = OK).
+*/
+struct virtio_blk_req {
+  uint type;
+  uint reserved;
+  uint64 sector;
+};
+
+#endif // VIRTIO_H
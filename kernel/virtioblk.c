@@ -0,0 +1,334 @@
+// Driver for virtio block devices ("make qemu" attaches one with
+// -drive if=virtio), through the legacy virtio PCI interface.
+//
+// The disks are block devices after the IDE disks; iderw() hands
+// their buffers to virtiorw().  Each disk has one virtqueue and,
+// unlike IDE, takes many requests at once: every request is a
+// chain of descriptors holding the request header, the data of
+// one or more bufs for adjacent blocks, and a status byte the
+// device fills in.  The interrupt only acknowledges the device;
+// finished requests are collected by virtiodone() in a
+// workqueue thread.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "pci.h"
+#include "virtio.h"
+#include "workqueue.h"
+
+#define SECTOR_SIZE 512
+#define NVBLK       2     // Most virtio disks
+#define VQMAX       256   // Largest queue size supported
+#define VBLK_MAXSEG 32    // Most bufs in one request
+
+// Bytes of memory for a virtqueue of size n
+#define VQSIZE(n) (PGROUNDUP(sizeof(struct vring_desc)*(n) + 6 + 2*(n)) + \
+                   PGROUNDUP(6 + sizeof(struct vring_used_elem)*(n)))
+
+/*
+*   A request in flight.
+*   Member hdr, status: Read and written by the device.
+*   Member b, nbuf: The bufs it moves, linked through qnext.
+*/
+struct vreq {
+  struct virtio_blk_req hdr;
+  uchar status;
+  struct buf *b;
+  int nbuf;
+};
+
+/*
+*   Virtio disk.
+*   Member lock: Protects the queue and the descriptor free list.
+*   Member iobase, irq: Registers and interrupt line.
+*   Member capacity: Size in sectors.
+*   Member qsize: Entries in the virtqueue (chosen by the device).
+*   Member desc, avail, used: The virtqueue, in vqmem.
+*   Member usedidx: Next entry of used to look at.
+*   Member freedesc, nfree: Unused descriptors, chained by next.
+*   Member req: Requests in flight, by head descriptor.
+*   Member done: Collects finished requests (see virtiodone).
+*/
+static struct vblk {
+  struct spinlock lock;
+  uint iobase;
+  int irq;
+  uint64 capacity;
+  uint qsize;
+  struct vring_desc *desc;
+  struct vring_avail *avail;
+  struct vring_used *used;
+  ushort usedidx;
+  ushort freedesc;
+  uint nfree;
+  struct vreq req[VQMAX];
+  struct work done;
+} vblk[NVBLK];
+static int nvblk;
+
+static char vqmem[NVBLK][VQSIZE(VQMAX)] __attribute__((aligned(VIRTIO_QALIGN)));
+
+static void virtiodone(void*);
+
+static int
+allocdesc(struct vblk *vd) {
+  int d = vd->freedesc;
+
+  vd->freedesc = vd->desc[d].next;
+  vd->nfree--;
+  return d;
+}
+
+// Put the descriptors of the request starting at d back on
+// the free list.
+static void
+freechain(struct vblk *vd, int d) {
+  int next;
+
+  for(;;){
+    next = vd->desc[d].next;
+    vd->desc[d].next = vd->freedesc;
+    vd->freedesc = d;
+    vd->nfree++;
+    if(!(vd->desc[d].flags & VRING_DESC_F_NEXT))
+      break;
+    d = next;
+  }
+}
+
+// Set up the virtio disk at pd.  Returns -1 if it can't be used.
+static int
+vblkinit(struct vblk *vd, struct pcidev *pd, char *mem) {
+  uint iobase;
+  int i;
+
+  if(!(pd->bar[0] & 1))
+    return -1;
+  // No interrupt line (0 or 0xff), or one whose vector trap.c
+  // uses for something else: we could never hear from it.
+  if(pd->irq == 0 || pd->irq == 0xff || pd->irq >= IRQ_ERROR)
+    return -1;
+  iobase = pd->bar[0] & ~3;
+  pcienable(pd);
+
+  outb(iobase + VIRTIO_PCI_STATUS, 0);    // reset
+  outb(iobase + VIRTIO_PCI_STATUS, VIRTIO_STAT_ACK);
+  outb(iobase + VIRTIO_PCI_STATUS, VIRTIO_STAT_ACK | VIRTIO_STAT_DRIVER);
+  // None of the optional features are needed.
+  outl(iobase + VIRTIO_PCI_GUEST_FEATURES, 0);
+
+  outw(iobase + VIRTIO_PCI_QUEUE_SEL, 0);
+  vd->qsize = inw(iobase + VIRTIO_PCI_QUEUE_SIZE);
+  // A request takes at least three descriptors.
+  if(vd->qsize < 3 || vd->qsize > VQMAX){
+    outb(iobase + VIRTIO_PCI_STATUS, VIRTIO_STAT_FAILED);
+    return -1;
+  }
+  memset(mem, 0, VQSIZE(vd->qsize));
+  vd->desc = (struct vring_desc*)mem;
+  vd->avail = (struct vring_avail*)(mem + sizeof(struct vring_desc)*vd->qsize);
+  vd->used = (struct vring_used*)(mem + PGROUNDUP(sizeof(struct vring_desc)*vd->qsize +
+                                                  6 + 2*vd->qsize));
+  for(i = 0; i < vd->qsize; i++)
+    vd->desc[i].next = i + 1;
+  vd->freedesc = 0;
+  vd->nfree = vd->qsize;
+  vd->usedidx = 0;
+  outl(iobase + VIRTIO_PCI_QUEUE_PFN, V2P(mem) / VIRTIO_QALIGN);
+
+  vd->capacity = inl(iobase + VIRTIO_PCI_CONFIG + VIRTIO_BLK_CAPACITY) |
+                 (uint64)inl(iobase + VIRTIO_PCI_CONFIG + VIRTIO_BLK_CAPACITY + 4) << 32;
+  vd->iobase = iobase;
+  vd->irq = pd->irq;
+  initlock(&vd->lock, "virtio");
+  initwork(&vd->done, virtiodone, vd);
+  outb(iobase + VIRTIO_PCI_STATUS,
+       VIRTIO_STAT_ACK | VIRTIO_STAT_DRIVER | VIRTIO_STAT_DRIVER_OK);
+  ioapicenable(vd->irq, ncpu - 1);
+  return 0;
+}
+
+void
+virtioinit(void) {
+  struct pcidev *pd;
+  int i;
+
+  for(i = 0; nvblk < NVBLK && (pd = pcifindid(VIRTIO_VENDOR, VIRTIO_DEV_BLK, i)) != 0; i++)
+    if(vblkinit(&vblk[nvblk], pd, vqmem[nvblk]) == 0)
+      nvblk++;
+}
+
+// Is there a virtio disk number disk?
+int
+virtiodisk(uint disk) {
+  return disk < nvblk;
+}
+
+// Size of virtio disk number disk in blocks.
+uint
+virtiosize(uint disk) {
+  uint64 n = vblk[disk].capacity / (BSIZE/SECTOR_SIZE);
+
+  return n > 0xffffffff ? 0xffffffff : n;
+}
+
+// Queue a request moving the n bufs from bufs, which are for
+// adjacent blocks and all reads or all writes.
+// Caller holds vd->lock and has made sure n+2 descriptors are free.
+static void
+vblkqueue(struct vblk *vd, struct buf **bufs, int n) {
+  struct vreq *r;
+  int i, head, d, write;
+
+  write = bufs[0]->flags & B_DIRTY;
+  head = allocdesc(vd);
+  r = &vd->req[head];
+  r->hdr.type = write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+  r->hdr.reserved = 0;
+  r->hdr.sector = (uint64)bufs[0]->blockno * (BSIZE/SECTOR_SIZE);
+  r->status = 0xff;
+  r->b = bufs[0];
+  r->nbuf = n;
+
+  vd->desc[head].addr = V2P(&r->hdr);
+  vd->desc[head].len = sizeof(r->hdr);
+  vd->desc[head].flags = VRING_DESC_F_NEXT;
+  d = head;
+  for(i = 0; i < n; i++){
+    bufs[i]->qnext = i+1 < n ? bufs[i+1] : 0;
+    d = vd->desc[d].next = allocdesc(vd);
+    vd->desc[d].addr = V2P(bufs[i]->data);
+    vd->desc[d].len = BSIZE;
+    vd->desc[d].flags = VRING_DESC_F_NEXT | (write ? 0 : VRING_DESC_F_WRITE);
+  }
+  d = vd->desc[d].next = allocdesc(vd);
+  vd->desc[d].addr = V2P(&r->status);
+  vd->desc[d].len = 1;
+  vd->desc[d].flags = VRING_DESC_F_WRITE;
+
+  vd->avail->ring[vd->avail->idx % vd->qsize] = head;
+  // The device must see the request before the new index.
+  __sync_synchronize();
+  vd->avail->idx++;
+}
+
+// Sync n bufs with virtio disk number disk, as iderw().  Runs
+// of adjacent blocks go in one request, and all the requests
+// are queued before waiting for any.
+void
+virtiorw(uint disk, struct buf **bufs, int n) {
+  struct vblk *vd;
+  struct buf *b;
+  int i, k;
+
+  if(disk >= nvblk)
+    panic("virtiorw: no such disk");
+  vd = &vblk[disk];
+  for(i = 0; i < n; i++){
+    b = bufs[i];
+    if(!holdingsleep(&b->lock))
+      panic("virtiorw: buf not locked");
+    if(b->dev != bufs[0]->dev)
+      panic("virtiorw: mixed disks");
+    if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("virtiorw: nothing to do");
+    if((uint64)(b->blockno + 1) * (BSIZE/SECTOR_SIZE) > vd->capacity)
+      panic("virtiorw: block out of range");
+    b->flags &= ~B_ERROR;
+    sem_init(&b->sem, 0);
+  }
+
+  acquire(&vd->lock);
+  // The device orders requests itself, so they don't go
+  // through an I/O scheduler; just count them.
+  for(i = 0; i < n; i++)
+    ioqueued(bufs[i]);
+  for(i = 0; i < n; i += k){
+    // A request also takes a header and a status descriptor,
+    // and must fit in the queue.
+    for(k = 1; i+k < n && k < VBLK_MAXSEG && k < vd->qsize-2; k++){
+      b = bufs[i+k];
+      if(b->blockno != bufs[i+k-1]->blockno + 1 ||
+         (b->flags & B_DIRTY) != (bufs[i]->flags & B_DIRTY))
+        break;
+    }
+    // Let the device start on what is queued while we wait
+    // for descriptors.
+    while(vd->nfree < k+2){
+      outw(vd->iobase + VIRTIO_PCI_QUEUE_NOTIFY, 0);
+      sleep(&vd->nfree, &vd->lock);
+    }
+    vblkqueue(vd, bufs+i, k);
+    iocmd(bufs[i]->dev);
+  }
+  outw(vd->iobase + VIRTIO_PCI_QUEUE_NOTIFY, 0);
+  release(&vd->lock);
+
+  for(i = 0; i < n; i++)
+    sem_P(&bufs[i]->sem);
+}
+
+// Virtio disk interrupt on line irq.  Returns 0 if no virtio
+// disk uses it.
+int
+virtiointr(int irq) {
+  struct vblk *vd;
+  int mine = 0;
+
+  for(vd = vblk; vd < vblk+nvblk; vd++){
+    if(vd->irq != irq)
+      continue;
+    mine = 1;
+    // Reading the ISR status acknowledges the interrupt.
+    if(inb(vd->iobase + VIRTIO_PCI_ISR) & 1)
+      queuework(&vd->done);
+  }
+  return mine;
+}
+
+// Finish the requests the device has completed on disk arg.
+// Runs in a workqueue thread after virtiointr().
+static void
+virtiodone(void *arg) {
+  struct vblk *vd = arg;
+  struct vreq *r;
+  struct buf *b, *next;
+  int head, i;
+
+  acquire(&vd->lock);
+  while(vd->usedidx != vd->used->idx){
+    // Read the entry only after seeing the index.
+    __sync_synchronize();
+    head = vd->used->ring[vd->usedidx % vd->qsize].id;
+    r = &vd->req[head];
+    if(r->status != 0)
+      cprintf("virtio: disk error, sector %d\n", (uint)r->hdr.sector);
+    for(b = r->b, i = 0; i < r->nbuf; b = next, i++){
+      next = b->qnext;
+      iodone(b);
+      // Don't cache what a failed request read.
+      if(r->status != 0){
+        b->flags &= ~(B_VALID|B_DIRTY);
+        b->flags |= B_ERROR;
+      } else {
+        b->flags |= B_VALID;
+        b->flags &= ~B_DIRTY;
+      }
+      sem_V(&b->sem);
+    }
+    freechain(vd, head);
+    vd->usedidx++;
+  }
+  wakeup(&vd->nfree);
+  release(&vd->lock);
+}
@@ -15,17 +15,33 @@ pde_t *kpgdir;  // for use in scheduler()
 void
 seginit(void) {
   struct cpu *c;
+  int apicid;
 
   // Map "logical" addresses to virtual addresses using identity map.
   // Cannot share a CODE descriptor for both kernel and user
   // because it would have to have DPL_USR, but the CPU forbids
   // an interrupt from CPL=0 to DPL=3.
-  c = &cpus[cpuid()];
+  // mycpu() does not work until %gs is loaded below, so
+  // find this CPU's struct by its APIC ID.
+  apicid = lapicid();
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c->apicid == apicid)
+      break;
+  if(c == cpus+ncpu)
+    panic("seginit: unknown apicid");
   c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
   c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+
+  // Per-CPU data segment: %gs always points at this CPU's
+  // struct cpu while in the kernel (alltraps reloads it), so
+  // mycpu() and myproc() are a single load.
+  c->gdt[SEG_KCPU] = SEG(STA_W, c, sizeof(*c) - 1, 0);
+  c->self = c;
+
   lgdt(c->gdt, sizeof(c->gdt));
+  loadgs(SEG_KCPU << 3);
 }
 
 // Return the address of the PTE in page table pgdir
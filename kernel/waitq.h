@@ -0,0 +1,27 @@
+#ifndef WAITQ_H
+#define WAITQ_H
+
+/*
+*   A process waiting in sleepq(), linked on its own kernel stack.
+*   Member proc: The waiting process.
+*   Member woken: Set by wakeone() when it takes the waiter off the queue.
+*   Member next: Next waiter, in arrival order.
+*/
+struct waiter {
+  struct proc *proc;
+  int woken;
+  struct waiter *next;
+};
+
+/*
+*   FIFO queue of sleeping processes, for wake-one wakeups.
+*   All-zero is an empty queue.  Protected by the lock passed to sleepq().
+*   Member head: Longest waiting process, woken first.
+*   Member tail: Most recent waiter.
+*/
+struct waitq {
+  struct waiter *head;
+  struct waiter *tail;
+};
+
+#endif // WAITQ_H
@@ -0,0 +1,120 @@
+// Kernel workqueues.
+//
+// Interrupt handlers should do as little as possible with
+// interrupts off.  Anything longer (copying data out of a device,
+// starting the next request) can be deferred to a work item,
+// which runs in a kernel thread with interrupts on and may sleep.
+//
+// Each CPU has its own queue and its own worker thread, created
+// with kfork() and pinned to that CPU.  queuework() adds an item
+// to the queue of the CPU it is called on, so work queued by an
+// interrupt handler runs on the CPU that took the interrupt.
+// sched() runs a CPU's worker ahead of other processes, and
+// trap() reschedules as soon as the worker has work to do.
+//
+// Interface:
+// * initwork() sets up a work item to call func(arg).
+// * queuework() queues an item unless it is already queued.
+//   Safe to call from interrupt handlers.
+// An item may be queued again while its function runs.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "workqueue.h"
+
+struct workqueue {
+  struct spinlock lock;
+  struct work *head;          // Next item to run
+  struct work **tail;         // Where to link the next item queued
+};
+
+static struct workqueue wq[NCPU];
+static int nworker;           // Worker threads started so far
+
+void
+workinit(void) {
+  struct workqueue *q;
+
+  for(q = wq; q < wq+NCPU; q++){
+    initlock(&q->lock, "workqueue");
+    q->head = 0;
+    q->tail = &q->head;
+  }
+}
+
+void
+initwork(struct work *w, void (*func)(void*), void *arg) {
+  w->func = func;
+  w->arg = arg;
+  w->pending = 0;
+  w->next = 0;
+}
+
+// Queue w on this CPU's workqueue and wake its worker.
+// Returns 0 if w was already queued.
+int
+queuework(struct work *w) {
+  struct workqueue *q;
+
+  if(xchg(&w->pending, 1))
+    return 0;
+
+  pushcli();
+  q = &wq[cpuid()];
+  acquire(&q->lock);
+  popcli();
+  w->next = 0;
+  *q->tail = w;
+  q->tail = &w->next;
+  wakeup(q);
+  release(&q->lock);
+  return 1;
+}
+
+// Worker thread: pin ourselves to the next CPU without
+// one and run that CPU's work items forever.
+static void
+worker(void) {
+  struct proc *p = myproc();
+  struct workqueue *q;
+  struct work *w;
+  int id;
+
+  id = __sync_fetch_and_add(&nworker, 1);
+  safestrcpy(p->name, "kworker", sizeof(p->name));
+  setaffinity(0, 1 << id);
+  cpus[id].worker = p;
+  q = &wq[id];
+
+  acquire(&q->lock);
+  for(;;){
+    while((w = q->head) == 0)
+      sleep(q, &q->lock);
+    q->head = w->next;
+    if(q->head == 0)
+      q->tail = &q->head;
+    release(&q->lock);
+
+    // Clear pending first, so that func can queue w again.
+    xchg(&w->pending, 0);
+    w->func(w->arg);
+
+    acquire(&q->lock);
+  }
+}
+
+// Start one worker thread per CPU.
+// Must run after userinit(): kernel threads are children of init.
+void
+workstart(void) {
+  int i;
+
+  for(i = 0; i < ncpu; i++)
+    kfork(worker);
+}
@@ -0,0 +1,20 @@
+#ifndef WORKQUEUE_H
+#define WORKQUEUE_H
+
+#include "types.h"
+
+/*
+*   Deferred work item, run by a worker kernel thread.
+*   Member func: Called with arg in the worker thread (interrupts on,
+*   may sleep).
+*   Member pending: Non-zero while the item is on a queue.
+*   Member next: Queue list.
+*/
+struct work {
+  void (*func)(void*);
+  void *arg;
+  volatile uint pending;
+  struct work *next;
+};
+
+#endif // WORKQUEUE_H
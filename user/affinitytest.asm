@@ -0,0 +1,1583 @@
+
+_affinitytest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  for(i = 0; i < 50000000; ++i)
+    ;
+}
+
+int
+main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 24             	sub    $0x24,%esp
+  int all, pid, status;
+
+  all = sched_getaffinity(0);
+  14:	6a 00                	push   $0x0
+  16:	e8 48 05 00 00       	call   563 <sched_getaffinity>
+  printf(1, "default affinity mask: 0x%x\n", all);
+  1b:	83 c4 0c             	add    $0xc,%esp
+  1e:	50                   	push   %eax
+  all = sched_getaffinity(0);
+  1f:	89 c3                	mov    %eax,%ebx
+  printf(1, "default affinity mask: 0x%x\n", all);
+  21:	68 58 0a 00 00       	push   $0xa58
+  26:	6a 01                	push   $0x1
+  28:	e8 23 06 00 00       	call   650 <printf>
+  if(all <= 0) {
+  2d:	83 c4 10             	add    $0x10,%esp
+  30:	85 db                	test   %ebx,%ebx
+  32:	7e 7f                	jle    b3 <main+0xb3>
+    printf(1, "sched_getaffinity failed\n");
+    exit(1);
+  }
+
+  /* An empty mask, or one naming only CPUs that don't exist, is rejected */
+  if(sched_setaffinity(0, 0) >= 0 || sched_setaffinity(0, ~all) >= 0) {
+  34:	50                   	push   %eax
+  35:	50                   	push   %eax
+  36:	6a 00                	push   $0x0
+  38:	6a 00                	push   $0x0
+  3a:	e8 1c 05 00 00       	call   55b <sched_setaffinity>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	85 c0                	test   %eax,%eax
+  44:	78 1a                	js     60 <main+0x60>
+    printf(1, "sched_setaffinity accepted an empty mask\n");
+  46:	57                   	push   %edi
+  47:	57                   	push   %edi
+  48:	68 c0 0a 00 00       	push   $0xac0
+  4d:	6a 01                	push   $0x1
+  4f:	e8 fc 05 00 00       	call   650 <printf>
+    exit(1);
+  54:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  5b:	e8 13 04 00 00       	call   473 <exit>
+  if(sched_setaffinity(0, 0) >= 0 || sched_setaffinity(0, ~all) >= 0) {
+  60:	89 d8                	mov    %ebx,%eax
+  62:	56                   	push   %esi
+  63:	f7 d0                	not    %eax
+  65:	56                   	push   %esi
+  66:	50                   	push   %eax
+  67:	6a 00                	push   $0x0
+  69:	e8 ed 04 00 00       	call   55b <sched_setaffinity>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	85 c0                	test   %eax,%eax
+  73:	79 d1                	jns    46 <main+0x46>
+  }
+
+  /* Pin ourselves to CPU 0 and keep running there */
+  if(sched_setaffinity(0, 1) < 0 || sched_getaffinity(0) != 1) {
+  75:	51                   	push   %ecx
+  76:	51                   	push   %ecx
+  77:	6a 01                	push   $0x1
+  79:	6a 00                	push   $0x0
+  7b:	e8 db 04 00 00       	call   55b <sched_setaffinity>
+  80:	83 c4 10             	add    $0x10,%esp
+  83:	85 c0                	test   %eax,%eax
+  85:	78 12                	js     99 <main+0x99>
+  87:	83 ec 0c             	sub    $0xc,%esp
+  8a:	6a 00                	push   $0x0
+  8c:	e8 d2 04 00 00       	call   563 <sched_getaffinity>
+  91:	83 c4 10             	add    $0x10,%esp
+  94:	83 e8 01             	sub    $0x1,%eax
+  97:	74 34                	je     cd <main+0xcd>
+    printf(1, "sched_setaffinity(0, 1) failed\n");
+  99:	52                   	push   %edx
+  9a:	52                   	push   %edx
+  9b:	68 ec 0a 00 00       	push   $0xaec
+  a0:	6a 01                	push   $0x1
+  a2:	e8 a9 05 00 00       	call   650 <printf>
+    exit(1);
+  a7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  ae:	e8 c0 03 00 00       	call   473 <exit>
+    printf(1, "sched_getaffinity failed\n");
+  b3:	50                   	push   %eax
+  b4:	50                   	push   %eax
+  b5:	68 75 0a 00 00       	push   $0xa75
+  ba:	6a 01                	push   $0x1
+  bc:	e8 8f 05 00 00       	call   650 <printf>
+    exit(1);
+  c1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  c8:	e8 a6 03 00 00       	call   473 <exit>
+  for(i = 0; i < 50000000; ++i)
+  cd:	31 c0                	xor    %eax,%eax
+  cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  d2:	eb 09                	jmp    dd <main+0xdd>
+  d4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  d7:	83 c0 01             	add    $0x1,%eax
+  da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  e0:	3d 7f f0 fa 02       	cmp    $0x2faf07f,%eax
+  e5:	76 ed                	jbe    d4 <main+0xd4>
+  }
+  spin();
+
+  /* Children inherit the mask */
+  if((pid = fork()) == 0) {
+  e7:	e8 7f 03 00 00       	call   46b <fork>
+  ec:	85 c0                	test   %eax,%eax
+  ee:	75 2c                	jne    11c <main+0x11c>
+    if(sched_getaffinity(0) != 1) {
+  f0:	83 ec 0c             	sub    $0xc,%esp
+  f3:	6a 00                	push   $0x0
+  f5:	e8 69 04 00 00       	call   563 <sched_getaffinity>
+  fa:	83 c4 10             	add    $0x10,%esp
+  fd:	83 e8 01             	sub    $0x1,%eax
+ 100:	74 39                	je     13b <main+0x13b>
+      printf(1, "child did not inherit the affinity mask\n");
+ 102:	50                   	push   %eax
+ 103:	50                   	push   %eax
+ 104:	68 0c 0b 00 00       	push   $0xb0c
+ 109:	6a 01                	push   $0x1
+ 10b:	e8 40 05 00 00       	call   650 <printf>
+      exit(1);
+ 110:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 117:	e8 57 03 00 00       	call   473 <exit>
+    }
+    spin();
+    exit(0);
+  }
+  wait(&status);
+ 11c:	83 ec 0c             	sub    $0xc,%esp
+ 11f:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+ 122:	57                   	push   %edi
+ 123:	e8 53 03 00 00       	call   47b <wait>
+  if(status != 0)
+ 128:	83 c4 10             	add    $0x10,%esp
+ 12b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 12f:	74 2e                	je     15f <main+0x15f>
+    exit(1);
+ 131:	83 ec 0c             	sub    $0xc,%esp
+ 134:	6a 01                	push   $0x1
+ 136:	e8 38 03 00 00       	call   473 <exit>
+  for(i = 0; i < 50000000; ++i)
+ 13b:	31 c0                	xor    %eax,%eax
+ 13d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 140:	eb 09                	jmp    14b <main+0x14b>
+ 142:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 145:	83 c0 01             	add    $0x1,%eax
+ 148:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 14b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 14e:	3d 7f f0 fa 02       	cmp    $0x2faf07f,%eax
+ 153:	76 ed                	jbe    142 <main+0x142>
+    exit(0);
+ 155:	83 ec 0c             	sub    $0xc,%esp
+ 158:	6a 00                	push   $0x0
+ 15a:	e8 14 03 00 00       	call   473 <exit>
+
+  /* Another process's mask can be changed by pid */
+  if((pid = fork()) == 0) {
+ 15f:	e8 07 03 00 00       	call   46b <fork>
+ 164:	89 c6                	mov    %eax,%esi
+ 166:	85 c0                	test   %eax,%eax
+ 168:	75 24                	jne    18e <main+0x18e>
+    sleep(10);
+ 16a:	83 ec 0c             	sub    $0xc,%esp
+ 16d:	6a 0a                	push   $0xa
+ 16f:	e8 8f 03 00 00       	call   503 <sleep>
+    exit(sched_getaffinity(0) == all ? 0 : 1);
+ 174:	31 c0                	xor    %eax,%eax
+ 176:	89 04 24             	mov    %eax,(%esp)
+ 179:	e8 e5 03 00 00       	call   563 <sched_getaffinity>
+ 17e:	39 d8                	cmp    %ebx,%eax
+ 180:	0f 95 c0             	setne  %al
+ 183:	0f b6 c0             	movzbl %al,%eax
+ 186:	89 04 24             	mov    %eax,(%esp)
+ 189:	e8 e5 02 00 00       	call   473 <exit>
+  }
+  if(sched_setaffinity(pid, all) < 0) {
+ 18e:	50                   	push   %eax
+ 18f:	50                   	push   %eax
+ 190:	53                   	push   %ebx
+ 191:	56                   	push   %esi
+ 192:	e8 c4 03 00 00       	call   55b <sched_setaffinity>
+ 197:	83 c4 10             	add    $0x10,%esp
+ 19a:	85 c0                	test   %eax,%eax
+ 19c:	78 2c                	js     1ca <main+0x1ca>
+    printf(1, "sched_setaffinity(%d) failed\n", pid);
+    exit(1);
+  }
+  wait(&status);
+ 19e:	83 ec 0c             	sub    $0xc,%esp
+ 1a1:	57                   	push   %edi
+ 1a2:	e8 d4 02 00 00       	call   47b <wait>
+  if(status != 0) {
+ 1a7:	83 c4 10             	add    $0x10,%esp
+ 1aa:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 1ae:	74 34                	je     1e4 <main+0x1e4>
+    printf(1, "affinity of child %d was not changed\n", pid);
+ 1b0:	53                   	push   %ebx
+ 1b1:	56                   	push   %esi
+ 1b2:	68 38 0b 00 00       	push   $0xb38
+ 1b7:	6a 01                	push   $0x1
+ 1b9:	e8 92 04 00 00       	call   650 <printf>
+    exit(1);
+ 1be:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 1c5:	e8 a9 02 00 00       	call   473 <exit>
+    printf(1, "sched_setaffinity(%d) failed\n", pid);
+ 1ca:	57                   	push   %edi
+ 1cb:	56                   	push   %esi
+ 1cc:	68 8f 0a 00 00       	push   $0xa8f
+ 1d1:	6a 01                	push   $0x1
+ 1d3:	e8 78 04 00 00       	call   650 <printf>
+    exit(1);
+ 1d8:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 1df:	e8 8f 02 00 00       	call   473 <exit>
+  }
+
+  if(sched_getaffinity(-1) >= 0) {
+ 1e4:	83 ec 0c             	sub    $0xc,%esp
+ 1e7:	6a ff                	push   $0xffffffff
+ 1e9:	e8 75 03 00 00       	call   563 <sched_getaffinity>
+ 1ee:	83 c4 10             	add    $0x10,%esp
+ 1f1:	85 c0                	test   %eax,%eax
+ 1f3:	78 1a                	js     20f <main+0x20f>
+    printf(1, "sched_getaffinity accepted a bad pid\n");
+ 1f5:	51                   	push   %ecx
+ 1f6:	51                   	push   %ecx
+ 1f7:	68 60 0b 00 00       	push   $0xb60
+ 1fc:	6a 01                	push   $0x1
+ 1fe:	e8 4d 04 00 00       	call   650 <printf>
+    exit(1);
+ 203:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 20a:	e8 64 02 00 00       	call   473 <exit>
+  }
+
+  printf(1, "affinitytest ok\n");
+ 20f:	50                   	push   %eax
+ 210:	50                   	push   %eax
+ 211:	68 ad 0a 00 00       	push   $0xaad
+ 216:	6a 01                	push   $0x1
+ 218:	e8 33 04 00 00       	call   650 <printf>
+  exit(0);
+ 21d:	31 d2                	xor    %edx,%edx
+ 21f:	89 14 24             	mov    %edx,(%esp)
+ 222:	e8 4c 02 00 00       	call   473 <exit>
+ 227:	66 90                	xchg   %ax,%ax
+ 229:	66 90                	xchg   %ax,%ax
+ 22b:	66 90                	xchg   %ax,%ax
+ 22d:	66 90                	xchg   %ax,%ax
+ 22f:	90                   	nop
+
+00000230 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 230:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 231:	31 c0                	xor    %eax,%eax
+{
+ 233:	89 e5                	mov    %esp,%ebp
+ 235:	53                   	push   %ebx
+ 236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 239:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 240:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 244:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 247:	83 c0 01             	add    $0x1,%eax
+ 24a:	84 d2                	test   %dl,%dl
+ 24c:	75 f2                	jne    240 <strcpy+0x10>
+    ;
+  return os;
+}
+ 24e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 251:	89 c8                	mov    %ecx,%eax
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+ 255:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+ 267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 26a:	0f b6 02             	movzbl (%edx),%eax
+ 26d:	84 c0                	test   %al,%al
+ 26f:	75 17                	jne    288 <strcmp+0x28>
+ 271:	eb 3a                	jmp    2ad <strcmp+0x4d>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 27c:	83 c2 01             	add    $0x1,%edx
+ 27f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 282:	84 c0                	test   %al,%al
+ 284:	74 1a                	je     2a0 <strcmp+0x40>
+    p++, q++;
+ 286:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 288:	0f b6 19             	movzbl (%ecx),%ebx
+ 28b:	38 c3                	cmp    %al,%bl
+ 28d:	74 e9                	je     278 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 28f:	29 d8                	sub    %ebx,%eax
+}
+ 291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 294:	c9                   	leave
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2a4:	31 c0                	xor    %eax,%eax
+ 2a6:	29 d8                	sub    %ebx,%eax
+}
+ 2a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2ab:	c9                   	leave
+ 2ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 2b0:	31 c0                	xor    %eax,%eax
+ 2b2:	eb db                	jmp    28f <strcmp+0x2f>
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2c9:	74 15                	je     2e0 <strlen+0x20>
+ 2cb:	31 c0                	xor    %eax,%eax
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2d0:	83 c0 01             	add    $0x1,%eax
+ 2d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2d7:	89 c1                	mov    %eax,%ecx
+ 2d9:	75 f5                	jne    2d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2db:	89 c8                	mov    %ecx,%eax
+ 2dd:	5d                   	pop    %ebp
+ 2de:	c3                   	ret
+ 2df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2e0:	31 c9                	xor    %ecx,%ecx
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	89 c8                	mov    %ecx,%eax
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2fd:	89 d7                	mov    %edx,%edi
+ 2ff:	fc                   	cld
+ 300:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 302:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 305:	89 d0                	mov    %edx,%eax
+ 307:	c9                   	leave
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 31a:	0f b6 10             	movzbl (%eax),%edx
+ 31d:	84 d2                	test   %dl,%dl
+ 31f:	75 12                	jne    333 <strchr+0x23>
+ 321:	eb 1d                	jmp    340 <strchr+0x30>
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+ 328:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 32c:	83 c0 01             	add    $0x1,%eax
+ 32f:	84 d2                	test   %dl,%dl
+ 331:	74 0d                	je     340 <strchr+0x30>
+    if(*s == c)
+ 333:	38 d1                	cmp    %dl,%cl
+ 335:	75 f1                	jne    328 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 337:	5d                   	pop    %ebp
+ 338:	c3                   	ret
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 340:	31 c0                	xor    %eax,%eax
+}
+ 342:	5d                   	pop    %ebp
+ 343:	c3                   	ret
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 355:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 358:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 359:	31 db                	xor    %ebx,%ebx
+{
+ 35b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 35e:	eb 27                	jmp    387 <gets+0x37>
+    cc = read(0, &c, 1);
+ 360:	83 ec 04             	sub    $0x4,%esp
+ 363:	6a 01                	push   $0x1
+ 365:	56                   	push   %esi
+ 366:	6a 00                	push   $0x0
+ 368:	e8 1e 01 00 00       	call   48b <read>
+    if(cc < 1)
+ 36d:	83 c4 10             	add    $0x10,%esp
+ 370:	85 c0                	test   %eax,%eax
+ 372:	7e 1d                	jle    391 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 374:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 378:	8b 55 08             	mov    0x8(%ebp),%edx
+ 37b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 37f:	3c 0a                	cmp    $0xa,%al
+ 381:	74 10                	je     393 <gets+0x43>
+ 383:	3c 0d                	cmp    $0xd,%al
+ 385:	74 0c                	je     393 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 387:	89 df                	mov    %ebx,%edi
+ 389:	83 c3 01             	add    $0x1,%ebx
+ 38c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 38f:	7c cf                	jl     360 <gets+0x10>
+ 391:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 39a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 39d:	5b                   	pop    %ebx
+ 39e:	5e                   	pop    %esi
+ 39f:	5f                   	pop    %edi
+ 3a0:	5d                   	pop    %ebp
+ 3a1:	c3                   	ret
+ 3a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	56                   	push   %esi
+ 3b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3b5:	83 ec 08             	sub    $0x8,%esp
+ 3b8:	6a 00                	push   $0x0
+ 3ba:	ff 75 08             	push   0x8(%ebp)
+ 3bd:	e8 f1 00 00 00       	call   4b3 <open>
+  if(fd < 0)
+ 3c2:	83 c4 10             	add    $0x10,%esp
+ 3c5:	85 c0                	test   %eax,%eax
+ 3c7:	78 27                	js     3f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3c9:	83 ec 08             	sub    $0x8,%esp
+ 3cc:	ff 75 0c             	push   0xc(%ebp)
+ 3cf:	89 c3                	mov    %eax,%ebx
+ 3d1:	50                   	push   %eax
+ 3d2:	e8 f4 00 00 00       	call   4cb <fstat>
+  close(fd);
+ 3d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3dc:	e8 ba 00 00 00       	call   49b <close>
+  return r;
+ 3e1:	83 c4 10             	add    $0x10,%esp
+}
+ 3e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3e7:	89 f0                	mov    %esi,%eax
+ 3e9:	5b                   	pop    %ebx
+ 3ea:	5e                   	pop    %esi
+ 3eb:	5d                   	pop    %ebp
+ 3ec:	c3                   	ret
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3f5:	eb ed                	jmp    3e4 <stat+0x34>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	53                   	push   %ebx
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 407:	0f be 02             	movsbl (%edx),%eax
+ 40a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 40d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 410:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 415:	77 1e                	ja     435 <atoi+0x35>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 420:	83 c2 01             	add    $0x1,%edx
+ 423:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 426:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 42a:	0f be 02             	movsbl (%edx),%eax
+ 42d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 430:	80 fb 09             	cmp    $0x9,%bl
+ 433:	76 eb                	jbe    420 <atoi+0x20>
+  return n;
+}
+ 435:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 438:	89 c8                	mov    %ecx,%eax
+ 43a:	c9                   	leave
+ 43b:	c3                   	ret
+ 43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	8b 45 10             	mov    0x10(%ebp),%eax
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 44e:	85 c0                	test   %eax,%eax
+ 450:	7e 13                	jle    465 <memmove+0x25>
+ 452:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 454:	89 d7                	mov    %edx,%edi
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 460:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 461:	39 f8                	cmp    %edi,%eax
+ 463:	75 fb                	jne    460 <memmove+0x20>
+  return vdst;
+}
+ 465:	5e                   	pop    %esi
+ 466:	89 d0                	mov    %edx,%eax
+ 468:	5f                   	pop    %edi
+ 469:	5d                   	pop    %ebp
+ 46a:	c3                   	ret
+
+0000046b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 46b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <exit>:
+SYSCALL(exit)
+ 473:	b8 02 00 00 00       	mov    $0x2,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <wait>:
+SYSCALL(wait)
+ 47b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <pipe>:
+SYSCALL(pipe)
+ 483:	b8 04 00 00 00       	mov    $0x4,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <read>:
+SYSCALL(read)
+ 48b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <write>:
+SYSCALL(write)
+ 493:	b8 10 00 00 00       	mov    $0x10,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <close>:
+SYSCALL(close)
+ 49b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <kill>:
+SYSCALL(kill)
+ 4a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <exec>:
+SYSCALL(exec)
+ 4ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <open>:
+SYSCALL(open)
+ 4b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <mknod>:
+SYSCALL(mknod)
+ 4bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <unlink>:
+SYSCALL(unlink)
+ 4c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <fstat>:
+SYSCALL(fstat)
+ 4cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <link>:
+SYSCALL(link)
+ 4d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mkdir>:
+SYSCALL(mkdir)
+ 4db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <chdir>:
+SYSCALL(chdir)
+ 4e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <dup>:
+SYSCALL(dup)
+ 4eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getpid>:
+SYSCALL(getpid)
+ 4f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <sbrk>:
+SYSCALL(sbrk)
+ 4fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <sleep>:
+SYSCALL(sleep)
+ 503:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <uptime>:
+SYSCALL(uptime)
+ 50b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <getdate>:
+SYSCALL(getdate)
+ 513:	b8 16 00 00 00       	mov    $0x16,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <setdate>:
+SYSCALL(setdate)
+ 51b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <mount>:
+SYSCALL(mount)
+ 523:	b8 18 00 00 00       	mov    $0x18,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <unmount>:
+SYSCALL(unmount)
+ 52b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <lseek>:
+SYSCALL(lseek)
+ 533:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <mmap>:
+SYSCALL(mmap)
+ 53b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <munmap>:
+SYSCALL(munmap)
+ 543:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <clock_gettime>:
+SYSCALL(clock_gettime)
+ 54b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <nanosleep>:
+SYSCALL(nanosleep)
+ 553:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 55b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 563:	b8 20 00 00 00       	mov    $0x20,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <proclimit>:
+SYSCALL(proclimit)
+ 56b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <procinfo>:
+SYSCALL(procinfo)
+ 573:	b8 22 00 00 00       	mov    $0x22,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <cpuinfo>:
+SYSCALL(cpuinfo)
+ 57b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <schedstat>:
+SYSCALL(schedstat)
+ 583:	b8 24 00 00 00       	mov    $0x24,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <lockstat>:
+SYSCALL(lockstat)
+ 58b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <bcachestat>:
+SYSCALL(bcachestat)
+ 593:	b8 26 00 00 00       	mov    $0x26,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <diskstat>:
+SYSCALL(diskstat)
+ 59b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <iosched>:
+SYSCALL(iosched)
+ 5a3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+ 5ab:	66 90                	xchg   %ax,%ax
+ 5ad:	66 90                	xchg   %ax,%ax
+ 5af:	90                   	nop
+
+000005b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5b8:	89 d1                	mov    %edx,%ecx
+{
+ 5ba:	83 ec 3c             	sub    $0x3c,%esp
+ 5bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5c0:	85 d2                	test   %edx,%edx
+ 5c2:	0f 89 80 00 00 00    	jns    648 <printint+0x98>
+ 5c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5cc:	74 7a                	je     648 <printint+0x98>
+    x = -xx;
+ 5ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5d8:	31 f6                	xor    %esi,%esi
+ 5da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5e0:	89 c8                	mov    %ecx,%eax
+ 5e2:	31 d2                	xor    %edx,%edx
+ 5e4:	89 f7                	mov    %esi,%edi
+ 5e6:	f7 f3                	div    %ebx
+ 5e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5eb:	0f b6 92 e8 0b 00 00 	movzbl 0xbe8(%edx),%edx
+ 5f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5f6:	89 ca                	mov    %ecx,%edx
+ 5f8:	89 c1                	mov    %eax,%ecx
+ 5fa:	39 da                	cmp    %ebx,%edx
+ 5fc:	73 e2                	jae    5e0 <printint+0x30>
+  if(neg)
+ 5fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 601:	85 c0                	test   %eax,%eax
+ 603:	74 07                	je     60c <printint+0x5c>
+    buf[i++] = '-';
+ 605:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 60a:	89 f7                	mov    %esi,%edi
+ 60c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 60f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 612:	01 df                	add    %ebx,%edi
+ 614:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 618:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 621:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 624:	6a 01                	push   $0x1
+ 626:	50                   	push   %eax
+ 627:	56                   	push   %esi
+ 628:	e8 66 fe ff ff       	call   493 <write>
+  while(--i >= 0)
+ 62d:	89 f8                	mov    %edi,%eax
+ 62f:	83 c4 10             	add    $0x10,%esp
+ 632:	83 ef 01             	sub    $0x1,%edi
+ 635:	39 d8                	cmp    %ebx,%eax
+ 637:	75 df                	jne    618 <printint+0x68>
+}
+ 639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 63c:	5b                   	pop    %ebx
+ 63d:	5e                   	pop    %esi
+ 63e:	5f                   	pop    %edi
+ 63f:	5d                   	pop    %ebp
+ 640:	c3                   	ret
+ 641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 648:	31 c0                	xor    %eax,%eax
+ 64a:	eb 89                	jmp    5d5 <printint+0x25>
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 659:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+ 65c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 65f:	0f b6 1e             	movzbl (%esi),%ebx
+ 662:	83 c6 01             	add    $0x1,%esi
+ 665:	84 db                	test   %bl,%bl
+ 667:	74 67                	je     6d0 <printf+0x80>
+ 669:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 66c:	31 d2                	xor    %edx,%edx
+ 66e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 671:	eb 34                	jmp    6a7 <printf+0x57>
+ 673:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 677:	90                   	nop
+ 678:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 67b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 680:	83 f8 25             	cmp    $0x25,%eax
+ 683:	74 18                	je     69d <printf+0x4d>
+  write(fd, &c, 1);
+ 685:	83 ec 04             	sub    $0x4,%esp
+ 688:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 68b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 68e:	6a 01                	push   $0x1
+ 690:	50                   	push   %eax
+ 691:	57                   	push   %edi
+ 692:	e8 fc fd ff ff       	call   493 <write>
+ 697:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 69a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 69d:	0f b6 1e             	movzbl (%esi),%ebx
+ 6a0:	83 c6 01             	add    $0x1,%esi
+ 6a3:	84 db                	test   %bl,%bl
+ 6a5:	74 29                	je     6d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6aa:	85 d2                	test   %edx,%edx
+ 6ac:	74 ca                	je     678 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ae:	83 fa 25             	cmp    $0x25,%edx
+ 6b1:	75 ea                	jne    69d <printf+0x4d>
+      if(c == 'd'){
+ 6b3:	83 f8 25             	cmp    $0x25,%eax
+ 6b6:	0f 84 24 01 00 00    	je     7e0 <printf+0x190>
+ 6bc:	83 e8 63             	sub    $0x63,%eax
+ 6bf:	83 f8 15             	cmp    $0x15,%eax
+ 6c2:	77 1c                	ja     6e0 <printf+0x90>
+ 6c4:	ff 24 85 90 0b 00 00 	jmp    *0xb90(,%eax,4)
+ 6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6d3:	5b                   	pop    %ebx
+ 6d4:	5e                   	pop    %esi
+ 6d5:	5f                   	pop    %edi
+ 6d6:	5d                   	pop    %ebp
+ 6d7:	c3                   	ret
+ 6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ea:	6a 01                	push   $0x1
+ 6ec:	52                   	push   %edx
+ 6ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6f0:	57                   	push   %edi
+ 6f1:	e8 9d fd ff ff       	call   493 <write>
+ 6f6:	83 c4 0c             	add    $0xc,%esp
+ 6f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6fc:	6a 01                	push   $0x1
+ 6fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 701:	52                   	push   %edx
+ 702:	57                   	push   %edi
+ 703:	e8 8b fd ff ff       	call   493 <write>
+        putc(fd, c);
+ 708:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70b:	31 d2                	xor    %edx,%edx
+ 70d:	eb 8e                	jmp    69d <printf+0x4d>
+ 70f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 00                	push   $0x0
+ 71f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 721:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 724:	e8 87 fe ff ff       	call   5b0 <printint>
+        ap++;
+ 729:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 72c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 67 ff ff ff       	jmp    69d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 740:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 743:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 745:	83 c0 04             	add    $0x4,%eax
+ 748:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 74b:	85 db                	test   %ebx,%ebx
+ 74d:	0f 84 9d 00 00 00    	je     7f0 <printf+0x1a0>
+        while(*s != 0){
+ 753:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 756:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 758:	84 c0                	test   %al,%al
+ 75a:	0f 84 3d ff ff ff    	je     69d <printf+0x4d>
+ 760:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 763:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 766:	89 de                	mov    %ebx,%esi
+ 768:	89 d3                	mov    %edx,%ebx
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 776:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	53                   	push   %ebx
+ 77c:	57                   	push   %edi
+ 77d:	e8 11 fd ff ff       	call   493 <write>
+        while(*s != 0){
+ 782:	0f b6 06             	movzbl (%esi),%eax
+ 785:	83 c4 10             	add    $0x10,%esp
+ 788:	84 c0                	test   %al,%al
+ 78a:	75 e4                	jne    770 <printf+0x120>
+      state = 0;
+ 78c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 78f:	31 d2                	xor    %edx,%edx
+ 791:	e9 07 ff ff ff       	jmp    69d <printf+0x4d>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 01                	push   $0x1
+ 7af:	e9 6b ff ff ff       	jmp    71f <printf+0xcf>
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	52                   	push   %edx
+ 7cc:	57                   	push   %edi
+ 7cd:	e8 c1 fc ff ff       	call   493 <write>
+        ap++;
+ 7d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7d8:	31 d2                	xor    %edx,%edx
+ 7da:	e9 be fe ff ff       	jmp    69d <printf+0x4d>
+ 7df:	90                   	nop
+  write(fd, &c, 1);
+ 7e0:	83 ec 04             	sub    $0x4,%esp
+ 7e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	e9 11 ff ff ff       	jmp    701 <printf+0xb1>
+ 7f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7f5:	bb 86 0b 00 00       	mov    $0xb86,%ebx
+ 7fa:	e9 61 ff ff ff       	jmp    760 <printf+0x110>
+ 7ff:	90                   	nop
+
+00000800 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+ 800:	55                   	push   %ebp
+ 801:	89 e5                	mov    %esp,%ebp
+ 803:	57                   	push   %edi
+ 804:	56                   	push   %esi
+ 805:	53                   	push   %ebx
+ 806:	83 ec 20             	sub    $0x20,%esp
+ 809:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 80c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+ 80f:	57                   	push   %edi
+ 810:	68 8d 0b 00 00       	push   $0xb8d
+ 815:	53                   	push   %ebx
+ 816:	e8 35 fe ff ff       	call   650 <printf>
+  for(n = strlen(s); n < w; n++)
+ 81b:	89 3c 24             	mov    %edi,(%esp)
+ 81e:	e8 9d fa ff ff       	call   2c0 <strlen>
+ 823:	83 c4 10             	add    $0x10,%esp
+ 826:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 829:	7d 20                	jge    84b <pads+0x4b>
+ 82b:	89 c6                	mov    %eax,%esi
+ 82d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+ 837:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 83a:	6a 01                	push   $0x1
+ 83c:	57                   	push   %edi
+ 83d:	53                   	push   %ebx
+ 83e:	e8 50 fc ff ff       	call   493 <write>
+  for(n = strlen(s); n < w; n++)
+ 843:	83 c4 10             	add    $0x10,%esp
+ 846:	39 75 10             	cmp    %esi,0x10(%ebp)
+ 849:	75 e5                	jne    830 <pads+0x30>
+    putc(fd, ' ');
+}
+ 84b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 84e:	5b                   	pop    %ebx
+ 84f:	5e                   	pop    %esi
+ 850:	5f                   	pop    %edi
+ 851:	5d                   	pop    %ebp
+ 852:	c3                   	ret
+ 853:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000860 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+ 860:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+ 861:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+ 866:	89 e5                	mov    %esp,%ebp
+ 868:	57                   	push   %edi
+ 869:	56                   	push   %esi
+ 86a:	53                   	push   %ebx
+  int n = 0;
+ 86b:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+ 86d:	83 ec 2c             	sub    $0x2c,%esp
+ 870:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 873:	8b 45 10             	mov    0x10(%ebp),%eax
+ 876:	8b 75 08             	mov    0x8(%ebp),%esi
+ 879:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 87c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 87f:	90                   	nop
+  }while((x /= 10) != 0);
+ 880:	89 d0                	mov    %edx,%eax
+ 882:	89 d7                	mov    %edx,%edi
+    n++;
+ 884:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+ 887:	f7 e1                	mul    %ecx
+ 889:	c1 ea 03             	shr    $0x3,%edx
+ 88c:	83 ff 09             	cmp    $0x9,%edi
+ 88f:	77 ef                	ja     880 <padd+0x20>
+  for(; n < w; n++)
+ 891:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 894:	39 c3                	cmp    %eax,%ebx
+ 896:	7d 23                	jge    8bb <padd+0x5b>
+ 898:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 89b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+  write(fd, &c, 1);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+ 8a7:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+ 8aa:	6a 01                	push   $0x1
+ 8ac:	57                   	push   %edi
+ 8ad:	56                   	push   %esi
+ 8ae:	e8 e0 fb ff ff       	call   493 <write>
+  for(; n < w; n++)
+ 8b3:	83 c4 10             	add    $0x10,%esp
+ 8b6:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+ 8b9:	75 e5                	jne    8a0 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+ 8bb:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+ 8c2:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+ 8c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+ 8c8:	89 f0                	mov    %esi,%eax
+}
+ 8ca:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+ 8cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+ 8d0:	5e                   	pop    %esi
+ 8d1:	5f                   	pop    %edi
+ 8d2:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+ 8d3:	e9 d8 fc ff ff       	jmp    5b0 <printint>
+ 8d8:	66 90                	xchg   %ax,%ax
+ 8da:	66 90                	xchg   %ax,%ax
+ 8dc:	66 90                	xchg   %ax,%ax
+ 8de:	66 90                	xchg   %ax,%ax
+
+000008e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8e1:	a1 e8 0e 00 00       	mov    0xee8,%eax
+{
+ 8e6:	89 e5                	mov    %esp,%ebp
+ 8e8:	57                   	push   %edi
+ 8e9:	56                   	push   %esi
+ 8ea:	53                   	push   %ebx
+ 8eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8fc:	39 ca                	cmp    %ecx,%edx
+ 8fe:	73 30                	jae    930 <free+0x50>
+ 900:	39 c1                	cmp    %eax,%ecx
+ 902:	72 04                	jb     908 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 904:	39 c2                	cmp    %eax,%edx
+ 906:	72 f0                	jb     8f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 908:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 90b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 90e:	39 f8                	cmp    %edi,%eax
+ 910:	74 2e                	je     940 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 912:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 915:	8b 42 04             	mov    0x4(%edx),%eax
+ 918:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 91b:	39 f1                	cmp    %esi,%ecx
+ 91d:	74 38                	je     957 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 91f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 921:	5b                   	pop    %ebx
+  freep = p;
+ 922:	89 15 e8 0e 00 00    	mov    %edx,0xee8
+}
+ 928:	5e                   	pop    %esi
+ 929:	5f                   	pop    %edi
+ 92a:	5d                   	pop    %ebp
+ 92b:	c3                   	ret
+ 92c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 930:	39 c1                	cmp    %eax,%ecx
+ 932:	72 d0                	jb     904 <free+0x24>
+ 934:	eb c2                	jmp    8f8 <free+0x18>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 940:	03 70 04             	add    0x4(%eax),%esi
+ 943:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 946:	8b 02                	mov    (%edx),%eax
+ 948:	8b 00                	mov    (%eax),%eax
+ 94a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 94d:	8b 42 04             	mov    0x4(%edx),%eax
+ 950:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 953:	39 f1                	cmp    %esi,%ecx
+ 955:	75 c8                	jne    91f <free+0x3f>
+    p->s.size += bp->s.size;
+ 957:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 95a:	89 15 e8 0e 00 00    	mov    %edx,0xee8
+    p->s.size += bp->s.size;
+ 960:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 963:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 966:	89 0a                	mov    %ecx,(%edx)
+}
+ 968:	5b                   	pop    %ebx
+ 969:	5e                   	pop    %esi
+ 96a:	5f                   	pop    %edi
+ 96b:	5d                   	pop    %ebp
+ 96c:	c3                   	ret
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000970 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 979:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 97c:	8b 15 e8 0e 00 00    	mov    0xee8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 982:	8d 78 07             	lea    0x7(%eax),%edi
+ 985:	c1 ef 03             	shr    $0x3,%edi
+ 988:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 98b:	85 d2                	test   %edx,%edx
+ 98d:	0f 84 8d 00 00 00    	je     a20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 993:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 995:	8b 48 04             	mov    0x4(%eax),%ecx
+ 998:	39 f9                	cmp    %edi,%ecx
+ 99a:	73 64                	jae    a00 <malloc+0x90>
+  if(nu < 4096)
+ 99c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9a1:	39 df                	cmp    %ebx,%edi
+ 9a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9ad:	eb 0a                	jmp    9b9 <malloc+0x49>
+ 9af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9b2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9b5:	39 f9                	cmp    %edi,%ecx
+ 9b7:	73 47                	jae    a00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9b9:	89 c2                	mov    %eax,%edx
+ 9bb:	39 05 e8 0e 00 00    	cmp    %eax,0xee8
+ 9c1:	75 ed                	jne    9b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9c3:	83 ec 0c             	sub    $0xc,%esp
+ 9c6:	56                   	push   %esi
+ 9c7:	e8 2f fb ff ff       	call   4fb <sbrk>
+  if(p == (char*)-1)
+ 9cc:	83 c4 10             	add    $0x10,%esp
+ 9cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9d2:	74 1c                	je     9f0 <malloc+0x80>
+  hp->s.size = nu;
+ 9d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9d7:	83 ec 0c             	sub    $0xc,%esp
+ 9da:	83 c0 08             	add    $0x8,%eax
+ 9dd:	50                   	push   %eax
+ 9de:	e8 fd fe ff ff       	call   8e0 <free>
+  return freep;
+ 9e3:	8b 15 e8 0e 00 00    	mov    0xee8,%edx
+      if((p = morecore(nunits)) == 0)
+ 9e9:	83 c4 10             	add    $0x10,%esp
+ 9ec:	85 d2                	test   %edx,%edx
+ 9ee:	75 c0                	jne    9b0 <malloc+0x40>
+        return 0;
+  }
+}
+ 9f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9f3:	31 c0                	xor    %eax,%eax
+}
+ 9f5:	5b                   	pop    %ebx
+ 9f6:	5e                   	pop    %esi
+ 9f7:	5f                   	pop    %edi
+ 9f8:	5d                   	pop    %ebp
+ 9f9:	c3                   	ret
+ 9fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a00:	39 cf                	cmp    %ecx,%edi
+ a02:	74 4c                	je     a50 <malloc+0xe0>
+        p->s.size -= nunits;
+ a04:	29 f9                	sub    %edi,%ecx
+ a06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a0f:	89 15 e8 0e 00 00    	mov    %edx,0xee8
+}
+ a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a18:	83 c0 08             	add    $0x8,%eax
+}
+ a1b:	5b                   	pop    %ebx
+ a1c:	5e                   	pop    %esi
+ a1d:	5f                   	pop    %edi
+ a1e:	5d                   	pop    %ebp
+ a1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a20:	c7 05 e8 0e 00 00 ec 	movl   $0xeec,0xee8
+ a27:	0e 00 00 
+    base.s.size = 0;
+ a2a:	b8 ec 0e 00 00       	mov    $0xeec,%eax
+    base.s.ptr = freep = prevp = &base;
+ a2f:	c7 05 ec 0e 00 00 ec 	movl   $0xeec,0xeec
+ a36:	0e 00 00 
+    base.s.size = 0;
+ a39:	c7 05 f0 0e 00 00 00 	movl   $0x0,0xef0
+ a40:	00 00 00 
+    if(p->s.size >= nunits){
+ a43:	e9 54 ff ff ff       	jmp    99c <malloc+0x2c>
+ a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a50:	8b 08                	mov    (%eax),%ecx
+ a52:	89 0a                	mov    %ecx,(%edx)
+ a54:	eb b9                	jmp    a0f <malloc+0x9f>
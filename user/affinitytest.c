@@ -0,0 +1,72 @@
+#include "kernel/types.h"
+#include "user.h"
+
+/* Spin for a while so the scheduler has a chance to move us */
+static void
+spin(void) {
+  volatile uint i;
+
+  for(i = 0; i < 50000000; ++i)
+    ;
+}
+
+int
+main(int argc, char *argv[]) {
+  int all, pid, status;
+
+  all = sched_getaffinity(0);
+  printf(1, "default affinity mask: 0x%x\n", all);
+  if(all <= 0) {
+    printf(1, "sched_getaffinity failed\n");
+    exit(1);
+  }
+
+  /* An empty mask, or one naming only CPUs that don't exist, is rejected */
+  if(sched_setaffinity(0, 0) >= 0 || sched_setaffinity(0, ~all) >= 0) {
+    printf(1, "sched_setaffinity accepted an empty mask\n");
+    exit(1);
+  }
+
+  /* Pin ourselves to CPU 0 and keep running there */
+  if(sched_setaffinity(0, 1) < 0 || sched_getaffinity(0) != 1) {
+    printf(1, "sched_setaffinity(0, 1) failed\n");
+    exit(1);
+  }
+  spin();
+
+  /* Children inherit the mask */
+  if((pid = fork()) == 0) {
+    if(sched_getaffinity(0) != 1) {
+      printf(1, "child did not inherit the affinity mask\n");
+      exit(1);
+    }
+    spin();
+    exit(0);
+  }
+  wait(&status);
+  if(status != 0)
+    exit(1);
+
+  /* Another process's mask can be changed by pid */
+  if((pid = fork()) == 0) {
+    sleep(10);
+    exit(sched_getaffinity(0) == all ? 0 : 1);
+  }
+  if(sched_setaffinity(pid, all) < 0) {
+    printf(1, "sched_setaffinity(%d) failed\n", pid);
+    exit(1);
+  }
+  wait(&status);
+  if(status != 0) {
+    printf(1, "affinity of child %d was not changed\n", pid);
+    exit(1);
+  }
+
+  if(sched_getaffinity(-1) >= 0) {
+    printf(1, "sched_getaffinity accepted a bad pid\n");
+    exit(1);
+  }
+
+  printf(1, "affinitytest ok\n");
+  exit(0);
+}
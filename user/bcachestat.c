@@ -0,0 +1,23 @@
+#include "kernel/types.h"
+#include "kernel/fs.h"
+#include "kernel/bcache.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[]) {
+  struct bcachestat st;
+  uint lookups;
+
+  if(bcachestat(&st) < 0) {
+    printf(2, "bcachestat: cannot read buffer cache statistics\n");
+    exit(1);
+  }
+  lookups = st.hits + st.misses;
+  printf(1, "buffers: %d (%d KB), at most %d (%d KB)\n",
+         st.nbuf, st.nbuf * (BSIZE / 512) / 2, st.maxbuf, st.maxbuf * (BSIZE / 512) / 2);
+  printf(1, "lookups: %d hits, %d misses, %d%% hit rate\n",
+         st.hits, st.misses, lookups ? st.hits * 100 / lookups : 0);
+  printf(1, "cached: %d metadata, %d data used again\n", st.nmeta, st.nhot);
+  printf(1, "pages: %d added, %d given back\n", st.grows, st.shrinks);
+  exit(0);
+}
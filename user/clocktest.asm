@@ -0,0 +1,1544 @@
+
+_clocktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+elapsed(struct timespec *a, struct timespec *b) {
+  return (b->tv_sec - a->tv_sec) * 1000000000 + b->tv_nsec - a->tv_nsec;
+}
+
+int
+main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  struct timespec t0, t1, req;
+  uint naps[] = { 100000, 1000000, 5000000 };
+  uint ns, i;
+
+  if(clock_gettime(CLOCK_MONOTONIC, &t0) < 0) {
+   f:	8d 7d c4             	lea    -0x3c(%ebp),%edi
+main(int argc, char *argv[]) {
+  12:	53                   	push   %ebx
+  13:	51                   	push   %ecx
+  14:	83 ec 50             	sub    $0x50,%esp
+  uint naps[] = { 100000, 1000000, 5000000 };
+  17:	c7 45 dc a0 86 01 00 	movl   $0x186a0,-0x24(%ebp)
+  1e:	c7 45 e0 40 42 0f 00 	movl   $0xf4240,-0x20(%ebp)
+  25:	c7 45 e4 40 4b 4c 00 	movl   $0x4c4b40,-0x1c(%ebp)
+  if(clock_gettime(CLOCK_MONOTONIC, &t0) < 0) {
+  2c:	57                   	push   %edi
+  2d:	6a 01                	push   $0x1
+  2f:	e8 b7 04 00 00       	call   4eb <clock_gettime>
+  34:	83 c4 10             	add    $0x10,%esp
+  37:	85 c0                	test   %eax,%eax
+  39:	0f 88 39 01 00 00    	js     178 <main+0x178>
+    printf(1, "clock_gettime failed\n");
+    exit(1);
+  }
+  printf(1, "monotonic clock: %d.%d s since boot\n", t0.tv_sec, t0.tv_nsec);
+  3f:	ff 75 c8             	push   -0x38(%ebp)
+  42:	bb 10 27 00 00       	mov    $0x2710,%ebx
+  47:	8d 75 cc             	lea    -0x34(%ebp),%esi
+  4a:	ff 75 c4             	push   -0x3c(%ebp)
+  4d:	68 94 0a 00 00       	push   $0xa94
+  52:	6a 01                	push   $0x1
+  54:	e8 97 05 00 00       	call   5f0 <printf>
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	eb 13                	jmp    71 <main+0x71>
+  5e:	66 90                	xchg   %ax,%ax
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if(t1.tv_sec < t0.tv_sec || (t1.tv_sec == t0.tv_sec && t1.tv_nsec < t0.tv_nsec)) {
+      printf(1, "clock went backwards\n");
+      exit(1);
+    }
+    t0 = t1;
+  60:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  63:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  66:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  69:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  for(i = 0; i < 10000; ++i) {
+  6c:	83 eb 01             	sub    $0x1,%ebx
+  6f:	74 3a                	je     ab <main+0xab>
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+  71:	83 ec 08             	sub    $0x8,%esp
+  74:	56                   	push   %esi
+  75:	6a 01                	push   $0x1
+  77:	e8 6f 04 00 00       	call   4eb <clock_gettime>
+    if(t1.tv_sec < t0.tv_sec || (t1.tv_sec == t0.tv_sec && t1.tv_nsec < t0.tv_nsec)) {
+  7c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  7f:	83 c4 10             	add    $0x10,%esp
+  82:	39 45 cc             	cmp    %eax,-0x34(%ebp)
+  85:	72 0a                	jb     91 <main+0x91>
+  87:	75 d7                	jne    60 <main+0x60>
+  89:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8c:	39 45 d0             	cmp    %eax,-0x30(%ebp)
+  8f:	73 cf                	jae    60 <main+0x60>
+      printf(1, "clock went backwards\n");
+  91:	52                   	push   %edx
+  92:	52                   	push   %edx
+  93:	68 0e 0a 00 00       	push   $0xa0e
+  98:	6a 01                	push   $0x1
+  9a:	e8 51 05 00 00       	call   5f0 <printf>
+      exit(1);
+  9f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  a6:	e8 68 03 00 00       	call   413 <exit>
+  }
+
+  /* Sub-tick sleeps: 100us, 1ms and 5ms */
+  for(i = 0; i < sizeof(naps)/sizeof(naps[0]); ++i) {
+    req.tv_sec = 0;
+  ab:	31 c0                	xor    %eax,%eax
+  ad:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    req.tv_nsec = naps[i];
+  b0:	8b 44 9d dc          	mov    -0x24(%ebp,%ebx,4),%eax
+  b4:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  b7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+  ba:	50                   	push   %eax
+  bb:	50                   	push   %eax
+  bc:	57                   	push   %edi
+  bd:	6a 01                	push   $0x1
+  bf:	e8 27 04 00 00       	call   4eb <clock_gettime>
+    if(nanosleep(&req) < 0) {
+  c4:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  c7:	89 04 24             	mov    %eax,(%esp)
+  ca:	e8 24 04 00 00       	call   4f3 <nanosleep>
+  cf:	83 c4 10             	add    $0x10,%esp
+  d2:	85 c0                	test   %eax,%eax
+  d4:	0f 88 d2 00 00 00    	js     1ac <main+0x1ac>
+      printf(1, "nanosleep failed\n");
+      exit(1);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+  da:	50                   	push   %eax
+  db:	50                   	push   %eax
+  dc:	56                   	push   %esi
+  dd:	6a 01                	push   $0x1
+  df:	e8 07 04 00 00       	call   4eb <clock_gettime>
+  return (b->tv_sec - a->tv_sec) * 1000000000 + b->tv_nsec - a->tv_nsec;
+  e4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  e7:	2b 45 c4             	sub    -0x3c(%ebp),%eax
+  ea:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+  f0:	03 45 d0             	add    -0x30(%ebp),%eax
+  f3:	2b 45 c8             	sub    -0x38(%ebp),%eax
+    ns = elapsed(&t0, &t1);
+    printf(1, "nanosleep(%d ns) slept %d ns\n", naps[i], ns);
+  f6:	50                   	push   %eax
+  f7:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  fa:	ff 75 b4             	push   -0x4c(%ebp)
+  fd:	68 36 0a 00 00       	push   $0xa36
+ 102:	6a 01                	push   $0x1
+ 104:	e8 e7 04 00 00       	call   5f0 <printf>
+    if(ns < naps[i]) {
+ 109:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 10c:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 10f:	83 c4 20             	add    $0x20,%esp
+ 112:	39 d0                	cmp    %edx,%eax
+ 114:	72 7c                	jb     192 <main+0x192>
+  for(i = 0; i < sizeof(naps)/sizeof(naps[0]); ++i) {
+ 116:	83 c3 01             	add    $0x1,%ebx
+ 119:	83 fb 03             	cmp    $0x3,%ebx
+ 11c:	75 8d                	jne    ab <main+0xab>
+      exit(1);
+    }
+  }
+
+  /* One clock tick, for comparison */
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+ 11e:	50                   	push   %eax
+ 11f:	50                   	push   %eax
+ 120:	57                   	push   %edi
+  sleep(1);
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  printf(1, "sleep(1) slept %d ns\n", elapsed(&t0, &t1));
+
+  printf(1, "clocktest ok\n");
+  exit(0);
+ 121:	31 ff                	xor    %edi,%edi
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+ 123:	6a 01                	push   $0x1
+ 125:	e8 c1 03 00 00       	call   4eb <clock_gettime>
+  sleep(1);
+ 12a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 131:	e8 6d 03 00 00       	call   4a3 <sleep>
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+ 136:	5a                   	pop    %edx
+ 137:	59                   	pop    %ecx
+ 138:	56                   	push   %esi
+ 139:	6a 01                	push   $0x1
+ 13b:	e8 ab 03 00 00       	call   4eb <clock_gettime>
+  return (b->tv_sec - a->tv_sec) * 1000000000 + b->tv_nsec - a->tv_nsec;
+ 140:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 143:	2b 45 c4             	sub    -0x3c(%ebp),%eax
+  printf(1, "sleep(1) slept %d ns\n", elapsed(&t0, &t1));
+ 146:	83 c4 0c             	add    $0xc,%esp
+  return (b->tv_sec - a->tv_sec) * 1000000000 + b->tv_nsec - a->tv_nsec;
+ 149:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 14f:	03 45 d0             	add    -0x30(%ebp),%eax
+ 152:	2b 45 c8             	sub    -0x38(%ebp),%eax
+  printf(1, "sleep(1) slept %d ns\n", elapsed(&t0, &t1));
+ 155:	50                   	push   %eax
+ 156:	68 6d 0a 00 00       	push   $0xa6d
+ 15b:	6a 01                	push   $0x1
+ 15d:	e8 8e 04 00 00       	call   5f0 <printf>
+  printf(1, "clocktest ok\n");
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	68 83 0a 00 00       	push   $0xa83
+ 169:	6a 01                	push   $0x1
+ 16b:	e8 80 04 00 00       	call   5f0 <printf>
+  exit(0);
+ 170:	89 3c 24             	mov    %edi,(%esp)
+ 173:	e8 9b 02 00 00       	call   413 <exit>
+    printf(1, "clock_gettime failed\n");
+ 178:	51                   	push   %ecx
+ 179:	51                   	push   %ecx
+ 17a:	68 f8 09 00 00       	push   $0x9f8
+ 17f:	6a 01                	push   $0x1
+ 181:	e8 6a 04 00 00       	call   5f0 <printf>
+    exit(1);
+ 186:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 18d:	e8 81 02 00 00       	call   413 <exit>
+      printf(1, "nanosleep woke up early\n");
+ 192:	50                   	push   %eax
+ 193:	50                   	push   %eax
+ 194:	68 54 0a 00 00       	push   $0xa54
+ 199:	6a 01                	push   $0x1
+ 19b:	e8 50 04 00 00       	call   5f0 <printf>
+      exit(1);
+ 1a0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 1a7:	e8 67 02 00 00       	call   413 <exit>
+      printf(1, "nanosleep failed\n");
+ 1ac:	50                   	push   %eax
+ 1ad:	50                   	push   %eax
+ 1ae:	68 24 0a 00 00       	push   $0xa24
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	e8 36 04 00 00       	call   5f0 <printf>
+      exit(1);
+ 1ba:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 1c1:	e8 4d 02 00 00       	call   413 <exit>
+ 1c6:	66 90                	xchg   %ax,%ax
+ 1c8:	66 90                	xchg   %ax,%ax
+ 1ca:	66 90                	xchg   %ax,%ax
+ 1cc:	66 90                	xchg   %ax,%ax
+ 1ce:	66 90                	xchg   %ax,%ax
+
+000001d0 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1d1:	31 c0                	xor    %eax,%eax
+{
+ 1d3:	89 e5                	mov    %esp,%ebp
+ 1d5:	53                   	push   %ebx
+ 1d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1e7:	83 c0 01             	add    $0x1,%eax
+ 1ea:	84 d2                	test   %dl,%dl
+ 1ec:	75 f2                	jne    1e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f1:	89 c8                	mov    %ecx,%eax
+ 1f3:	c9                   	leave
+ 1f4:	c3                   	ret
+ 1f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+ 207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 20a:	0f b6 02             	movzbl (%edx),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 17                	jne    228 <strcmp+0x28>
+ 211:	eb 3a                	jmp    24d <strcmp+0x4d>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 21c:	83 c2 01             	add    $0x1,%edx
+ 21f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 222:	84 c0                	test   %al,%al
+ 224:	74 1a                	je     240 <strcmp+0x40>
+    p++, q++;
+ 226:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 228:	0f b6 19             	movzbl (%ecx),%ebx
+ 22b:	38 c3                	cmp    %al,%bl
+ 22d:	74 e9                	je     218 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 22f:	29 d8                	sub    %ebx,%eax
+}
+ 231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 234:	c9                   	leave
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 240:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 244:	31 c0                	xor    %eax,%eax
+ 246:	29 d8                	sub    %ebx,%eax
+}
+ 248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24b:	c9                   	leave
+ 24c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 24d:	0f b6 19             	movzbl (%ecx),%ebx
+ 250:	31 c0                	xor    %eax,%eax
+ 252:	eb db                	jmp    22f <strcmp+0x2f>
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 266:	80 3a 00             	cmpb   $0x0,(%edx)
+ 269:	74 15                	je     280 <strlen+0x20>
+ 26b:	31 c0                	xor    %eax,%eax
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+ 270:	83 c0 01             	add    $0x1,%eax
+ 273:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 277:	89 c1                	mov    %eax,%ecx
+ 279:	75 f5                	jne    270 <strlen+0x10>
+    ;
+  return n;
+}
+ 27b:	89 c8                	mov    %ecx,%eax
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+ 27f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 280:	31 c9                	xor    %ecx,%ecx
+}
+ 282:	5d                   	pop    %ebp
+ 283:	89 c8                	mov    %ecx,%eax
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000290 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 297:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 29a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29d:	89 d7                	mov    %edx,%edi
+ 29f:	fc                   	cld
+ 2a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2a5:	89 d0                	mov    %edx,%eax
+ 2a7:	c9                   	leave
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ba:	0f b6 10             	movzbl (%eax),%edx
+ 2bd:	84 d2                	test   %dl,%dl
+ 2bf:	75 12                	jne    2d3 <strchr+0x23>
+ 2c1:	eb 1d                	jmp    2e0 <strchr+0x30>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2cc:	83 c0 01             	add    $0x1,%eax
+ 2cf:	84 d2                	test   %dl,%dl
+ 2d1:	74 0d                	je     2e0 <strchr+0x30>
+    if(*s == c)
+ 2d3:	38 d1                	cmp    %dl,%cl
+ 2d5:	75 f1                	jne    2c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2d7:	5d                   	pop    %ebp
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2e0:	31 c0                	xor    %eax,%eax
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	c3                   	ret
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2f9:	31 db                	xor    %ebx,%ebx
+{
+ 2fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2fe:	eb 27                	jmp    327 <gets+0x37>
+    cc = read(0, &c, 1);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	6a 01                	push   $0x1
+ 305:	56                   	push   %esi
+ 306:	6a 00                	push   $0x0
+ 308:	e8 1e 01 00 00       	call   42b <read>
+    if(cc < 1)
+ 30d:	83 c4 10             	add    $0x10,%esp
+ 310:	85 c0                	test   %eax,%eax
+ 312:	7e 1d                	jle    331 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 314:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+ 31b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 31f:	3c 0a                	cmp    $0xa,%al
+ 321:	74 10                	je     333 <gets+0x43>
+ 323:	3c 0d                	cmp    $0xd,%al
+ 325:	74 0c                	je     333 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 327:	89 df                	mov    %ebx,%edi
+ 329:	83 c3 01             	add    $0x1,%ebx
+ 32c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 32f:	7c cf                	jl     300 <gets+0x10>
+ 331:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 33a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 33d:	5b                   	pop    %ebx
+ 33e:	5e                   	pop    %esi
+ 33f:	5f                   	pop    %edi
+ 340:	5d                   	pop    %ebp
+ 341:	c3                   	ret
+ 342:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 355:	83 ec 08             	sub    $0x8,%esp
+ 358:	6a 00                	push   $0x0
+ 35a:	ff 75 08             	push   0x8(%ebp)
+ 35d:	e8 f1 00 00 00       	call   453 <open>
+  if(fd < 0)
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	78 27                	js     390 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 369:	83 ec 08             	sub    $0x8,%esp
+ 36c:	ff 75 0c             	push   0xc(%ebp)
+ 36f:	89 c3                	mov    %eax,%ebx
+ 371:	50                   	push   %eax
+ 372:	e8 f4 00 00 00       	call   46b <fstat>
+  close(fd);
+ 377:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 37a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 37c:	e8 ba 00 00 00       	call   43b <close>
+  return r;
+ 381:	83 c4 10             	add    $0x10,%esp
+}
+ 384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 387:	89 f0                	mov    %esi,%eax
+ 389:	5b                   	pop    %ebx
+ 38a:	5e                   	pop    %esi
+ 38b:	5d                   	pop    %ebp
+ 38c:	c3                   	ret
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 395:	eb ed                	jmp    384 <stat+0x34>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3a7:	0f be 02             	movsbl (%edx),%eax
+ 3aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3b5:	77 1e                	ja     3d5 <atoi+0x35>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3c0:	83 c2 01             	add    $0x1,%edx
+ 3c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ca:	0f be 02             	movsbl (%edx),%eax
+ 3cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3d0:	80 fb 09             	cmp    $0x9,%bl
+ 3d3:	76 eb                	jbe    3c0 <atoi+0x20>
+  return n;
+}
+ 3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d8:	89 c8                	mov    %ecx,%eax
+ 3da:	c9                   	leave
+ 3db:	c3                   	ret
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ee:	85 c0                	test   %eax,%eax
+ 3f0:	7e 13                	jle    405 <memmove+0x25>
+ 3f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3f4:	89 d7                	mov    %edx,%edi
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 400:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 401:	39 f8                	cmp    %edi,%eax
+ 403:	75 fb                	jne    400 <memmove+0x20>
+  return vdst;
+}
+ 405:	5e                   	pop    %esi
+ 406:	89 d0                	mov    %edx,%eax
+ 408:	5f                   	pop    %edi
+ 409:	5d                   	pop    %ebp
+ 40a:	c3                   	ret
+
+0000040b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 40b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <exit>:
+SYSCALL(exit)
+ 413:	b8 02 00 00 00       	mov    $0x2,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <wait>:
+SYSCALL(wait)
+ 41b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <pipe>:
+SYSCALL(pipe)
+ 423:	b8 04 00 00 00       	mov    $0x4,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <read>:
+SYSCALL(read)
+ 42b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <write>:
+SYSCALL(write)
+ 433:	b8 10 00 00 00       	mov    $0x10,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <close>:
+SYSCALL(close)
+ 43b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <kill>:
+SYSCALL(kill)
+ 443:	b8 06 00 00 00       	mov    $0x6,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <exec>:
+SYSCALL(exec)
+ 44b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <open>:
+SYSCALL(open)
+ 453:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mknod>:
+SYSCALL(mknod)
+ 45b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <unlink>:
+SYSCALL(unlink)
+ 463:	b8 12 00 00 00       	mov    $0x12,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <fstat>:
+SYSCALL(fstat)
+ 46b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <link>:
+SYSCALL(link)
+ 473:	b8 13 00 00 00       	mov    $0x13,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mkdir>:
+SYSCALL(mkdir)
+ 47b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <chdir>:
+SYSCALL(chdir)
+ 483:	b8 09 00 00 00       	mov    $0x9,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <dup>:
+SYSCALL(dup)
+ 48b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <getpid>:
+SYSCALL(getpid)
+ 493:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <sbrk>:
+SYSCALL(sbrk)
+ 49b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <sleep>:
+SYSCALL(sleep)
+ 4a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <uptime>:
+SYSCALL(uptime)
+ 4ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getdate>:
+SYSCALL(getdate)
+ 4b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <setdate>:
+SYSCALL(setdate)
+ 4bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <mount>:
+SYSCALL(mount)
+ 4c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <unmount>:
+SYSCALL(unmount)
+ 4cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <lseek>:
+SYSCALL(lseek)
+ 4d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mmap>:
+SYSCALL(mmap)
+ 4db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <munmap>:
+SYSCALL(munmap)
+ 4e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <clock_gettime>:
+SYSCALL(clock_gettime)
+ 4eb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <nanosleep>:
+SYSCALL(nanosleep)
+ 4f3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4fb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 503:	b8 20 00 00 00       	mov    $0x20,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <proclimit>:
+SYSCALL(proclimit)
+ 50b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <procinfo>:
+SYSCALL(procinfo)
+ 513:	b8 22 00 00 00       	mov    $0x22,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <cpuinfo>:
+SYSCALL(cpuinfo)
+ 51b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <schedstat>:
+SYSCALL(schedstat)
+ 523:	b8 24 00 00 00       	mov    $0x24,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <lockstat>:
+SYSCALL(lockstat)
+ 52b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <bcachestat>:
+SYSCALL(bcachestat)
+ 533:	b8 26 00 00 00       	mov    $0x26,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <diskstat>:
+SYSCALL(diskstat)
+ 53b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <iosched>:
+SYSCALL(iosched)
+ 543:	b8 28 00 00 00       	mov    $0x28,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+ 54b:	66 90                	xchg   %ax,%ax
+ 54d:	66 90                	xchg   %ax,%ax
+ 54f:	90                   	nop
+
+00000550 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 558:	89 d1                	mov    %edx,%ecx
+{
+ 55a:	83 ec 3c             	sub    $0x3c,%esp
+ 55d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 560:	85 d2                	test   %edx,%edx
+ 562:	0f 89 80 00 00 00    	jns    5e8 <printint+0x98>
+ 568:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 56c:	74 7a                	je     5e8 <printint+0x98>
+    x = -xx;
+ 56e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 570:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 575:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 578:	31 f6                	xor    %esi,%esi
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 580:	89 c8                	mov    %ecx,%eax
+ 582:	31 d2                	xor    %edx,%edx
+ 584:	89 f7                	mov    %esi,%edi
+ 586:	f7 f3                	div    %ebx
+ 588:	8d 76 01             	lea    0x1(%esi),%esi
+ 58b:	0f b6 92 1c 0b 00 00 	movzbl 0xb1c(%edx),%edx
+ 592:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 596:	89 ca                	mov    %ecx,%edx
+ 598:	89 c1                	mov    %eax,%ecx
+ 59a:	39 da                	cmp    %ebx,%edx
+ 59c:	73 e2                	jae    580 <printint+0x30>
+  if(neg)
+ 59e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5a1:	85 c0                	test   %eax,%eax
+ 5a3:	74 07                	je     5ac <printint+0x5c>
+    buf[i++] = '-';
+ 5a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5aa:	89 f7                	mov    %esi,%edi
+ 5ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5b2:	01 df                	add    %ebx,%edi
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5c4:	6a 01                	push   $0x1
+ 5c6:	50                   	push   %eax
+ 5c7:	56                   	push   %esi
+ 5c8:	e8 66 fe ff ff       	call   433 <write>
+  while(--i >= 0)
+ 5cd:	89 f8                	mov    %edi,%eax
+ 5cf:	83 c4 10             	add    $0x10,%esp
+ 5d2:	83 ef 01             	sub    $0x1,%edi
+ 5d5:	39 d8                	cmp    %ebx,%eax
+ 5d7:	75 df                	jne    5b8 <printint+0x68>
+}
+ 5d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dc:	5b                   	pop    %ebx
+ 5dd:	5e                   	pop    %esi
+ 5de:	5f                   	pop    %edi
+ 5df:	5d                   	pop    %ebp
+ 5e0:	c3                   	ret
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5e8:	31 c0                	xor    %eax,%eax
+ 5ea:	eb 89                	jmp    575 <printint+0x25>
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+ 5fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 602:	83 c6 01             	add    $0x1,%esi
+ 605:	84 db                	test   %bl,%bl
+ 607:	74 67                	je     670 <printf+0x80>
+ 609:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 60c:	31 d2                	xor    %edx,%edx
+ 60e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 611:	eb 34                	jmp    647 <printf+0x57>
+ 613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 617:	90                   	nop
+ 618:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 61b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 620:	83 f8 25             	cmp    $0x25,%eax
+ 623:	74 18                	je     63d <printf+0x4d>
+  write(fd, &c, 1);
+ 625:	83 ec 04             	sub    $0x4,%esp
+ 628:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 62b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62e:	6a 01                	push   $0x1
+ 630:	50                   	push   %eax
+ 631:	57                   	push   %edi
+ 632:	e8 fc fd ff ff       	call   433 <write>
+ 637:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 63a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 63d:	0f b6 1e             	movzbl (%esi),%ebx
+ 640:	83 c6 01             	add    $0x1,%esi
+ 643:	84 db                	test   %bl,%bl
+ 645:	74 29                	je     670 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 647:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 64a:	85 d2                	test   %edx,%edx
+ 64c:	74 ca                	je     618 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 64e:	83 fa 25             	cmp    $0x25,%edx
+ 651:	75 ea                	jne    63d <printf+0x4d>
+      if(c == 'd'){
+ 653:	83 f8 25             	cmp    $0x25,%eax
+ 656:	0f 84 24 01 00 00    	je     780 <printf+0x190>
+ 65c:	83 e8 63             	sub    $0x63,%eax
+ 65f:	83 f8 15             	cmp    $0x15,%eax
+ 662:	77 1c                	ja     680 <printf+0x90>
+ 664:	ff 24 85 c4 0a 00 00 	jmp    *0xac4(,%eax,4)
+ 66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 673:	5b                   	pop    %ebx
+ 674:	5e                   	pop    %esi
+ 675:	5f                   	pop    %edi
+ 676:	5d                   	pop    %ebp
+ 677:	c3                   	ret
+ 678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 686:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 68a:	6a 01                	push   $0x1
+ 68c:	52                   	push   %edx
+ 68d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 690:	57                   	push   %edi
+ 691:	e8 9d fd ff ff       	call   433 <write>
+ 696:	83 c4 0c             	add    $0xc,%esp
+ 699:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69c:	6a 01                	push   $0x1
+ 69e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6a1:	52                   	push   %edx
+ 6a2:	57                   	push   %edi
+ 6a3:	e8 8b fd ff ff       	call   433 <write>
+        putc(fd, c);
+ 6a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ab:	31 d2                	xor    %edx,%edx
+ 6ad:	eb 8e                	jmp    63d <printf+0x4d>
+ 6af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 00                	push   $0x0
+ 6bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6c4:	e8 87 fe ff ff       	call   550 <printint>
+        ap++;
+ 6c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 67 ff ff ff       	jmp    63d <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6e5:	83 c0 04             	add    $0x4,%eax
+ 6e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6eb:	85 db                	test   %ebx,%ebx
+ 6ed:	0f 84 9d 00 00 00    	je     790 <printf+0x1a0>
+        while(*s != 0){
+ 6f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	0f 84 3d ff ff ff    	je     63d <printf+0x4d>
+ 700:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 703:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 706:	89 de                	mov    %ebx,%esi
+ 708:	89 d3                	mov    %edx,%ebx
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 716:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 719:	6a 01                	push   $0x1
+ 71b:	53                   	push   %ebx
+ 71c:	57                   	push   %edi
+ 71d:	e8 11 fd ff ff       	call   433 <write>
+        while(*s != 0){
+ 722:	0f b6 06             	movzbl (%esi),%eax
+ 725:	83 c4 10             	add    $0x10,%esp
+ 728:	84 c0                	test   %al,%al
+ 72a:	75 e4                	jne    710 <printf+0x120>
+      state = 0;
+ 72c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 07 ff ff ff       	jmp    63d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 01                	push   $0x1
+ 74f:	e9 6b ff ff ff       	jmp    6bf <printf+0xcf>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 758:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 761:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 763:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 766:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	52                   	push   %edx
+ 76c:	57                   	push   %edi
+ 76d:	e8 c1 fc ff ff       	call   433 <write>
+        ap++;
+ 772:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 775:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 778:	31 d2                	xor    %edx,%edx
+ 77a:	e9 be fe ff ff       	jmp    63d <printf+0x4d>
+ 77f:	90                   	nop
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 786:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 789:	6a 01                	push   $0x1
+ 78b:	e9 11 ff ff ff       	jmp    6a1 <printf+0xb1>
+ 790:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 795:	bb b9 0a 00 00       	mov    $0xab9,%ebx
+ 79a:	e9 61 ff ff ff       	jmp    700 <printf+0x110>
+ 79f:	90                   	nop
+
+000007a0 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	83 ec 20             	sub    $0x20,%esp
+ 7a9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 7ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+ 7af:	57                   	push   %edi
+ 7b0:	68 c0 0a 00 00       	push   $0xac0
+ 7b5:	53                   	push   %ebx
+ 7b6:	e8 35 fe ff ff       	call   5f0 <printf>
+  for(n = strlen(s); n < w; n++)
+ 7bb:	89 3c 24             	mov    %edi,(%esp)
+ 7be:	e8 9d fa ff ff       	call   260 <strlen>
+ 7c3:	83 c4 10             	add    $0x10,%esp
+ 7c6:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 7c9:	7d 20                	jge    7eb <pads+0x4b>
+ 7cb:	89 c6                	mov    %eax,%esi
+ 7cd:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+ 7d7:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7da:	6a 01                	push   $0x1
+ 7dc:	57                   	push   %edi
+ 7dd:	53                   	push   %ebx
+ 7de:	e8 50 fc ff ff       	call   433 <write>
+  for(n = strlen(s); n < w; n++)
+ 7e3:	83 c4 10             	add    $0x10,%esp
+ 7e6:	39 75 10             	cmp    %esi,0x10(%ebp)
+ 7e9:	75 e5                	jne    7d0 <pads+0x30>
+    putc(fd, ' ');
+}
+ 7eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7ee:	5b                   	pop    %ebx
+ 7ef:	5e                   	pop    %esi
+ 7f0:	5f                   	pop    %edi
+ 7f1:	5d                   	pop    %ebp
+ 7f2:	c3                   	ret
+ 7f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000800 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+ 800:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+ 801:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+ 806:	89 e5                	mov    %esp,%ebp
+ 808:	57                   	push   %edi
+ 809:	56                   	push   %esi
+ 80a:	53                   	push   %ebx
+  int n = 0;
+ 80b:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+ 80d:	83 ec 2c             	sub    $0x2c,%esp
+ 810:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 813:	8b 45 10             	mov    0x10(%ebp),%eax
+ 816:	8b 75 08             	mov    0x8(%ebp),%esi
+ 819:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 81c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 81f:	90                   	nop
+  }while((x /= 10) != 0);
+ 820:	89 d0                	mov    %edx,%eax
+ 822:	89 d7                	mov    %edx,%edi
+    n++;
+ 824:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+ 827:	f7 e1                	mul    %ecx
+ 829:	c1 ea 03             	shr    $0x3,%edx
+ 82c:	83 ff 09             	cmp    $0x9,%edi
+ 82f:	77 ef                	ja     820 <padd+0x20>
+  for(; n < w; n++)
+ 831:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 834:	39 c3                	cmp    %eax,%ebx
+ 836:	7d 23                	jge    85b <padd+0x5b>
+ 838:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 83b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 83f:	90                   	nop
+  write(fd, &c, 1);
+ 840:	83 ec 04             	sub    $0x4,%esp
+ 843:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+ 847:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+ 84a:	6a 01                	push   $0x1
+ 84c:	57                   	push   %edi
+ 84d:	56                   	push   %esi
+ 84e:	e8 e0 fb ff ff       	call   433 <write>
+  for(; n < w; n++)
+ 853:	83 c4 10             	add    $0x10,%esp
+ 856:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+ 859:	75 e5                	jne    840 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+ 85b:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+ 862:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+ 865:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+ 868:	89 f0                	mov    %esi,%eax
+}
+ 86a:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+ 86b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+ 870:	5e                   	pop    %esi
+ 871:	5f                   	pop    %edi
+ 872:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+ 873:	e9 d8 fc ff ff       	jmp    550 <printint>
+ 878:	66 90                	xchg   %ax,%ax
+ 87a:	66 90                	xchg   %ax,%ax
+ 87c:	66 90                	xchg   %ax,%ax
+ 87e:	66 90                	xchg   %ax,%ax
+
+00000880 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 880:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 881:	a1 20 0e 00 00       	mov    0xe20,%eax
+{
+ 886:	89 e5                	mov    %esp,%ebp
+ 888:	57                   	push   %edi
+ 889:	56                   	push   %esi
+ 88a:	53                   	push   %ebx
+ 88b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 88e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 898:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 89a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 89c:	39 ca                	cmp    %ecx,%edx
+ 89e:	73 30                	jae    8d0 <free+0x50>
+ 8a0:	39 c1                	cmp    %eax,%ecx
+ 8a2:	72 04                	jb     8a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8a4:	39 c2                	cmp    %eax,%edx
+ 8a6:	72 f0                	jb     898 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8ae:	39 f8                	cmp    %edi,%eax
+ 8b0:	74 2e                	je     8e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8bb:	39 f1                	cmp    %esi,%ecx
+ 8bd:	74 38                	je     8f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8c1:	5b                   	pop    %ebx
+  freep = p;
+ 8c2:	89 15 20 0e 00 00    	mov    %edx,0xe20
+}
+ 8c8:	5e                   	pop    %esi
+ 8c9:	5f                   	pop    %edi
+ 8ca:	5d                   	pop    %ebp
+ 8cb:	c3                   	ret
+ 8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8d0:	39 c1                	cmp    %eax,%ecx
+ 8d2:	72 d0                	jb     8a4 <free+0x24>
+ 8d4:	eb c2                	jmp    898 <free+0x18>
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8e0:	03 70 04             	add    0x4(%eax),%esi
+ 8e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8e6:	8b 02                	mov    (%edx),%eax
+ 8e8:	8b 00                	mov    (%eax),%eax
+ 8ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 8f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8f3:	39 f1                	cmp    %esi,%ecx
+ 8f5:	75 c8                	jne    8bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 8f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8fa:	89 15 20 0e 00 00    	mov    %edx,0xe20
+    p->s.size += bp->s.size;
+ 900:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 903:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 906:	89 0a                	mov    %ecx,(%edx)
+}
+ 908:	5b                   	pop    %ebx
+ 909:	5e                   	pop    %esi
+ 90a:	5f                   	pop    %edi
+ 90b:	5d                   	pop    %ebp
+ 90c:	c3                   	ret
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000910 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+ 910:	55                   	push   %ebp
+ 911:	89 e5                	mov    %esp,%ebp
+ 913:	57                   	push   %edi
+ 914:	56                   	push   %esi
+ 915:	53                   	push   %ebx
+ 916:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 919:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 91c:	8b 15 20 0e 00 00    	mov    0xe20,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 922:	8d 78 07             	lea    0x7(%eax),%edi
+ 925:	c1 ef 03             	shr    $0x3,%edi
+ 928:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 92b:	85 d2                	test   %edx,%edx
+ 92d:	0f 84 8d 00 00 00    	je     9c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 933:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 935:	8b 48 04             	mov    0x4(%eax),%ecx
+ 938:	39 f9                	cmp    %edi,%ecx
+ 93a:	73 64                	jae    9a0 <malloc+0x90>
+  if(nu < 4096)
+ 93c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 941:	39 df                	cmp    %ebx,%edi
+ 943:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 946:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 94d:	eb 0a                	jmp    959 <malloc+0x49>
+ 94f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 950:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 952:	8b 48 04             	mov    0x4(%eax),%ecx
+ 955:	39 f9                	cmp    %edi,%ecx
+ 957:	73 47                	jae    9a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 959:	89 c2                	mov    %eax,%edx
+ 95b:	39 05 20 0e 00 00    	cmp    %eax,0xe20
+ 961:	75 ed                	jne    950 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 963:	83 ec 0c             	sub    $0xc,%esp
+ 966:	56                   	push   %esi
+ 967:	e8 2f fb ff ff       	call   49b <sbrk>
+  if(p == (char*)-1)
+ 96c:	83 c4 10             	add    $0x10,%esp
+ 96f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 972:	74 1c                	je     990 <malloc+0x80>
+  hp->s.size = nu;
+ 974:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 977:	83 ec 0c             	sub    $0xc,%esp
+ 97a:	83 c0 08             	add    $0x8,%eax
+ 97d:	50                   	push   %eax
+ 97e:	e8 fd fe ff ff       	call   880 <free>
+  return freep;
+ 983:	8b 15 20 0e 00 00    	mov    0xe20,%edx
+      if((p = morecore(nunits)) == 0)
+ 989:	83 c4 10             	add    $0x10,%esp
+ 98c:	85 d2                	test   %edx,%edx
+ 98e:	75 c0                	jne    950 <malloc+0x40>
+        return 0;
+  }
+}
+ 990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 993:	31 c0                	xor    %eax,%eax
+}
+ 995:	5b                   	pop    %ebx
+ 996:	5e                   	pop    %esi
+ 997:	5f                   	pop    %edi
+ 998:	5d                   	pop    %ebp
+ 999:	c3                   	ret
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9a0:	39 cf                	cmp    %ecx,%edi
+ 9a2:	74 4c                	je     9f0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9a4:	29 f9                	sub    %edi,%ecx
+ 9a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9af:	89 15 20 0e 00 00    	mov    %edx,0xe20
+}
+ 9b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9b8:	83 c0 08             	add    $0x8,%eax
+}
+ 9bb:	5b                   	pop    %ebx
+ 9bc:	5e                   	pop    %esi
+ 9bd:	5f                   	pop    %edi
+ 9be:	5d                   	pop    %ebp
+ 9bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9c0:	c7 05 20 0e 00 00 24 	movl   $0xe24,0xe20
+ 9c7:	0e 00 00 
+    base.s.size = 0;
+ 9ca:	b8 24 0e 00 00       	mov    $0xe24,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9cf:	c7 05 24 0e 00 00 24 	movl   $0xe24,0xe24
+ 9d6:	0e 00 00 
+    base.s.size = 0;
+ 9d9:	c7 05 28 0e 00 00 00 	movl   $0x0,0xe28
+ 9e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9e3:	e9 54 ff ff ff       	jmp    93c <malloc+0x2c>
+ 9e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9f0:	8b 08                	mov    (%eax),%ecx
+ 9f2:	89 0a                	mov    %ecx,(%edx)
+ 9f4:	eb b9                	jmp    9af <malloc+0x9f>
@@ -0,0 +1,59 @@
+#include "kernel/types.h"
+#include "kernel/date.h"
+#include "user.h"
+
+/* Nanoseconds from a to b (b later than a) */
+static uint
+elapsed(struct timespec *a, struct timespec *b) {
+  return (b->tv_sec - a->tv_sec) * 1000000000 + b->tv_nsec - a->tv_nsec;
+}
+
+int
+main(int argc, char *argv[]) {
+  struct timespec t0, t1, req;
+  uint naps[] = { 100000, 1000000, 5000000 };
+  uint ns, i;
+
+  if(clock_gettime(CLOCK_MONOTONIC, &t0) < 0) {
+    printf(1, "clock_gettime failed\n");
+    exit(1);
+  }
+  printf(1, "monotonic clock: %d.%d s since boot\n", t0.tv_sec, t0.tv_nsec);
+
+  /* The clock must never go backwards */
+  for(i = 0; i < 10000; ++i) {
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if(t1.tv_sec < t0.tv_sec || (t1.tv_sec == t0.tv_sec && t1.tv_nsec < t0.tv_nsec)) {
+      printf(1, "clock went backwards\n");
+      exit(1);
+    }
+    t0 = t1;
+  }
+
+  /* Sub-tick sleeps: 100us, 1ms and 5ms */
+  for(i = 0; i < sizeof(naps)/sizeof(naps[0]); ++i) {
+    req.tv_sec = 0;
+    req.tv_nsec = naps[i];
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if(nanosleep(&req) < 0) {
+      printf(1, "nanosleep failed\n");
+      exit(1);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    ns = elapsed(&t0, &t1);
+    printf(1, "nanosleep(%d ns) slept %d ns\n", naps[i], ns);
+    if(ns < naps[i]) {
+      printf(1, "nanosleep woke up early\n");
+      exit(1);
+    }
+  }
+
+  /* One clock tick, for comparison */
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  sleep(1);
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  printf(1, "sleep(1) slept %d ns\n", elapsed(&t0, &t1));
+
+  printf(1, "clocktest ok\n");
+  exit(0);
+}
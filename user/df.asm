@@ -0,0 +1,1491 @@
+
+_df:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+
+#define TESTBIT(BMAP, INDEX)    (BMAP[(INDEX/8)] & (1<<(INDEX%8)))
+
+int
+main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 24             	sub    $0x24,%esp
+    uint fd_d1, stdout = 1;
+    uint fblocks = 0, finodes = 0, numbblock;
+    uint isize = sizeof(struct dinode);
+    struct superblock *sb = malloc(sizeof(struct superblock));
+  14:	6a 1c                	push   $0x1c
+  16:	e8 65 08 00 00       	call   880 <malloc>
+  1b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+
+    /* Open Disk 1 */
+    fd_d1 = open("disk1", O_RDONLY);
+  1e:	5a                   	pop    %edx
+    struct superblock *sb = malloc(sizeof(struct superblock));
+  1f:	89 c3                	mov    %eax,%ebx
+    fd_d1 = open("disk1", O_RDONLY);
+  21:	59                   	pop    %ecx
+  22:	6a 00                	push   $0x0
+  24:	68 68 09 00 00       	push   $0x968
+  29:	e8 95 03 00 00       	call   3c3 <open>
+
+    /* Read Super Block */
+    lseek(fd_d1, BSIZE, SEEK_SET); // Start at the Block 1 - SUPER BLOCK
+  2e:	83 c4 0c             	add    $0xc,%esp
+    fd_d1 = open("disk1", O_RDONLY);
+  31:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  34:	89 c6                	mov    %eax,%esi
+    lseek(fd_d1, BSIZE, SEEK_SET); // Start at the Block 1 - SUPER BLOCK
+  36:	6a 00                	push   $0x0
+  38:	68 00 02 00 00       	push   $0x200
+  3d:	50                   	push   %eax
+  3e:	e8 00 04 00 00       	call   443 <lseek>
+    read(fd_d1, sb, sizeof(struct superblock));
+  43:	83 c4 0c             	add    $0xc,%esp
+  46:	6a 1c                	push   $0x1c
+  48:	53                   	push   %ebx
+  49:	56                   	push   %esi
+  4a:	e8 4c 03 00 00       	call   39b <read>
+
+    /* Calculate number of free blocks */
+    numbblock = (FSSIZE/(BSIZE*8) + 1); // Number of bitmap blocks
+    uchar buf[BSIZE * numbblock]; // Temporary bitmap buffer
+  4f:	81 ec f0 01 00 00    	sub    $0x1f0,%esp
+  55:	89 e7                	mov    %esp,%edi
+    lseek(fd_d1, (sb->bmapstart*BSIZE), SEEK_SET); // Start at 1st Bmap Block
+  57:	83 ec 04             	sub    $0x4,%esp
+  5a:	6a 00                	push   $0x0
+  5c:	8b 43 18             	mov    0x18(%ebx),%eax
+  5f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  62:	c1 e0 09             	shl    $0x9,%eax
+  65:	50                   	push   %eax
+  66:	56                   	push   %esi
+  67:	e8 d7 03 00 00       	call   443 <lseek>
+    read(fd_d1, buf, BSIZE * numbblock); // Read bitmap block(s)
+  6c:	83 c4 0c             	add    $0xc,%esp
+  6f:	68 00 02 00 00       	push   $0x200
+  74:	57                   	push   %edi
+  75:	56                   	push   %esi
+  76:	e8 20 03 00 00       	call   39b <read>
+    for(uint bi = 0; bi < sb->nblocks; ++bi) {
+  7b:	8b 73 04             	mov    0x4(%ebx),%esi
+  7e:	89 fc                	mov    %edi,%esp
+  80:	85 f6                	test   %esi,%esi
+  82:	0f 84 b1 00 00 00    	je     139 <main+0x139>
+  88:	31 db                	xor    %ebx,%ebx
+    uint fblocks = 0, finodes = 0, numbblock;
+  8a:	31 d2                	xor    %edx,%edx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        if(!TESTBIT(buf, bi))
+  90:	89 d8                	mov    %ebx,%eax
+  92:	89 d9                	mov    %ebx,%ecx
+  94:	c1 e8 03             	shr    $0x3,%eax
+  97:	83 e1 07             	and    $0x7,%ecx
+  9a:	0f b6 04 07          	movzbl (%edi,%eax,1),%eax
+  9e:	d3 f8                	sar    %cl,%eax
+  a0:	83 e0 01             	and    $0x1,%eax
+            fblocks++;
+  a3:	83 f8 01             	cmp    $0x1,%eax
+  a6:	83 d2 00             	adc    $0x0,%edx
+    for(uint bi = 0; bi < sb->nblocks; ++bi) {
+  a9:	83 c3 01             	add    $0x1,%ebx
+  ac:	39 de                	cmp    %ebx,%esi
+  ae:	75 e0                	jne    90 <main+0x90>
+    }
+
+    /* Calculate number of free inodes */
+    struct dinode *inode = malloc(isize); // Temporary inode
+  b0:	83 ec 0c             	sub    $0xc,%esp
+  b3:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  b6:	6a 40                	push   $0x40
+  b8:	e8 c3 07 00 00       	call   880 <malloc>
+    lseek(fd_d1, (sb->inodestart*BSIZE), SEEK_SET); // Start at 1st Inode Block
+  bd:	83 c4 0c             	add    $0xc,%esp
+  c0:	6a 00                	push   $0x0
+  c2:	8b 7d e0             	mov    -0x20(%ebp),%edi
+    struct dinode *inode = malloc(isize); // Temporary inode
+  c5:	89 c3                	mov    %eax,%ebx
+    lseek(fd_d1, (sb->inodestart*BSIZE), SEEK_SET); // Start at 1st Inode Block
+  c7:	8b 47 14             	mov    0x14(%edi),%eax
+  ca:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  cd:	c1 e0 09             	shl    $0x9,%eax
+  d0:	50                   	push   %eax
+  d1:	ff 75 e4             	push   -0x1c(%ebp)
+  d4:	e8 6a 03 00 00       	call   443 <lseek>
+    for(uint in = 0; in < sb->ninodes; ++in) {
+  d9:	8b 77 08             	mov    0x8(%edi),%esi
+  dc:	83 c4 10             	add    $0x10,%esp
+  df:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  e2:	85 f6                	test   %esi,%esi
+  e4:	74 30                	je     116 <main+0x116>
+    uint fblocks = 0, finodes = 0, numbblock;
+  e6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    for(uint in = 0; in < sb->ninodes; ++in) {
+  e9:	31 ff                	xor    %edi,%edi
+    uint fblocks = 0, finodes = 0, numbblock;
+  eb:	31 f6                	xor    %esi,%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+        read(fd_d1, inode, isize);
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	6a 40                	push   $0x40
+  f5:	53                   	push   %ebx
+  f6:	ff 75 e4             	push   -0x1c(%ebp)
+  f9:	e8 9d 02 00 00       	call   39b <read>
+    for(uint in = 0; in < sb->ninodes; ++in) {
+  fe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+        if(!inode->type) 
+ 101:	83 c4 10             	add    $0x10,%esp
+            finodes++;
+ 104:	66 83 3b 01          	cmpw   $0x1,(%ebx)
+ 108:	83 d6 00             	adc    $0x0,%esi
+    for(uint in = 0; in < sb->ninodes; ++in) {
+ 10b:	83 c7 01             	add    $0x1,%edi
+ 10e:	3b 78 08             	cmp    0x8(%eax),%edi
+ 111:	72 dd                	jb     f0 <main+0xf0>
+ 113:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    }
+
+    /* Print current number of free blocks & free inodes */
+    printf(stdout, "Number of Free Blocks: %d\nNumber of Free Inodes: %d\n", fblocks, finodes);
+ 116:	56                   	push   %esi
+ 117:	52                   	push   %edx
+ 118:	68 70 09 00 00       	push   $0x970
+ 11d:	6a 01                	push   $0x1
+ 11f:	e8 3c 04 00 00       	call   560 <printf>
+
+    /* Close Disk 1 */
+    close(fd_d1);
+ 124:	58                   	pop    %eax
+ 125:	ff 75 e4             	push   -0x1c(%ebp)
+ 128:	e8 7e 02 00 00       	call   3ab <close>
+
+    exit(0);
+ 12d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+ 134:	e8 4a 02 00 00       	call   383 <exit>
+    uint fblocks = 0, finodes = 0, numbblock;
+ 139:	31 d2                	xor    %edx,%edx
+ 13b:	e9 70 ff ff ff       	jmp    b0 <main+0xb0>
+
+00000140 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 140:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 141:	31 c0                	xor    %eax,%eax
+{
+ 143:	89 e5                	mov    %esp,%ebp
+ 145:	53                   	push   %ebx
+ 146:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 149:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 150:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 154:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 157:	83 c0 01             	add    $0x1,%eax
+ 15a:	84 d2                	test   %dl,%dl
+ 15c:	75 f2                	jne    150 <strcpy+0x10>
+    ;
+  return os;
+}
+ 15e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 161:	89 c8                	mov    %ecx,%eax
+ 163:	c9                   	leave
+ 164:	c3                   	ret
+ 165:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	53                   	push   %ebx
+ 174:	8b 55 08             	mov    0x8(%ebp),%edx
+ 177:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 17a:	0f b6 02             	movzbl (%edx),%eax
+ 17d:	84 c0                	test   %al,%al
+ 17f:	75 17                	jne    198 <strcmp+0x28>
+ 181:	eb 3a                	jmp    1bd <strcmp+0x4d>
+ 183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 187:	90                   	nop
+ 188:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 18c:	83 c2 01             	add    $0x1,%edx
+ 18f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 192:	84 c0                	test   %al,%al
+ 194:	74 1a                	je     1b0 <strcmp+0x40>
+    p++, q++;
+ 196:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 198:	0f b6 19             	movzbl (%ecx),%ebx
+ 19b:	38 c3                	cmp    %al,%bl
+ 19d:	74 e9                	je     188 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 19f:	29 d8                	sub    %ebx,%eax
+}
+ 1a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a4:	c9                   	leave
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1b4:	31 c0                	xor    %eax,%eax
+ 1b6:	29 d8                	sub    %ebx,%eax
+}
+ 1b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1bb:	c9                   	leave
+ 1bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1c0:	31 c0                	xor    %eax,%eax
+ 1c2:	eb db                	jmp    19f <strcmp+0x2f>
+ 1c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1d9:	74 15                	je     1f0 <strlen+0x20>
+ 1db:	31 c0                	xor    %eax,%eax
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1e0:	83 c0 01             	add    $0x1,%eax
+ 1e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1e7:	89 c1                	mov    %eax,%ecx
+ 1e9:	75 f5                	jne    1e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1eb:	89 c8                	mov    %ecx,%eax
+ 1ed:	5d                   	pop    %ebp
+ 1ee:	c3                   	ret
+ 1ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1f0:	31 c9                	xor    %ecx,%ecx
+}
+ 1f2:	5d                   	pop    %ebp
+ 1f3:	89 c8                	mov    %ecx,%eax
+ 1f5:	c3                   	ret
+ 1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 207:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 20a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20d:	89 d7                	mov    %edx,%edi
+ 20f:	fc                   	cld
+ 210:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 212:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 215:	89 d0                	mov    %edx,%eax
+ 217:	c9                   	leave
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 22a:	0f b6 10             	movzbl (%eax),%edx
+ 22d:	84 d2                	test   %dl,%dl
+ 22f:	75 12                	jne    243 <strchr+0x23>
+ 231:	eb 1d                	jmp    250 <strchr+0x30>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 23c:	83 c0 01             	add    $0x1,%eax
+ 23f:	84 d2                	test   %dl,%dl
+ 241:	74 0d                	je     250 <strchr+0x30>
+    if(*s == c)
+ 243:	38 d1                	cmp    %dl,%cl
+ 245:	75 f1                	jne    238 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 247:	5d                   	pop    %ebp
+ 248:	c3                   	ret
+ 249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 250:	31 c0                	xor    %eax,%eax
+}
+ 252:	5d                   	pop    %ebp
+ 253:	c3                   	ret
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 265:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 268:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 269:	31 db                	xor    %ebx,%ebx
+{
+ 26b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 26e:	eb 27                	jmp    297 <gets+0x37>
+    cc = read(0, &c, 1);
+ 270:	83 ec 04             	sub    $0x4,%esp
+ 273:	6a 01                	push   $0x1
+ 275:	56                   	push   %esi
+ 276:	6a 00                	push   $0x0
+ 278:	e8 1e 01 00 00       	call   39b <read>
+    if(cc < 1)
+ 27d:	83 c4 10             	add    $0x10,%esp
+ 280:	85 c0                	test   %eax,%eax
+ 282:	7e 1d                	jle    2a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 284:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 28f:	3c 0a                	cmp    $0xa,%al
+ 291:	74 10                	je     2a3 <gets+0x43>
+ 293:	3c 0d                	cmp    $0xd,%al
+ 295:	74 0c                	je     2a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 297:	89 df                	mov    %ebx,%edi
+ 299:	83 c3 01             	add    $0x1,%ebx
+ 29c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 29f:	7c cf                	jl     270 <gets+0x10>
+ 2a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ad:	5b                   	pop    %ebx
+ 2ae:	5e                   	pop    %esi
+ 2af:	5f                   	pop    %edi
+ 2b0:	5d                   	pop    %ebp
+ 2b1:	c3                   	ret
+ 2b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	56                   	push   %esi
+ 2c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2c5:	83 ec 08             	sub    $0x8,%esp
+ 2c8:	6a 00                	push   $0x0
+ 2ca:	ff 75 08             	push   0x8(%ebp)
+ 2cd:	e8 f1 00 00 00       	call   3c3 <open>
+  if(fd < 0)
+ 2d2:	83 c4 10             	add    $0x10,%esp
+ 2d5:	85 c0                	test   %eax,%eax
+ 2d7:	78 27                	js     300 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2d9:	83 ec 08             	sub    $0x8,%esp
+ 2dc:	ff 75 0c             	push   0xc(%ebp)
+ 2df:	89 c3                	mov    %eax,%ebx
+ 2e1:	50                   	push   %eax
+ 2e2:	e8 f4 00 00 00       	call   3db <fstat>
+  close(fd);
+ 2e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2ec:	e8 ba 00 00 00       	call   3ab <close>
+  return r;
+ 2f1:	83 c4 10             	add    $0x10,%esp
+}
+ 2f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2f7:	89 f0                	mov    %esi,%eax
+ 2f9:	5b                   	pop    %ebx
+ 2fa:	5e                   	pop    %esi
+ 2fb:	5d                   	pop    %ebp
+ 2fc:	c3                   	ret
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 300:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 305:	eb ed                	jmp    2f4 <stat+0x34>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+
+00000310 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	53                   	push   %ebx
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 317:	0f be 02             	movsbl (%edx),%eax
+ 31a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 31d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 320:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 325:	77 1e                	ja     345 <atoi+0x35>
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 330:	83 c2 01             	add    $0x1,%edx
+ 333:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 336:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 33a:	0f be 02             	movsbl (%edx),%eax
+ 33d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 340:	80 fb 09             	cmp    $0x9,%bl
+ 343:	76 eb                	jbe    330 <atoi+0x20>
+  return n;
+}
+ 345:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 348:	89 c8                	mov    %ecx,%eax
+ 34a:	c9                   	leave
+ 34b:	c3                   	ret
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	8b 45 10             	mov    0x10(%ebp),%eax
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 35e:	85 c0                	test   %eax,%eax
+ 360:	7e 13                	jle    375 <memmove+0x25>
+ 362:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 364:	89 d7                	mov    %edx,%edi
+ 366:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 370:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 371:	39 f8                	cmp    %edi,%eax
+ 373:	75 fb                	jne    370 <memmove+0x20>
+  return vdst;
+}
+ 375:	5e                   	pop    %esi
+ 376:	89 d0                	mov    %edx,%eax
+ 378:	5f                   	pop    %edi
+ 379:	5d                   	pop    %ebp
+ 37a:	c3                   	ret
+
+0000037b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 37b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <exit>:
+SYSCALL(exit)
+ 383:	b8 02 00 00 00       	mov    $0x2,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <wait>:
+SYSCALL(wait)
+ 38b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <pipe>:
+SYSCALL(pipe)
+ 393:	b8 04 00 00 00       	mov    $0x4,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <read>:
+SYSCALL(read)
+ 39b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <write>:
+SYSCALL(write)
+ 3a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <close>:
+SYSCALL(close)
+ 3ab:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <kill>:
+SYSCALL(kill)
+ 3b3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <exec>:
+SYSCALL(exec)
+ 3bb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <open>:
+SYSCALL(open)
+ 3c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <mknod>:
+SYSCALL(mknod)
+ 3cb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <unlink>:
+SYSCALL(unlink)
+ 3d3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <fstat>:
+SYSCALL(fstat)
+ 3db:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <link>:
+SYSCALL(link)
+ 3e3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <mkdir>:
+SYSCALL(mkdir)
+ 3eb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <chdir>:
+SYSCALL(chdir)
+ 3f3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <dup>:
+SYSCALL(dup)
+ 3fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <getpid>:
+SYSCALL(getpid)
+ 403:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <sbrk>:
+SYSCALL(sbrk)
+ 40b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <sleep>:
+SYSCALL(sleep)
+ 413:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <uptime>:
+SYSCALL(uptime)
+ 41b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <getdate>:
+SYSCALL(getdate)
+ 423:	b8 16 00 00 00       	mov    $0x16,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <setdate>:
+SYSCALL(setdate)
+ 42b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <mount>:
+SYSCALL(mount)
+ 433:	b8 18 00 00 00       	mov    $0x18,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <unmount>:
+SYSCALL(unmount)
+ 43b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <lseek>:
+SYSCALL(lseek)
+ 443:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mmap>:
+SYSCALL(mmap)
+ 44b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <munmap>:
+SYSCALL(munmap)
+ 453:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <clock_gettime>:
+SYSCALL(clock_gettime)
+ 45b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <nanosleep>:
+SYSCALL(nanosleep)
+ 463:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 46b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 473:	b8 20 00 00 00       	mov    $0x20,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <proclimit>:
+SYSCALL(proclimit)
+ 47b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <procinfo>:
+SYSCALL(procinfo)
+ 483:	b8 22 00 00 00       	mov    $0x22,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <cpuinfo>:
+SYSCALL(cpuinfo)
+ 48b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <schedstat>:
+SYSCALL(schedstat)
+ 493:	b8 24 00 00 00       	mov    $0x24,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <lockstat>:
+SYSCALL(lockstat)
+ 49b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <bcachestat>:
+SYSCALL(bcachestat)
+ 4a3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <diskstat>:
+SYSCALL(diskstat)
+ 4ab:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <iosched>:
+SYSCALL(iosched)
+ 4b3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+ 4bb:	66 90                	xchg   %ax,%ax
+ 4bd:	66 90                	xchg   %ax,%ax
+ 4bf:	90                   	nop
+
+000004c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	53                   	push   %ebx
+ 4c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4c8:	89 d1                	mov    %edx,%ecx
+{
+ 4ca:	83 ec 3c             	sub    $0x3c,%esp
+ 4cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4d0:	85 d2                	test   %edx,%edx
+ 4d2:	0f 89 80 00 00 00    	jns    558 <printint+0x98>
+ 4d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4dc:	74 7a                	je     558 <printint+0x98>
+    x = -xx;
+ 4de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4e8:	31 f6                	xor    %esi,%esi
+ 4ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4f0:	89 c8                	mov    %ecx,%eax
+ 4f2:	31 d2                	xor    %edx,%edx
+ 4f4:	89 f7                	mov    %esi,%edi
+ 4f6:	f7 f3                	div    %ebx
+ 4f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4fb:	0f b6 92 08 0a 00 00 	movzbl 0xa08(%edx),%edx
+ 502:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 506:	89 ca                	mov    %ecx,%edx
+ 508:	89 c1                	mov    %eax,%ecx
+ 50a:	39 da                	cmp    %ebx,%edx
+ 50c:	73 e2                	jae    4f0 <printint+0x30>
+  if(neg)
+ 50e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 511:	85 c0                	test   %eax,%eax
+ 513:	74 07                	je     51c <printint+0x5c>
+    buf[i++] = '-';
+ 515:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 51a:	89 f7                	mov    %esi,%edi
+ 51c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 51f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 522:	01 df                	add    %ebx,%edi
+ 524:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 528:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 52b:	83 ec 04             	sub    $0x4,%esp
+ 52e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 531:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 534:	6a 01                	push   $0x1
+ 536:	50                   	push   %eax
+ 537:	56                   	push   %esi
+ 538:	e8 66 fe ff ff       	call   3a3 <write>
+  while(--i >= 0)
+ 53d:	89 f8                	mov    %edi,%eax
+ 53f:	83 c4 10             	add    $0x10,%esp
+ 542:	83 ef 01             	sub    $0x1,%edi
+ 545:	39 d8                	cmp    %ebx,%eax
+ 547:	75 df                	jne    528 <printint+0x68>
+}
+ 549:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 54c:	5b                   	pop    %ebx
+ 54d:	5e                   	pop    %esi
+ 54e:	5f                   	pop    %edi
+ 54f:	5d                   	pop    %ebp
+ 550:	c3                   	ret
+ 551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 558:	31 c0                	xor    %eax,%eax
+ 55a:	eb 89                	jmp    4e5 <printint+0x25>
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	53                   	push   %ebx
+ 566:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 569:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+ 56c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 56f:	0f b6 1e             	movzbl (%esi),%ebx
+ 572:	83 c6 01             	add    $0x1,%esi
+ 575:	84 db                	test   %bl,%bl
+ 577:	74 67                	je     5e0 <printf+0x80>
+ 579:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 57c:	31 d2                	xor    %edx,%edx
+ 57e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 581:	eb 34                	jmp    5b7 <printf+0x57>
+ 583:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 587:	90                   	nop
+ 588:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 58b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 590:	83 f8 25             	cmp    $0x25,%eax
+ 593:	74 18                	je     5ad <printf+0x4d>
+  write(fd, &c, 1);
+ 595:	83 ec 04             	sub    $0x4,%esp
+ 598:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 59b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 59e:	6a 01                	push   $0x1
+ 5a0:	50                   	push   %eax
+ 5a1:	57                   	push   %edi
+ 5a2:	e8 fc fd ff ff       	call   3a3 <write>
+ 5a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 5b0:	83 c6 01             	add    $0x1,%esi
+ 5b3:	84 db                	test   %bl,%bl
+ 5b5:	74 29                	je     5e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5ba:	85 d2                	test   %edx,%edx
+ 5bc:	74 ca                	je     588 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5be:	83 fa 25             	cmp    $0x25,%edx
+ 5c1:	75 ea                	jne    5ad <printf+0x4d>
+      if(c == 'd'){
+ 5c3:	83 f8 25             	cmp    $0x25,%eax
+ 5c6:	0f 84 24 01 00 00    	je     6f0 <printf+0x190>
+ 5cc:	83 e8 63             	sub    $0x63,%eax
+ 5cf:	83 f8 15             	cmp    $0x15,%eax
+ 5d2:	77 1c                	ja     5f0 <printf+0x90>
+ 5d4:	ff 24 85 b0 09 00 00 	jmp    *0x9b0(,%eax,4)
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5e3:	5b                   	pop    %ebx
+ 5e4:	5e                   	pop    %esi
+ 5e5:	5f                   	pop    %edi
+ 5e6:	5d                   	pop    %ebp
+ 5e7:	c3                   	ret
+ 5e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+  write(fd, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5fa:	6a 01                	push   $0x1
+ 5fc:	52                   	push   %edx
+ 5fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 600:	57                   	push   %edi
+ 601:	e8 9d fd ff ff       	call   3a3 <write>
+ 606:	83 c4 0c             	add    $0xc,%esp
+ 609:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 60c:	6a 01                	push   $0x1
+ 60e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 611:	52                   	push   %edx
+ 612:	57                   	push   %edi
+ 613:	e8 8b fd ff ff       	call   3a3 <write>
+        putc(fd, c);
+ 618:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 61b:	31 d2                	xor    %edx,%edx
+ 61d:	eb 8e                	jmp    5ad <printf+0x4d>
+ 61f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 620:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 623:	83 ec 0c             	sub    $0xc,%esp
+ 626:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 62b:	8b 13                	mov    (%ebx),%edx
+ 62d:	6a 00                	push   $0x0
+ 62f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 631:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 634:	e8 87 fe ff ff       	call   4c0 <printint>
+        ap++;
+ 639:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 63c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 63f:	31 d2                	xor    %edx,%edx
+ 641:	e9 67 ff ff ff       	jmp    5ad <printf+0x4d>
+ 646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 650:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 653:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 655:	83 c0 04             	add    $0x4,%eax
+ 658:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 65b:	85 db                	test   %ebx,%ebx
+ 65d:	0f 84 9d 00 00 00    	je     700 <printf+0x1a0>
+        while(*s != 0){
+ 663:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 666:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 668:	84 c0                	test   %al,%al
+ 66a:	0f 84 3d ff ff ff    	je     5ad <printf+0x4d>
+ 670:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 673:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 676:	89 de                	mov    %ebx,%esi
+ 678:	89 d3                	mov    %edx,%ebx
+ 67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 686:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 689:	6a 01                	push   $0x1
+ 68b:	53                   	push   %ebx
+ 68c:	57                   	push   %edi
+ 68d:	e8 11 fd ff ff       	call   3a3 <write>
+        while(*s != 0){
+ 692:	0f b6 06             	movzbl (%esi),%eax
+ 695:	83 c4 10             	add    $0x10,%esp
+ 698:	84 c0                	test   %al,%al
+ 69a:	75 e4                	jne    680 <printf+0x120>
+      state = 0;
+ 69c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 69f:	31 d2                	xor    %edx,%edx
+ 6a1:	e9 07 ff ff ff       	jmp    5ad <printf+0x4d>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 01                	push   $0x1
+ 6bf:	e9 6b ff ff ff       	jmp    62f <printf+0xcf>
+ 6c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6cb:	83 ec 04             	sub    $0x4,%esp
+ 6ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6d9:	6a 01                	push   $0x1
+ 6db:	52                   	push   %edx
+ 6dc:	57                   	push   %edi
+ 6dd:	e8 c1 fc ff ff       	call   3a3 <write>
+        ap++;
+ 6e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6e8:	31 d2                	xor    %edx,%edx
+ 6ea:	e9 be fe ff ff       	jmp    5ad <printf+0x4d>
+ 6ef:	90                   	nop
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	e9 11 ff ff ff       	jmp    611 <printf+0xb1>
+ 700:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 705:	bb a5 09 00 00       	mov    $0x9a5,%ebx
+ 70a:	e9 61 ff ff ff       	jmp    670 <printf+0x110>
+ 70f:	90                   	nop
+
+00000710 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	83 ec 20             	sub    $0x20,%esp
+ 719:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 71c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+ 71f:	57                   	push   %edi
+ 720:	68 ac 09 00 00       	push   $0x9ac
+ 725:	53                   	push   %ebx
+ 726:	e8 35 fe ff ff       	call   560 <printf>
+  for(n = strlen(s); n < w; n++)
+ 72b:	89 3c 24             	mov    %edi,(%esp)
+ 72e:	e8 9d fa ff ff       	call   1d0 <strlen>
+ 733:	83 c4 10             	add    $0x10,%esp
+ 736:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 739:	7d 20                	jge    75b <pads+0x4b>
+ 73b:	89 c6                	mov    %eax,%esi
+ 73d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+ 747:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 74a:	6a 01                	push   $0x1
+ 74c:	57                   	push   %edi
+ 74d:	53                   	push   %ebx
+ 74e:	e8 50 fc ff ff       	call   3a3 <write>
+  for(n = strlen(s); n < w; n++)
+ 753:	83 c4 10             	add    $0x10,%esp
+ 756:	39 75 10             	cmp    %esi,0x10(%ebp)
+ 759:	75 e5                	jne    740 <pads+0x30>
+    putc(fd, ' ');
+}
+ 75b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 75e:	5b                   	pop    %ebx
+ 75f:	5e                   	pop    %esi
+ 760:	5f                   	pop    %edi
+ 761:	5d                   	pop    %ebp
+ 762:	c3                   	ret
+ 763:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000770 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+ 770:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+ 771:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+ 776:	89 e5                	mov    %esp,%ebp
+ 778:	57                   	push   %edi
+ 779:	56                   	push   %esi
+ 77a:	53                   	push   %ebx
+  int n = 0;
+ 77b:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+ 77d:	83 ec 2c             	sub    $0x2c,%esp
+ 780:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 783:	8b 45 10             	mov    0x10(%ebp),%eax
+ 786:	8b 75 08             	mov    0x8(%ebp),%esi
+ 789:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 78c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 78f:	90                   	nop
+  }while((x /= 10) != 0);
+ 790:	89 d0                	mov    %edx,%eax
+ 792:	89 d7                	mov    %edx,%edi
+    n++;
+ 794:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+ 797:	f7 e1                	mul    %ecx
+ 799:	c1 ea 03             	shr    $0x3,%edx
+ 79c:	83 ff 09             	cmp    $0x9,%edi
+ 79f:	77 ef                	ja     790 <padd+0x20>
+  for(; n < w; n++)
+ 7a1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 7a4:	39 c3                	cmp    %eax,%ebx
+ 7a6:	7d 23                	jge    7cb <padd+0x5b>
+ 7a8:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 7ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7af:	90                   	nop
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+ 7b7:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+ 7ba:	6a 01                	push   $0x1
+ 7bc:	57                   	push   %edi
+ 7bd:	56                   	push   %esi
+ 7be:	e8 e0 fb ff ff       	call   3a3 <write>
+  for(; n < w; n++)
+ 7c3:	83 c4 10             	add    $0x10,%esp
+ 7c6:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+ 7c9:	75 e5                	jne    7b0 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+ 7cb:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+ 7d2:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+ 7d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+ 7d8:	89 f0                	mov    %esi,%eax
+}
+ 7da:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+ 7db:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+ 7e0:	5e                   	pop    %esi
+ 7e1:	5f                   	pop    %edi
+ 7e2:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+ 7e3:	e9 d8 fc ff ff       	jmp    4c0 <printint>
+ 7e8:	66 90                	xchg   %ax,%ax
+ 7ea:	66 90                	xchg   %ax,%ax
+ 7ec:	66 90                	xchg   %ax,%ax
+ 7ee:	66 90                	xchg   %ax,%ax
+
+000007f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f1:	a1 08 0d 00 00       	mov    0xd08,%eax
+{
+ 7f6:	89 e5                	mov    %esp,%ebp
+ 7f8:	57                   	push   %edi
+ 7f9:	56                   	push   %esi
+ 7fa:	53                   	push   %ebx
+ 7fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 808:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 80a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 80c:	39 ca                	cmp    %ecx,%edx
+ 80e:	73 30                	jae    840 <free+0x50>
+ 810:	39 c1                	cmp    %eax,%ecx
+ 812:	72 04                	jb     818 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 814:	39 c2                	cmp    %eax,%edx
+ 816:	72 f0                	jb     808 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 818:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 81b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 81e:	39 f8                	cmp    %edi,%eax
+ 820:	74 2e                	je     850 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 822:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 825:	8b 42 04             	mov    0x4(%edx),%eax
+ 828:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 82b:	39 f1                	cmp    %esi,%ecx
+ 82d:	74 38                	je     867 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 82f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 831:	5b                   	pop    %ebx
+  freep = p;
+ 832:	89 15 08 0d 00 00    	mov    %edx,0xd08
+}
+ 838:	5e                   	pop    %esi
+ 839:	5f                   	pop    %edi
+ 83a:	5d                   	pop    %ebp
+ 83b:	c3                   	ret
+ 83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 840:	39 c1                	cmp    %eax,%ecx
+ 842:	72 d0                	jb     814 <free+0x24>
+ 844:	eb c2                	jmp    808 <free+0x18>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 850:	03 70 04             	add    0x4(%eax),%esi
+ 853:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 856:	8b 02                	mov    (%edx),%eax
+ 858:	8b 00                	mov    (%eax),%eax
+ 85a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 85d:	8b 42 04             	mov    0x4(%edx),%eax
+ 860:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 863:	39 f1                	cmp    %esi,%ecx
+ 865:	75 c8                	jne    82f <free+0x3f>
+    p->s.size += bp->s.size;
+ 867:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 86a:	89 15 08 0d 00 00    	mov    %edx,0xd08
+    p->s.size += bp->s.size;
+ 870:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 873:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 876:	89 0a                	mov    %ecx,(%edx)
+}
+ 878:	5b                   	pop    %ebx
+ 879:	5e                   	pop    %esi
+ 87a:	5f                   	pop    %edi
+ 87b:	5d                   	pop    %ebp
+ 87c:	c3                   	ret
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000880 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 889:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 88c:	8b 15 08 0d 00 00    	mov    0xd08,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 892:	8d 78 07             	lea    0x7(%eax),%edi
+ 895:	c1 ef 03             	shr    $0x3,%edi
+ 898:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 89b:	85 d2                	test   %edx,%edx
+ 89d:	0f 84 8d 00 00 00    	je     930 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8a5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8a8:	39 f9                	cmp    %edi,%ecx
+ 8aa:	73 64                	jae    910 <malloc+0x90>
+  if(nu < 4096)
+ 8ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8b1:	39 df                	cmp    %ebx,%edi
+ 8b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8bd:	eb 0a                	jmp    8c9 <malloc+0x49>
+ 8bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8c2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8c5:	39 f9                	cmp    %edi,%ecx
+ 8c7:	73 47                	jae    910 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8c9:	89 c2                	mov    %eax,%edx
+ 8cb:	39 05 08 0d 00 00    	cmp    %eax,0xd08
+ 8d1:	75 ed                	jne    8c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	56                   	push   %esi
+ 8d7:	e8 2f fb ff ff       	call   40b <sbrk>
+  if(p == (char*)-1)
+ 8dc:	83 c4 10             	add    $0x10,%esp
+ 8df:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8e2:	74 1c                	je     900 <malloc+0x80>
+  hp->s.size = nu;
+ 8e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8e7:	83 ec 0c             	sub    $0xc,%esp
+ 8ea:	83 c0 08             	add    $0x8,%eax
+ 8ed:	50                   	push   %eax
+ 8ee:	e8 fd fe ff ff       	call   7f0 <free>
+  return freep;
+ 8f3:	8b 15 08 0d 00 00    	mov    0xd08,%edx
+      if((p = morecore(nunits)) == 0)
+ 8f9:	83 c4 10             	add    $0x10,%esp
+ 8fc:	85 d2                	test   %edx,%edx
+ 8fe:	75 c0                	jne    8c0 <malloc+0x40>
+        return 0;
+  }
+}
+ 900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 903:	31 c0                	xor    %eax,%eax
+}
+ 905:	5b                   	pop    %ebx
+ 906:	5e                   	pop    %esi
+ 907:	5f                   	pop    %edi
+ 908:	5d                   	pop    %ebp
+ 909:	c3                   	ret
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 910:	39 cf                	cmp    %ecx,%edi
+ 912:	74 4c                	je     960 <malloc+0xe0>
+        p->s.size -= nunits;
+ 914:	29 f9                	sub    %edi,%ecx
+ 916:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 919:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 91c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 91f:	89 15 08 0d 00 00    	mov    %edx,0xd08
+}
+ 925:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 928:	83 c0 08             	add    $0x8,%eax
+}
+ 92b:	5b                   	pop    %ebx
+ 92c:	5e                   	pop    %esi
+ 92d:	5f                   	pop    %edi
+ 92e:	5d                   	pop    %ebp
+ 92f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 930:	c7 05 08 0d 00 00 0c 	movl   $0xd0c,0xd08
+ 937:	0d 00 00 
+    base.s.size = 0;
+ 93a:	b8 0c 0d 00 00       	mov    $0xd0c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 93f:	c7 05 0c 0d 00 00 0c 	movl   $0xd0c,0xd0c
+ 946:	0d 00 00 
+    base.s.size = 0;
+ 949:	c7 05 10 0d 00 00 00 	movl   $0x0,0xd10
+ 950:	00 00 00 
+    if(p->s.size >= nunits){
+ 953:	e9 54 ff ff ff       	jmp    8ac <malloc+0x2c>
+ 958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 960:	8b 08                	mov    (%eax),%ecx
+ 962:	89 0a                	mov    %ecx,(%edx)
+ 964:	eb b9                	jmp    91f <malloc+0x9f>
@@ -0,0 +1,781 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  forktest();
+  11:	e8 3a 00 00 00       	call   50 <forktest>
+  exit(0);
+  16:	83 ec 0c             	sub    $0xc,%esp
+  19:	6a 00                	push   $0x0
+  1b:	e8 83 03 00 00       	call   3a3 <exit>
+
+00000020 <printf>:
+{
+  20:	55                   	push   %ebp
+  21:	89 e5                	mov    %esp,%ebp
+  23:	53                   	push   %ebx
+  24:	83 ec 10             	sub    $0x10,%esp
+  27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  2a:	53                   	push   %ebx
+  2b:	e8 c0 01 00 00       	call   1f0 <strlen>
+  30:	83 c4 0c             	add    $0xc,%esp
+  33:	50                   	push   %eax
+  34:	53                   	push   %ebx
+  35:	ff 75 08             	push   0x8(%ebp)
+  38:	e8 86 03 00 00       	call   3c3 <write>
+}
+  3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	c9                   	leave
+  44:	c3                   	ret
+  45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000050 <forktest>:
+{
+  50:	55                   	push   %ebp
+  51:	89 e5                	mov    %esp,%ebp
+  53:	56                   	push   %esi
+  54:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+  55:	31 db                	xor    %ebx,%ebx
+{
+  57:	83 ec 1c             	sub    $0x1c,%esp
+  write(fd, s, strlen(s));
+  5a:	68 dc 04 00 00       	push   $0x4dc
+  5f:	e8 8c 01 00 00       	call   1f0 <strlen>
+  64:	83 c4 0c             	add    $0xc,%esp
+  67:	50                   	push   %eax
+  68:	68 dc 04 00 00       	push   $0x4dc
+  6d:	6a 01                	push   $0x1
+  6f:	e8 4f 03 00 00       	call   3c3 <write>
+  74:	83 c4 10             	add    $0x10,%esp
+  77:	eb 18                	jmp    91 <forktest+0x41>
+  79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pid == 0)
+  80:	74 73                	je     f5 <forktest+0xa5>
+  for(n=0; n<N; n++){
+  82:	83 c3 01             	add    $0x1,%ebx
+  85:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  8b:	0f 84 b1 00 00 00    	je     142 <forktest+0xf2>
+    pid = fork();
+  91:	e8 05 03 00 00       	call   39b <fork>
+    if(pid < 0)
+  96:	85 c0                	test   %eax,%eax
+  98:	79 e6                	jns    80 <forktest+0x30>
+  for(; n > 0; n--){
+  9a:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  9d:	85 db                	test   %ebx,%ebx
+  9f:	74 1c                	je     bd <forktest+0x6d>
+  a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(wait(&estatus) < 0){
+  a8:	83 ec 0c             	sub    $0xc,%esp
+  ab:	56                   	push   %esi
+  ac:	e8 fa 02 00 00       	call   3ab <wait>
+  b1:	83 c4 10             	add    $0x10,%esp
+  b4:	85 c0                	test   %eax,%eax
+  b6:	78 47                	js     ff <forktest+0xaf>
+  for(; n > 0; n--){
+  b8:	83 eb 01             	sub    $0x1,%ebx
+  bb:	75 eb                	jne    a8 <forktest+0x58>
+  if(wait(&estatus) != -1){
+  bd:	83 ec 0c             	sub    $0xc,%esp
+  c0:	56                   	push   %esi
+  c1:	e8 e5 02 00 00       	call   3ab <wait>
+  c6:	83 c4 10             	add    $0x10,%esp
+  c9:	83 f8 ff             	cmp    $0xffffffff,%eax
+  cc:	75 5a                	jne    128 <forktest+0xd8>
+  write(fd, s, strlen(s));
+  ce:	83 ec 0c             	sub    $0xc,%esp
+  d1:	68 0e 05 00 00       	push   $0x50e
+  d6:	e8 15 01 00 00       	call   1f0 <strlen>
+  db:	83 c4 0c             	add    $0xc,%esp
+  de:	50                   	push   %eax
+  df:	68 0e 05 00 00       	push   $0x50e
+  e4:	6a 01                	push   $0x1
+  e6:	e8 d8 02 00 00       	call   3c3 <write>
+}
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+      exit(1);
+  f5:	83 ec 0c             	sub    $0xc,%esp
+  f8:	6a 01                	push   $0x1
+  fa:	e8 a4 02 00 00       	call   3a3 <exit>
+  write(fd, s, strlen(s));
+  ff:	83 ec 0c             	sub    $0xc,%esp
+ 102:	68 e7 04 00 00       	push   $0x4e7
+ 107:	e8 e4 00 00 00       	call   1f0 <strlen>
+ 10c:	83 c4 0c             	add    $0xc,%esp
+ 10f:	50                   	push   %eax
+ 110:	68 e7 04 00 00       	push   $0x4e7
+ 115:	6a 01                	push   $0x1
+ 117:	e8 a7 02 00 00       	call   3c3 <write>
+      exit(1);
+ 11c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 123:	e8 7b 02 00 00       	call   3a3 <exit>
+    printf(1, "wait got too many\n");
+ 128:	50                   	push   %eax
+ 129:	50                   	push   %eax
+ 12a:	68 fb 04 00 00       	push   $0x4fb
+ 12f:	6a 01                	push   $0x1
+ 131:	e8 ea fe ff ff       	call   20 <printf>
+    exit(1);
+ 136:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 13d:	e8 61 02 00 00       	call   3a3 <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+ 142:	52                   	push   %edx
+ 143:	68 e8 03 00 00       	push   $0x3e8
+ 148:	68 1c 05 00 00       	push   $0x51c
+ 14d:	6a 01                	push   $0x1
+ 14f:	e8 cc fe ff ff       	call   20 <printf>
+    exit(1);
+ 154:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 15b:	e8 43 02 00 00       	call   3a3 <exit>
+
+00000160 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 160:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 161:	31 c0                	xor    %eax,%eax
+{
+ 163:	89 e5                	mov    %esp,%ebp
+ 165:	53                   	push   %ebx
+ 166:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 169:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 170:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 174:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 177:	83 c0 01             	add    $0x1,%eax
+ 17a:	84 d2                	test   %dl,%dl
+ 17c:	75 f2                	jne    170 <strcpy+0x10>
+    ;
+  return os;
+}
+ 17e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 181:	89 c8                	mov    %ecx,%eax
+ 183:	c9                   	leave
+ 184:	c3                   	ret
+ 185:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	53                   	push   %ebx
+ 194:	8b 55 08             	mov    0x8(%ebp),%edx
+ 197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 19a:	0f b6 02             	movzbl (%edx),%eax
+ 19d:	84 c0                	test   %al,%al
+ 19f:	75 17                	jne    1b8 <strcmp+0x28>
+ 1a1:	eb 3a                	jmp    1dd <strcmp+0x4d>
+ 1a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1a7:	90                   	nop
+ 1a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1ac:	83 c2 01             	add    $0x1,%edx
+ 1af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1b2:	84 c0                	test   %al,%al
+ 1b4:	74 1a                	je     1d0 <strcmp+0x40>
+    p++, q++;
+ 1b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1bb:	38 c3                	cmp    %al,%bl
+ 1bd:	74 e9                	je     1a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1bf:	29 d8                	sub    %ebx,%eax
+}
+ 1c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1c4:	c9                   	leave
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1d4:	31 c0                	xor    %eax,%eax
+ 1d6:	29 d8                	sub    %ebx,%eax
+}
+ 1d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1db:	c9                   	leave
+ 1dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1e0:	31 c0                	xor    %eax,%eax
+ 1e2:	eb db                	jmp    1bf <strcmp+0x2f>
+ 1e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1f9:	74 15                	je     210 <strlen+0x20>
+ 1fb:	31 c0                	xor    %eax,%eax
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 200:	83 c0 01             	add    $0x1,%eax
+ 203:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 207:	89 c1                	mov    %eax,%ecx
+ 209:	75 f5                	jne    200 <strlen+0x10>
+    ;
+  return n;
+}
+ 20b:	89 c8                	mov    %ecx,%eax
+ 20d:	5d                   	pop    %ebp
+ 20e:	c3                   	ret
+ 20f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 210:	31 c9                	xor    %ecx,%ecx
+}
+ 212:	5d                   	pop    %ebp
+ 213:	89 c8                	mov    %ecx,%eax
+ 215:	c3                   	ret
+ 216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000220 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	57                   	push   %edi
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 227:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 22a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22d:	89 d7                	mov    %edx,%edi
+ 22f:	fc                   	cld
+ 230:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 232:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 235:	89 d0                	mov    %edx,%eax
+ 237:	c9                   	leave
+ 238:	c3                   	ret
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 24a:	0f b6 10             	movzbl (%eax),%edx
+ 24d:	84 d2                	test   %dl,%dl
+ 24f:	75 12                	jne    263 <strchr+0x23>
+ 251:	eb 1d                	jmp    270 <strchr+0x30>
+ 253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 257:	90                   	nop
+ 258:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 25c:	83 c0 01             	add    $0x1,%eax
+ 25f:	84 d2                	test   %dl,%dl
+ 261:	74 0d                	je     270 <strchr+0x30>
+    if(*s == c)
+ 263:	38 d1                	cmp    %dl,%cl
+ 265:	75 f1                	jne    258 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 267:	5d                   	pop    %ebp
+ 268:	c3                   	ret
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 270:	31 c0                	xor    %eax,%eax
+}
+ 272:	5d                   	pop    %ebp
+ 273:	c3                   	ret
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 285:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 288:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 289:	31 db                	xor    %ebx,%ebx
+{
+ 28b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 28e:	eb 27                	jmp    2b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 290:	83 ec 04             	sub    $0x4,%esp
+ 293:	6a 01                	push   $0x1
+ 295:	56                   	push   %esi
+ 296:	6a 00                	push   $0x0
+ 298:	e8 1e 01 00 00       	call   3bb <read>
+    if(cc < 1)
+ 29d:	83 c4 10             	add    $0x10,%esp
+ 2a0:	85 c0                	test   %eax,%eax
+ 2a2:	7e 1d                	jle    2c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2af:	3c 0a                	cmp    $0xa,%al
+ 2b1:	74 10                	je     2c3 <gets+0x43>
+ 2b3:	3c 0d                	cmp    $0xd,%al
+ 2b5:	74 0c                	je     2c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2b7:	89 df                	mov    %ebx,%edi
+ 2b9:	83 c3 01             	add    $0x1,%ebx
+ 2bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2bf:	7c cf                	jl     290 <gets+0x10>
+ 2c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2cd:	5b                   	pop    %ebx
+ 2ce:	5e                   	pop    %esi
+ 2cf:	5f                   	pop    %edi
+ 2d0:	5d                   	pop    %ebp
+ 2d1:	c3                   	ret
+ 2d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	56                   	push   %esi
+ 2e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2e5:	83 ec 08             	sub    $0x8,%esp
+ 2e8:	6a 00                	push   $0x0
+ 2ea:	ff 75 08             	push   0x8(%ebp)
+ 2ed:	e8 f1 00 00 00       	call   3e3 <open>
+  if(fd < 0)
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	85 c0                	test   %eax,%eax
+ 2f7:	78 27                	js     320 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2f9:	83 ec 08             	sub    $0x8,%esp
+ 2fc:	ff 75 0c             	push   0xc(%ebp)
+ 2ff:	89 c3                	mov    %eax,%ebx
+ 301:	50                   	push   %eax
+ 302:	e8 f4 00 00 00       	call   3fb <fstat>
+  close(fd);
+ 307:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 30a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 30c:	e8 ba 00 00 00       	call   3cb <close>
+  return r;
+ 311:	83 c4 10             	add    $0x10,%esp
+}
+ 314:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 317:	89 f0                	mov    %esi,%eax
+ 319:	5b                   	pop    %ebx
+ 31a:	5e                   	pop    %esi
+ 31b:	5d                   	pop    %ebp
+ 31c:	c3                   	ret
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 320:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 325:	eb ed                	jmp    314 <stat+0x34>
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+
+00000330 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	53                   	push   %ebx
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 337:	0f be 02             	movsbl (%edx),%eax
+ 33a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 33d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 340:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 345:	77 1e                	ja     365 <atoi+0x35>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 350:	83 c2 01             	add    $0x1,%edx
+ 353:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 356:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 35a:	0f be 02             	movsbl (%edx),%eax
+ 35d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 360:	80 fb 09             	cmp    $0x9,%bl
+ 363:	76 eb                	jbe    350 <atoi+0x20>
+  return n;
+}
+ 365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 368:	89 c8                	mov    %ecx,%eax
+ 36a:	c9                   	leave
+ 36b:	c3                   	ret
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+ 375:	8b 45 10             	mov    0x10(%ebp),%eax
+ 378:	8b 55 08             	mov    0x8(%ebp),%edx
+ 37b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 37e:	85 c0                	test   %eax,%eax
+ 380:	7e 13                	jle    395 <memmove+0x25>
+ 382:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 384:	89 d7                	mov    %edx,%edi
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 390:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 391:	39 f8                	cmp    %edi,%eax
+ 393:	75 fb                	jne    390 <memmove+0x20>
+  return vdst;
+}
+ 395:	5e                   	pop    %esi
+ 396:	89 d0                	mov    %edx,%eax
+ 398:	5f                   	pop    %edi
+ 399:	5d                   	pop    %ebp
+ 39a:	c3                   	ret
+
+0000039b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 39b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <exit>:
+SYSCALL(exit)
+ 3a3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <wait>:
+SYSCALL(wait)
+ 3ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <pipe>:
+SYSCALL(pipe)
+ 3b3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <read>:
+SYSCALL(read)
+ 3bb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <write>:
+SYSCALL(write)
+ 3c3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <close>:
+SYSCALL(close)
+ 3cb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <kill>:
+SYSCALL(kill)
+ 3d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <exec>:
+SYSCALL(exec)
+ 3db:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <open>:
+SYSCALL(open)
+ 3e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <mknod>:
+SYSCALL(mknod)
+ 3eb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <unlink>:
+SYSCALL(unlink)
+ 3f3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <fstat>:
+SYSCALL(fstat)
+ 3fb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <link>:
+SYSCALL(link)
+ 403:	b8 13 00 00 00       	mov    $0x13,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <mkdir>:
+SYSCALL(mkdir)
+ 40b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <chdir>:
+SYSCALL(chdir)
+ 413:	b8 09 00 00 00       	mov    $0x9,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <dup>:
+SYSCALL(dup)
+ 41b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <getpid>:
+SYSCALL(getpid)
+ 423:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <sbrk>:
+SYSCALL(sbrk)
+ 42b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <sleep>:
+SYSCALL(sleep)
+ 433:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <uptime>:
+SYSCALL(uptime)
+ 43b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <getdate>:
+SYSCALL(getdate)
+ 443:	b8 16 00 00 00       	mov    $0x16,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <setdate>:
+SYSCALL(setdate)
+ 44b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <mount>:
+SYSCALL(mount)
+ 453:	b8 18 00 00 00       	mov    $0x18,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <unmount>:
+SYSCALL(unmount)
+ 45b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <lseek>:
+SYSCALL(lseek)
+ 463:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <mmap>:
+SYSCALL(mmap)
+ 46b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <munmap>:
+SYSCALL(munmap)
+ 473:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <clock_gettime>:
+SYSCALL(clock_gettime)
+ 47b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <nanosleep>:
+SYSCALL(nanosleep)
+ 483:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 48b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 493:	b8 20 00 00 00       	mov    $0x20,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <proclimit>:
+SYSCALL(proclimit)
+ 49b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <procinfo>:
+SYSCALL(procinfo)
+ 4a3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <cpuinfo>:
+SYSCALL(cpuinfo)
+ 4ab:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <schedstat>:
+SYSCALL(schedstat)
+ 4b3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <lockstat>:
+SYSCALL(lockstat)
+ 4bb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <bcachestat>:
+SYSCALL(bcachestat)
+ 4c3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <diskstat>:
+SYSCALL(diskstat)
+ 4cb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <iosched>:
+SYSCALL(iosched)
+ 4d3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
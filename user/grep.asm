@@ -0,0 +1,1804 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    }
+  }
+}
+
+int
+main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 7b                	jle    9c <main+0x9c>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit(1);
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit(1);
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 7f                	jmp    b6 <main+0xb6>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit(1);
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 ae 01 00 00       	call   200 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 c1 05 00 00       	call   61b <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 30                	jle    92 <main+0x92>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 c5 05 00 00       	call   633 <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 f8 0b 00 00       	push   $0xbf8
+  7f:	6a 01                	push   $0x1
+  81:	e8 4a 07 00 00       	call   7d0 <printf>
+      exit(1);
+  86:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8d:	e8 61 05 00 00       	call   5f3 <exit>
+  }
+  exit(0);
+  92:	83 ec 0c             	sub    $0xc,%esp
+  95:	6a 00                	push   $0x0
+  97:	e8 57 05 00 00       	call   5f3 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  9c:	51                   	push   %ecx
+  9d:	51                   	push   %ecx
+  9e:	68 d8 0b 00 00       	push   $0xbd8
+  a3:	6a 02                	push   $0x2
+  a5:	e8 26 07 00 00       	call   7d0 <printf>
+    exit(1);
+  aa:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  b1:	e8 3d 05 00 00       	call   5f3 <exit>
+    grep(pattern, 0);
+  b6:	52                   	push   %edx
+  b7:	52                   	push   %edx
+  b8:	6a 00                	push   $0x0
+  ba:	50                   	push   %eax
+  bb:	e8 40 01 00 00       	call   200 <grep>
+    exit(1);
+  c0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  c7:	e8 27 05 00 00       	call   5f3 <exit>
+  cc:	66 90                	xchg   %ax,%ax
+  ce:	66 90                	xchg   %ax,%ax
+
+000000d0 <matchhere>:
+  }while(*text++ != '\0');
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text) {
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	57                   	push   %edi
+  d4:	56                   	push   %esi
+  d5:	53                   	push   %ebx
+  d6:	83 ec 0c             	sub    $0xc,%esp
+  d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  df:	0f b6 0f             	movzbl (%edi),%ecx
+  e2:	84 c9                	test   %cl,%cl
+  e4:	0f 84 96 00 00 00    	je     180 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  ea:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  ee:	3c 2a                	cmp    $0x2a,%al
+  f0:	74 2d                	je     11f <matchhere+0x4f>
+  f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  f8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  fb:	80 f9 24             	cmp    $0x24,%cl
+  fe:	74 50                	je     150 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 100:	89 f2                	mov    %esi,%edx
+ 102:	84 d2                	test   %dl,%dl
+ 104:	74 6e                	je     174 <matchhere+0xa4>
+ 106:	80 f9 2e             	cmp    $0x2e,%cl
+ 109:	75 65                	jne    170 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+ 10b:	83 c3 01             	add    $0x1,%ebx
+ 10e:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 111:	84 c0                	test   %al,%al
+ 113:	74 6b                	je     180 <matchhere+0xb0>
+ 115:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 117:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 11b:	3c 2a                	cmp    $0x2a,%al
+ 11d:	75 d9                	jne    f8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 11f:	8d 77 02             	lea    0x2(%edi),%esi
+ 122:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text) {
+ 125:	8d 76 00             	lea    0x0(%esi),%esi
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 128:	83 ec 08             	sub    $0x8,%esp
+ 12b:	53                   	push   %ebx
+ 12c:	56                   	push   %esi
+ 12d:	e8 9e ff ff ff       	call   d0 <matchhere>
+ 132:	83 c4 10             	add    $0x10,%esp
+ 135:	85 c0                	test   %eax,%eax
+ 137:	75 47                	jne    180 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 139:	0f be 13             	movsbl (%ebx),%edx
+ 13c:	84 d2                	test   %dl,%dl
+ 13e:	74 45                	je     185 <matchhere+0xb5>
+ 140:	83 c3 01             	add    $0x1,%ebx
+ 143:	39 fa                	cmp    %edi,%edx
+ 145:	74 e1                	je     128 <matchhere+0x58>
+ 147:	83 ff 2e             	cmp    $0x2e,%edi
+ 14a:	74 dc                	je     128 <matchhere+0x58>
+ 14c:	eb 37                	jmp    185 <matchhere+0xb5>
+ 14e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 150:	84 c0                	test   %al,%al
+ 152:	74 39                	je     18d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 154:	89 f2                	mov    %esi,%edx
+ 156:	84 d2                	test   %dl,%dl
+ 158:	74 1a                	je     174 <matchhere+0xa4>
+ 15a:	80 fa 24             	cmp    $0x24,%dl
+ 15d:	75 15                	jne    174 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 15f:	83 c3 01             	add    $0x1,%ebx
+ 162:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 165:	89 c1                	mov    %eax,%ecx
+ 167:	eb ae                	jmp    117 <matchhere+0x47>
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 170:	38 ca                	cmp    %cl,%dl
+ 172:	74 97                	je     10b <matchhere+0x3b>
+}
+ 174:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 177:	31 c0                	xor    %eax,%eax
+}
+ 179:	5b                   	pop    %ebx
+ 17a:	5e                   	pop    %esi
+ 17b:	5f                   	pop    %edi
+ 17c:	5d                   	pop    %ebp
+ 17d:	c3                   	ret
+ 17e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 180:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 185:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 188:	5b                   	pop    %ebx
+ 189:	5e                   	pop    %esi
+ 18a:	5f                   	pop    %edi
+ 18b:	5d                   	pop    %ebp
+ 18c:	c3                   	ret
+    return *text == '\0';
+ 18d:	89 f0                	mov    %esi,%eax
+ 18f:	84 c0                	test   %al,%al
+ 191:	0f 94 c0             	sete   %al
+ 194:	0f b6 c0             	movzbl %al,%eax
+ 197:	eb ec                	jmp    185 <matchhere+0xb5>
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <match>:
+match(char *re, char *text) {
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	56                   	push   %esi
+ 1a4:	53                   	push   %ebx
+ 1a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1a8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 1ab:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 1ae:	75 11                	jne    1c1 <match+0x21>
+ 1b0:	eb 2e                	jmp    1e0 <match+0x40>
+ 1b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1b8:	83 c6 01             	add    $0x1,%esi
+ 1bb:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1bf:	74 16                	je     1d7 <match+0x37>
+    if(matchhere(re, text))
+ 1c1:	83 ec 08             	sub    $0x8,%esp
+ 1c4:	56                   	push   %esi
+ 1c5:	53                   	push   %ebx
+ 1c6:	e8 05 ff ff ff       	call   d0 <matchhere>
+ 1cb:	83 c4 10             	add    $0x10,%esp
+ 1ce:	85 c0                	test   %eax,%eax
+ 1d0:	74 e6                	je     1b8 <match+0x18>
+      return 1;
+ 1d2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1da:	5b                   	pop    %ebx
+ 1db:	5e                   	pop    %esi
+ 1dc:	5d                   	pop    %ebp
+ 1dd:	c3                   	ret
+ 1de:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1e0:	83 c3 01             	add    $0x1,%ebx
+ 1e3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1ec:	e9 df fe ff ff       	jmp    d0 <matchhere>
+ 1f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+
+00000200 <grep>:
+grep(char *pattern, int fd) {
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+  m = 0;
+ 204:	31 ff                	xor    %edi,%edi
+grep(char *pattern, int fd) {
+ 206:	56                   	push   %esi
+ 207:	53                   	push   %ebx
+ 208:	83 ec 1c             	sub    $0x1c,%esp
+ 20b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 20e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 211:	8d 43 01             	lea    0x1(%ebx),%eax
+ 214:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 220:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 223:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	29 c8                	sub    %ecx,%eax
+ 22d:	50                   	push   %eax
+ 22e:	8d 81 60 10 00 00    	lea    0x1060(%ecx),%eax
+ 234:	50                   	push   %eax
+ 235:	ff 75 0c             	push   0xc(%ebp)
+ 238:	e8 ce 03 00 00       	call   60b <read>
+ 23d:	83 c4 10             	add    $0x10,%esp
+ 240:	85 c0                	test   %eax,%eax
+ 242:	0f 8e fd 00 00 00    	jle    345 <grep+0x145>
+    m += n;
+ 248:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 24b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 24e:	bf 60 10 00 00       	mov    $0x1060,%edi
+ 253:	89 de                	mov    %ebx,%esi
+ 255:	c6 81 60 10 00 00 00 	movb   $0x0,0x1060(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 260:	83 ec 08             	sub    $0x8,%esp
+ 263:	6a 0a                	push   $0xa
+ 265:	57                   	push   %edi
+ 266:	e8 25 02 00 00       	call   490 <strchr>
+ 26b:	83 c4 10             	add    $0x10,%esp
+ 26e:	89 c2                	mov    %eax,%edx
+ 270:	85 c0                	test   %eax,%eax
+ 272:	0f 84 88 00 00 00    	je     300 <grep+0x100>
+      *q = 0;
+ 278:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 27b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 27e:	74 58                	je     2d8 <grep+0xd8>
+ 280:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 283:	89 d3                	mov    %edx,%ebx
+ 285:	eb 12                	jmp    299 <grep+0x99>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 290:	83 c7 01             	add    $0x1,%edi
+ 293:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 297:	74 37                	je     2d0 <grep+0xd0>
+    if(matchhere(re, text))
+ 299:	83 ec 08             	sub    $0x8,%esp
+ 29c:	57                   	push   %edi
+ 29d:	56                   	push   %esi
+ 29e:	e8 2d fe ff ff       	call   d0 <matchhere>
+ 2a3:	83 c4 10             	add    $0x10,%esp
+ 2a6:	85 c0                	test   %eax,%eax
+ 2a8:	74 e6                	je     290 <grep+0x90>
+        write(1, p, q+1 - p);
+ 2aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 2ad:	89 da                	mov    %ebx,%edx
+ 2af:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2b2:	89 d8                	mov    %ebx,%eax
+ 2b4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2b7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2ba:	29 f8                	sub    %edi,%eax
+ 2bc:	50                   	push   %eax
+ 2bd:	57                   	push   %edi
+ 2be:	89 df                	mov    %ebx,%edi
+ 2c0:	6a 01                	push   $0x1
+ 2c2:	e8 4c 03 00 00       	call   613 <write>
+ 2c7:	83 c4 10             	add    $0x10,%esp
+ 2ca:	eb 94                	jmp    260 <grep+0x60>
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2d0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2d3:	eb 8b                	jmp    260 <grep+0x60>
+ 2d5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2d8:	83 ec 08             	sub    $0x8,%esp
+ 2db:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2de:	57                   	push   %edi
+ 2df:	ff 75 dc             	push   -0x24(%ebp)
+ 2e2:	e8 e9 fd ff ff       	call   d0 <matchhere>
+        write(1, p, q+1 - p);
+ 2e7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2ea:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2ed:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2f0:	85 c0                	test   %eax,%eax
+ 2f2:	75 be                	jne    2b2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2f4:	89 df                	mov    %ebx,%edi
+ 2f6:	e9 65 ff ff ff       	jmp    260 <grep+0x60>
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+    if(p == buf)
+ 300:	89 f3                	mov    %esi,%ebx
+ 302:	81 ff 60 10 00 00    	cmp    $0x1060,%edi
+ 308:	74 2f                	je     339 <grep+0x139>
+    if(m > 0){
+ 30a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 30d:	85 c0                	test   %eax,%eax
+ 30f:	0f 8e 0b ff ff ff    	jle    220 <grep+0x20>
+      m -= p - buf;
+ 315:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 317:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 31a:	2d 60 10 00 00       	sub    $0x1060,%eax
+ 31f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 322:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 325:	51                   	push   %ecx
+ 326:	57                   	push   %edi
+ 327:	68 60 10 00 00       	push   $0x1060
+ 32c:	e8 8f 02 00 00       	call   5c0 <memmove>
+ 331:	83 c4 10             	add    $0x10,%esp
+ 334:	e9 e7 fe ff ff       	jmp    220 <grep+0x20>
+      m = 0;
+ 339:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 340:	e9 db fe ff ff       	jmp    220 <grep+0x20>
+}
+ 345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 348:	5b                   	pop    %ebx
+ 349:	5e                   	pop    %esi
+ 34a:	5f                   	pop    %edi
+ 34b:	5d                   	pop    %ebp
+ 34c:	c3                   	ret
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000350 <matchstar>:
+int matchstar(int c, char *re, char *text) {
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	53                   	push   %ebx
+ 356:	83 ec 0c             	sub    $0xc,%esp
+ 359:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 35c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 35f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 362:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 368:	83 ec 08             	sub    $0x8,%esp
+ 36b:	57                   	push   %edi
+ 36c:	56                   	push   %esi
+ 36d:	e8 5e fd ff ff       	call   d0 <matchhere>
+ 372:	83 c4 10             	add    $0x10,%esp
+ 375:	85 c0                	test   %eax,%eax
+ 377:	75 1f                	jne    398 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 379:	0f be 17             	movsbl (%edi),%edx
+ 37c:	84 d2                	test   %dl,%dl
+ 37e:	74 0c                	je     38c <matchstar+0x3c>
+ 380:	83 c7 01             	add    $0x1,%edi
+ 383:	39 da                	cmp    %ebx,%edx
+ 385:	74 e1                	je     368 <matchstar+0x18>
+ 387:	83 fb 2e             	cmp    $0x2e,%ebx
+ 38a:	74 dc                	je     368 <matchstar+0x18>
+}
+ 38c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 38f:	5b                   	pop    %ebx
+ 390:	5e                   	pop    %esi
+ 391:	5f                   	pop    %edi
+ 392:	5d                   	pop    %ebp
+ 393:	c3                   	ret
+ 394:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 398:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 39b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 3a0:	5b                   	pop    %ebx
+ 3a1:	5e                   	pop    %esi
+ 3a2:	5f                   	pop    %edi
+ 3a3:	5d                   	pop    %ebp
+ 3a4:	c3                   	ret
+ 3a5:	66 90                	xchg   %ax,%ax
+ 3a7:	66 90                	xchg   %ax,%ax
+ 3a9:	66 90                	xchg   %ax,%ax
+ 3ab:	66 90                	xchg   %ax,%ax
+ 3ad:	66 90                	xchg   %ax,%ax
+ 3af:	90                   	nop
+
+000003b0 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 3b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3b1:	31 c0                	xor    %eax,%eax
+{
+ 3b3:	89 e5                	mov    %esp,%ebp
+ 3b5:	53                   	push   %ebx
+ 3b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3c7:	83 c0 01             	add    $0x1,%eax
+ 3ca:	84 d2                	test   %dl,%dl
+ 3cc:	75 f2                	jne    3c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d1:	89 c8                	mov    %ecx,%eax
+ 3d3:	c9                   	leave
+ 3d4:	c3                   	ret
+ 3d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	53                   	push   %ebx
+ 3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3ea:	0f b6 02             	movzbl (%edx),%eax
+ 3ed:	84 c0                	test   %al,%al
+ 3ef:	75 17                	jne    408 <strcmp+0x28>
+ 3f1:	eb 3a                	jmp    42d <strcmp+0x4d>
+ 3f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3f7:	90                   	nop
+ 3f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3fc:	83 c2 01             	add    $0x1,%edx
+ 3ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 402:	84 c0                	test   %al,%al
+ 404:	74 1a                	je     420 <strcmp+0x40>
+    p++, q++;
+ 406:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 408:	0f b6 19             	movzbl (%ecx),%ebx
+ 40b:	38 c3                	cmp    %al,%bl
+ 40d:	74 e9                	je     3f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 40f:	29 d8                	sub    %ebx,%eax
+}
+ 411:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 414:	c9                   	leave
+ 415:	c3                   	ret
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 420:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 424:	31 c0                	xor    %eax,%eax
+ 426:	29 d8                	sub    %ebx,%eax
+}
+ 428:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 42b:	c9                   	leave
+ 42c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 42d:	0f b6 19             	movzbl (%ecx),%ebx
+ 430:	31 c0                	xor    %eax,%eax
+ 432:	eb db                	jmp    40f <strcmp+0x2f>
+ 434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+
+00000440 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 446:	80 3a 00             	cmpb   $0x0,(%edx)
+ 449:	74 15                	je     460 <strlen+0x20>
+ 44b:	31 c0                	xor    %eax,%eax
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+ 450:	83 c0 01             	add    $0x1,%eax
+ 453:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 457:	89 c1                	mov    %eax,%ecx
+ 459:	75 f5                	jne    450 <strlen+0x10>
+    ;
+  return n;
+}
+ 45b:	89 c8                	mov    %ecx,%eax
+ 45d:	5d                   	pop    %ebp
+ 45e:	c3                   	ret
+ 45f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 460:	31 c9                	xor    %ecx,%ecx
+}
+ 462:	5d                   	pop    %ebp
+ 463:	89 c8                	mov    %ecx,%eax
+ 465:	c3                   	ret
+ 466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000470 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	57                   	push   %edi
+ 474:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 477:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 47a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 47d:	89 d7                	mov    %edx,%edi
+ 47f:	fc                   	cld
+ 480:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 482:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 485:	89 d0                	mov    %edx,%eax
+ 487:	c9                   	leave
+ 488:	c3                   	ret
+ 489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	8b 45 08             	mov    0x8(%ebp),%eax
+ 496:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 49a:	0f b6 10             	movzbl (%eax),%edx
+ 49d:	84 d2                	test   %dl,%dl
+ 49f:	75 12                	jne    4b3 <strchr+0x23>
+ 4a1:	eb 1d                	jmp    4c0 <strchr+0x30>
+ 4a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4a7:	90                   	nop
+ 4a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4ac:	83 c0 01             	add    $0x1,%eax
+ 4af:	84 d2                	test   %dl,%dl
+ 4b1:	74 0d                	je     4c0 <strchr+0x30>
+    if(*s == c)
+ 4b3:	38 d1                	cmp    %dl,%cl
+ 4b5:	75 f1                	jne    4a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4b7:	5d                   	pop    %ebp
+ 4b8:	c3                   	ret
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4c0:	31 c0                	xor    %eax,%eax
+}
+ 4c2:	5d                   	pop    %ebp
+ 4c3:	c3                   	ret
+ 4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4d9:	31 db                	xor    %ebx,%ebx
+{
+ 4db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4de:	eb 27                	jmp    507 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4e0:	83 ec 04             	sub    $0x4,%esp
+ 4e3:	6a 01                	push   $0x1
+ 4e5:	56                   	push   %esi
+ 4e6:	6a 00                	push   $0x0
+ 4e8:	e8 1e 01 00 00       	call   60b <read>
+    if(cc < 1)
+ 4ed:	83 c4 10             	add    $0x10,%esp
+ 4f0:	85 c0                	test   %eax,%eax
+ 4f2:	7e 1d                	jle    511 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ff:	3c 0a                	cmp    $0xa,%al
+ 501:	74 10                	je     513 <gets+0x43>
+ 503:	3c 0d                	cmp    $0xd,%al
+ 505:	74 0c                	je     513 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 507:	89 df                	mov    %ebx,%edi
+ 509:	83 c3 01             	add    $0x1,%ebx
+ 50c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 50f:	7c cf                	jl     4e0 <gets+0x10>
+ 511:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 513:	8b 45 08             	mov    0x8(%ebp),%eax
+ 516:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 51a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51d:	5b                   	pop    %ebx
+ 51e:	5e                   	pop    %esi
+ 51f:	5f                   	pop    %edi
+ 520:	5d                   	pop    %ebp
+ 521:	c3                   	ret
+ 522:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 529:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	56                   	push   %esi
+ 534:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 535:	83 ec 08             	sub    $0x8,%esp
+ 538:	6a 00                	push   $0x0
+ 53a:	ff 75 08             	push   0x8(%ebp)
+ 53d:	e8 f1 00 00 00       	call   633 <open>
+  if(fd < 0)
+ 542:	83 c4 10             	add    $0x10,%esp
+ 545:	85 c0                	test   %eax,%eax
+ 547:	78 27                	js     570 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 549:	83 ec 08             	sub    $0x8,%esp
+ 54c:	ff 75 0c             	push   0xc(%ebp)
+ 54f:	89 c3                	mov    %eax,%ebx
+ 551:	50                   	push   %eax
+ 552:	e8 f4 00 00 00       	call   64b <fstat>
+  close(fd);
+ 557:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 55a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 55c:	e8 ba 00 00 00       	call   61b <close>
+  return r;
+ 561:	83 c4 10             	add    $0x10,%esp
+}
+ 564:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 567:	89 f0                	mov    %esi,%eax
+ 569:	5b                   	pop    %ebx
+ 56a:	5e                   	pop    %esi
+ 56b:	5d                   	pop    %ebp
+ 56c:	c3                   	ret
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 570:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 575:	eb ed                	jmp    564 <stat+0x34>
+ 577:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	53                   	push   %ebx
+ 584:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 587:	0f be 02             	movsbl (%edx),%eax
+ 58a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 58d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 590:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 595:	77 1e                	ja     5b5 <atoi+0x35>
+ 597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5a0:	83 c2 01             	add    $0x1,%edx
+ 5a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5aa:	0f be 02             	movsbl (%edx),%eax
+ 5ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5b0:	80 fb 09             	cmp    $0x9,%bl
+ 5b3:	76 eb                	jbe    5a0 <atoi+0x20>
+  return n;
+}
+ 5b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5b8:	89 c8                	mov    %ecx,%eax
+ 5ba:	c9                   	leave
+ 5bb:	c3                   	ret
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5ce:	85 c0                	test   %eax,%eax
+ 5d0:	7e 13                	jle    5e5 <memmove+0x25>
+ 5d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5d4:	89 d7                	mov    %edx,%edi
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5e1:	39 f8                	cmp    %edi,%eax
+ 5e3:	75 fb                	jne    5e0 <memmove+0x20>
+  return vdst;
+}
+ 5e5:	5e                   	pop    %esi
+ 5e6:	89 d0                	mov    %edx,%eax
+ 5e8:	5f                   	pop    %edi
+ 5e9:	5d                   	pop    %ebp
+ 5ea:	c3                   	ret
+
+000005eb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5eb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <exit>:
+SYSCALL(exit)
+ 5f3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <wait>:
+SYSCALL(wait)
+ 5fb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <pipe>:
+SYSCALL(pipe)
+ 603:	b8 04 00 00 00       	mov    $0x4,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <read>:
+SYSCALL(read)
+ 60b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <write>:
+SYSCALL(write)
+ 613:	b8 10 00 00 00       	mov    $0x10,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <close>:
+SYSCALL(close)
+ 61b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <kill>:
+SYSCALL(kill)
+ 623:	b8 06 00 00 00       	mov    $0x6,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <exec>:
+SYSCALL(exec)
+ 62b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <open>:
+SYSCALL(open)
+ 633:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <mknod>:
+SYSCALL(mknod)
+ 63b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <unlink>:
+SYSCALL(unlink)
+ 643:	b8 12 00 00 00       	mov    $0x12,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <fstat>:
+SYSCALL(fstat)
+ 64b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <link>:
+SYSCALL(link)
+ 653:	b8 13 00 00 00       	mov    $0x13,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <mkdir>:
+SYSCALL(mkdir)
+ 65b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <chdir>:
+SYSCALL(chdir)
+ 663:	b8 09 00 00 00       	mov    $0x9,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <dup>:
+SYSCALL(dup)
+ 66b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <getpid>:
+SYSCALL(getpid)
+ 673:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <sbrk>:
+SYSCALL(sbrk)
+ 67b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <sleep>:
+SYSCALL(sleep)
+ 683:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <uptime>:
+SYSCALL(uptime)
+ 68b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <getdate>:
+SYSCALL(getdate)
+ 693:	b8 16 00 00 00       	mov    $0x16,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <setdate>:
+SYSCALL(setdate)
+ 69b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <mount>:
+SYSCALL(mount)
+ 6a3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <unmount>:
+SYSCALL(unmount)
+ 6ab:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <lseek>:
+SYSCALL(lseek)
+ 6b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <mmap>:
+SYSCALL(mmap)
+ 6bb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <munmap>:
+SYSCALL(munmap)
+ 6c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <clock_gettime>:
+SYSCALL(clock_gettime)
+ 6cb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <nanosleep>:
+SYSCALL(nanosleep)
+ 6d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 6db:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 6e3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <proclimit>:
+SYSCALL(proclimit)
+ 6eb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <procinfo>:
+SYSCALL(procinfo)
+ 6f3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <cpuinfo>:
+SYSCALL(cpuinfo)
+ 6fb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <schedstat>:
+SYSCALL(schedstat)
+ 703:	b8 24 00 00 00       	mov    $0x24,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <lockstat>:
+SYSCALL(lockstat)
+ 70b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <bcachestat>:
+SYSCALL(bcachestat)
+ 713:	b8 26 00 00 00       	mov    $0x26,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <diskstat>:
+SYSCALL(diskstat)
+ 71b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <iosched>:
+SYSCALL(iosched)
+ 723:	b8 28 00 00 00       	mov    $0x28,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+ 72b:	66 90                	xchg   %ax,%ax
+ 72d:	66 90                	xchg   %ax,%ax
+ 72f:	90                   	nop
+
+00000730 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	53                   	push   %ebx
+ 736:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 738:	89 d1                	mov    %edx,%ecx
+{
+ 73a:	83 ec 3c             	sub    $0x3c,%esp
+ 73d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 740:	85 d2                	test   %edx,%edx
+ 742:	0f 89 80 00 00 00    	jns    7c8 <printint+0x98>
+ 748:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 74c:	74 7a                	je     7c8 <printint+0x98>
+    x = -xx;
+ 74e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 750:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 755:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 758:	31 f6                	xor    %esi,%esi
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 760:	89 c8                	mov    %ecx,%eax
+ 762:	31 d2                	xor    %edx,%edx
+ 764:	89 f7                	mov    %esi,%edi
+ 766:	f7 f3                	div    %ebx
+ 768:	8d 76 01             	lea    0x1(%esi),%esi
+ 76b:	0f b6 92 70 0c 00 00 	movzbl 0xc70(%edx),%edx
+ 772:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 776:	89 ca                	mov    %ecx,%edx
+ 778:	89 c1                	mov    %eax,%ecx
+ 77a:	39 da                	cmp    %ebx,%edx
+ 77c:	73 e2                	jae    760 <printint+0x30>
+  if(neg)
+ 77e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 781:	85 c0                	test   %eax,%eax
+ 783:	74 07                	je     78c <printint+0x5c>
+    buf[i++] = '-';
+ 785:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 78a:	89 f7                	mov    %esi,%edi
+ 78c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 78f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 792:	01 df                	add    %ebx,%edi
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 798:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 79b:	83 ec 04             	sub    $0x4,%esp
+ 79e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7a4:	6a 01                	push   $0x1
+ 7a6:	50                   	push   %eax
+ 7a7:	56                   	push   %esi
+ 7a8:	e8 66 fe ff ff       	call   613 <write>
+  while(--i >= 0)
+ 7ad:	89 f8                	mov    %edi,%eax
+ 7af:	83 c4 10             	add    $0x10,%esp
+ 7b2:	83 ef 01             	sub    $0x1,%edi
+ 7b5:	39 d8                	cmp    %ebx,%eax
+ 7b7:	75 df                	jne    798 <printint+0x68>
+}
+ 7b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7bc:	5b                   	pop    %ebx
+ 7bd:	5e                   	pop    %esi
+ 7be:	5f                   	pop    %edi
+ 7bf:	5d                   	pop    %ebp
+ 7c0:	c3                   	ret
+ 7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7c8:	31 c0                	xor    %eax,%eax
+ 7ca:	eb 89                	jmp    755 <printint+0x25>
+ 7cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+ 7dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7df:	0f b6 1e             	movzbl (%esi),%ebx
+ 7e2:	83 c6 01             	add    $0x1,%esi
+ 7e5:	84 db                	test   %bl,%bl
+ 7e7:	74 67                	je     850 <printf+0x80>
+ 7e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7ec:	31 d2                	xor    %edx,%edx
+ 7ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7f1:	eb 34                	jmp    827 <printf+0x57>
+ 7f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7f7:	90                   	nop
+ 7f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 800:	83 f8 25             	cmp    $0x25,%eax
+ 803:	74 18                	je     81d <printf+0x4d>
+  write(fd, &c, 1);
+ 805:	83 ec 04             	sub    $0x4,%esp
+ 808:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 80b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 80e:	6a 01                	push   $0x1
+ 810:	50                   	push   %eax
+ 811:	57                   	push   %edi
+ 812:	e8 fc fd ff ff       	call   613 <write>
+ 817:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 81a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 81d:	0f b6 1e             	movzbl (%esi),%ebx
+ 820:	83 c6 01             	add    $0x1,%esi
+ 823:	84 db                	test   %bl,%bl
+ 825:	74 29                	je     850 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 827:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 82a:	85 d2                	test   %edx,%edx
+ 82c:	74 ca                	je     7f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 82e:	83 fa 25             	cmp    $0x25,%edx
+ 831:	75 ea                	jne    81d <printf+0x4d>
+      if(c == 'd'){
+ 833:	83 f8 25             	cmp    $0x25,%eax
+ 836:	0f 84 24 01 00 00    	je     960 <printf+0x190>
+ 83c:	83 e8 63             	sub    $0x63,%eax
+ 83f:	83 f8 15             	cmp    $0x15,%eax
+ 842:	77 1c                	ja     860 <printf+0x90>
+ 844:	ff 24 85 18 0c 00 00 	jmp    *0xc18(,%eax,4)
+ 84b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 853:	5b                   	pop    %ebx
+ 854:	5e                   	pop    %esi
+ 855:	5f                   	pop    %edi
+ 856:	5d                   	pop    %ebp
+ 857:	c3                   	ret
+ 858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85f:	90                   	nop
+  write(fd, &c, 1);
+ 860:	83 ec 04             	sub    $0x4,%esp
+ 863:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 866:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 86a:	6a 01                	push   $0x1
+ 86c:	52                   	push   %edx
+ 86d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 870:	57                   	push   %edi
+ 871:	e8 9d fd ff ff       	call   613 <write>
+ 876:	83 c4 0c             	add    $0xc,%esp
+ 879:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 87c:	6a 01                	push   $0x1
+ 87e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 881:	52                   	push   %edx
+ 882:	57                   	push   %edi
+ 883:	e8 8b fd ff ff       	call   613 <write>
+        putc(fd, c);
+ 888:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 88b:	31 d2                	xor    %edx,%edx
+ 88d:	eb 8e                	jmp    81d <printf+0x4d>
+ 88f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 890:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 89b:	8b 13                	mov    (%ebx),%edx
+ 89d:	6a 00                	push   $0x0
+ 89f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8a4:	e8 87 fe ff ff       	call   730 <printint>
+        ap++;
+ 8a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8af:	31 d2                	xor    %edx,%edx
+ 8b1:	e9 67 ff ff ff       	jmp    81d <printf+0x4d>
+ 8b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8c5:	83 c0 04             	add    $0x4,%eax
+ 8c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8cb:	85 db                	test   %ebx,%ebx
+ 8cd:	0f 84 9d 00 00 00    	je     970 <printf+0x1a0>
+        while(*s != 0){
+ 8d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8d8:	84 c0                	test   %al,%al
+ 8da:	0f 84 3d ff ff ff    	je     81d <printf+0x4d>
+ 8e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8e6:	89 de                	mov    %ebx,%esi
+ 8e8:	89 d3                	mov    %edx,%ebx
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8f0:	83 ec 04             	sub    $0x4,%esp
+ 8f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8f9:	6a 01                	push   $0x1
+ 8fb:	53                   	push   %ebx
+ 8fc:	57                   	push   %edi
+ 8fd:	e8 11 fd ff ff       	call   613 <write>
+        while(*s != 0){
+ 902:	0f b6 06             	movzbl (%esi),%eax
+ 905:	83 c4 10             	add    $0x10,%esp
+ 908:	84 c0                	test   %al,%al
+ 90a:	75 e4                	jne    8f0 <printf+0x120>
+      state = 0;
+ 90c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 90f:	31 d2                	xor    %edx,%edx
+ 911:	e9 07 ff ff ff       	jmp    81d <printf+0x4d>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 920:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 923:	83 ec 0c             	sub    $0xc,%esp
+ 926:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 92b:	8b 13                	mov    (%ebx),%edx
+ 92d:	6a 01                	push   $0x1
+ 92f:	e9 6b ff ff ff       	jmp    89f <printf+0xcf>
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 938:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 941:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 943:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 946:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 949:	6a 01                	push   $0x1
+ 94b:	52                   	push   %edx
+ 94c:	57                   	push   %edi
+ 94d:	e8 c1 fc ff ff       	call   613 <write>
+        ap++;
+ 952:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 955:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 958:	31 d2                	xor    %edx,%edx
+ 95a:	e9 be fe ff ff       	jmp    81d <printf+0x4d>
+ 95f:	90                   	nop
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 966:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 969:	6a 01                	push   $0x1
+ 96b:	e9 11 ff ff ff       	jmp    881 <printf+0xb1>
+ 970:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 975:	bb 0e 0c 00 00       	mov    $0xc0e,%ebx
+ 97a:	e9 61 ff ff ff       	jmp    8e0 <printf+0x110>
+ 97f:	90                   	nop
+
+00000980 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	83 ec 20             	sub    $0x20,%esp
+ 989:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 98c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+ 98f:	57                   	push   %edi
+ 990:	68 15 0c 00 00       	push   $0xc15
+ 995:	53                   	push   %ebx
+ 996:	e8 35 fe ff ff       	call   7d0 <printf>
+  for(n = strlen(s); n < w; n++)
+ 99b:	89 3c 24             	mov    %edi,(%esp)
+ 99e:	e8 9d fa ff ff       	call   440 <strlen>
+ 9a3:	83 c4 10             	add    $0x10,%esp
+ 9a6:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 9a9:	7d 20                	jge    9cb <pads+0x4b>
+ 9ab:	89 c6                	mov    %eax,%esi
+ 9ad:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+ 9b7:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9ba:	6a 01                	push   $0x1
+ 9bc:	57                   	push   %edi
+ 9bd:	53                   	push   %ebx
+ 9be:	e8 50 fc ff ff       	call   613 <write>
+  for(n = strlen(s); n < w; n++)
+ 9c3:	83 c4 10             	add    $0x10,%esp
+ 9c6:	39 75 10             	cmp    %esi,0x10(%ebp)
+ 9c9:	75 e5                	jne    9b0 <pads+0x30>
+    putc(fd, ' ');
+}
+ 9cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9ce:	5b                   	pop    %ebx
+ 9cf:	5e                   	pop    %esi
+ 9d0:	5f                   	pop    %edi
+ 9d1:	5d                   	pop    %ebp
+ 9d2:	c3                   	ret
+ 9d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009e0 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+ 9e0:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+ 9e1:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+ 9e6:	89 e5                	mov    %esp,%ebp
+ 9e8:	57                   	push   %edi
+ 9e9:	56                   	push   %esi
+ 9ea:	53                   	push   %ebx
+  int n = 0;
+ 9eb:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+ 9ed:	83 ec 2c             	sub    $0x2c,%esp
+ 9f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9f3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 9f6:	8b 75 08             	mov    0x8(%ebp),%esi
+ 9f9:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 9fc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 9ff:	90                   	nop
+  }while((x /= 10) != 0);
+ a00:	89 d0                	mov    %edx,%eax
+ a02:	89 d7                	mov    %edx,%edi
+    n++;
+ a04:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+ a07:	f7 e1                	mul    %ecx
+ a09:	c1 ea 03             	shr    $0x3,%edx
+ a0c:	83 ff 09             	cmp    $0x9,%edi
+ a0f:	77 ef                	ja     a00 <padd+0x20>
+  for(; n < w; n++)
+ a11:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ a14:	39 c3                	cmp    %eax,%ebx
+ a16:	7d 23                	jge    a3b <padd+0x5b>
+ a18:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+  write(fd, &c, 1);
+ a20:	83 ec 04             	sub    $0x4,%esp
+ a23:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+ a27:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+ a2a:	6a 01                	push   $0x1
+ a2c:	57                   	push   %edi
+ a2d:	56                   	push   %esi
+ a2e:	e8 e0 fb ff ff       	call   613 <write>
+  for(; n < w; n++)
+ a33:	83 c4 10             	add    $0x10,%esp
+ a36:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+ a39:	75 e5                	jne    a20 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+ a3b:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+ a42:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+ a45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+ a48:	89 f0                	mov    %esi,%eax
+}
+ a4a:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+ a4b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+ a50:	5e                   	pop    %esi
+ a51:	5f                   	pop    %edi
+ a52:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+ a53:	e9 d8 fc ff ff       	jmp    730 <printint>
+ a58:	66 90                	xchg   %ax,%ax
+ a5a:	66 90                	xchg   %ax,%ax
+ a5c:	66 90                	xchg   %ax,%ax
+ a5e:	66 90                	xchg   %ax,%ax
+
+00000a60 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a61:	a1 60 14 00 00       	mov    0x1460,%eax
+{
+ a66:	89 e5                	mov    %esp,%ebp
+ a68:	57                   	push   %edi
+ a69:	56                   	push   %esi
+ a6a:	53                   	push   %ebx
+ a6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a6e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a78:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a7a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a7c:	39 ca                	cmp    %ecx,%edx
+ a7e:	73 30                	jae    ab0 <free+0x50>
+ a80:	39 c1                	cmp    %eax,%ecx
+ a82:	72 04                	jb     a88 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a84:	39 c2                	cmp    %eax,%edx
+ a86:	72 f0                	jb     a78 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a88:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a8b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a8e:	39 f8                	cmp    %edi,%eax
+ a90:	74 2e                	je     ac0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a92:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a95:	8b 42 04             	mov    0x4(%edx),%eax
+ a98:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a9b:	39 f1                	cmp    %esi,%ecx
+ a9d:	74 38                	je     ad7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a9f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ aa1:	5b                   	pop    %ebx
+  freep = p;
+ aa2:	89 15 60 14 00 00    	mov    %edx,0x1460
+}
+ aa8:	5e                   	pop    %esi
+ aa9:	5f                   	pop    %edi
+ aaa:	5d                   	pop    %ebp
+ aab:	c3                   	ret
+ aac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ab0:	39 c1                	cmp    %eax,%ecx
+ ab2:	72 d0                	jb     a84 <free+0x24>
+ ab4:	eb c2                	jmp    a78 <free+0x18>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ac0:	03 70 04             	add    0x4(%eax),%esi
+ ac3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ac6:	8b 02                	mov    (%edx),%eax
+ ac8:	8b 00                	mov    (%eax),%eax
+ aca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ acd:	8b 42 04             	mov    0x4(%edx),%eax
+ ad0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ad3:	39 f1                	cmp    %esi,%ecx
+ ad5:	75 c8                	jne    a9f <free+0x3f>
+    p->s.size += bp->s.size;
+ ad7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ ada:	89 15 60 14 00 00    	mov    %edx,0x1460
+    p->s.size += bp->s.size;
+ ae0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ae3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ae6:	89 0a                	mov    %ecx,(%edx)
+}
+ ae8:	5b                   	pop    %ebx
+ ae9:	5e                   	pop    %esi
+ aea:	5f                   	pop    %edi
+ aeb:	5d                   	pop    %ebp
+ aec:	c3                   	ret
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000af0 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+ af0:	55                   	push   %ebp
+ af1:	89 e5                	mov    %esp,%ebp
+ af3:	57                   	push   %edi
+ af4:	56                   	push   %esi
+ af5:	53                   	push   %ebx
+ af6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ af9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ afc:	8b 15 60 14 00 00    	mov    0x1460,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b02:	8d 78 07             	lea    0x7(%eax),%edi
+ b05:	c1 ef 03             	shr    $0x3,%edi
+ b08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b0b:	85 d2                	test   %edx,%edx
+ b0d:	0f 84 8d 00 00 00    	je     ba0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b15:	8b 48 04             	mov    0x4(%eax),%ecx
+ b18:	39 f9                	cmp    %edi,%ecx
+ b1a:	73 64                	jae    b80 <malloc+0x90>
+  if(nu < 4096)
+ b1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b21:	39 df                	cmp    %ebx,%edi
+ b23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b2d:	eb 0a                	jmp    b39 <malloc+0x49>
+ b2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b32:	8b 48 04             	mov    0x4(%eax),%ecx
+ b35:	39 f9                	cmp    %edi,%ecx
+ b37:	73 47                	jae    b80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b39:	89 c2                	mov    %eax,%edx
+ b3b:	39 05 60 14 00 00    	cmp    %eax,0x1460
+ b41:	75 ed                	jne    b30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b43:	83 ec 0c             	sub    $0xc,%esp
+ b46:	56                   	push   %esi
+ b47:	e8 2f fb ff ff       	call   67b <sbrk>
+  if(p == (char*)-1)
+ b4c:	83 c4 10             	add    $0x10,%esp
+ b4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b52:	74 1c                	je     b70 <malloc+0x80>
+  hp->s.size = nu;
+ b54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b57:	83 ec 0c             	sub    $0xc,%esp
+ b5a:	83 c0 08             	add    $0x8,%eax
+ b5d:	50                   	push   %eax
+ b5e:	e8 fd fe ff ff       	call   a60 <free>
+  return freep;
+ b63:	8b 15 60 14 00 00    	mov    0x1460,%edx
+      if((p = morecore(nunits)) == 0)
+ b69:	83 c4 10             	add    $0x10,%esp
+ b6c:	85 d2                	test   %edx,%edx
+ b6e:	75 c0                	jne    b30 <malloc+0x40>
+        return 0;
+  }
+}
+ b70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b73:	31 c0                	xor    %eax,%eax
+}
+ b75:	5b                   	pop    %ebx
+ b76:	5e                   	pop    %esi
+ b77:	5f                   	pop    %edi
+ b78:	5d                   	pop    %ebp
+ b79:	c3                   	ret
+ b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b80:	39 cf                	cmp    %ecx,%edi
+ b82:	74 4c                	je     bd0 <malloc+0xe0>
+        p->s.size -= nunits;
+ b84:	29 f9                	sub    %edi,%ecx
+ b86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b8f:	89 15 60 14 00 00    	mov    %edx,0x1460
+}
+ b95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b98:	83 c0 08             	add    $0x8,%eax
+}
+ b9b:	5b                   	pop    %ebx
+ b9c:	5e                   	pop    %esi
+ b9d:	5f                   	pop    %edi
+ b9e:	5d                   	pop    %ebp
+ b9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ba0:	c7 05 60 14 00 00 64 	movl   $0x1464,0x1460
+ ba7:	14 00 00 
+    base.s.size = 0;
+ baa:	b8 64 14 00 00       	mov    $0x1464,%eax
+    base.s.ptr = freep = prevp = &base;
+ baf:	c7 05 64 14 00 00 64 	movl   $0x1464,0x1464
+ bb6:	14 00 00 
+    base.s.size = 0;
+ bb9:	c7 05 68 14 00 00 00 	movl   $0x0,0x1468
+ bc0:	00 00 00 
+    if(p->s.size >= nunits){
+ bc3:	e9 54 ff ff ff       	jmp    b1c <malloc+0x2c>
+ bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bd0:	8b 08                	mov    (%eax),%ecx
+ bd2:	89 0a                	mov    %ecx,(%edx)
+ bd4:	eb b9                	jmp    b8f <malloc+0x9f>
@@ -0,0 +1,1518 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    mknod(deviceinit[i].name, deviceinit[i].majordn, deviceinit[i].minordn);
+  }
+}
+
+int
+main(void) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	31 db                	xor    %ebx,%ebx
+  12:	51                   	push   %ecx
+  13:	83 ec 18             	sub    $0x18,%esp
+  16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  1d:	8d 76 00             	lea    0x0(%esi),%esi
+    mknod(deviceinit[i].name, deviceinit[i].majordn, deviceinit[i].minordn);
+  20:	0f bf 83 2c 0e 00 00 	movswl 0xe2c(%ebx),%eax
+  27:	83 ec 04             	sub    $0x4,%esp
+  for(uint i = 3; i < NUMDISK + 3; ++i) {
+  2a:	83 c3 0c             	add    $0xc,%ebx
+    mknod(deviceinit[i].name, deviceinit[i].majordn, deviceinit[i].minordn);
+  2d:	50                   	push   %eax
+  2e:	0f bf 83 1c 0e 00 00 	movswl 0xe1c(%ebx),%eax
+  35:	50                   	push   %eax
+  36:	ff b3 18 0e 00 00    	push   0xe18(%ebx)
+  3c:	e8 0a 04 00 00       	call   44b <mknod>
+  for(uint i = 3; i < NUMDISK + 3; ++i) {
+  41:	83 c4 10             	add    $0x10,%esp
+  44:	83 fb 3c             	cmp    $0x3c,%ebx
+  47:	75 d7                	jne    20 <main+0x20>
+  int wpid, estatus;
+
+  idenodes();
+  
+  for(uint i = 0; i < (NUMDEV); ++i) {
+  49:	31 db                	xor    %ebx,%ebx
+    close(0);
+  4b:	83 ec 0c             	sub    $0xc,%esp
+  4e:	6a 00                	push   $0x0
+  50:	e8 d6 03 00 00       	call   42b <close>
+    close(1);
+  55:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  5c:	e8 ca 03 00 00       	call   42b <close>
+    close(2);
+  61:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  68:	e8 be 03 00 00       	call   42b <close>
+    if((pids[i] = fork()) < 0) {
+  6d:	e8 89 03 00 00       	call   3fb <fork>
+      printf(1, "init: fork failed\n");
+      exit(1);
+    } else if (pids[i] == 0) {
+  72:	83 c4 10             	add    $0x10,%esp
+    if((pids[i] = fork()) < 0) {
+  75:	89 04 9d 84 0e 00 00 	mov    %eax,0xe84(,%ebx,4)
+    } else if (pids[i] == 0) {
+  7c:	85 c0                	test   %eax,%eax
+  7e:	0f 84 a8 00 00 00    	je     12c <main+0x12c>
+  for(uint i = 0; i < (NUMDEV); ++i) {
+  84:	83 c3 01             	add    $0x1,%ebx
+  87:	83 fb 03             	cmp    $0x3,%ebx
+  8a:	75 bf                	jne    4b <main+0x4b>
+  8c:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  8f:	90                   	nop
+    }
+  }
+
+  /* Restart shell if any terminal exited */
+  for(;;) {
+    wpid = wait(&estatus);
+  90:	83 ec 0c             	sub    $0xc,%esp
+    for(uint i = 0; i < NUMDEV; ++i) {
+  93:	31 db                	xor    %ebx,%ebx
+    wpid = wait(&estatus);
+  95:	57                   	push   %edi
+  96:	e8 70 03 00 00       	call   40b <wait>
+      if(wpid == pids[i]) {
+  9b:	83 c4 10             	add    $0x10,%esp
+    wpid = wait(&estatus);
+  9e:	89 c6                	mov    %eax,%esi
+      if(wpid == pids[i]) {
+  a0:	39 34 9d 84 0e 00 00 	cmp    %esi,0xe84(,%ebx,4)
+  a7:	74 11                	je     ba <main+0xba>
+    for(uint i = 0; i < NUMDEV; ++i) {
+  a9:	83 c3 01             	add    $0x1,%ebx
+  ac:	83 fb 03             	cmp    $0x3,%ebx
+  af:	74 df                	je     90 <main+0x90>
+      if(wpid == pids[i]) {
+  b1:	39 34 9d 84 0e 00 00 	cmp    %esi,0xe84(,%ebx,4)
+  b8:	75 ef                	jne    a9 <main+0xa9>
+        if((pids[i] = fork()) < 0) {
+  ba:	e8 3c 03 00 00       	call   3fb <fork>
+  bf:	89 04 9d 84 0e 00 00 	mov    %eax,0xe84(,%ebx,4)
+          printf(1, "init: re-fork failed\n");
+          exit(1);
+        } else if (pids[i] == 0) {
+  c6:	85 c0                	test   %eax,%eax
+  c8:	75 df                	jne    a9 <main+0xa9>
+          opendev(i);
+  ca:	89 d8                	mov    %ebx,%eax
+  cc:	e8 8f 00 00 00       	call   160 <opendev>
+          dup(0);  // stdin
+  d1:	83 ec 0c             	sub    $0xc,%esp
+  d4:	6a 00                	push   $0x0
+  d6:	e8 a0 03 00 00       	call   47b <dup>
+          dup(1);  // stdout
+  db:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  e2:	e8 94 03 00 00       	call   47b <dup>
+          dup(2);  // stderr
+  e7:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  ee:	e8 88 03 00 00       	call   47b <dup>
+          printf(1, "init: re-starting sh\n");
+  f3:	5e                   	pop    %esi
+  f4:	5f                   	pop    %edi
+  f5:	68 0a 0a 00 00       	push   $0xa0a
+  fa:	6a 01                	push   $0x1
+  fc:	e8 df 04 00 00       	call   5e0 <printf>
+          exec("sh", argv);
+ 101:	58                   	pop    %eax
+ 102:	5a                   	pop    %edx
+ 103:	68 7c 0e 00 00       	push   $0xe7c
+ 108:	68 fb 09 00 00       	push   $0x9fb
+ 10d:	e8 29 03 00 00       	call   43b <exec>
+          printf(1, "sh exiting\n");
+ 112:	59                   	pop    %ecx
+ 113:	5b                   	pop    %ebx
+ 114:	68 fe 09 00 00       	push   $0x9fe
+ 119:	6a 01                	push   $0x1
+ 11b:	e8 c0 04 00 00       	call   5e0 <printf>
+          exit(1);
+ 120:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 127:	e8 d7 02 00 00       	call   403 <exit>
+      opendev(i);
+ 12c:	89 d8                	mov    %ebx,%eax
+ 12e:	e8 2d 00 00 00       	call   160 <opendev>
+      dup(0);  // stdin
+ 133:	83 ec 0c             	sub    $0xc,%esp
+ 136:	6a 00                	push   $0x0
+ 138:	e8 3e 03 00 00       	call   47b <dup>
+      dup(1);  // stdout
+ 13d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 144:	e8 32 03 00 00       	call   47b <dup>
+      dup(2);  // stderr
+ 149:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+ 150:	e8 26 03 00 00       	call   47b <dup>
+      printf(1, "init: starting sh\n");
+ 155:	58                   	pop    %eax
+ 156:	5a                   	pop    %edx
+ 157:	68 e8 09 00 00       	push   $0x9e8
+ 15c:	eb 9c                	jmp    fa <main+0xfa>
+ 15e:	66 90                	xchg   %ax,%ax
+
+00000160 <opendev>:
+opendev(uint dev) {
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	56                   	push   %esi
+ 164:	53                   	push   %ebx
+  if(open(deviceinit[dev].name, O_RDWR) < 0){
+ 165:	8d 1c 40             	lea    (%eax,%eax,2),%ebx
+ 168:	c1 e3 02             	shl    $0x2,%ebx
+ 16b:	83 ec 08             	sub    $0x8,%esp
+ 16e:	6a 02                	push   $0x2
+ 170:	ff b3 00 0e 00 00    	push   0xe00(%ebx)
+ 176:	e8 c8 02 00 00       	call   443 <open>
+ 17b:	83 c4 10             	add    $0x10,%esp
+ 17e:	85 c0                	test   %eax,%eax
+ 180:	78 07                	js     189 <opendev+0x29>
+}
+ 182:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 185:	5b                   	pop    %ebx
+ 186:	5e                   	pop    %esi
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+    mknod(deviceinit[dev].name, deviceinit[dev].majordn, deviceinit[dev].minordn);
+ 189:	50                   	push   %eax
+ 18a:	0f bf 83 08 0e 00 00 	movswl 0xe08(%ebx),%eax
+ 191:	50                   	push   %eax
+ 192:	0f bf 83 04 0e 00 00 	movswl 0xe04(%ebx),%eax
+ 199:	50                   	push   %eax
+ 19a:	ff b3 00 0e 00 00    	push   0xe00(%ebx)
+ 1a0:	e8 a6 02 00 00       	call   44b <mknod>
+    open(deviceinit[dev].name, O_RDWR);
+ 1a5:	5a                   	pop    %edx
+ 1a6:	59                   	pop    %ecx
+ 1a7:	6a 02                	push   $0x2
+ 1a9:	ff b3 00 0e 00 00    	push   0xe00(%ebx)
+ 1af:	e8 8f 02 00 00       	call   443 <open>
+}
+ 1b4:	83 c4 10             	add    $0x10,%esp
+ 1b7:	eb c9                	jmp    182 <opendev+0x22>
+ 1b9:	66 90                	xchg   %ax,%ax
+ 1bb:	66 90                	xchg   %ax,%ax
+ 1bd:	66 90                	xchg   %ax,%ax
+ 1bf:	90                   	nop
+
+000001c0 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1c1:	31 c0                	xor    %eax,%eax
+{
+ 1c3:	89 e5                	mov    %esp,%ebp
+ 1c5:	53                   	push   %ebx
+ 1c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1d7:	83 c0 01             	add    $0x1,%eax
+ 1da:	84 d2                	test   %dl,%dl
+ 1dc:	75 f2                	jne    1d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e1:	89 c8                	mov    %ecx,%eax
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+ 1e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1fa:	0f b6 02             	movzbl (%edx),%eax
+ 1fd:	84 c0                	test   %al,%al
+ 1ff:	75 17                	jne    218 <strcmp+0x28>
+ 201:	eb 3a                	jmp    23d <strcmp+0x4d>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 20c:	83 c2 01             	add    $0x1,%edx
+ 20f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 212:	84 c0                	test   %al,%al
+ 214:	74 1a                	je     230 <strcmp+0x40>
+    p++, q++;
+ 216:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 218:	0f b6 19             	movzbl (%ecx),%ebx
+ 21b:	38 c3                	cmp    %al,%bl
+ 21d:	74 e9                	je     208 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 21f:	29 d8                	sub    %ebx,%eax
+}
+ 221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 224:	c9                   	leave
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 230:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 234:	31 c0                	xor    %eax,%eax
+ 236:	29 d8                	sub    %ebx,%eax
+}
+ 238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 23b:	c9                   	leave
+ 23c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 23d:	0f b6 19             	movzbl (%ecx),%ebx
+ 240:	31 c0                	xor    %eax,%eax
+ 242:	eb db                	jmp    21f <strcmp+0x2f>
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 256:	80 3a 00             	cmpb   $0x0,(%edx)
+ 259:	74 15                	je     270 <strlen+0x20>
+ 25b:	31 c0                	xor    %eax,%eax
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+ 260:	83 c0 01             	add    $0x1,%eax
+ 263:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 267:	89 c1                	mov    %eax,%ecx
+ 269:	75 f5                	jne    260 <strlen+0x10>
+    ;
+  return n;
+}
+ 26b:	89 c8                	mov    %ecx,%eax
+ 26d:	5d                   	pop    %ebp
+ 26e:	c3                   	ret
+ 26f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 270:	31 c9                	xor    %ecx,%ecx
+}
+ 272:	5d                   	pop    %ebp
+ 273:	89 c8                	mov    %ecx,%eax
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000280 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 287:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 28a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28d:	89 d7                	mov    %edx,%edi
+ 28f:	fc                   	cld
+ 290:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 292:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 295:	89 d0                	mov    %edx,%eax
+ 297:	c9                   	leave
+ 298:	c3                   	ret
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2aa:	0f b6 10             	movzbl (%eax),%edx
+ 2ad:	84 d2                	test   %dl,%dl
+ 2af:	75 12                	jne    2c3 <strchr+0x23>
+ 2b1:	eb 1d                	jmp    2d0 <strchr+0x30>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2bc:	83 c0 01             	add    $0x1,%eax
+ 2bf:	84 d2                	test   %dl,%dl
+ 2c1:	74 0d                	je     2d0 <strchr+0x30>
+    if(*s == c)
+ 2c3:	38 d1                	cmp    %dl,%cl
+ 2c5:	75 f1                	jne    2b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2c7:	5d                   	pop    %ebp
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2d0:	31 c0                	xor    %eax,%eax
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	c3                   	ret
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2e9:	31 db                	xor    %ebx,%ebx
+{
+ 2eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ee:	eb 27                	jmp    317 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2f0:	83 ec 04             	sub    $0x4,%esp
+ 2f3:	6a 01                	push   $0x1
+ 2f5:	56                   	push   %esi
+ 2f6:	6a 00                	push   $0x0
+ 2f8:	e8 1e 01 00 00       	call   41b <read>
+    if(cc < 1)
+ 2fd:	83 c4 10             	add    $0x10,%esp
+ 300:	85 c0                	test   %eax,%eax
+ 302:	7e 1d                	jle    321 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 304:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 30f:	3c 0a                	cmp    $0xa,%al
+ 311:	74 10                	je     323 <gets+0x43>
+ 313:	3c 0d                	cmp    $0xd,%al
+ 315:	74 0c                	je     323 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 317:	89 df                	mov    %ebx,%edi
+ 319:	83 c3 01             	add    $0x1,%ebx
+ 31c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 31f:	7c cf                	jl     2f0 <gets+0x10>
+ 321:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 323:	8b 45 08             	mov    0x8(%ebp),%eax
+ 326:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 32a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 32d:	5b                   	pop    %ebx
+ 32e:	5e                   	pop    %esi
+ 32f:	5f                   	pop    %edi
+ 330:	5d                   	pop    %ebp
+ 331:	c3                   	ret
+ 332:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+ 344:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 345:	83 ec 08             	sub    $0x8,%esp
+ 348:	6a 00                	push   $0x0
+ 34a:	ff 75 08             	push   0x8(%ebp)
+ 34d:	e8 f1 00 00 00       	call   443 <open>
+  if(fd < 0)
+ 352:	83 c4 10             	add    $0x10,%esp
+ 355:	85 c0                	test   %eax,%eax
+ 357:	78 27                	js     380 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 359:	83 ec 08             	sub    $0x8,%esp
+ 35c:	ff 75 0c             	push   0xc(%ebp)
+ 35f:	89 c3                	mov    %eax,%ebx
+ 361:	50                   	push   %eax
+ 362:	e8 f4 00 00 00       	call   45b <fstat>
+  close(fd);
+ 367:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 36a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 36c:	e8 ba 00 00 00       	call   42b <close>
+  return r;
+ 371:	83 c4 10             	add    $0x10,%esp
+}
+ 374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 377:	89 f0                	mov    %esi,%eax
+ 379:	5b                   	pop    %ebx
+ 37a:	5e                   	pop    %esi
+ 37b:	5d                   	pop    %ebp
+ 37c:	c3                   	ret
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 380:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 385:	eb ed                	jmp    374 <stat+0x34>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 397:	0f be 02             	movsbl (%edx),%eax
+ 39a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 39d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3a5:	77 1e                	ja     3c5 <atoi+0x35>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3b0:	83 c2 01             	add    $0x1,%edx
+ 3b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ba:	0f be 02             	movsbl (%edx),%eax
+ 3bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3c0:	80 fb 09             	cmp    $0x9,%bl
+ 3c3:	76 eb                	jbe    3b0 <atoi+0x20>
+  return n;
+}
+ 3c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c8:	89 c8                	mov    %ecx,%eax
+ 3ca:	c9                   	leave
+ 3cb:	c3                   	ret
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3de:	85 c0                	test   %eax,%eax
+ 3e0:	7e 13                	jle    3f5 <memmove+0x25>
+ 3e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3e4:	89 d7                	mov    %edx,%edi
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3f1:	39 f8                	cmp    %edi,%eax
+ 3f3:	75 fb                	jne    3f0 <memmove+0x20>
+  return vdst;
+}
+ 3f5:	5e                   	pop    %esi
+ 3f6:	89 d0                	mov    %edx,%eax
+ 3f8:	5f                   	pop    %edi
+ 3f9:	5d                   	pop    %ebp
+ 3fa:	c3                   	ret
+
+000003fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <exit>:
+SYSCALL(exit)
+ 403:	b8 02 00 00 00       	mov    $0x2,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <wait>:
+SYSCALL(wait)
+ 40b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <pipe>:
+SYSCALL(pipe)
+ 413:	b8 04 00 00 00       	mov    $0x4,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <read>:
+SYSCALL(read)
+ 41b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <write>:
+SYSCALL(write)
+ 423:	b8 10 00 00 00       	mov    $0x10,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <close>:
+SYSCALL(close)
+ 42b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <kill>:
+SYSCALL(kill)
+ 433:	b8 06 00 00 00       	mov    $0x6,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <exec>:
+SYSCALL(exec)
+ 43b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <open>:
+SYSCALL(open)
+ 443:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mknod>:
+SYSCALL(mknod)
+ 44b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <unlink>:
+SYSCALL(unlink)
+ 453:	b8 12 00 00 00       	mov    $0x12,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <fstat>:
+SYSCALL(fstat)
+ 45b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <link>:
+SYSCALL(link)
+ 463:	b8 13 00 00 00       	mov    $0x13,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <mkdir>:
+SYSCALL(mkdir)
+ 46b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <chdir>:
+SYSCALL(chdir)
+ 473:	b8 09 00 00 00       	mov    $0x9,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <dup>:
+SYSCALL(dup)
+ 47b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getpid>:
+SYSCALL(getpid)
+ 483:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <sbrk>:
+SYSCALL(sbrk)
+ 48b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <sleep>:
+SYSCALL(sleep)
+ 493:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <uptime>:
+SYSCALL(uptime)
+ 49b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <getdate>:
+SYSCALL(getdate)
+ 4a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <setdate>:
+SYSCALL(setdate)
+ 4ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <mount>:
+SYSCALL(mount)
+ 4b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <unmount>:
+SYSCALL(unmount)
+ 4bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <lseek>:
+SYSCALL(lseek)
+ 4c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <mmap>:
+SYSCALL(mmap)
+ 4cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <munmap>:
+SYSCALL(munmap)
+ 4d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <clock_gettime>:
+SYSCALL(clock_gettime)
+ 4db:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <nanosleep>:
+SYSCALL(nanosleep)
+ 4e3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4eb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4f3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <proclimit>:
+SYSCALL(proclimit)
+ 4fb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <procinfo>:
+SYSCALL(procinfo)
+ 503:	b8 22 00 00 00       	mov    $0x22,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <cpuinfo>:
+SYSCALL(cpuinfo)
+ 50b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <schedstat>:
+SYSCALL(schedstat)
+ 513:	b8 24 00 00 00       	mov    $0x24,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <lockstat>:
+SYSCALL(lockstat)
+ 51b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <bcachestat>:
+SYSCALL(bcachestat)
+ 523:	b8 26 00 00 00       	mov    $0x26,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <diskstat>:
+SYSCALL(diskstat)
+ 52b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <iosched>:
+SYSCALL(iosched)
+ 533:	b8 28 00 00 00       	mov    $0x28,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+ 53b:	66 90                	xchg   %ax,%ax
+ 53d:	66 90                	xchg   %ax,%ax
+ 53f:	90                   	nop
+
+00000540 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	53                   	push   %ebx
+ 546:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 548:	89 d1                	mov    %edx,%ecx
+{
+ 54a:	83 ec 3c             	sub    $0x3c,%esp
+ 54d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 550:	85 d2                	test   %edx,%edx
+ 552:	0f 89 80 00 00 00    	jns    5d8 <printint+0x98>
+ 558:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 55c:	74 7a                	je     5d8 <printint+0x98>
+    x = -xx;
+ 55e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 560:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 565:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 568:	31 f6                	xor    %esi,%esi
+ 56a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 570:	89 c8                	mov    %ecx,%eax
+ 572:	31 d2                	xor    %edx,%edx
+ 574:	89 f7                	mov    %esi,%edi
+ 576:	f7 f3                	div    %ebx
+ 578:	8d 76 01             	lea    0x1(%esi),%esi
+ 57b:	0f b6 92 b4 0a 00 00 	movzbl 0xab4(%edx),%edx
+ 582:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 586:	89 ca                	mov    %ecx,%edx
+ 588:	89 c1                	mov    %eax,%ecx
+ 58a:	39 da                	cmp    %ebx,%edx
+ 58c:	73 e2                	jae    570 <printint+0x30>
+  if(neg)
+ 58e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 591:	85 c0                	test   %eax,%eax
+ 593:	74 07                	je     59c <printint+0x5c>
+    buf[i++] = '-';
+ 595:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 59a:	89 f7                	mov    %esi,%edi
+ 59c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 59f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5a2:	01 df                	add    %ebx,%edi
+ 5a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5ab:	83 ec 04             	sub    $0x4,%esp
+ 5ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5b4:	6a 01                	push   $0x1
+ 5b6:	50                   	push   %eax
+ 5b7:	56                   	push   %esi
+ 5b8:	e8 66 fe ff ff       	call   423 <write>
+  while(--i >= 0)
+ 5bd:	89 f8                	mov    %edi,%eax
+ 5bf:	83 c4 10             	add    $0x10,%esp
+ 5c2:	83 ef 01             	sub    $0x1,%edi
+ 5c5:	39 d8                	cmp    %ebx,%eax
+ 5c7:	75 df                	jne    5a8 <printint+0x68>
+}
+ 5c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5cc:	5b                   	pop    %ebx
+ 5cd:	5e                   	pop    %esi
+ 5ce:	5f                   	pop    %edi
+ 5cf:	5d                   	pop    %ebp
+ 5d0:	c3                   	ret
+ 5d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5d8:	31 c0                	xor    %eax,%eax
+ 5da:	eb 89                	jmp    565 <printint+0x25>
+ 5dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	53                   	push   %ebx
+ 5e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+ 5ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 5f2:	83 c6 01             	add    $0x1,%esi
+ 5f5:	84 db                	test   %bl,%bl
+ 5f7:	74 67                	je     660 <printf+0x80>
+ 5f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5fc:	31 d2                	xor    %edx,%edx
+ 5fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 601:	eb 34                	jmp    637 <printf+0x57>
+ 603:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 607:	90                   	nop
+ 608:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 60b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 610:	83 f8 25             	cmp    $0x25,%eax
+ 613:	74 18                	je     62d <printf+0x4d>
+  write(fd, &c, 1);
+ 615:	83 ec 04             	sub    $0x4,%esp
+ 618:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 61b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 61e:	6a 01                	push   $0x1
+ 620:	50                   	push   %eax
+ 621:	57                   	push   %edi
+ 622:	e8 fc fd ff ff       	call   423 <write>
+ 627:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 62a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 62d:	0f b6 1e             	movzbl (%esi),%ebx
+ 630:	83 c6 01             	add    $0x1,%esi
+ 633:	84 db                	test   %bl,%bl
+ 635:	74 29                	je     660 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 637:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 63a:	85 d2                	test   %edx,%edx
+ 63c:	74 ca                	je     608 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 63e:	83 fa 25             	cmp    $0x25,%edx
+ 641:	75 ea                	jne    62d <printf+0x4d>
+      if(c == 'd'){
+ 643:	83 f8 25             	cmp    $0x25,%eax
+ 646:	0f 84 24 01 00 00    	je     770 <printf+0x190>
+ 64c:	83 e8 63             	sub    $0x63,%eax
+ 64f:	83 f8 15             	cmp    $0x15,%eax
+ 652:	77 1c                	ja     670 <printf+0x90>
+ 654:	ff 24 85 5c 0a 00 00 	jmp    *0xa5c(,%eax,4)
+ 65b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 65f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 663:	5b                   	pop    %ebx
+ 664:	5e                   	pop    %esi
+ 665:	5f                   	pop    %edi
+ 666:	5d                   	pop    %ebp
+ 667:	c3                   	ret
+ 668:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+  write(fd, &c, 1);
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 676:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 67a:	6a 01                	push   $0x1
+ 67c:	52                   	push   %edx
+ 67d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 680:	57                   	push   %edi
+ 681:	e8 9d fd ff ff       	call   423 <write>
+ 686:	83 c4 0c             	add    $0xc,%esp
+ 689:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 68c:	6a 01                	push   $0x1
+ 68e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 691:	52                   	push   %edx
+ 692:	57                   	push   %edi
+ 693:	e8 8b fd ff ff       	call   423 <write>
+        putc(fd, c);
+ 698:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 69b:	31 d2                	xor    %edx,%edx
+ 69d:	eb 8e                	jmp    62d <printf+0x4d>
+ 69f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6a3:	83 ec 0c             	sub    $0xc,%esp
+ 6a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6ab:	8b 13                	mov    (%ebx),%edx
+ 6ad:	6a 00                	push   $0x0
+ 6af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6b4:	e8 87 fe ff ff       	call   540 <printint>
+        ap++;
+ 6b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6bf:	31 d2                	xor    %edx,%edx
+ 6c1:	e9 67 ff ff ff       	jmp    62d <printf+0x4d>
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6d5:	83 c0 04             	add    $0x4,%eax
+ 6d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6db:	85 db                	test   %ebx,%ebx
+ 6dd:	0f 84 9d 00 00 00    	je     780 <printf+0x1a0>
+        while(*s != 0){
+ 6e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6e8:	84 c0                	test   %al,%al
+ 6ea:	0f 84 3d ff ff ff    	je     62d <printf+0x4d>
+ 6f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6f6:	89 de                	mov    %ebx,%esi
+ 6f8:	89 d3                	mov    %edx,%ebx
+ 6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 700:	83 ec 04             	sub    $0x4,%esp
+ 703:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 706:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 709:	6a 01                	push   $0x1
+ 70b:	53                   	push   %ebx
+ 70c:	57                   	push   %edi
+ 70d:	e8 11 fd ff ff       	call   423 <write>
+        while(*s != 0){
+ 712:	0f b6 06             	movzbl (%esi),%eax
+ 715:	83 c4 10             	add    $0x10,%esp
+ 718:	84 c0                	test   %al,%al
+ 71a:	75 e4                	jne    700 <printf+0x120>
+      state = 0;
+ 71c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 71f:	31 d2                	xor    %edx,%edx
+ 721:	e9 07 ff ff ff       	jmp    62d <printf+0x4d>
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 730:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 73b:	8b 13                	mov    (%ebx),%edx
+ 73d:	6a 01                	push   $0x1
+ 73f:	e9 6b ff ff ff       	jmp    6af <printf+0xcf>
+ 744:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 748:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 74b:	83 ec 04             	sub    $0x4,%esp
+ 74e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 751:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 753:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 756:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 759:	6a 01                	push   $0x1
+ 75b:	52                   	push   %edx
+ 75c:	57                   	push   %edi
+ 75d:	e8 c1 fc ff ff       	call   423 <write>
+        ap++;
+ 762:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 765:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 768:	31 d2                	xor    %edx,%edx
+ 76a:	e9 be fe ff ff       	jmp    62d <printf+0x4d>
+ 76f:	90                   	nop
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 776:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 779:	6a 01                	push   $0x1
+ 77b:	e9 11 ff ff ff       	jmp    691 <printf+0xb1>
+ 780:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 785:	bb 50 0a 00 00       	mov    $0xa50,%ebx
+ 78a:	e9 61 ff ff ff       	jmp    6f0 <printf+0x110>
+ 78f:	90                   	nop
+
+00000790 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	53                   	push   %ebx
+ 796:	83 ec 20             	sub    $0x20,%esp
+ 799:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 79c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+ 79f:	57                   	push   %edi
+ 7a0:	68 57 0a 00 00       	push   $0xa57
+ 7a5:	53                   	push   %ebx
+ 7a6:	e8 35 fe ff ff       	call   5e0 <printf>
+  for(n = strlen(s); n < w; n++)
+ 7ab:	89 3c 24             	mov    %edi,(%esp)
+ 7ae:	e8 9d fa ff ff       	call   250 <strlen>
+ 7b3:	83 c4 10             	add    $0x10,%esp
+ 7b6:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 7b9:	7d 20                	jge    7db <pads+0x4b>
+ 7bb:	89 c6                	mov    %eax,%esi
+ 7bd:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+ 7c7:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7ca:	6a 01                	push   $0x1
+ 7cc:	57                   	push   %edi
+ 7cd:	53                   	push   %ebx
+ 7ce:	e8 50 fc ff ff       	call   423 <write>
+  for(n = strlen(s); n < w; n++)
+ 7d3:	83 c4 10             	add    $0x10,%esp
+ 7d6:	39 75 10             	cmp    %esi,0x10(%ebp)
+ 7d9:	75 e5                	jne    7c0 <pads+0x30>
+    putc(fd, ' ');
+}
+ 7db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7de:	5b                   	pop    %ebx
+ 7df:	5e                   	pop    %esi
+ 7e0:	5f                   	pop    %edi
+ 7e1:	5d                   	pop    %ebp
+ 7e2:	c3                   	ret
+ 7e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007f0 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+ 7f0:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+ 7f1:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+ 7f6:	89 e5                	mov    %esp,%ebp
+ 7f8:	57                   	push   %edi
+ 7f9:	56                   	push   %esi
+ 7fa:	53                   	push   %ebx
+  int n = 0;
+ 7fb:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+ 7fd:	83 ec 2c             	sub    $0x2c,%esp
+ 800:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 803:	8b 45 10             	mov    0x10(%ebp),%eax
+ 806:	8b 75 08             	mov    0x8(%ebp),%esi
+ 809:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 80c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 80f:	90                   	nop
+  }while((x /= 10) != 0);
+ 810:	89 d0                	mov    %edx,%eax
+ 812:	89 d7                	mov    %edx,%edi
+    n++;
+ 814:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+ 817:	f7 e1                	mul    %ecx
+ 819:	c1 ea 03             	shr    $0x3,%edx
+ 81c:	83 ff 09             	cmp    $0x9,%edi
+ 81f:	77 ef                	ja     810 <padd+0x20>
+  for(; n < w; n++)
+ 821:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 824:	39 c3                	cmp    %eax,%ebx
+ 826:	7d 23                	jge    84b <padd+0x5b>
+ 828:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 82b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 82f:	90                   	nop
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+ 837:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+ 83a:	6a 01                	push   $0x1
+ 83c:	57                   	push   %edi
+ 83d:	56                   	push   %esi
+ 83e:	e8 e0 fb ff ff       	call   423 <write>
+  for(; n < w; n++)
+ 843:	83 c4 10             	add    $0x10,%esp
+ 846:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+ 849:	75 e5                	jne    830 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+ 84b:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+ 852:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+ 855:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+ 858:	89 f0                	mov    %esi,%eax
+}
+ 85a:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+ 85b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+ 860:	5e                   	pop    %esi
+ 861:	5f                   	pop    %edi
+ 862:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+ 863:	e9 d8 fc ff ff       	jmp    540 <printint>
+ 868:	66 90                	xchg   %ax,%ax
+ 86a:	66 90                	xchg   %ax,%ax
+ 86c:	66 90                	xchg   %ax,%ax
+ 86e:	66 90                	xchg   %ax,%ax
+
+00000870 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 870:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 871:	a1 90 0e 00 00       	mov    0xe90,%eax
+{
+ 876:	89 e5                	mov    %esp,%ebp
+ 878:	57                   	push   %edi
+ 879:	56                   	push   %esi
+ 87a:	53                   	push   %ebx
+ 87b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 87e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 881:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 888:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 88a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 88c:	39 ca                	cmp    %ecx,%edx
+ 88e:	73 30                	jae    8c0 <free+0x50>
+ 890:	39 c1                	cmp    %eax,%ecx
+ 892:	72 04                	jb     898 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 894:	39 c2                	cmp    %eax,%edx
+ 896:	72 f0                	jb     888 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 898:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 89b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 89e:	39 f8                	cmp    %edi,%eax
+ 8a0:	74 2e                	je     8d0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8a2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8a5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8a8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8ab:	39 f1                	cmp    %esi,%ecx
+ 8ad:	74 38                	je     8e7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8af:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8b1:	5b                   	pop    %ebx
+  freep = p;
+ 8b2:	89 15 90 0e 00 00    	mov    %edx,0xe90
+}
+ 8b8:	5e                   	pop    %esi
+ 8b9:	5f                   	pop    %edi
+ 8ba:	5d                   	pop    %ebp
+ 8bb:	c3                   	ret
+ 8bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8c0:	39 c1                	cmp    %eax,%ecx
+ 8c2:	72 d0                	jb     894 <free+0x24>
+ 8c4:	eb c2                	jmp    888 <free+0x18>
+ 8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8d0:	03 70 04             	add    0x4(%eax),%esi
+ 8d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8d6:	8b 02                	mov    (%edx),%eax
+ 8d8:	8b 00                	mov    (%eax),%eax
+ 8da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8e3:	39 f1                	cmp    %esi,%ecx
+ 8e5:	75 c8                	jne    8af <free+0x3f>
+    p->s.size += bp->s.size;
+ 8e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8ea:	89 15 90 0e 00 00    	mov    %edx,0xe90
+    p->s.size += bp->s.size;
+ 8f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8f8:	5b                   	pop    %ebx
+ 8f9:	5e                   	pop    %esi
+ 8fa:	5f                   	pop    %edi
+ 8fb:	5d                   	pop    %ebp
+ 8fc:	c3                   	ret
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000900 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 909:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 90c:	8b 15 90 0e 00 00    	mov    0xe90,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 912:	8d 78 07             	lea    0x7(%eax),%edi
+ 915:	c1 ef 03             	shr    $0x3,%edi
+ 918:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 91b:	85 d2                	test   %edx,%edx
+ 91d:	0f 84 8d 00 00 00    	je     9b0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 923:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 925:	8b 48 04             	mov    0x4(%eax),%ecx
+ 928:	39 f9                	cmp    %edi,%ecx
+ 92a:	73 64                	jae    990 <malloc+0x90>
+  if(nu < 4096)
+ 92c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 931:	39 df                	cmp    %ebx,%edi
+ 933:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 936:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 93d:	eb 0a                	jmp    949 <malloc+0x49>
+ 93f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 940:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 942:	8b 48 04             	mov    0x4(%eax),%ecx
+ 945:	39 f9                	cmp    %edi,%ecx
+ 947:	73 47                	jae    990 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 949:	89 c2                	mov    %eax,%edx
+ 94b:	39 05 90 0e 00 00    	cmp    %eax,0xe90
+ 951:	75 ed                	jne    940 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 953:	83 ec 0c             	sub    $0xc,%esp
+ 956:	56                   	push   %esi
+ 957:	e8 2f fb ff ff       	call   48b <sbrk>
+  if(p == (char*)-1)
+ 95c:	83 c4 10             	add    $0x10,%esp
+ 95f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 962:	74 1c                	je     980 <malloc+0x80>
+  hp->s.size = nu;
+ 964:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 967:	83 ec 0c             	sub    $0xc,%esp
+ 96a:	83 c0 08             	add    $0x8,%eax
+ 96d:	50                   	push   %eax
+ 96e:	e8 fd fe ff ff       	call   870 <free>
+  return freep;
+ 973:	8b 15 90 0e 00 00    	mov    0xe90,%edx
+      if((p = morecore(nunits)) == 0)
+ 979:	83 c4 10             	add    $0x10,%esp
+ 97c:	85 d2                	test   %edx,%edx
+ 97e:	75 c0                	jne    940 <malloc+0x40>
+        return 0;
+  }
+}
+ 980:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 983:	31 c0                	xor    %eax,%eax
+}
+ 985:	5b                   	pop    %ebx
+ 986:	5e                   	pop    %esi
+ 987:	5f                   	pop    %edi
+ 988:	5d                   	pop    %ebp
+ 989:	c3                   	ret
+ 98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 990:	39 cf                	cmp    %ecx,%edi
+ 992:	74 4c                	je     9e0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 994:	29 f9                	sub    %edi,%ecx
+ 996:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 999:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 99c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 99f:	89 15 90 0e 00 00    	mov    %edx,0xe90
+}
+ 9a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9a8:	83 c0 08             	add    $0x8,%eax
+}
+ 9ab:	5b                   	pop    %ebx
+ 9ac:	5e                   	pop    %esi
+ 9ad:	5f                   	pop    %edi
+ 9ae:	5d                   	pop    %ebp
+ 9af:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9b0:	c7 05 90 0e 00 00 94 	movl   $0xe94,0xe90
+ 9b7:	0e 00 00 
+    base.s.size = 0;
+ 9ba:	b8 94 0e 00 00       	mov    $0xe94,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9bf:	c7 05 94 0e 00 00 94 	movl   $0xe94,0xe94
+ 9c6:	0e 00 00 
+    base.s.size = 0;
+ 9c9:	c7 05 98 0e 00 00 00 	movl   $0x0,0xe98
+ 9d0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9d3:	e9 54 ff ff ff       	jmp    92c <malloc+0x2c>
+ 9d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9e0:	8b 08                	mov    (%eax),%ecx
+ 9e2:	89 0a                	mov    %ecx,(%edx)
+ 9e4:	eb b9                	jmp    99f <malloc+0x9f>
@@ -9,7 +9,7 @@
 #include "kernel/file.h"
 #include "user.h"
 #define NUMDEV  3
-#define NUMDISK 4
+#define NUMDISK 5
 
 char *argv[] = { "sh", 0 };
 uint pids[NUMDEV];  // Array of child PIDs
@@ -22,7 +22,8 @@ struct deviceinit deviceinit[NDEV] = {
   { .name = "disk0", .majordn = 3, .minordn = 0 },
   { .name = "disk1", .majordn = 3, .minordn = 1 },
   { .name = "disk2", .majordn = 3, .minordn = 2 },
-  { .name = "disk3", .majordn = 3, .minordn = 3 }
+  { .name = "disk3", .majordn = 3, .minordn = 3 },
+  { .name = "disk4", .majordn = 3, .minordn = 4 }   // virtio
 };
 
 static void
@@ -0,0 +1,1504 @@
+
+_iostat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "kernel/param.h"
+#include "kernel/iostat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  static struct diskstat st[NDISK];
+  int n, i;
+
+  if(argc == 3 && strcmp(argv[1], "-s") == 0) {
+  19:	83 f8 03             	cmp    $0x3,%eax
+  1c:	0f 84 fb 00 00 00    	je     11d <main+0x11d>
+    if(iosched(argv[2]) < 0) {
+      printf(2, "iostat: no I/O scheduler %s\n", argv[2]);
+      exit(1);
+    }
+  } else if(argc != 1) {
+  22:	83 f8 01             	cmp    $0x1,%eax
+  25:	0f 85 08 01 00 00    	jne    133 <main+0x133>
+    printf(2, "usage: iostat [-s fifo|cscan|deadline]\n");
+    exit(1);
+  }
+
+  if((n = diskstat(st, NDISK)) < 0) {
+  2b:	50                   	push   %eax
+  2c:	50                   	push   %eax
+  2d:	6a 06                	push   $0x6
+  2f:	68 e0 0d 00 00       	push   $0xde0
+  34:	e8 d2 04 00 00       	call   50b <diskstat>
+  39:	83 c4 10             	add    $0x10,%esp
+  3c:	89 c7                	mov    %eax,%edi
+  3e:	85 c0                	test   %eax,%eax
+  40:	0f 88 07 01 00 00    	js     14d <main+0x14d>
+    printf(2, "iostat: cannot read disk statistics\n");
+    exit(1);
+  }
+  printf(1, "DEV SCHED     DEPTH MAXDEPTH     REQS     CMDS  AVG(us)  MAX(us)\n");
+  46:	50                   	push   %eax
+  47:	50                   	push   %eax
+  48:	68 3c 0a 00 00       	push   $0xa3c
+  4d:	6a 01                	push   $0x1
+  4f:	e8 6c 05 00 00       	call   5c0 <printf>
+  for(i = 0; i < n; ++i) {
+  54:	83 c4 10             	add    $0x10,%esp
+  57:	85 ff                	test   %edi,%edi
+  59:	0f 84 b4 00 00 00    	je     113 <main+0x113>
+  5f:	bb e4 0d 00 00       	mov    $0xde4,%ebx
+  64:	31 f6                	xor    %esi,%esi
+  66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6d:	8d 76 00             	lea    0x0(%esi),%esi
+    padd(1, st[i].dev, 3);
+  70:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < n; ++i) {
+  73:	83 c6 01             	add    $0x1,%esi
+    padd(1, st[i].dev, 3);
+  76:	6a 03                	push   $0x3
+  78:	ff 73 fc             	push   -0x4(%ebx)
+  7b:	6a 01                	push   $0x1
+  7d:	e8 4e 07 00 00       	call   7d0 <padd>
+    printf(1, " ");
+  82:	58                   	pop    %eax
+  83:	5a                   	pop    %edx
+  84:	68 e8 09 00 00       	push   $0x9e8
+  89:	6a 01                	push   $0x1
+  8b:	e8 30 05 00 00       	call   5c0 <printf>
+    pads(1, st[i].sched, 9);
+  90:	83 c4 0c             	add    $0xc,%esp
+  93:	6a 09                	push   $0x9
+  95:	53                   	push   %ebx
+  for(i = 0; i < n; ++i) {
+  96:	83 c3 2c             	add    $0x2c,%ebx
+    pads(1, st[i].sched, 9);
+  99:	6a 01                	push   $0x1
+  9b:	e8 d0 06 00 00       	call   770 <pads>
+    padd(1, st[i].depth, 6);
+  a0:	83 c4 0c             	add    $0xc,%esp
+  a3:	6a 06                	push   $0x6
+  a5:	ff 73 e4             	push   -0x1c(%ebx)
+  a8:	6a 01                	push   $0x1
+  aa:	e8 21 07 00 00       	call   7d0 <padd>
+    padd(1, st[i].maxdepth, 9);
+  af:	83 c4 0c             	add    $0xc,%esp
+  b2:	6a 09                	push   $0x9
+  b4:	ff 73 e8             	push   -0x18(%ebx)
+  b7:	6a 01                	push   $0x1
+  b9:	e8 12 07 00 00       	call   7d0 <padd>
+    padd(1, st[i].nreq, 9);
+  be:	83 c4 0c             	add    $0xc,%esp
+  c1:	6a 09                	push   $0x9
+  c3:	ff 73 ec             	push   -0x14(%ebx)
+  c6:	6a 01                	push   $0x1
+  c8:	e8 03 07 00 00       	call   7d0 <padd>
+    padd(1, st[i].ncmd, 9);
+  cd:	83 c4 0c             	add    $0xc,%esp
+  d0:	6a 09                	push   $0x9
+  d2:	ff 73 f0             	push   -0x10(%ebx)
+  d5:	6a 01                	push   $0x1
+  d7:	e8 f4 06 00 00       	call   7d0 <padd>
+    padd(1, st[i].avgus, 9);
+  dc:	83 c4 0c             	add    $0xc,%esp
+  df:	6a 09                	push   $0x9
+  e1:	ff 73 f4             	push   -0xc(%ebx)
+  e4:	6a 01                	push   $0x1
+  e6:	e8 e5 06 00 00       	call   7d0 <padd>
+    padd(1, st[i].maxus, 9);
+  eb:	83 c4 0c             	add    $0xc,%esp
+  ee:	6a 09                	push   $0x9
+  f0:	ff 73 f8             	push   -0x8(%ebx)
+  f3:	6a 01                	push   $0x1
+  f5:	e8 d6 06 00 00       	call   7d0 <padd>
+    printf(1, "\n");
+  fa:	59                   	pop    %ecx
+  fb:	58                   	pop    %eax
+  fc:	68 e6 09 00 00       	push   $0x9e6
+ 101:	6a 01                	push   $0x1
+ 103:	e8 b8 04 00 00       	call   5c0 <printf>
+  for(i = 0; i < n; ++i) {
+ 108:	83 c4 10             	add    $0x10,%esp
+ 10b:	39 f7                	cmp    %esi,%edi
+ 10d:	0f 85 5d ff ff ff    	jne    70 <main+0x70>
+  }
+  exit(0);
+ 113:	83 ec 0c             	sub    $0xc,%esp
+ 116:	6a 00                	push   $0x0
+ 118:	e8 c6 02 00 00       	call   3e3 <exit>
+  if(argc == 3 && strcmp(argv[1], "-s") == 0) {
+ 11d:	51                   	push   %ecx
+ 11e:	51                   	push   %ecx
+ 11f:	68 c8 09 00 00       	push   $0x9c8
+ 124:	ff 73 04             	push   0x4(%ebx)
+ 127:	e8 a4 00 00 00       	call   1d0 <strcmp>
+ 12c:	83 c4 10             	add    $0x10,%esp
+ 12f:	85 c0                	test   %eax,%eax
+ 131:	74 34                	je     167 <main+0x167>
+    printf(2, "usage: iostat [-s fifo|cscan|deadline]\n");
+ 133:	52                   	push   %edx
+ 134:	52                   	push   %edx
+ 135:	68 ec 09 00 00       	push   $0x9ec
+ 13a:	6a 02                	push   $0x2
+ 13c:	e8 7f 04 00 00       	call   5c0 <printf>
+    exit(1);
+ 141:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 148:	e8 96 02 00 00       	call   3e3 <exit>
+    printf(2, "iostat: cannot read disk statistics\n");
+ 14d:	50                   	push   %eax
+ 14e:	50                   	push   %eax
+ 14f:	68 14 0a 00 00       	push   $0xa14
+ 154:	6a 02                	push   $0x2
+ 156:	e8 65 04 00 00       	call   5c0 <printf>
+    exit(1);
+ 15b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 162:	e8 7c 02 00 00       	call   3e3 <exit>
+    if(iosched(argv[2]) < 0) {
+ 167:	83 ec 0c             	sub    $0xc,%esp
+ 16a:	ff 73 08             	push   0x8(%ebx)
+ 16d:	e8 a1 03 00 00       	call   513 <iosched>
+ 172:	83 c4 10             	add    $0x10,%esp
+ 175:	85 c0                	test   %eax,%eax
+ 177:	0f 89 ae fe ff ff    	jns    2b <main+0x2b>
+      printf(2, "iostat: no I/O scheduler %s\n", argv[2]);
+ 17d:	50                   	push   %eax
+ 17e:	ff 73 08             	push   0x8(%ebx)
+ 181:	68 cb 09 00 00       	push   $0x9cb
+ 186:	6a 02                	push   $0x2
+ 188:	e8 33 04 00 00       	call   5c0 <printf>
+      exit(1);
+ 18d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 194:	e8 4a 02 00 00       	call   3e3 <exit>
+ 199:	66 90                	xchg   %ax,%ax
+ 19b:	66 90                	xchg   %ax,%ax
+ 19d:	66 90                	xchg   %ax,%ax
+ 19f:	90                   	nop
+
+000001a0 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1a1:	31 c0                	xor    %eax,%eax
+{
+ 1a3:	89 e5                	mov    %esp,%ebp
+ 1a5:	53                   	push   %ebx
+ 1a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1b7:	83 c0 01             	add    $0x1,%eax
+ 1ba:	84 d2                	test   %dl,%dl
+ 1bc:	75 f2                	jne    1b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1c1:	89 c8                	mov    %ecx,%eax
+ 1c3:	c9                   	leave
+ 1c4:	c3                   	ret
+ 1c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	53                   	push   %ebx
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1da:	0f b6 02             	movzbl (%edx),%eax
+ 1dd:	84 c0                	test   %al,%al
+ 1df:	75 17                	jne    1f8 <strcmp+0x28>
+ 1e1:	eb 3a                	jmp    21d <strcmp+0x4d>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1ec:	83 c2 01             	add    $0x1,%edx
+ 1ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1f2:	84 c0                	test   %al,%al
+ 1f4:	74 1a                	je     210 <strcmp+0x40>
+    p++, q++;
+ 1f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1fb:	38 c3                	cmp    %al,%bl
+ 1fd:	74 e9                	je     1e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1ff:	29 d8                	sub    %ebx,%eax
+}
+ 201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 204:	c9                   	leave
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 210:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 214:	31 c0                	xor    %eax,%eax
+ 216:	29 d8                	sub    %ebx,%eax
+}
+ 218:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 21b:	c9                   	leave
+ 21c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 21d:	0f b6 19             	movzbl (%ecx),%ebx
+ 220:	31 c0                	xor    %eax,%eax
+ 222:	eb db                	jmp    1ff <strcmp+0x2f>
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 236:	80 3a 00             	cmpb   $0x0,(%edx)
+ 239:	74 15                	je     250 <strlen+0x20>
+ 23b:	31 c0                	xor    %eax,%eax
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+ 240:	83 c0 01             	add    $0x1,%eax
+ 243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 247:	89 c1                	mov    %eax,%ecx
+ 249:	75 f5                	jne    240 <strlen+0x10>
+    ;
+  return n;
+}
+ 24b:	89 c8                	mov    %ecx,%eax
+ 24d:	5d                   	pop    %ebp
+ 24e:	c3                   	ret
+ 24f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 250:	31 c9                	xor    %ecx,%ecx
+}
+ 252:	5d                   	pop    %ebp
+ 253:	89 c8                	mov    %ecx,%eax
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000260 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	57                   	push   %edi
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 267:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 26a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 26d:	89 d7                	mov    %edx,%edi
+ 26f:	fc                   	cld
+ 270:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 272:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 275:	89 d0                	mov    %edx,%eax
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+ 279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 28a:	0f b6 10             	movzbl (%eax),%edx
+ 28d:	84 d2                	test   %dl,%dl
+ 28f:	75 12                	jne    2a3 <strchr+0x23>
+ 291:	eb 1d                	jmp    2b0 <strchr+0x30>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 29c:	83 c0 01             	add    $0x1,%eax
+ 29f:	84 d2                	test   %dl,%dl
+ 2a1:	74 0d                	je     2b0 <strchr+0x30>
+    if(*s == c)
+ 2a3:	38 d1                	cmp    %dl,%cl
+ 2a5:	75 f1                	jne    298 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2a7:	5d                   	pop    %ebp
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2b0:	31 c0                	xor    %eax,%eax
+}
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	c3                   	ret
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2c9:	31 db                	xor    %ebx,%ebx
+{
+ 2cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ce:	eb 27                	jmp    2f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2d0:	83 ec 04             	sub    $0x4,%esp
+ 2d3:	6a 01                	push   $0x1
+ 2d5:	56                   	push   %esi
+ 2d6:	6a 00                	push   $0x0
+ 2d8:	e8 1e 01 00 00       	call   3fb <read>
+    if(cc < 1)
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	7e 1d                	jle    301 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2ef:	3c 0a                	cmp    $0xa,%al
+ 2f1:	74 10                	je     303 <gets+0x43>
+ 2f3:	3c 0d                	cmp    $0xd,%al
+ 2f5:	74 0c                	je     303 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2f7:	89 df                	mov    %ebx,%edi
+ 2f9:	83 c3 01             	add    $0x1,%ebx
+ 2fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2ff:	7c cf                	jl     2d0 <gets+0x10>
+ 301:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 30a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 30d:	5b                   	pop    %ebx
+ 30e:	5e                   	pop    %esi
+ 30f:	5f                   	pop    %edi
+ 310:	5d                   	pop    %ebp
+ 311:	c3                   	ret
+ 312:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 319:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	56                   	push   %esi
+ 324:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 325:	83 ec 08             	sub    $0x8,%esp
+ 328:	6a 00                	push   $0x0
+ 32a:	ff 75 08             	push   0x8(%ebp)
+ 32d:	e8 f1 00 00 00       	call   423 <open>
+  if(fd < 0)
+ 332:	83 c4 10             	add    $0x10,%esp
+ 335:	85 c0                	test   %eax,%eax
+ 337:	78 27                	js     360 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 339:	83 ec 08             	sub    $0x8,%esp
+ 33c:	ff 75 0c             	push   0xc(%ebp)
+ 33f:	89 c3                	mov    %eax,%ebx
+ 341:	50                   	push   %eax
+ 342:	e8 f4 00 00 00       	call   43b <fstat>
+  close(fd);
+ 347:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 34a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 34c:	e8 ba 00 00 00       	call   40b <close>
+  return r;
+ 351:	83 c4 10             	add    $0x10,%esp
+}
+ 354:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 357:	89 f0                	mov    %esi,%eax
+ 359:	5b                   	pop    %ebx
+ 35a:	5e                   	pop    %esi
+ 35b:	5d                   	pop    %ebp
+ 35c:	c3                   	ret
+ 35d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 360:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 365:	eb ed                	jmp    354 <stat+0x34>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 377:	0f be 02             	movsbl (%edx),%eax
+ 37a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 37d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 380:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 385:	77 1e                	ja     3a5 <atoi+0x35>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 390:	83 c2 01             	add    $0x1,%edx
+ 393:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 396:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 39a:	0f be 02             	movsbl (%edx),%eax
+ 39d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3a0:	80 fb 09             	cmp    $0x9,%bl
+ 3a3:	76 eb                	jbe    390 <atoi+0x20>
+  return n;
+}
+ 3a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a8:	89 c8                	mov    %ecx,%eax
+ 3aa:	c9                   	leave
+ 3ab:	c3                   	ret
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	57                   	push   %edi
+ 3b4:	56                   	push   %esi
+ 3b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3be:	85 c0                	test   %eax,%eax
+ 3c0:	7e 13                	jle    3d5 <memmove+0x25>
+ 3c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3c4:	89 d7                	mov    %edx,%edi
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3d1:	39 f8                	cmp    %edi,%eax
+ 3d3:	75 fb                	jne    3d0 <memmove+0x20>
+  return vdst;
+}
+ 3d5:	5e                   	pop    %esi
+ 3d6:	89 d0                	mov    %edx,%eax
+ 3d8:	5f                   	pop    %edi
+ 3d9:	5d                   	pop    %ebp
+ 3da:	c3                   	ret
+
+000003db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <exit>:
+SYSCALL(exit)
+ 3e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <wait>:
+SYSCALL(wait)
+ 3eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <pipe>:
+SYSCALL(pipe)
+ 3f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <read>:
+SYSCALL(read)
+ 3fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <write>:
+SYSCALL(write)
+ 403:	b8 10 00 00 00       	mov    $0x10,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <close>:
+SYSCALL(close)
+ 40b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <kill>:
+SYSCALL(kill)
+ 413:	b8 06 00 00 00       	mov    $0x6,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <exec>:
+SYSCALL(exec)
+ 41b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <open>:
+SYSCALL(open)
+ 423:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <mknod>:
+SYSCALL(mknod)
+ 42b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <unlink>:
+SYSCALL(unlink)
+ 433:	b8 12 00 00 00       	mov    $0x12,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <fstat>:
+SYSCALL(fstat)
+ 43b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <link>:
+SYSCALL(link)
+ 443:	b8 13 00 00 00       	mov    $0x13,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mkdir>:
+SYSCALL(mkdir)
+ 44b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <chdir>:
+SYSCALL(chdir)
+ 453:	b8 09 00 00 00       	mov    $0x9,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <dup>:
+SYSCALL(dup)
+ 45b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <getpid>:
+SYSCALL(getpid)
+ 463:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <sbrk>:
+SYSCALL(sbrk)
+ 46b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <sleep>:
+SYSCALL(sleep)
+ 473:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <uptime>:
+SYSCALL(uptime)
+ 47b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getdate>:
+SYSCALL(getdate)
+ 483:	b8 16 00 00 00       	mov    $0x16,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <setdate>:
+SYSCALL(setdate)
+ 48b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <mount>:
+SYSCALL(mount)
+ 493:	b8 18 00 00 00       	mov    $0x18,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <unmount>:
+SYSCALL(unmount)
+ 49b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <lseek>:
+SYSCALL(lseek)
+ 4a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <mmap>:
+SYSCALL(mmap)
+ 4ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <munmap>:
+SYSCALL(munmap)
+ 4b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <clock_gettime>:
+SYSCALL(clock_gettime)
+ 4bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <nanosleep>:
+SYSCALL(nanosleep)
+ 4c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 4cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 4d3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <proclimit>:
+SYSCALL(proclimit)
+ 4db:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <procinfo>:
+SYSCALL(procinfo)
+ 4e3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <cpuinfo>:
+SYSCALL(cpuinfo)
+ 4eb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <schedstat>:
+SYSCALL(schedstat)
+ 4f3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <lockstat>:
+SYSCALL(lockstat)
+ 4fb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <bcachestat>:
+SYSCALL(bcachestat)
+ 503:	b8 26 00 00 00       	mov    $0x26,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <diskstat>:
+SYSCALL(diskstat)
+ 50b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <iosched>:
+SYSCALL(iosched)
+ 513:	b8 28 00 00 00       	mov    $0x28,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+ 51b:	66 90                	xchg   %ax,%ax
+ 51d:	66 90                	xchg   %ax,%ax
+ 51f:	90                   	nop
+
+00000520 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	57                   	push   %edi
+ 524:	56                   	push   %esi
+ 525:	53                   	push   %ebx
+ 526:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 528:	89 d1                	mov    %edx,%ecx
+{
+ 52a:	83 ec 3c             	sub    $0x3c,%esp
+ 52d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 530:	85 d2                	test   %edx,%edx
+ 532:	0f 89 80 00 00 00    	jns    5b8 <printint+0x98>
+ 538:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 53c:	74 7a                	je     5b8 <printint+0x98>
+    x = -xx;
+ 53e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 540:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 545:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 548:	31 f6                	xor    %esi,%esi
+ 54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 550:	89 c8                	mov    %ecx,%eax
+ 552:	31 d2                	xor    %edx,%edx
+ 554:	89 f7                	mov    %esi,%edi
+ 556:	f7 f3                	div    %ebx
+ 558:	8d 76 01             	lea    0x1(%esi),%esi
+ 55b:	0f b6 92 e0 0a 00 00 	movzbl 0xae0(%edx),%edx
+ 562:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 566:	89 ca                	mov    %ecx,%edx
+ 568:	89 c1                	mov    %eax,%ecx
+ 56a:	39 da                	cmp    %ebx,%edx
+ 56c:	73 e2                	jae    550 <printint+0x30>
+  if(neg)
+ 56e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 571:	85 c0                	test   %eax,%eax
+ 573:	74 07                	je     57c <printint+0x5c>
+    buf[i++] = '-';
+ 575:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 57a:	89 f7                	mov    %esi,%edi
+ 57c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 57f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 582:	01 df                	add    %ebx,%edi
+ 584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 588:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 58b:	83 ec 04             	sub    $0x4,%esp
+ 58e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 591:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 594:	6a 01                	push   $0x1
+ 596:	50                   	push   %eax
+ 597:	56                   	push   %esi
+ 598:	e8 66 fe ff ff       	call   403 <write>
+  while(--i >= 0)
+ 59d:	89 f8                	mov    %edi,%eax
+ 59f:	83 c4 10             	add    $0x10,%esp
+ 5a2:	83 ef 01             	sub    $0x1,%edi
+ 5a5:	39 d8                	cmp    %ebx,%eax
+ 5a7:	75 df                	jne    588 <printint+0x68>
+}
+ 5a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ac:	5b                   	pop    %ebx
+ 5ad:	5e                   	pop    %esi
+ 5ae:	5f                   	pop    %edi
+ 5af:	5d                   	pop    %ebp
+ 5b0:	c3                   	ret
+ 5b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5b8:	31 c0                	xor    %eax,%eax
+ 5ba:	eb 89                	jmp    545 <printint+0x25>
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+ 5cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5cf:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d2:	83 c6 01             	add    $0x1,%esi
+ 5d5:	84 db                	test   %bl,%bl
+ 5d7:	74 67                	je     640 <printf+0x80>
+ 5d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5dc:	31 d2                	xor    %edx,%edx
+ 5de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5e1:	eb 34                	jmp    617 <printf+0x57>
+ 5e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5e7:	90                   	nop
+ 5e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5f0:	83 f8 25             	cmp    $0x25,%eax
+ 5f3:	74 18                	je     60d <printf+0x4d>
+  write(fd, &c, 1);
+ 5f5:	83 ec 04             	sub    $0x4,%esp
+ 5f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5fe:	6a 01                	push   $0x1
+ 600:	50                   	push   %eax
+ 601:	57                   	push   %edi
+ 602:	e8 fc fd ff ff       	call   403 <write>
+ 607:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 60a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 60d:	0f b6 1e             	movzbl (%esi),%ebx
+ 610:	83 c6 01             	add    $0x1,%esi
+ 613:	84 db                	test   %bl,%bl
+ 615:	74 29                	je     640 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 617:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 61a:	85 d2                	test   %edx,%edx
+ 61c:	74 ca                	je     5e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 61e:	83 fa 25             	cmp    $0x25,%edx
+ 621:	75 ea                	jne    60d <printf+0x4d>
+      if(c == 'd'){
+ 623:	83 f8 25             	cmp    $0x25,%eax
+ 626:	0f 84 24 01 00 00    	je     750 <printf+0x190>
+ 62c:	83 e8 63             	sub    $0x63,%eax
+ 62f:	83 f8 15             	cmp    $0x15,%eax
+ 632:	77 1c                	ja     650 <printf+0x90>
+ 634:	ff 24 85 88 0a 00 00 	jmp    *0xa88(,%eax,4)
+ 63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 643:	5b                   	pop    %ebx
+ 644:	5e                   	pop    %esi
+ 645:	5f                   	pop    %edi
+ 646:	5d                   	pop    %ebp
+ 647:	c3                   	ret
+ 648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+  write(fd, &c, 1);
+ 650:	83 ec 04             	sub    $0x4,%esp
+ 653:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 656:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 65a:	6a 01                	push   $0x1
+ 65c:	52                   	push   %edx
+ 65d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 660:	57                   	push   %edi
+ 661:	e8 9d fd ff ff       	call   403 <write>
+ 666:	83 c4 0c             	add    $0xc,%esp
+ 669:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 66c:	6a 01                	push   $0x1
+ 66e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 671:	52                   	push   %edx
+ 672:	57                   	push   %edi
+ 673:	e8 8b fd ff ff       	call   403 <write>
+        putc(fd, c);
+ 678:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 67b:	31 d2                	xor    %edx,%edx
+ 67d:	eb 8e                	jmp    60d <printf+0x4d>
+ 67f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 68b:	8b 13                	mov    (%ebx),%edx
+ 68d:	6a 00                	push   $0x0
+ 68f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 691:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 694:	e8 87 fe ff ff       	call   520 <printint>
+        ap++;
+ 699:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 69c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 69f:	31 d2                	xor    %edx,%edx
+ 6a1:	e9 67 ff ff ff       	jmp    60d <printf+0x4d>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6b5:	83 c0 04             	add    $0x4,%eax
+ 6b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6bb:	85 db                	test   %ebx,%ebx
+ 6bd:	0f 84 9d 00 00 00    	je     760 <printf+0x1a0>
+        while(*s != 0){
+ 6c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6c8:	84 c0                	test   %al,%al
+ 6ca:	0f 84 3d ff ff ff    	je     60d <printf+0x4d>
+ 6d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6d6:	89 de                	mov    %ebx,%esi
+ 6d8:	89 d3                	mov    %edx,%ebx
+ 6da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6e9:	6a 01                	push   $0x1
+ 6eb:	53                   	push   %ebx
+ 6ec:	57                   	push   %edi
+ 6ed:	e8 11 fd ff ff       	call   403 <write>
+        while(*s != 0){
+ 6f2:	0f b6 06             	movzbl (%esi),%eax
+ 6f5:	83 c4 10             	add    $0x10,%esp
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	75 e4                	jne    6e0 <printf+0x120>
+      state = 0;
+ 6fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	e9 07 ff ff ff       	jmp    60d <printf+0x4d>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 710:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 71b:	8b 13                	mov    (%ebx),%edx
+ 71d:	6a 01                	push   $0x1
+ 71f:	e9 6b ff ff ff       	jmp    68f <printf+0xcf>
+ 724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 728:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 72b:	83 ec 04             	sub    $0x4,%esp
+ 72e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 731:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 733:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 736:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 739:	6a 01                	push   $0x1
+ 73b:	52                   	push   %edx
+ 73c:	57                   	push   %edi
+ 73d:	e8 c1 fc ff ff       	call   403 <write>
+        ap++;
+ 742:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 745:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 748:	31 d2                	xor    %edx,%edx
+ 74a:	e9 be fe ff ff       	jmp    60d <printf+0x4d>
+ 74f:	90                   	nop
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 756:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 759:	6a 01                	push   $0x1
+ 75b:	e9 11 ff ff ff       	jmp    671 <printf+0xb1>
+ 760:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 765:	bb 7e 0a 00 00       	mov    $0xa7e,%ebx
+ 76a:	e9 61 ff ff ff       	jmp    6d0 <printf+0x110>
+ 76f:	90                   	nop
+
+00000770 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	83 ec 20             	sub    $0x20,%esp
+ 779:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 77c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+ 77f:	57                   	push   %edi
+ 780:	68 85 0a 00 00       	push   $0xa85
+ 785:	53                   	push   %ebx
+ 786:	e8 35 fe ff ff       	call   5c0 <printf>
+  for(n = strlen(s); n < w; n++)
+ 78b:	89 3c 24             	mov    %edi,(%esp)
+ 78e:	e8 9d fa ff ff       	call   230 <strlen>
+ 793:	83 c4 10             	add    $0x10,%esp
+ 796:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 799:	7d 20                	jge    7bb <pads+0x4b>
+ 79b:	89 c6                	mov    %eax,%esi
+ 79d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+ 7a7:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7aa:	6a 01                	push   $0x1
+ 7ac:	57                   	push   %edi
+ 7ad:	53                   	push   %ebx
+ 7ae:	e8 50 fc ff ff       	call   403 <write>
+  for(n = strlen(s); n < w; n++)
+ 7b3:	83 c4 10             	add    $0x10,%esp
+ 7b6:	39 75 10             	cmp    %esi,0x10(%ebp)
+ 7b9:	75 e5                	jne    7a0 <pads+0x30>
+    putc(fd, ' ');
+}
+ 7bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7be:	5b                   	pop    %ebx
+ 7bf:	5e                   	pop    %esi
+ 7c0:	5f                   	pop    %edi
+ 7c1:	5d                   	pop    %ebp
+ 7c2:	c3                   	ret
+ 7c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007d0 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+ 7d0:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+ 7d1:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+ 7d6:	89 e5                	mov    %esp,%ebp
+ 7d8:	57                   	push   %edi
+ 7d9:	56                   	push   %esi
+ 7da:	53                   	push   %ebx
+  int n = 0;
+ 7db:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+ 7dd:	83 ec 2c             	sub    $0x2c,%esp
+ 7e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7e3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 7e6:	8b 75 08             	mov    0x8(%ebp),%esi
+ 7e9:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 7ec:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 7ef:	90                   	nop
+  }while((x /= 10) != 0);
+ 7f0:	89 d0                	mov    %edx,%eax
+ 7f2:	89 d7                	mov    %edx,%edi
+    n++;
+ 7f4:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+ 7f7:	f7 e1                	mul    %ecx
+ 7f9:	c1 ea 03             	shr    $0x3,%edx
+ 7fc:	83 ff 09             	cmp    $0x9,%edi
+ 7ff:	77 ef                	ja     7f0 <padd+0x20>
+  for(; n < w; n++)
+ 801:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 804:	39 c3                	cmp    %eax,%ebx
+ 806:	7d 23                	jge    82b <padd+0x5b>
+ 808:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+  write(fd, &c, 1);
+ 810:	83 ec 04             	sub    $0x4,%esp
+ 813:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+ 817:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+ 81a:	6a 01                	push   $0x1
+ 81c:	57                   	push   %edi
+ 81d:	56                   	push   %esi
+ 81e:	e8 e0 fb ff ff       	call   403 <write>
+  for(; n < w; n++)
+ 823:	83 c4 10             	add    $0x10,%esp
+ 826:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+ 829:	75 e5                	jne    810 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+ 82b:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+ 832:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+ 835:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+ 838:	89 f0                	mov    %esi,%eax
+}
+ 83a:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+ 83b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+ 840:	5e                   	pop    %esi
+ 841:	5f                   	pop    %edi
+ 842:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+ 843:	e9 d8 fc ff ff       	jmp    520 <printint>
+ 848:	66 90                	xchg   %ax,%ax
+ 84a:	66 90                	xchg   %ax,%ax
+ 84c:	66 90                	xchg   %ax,%ax
+ 84e:	66 90                	xchg   %ax,%ax
+
+00000850 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 850:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 851:	a1 e8 0e 00 00       	mov    0xee8,%eax
+{
+ 856:	89 e5                	mov    %esp,%ebp
+ 858:	57                   	push   %edi
+ 859:	56                   	push   %esi
+ 85a:	53                   	push   %ebx
+ 85b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 85e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 861:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 868:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 86a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 86c:	39 ca                	cmp    %ecx,%edx
+ 86e:	73 30                	jae    8a0 <free+0x50>
+ 870:	39 c1                	cmp    %eax,%ecx
+ 872:	72 04                	jb     878 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 874:	39 c2                	cmp    %eax,%edx
+ 876:	72 f0                	jb     868 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 878:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 87b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 87e:	39 f8                	cmp    %edi,%eax
+ 880:	74 2e                	je     8b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 882:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 885:	8b 42 04             	mov    0x4(%edx),%eax
+ 888:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 88b:	39 f1                	cmp    %esi,%ecx
+ 88d:	74 38                	je     8c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 88f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 891:	5b                   	pop    %ebx
+  freep = p;
+ 892:	89 15 e8 0e 00 00    	mov    %edx,0xee8
+}
+ 898:	5e                   	pop    %esi
+ 899:	5f                   	pop    %edi
+ 89a:	5d                   	pop    %ebp
+ 89b:	c3                   	ret
+ 89c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8a0:	39 c1                	cmp    %eax,%ecx
+ 8a2:	72 d0                	jb     874 <free+0x24>
+ 8a4:	eb c2                	jmp    868 <free+0x18>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8b0:	03 70 04             	add    0x4(%eax),%esi
+ 8b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8b6:	8b 02                	mov    (%edx),%eax
+ 8b8:	8b 00                	mov    (%eax),%eax
+ 8ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8bd:	8b 42 04             	mov    0x4(%edx),%eax
+ 8c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8c3:	39 f1                	cmp    %esi,%ecx
+ 8c5:	75 c8                	jne    88f <free+0x3f>
+    p->s.size += bp->s.size;
+ 8c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8ca:	89 15 e8 0e 00 00    	mov    %edx,0xee8
+    p->s.size += bp->s.size;
+ 8d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8d6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8d8:	5b                   	pop    %ebx
+ 8d9:	5e                   	pop    %esi
+ 8da:	5f                   	pop    %edi
+ 8db:	5d                   	pop    %ebp
+ 8dc:	c3                   	ret
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008e0 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	56                   	push   %esi
+ 8e5:	53                   	push   %ebx
+ 8e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8ec:	8b 15 e8 0e 00 00    	mov    0xee8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8f2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8f5:	c1 ef 03             	shr    $0x3,%edi
+ 8f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8fb:	85 d2                	test   %edx,%edx
+ 8fd:	0f 84 8d 00 00 00    	je     990 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 903:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 905:	8b 48 04             	mov    0x4(%eax),%ecx
+ 908:	39 f9                	cmp    %edi,%ecx
+ 90a:	73 64                	jae    970 <malloc+0x90>
+  if(nu < 4096)
+ 90c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 911:	39 df                	cmp    %ebx,%edi
+ 913:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 916:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 91d:	eb 0a                	jmp    929 <malloc+0x49>
+ 91f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 920:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 922:	8b 48 04             	mov    0x4(%eax),%ecx
+ 925:	39 f9                	cmp    %edi,%ecx
+ 927:	73 47                	jae    970 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 929:	89 c2                	mov    %eax,%edx
+ 92b:	39 05 e8 0e 00 00    	cmp    %eax,0xee8
+ 931:	75 ed                	jne    920 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 933:	83 ec 0c             	sub    $0xc,%esp
+ 936:	56                   	push   %esi
+ 937:	e8 2f fb ff ff       	call   46b <sbrk>
+  if(p == (char*)-1)
+ 93c:	83 c4 10             	add    $0x10,%esp
+ 93f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 942:	74 1c                	je     960 <malloc+0x80>
+  hp->s.size = nu;
+ 944:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 947:	83 ec 0c             	sub    $0xc,%esp
+ 94a:	83 c0 08             	add    $0x8,%eax
+ 94d:	50                   	push   %eax
+ 94e:	e8 fd fe ff ff       	call   850 <free>
+  return freep;
+ 953:	8b 15 e8 0e 00 00    	mov    0xee8,%edx
+      if((p = morecore(nunits)) == 0)
+ 959:	83 c4 10             	add    $0x10,%esp
+ 95c:	85 d2                	test   %edx,%edx
+ 95e:	75 c0                	jne    920 <malloc+0x40>
+        return 0;
+  }
+}
+ 960:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 963:	31 c0                	xor    %eax,%eax
+}
+ 965:	5b                   	pop    %ebx
+ 966:	5e                   	pop    %esi
+ 967:	5f                   	pop    %edi
+ 968:	5d                   	pop    %ebp
+ 969:	c3                   	ret
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 970:	39 cf                	cmp    %ecx,%edi
+ 972:	74 4c                	je     9c0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 974:	29 f9                	sub    %edi,%ecx
+ 976:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 979:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 97c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 97f:	89 15 e8 0e 00 00    	mov    %edx,0xee8
+}
+ 985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 988:	83 c0 08             	add    $0x8,%eax
+}
+ 98b:	5b                   	pop    %ebx
+ 98c:	5e                   	pop    %esi
+ 98d:	5f                   	pop    %edi
+ 98e:	5d                   	pop    %ebp
+ 98f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 990:	c7 05 e8 0e 00 00 ec 	movl   $0xeec,0xee8
+ 997:	0e 00 00 
+    base.s.size = 0;
+ 99a:	b8 ec 0e 00 00       	mov    $0xeec,%eax
+    base.s.ptr = freep = prevp = &base;
+ 99f:	c7 05 ec 0e 00 00 ec 	movl   $0xeec,0xeec
+ 9a6:	0e 00 00 
+    base.s.size = 0;
+ 9a9:	c7 05 f0 0e 00 00 00 	movl   $0x0,0xef0
+ 9b0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9b3:	e9 54 ff ff ff       	jmp    90c <malloc+0x2c>
+ 9b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9c0:	8b 08                	mov    (%eax),%ecx
+ 9c2:	89 0a                	mov    %ecx,(%edx)
+ 9c4:	eb b9                	jmp    97f <malloc+0x9f>
@@ -0,0 +1,39 @@
+#include "kernel/types.h"
+#include "kernel/param.h"
+#include "kernel/iostat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[]) {
+  static struct diskstat st[NDISK];
+  int n, i;
+
+  if(argc == 3 && strcmp(argv[1], "-s") == 0) {
+    if(iosched(argv[2]) < 0) {
+      printf(2, "iostat: no I/O scheduler %s\n", argv[2]);
+      exit(1);
+    }
+  } else if(argc != 1) {
+    printf(2, "usage: iostat [-s fifo|cscan|deadline]\n");
+    exit(1);
+  }
+
+  if((n = diskstat(st, NDISK)) < 0) {
+    printf(2, "iostat: cannot read disk statistics\n");
+    exit(1);
+  }
+  printf(1, "DEV SCHED     DEPTH MAXDEPTH     REQS     CMDS  AVG(us)  MAX(us)\n");
+  for(i = 0; i < n; ++i) {
+    padd(1, st[i].dev, 3);
+    printf(1, " ");
+    pads(1, st[i].sched, 9);
+    padd(1, st[i].depth, 6);
+    padd(1, st[i].maxdepth, 9);
+    padd(1, st[i].nreq, 9);
+    padd(1, st[i].ncmd, 9);
+    padd(1, st[i].avgus, 9);
+    padd(1, st[i].maxus, 9);
+    printf(1, "\n");
+  }
+  exit(0);
+}
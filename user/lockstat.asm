@@ -0,0 +1,1687 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    printf(1, "\n");
+  }
+}
+
+int
+main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  static struct lockinfo before[NLOCKCLASS], after[NLOCKCLASS];
+  int secs, nb, na, i;
+
+  secs = argc > 1 ? atoi(argv[1]) : 0;
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+main(int argc, char *argv[]) {
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  secs = argc > 1 ? atoi(argv[1]) : 0;
+  1a:	0f 8e 07 01 00 00    	jle    127 <main+0x127>
+  20:	83 ec 0c             	sub    $0xc,%esp
+  23:	ff 70 04             	push   0x4(%eax)
+  26:	e8 15 05 00 00       	call   540 <atoi>
+  if(secs < 0) {
+  2b:	83 c4 10             	add    $0x10,%esp
+  secs = argc > 1 ? atoi(argv[1]) : 0;
+  2e:	89 c3                	mov    %eax,%ebx
+  if(secs < 0) {
+  30:	85 c0                	test   %eax,%eax
+  32:	0f 88 34 01 00 00    	js     16c <main+0x16c>
+    printf(2, "usage: lockstat [seconds]\n");
+    exit(1);
+  }
+
+  if((nb = lockstat(before, NLOCKCLASS)) < 0) {
+  38:	56                   	push   %esi
+  39:	56                   	push   %esi
+  3a:	6a 40                	push   $0x40
+  3c:	68 00 19 00 00       	push   $0x1900
+  41:	e8 85 06 00 00       	call   6cb <lockstat>
+  46:	83 c4 10             	add    $0x10,%esp
+  49:	89 c2                	mov    %eax,%edx
+  4b:	85 c0                	test   %eax,%eax
+  4d:	0f 88 ff 00 00 00    	js     152 <main+0x152>
+    printf(2, "lockstat: lock statistics are not compiled in\n");
+    exit(1);
+  }
+  if(secs == 0) {
+  53:	85 db                	test   %ebx,%ebx
+  55:	0f 84 e3 00 00 00    	je     13e <main+0x13e>
+    /* Totals since boot */
+    show(before, nb);
+    exit(0);
+  }
+
+  sleep(secs * 100);
+  5b:	6b db 64             	imul   $0x64,%ebx,%ebx
+  5e:	83 ec 0c             	sub    $0xc,%esp
+  61:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  64:	53                   	push   %ebx
+  65:	e8 d9 05 00 00       	call   643 <sleep>
+  if((na = lockstat(after, NLOCKCLASS)) < 0) {
+  6a:	5a                   	pop    %edx
+  6b:	59                   	pop    %ecx
+  6c:	6a 40                	push   $0x40
+  6e:	68 00 10 00 00       	push   $0x1000
+  73:	e8 53 06 00 00       	call   6cb <lockstat>
+  78:	83 c4 10             	add    $0x10,%esp
+  7b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  7e:	85 c0                	test   %eax,%eax
+  80:	0f 88 00 01 00 00    	js     186 <main+0x186>
+    printf(2, "lockstat: cannot read lock statistics\n");
+    exit(1);
+  }
+  for(i = 0; i < na; ++i)
+  86:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  89:	be 00 10 00 00       	mov    $0x1000,%esi
+  8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  93:	74 36                	je     cb <main+0xcb>
+  95:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < na; ++i) {
+  98:	85 d2                	test   %edx,%edx
+  9a:	74 7a                	je     116 <main+0x116>
+  9c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  9f:	bb 00 19 00 00       	mov    $0x1900,%ebx
+  a4:	31 ff                	xor    %edi,%edi
+  a6:	89 d1                	mov    %edx,%ecx
+    if(a[i].sleep != b->sleep || strcmp(a[i].name, b->name) != 0)
+  a8:	8b 46 10             	mov    0x10(%esi),%eax
+  ab:	39 43 10             	cmp    %eax,0x10(%ebx)
+  ae:	74 38                	je     e8 <main+0xe8>
+  for(i = 0; i < na; ++i) {
+  b0:	83 c7 01             	add    $0x1,%edi
+  b3:	83 c3 24             	add    $0x24,%ebx
+  b6:	39 f9                	cmp    %edi,%ecx
+  b8:	75 ee                	jne    a8 <main+0xa8>
+  for(i = 0; i < na; ++i)
+  ba:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+  be:	89 ca                	mov    %ecx,%edx
+  c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  c3:	83 c6 24             	add    $0x24,%esi
+  c6:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  c9:	75 d4                	jne    9f <main+0x9f>
+    delta(before, nb, &after[i]);
+  show(after, na);
+  cb:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  ce:	b8 00 10 00 00       	mov    $0x1000,%eax
+  d3:	e8 c8 00 00 00       	call   1a0 <show>
+  exit(0);
+  d8:	83 ec 0c             	sub    $0xc,%esp
+  db:	6a 00                	push   $0x0
+  dd:	e8 d1 04 00 00       	call   5b3 <exit>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(a[i].sleep != b->sleep || strcmp(a[i].name, b->name) != 0)
+  e8:	83 ec 08             	sub    $0x8,%esp
+  eb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  ee:	56                   	push   %esi
+  ef:	53                   	push   %ebx
+  f0:	e8 ab 02 00 00       	call   3a0 <strcmp>
+  f5:	83 c4 10             	add    $0x10,%esp
+  f8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  fb:	85 c0                	test   %eax,%eax
+  fd:	75 b1                	jne    b0 <main+0xb0>
+    b->nacq -= a[i].nacq;
+  ff:	89 ca                	mov    %ecx,%edx
+ 101:	8b 4b 14             	mov    0x14(%ebx),%ecx
+ 104:	29 4e 14             	sub    %ecx,0x14(%esi)
+    b->ncont -= a[i].ncont;
+ 107:	8b 4b 18             	mov    0x18(%ebx),%ecx
+ 10a:	29 4e 18             	sub    %ecx,0x18(%esi)
+    b->spin -= a[i].spin;
+ 10d:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+ 110:	29 4e 1c             	sub    %ecx,0x1c(%esi)
+    b->nacq -= a[i].nacq;
+ 113:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  for(i = 0; i < na; ++i)
+ 116:	83 c0 01             	add    $0x1,%eax
+ 119:	83 c6 24             	add    $0x24,%esi
+ 11c:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+ 11f:	0f 85 73 ff ff ff    	jne    98 <main+0x98>
+ 125:	eb a4                	jmp    cb <main+0xcb>
+  if((nb = lockstat(before, NLOCKCLASS)) < 0) {
+ 127:	50                   	push   %eax
+ 128:	50                   	push   %eax
+ 129:	6a 40                	push   $0x40
+ 12b:	68 00 19 00 00       	push   $0x1900
+ 130:	e8 96 05 00 00       	call   6cb <lockstat>
+ 135:	83 c4 10             	add    $0x10,%esp
+ 138:	89 c2                	mov    %eax,%edx
+ 13a:	85 c0                	test   %eax,%eax
+ 13c:	78 14                	js     152 <main+0x152>
+    show(before, nb);
+ 13e:	b8 00 19 00 00       	mov    $0x1900,%eax
+ 143:	e8 58 00 00 00       	call   1a0 <show>
+    exit(0);
+ 148:	83 ec 0c             	sub    $0xc,%esp
+ 14b:	6a 00                	push   $0x0
+ 14d:	e8 61 04 00 00       	call   5b3 <exit>
+    printf(2, "lockstat: lock statistics are not compiled in\n");
+ 152:	57                   	push   %edi
+ 153:	57                   	push   %edi
+ 154:	68 0c 0c 00 00       	push   $0xc0c
+ 159:	6a 02                	push   $0x2
+ 15b:	e8 30 06 00 00       	call   790 <printf>
+    exit(1);
+ 160:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 167:	e8 47 04 00 00       	call   5b3 <exit>
+    printf(2, "usage: lockstat [seconds]\n");
+ 16c:	50                   	push   %eax
+ 16d:	50                   	push   %eax
+ 16e:	68 a3 0b 00 00       	push   $0xba3
+ 173:	6a 02                	push   $0x2
+ 175:	e8 16 06 00 00       	call   790 <printf>
+    exit(1);
+ 17a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 181:	e8 2d 04 00 00       	call   5b3 <exit>
+    printf(2, "lockstat: cannot read lock statistics\n");
+ 186:	50                   	push   %eax
+ 187:	50                   	push   %eax
+ 188:	68 3c 0c 00 00       	push   $0xc3c
+ 18d:	6a 02                	push   $0x2
+ 18f:	e8 fc 05 00 00       	call   790 <printf>
+    exit(1);
+ 194:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 19b:	e8 13 04 00 00       	call   5b3 <exit>
+
+000001a0 <show>:
+show(struct lockinfo *li, int n) {
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+ 1a5:	53                   	push   %ebx
+ 1a6:	81 ec 1c 01 00 00    	sub    $0x11c,%esp
+ 1ac:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+  for(i = 0; i < n; ++i) {
+ 1b2:	85 d2                	test   %edx,%edx
+ 1b4:	0f 8e 98 01 00 00    	jle    352 <show+0x1b2>
+ 1ba:	83 c0 18             	add    $0x18,%eax
+ 1bd:	89 d3                	mov    %edx,%ebx
+ 1bf:	31 d2                	xor    %edx,%edx
+ 1c1:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%ebp)
+    for(j = i; j > 0 && worse(&li[i], &li[order[j-1]]); --j)
+ 1c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ce:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < n; ++i) {
+ 1d0:	89 d7                	mov    %edx,%edi
+ 1d2:	31 f6                	xor    %esi,%esi
+    order[j] = i;
+ 1d4:	89 94 b5 e8 fe ff ff 	mov    %edx,-0x118(%ebp,%esi,4)
+  for(i = 0; i < n; ++i) {
+ 1db:	83 c2 01             	add    $0x1,%edx
+ 1de:	83 85 e0 fe ff ff 24 	addl   $0x24,-0x120(%ebp)
+ 1e5:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+ 1eb:	39 d3                	cmp    %edx,%ebx
+ 1ed:	0f 84 85 00 00 00    	je     278 <show+0xd8>
+  if(a->spin != b->spin)
+ 1f3:	8b 78 04             	mov    0x4(%eax),%edi
+ 1f6:	89 95 dc fe ff ff    	mov    %edx,-0x124(%ebp)
+  for(i = 0; i < n; ++i) {
+ 1fc:	89 d0                	mov    %edx,%eax
+ 1fe:	89 9d d8 fe ff ff    	mov    %ebx,-0x128(%ebp)
+ 204:	eb 19                	jmp    21f <show+0x7f>
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(j = i; j > 0 && worse(&li[i], &li[order[j-1]]); --j)
+ 210:	39 fb                	cmp    %edi,%ebx
+ 212:	73 37                	jae    24b <show+0xab>
+      order[j] = order[j-1];
+ 214:	89 94 85 ec fe ff ff 	mov    %edx,-0x114(%ebp,%eax,4)
+    for(j = i; j > 0 && worse(&li[i], &li[order[j-1]]); --j)
+ 21b:	85 c0                	test   %eax,%eax
+ 21d:	74 41                	je     260 <show+0xc0>
+ 21f:	89 c6                	mov    %eax,%esi
+ 221:	8d 40 ff             	lea    -0x1(%eax),%eax
+ 224:	8b 9d e4 fe ff ff    	mov    -0x11c(%ebp),%ebx
+ 22a:	8b 94 85 e8 fe ff ff 	mov    -0x118(%ebp,%eax,4),%edx
+ 231:	8d 0c d2             	lea    (%edx,%edx,8),%ecx
+ 234:	8d 0c 8b             	lea    (%ebx,%ecx,4),%ecx
+  if(a->spin != b->spin)
+ 237:	8b 59 1c             	mov    0x1c(%ecx),%ebx
+ 23a:	39 df                	cmp    %ebx,%edi
+ 23c:	75 d2                	jne    210 <show+0x70>
+    for(j = i; j > 0 && worse(&li[i], &li[order[j-1]]); --j)
+ 23e:	8b 9d e0 fe ff ff    	mov    -0x120(%ebp),%ebx
+ 244:	8b 1b                	mov    (%ebx),%ebx
+ 246:	39 59 18             	cmp    %ebx,0x18(%ecx)
+ 249:	72 c9                	jb     214 <show+0x74>
+  for(i = 0; i < n; ++i) {
+ 24b:	8b 95 dc fe ff ff    	mov    -0x124(%ebp),%edx
+ 251:	8b 9d d8 fe ff ff    	mov    -0x128(%ebp),%ebx
+ 257:	89 d7                	mov    %edx,%edi
+ 259:	e9 76 ff ff ff       	jmp    1d4 <show+0x34>
+ 25e:	66 90                	xchg   %ax,%ax
+ 260:	8b 95 dc fe ff ff    	mov    -0x124(%ebp),%edx
+ 266:	8b 9d d8 fe ff ff    	mov    -0x128(%ebp),%ebx
+ 26c:	e9 5f ff ff ff       	jmp    1d0 <show+0x30>
+ 271:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  printf(1, "NAME            TYPE       ACQ   CONT  %%CONT  WAIT(kcyc) MAXHOLD(kcyc)\n");
+ 278:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < n; ++i) {
+ 27b:	31 f6                	xor    %esi,%esi
+  printf(1, "NAME            TYPE       ACQ   CONT  %%CONT  WAIT(kcyc) MAXHOLD(kcyc)\n");
+ 27d:	68 c0 0b 00 00       	push   $0xbc0
+ 282:	6a 01                	push   $0x1
+ 284:	e8 07 05 00 00       	call   790 <printf>
+ 289:	83 c4 10             	add    $0x10,%esp
+ 28c:	eb 04                	jmp    292 <show+0xf2>
+ 28e:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < n; ++i) {
+ 290:	89 c6                	mov    %eax,%esi
+    struct lockinfo *l = &li[order[i]];
+ 292:	8b 84 b5 e8 fe ff ff 	mov    -0x118(%ebp,%esi,4),%eax
+ 299:	8b 95 e4 fe ff ff    	mov    -0x11c(%ebp),%edx
+ 29f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+ 2a2:	8d 1c 82             	lea    (%edx,%eax,4),%ebx
+    if(l->nacq == 0)
+ 2a5:	8b 43 14             	mov    0x14(%ebx),%eax
+ 2a8:	85 c0                	test   %eax,%eax
+ 2aa:	0f 84 8f 00 00 00    	je     33f <show+0x19f>
+    pads(1, l->name, 16);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 10                	push   $0x10
+ 2b5:	53                   	push   %ebx
+ 2b6:	6a 01                	push   $0x1
+ 2b8:	e8 83 06 00 00       	call   940 <pads>
+    pads(1, l->sleep ? "sleep" : "spin", 5);
+ 2bd:	8b 43 10             	mov    0x10(%ebx),%eax
+ 2c0:	83 c4 0c             	add    $0xc,%esp
+ 2c3:	ba 9e 0b 00 00       	mov    $0xb9e,%edx
+ 2c8:	6a 05                	push   $0x5
+ 2ca:	85 c0                	test   %eax,%eax
+ 2cc:	b8 98 0b 00 00       	mov    $0xb98,%eax
+ 2d1:	0f 44 c2             	cmove  %edx,%eax
+ 2d4:	50                   	push   %eax
+ 2d5:	6a 01                	push   $0x1
+ 2d7:	e8 64 06 00 00       	call   940 <pads>
+    padd(1, l->nacq, 9);
+ 2dc:	83 c4 0c             	add    $0xc,%esp
+ 2df:	6a 09                	push   $0x9
+ 2e1:	ff 73 14             	push   0x14(%ebx)
+ 2e4:	6a 01                	push   $0x1
+ 2e6:	e8 b5 06 00 00       	call   9a0 <padd>
+    padd(1, l->ncont, 7);
+ 2eb:	83 c4 0c             	add    $0xc,%esp
+ 2ee:	6a 07                	push   $0x7
+ 2f0:	ff 73 18             	push   0x18(%ebx)
+ 2f3:	6a 01                	push   $0x1
+ 2f5:	e8 a6 06 00 00       	call   9a0 <padd>
+    padd(1, l->ncont * 100 / l->nacq, 7);
+ 2fa:	83 c4 0c             	add    $0xc,%esp
+ 2fd:	31 d2                	xor    %edx,%edx
+ 2ff:	6a 07                	push   $0x7
+ 301:	6b 43 18 64          	imul   $0x64,0x18(%ebx),%eax
+ 305:	f7 73 14             	divl   0x14(%ebx)
+ 308:	50                   	push   %eax
+ 309:	6a 01                	push   $0x1
+ 30b:	e8 90 06 00 00       	call   9a0 <padd>
+    padd(1, l->spin, 12);
+ 310:	83 c4 0c             	add    $0xc,%esp
+ 313:	6a 0c                	push   $0xc
+ 315:	ff 73 1c             	push   0x1c(%ebx)
+ 318:	6a 01                	push   $0x1
+ 31a:	e8 81 06 00 00       	call   9a0 <padd>
+    padd(1, l->maxhold, 14);
+ 31f:	83 c4 0c             	add    $0xc,%esp
+ 322:	6a 0e                	push   $0xe
+ 324:	ff 73 20             	push   0x20(%ebx)
+ 327:	6a 01                	push   $0x1
+ 329:	e8 72 06 00 00       	call   9a0 <padd>
+    printf(1, "\n");
+ 32e:	5a                   	pop    %edx
+ 32f:	59                   	pop    %ecx
+ 330:	68 bc 0b 00 00       	push   $0xbbc
+ 335:	6a 01                	push   $0x1
+ 337:	e8 54 04 00 00       	call   790 <printf>
+ 33c:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; ++i) {
+ 33f:	8d 46 01             	lea    0x1(%esi),%eax
+ 342:	39 f7                	cmp    %esi,%edi
+ 344:	0f 85 46 ff ff ff    	jne    290 <show+0xf0>
+}
+ 34a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 34d:	5b                   	pop    %ebx
+ 34e:	5e                   	pop    %esi
+ 34f:	5f                   	pop    %edi
+ 350:	5d                   	pop    %ebp
+ 351:	c3                   	ret
+  printf(1, "NAME            TYPE       ACQ   CONT  %%CONT  WAIT(kcyc) MAXHOLD(kcyc)\n");
+ 352:	50                   	push   %eax
+ 353:	50                   	push   %eax
+ 354:	68 c0 0b 00 00       	push   $0xbc0
+ 359:	6a 01                	push   $0x1
+ 35b:	e8 30 04 00 00       	call   790 <printf>
+ 360:	83 c4 10             	add    $0x10,%esp
+ 363:	eb e5                	jmp    34a <show+0x1aa>
+ 365:	66 90                	xchg   %ax,%ax
+ 367:	66 90                	xchg   %ax,%ax
+ 369:	66 90                	xchg   %ax,%ax
+ 36b:	66 90                	xchg   %ax,%ax
+ 36d:	66 90                	xchg   %ax,%ax
+ 36f:	90                   	nop
+
+00000370 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 370:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 371:	31 c0                	xor    %eax,%eax
+{
+ 373:	89 e5                	mov    %esp,%ebp
+ 375:	53                   	push   %ebx
+ 376:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 379:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 37c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 380:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 384:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 387:	83 c0 01             	add    $0x1,%eax
+ 38a:	84 d2                	test   %dl,%dl
+ 38c:	75 f2                	jne    380 <strcpy+0x10>
+    ;
+  return os;
+}
+ 38e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 391:	89 c8                	mov    %ecx,%eax
+ 393:	c9                   	leave
+ 394:	c3                   	ret
+ 395:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3aa:	0f b6 02             	movzbl (%edx),%eax
+ 3ad:	84 c0                	test   %al,%al
+ 3af:	75 17                	jne    3c8 <strcmp+0x28>
+ 3b1:	eb 3a                	jmp    3ed <strcmp+0x4d>
+ 3b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3b7:	90                   	nop
+ 3b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3bc:	83 c2 01             	add    $0x1,%edx
+ 3bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3c2:	84 c0                	test   %al,%al
+ 3c4:	74 1a                	je     3e0 <strcmp+0x40>
+    p++, q++;
+ 3c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3cb:	38 c3                	cmp    %al,%bl
+ 3cd:	74 e9                	je     3b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3cf:	29 d8                	sub    %ebx,%eax
+}
+ 3d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d4:	c9                   	leave
+ 3d5:	c3                   	ret
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3e4:	31 c0                	xor    %eax,%eax
+ 3e6:	29 d8                	sub    %ebx,%eax
+}
+ 3e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3eb:	c9                   	leave
+ 3ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 3f0:	31 c0                	xor    %eax,%eax
+ 3f2:	eb db                	jmp    3cf <strcmp+0x2f>
+ 3f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 406:	80 3a 00             	cmpb   $0x0,(%edx)
+ 409:	74 15                	je     420 <strlen+0x20>
+ 40b:	31 c0                	xor    %eax,%eax
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+ 410:	83 c0 01             	add    $0x1,%eax
+ 413:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 417:	89 c1                	mov    %eax,%ecx
+ 419:	75 f5                	jne    410 <strlen+0x10>
+    ;
+  return n;
+}
+ 41b:	89 c8                	mov    %ecx,%eax
+ 41d:	5d                   	pop    %ebp
+ 41e:	c3                   	ret
+ 41f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 420:	31 c9                	xor    %ecx,%ecx
+}
+ 422:	5d                   	pop    %ebp
+ 423:	89 c8                	mov    %ecx,%eax
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 437:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 43a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43d:	89 d7                	mov    %edx,%edi
+ 43f:	fc                   	cld
+ 440:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 442:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 445:	89 d0                	mov    %edx,%eax
+ 447:	c9                   	leave
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 45a:	0f b6 10             	movzbl (%eax),%edx
+ 45d:	84 d2                	test   %dl,%dl
+ 45f:	75 12                	jne    473 <strchr+0x23>
+ 461:	eb 1d                	jmp    480 <strchr+0x30>
+ 463:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 467:	90                   	nop
+ 468:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 46c:	83 c0 01             	add    $0x1,%eax
+ 46f:	84 d2                	test   %dl,%dl
+ 471:	74 0d                	je     480 <strchr+0x30>
+    if(*s == c)
+ 473:	38 d1                	cmp    %dl,%cl
+ 475:	75 f1                	jne    468 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 477:	5d                   	pop    %ebp
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 480:	31 c0                	xor    %eax,%eax
+}
+ 482:	5d                   	pop    %ebp
+ 483:	c3                   	ret
+ 484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 495:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 498:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 499:	31 db                	xor    %ebx,%ebx
+{
+ 49b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 49e:	eb 27                	jmp    4c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4a0:	83 ec 04             	sub    $0x4,%esp
+ 4a3:	6a 01                	push   $0x1
+ 4a5:	56                   	push   %esi
+ 4a6:	6a 00                	push   $0x0
+ 4a8:	e8 1e 01 00 00       	call   5cb <read>
+    if(cc < 1)
+ 4ad:	83 c4 10             	add    $0x10,%esp
+ 4b0:	85 c0                	test   %eax,%eax
+ 4b2:	7e 1d                	jle    4d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4bf:	3c 0a                	cmp    $0xa,%al
+ 4c1:	74 10                	je     4d3 <gets+0x43>
+ 4c3:	3c 0d                	cmp    $0xd,%al
+ 4c5:	74 0c                	je     4d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4c7:	89 df                	mov    %ebx,%edi
+ 4c9:	83 c3 01             	add    $0x1,%ebx
+ 4cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4cf:	7c cf                	jl     4a0 <gets+0x10>
+ 4d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4dd:	5b                   	pop    %ebx
+ 4de:	5e                   	pop    %esi
+ 4df:	5f                   	pop    %edi
+ 4e0:	5d                   	pop    %ebp
+ 4e1:	c3                   	ret
+ 4e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	56                   	push   %esi
+ 4f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4f5:	83 ec 08             	sub    $0x8,%esp
+ 4f8:	6a 00                	push   $0x0
+ 4fa:	ff 75 08             	push   0x8(%ebp)
+ 4fd:	e8 f1 00 00 00       	call   5f3 <open>
+  if(fd < 0)
+ 502:	83 c4 10             	add    $0x10,%esp
+ 505:	85 c0                	test   %eax,%eax
+ 507:	78 27                	js     530 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 509:	83 ec 08             	sub    $0x8,%esp
+ 50c:	ff 75 0c             	push   0xc(%ebp)
+ 50f:	89 c3                	mov    %eax,%ebx
+ 511:	50                   	push   %eax
+ 512:	e8 f4 00 00 00       	call   60b <fstat>
+  close(fd);
+ 517:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 51a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 51c:	e8 ba 00 00 00       	call   5db <close>
+  return r;
+ 521:	83 c4 10             	add    $0x10,%esp
+}
+ 524:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 527:	89 f0                	mov    %esi,%eax
+ 529:	5b                   	pop    %ebx
+ 52a:	5e                   	pop    %esi
+ 52b:	5d                   	pop    %ebp
+ 52c:	c3                   	ret
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 530:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 535:	eb ed                	jmp    524 <stat+0x34>
+ 537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53e:	66 90                	xchg   %ax,%ax
+
+00000540 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	53                   	push   %ebx
+ 544:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 547:	0f be 02             	movsbl (%edx),%eax
+ 54a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 54d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 555:	77 1e                	ja     575 <atoi+0x35>
+ 557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 560:	83 c2 01             	add    $0x1,%edx
+ 563:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 566:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 56a:	0f be 02             	movsbl (%edx),%eax
+ 56d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 570:	80 fb 09             	cmp    $0x9,%bl
+ 573:	76 eb                	jbe    560 <atoi+0x20>
+  return n;
+}
+ 575:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 578:	89 c8                	mov    %ecx,%eax
+ 57a:	c9                   	leave
+ 57b:	c3                   	ret
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	8b 45 10             	mov    0x10(%ebp),%eax
+ 588:	8b 55 08             	mov    0x8(%ebp),%edx
+ 58b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 58e:	85 c0                	test   %eax,%eax
+ 590:	7e 13                	jle    5a5 <memmove+0x25>
+ 592:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 594:	89 d7                	mov    %edx,%edi
+ 596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5a1:	39 f8                	cmp    %edi,%eax
+ 5a3:	75 fb                	jne    5a0 <memmove+0x20>
+  return vdst;
+}
+ 5a5:	5e                   	pop    %esi
+ 5a6:	89 d0                	mov    %edx,%eax
+ 5a8:	5f                   	pop    %edi
+ 5a9:	5d                   	pop    %ebp
+ 5aa:	c3                   	ret
+
+000005ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5ab:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <exit>:
+SYSCALL(exit)
+ 5b3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <wait>:
+SYSCALL(wait)
+ 5bb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <pipe>:
+SYSCALL(pipe)
+ 5c3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <read>:
+SYSCALL(read)
+ 5cb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <write>:
+SYSCALL(write)
+ 5d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <close>:
+SYSCALL(close)
+ 5db:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <kill>:
+SYSCALL(kill)
+ 5e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <exec>:
+SYSCALL(exec)
+ 5eb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <open>:
+SYSCALL(open)
+ 5f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <mknod>:
+SYSCALL(mknod)
+ 5fb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <unlink>:
+SYSCALL(unlink)
+ 603:	b8 12 00 00 00       	mov    $0x12,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <fstat>:
+SYSCALL(fstat)
+ 60b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <link>:
+SYSCALL(link)
+ 613:	b8 13 00 00 00       	mov    $0x13,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <mkdir>:
+SYSCALL(mkdir)
+ 61b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <chdir>:
+SYSCALL(chdir)
+ 623:	b8 09 00 00 00       	mov    $0x9,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <dup>:
+SYSCALL(dup)
+ 62b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <getpid>:
+SYSCALL(getpid)
+ 633:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <sbrk>:
+SYSCALL(sbrk)
+ 63b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <sleep>:
+SYSCALL(sleep)
+ 643:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <uptime>:
+SYSCALL(uptime)
+ 64b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <getdate>:
+SYSCALL(getdate)
+ 653:	b8 16 00 00 00       	mov    $0x16,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <setdate>:
+SYSCALL(setdate)
+ 65b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <mount>:
+SYSCALL(mount)
+ 663:	b8 18 00 00 00       	mov    $0x18,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <unmount>:
+SYSCALL(unmount)
+ 66b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <lseek>:
+SYSCALL(lseek)
+ 673:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <mmap>:
+SYSCALL(mmap)
+ 67b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <munmap>:
+SYSCALL(munmap)
+ 683:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <clock_gettime>:
+SYSCALL(clock_gettime)
+ 68b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <nanosleep>:
+SYSCALL(nanosleep)
+ 693:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 69b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 6a3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <proclimit>:
+SYSCALL(proclimit)
+ 6ab:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <procinfo>:
+SYSCALL(procinfo)
+ 6b3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <cpuinfo>:
+SYSCALL(cpuinfo)
+ 6bb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <schedstat>:
+SYSCALL(schedstat)
+ 6c3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <lockstat>:
+SYSCALL(lockstat)
+ 6cb:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <bcachestat>:
+SYSCALL(bcachestat)
+ 6d3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <diskstat>:
+SYSCALL(diskstat)
+ 6db:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <iosched>:
+SYSCALL(iosched)
+ 6e3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+ 6eb:	66 90                	xchg   %ax,%ax
+ 6ed:	66 90                	xchg   %ax,%ax
+ 6ef:	90                   	nop
+
+000006f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	57                   	push   %edi
+ 6f4:	56                   	push   %esi
+ 6f5:	53                   	push   %ebx
+ 6f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6f8:	89 d1                	mov    %edx,%ecx
+{
+ 6fa:	83 ec 3c             	sub    $0x3c,%esp
+ 6fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 700:	85 d2                	test   %edx,%edx
+ 702:	0f 89 80 00 00 00    	jns    788 <printint+0x98>
+ 708:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 70c:	74 7a                	je     788 <printint+0x98>
+    x = -xx;
+ 70e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 710:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 715:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 718:	31 f6                	xor    %esi,%esi
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 720:	89 c8                	mov    %ecx,%eax
+ 722:	31 d2                	xor    %edx,%edx
+ 724:	89 f7                	mov    %esi,%edi
+ 726:	f7 f3                	div    %ebx
+ 728:	8d 76 01             	lea    0x1(%esi),%esi
+ 72b:	0f b6 92 c8 0c 00 00 	movzbl 0xcc8(%edx),%edx
+ 732:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 736:	89 ca                	mov    %ecx,%edx
+ 738:	89 c1                	mov    %eax,%ecx
+ 73a:	39 da                	cmp    %ebx,%edx
+ 73c:	73 e2                	jae    720 <printint+0x30>
+  if(neg)
+ 73e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 741:	85 c0                	test   %eax,%eax
+ 743:	74 07                	je     74c <printint+0x5c>
+    buf[i++] = '-';
+ 745:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 74a:	89 f7                	mov    %esi,%edi
+ 74c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 74f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 752:	01 df                	add    %ebx,%edi
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 758:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 761:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 764:	6a 01                	push   $0x1
+ 766:	50                   	push   %eax
+ 767:	56                   	push   %esi
+ 768:	e8 66 fe ff ff       	call   5d3 <write>
+  while(--i >= 0)
+ 76d:	89 f8                	mov    %edi,%eax
+ 76f:	83 c4 10             	add    $0x10,%esp
+ 772:	83 ef 01             	sub    $0x1,%edi
+ 775:	39 d8                	cmp    %ebx,%eax
+ 777:	75 df                	jne    758 <printint+0x68>
+}
+ 779:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 77c:	5b                   	pop    %ebx
+ 77d:	5e                   	pop    %esi
+ 77e:	5f                   	pop    %edi
+ 77f:	5d                   	pop    %ebp
+ 780:	c3                   	ret
+ 781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 788:	31 c0                	xor    %eax,%eax
+ 78a:	eb 89                	jmp    715 <printint+0x25>
+ 78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000790 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	53                   	push   %ebx
+ 796:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 799:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+ 79c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 79f:	0f b6 1e             	movzbl (%esi),%ebx
+ 7a2:	83 c6 01             	add    $0x1,%esi
+ 7a5:	84 db                	test   %bl,%bl
+ 7a7:	74 67                	je     810 <printf+0x80>
+ 7a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 7ac:	31 d2                	xor    %edx,%edx
+ 7ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7b1:	eb 34                	jmp    7e7 <printf+0x57>
+ 7b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7b7:	90                   	nop
+ 7b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7c0:	83 f8 25             	cmp    $0x25,%eax
+ 7c3:	74 18                	je     7dd <printf+0x4d>
+  write(fd, &c, 1);
+ 7c5:	83 ec 04             	sub    $0x4,%esp
+ 7c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7ce:	6a 01                	push   $0x1
+ 7d0:	50                   	push   %eax
+ 7d1:	57                   	push   %edi
+ 7d2:	e8 fc fd ff ff       	call   5d3 <write>
+ 7d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 7e0:	83 c6 01             	add    $0x1,%esi
+ 7e3:	84 db                	test   %bl,%bl
+ 7e5:	74 29                	je     810 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7ea:	85 d2                	test   %edx,%edx
+ 7ec:	74 ca                	je     7b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7ee:	83 fa 25             	cmp    $0x25,%edx
+ 7f1:	75 ea                	jne    7dd <printf+0x4d>
+      if(c == 'd'){
+ 7f3:	83 f8 25             	cmp    $0x25,%eax
+ 7f6:	0f 84 24 01 00 00    	je     920 <printf+0x190>
+ 7fc:	83 e8 63             	sub    $0x63,%eax
+ 7ff:	83 f8 15             	cmp    $0x15,%eax
+ 802:	77 1c                	ja     820 <printf+0x90>
+ 804:	ff 24 85 70 0c 00 00 	jmp    *0xc70(,%eax,4)
+ 80b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 810:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 813:	5b                   	pop    %ebx
+ 814:	5e                   	pop    %esi
+ 815:	5f                   	pop    %edi
+ 816:	5d                   	pop    %ebp
+ 817:	c3                   	ret
+ 818:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 81f:	90                   	nop
+  write(fd, &c, 1);
+ 820:	83 ec 04             	sub    $0x4,%esp
+ 823:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 826:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 82a:	6a 01                	push   $0x1
+ 82c:	52                   	push   %edx
+ 82d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 830:	57                   	push   %edi
+ 831:	e8 9d fd ff ff       	call   5d3 <write>
+ 836:	83 c4 0c             	add    $0xc,%esp
+ 839:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 83c:	6a 01                	push   $0x1
+ 83e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 841:	52                   	push   %edx
+ 842:	57                   	push   %edi
+ 843:	e8 8b fd ff ff       	call   5d3 <write>
+        putc(fd, c);
+ 848:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 84b:	31 d2                	xor    %edx,%edx
+ 84d:	eb 8e                	jmp    7dd <printf+0x4d>
+ 84f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 850:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 853:	83 ec 0c             	sub    $0xc,%esp
+ 856:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 85b:	8b 13                	mov    (%ebx),%edx
+ 85d:	6a 00                	push   $0x0
+ 85f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 861:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 864:	e8 87 fe ff ff       	call   6f0 <printint>
+        ap++;
+ 869:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 86c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 86f:	31 d2                	xor    %edx,%edx
+ 871:	e9 67 ff ff ff       	jmp    7dd <printf+0x4d>
+ 876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 880:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 883:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 885:	83 c0 04             	add    $0x4,%eax
+ 888:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 88b:	85 db                	test   %ebx,%ebx
+ 88d:	0f 84 9d 00 00 00    	je     930 <printf+0x1a0>
+        while(*s != 0){
+ 893:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 896:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 898:	84 c0                	test   %al,%al
+ 89a:	0f 84 3d ff ff ff    	je     7dd <printf+0x4d>
+ 8a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 8a6:	89 de                	mov    %ebx,%esi
+ 8a8:	89 d3                	mov    %edx,%ebx
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8b0:	83 ec 04             	sub    $0x4,%esp
+ 8b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8b9:	6a 01                	push   $0x1
+ 8bb:	53                   	push   %ebx
+ 8bc:	57                   	push   %edi
+ 8bd:	e8 11 fd ff ff       	call   5d3 <write>
+        while(*s != 0){
+ 8c2:	0f b6 06             	movzbl (%esi),%eax
+ 8c5:	83 c4 10             	add    $0x10,%esp
+ 8c8:	84 c0                	test   %al,%al
+ 8ca:	75 e4                	jne    8b0 <printf+0x120>
+      state = 0;
+ 8cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8cf:	31 d2                	xor    %edx,%edx
+ 8d1:	e9 07 ff ff ff       	jmp    7dd <printf+0x4d>
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8eb:	8b 13                	mov    (%ebx),%edx
+ 8ed:	6a 01                	push   $0x1
+ 8ef:	e9 6b ff ff ff       	jmp    85f <printf+0xcf>
+ 8f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8fb:	83 ec 04             	sub    $0x4,%esp
+ 8fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 901:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 903:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 906:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 909:	6a 01                	push   $0x1
+ 90b:	52                   	push   %edx
+ 90c:	57                   	push   %edi
+ 90d:	e8 c1 fc ff ff       	call   5d3 <write>
+        ap++;
+ 912:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 915:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 918:	31 d2                	xor    %edx,%edx
+ 91a:	e9 be fe ff ff       	jmp    7dd <printf+0x4d>
+ 91f:	90                   	nop
+  write(fd, &c, 1);
+ 920:	83 ec 04             	sub    $0x4,%esp
+ 923:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 926:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 929:	6a 01                	push   $0x1
+ 92b:	e9 11 ff ff ff       	jmp    841 <printf+0xb1>
+ 930:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 935:	bb 63 0c 00 00       	mov    $0xc63,%ebx
+ 93a:	e9 61 ff ff ff       	jmp    8a0 <printf+0x110>
+ 93f:	90                   	nop
+
+00000940 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+ 945:	53                   	push   %ebx
+ 946:	83 ec 20             	sub    $0x20,%esp
+ 949:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 94c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+ 94f:	57                   	push   %edi
+ 950:	68 6a 0c 00 00       	push   $0xc6a
+ 955:	53                   	push   %ebx
+ 956:	e8 35 fe ff ff       	call   790 <printf>
+  for(n = strlen(s); n < w; n++)
+ 95b:	89 3c 24             	mov    %edi,(%esp)
+ 95e:	e8 9d fa ff ff       	call   400 <strlen>
+ 963:	83 c4 10             	add    $0x10,%esp
+ 966:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 969:	7d 20                	jge    98b <pads+0x4b>
+ 96b:	89 c6                	mov    %eax,%esi
+ 96d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+ 970:	83 ec 04             	sub    $0x4,%esp
+ 973:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+ 977:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 97a:	6a 01                	push   $0x1
+ 97c:	57                   	push   %edi
+ 97d:	53                   	push   %ebx
+ 97e:	e8 50 fc ff ff       	call   5d3 <write>
+  for(n = strlen(s); n < w; n++)
+ 983:	83 c4 10             	add    $0x10,%esp
+ 986:	39 75 10             	cmp    %esi,0x10(%ebp)
+ 989:	75 e5                	jne    970 <pads+0x30>
+    putc(fd, ' ');
+}
+ 98b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 98e:	5b                   	pop    %ebx
+ 98f:	5e                   	pop    %esi
+ 990:	5f                   	pop    %edi
+ 991:	5d                   	pop    %ebp
+ 992:	c3                   	ret
+ 993:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000009a0 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+ 9a0:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+ 9a1:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+ 9a6:	89 e5                	mov    %esp,%ebp
+ 9a8:	57                   	push   %edi
+ 9a9:	56                   	push   %esi
+ 9aa:	53                   	push   %ebx
+  int n = 0;
+ 9ab:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+ 9ad:	83 ec 2c             	sub    $0x2c,%esp
+ 9b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9b3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 9b6:	8b 75 08             	mov    0x8(%ebp),%esi
+ 9b9:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 9bc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 9bf:	90                   	nop
+  }while((x /= 10) != 0);
+ 9c0:	89 d0                	mov    %edx,%eax
+ 9c2:	89 d7                	mov    %edx,%edi
+    n++;
+ 9c4:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+ 9c7:	f7 e1                	mul    %ecx
+ 9c9:	c1 ea 03             	shr    $0x3,%edx
+ 9cc:	83 ff 09             	cmp    $0x9,%edi
+ 9cf:	77 ef                	ja     9c0 <padd+0x20>
+  for(; n < w; n++)
+ 9d1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 9d4:	39 c3                	cmp    %eax,%ebx
+ 9d6:	7d 23                	jge    9fb <padd+0x5b>
+ 9d8:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 9db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9df:	90                   	nop
+  write(fd, &c, 1);
+ 9e0:	83 ec 04             	sub    $0x4,%esp
+ 9e3:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+ 9e7:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+ 9ea:	6a 01                	push   $0x1
+ 9ec:	57                   	push   %edi
+ 9ed:	56                   	push   %esi
+ 9ee:	e8 e0 fb ff ff       	call   5d3 <write>
+  for(; n < w; n++)
+ 9f3:	83 c4 10             	add    $0x10,%esp
+ 9f6:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+ 9f9:	75 e5                	jne    9e0 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+ 9fb:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+ a02:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+ a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+ a08:	89 f0                	mov    %esi,%eax
+}
+ a0a:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+ a0b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+ a10:	5e                   	pop    %esi
+ a11:	5f                   	pop    %edi
+ a12:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+ a13:	e9 d8 fc ff ff       	jmp    6f0 <printint>
+ a18:	66 90                	xchg   %ax,%ax
+ a1a:	66 90                	xchg   %ax,%ax
+ a1c:	66 90                	xchg   %ax,%ax
+ a1e:	66 90                	xchg   %ax,%ax
+
+00000a20 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a21:	a1 00 22 00 00       	mov    0x2200,%eax
+{
+ a26:	89 e5                	mov    %esp,%ebp
+ a28:	57                   	push   %edi
+ a29:	56                   	push   %esi
+ a2a:	53                   	push   %ebx
+ a2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a2e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a38:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a3a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a3c:	39 ca                	cmp    %ecx,%edx
+ a3e:	73 30                	jae    a70 <free+0x50>
+ a40:	39 c1                	cmp    %eax,%ecx
+ a42:	72 04                	jb     a48 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a44:	39 c2                	cmp    %eax,%edx
+ a46:	72 f0                	jb     a38 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a48:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a4b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a4e:	39 f8                	cmp    %edi,%eax
+ a50:	74 2e                	je     a80 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a52:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a55:	8b 42 04             	mov    0x4(%edx),%eax
+ a58:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a5b:	39 f1                	cmp    %esi,%ecx
+ a5d:	74 38                	je     a97 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a5f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a61:	5b                   	pop    %ebx
+  freep = p;
+ a62:	89 15 00 22 00 00    	mov    %edx,0x2200
+}
+ a68:	5e                   	pop    %esi
+ a69:	5f                   	pop    %edi
+ a6a:	5d                   	pop    %ebp
+ a6b:	c3                   	ret
+ a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a70:	39 c1                	cmp    %eax,%ecx
+ a72:	72 d0                	jb     a44 <free+0x24>
+ a74:	eb c2                	jmp    a38 <free+0x18>
+ a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a80:	03 70 04             	add    0x4(%eax),%esi
+ a83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a86:	8b 02                	mov    (%edx),%eax
+ a88:	8b 00                	mov    (%eax),%eax
+ a8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a8d:	8b 42 04             	mov    0x4(%edx),%eax
+ a90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a93:	39 f1                	cmp    %esi,%ecx
+ a95:	75 c8                	jne    a5f <free+0x3f>
+    p->s.size += bp->s.size;
+ a97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a9a:	89 15 00 22 00 00    	mov    %edx,0x2200
+    p->s.size += bp->s.size;
+ aa0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ aa3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ aa6:	89 0a                	mov    %ecx,(%edx)
+}
+ aa8:	5b                   	pop    %ebx
+ aa9:	5e                   	pop    %esi
+ aaa:	5f                   	pop    %edi
+ aab:	5d                   	pop    %ebp
+ aac:	c3                   	ret
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ab0 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	57                   	push   %edi
+ ab4:	56                   	push   %esi
+ ab5:	53                   	push   %ebx
+ ab6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ abc:	8b 15 00 22 00 00    	mov    0x2200,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ac2:	8d 78 07             	lea    0x7(%eax),%edi
+ ac5:	c1 ef 03             	shr    $0x3,%edi
+ ac8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ acb:	85 d2                	test   %edx,%edx
+ acd:	0f 84 8d 00 00 00    	je     b60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ad3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ad5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ad8:	39 f9                	cmp    %edi,%ecx
+ ada:	73 64                	jae    b40 <malloc+0x90>
+  if(nu < 4096)
+ adc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ae1:	39 df                	cmp    %ebx,%edi
+ ae3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ae6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ aed:	eb 0a                	jmp    af9 <malloc+0x49>
+ aef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ af0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ af2:	8b 48 04             	mov    0x4(%eax),%ecx
+ af5:	39 f9                	cmp    %edi,%ecx
+ af7:	73 47                	jae    b40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ af9:	89 c2                	mov    %eax,%edx
+ afb:	39 05 00 22 00 00    	cmp    %eax,0x2200
+ b01:	75 ed                	jne    af0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b03:	83 ec 0c             	sub    $0xc,%esp
+ b06:	56                   	push   %esi
+ b07:	e8 2f fb ff ff       	call   63b <sbrk>
+  if(p == (char*)-1)
+ b0c:	83 c4 10             	add    $0x10,%esp
+ b0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b12:	74 1c                	je     b30 <malloc+0x80>
+  hp->s.size = nu;
+ b14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b17:	83 ec 0c             	sub    $0xc,%esp
+ b1a:	83 c0 08             	add    $0x8,%eax
+ b1d:	50                   	push   %eax
+ b1e:	e8 fd fe ff ff       	call   a20 <free>
+  return freep;
+ b23:	8b 15 00 22 00 00    	mov    0x2200,%edx
+      if((p = morecore(nunits)) == 0)
+ b29:	83 c4 10             	add    $0x10,%esp
+ b2c:	85 d2                	test   %edx,%edx
+ b2e:	75 c0                	jne    af0 <malloc+0x40>
+        return 0;
+  }
+}
+ b30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b33:	31 c0                	xor    %eax,%eax
+}
+ b35:	5b                   	pop    %ebx
+ b36:	5e                   	pop    %esi
+ b37:	5f                   	pop    %edi
+ b38:	5d                   	pop    %ebp
+ b39:	c3                   	ret
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b40:	39 cf                	cmp    %ecx,%edi
+ b42:	74 4c                	je     b90 <malloc+0xe0>
+        p->s.size -= nunits;
+ b44:	29 f9                	sub    %edi,%ecx
+ b46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b4f:	89 15 00 22 00 00    	mov    %edx,0x2200
+}
+ b55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b58:	83 c0 08             	add    $0x8,%eax
+}
+ b5b:	5b                   	pop    %ebx
+ b5c:	5e                   	pop    %esi
+ b5d:	5f                   	pop    %edi
+ b5e:	5d                   	pop    %ebp
+ b5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b60:	c7 05 00 22 00 00 04 	movl   $0x2204,0x2200
+ b67:	22 00 00 
+    base.s.size = 0;
+ b6a:	b8 04 22 00 00       	mov    $0x2204,%eax
+    base.s.ptr = freep = prevp = &base;
+ b6f:	c7 05 04 22 00 00 04 	movl   $0x2204,0x2204
+ b76:	22 00 00 
+    base.s.size = 0;
+ b79:	c7 05 08 22 00 00 00 	movl   $0x0,0x2208
+ b80:	00 00 00 
+    if(p->s.size >= nunits){
+ b83:	e9 54 ff ff ff       	jmp    adc <malloc+0x2c>
+ b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b90:	8b 08                	mov    (%eax),%ecx
+ b92:	89 0a                	mov    %ecx,(%edx)
+ b94:	eb b9                	jmp    b4f <malloc+0x9f>
@@ -0,0 +1,85 @@
+#include "kernel/types.h"
+#include "kernel/lockstat.h"
+#include "user.h"
+
+/* Subtract the counters in a from the matching class in b */
+static void
+delta(struct lockinfo *a, int na, struct lockinfo *b) {
+  int i;
+
+  for(i = 0; i < na; ++i) {
+    if(a[i].sleep != b->sleep || strcmp(a[i].name, b->name) != 0)
+      continue;
+    b->nacq -= a[i].nacq;
+    b->ncont -= a[i].ncont;
+    b->spin -= a[i].spin;
+    return;
+  }
+}
+
+/* Most contended first: by time spent waiting, then by waits */
+static int
+worse(struct lockinfo *a, struct lockinfo *b) {
+  if(a->spin != b->spin)
+    return a->spin > b->spin;
+  return a->ncont > b->ncont;
+}
+
+static void
+show(struct lockinfo *li, int n) {
+  int i, j, order[NLOCKCLASS];
+
+  for(i = 0; i < n; ++i) {
+    for(j = i; j > 0 && worse(&li[i], &li[order[j-1]]); --j)
+      order[j] = order[j-1];
+    order[j] = i;
+  }
+
+  printf(1, "NAME            TYPE       ACQ   CONT  %%CONT  WAIT(kcyc) MAXHOLD(kcyc)\n");
+  for(i = 0; i < n; ++i) {
+    struct lockinfo *l = &li[order[i]];
+
+    if(l->nacq == 0)
+      continue;
+    pads(1, l->name, 16);
+    pads(1, l->sleep ? "sleep" : "spin", 5);
+    padd(1, l->nacq, 9);
+    padd(1, l->ncont, 7);
+    padd(1, l->ncont * 100 / l->nacq, 7);
+    padd(1, l->spin, 12);
+    padd(1, l->maxhold, 14);
+    printf(1, "\n");
+  }
+}
+
+int
+main(int argc, char *argv[]) {
+  static struct lockinfo before[NLOCKCLASS], after[NLOCKCLASS];
+  int secs, nb, na, i;
+
+  secs = argc > 1 ? atoi(argv[1]) : 0;
+  if(secs < 0) {
+    printf(2, "usage: lockstat [seconds]\n");
+    exit(1);
+  }
+
+  if((nb = lockstat(before, NLOCKCLASS)) < 0) {
+    printf(2, "lockstat: lock statistics are not compiled in\n");
+    exit(1);
+  }
+  if(secs == 0) {
+    /* Totals since boot */
+    show(before, nb);
+    exit(0);
+  }
+
+  sleep(secs * 100);
+  if((na = lockstat(after, NLOCKCLASS)) < 0) {
+    printf(2, "lockstat: cannot read lock statistics\n");
+    exit(1);
+  }
+  for(i = 0; i < na; ++i)
+    delta(before, nb, &after[i]);
+  show(after, na);
+  exit(0);
+}
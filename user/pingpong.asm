@@ -0,0 +1,1634 @@
+
+_pingpong:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    total += ss[i].nhandoff;
+  return total;
+}
+
+int
+main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 38             	sub    $0x38,%esp
+  int ping[2], pong[2], rounds, i, pid;
+  uint t0, t1, h0, h1;
+  char c = 0;
+
+  rounds = argc > 1 ? atoi(argv[1]) : 10000;
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+main(int argc, char *argv[]) {
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  char c = 0;
+  1a:	c6 45 d7 00          	movb   $0x0,-0x29(%ebp)
+  rounds = argc > 1 ? atoi(argv[1]) : 10000;
+  1e:	0f 8e c2 00 00 00    	jle    e6 <main+0xe6>
+  24:	83 ec 0c             	sub    $0xc,%esp
+  27:	ff 70 04             	push   0x4(%eax)
+  2a:	e8 21 04 00 00       	call   450 <atoi>
+  if(rounds <= 0) {
+  2f:	83 c4 10             	add    $0x10,%esp
+  rounds = argc > 1 ? atoi(argv[1]) : 10000;
+  32:	89 c3                	mov    %eax,%ebx
+  if(rounds <= 0) {
+  34:	85 c0                	test   %eax,%eax
+  36:	0f 8e b4 00 00 00    	jle    f0 <main+0xf0>
+    printf(2, "usage: pingpong [rounds]\n");
+    exit(1);
+  }
+  if(pipe(ping) < 0 || pipe(pong) < 0) {
+  3c:	83 ec 0c             	sub    $0xc,%esp
+  3f:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  42:	50                   	push   %eax
+  43:	e8 8b 04 00 00       	call   4d3 <pipe>
+  48:	83 c4 10             	add    $0x10,%esp
+  4b:	85 c0                	test   %eax,%eax
+  4d:	78 13                	js     62 <main+0x62>
+  4f:	83 ec 0c             	sub    $0xc,%esp
+  52:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  55:	50                   	push   %eax
+  56:	e8 78 04 00 00       	call   4d3 <pipe>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	85 c0                	test   %eax,%eax
+  60:	79 1a                	jns    7c <main+0x7c>
+    printf(2, "pingpong: pipe failed\n");
+  62:	50                   	push   %eax
+  63:	50                   	push   %eax
+  64:	68 c2 0a 00 00       	push   $0xac2
+  69:	6a 02                	push   $0x2
+  6b:	e8 30 06 00 00       	call   6a0 <printf>
+    exit(1);
+  70:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  77:	e8 47 04 00 00       	call   4c3 <exit>
+  }
+
+  if((pid = fork()) < 0) {
+  7c:	e8 3a 04 00 00       	call   4bb <fork>
+  81:	85 c0                	test   %eax,%eax
+  83:	0f 88 81 00 00 00    	js     10a <main+0x10a>
+    printf(2, "pingpong: fork failed\n");
+    exit(1);
+  }
+  if(pid == 0) {
+  89:	0f 85 95 00 00 00    	jne    124 <main+0x124>
+    /* Echo every byte back */
+    close(ping[1]);
+  8f:	83 ec 0c             	sub    $0xc,%esp
+  92:	ff 75 dc             	push   -0x24(%ebp)
+  95:	8d 75 d7             	lea    -0x29(%ebp),%esi
+  98:	e8 4e 04 00 00       	call   4eb <close>
+    close(pong[0]);
+  9d:	58                   	pop    %eax
+  9e:	ff 75 e0             	push   -0x20(%ebp)
+  a1:	e8 45 04 00 00       	call   4eb <close>
+    while(read(ping[0], &c, 1) == 1)
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	eb 1b                	jmp    c6 <main+0xc6>
+  ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  af:	90                   	nop
+      if(write(pong[1], &c, 1) != 1)
+  b0:	83 ec 04             	sub    $0x4,%esp
+  b3:	6a 01                	push   $0x1
+  b5:	56                   	push   %esi
+  b6:	ff 75 e4             	push   -0x1c(%ebp)
+  b9:	e8 25 04 00 00       	call   4e3 <write>
+  be:	83 c4 10             	add    $0x10,%esp
+  c1:	83 f8 01             	cmp    $0x1,%eax
+  c4:	75 16                	jne    dc <main+0xdc>
+    while(read(ping[0], &c, 1) == 1)
+  c6:	83 ec 04             	sub    $0x4,%esp
+  c9:	6a 01                	push   $0x1
+  cb:	56                   	push   %esi
+  cc:	ff 75 d8             	push   -0x28(%ebp)
+  cf:	e8 07 04 00 00       	call   4db <read>
+  d4:	83 c4 10             	add    $0x10,%esp
+  d7:	83 f8 01             	cmp    $0x1,%eax
+  da:	74 d4                	je     b0 <main+0xb0>
+        break;
+    exit(0);
+  dc:	83 ec 0c             	sub    $0xc,%esp
+  df:	6a 00                	push   $0x0
+  e1:	e8 dd 03 00 00       	call   4c3 <exit>
+  rounds = argc > 1 ? atoi(argv[1]) : 10000;
+  e6:	bb 10 27 00 00       	mov    $0x2710,%ebx
+  eb:	e9 4c ff ff ff       	jmp    3c <main+0x3c>
+    printf(2, "usage: pingpong [rounds]\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 a8 0a 00 00       	push   $0xaa8
+  f7:	6a 02                	push   $0x2
+  f9:	e8 a2 05 00 00       	call   6a0 <printf>
+    exit(1);
+  fe:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 105:	e8 b9 03 00 00       	call   4c3 <exit>
+    printf(2, "pingpong: fork failed\n");
+ 10a:	50                   	push   %eax
+ 10b:	50                   	push   %eax
+ 10c:	68 d9 0a 00 00       	push   $0xad9
+ 111:	6a 02                	push   $0x2
+ 113:	e8 88 05 00 00       	call   6a0 <printf>
+    exit(1);
+ 118:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 11f:	e8 9f 03 00 00       	call   4c3 <exit>
+  }
+  close(ping[0]);
+ 124:	83 ec 0c             	sub    $0xc,%esp
+ 127:	ff 75 d8             	push   -0x28(%ebp)
+ 12a:	8d 75 d7             	lea    -0x29(%ebp),%esi
+ 12d:	e8 b9 03 00 00       	call   4eb <close>
+  close(pong[1]);
+ 132:	5f                   	pop    %edi
+ 133:	ff 75 e4             	push   -0x1c(%ebp)
+
+  h0 = handoffs();
+  t0 = usnow();
+  for(i = 0; i < rounds; ++i) {
+ 136:	31 ff                	xor    %edi,%edi
+  close(pong[1]);
+ 138:	e8 ae 03 00 00       	call   4eb <close>
+  h0 = handoffs();
+ 13d:	e8 fe 00 00 00       	call   240 <handoffs>
+ 142:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  t0 = usnow();
+ 145:	e8 c6 00 00 00       	call   210 <usnow>
+ 14a:	83 c4 10             	add    $0x10,%esp
+ 14d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  for(i = 0; i < rounds; ++i) {
+ 150:	eb 27                	jmp    179 <main+0x179>
+ 152:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(write(ping[1], &c, 1) != 1 || read(pong[0], &c, 1) != 1) {
+ 158:	83 ec 04             	sub    $0x4,%esp
+ 15b:	6a 01                	push   $0x1
+ 15d:	56                   	push   %esi
+ 15e:	ff 75 e0             	push   -0x20(%ebp)
+ 161:	e8 75 03 00 00       	call   4db <read>
+ 166:	83 c4 10             	add    $0x10,%esp
+ 169:	83 f8 01             	cmp    $0x1,%eax
+ 16c:	75 21                	jne    18f <main+0x18f>
+  for(i = 0; i < rounds; ++i) {
+ 16e:	83 c7 01             	add    $0x1,%edi
+      printf(2, "pingpong: round %d failed\n", i);
+      exit(1);
+    }
+    ++c;
+ 171:	80 45 d7 01          	addb   $0x1,-0x29(%ebp)
+  for(i = 0; i < rounds; ++i) {
+ 175:	39 fb                	cmp    %edi,%ebx
+ 177:	74 30                	je     1a9 <main+0x1a9>
+    if(write(ping[1], &c, 1) != 1 || read(pong[0], &c, 1) != 1) {
+ 179:	83 ec 04             	sub    $0x4,%esp
+ 17c:	6a 01                	push   $0x1
+ 17e:	56                   	push   %esi
+ 17f:	ff 75 dc             	push   -0x24(%ebp)
+ 182:	e8 5c 03 00 00       	call   4e3 <write>
+ 187:	83 c4 10             	add    $0x10,%esp
+ 18a:	83 f8 01             	cmp    $0x1,%eax
+ 18d:	74 c9                	je     158 <main+0x158>
+      printf(2, "pingpong: round %d failed\n", i);
+ 18f:	56                   	push   %esi
+ 190:	57                   	push   %edi
+ 191:	68 f0 0a 00 00       	push   $0xaf0
+ 196:	6a 02                	push   $0x2
+ 198:	e8 03 05 00 00       	call   6a0 <printf>
+      exit(1);
+ 19d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 1a4:	e8 1a 03 00 00       	call   4c3 <exit>
+  }
+  t1 = usnow();
+ 1a9:	e8 62 00 00 00       	call   210 <usnow>
+ 1ae:	89 c6                	mov    %eax,%esi
+  h1 = handoffs();
+ 1b0:	e8 8b 00 00 00       	call   240 <handoffs>
+
+  close(ping[1]);
+ 1b5:	83 ec 0c             	sub    $0xc,%esp
+ 1b8:	ff 75 dc             	push   -0x24(%ebp)
+  h1 = handoffs();
+ 1bb:	89 c7                	mov    %eax,%edi
+  close(ping[1]);
+ 1bd:	e8 29 03 00 00       	call   4eb <close>
+  wait(0);
+ 1c2:	31 c0                	xor    %eax,%eax
+ 1c4:	89 04 24             	mov    %eax,(%esp)
+ 1c7:	e8 ff 02 00 00       	call   4cb <wait>
+  printf(1, "%d round trips in %d us, %d us each, %d hand-offs\n",
+         rounds, t1 - t0, (t1 - t0) / rounds, h1 - h0);
+ 1cc:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  printf(1, "%d round trips in %d us, %d us each, %d hand-offs\n",
+ 1cf:	5a                   	pop    %edx
+ 1d0:	31 d2                	xor    %edx,%edx
+ 1d2:	59                   	pop    %ecx
+         rounds, t1 - t0, (t1 - t0) / rounds, h1 - h0);
+ 1d3:	29 c6                	sub    %eax,%esi
+  printf(1, "%d round trips in %d us, %d us each, %d hand-offs\n",
+ 1d5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 1d8:	29 c7                	sub    %eax,%edi
+ 1da:	89 f0                	mov    %esi,%eax
+ 1dc:	f7 f3                	div    %ebx
+ 1de:	57                   	push   %edi
+ 1df:	50                   	push   %eax
+ 1e0:	56                   	push   %esi
+ 1e1:	53                   	push   %ebx
+  printf(1, "pingpong ok\n");
+  exit(0);
+ 1e2:	31 db                	xor    %ebx,%ebx
+  printf(1, "%d round trips in %d us, %d us each, %d hand-offs\n",
+ 1e4:	68 18 0b 00 00       	push   $0xb18
+ 1e9:	6a 01                	push   $0x1
+ 1eb:	e8 b0 04 00 00       	call   6a0 <printf>
+  printf(1, "pingpong ok\n");
+ 1f0:	83 c4 18             	add    $0x18,%esp
+ 1f3:	68 0b 0b 00 00       	push   $0xb0b
+ 1f8:	6a 01                	push   $0x1
+ 1fa:	e8 a1 04 00 00       	call   6a0 <printf>
+  exit(0);
+ 1ff:	89 1c 24             	mov    %ebx,(%esp)
+ 202:	e8 bc 02 00 00       	call   4c3 <exit>
+ 207:	66 90                	xchg   %ax,%ax
+ 209:	66 90                	xchg   %ax,%ax
+ 20b:	66 90                	xchg   %ax,%ax
+ 20d:	66 90                	xchg   %ax,%ax
+ 20f:	90                   	nop
+
+00000210 <usnow>:
+usnow(void) {
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	83 ec 20             	sub    $0x20,%esp
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+ 216:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 219:	50                   	push   %eax
+ 21a:	6a 01                	push   $0x1
+ 21c:	e8 7a 03 00 00       	call   59b <clock_gettime>
+  return ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+ 221:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+ 226:	f7 65 f4             	mull   -0xc(%ebp)
+ 229:	69 4d f0 40 42 0f 00 	imul   $0xf4240,-0x10(%ebp),%ecx
+}
+ 230:	c9                   	leave
+  return ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+ 231:	c1 ea 06             	shr    $0x6,%edx
+ 234:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+}
+ 237:	c3                   	ret
+ 238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <handoffs>:
+handoffs(void) {
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	81 ec 90 03 00 00    	sub    $0x390,%esp
+  n = schedstat(ss, MAXCPU);
+ 249:	8d 85 78 fc ff ff    	lea    -0x388(%ebp),%eax
+ 24f:	6a 08                	push   $0x8
+ 251:	50                   	push   %eax
+ 252:	e8 7c 03 00 00       	call   5d3 <schedstat>
+  for(i = 0; i < n; ++i)
+ 257:	83 c4 10             	add    $0x10,%esp
+ 25a:	85 c0                	test   %eax,%eax
+ 25c:	7e 1d                	jle    27b <handoffs+0x3b>
+ 25e:	6b c0 70             	imul   $0x70,%eax,%eax
+ 261:	8d 95 88 fc ff ff    	lea    -0x378(%ebp),%edx
+ 267:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+  uint total = 0;
+ 26a:	31 c0                	xor    %eax,%eax
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    total += ss[i].nhandoff;
+ 270:	03 02                	add    (%edx),%eax
+  for(i = 0; i < n; ++i)
+ 272:	83 c2 70             	add    $0x70,%edx
+ 275:	39 ca                	cmp    %ecx,%edx
+ 277:	75 f7                	jne    270 <handoffs+0x30>
+}
+ 279:	c9                   	leave
+ 27a:	c3                   	ret
+ 27b:	c9                   	leave
+  uint total = 0;
+ 27c:	31 c0                	xor    %eax,%eax
+}
+ 27e:	c3                   	ret
+ 27f:	90                   	nop
+
+00000280 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 280:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 281:	31 c0                	xor    %eax,%eax
+{
+ 283:	89 e5                	mov    %esp,%ebp
+ 285:	53                   	push   %ebx
+ 286:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 289:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 290:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 294:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 297:	83 c0 01             	add    $0x1,%eax
+ 29a:	84 d2                	test   %dl,%dl
+ 29c:	75 f2                	jne    290 <strcpy+0x10>
+    ;
+  return os;
+}
+ 29e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a1:	89 c8                	mov    %ecx,%eax
+ 2a3:	c9                   	leave
+ 2a4:	c3                   	ret
+ 2a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ba:	0f b6 02             	movzbl (%edx),%eax
+ 2bd:	84 c0                	test   %al,%al
+ 2bf:	75 17                	jne    2d8 <strcmp+0x28>
+ 2c1:	eb 3a                	jmp    2fd <strcmp+0x4d>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2cc:	83 c2 01             	add    $0x1,%edx
+ 2cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2d2:	84 c0                	test   %al,%al
+ 2d4:	74 1a                	je     2f0 <strcmp+0x40>
+    p++, q++;
+ 2d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2db:	38 c3                	cmp    %al,%bl
+ 2dd:	74 e9                	je     2c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2df:	29 d8                	sub    %ebx,%eax
+}
+ 2e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e4:	c9                   	leave
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2f4:	31 c0                	xor    %eax,%eax
+ 2f6:	29 d8                	sub    %ebx,%eax
+}
+ 2f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2fb:	c9                   	leave
+ 2fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 300:	31 c0                	xor    %eax,%eax
+ 302:	eb db                	jmp    2df <strcmp+0x2f>
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 316:	80 3a 00             	cmpb   $0x0,(%edx)
+ 319:	74 15                	je     330 <strlen+0x20>
+ 31b:	31 c0                	xor    %eax,%eax
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+ 320:	83 c0 01             	add    $0x1,%eax
+ 323:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 327:	89 c1                	mov    %eax,%ecx
+ 329:	75 f5                	jne    320 <strlen+0x10>
+    ;
+  return n;
+}
+ 32b:	89 c8                	mov    %ecx,%eax
+ 32d:	5d                   	pop    %ebp
+ 32e:	c3                   	ret
+ 32f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 330:	31 c9                	xor    %ecx,%ecx
+}
+ 332:	5d                   	pop    %ebp
+ 333:	89 c8                	mov    %ecx,%eax
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 347:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 34a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 34d:	89 d7                	mov    %edx,%edi
+ 34f:	fc                   	cld
+ 350:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 352:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 355:	89 d0                	mov    %edx,%eax
+ 357:	c9                   	leave
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 36a:	0f b6 10             	movzbl (%eax),%edx
+ 36d:	84 d2                	test   %dl,%dl
+ 36f:	75 12                	jne    383 <strchr+0x23>
+ 371:	eb 1d                	jmp    390 <strchr+0x30>
+ 373:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 377:	90                   	nop
+ 378:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 37c:	83 c0 01             	add    $0x1,%eax
+ 37f:	84 d2                	test   %dl,%dl
+ 381:	74 0d                	je     390 <strchr+0x30>
+    if(*s == c)
+ 383:	38 d1                	cmp    %dl,%cl
+ 385:	75 f1                	jne    378 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 387:	5d                   	pop    %ebp
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 390:	31 c0                	xor    %eax,%eax
+}
+ 392:	5d                   	pop    %ebp
+ 393:	c3                   	ret
+ 394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3a9:	31 db                	xor    %ebx,%ebx
+{
+ 3ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ae:	eb 27                	jmp    3d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3b0:	83 ec 04             	sub    $0x4,%esp
+ 3b3:	6a 01                	push   $0x1
+ 3b5:	56                   	push   %esi
+ 3b6:	6a 00                	push   $0x0
+ 3b8:	e8 1e 01 00 00       	call   4db <read>
+    if(cc < 1)
+ 3bd:	83 c4 10             	add    $0x10,%esp
+ 3c0:	85 c0                	test   %eax,%eax
+ 3c2:	7e 1d                	jle    3e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3cf:	3c 0a                	cmp    $0xa,%al
+ 3d1:	74 10                	je     3e3 <gets+0x43>
+ 3d3:	3c 0d                	cmp    $0xd,%al
+ 3d5:	74 0c                	je     3e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3d7:	89 df                	mov    %ebx,%edi
+ 3d9:	83 c3 01             	add    $0x1,%ebx
+ 3dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3df:	7c cf                	jl     3b0 <gets+0x10>
+ 3e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ed:	5b                   	pop    %ebx
+ 3ee:	5e                   	pop    %esi
+ 3ef:	5f                   	pop    %edi
+ 3f0:	5d                   	pop    %ebp
+ 3f1:	c3                   	ret
+ 3f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 405:	83 ec 08             	sub    $0x8,%esp
+ 408:	6a 00                	push   $0x0
+ 40a:	ff 75 08             	push   0x8(%ebp)
+ 40d:	e8 f1 00 00 00       	call   503 <open>
+  if(fd < 0)
+ 412:	83 c4 10             	add    $0x10,%esp
+ 415:	85 c0                	test   %eax,%eax
+ 417:	78 27                	js     440 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 419:	83 ec 08             	sub    $0x8,%esp
+ 41c:	ff 75 0c             	push   0xc(%ebp)
+ 41f:	89 c3                	mov    %eax,%ebx
+ 421:	50                   	push   %eax
+ 422:	e8 f4 00 00 00       	call   51b <fstat>
+  close(fd);
+ 427:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 42a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 42c:	e8 ba 00 00 00       	call   4eb <close>
+  return r;
+ 431:	83 c4 10             	add    $0x10,%esp
+}
+ 434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 437:	89 f0                	mov    %esi,%eax
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5d                   	pop    %ebp
+ 43c:	c3                   	ret
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 445:	eb ed                	jmp    434 <stat+0x34>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 457:	0f be 02             	movsbl (%edx),%eax
+ 45a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 45d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 465:	77 1e                	ja     485 <atoi+0x35>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 470:	83 c2 01             	add    $0x1,%edx
+ 473:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 476:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 47a:	0f be 02             	movsbl (%edx),%eax
+ 47d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 480:	80 fb 09             	cmp    $0x9,%bl
+ 483:	76 eb                	jbe    470 <atoi+0x20>
+  return n;
+}
+ 485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 488:	89 c8                	mov    %ecx,%eax
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	8b 45 10             	mov    0x10(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 49e:	85 c0                	test   %eax,%eax
+ 4a0:	7e 13                	jle    4b5 <memmove+0x25>
+ 4a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4a4:	89 d7                	mov    %edx,%edi
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4b1:	39 f8                	cmp    %edi,%eax
+ 4b3:	75 fb                	jne    4b0 <memmove+0x20>
+  return vdst;
+}
+ 4b5:	5e                   	pop    %esi
+ 4b6:	89 d0                	mov    %edx,%eax
+ 4b8:	5f                   	pop    %edi
+ 4b9:	5d                   	pop    %ebp
+ 4ba:	c3                   	ret
+
+000004bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <exit>:
+SYSCALL(exit)
+ 4c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <wait>:
+SYSCALL(wait)
+ 4cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <pipe>:
+SYSCALL(pipe)
+ 4d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <read>:
+SYSCALL(read)
+ 4db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <write>:
+SYSCALL(write)
+ 4e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <close>:
+SYSCALL(close)
+ 4eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <kill>:
+SYSCALL(kill)
+ 4f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <exec>:
+SYSCALL(exec)
+ 4fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <open>:
+SYSCALL(open)
+ 503:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mknod>:
+SYSCALL(mknod)
+ 50b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <unlink>:
+SYSCALL(unlink)
+ 513:	b8 12 00 00 00       	mov    $0x12,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <fstat>:
+SYSCALL(fstat)
+ 51b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <link>:
+SYSCALL(link)
+ 523:	b8 13 00 00 00       	mov    $0x13,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mkdir>:
+SYSCALL(mkdir)
+ 52b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <chdir>:
+SYSCALL(chdir)
+ 533:	b8 09 00 00 00       	mov    $0x9,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <dup>:
+SYSCALL(dup)
+ 53b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <getpid>:
+SYSCALL(getpid)
+ 543:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <sbrk>:
+SYSCALL(sbrk)
+ 54b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <sleep>:
+SYSCALL(sleep)
+ 553:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <uptime>:
+SYSCALL(uptime)
+ 55b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <getdate>:
+SYSCALL(getdate)
+ 563:	b8 16 00 00 00       	mov    $0x16,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <setdate>:
+SYSCALL(setdate)
+ 56b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <mount>:
+SYSCALL(mount)
+ 573:	b8 18 00 00 00       	mov    $0x18,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <unmount>:
+SYSCALL(unmount)
+ 57b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <lseek>:
+SYSCALL(lseek)
+ 583:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <mmap>:
+SYSCALL(mmap)
+ 58b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <munmap>:
+SYSCALL(munmap)
+ 593:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+
+0000059b <clock_gettime>:
+SYSCALL(clock_gettime)
+ 59b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5a0:	cd 40                	int    $0x40
+ 5a2:	c3                   	ret
+
+000005a3 <nanosleep>:
+SYSCALL(nanosleep)
+ 5a3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 5ab:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5b0:	cd 40                	int    $0x40
+ 5b2:	c3                   	ret
+
+000005b3 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 5b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5b8:	cd 40                	int    $0x40
+ 5ba:	c3                   	ret
+
+000005bb <proclimit>:
+SYSCALL(proclimit)
+ 5bb:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5c0:	cd 40                	int    $0x40
+ 5c2:	c3                   	ret
+
+000005c3 <procinfo>:
+SYSCALL(procinfo)
+ 5c3:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5c8:	cd 40                	int    $0x40
+ 5ca:	c3                   	ret
+
+000005cb <cpuinfo>:
+SYSCALL(cpuinfo)
+ 5cb:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5d0:	cd 40                	int    $0x40
+ 5d2:	c3                   	ret
+
+000005d3 <schedstat>:
+SYSCALL(schedstat)
+ 5d3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <lockstat>:
+SYSCALL(lockstat)
+ 5db:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <bcachestat>:
+SYSCALL(bcachestat)
+ 5e3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <diskstat>:
+SYSCALL(diskstat)
+ 5eb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <iosched>:
+SYSCALL(iosched)
+ 5f3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+ 5fb:	66 90                	xchg   %ax,%ax
+ 5fd:	66 90                	xchg   %ax,%ax
+ 5ff:	90                   	nop
+
+00000600 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	53                   	push   %ebx
+ 606:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 608:	89 d1                	mov    %edx,%ecx
+{
+ 60a:	83 ec 3c             	sub    $0x3c,%esp
+ 60d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 610:	85 d2                	test   %edx,%edx
+ 612:	0f 89 80 00 00 00    	jns    698 <printint+0x98>
+ 618:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 61c:	74 7a                	je     698 <printint+0x98>
+    x = -xx;
+ 61e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 620:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 625:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 628:	31 f6                	xor    %esi,%esi
+ 62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 630:	89 c8                	mov    %ecx,%eax
+ 632:	31 d2                	xor    %edx,%edx
+ 634:	89 f7                	mov    %esi,%edi
+ 636:	f7 f3                	div    %ebx
+ 638:	8d 76 01             	lea    0x1(%esi),%esi
+ 63b:	0f b6 92 b0 0b 00 00 	movzbl 0xbb0(%edx),%edx
+ 642:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 646:	89 ca                	mov    %ecx,%edx
+ 648:	89 c1                	mov    %eax,%ecx
+ 64a:	39 da                	cmp    %ebx,%edx
+ 64c:	73 e2                	jae    630 <printint+0x30>
+  if(neg)
+ 64e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 651:	85 c0                	test   %eax,%eax
+ 653:	74 07                	je     65c <printint+0x5c>
+    buf[i++] = '-';
+ 655:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 65a:	89 f7                	mov    %esi,%edi
+ 65c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 65f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 662:	01 df                	add    %ebx,%edi
+ 664:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 668:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 66b:	83 ec 04             	sub    $0x4,%esp
+ 66e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 671:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 674:	6a 01                	push   $0x1
+ 676:	50                   	push   %eax
+ 677:	56                   	push   %esi
+ 678:	e8 66 fe ff ff       	call   4e3 <write>
+  while(--i >= 0)
+ 67d:	89 f8                	mov    %edi,%eax
+ 67f:	83 c4 10             	add    $0x10,%esp
+ 682:	83 ef 01             	sub    $0x1,%edi
+ 685:	39 d8                	cmp    %ebx,%eax
+ 687:	75 df                	jne    668 <printint+0x68>
+}
+ 689:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 68c:	5b                   	pop    %ebx
+ 68d:	5e                   	pop    %esi
+ 68e:	5f                   	pop    %edi
+ 68f:	5d                   	pop    %ebp
+ 690:	c3                   	ret
+ 691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 698:	31 c0                	xor    %eax,%eax
+ 69a:	eb 89                	jmp    625 <printint+0x25>
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	57                   	push   %edi
+ 6a4:	56                   	push   %esi
+ 6a5:	53                   	push   %ebx
+ 6a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+ 6ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6af:	0f b6 1e             	movzbl (%esi),%ebx
+ 6b2:	83 c6 01             	add    $0x1,%esi
+ 6b5:	84 db                	test   %bl,%bl
+ 6b7:	74 67                	je     720 <printf+0x80>
+ 6b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6bc:	31 d2                	xor    %edx,%edx
+ 6be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6c1:	eb 34                	jmp    6f7 <printf+0x57>
+ 6c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6c7:	90                   	nop
+ 6c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6d0:	83 f8 25             	cmp    $0x25,%eax
+ 6d3:	74 18                	je     6ed <printf+0x4d>
+  write(fd, &c, 1);
+ 6d5:	83 ec 04             	sub    $0x4,%esp
+ 6d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6de:	6a 01                	push   $0x1
+ 6e0:	50                   	push   %eax
+ 6e1:	57                   	push   %edi
+ 6e2:	e8 fc fd ff ff       	call   4e3 <write>
+ 6e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 6f0:	83 c6 01             	add    $0x1,%esi
+ 6f3:	84 db                	test   %bl,%bl
+ 6f5:	74 29                	je     720 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6fa:	85 d2                	test   %edx,%edx
+ 6fc:	74 ca                	je     6c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6fe:	83 fa 25             	cmp    $0x25,%edx
+ 701:	75 ea                	jne    6ed <printf+0x4d>
+      if(c == 'd'){
+ 703:	83 f8 25             	cmp    $0x25,%eax
+ 706:	0f 84 24 01 00 00    	je     830 <printf+0x190>
+ 70c:	83 e8 63             	sub    $0x63,%eax
+ 70f:	83 f8 15             	cmp    $0x15,%eax
+ 712:	77 1c                	ja     730 <printf+0x90>
+ 714:	ff 24 85 58 0b 00 00 	jmp    *0xb58(,%eax,4)
+ 71b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 71f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 723:	5b                   	pop    %ebx
+ 724:	5e                   	pop    %esi
+ 725:	5f                   	pop    %edi
+ 726:	5d                   	pop    %ebp
+ 727:	c3                   	ret
+ 728:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72f:	90                   	nop
+  write(fd, &c, 1);
+ 730:	83 ec 04             	sub    $0x4,%esp
+ 733:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 736:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 73a:	6a 01                	push   $0x1
+ 73c:	52                   	push   %edx
+ 73d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 740:	57                   	push   %edi
+ 741:	e8 9d fd ff ff       	call   4e3 <write>
+ 746:	83 c4 0c             	add    $0xc,%esp
+ 749:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 74c:	6a 01                	push   $0x1
+ 74e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 751:	52                   	push   %edx
+ 752:	57                   	push   %edi
+ 753:	e8 8b fd ff ff       	call   4e3 <write>
+        putc(fd, c);
+ 758:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 75b:	31 d2                	xor    %edx,%edx
+ 75d:	eb 8e                	jmp    6ed <printf+0x4d>
+ 75f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 760:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 763:	83 ec 0c             	sub    $0xc,%esp
+ 766:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 76b:	8b 13                	mov    (%ebx),%edx
+ 76d:	6a 00                	push   $0x0
+ 76f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 771:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 774:	e8 87 fe ff ff       	call   600 <printint>
+        ap++;
+ 779:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 77c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 77f:	31 d2                	xor    %edx,%edx
+ 781:	e9 67 ff ff ff       	jmp    6ed <printf+0x4d>
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 790:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 793:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 795:	83 c0 04             	add    $0x4,%eax
+ 798:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 79b:	85 db                	test   %ebx,%ebx
+ 79d:	0f 84 9d 00 00 00    	je     840 <printf+0x1a0>
+        while(*s != 0){
+ 7a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7a8:	84 c0                	test   %al,%al
+ 7aa:	0f 84 3d ff ff ff    	je     6ed <printf+0x4d>
+ 7b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7b6:	89 de                	mov    %ebx,%esi
+ 7b8:	89 d3                	mov    %edx,%ebx
+ 7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	53                   	push   %ebx
+ 7cc:	57                   	push   %edi
+ 7cd:	e8 11 fd ff ff       	call   4e3 <write>
+        while(*s != 0){
+ 7d2:	0f b6 06             	movzbl (%esi),%eax
+ 7d5:	83 c4 10             	add    $0x10,%esp
+ 7d8:	84 c0                	test   %al,%al
+ 7da:	75 e4                	jne    7c0 <printf+0x120>
+      state = 0;
+ 7dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7df:	31 d2                	xor    %edx,%edx
+ 7e1:	e9 07 ff ff ff       	jmp    6ed <printf+0x4d>
+ 7e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7f3:	83 ec 0c             	sub    $0xc,%esp
+ 7f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7fb:	8b 13                	mov    (%ebx),%edx
+ 7fd:	6a 01                	push   $0x1
+ 7ff:	e9 6b ff ff ff       	jmp    76f <printf+0xcf>
+ 804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 808:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 80b:	83 ec 04             	sub    $0x4,%esp
+ 80e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 811:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 813:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 816:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 819:	6a 01                	push   $0x1
+ 81b:	52                   	push   %edx
+ 81c:	57                   	push   %edi
+ 81d:	e8 c1 fc ff ff       	call   4e3 <write>
+        ap++;
+ 822:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 825:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 828:	31 d2                	xor    %edx,%edx
+ 82a:	e9 be fe ff ff       	jmp    6ed <printf+0x4d>
+ 82f:	90                   	nop
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 836:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 839:	6a 01                	push   $0x1
+ 83b:	e9 11 ff ff ff       	jmp    751 <printf+0xb1>
+ 840:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 845:	bb 4b 0b 00 00       	mov    $0xb4b,%ebx
+ 84a:	e9 61 ff ff ff       	jmp    7b0 <printf+0x110>
+ 84f:	90                   	nop
+
+00000850 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	57                   	push   %edi
+ 854:	56                   	push   %esi
+ 855:	53                   	push   %ebx
+ 856:	83 ec 20             	sub    $0x20,%esp
+ 859:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 85c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+ 85f:	57                   	push   %edi
+ 860:	68 52 0b 00 00       	push   $0xb52
+ 865:	53                   	push   %ebx
+ 866:	e8 35 fe ff ff       	call   6a0 <printf>
+  for(n = strlen(s); n < w; n++)
+ 86b:	89 3c 24             	mov    %edi,(%esp)
+ 86e:	e8 9d fa ff ff       	call   310 <strlen>
+ 873:	83 c4 10             	add    $0x10,%esp
+ 876:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 879:	7d 20                	jge    89b <pads+0x4b>
+ 87b:	89 c6                	mov    %eax,%esi
+ 87d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+ 887:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 88a:	6a 01                	push   $0x1
+ 88c:	57                   	push   %edi
+ 88d:	53                   	push   %ebx
+ 88e:	e8 50 fc ff ff       	call   4e3 <write>
+  for(n = strlen(s); n < w; n++)
+ 893:	83 c4 10             	add    $0x10,%esp
+ 896:	39 75 10             	cmp    %esi,0x10(%ebp)
+ 899:	75 e5                	jne    880 <pads+0x30>
+    putc(fd, ' ');
+}
+ 89b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 89e:	5b                   	pop    %ebx
+ 89f:	5e                   	pop    %esi
+ 8a0:	5f                   	pop    %edi
+ 8a1:	5d                   	pop    %ebp
+ 8a2:	c3                   	ret
+ 8a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008b0 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+ 8b0:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+ 8b1:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+ 8b6:	89 e5                	mov    %esp,%ebp
+ 8b8:	57                   	push   %edi
+ 8b9:	56                   	push   %esi
+ 8ba:	53                   	push   %ebx
+  int n = 0;
+ 8bb:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+ 8bd:	83 ec 2c             	sub    $0x2c,%esp
+ 8c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8c3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 8c6:	8b 75 08             	mov    0x8(%ebp),%esi
+ 8c9:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ 8cc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 8cf:	90                   	nop
+  }while((x /= 10) != 0);
+ 8d0:	89 d0                	mov    %edx,%eax
+ 8d2:	89 d7                	mov    %edx,%edi
+    n++;
+ 8d4:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+ 8d7:	f7 e1                	mul    %ecx
+ 8d9:	c1 ea 03             	shr    $0x3,%edx
+ 8dc:	83 ff 09             	cmp    $0x9,%edi
+ 8df:	77 ef                	ja     8d0 <padd+0x20>
+  for(; n < w; n++)
+ 8e1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 8e4:	39 c3                	cmp    %eax,%ebx
+ 8e6:	7d 23                	jge    90b <padd+0x5b>
+ 8e8:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ 8eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+  write(fd, &c, 1);
+ 8f0:	83 ec 04             	sub    $0x4,%esp
+ 8f3:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+ 8f7:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+ 8fa:	6a 01                	push   $0x1
+ 8fc:	57                   	push   %edi
+ 8fd:	56                   	push   %esi
+ 8fe:	e8 e0 fb ff ff       	call   4e3 <write>
+  for(; n < w; n++)
+ 903:	83 c4 10             	add    $0x10,%esp
+ 906:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+ 909:	75 e5                	jne    8f0 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+ 90b:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+ 912:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+ 915:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+ 918:	89 f0                	mov    %esi,%eax
+}
+ 91a:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+ 91b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+ 920:	5e                   	pop    %esi
+ 921:	5f                   	pop    %edi
+ 922:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+ 923:	e9 d8 fc ff ff       	jmp    600 <printint>
+ 928:	66 90                	xchg   %ax,%ax
+ 92a:	66 90                	xchg   %ax,%ax
+ 92c:	66 90                	xchg   %ax,%ax
+ 92e:	66 90                	xchg   %ax,%ax
+
+00000930 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 930:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 931:	a1 f8 0e 00 00       	mov    0xef8,%eax
+{
+ 936:	89 e5                	mov    %esp,%ebp
+ 938:	57                   	push   %edi
+ 939:	56                   	push   %esi
+ 93a:	53                   	push   %ebx
+ 93b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 93e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 948:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 94a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 94c:	39 ca                	cmp    %ecx,%edx
+ 94e:	73 30                	jae    980 <free+0x50>
+ 950:	39 c1                	cmp    %eax,%ecx
+ 952:	72 04                	jb     958 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 954:	39 c2                	cmp    %eax,%edx
+ 956:	72 f0                	jb     948 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 958:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 95b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 95e:	39 f8                	cmp    %edi,%eax
+ 960:	74 2e                	je     990 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 962:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 965:	8b 42 04             	mov    0x4(%edx),%eax
+ 968:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 96b:	39 f1                	cmp    %esi,%ecx
+ 96d:	74 38                	je     9a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 96f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 971:	5b                   	pop    %ebx
+  freep = p;
+ 972:	89 15 f8 0e 00 00    	mov    %edx,0xef8
+}
+ 978:	5e                   	pop    %esi
+ 979:	5f                   	pop    %edi
+ 97a:	5d                   	pop    %ebp
+ 97b:	c3                   	ret
+ 97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 980:	39 c1                	cmp    %eax,%ecx
+ 982:	72 d0                	jb     954 <free+0x24>
+ 984:	eb c2                	jmp    948 <free+0x18>
+ 986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 990:	03 70 04             	add    0x4(%eax),%esi
+ 993:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 996:	8b 02                	mov    (%edx),%eax
+ 998:	8b 00                	mov    (%eax),%eax
+ 99a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 99d:	8b 42 04             	mov    0x4(%edx),%eax
+ 9a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9a3:	39 f1                	cmp    %esi,%ecx
+ 9a5:	75 c8                	jne    96f <free+0x3f>
+    p->s.size += bp->s.size;
+ 9a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9aa:	89 15 f8 0e 00 00    	mov    %edx,0xef8
+    p->s.size += bp->s.size;
+ 9b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9b6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9b8:	5b                   	pop    %ebx
+ 9b9:	5e                   	pop    %esi
+ 9ba:	5f                   	pop    %edi
+ 9bb:	5d                   	pop    %ebp
+ 9bc:	c3                   	ret
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	57                   	push   %edi
+ 9c4:	56                   	push   %esi
+ 9c5:	53                   	push   %ebx
+ 9c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9cc:	8b 15 f8 0e 00 00    	mov    0xef8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9d2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9d5:	c1 ef 03             	shr    $0x3,%edi
+ 9d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9db:	85 d2                	test   %edx,%edx
+ 9dd:	0f 84 8d 00 00 00    	je     a70 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9e5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9e8:	39 f9                	cmp    %edi,%ecx
+ 9ea:	73 64                	jae    a50 <malloc+0x90>
+  if(nu < 4096)
+ 9ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9f1:	39 df                	cmp    %ebx,%edi
+ 9f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9fd:	eb 0a                	jmp    a09 <malloc+0x49>
+ 9ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a00:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a02:	8b 48 04             	mov    0x4(%eax),%ecx
+ a05:	39 f9                	cmp    %edi,%ecx
+ a07:	73 47                	jae    a50 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a09:	89 c2                	mov    %eax,%edx
+ a0b:	39 05 f8 0e 00 00    	cmp    %eax,0xef8
+ a11:	75 ed                	jne    a00 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a13:	83 ec 0c             	sub    $0xc,%esp
+ a16:	56                   	push   %esi
+ a17:	e8 2f fb ff ff       	call   54b <sbrk>
+  if(p == (char*)-1)
+ a1c:	83 c4 10             	add    $0x10,%esp
+ a1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a22:	74 1c                	je     a40 <malloc+0x80>
+  hp->s.size = nu;
+ a24:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a27:	83 ec 0c             	sub    $0xc,%esp
+ a2a:	83 c0 08             	add    $0x8,%eax
+ a2d:	50                   	push   %eax
+ a2e:	e8 fd fe ff ff       	call   930 <free>
+  return freep;
+ a33:	8b 15 f8 0e 00 00    	mov    0xef8,%edx
+      if((p = morecore(nunits)) == 0)
+ a39:	83 c4 10             	add    $0x10,%esp
+ a3c:	85 d2                	test   %edx,%edx
+ a3e:	75 c0                	jne    a00 <malloc+0x40>
+        return 0;
+  }
+}
+ a40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a43:	31 c0                	xor    %eax,%eax
+}
+ a45:	5b                   	pop    %ebx
+ a46:	5e                   	pop    %esi
+ a47:	5f                   	pop    %edi
+ a48:	5d                   	pop    %ebp
+ a49:	c3                   	ret
+ a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a50:	39 cf                	cmp    %ecx,%edi
+ a52:	74 4c                	je     aa0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a54:	29 f9                	sub    %edi,%ecx
+ a56:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a59:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a5c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a5f:	89 15 f8 0e 00 00    	mov    %edx,0xef8
+}
+ a65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a68:	83 c0 08             	add    $0x8,%eax
+}
+ a6b:	5b                   	pop    %ebx
+ a6c:	5e                   	pop    %esi
+ a6d:	5f                   	pop    %edi
+ a6e:	5d                   	pop    %ebp
+ a6f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a70:	c7 05 f8 0e 00 00 fc 	movl   $0xefc,0xef8
+ a77:	0e 00 00 
+    base.s.size = 0;
+ a7a:	b8 fc 0e 00 00       	mov    $0xefc,%eax
+    base.s.ptr = freep = prevp = &base;
+ a7f:	c7 05 fc 0e 00 00 fc 	movl   $0xefc,0xefc
+ a86:	0e 00 00 
+    base.s.size = 0;
+ a89:	c7 05 00 0f 00 00 00 	movl   $0x0,0xf00
+ a90:	00 00 00 
+    if(p->s.size >= nunits){
+ a93:	e9 54 ff ff ff       	jmp    9ec <malloc+0x2c>
+ a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ aa0:	8b 08                	mov    (%eax),%ecx
+ aa2:	89 0a                	mov    %ecx,(%edx)
+ aa4:	eb b9                	jmp    a5f <malloc+0x9f>
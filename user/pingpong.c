@@ -0,0 +1,80 @@
+#include "kernel/types.h"
+#include "kernel/date.h"
+#include "kernel/procinfo.h"
+#include "user.h"
+
+#define MAXCPU 8
+
+/* Microseconds since boot */
+static uint
+usnow(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/* Context switches handed straight to a woken process, all CPUs */
+static uint
+handoffs(void) {
+  struct schedstat ss[MAXCPU];
+  uint total = 0;
+  int i, n;
+
+  n = schedstat(ss, MAXCPU);
+  for(i = 0; i < n; ++i)
+    total += ss[i].nhandoff;
+  return total;
+}
+
+int
+main(int argc, char *argv[]) {
+  int ping[2], pong[2], rounds, i, pid;
+  uint t0, t1, h0, h1;
+  char c = 0;
+
+  rounds = argc > 1 ? atoi(argv[1]) : 10000;
+  if(rounds <= 0) {
+    printf(2, "usage: pingpong [rounds]\n");
+    exit(1);
+  }
+  if(pipe(ping) < 0 || pipe(pong) < 0) {
+    printf(2, "pingpong: pipe failed\n");
+    exit(1);
+  }
+
+  if((pid = fork()) < 0) {
+    printf(2, "pingpong: fork failed\n");
+    exit(1);
+  }
+  if(pid == 0) {
+    /* Echo every byte back */
+    close(ping[1]);
+    close(pong[0]);
+    while(read(ping[0], &c, 1) == 1)
+      if(write(pong[1], &c, 1) != 1)
+        break;
+    exit(0);
+  }
+  close(ping[0]);
+  close(pong[1]);
+
+  h0 = handoffs();
+  t0 = usnow();
+  for(i = 0; i < rounds; ++i) {
+    if(write(ping[1], &c, 1) != 1 || read(pong[0], &c, 1) != 1) {
+      printf(2, "pingpong: round %d failed\n", i);
+      exit(1);
+    }
+    ++c;
+  }
+  t1 = usnow();
+  h1 = handoffs();
+
+  close(ping[1]);
+  wait(0);
+  printf(1, "%d round trips in %d us, %d us each, %d hand-offs\n",
+         rounds, t1 - t0, (t1 - t0) / rounds, h1 - h0);
+  printf(1, "pingpong ok\n");
+  exit(0);
+}
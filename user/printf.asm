@@ -0,0 +1,1111 @@
+
+_printf:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	57                   	push   %edi
+   4:	56                   	push   %esi
+   5:	53                   	push   %ebx
+   6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+   8:	89 d1                	mov    %edx,%ecx
+{
+   a:	83 ec 3c             	sub    $0x3c,%esp
+   d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+  10:	85 d2                	test   %edx,%edx
+  12:	0f 89 80 00 00 00    	jns    98 <printint+0x98>
+  18:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+  1c:	74 7a                	je     98 <printint+0x98>
+    x = -xx;
+  1e:	f7 d9                	neg    %ecx
+    neg = 1;
+  20:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+  25:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  28:	31 f6                	xor    %esi,%esi
+  2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+  30:	89 c8                	mov    %ecx,%eax
+  32:	31 d2                	xor    %edx,%edx
+  34:	89 f7                	mov    %esi,%edi
+  36:	f7 f3                	div    %ebx
+  38:	8d 76 01             	lea    0x1(%esi),%esi
+  3b:	0f b6 92 48 07 00 00 	movzbl 0x748(%edx),%edx
+  42:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+  46:	89 ca                	mov    %ecx,%edx
+  48:	89 c1                	mov    %eax,%ecx
+  4a:	39 da                	cmp    %ebx,%edx
+  4c:	73 e2                	jae    30 <printint+0x30>
+  if(neg)
+  4e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  51:	85 c0                	test   %eax,%eax
+  53:	74 07                	je     5c <printint+0x5c>
+    buf[i++] = '-';
+  55:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+  5a:	89 f7                	mov    %esi,%edi
+  5c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  5f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+  62:	01 df                	add    %ebx,%edi
+  64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+  68:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	88 45 d7             	mov    %al,-0x29(%ebp)
+  71:	8d 45 d7             	lea    -0x29(%ebp),%eax
+  74:	6a 01                	push   $0x1
+  76:	50                   	push   %eax
+  77:	56                   	push   %esi
+  78:	e8 36 04 00 00       	call   4b3 <write>
+  while(--i >= 0)
+  7d:	89 f8                	mov    %edi,%eax
+  7f:	83 c4 10             	add    $0x10,%esp
+  82:	83 ef 01             	sub    $0x1,%edi
+  85:	39 d8                	cmp    %ebx,%eax
+  87:	75 df                	jne    68 <printint+0x68>
+}
+  89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8c:	5b                   	pop    %ebx
+  8d:	5e                   	pop    %esi
+  8e:	5f                   	pop    %edi
+  8f:	5d                   	pop    %ebp
+  90:	c3                   	ret
+  91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+  98:	31 c0                	xor    %eax,%eax
+  9a:	eb 89                	jmp    25 <printint+0x25>
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	57                   	push   %edi
+  a4:	56                   	push   %esi
+  a5:	53                   	push   %ebx
+  a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+  a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+  ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+  af:	0f b6 1e             	movzbl (%esi),%ebx
+  b2:	83 c6 01             	add    $0x1,%esi
+  b5:	84 db                	test   %bl,%bl
+  b7:	74 67                	je     120 <printf+0x80>
+  b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+  bc:	31 d2                	xor    %edx,%edx
+  be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  c1:	eb 34                	jmp    f7 <printf+0x57>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+  cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+  d0:	83 f8 25             	cmp    $0x25,%eax
+  d3:	74 18                	je     ed <printf+0x4d>
+  write(fd, &c, 1);
+  d5:	83 ec 04             	sub    $0x4,%esp
+  d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+  de:	6a 01                	push   $0x1
+  e0:	50                   	push   %eax
+  e1:	57                   	push   %edi
+  e2:	e8 cc 03 00 00       	call   4b3 <write>
+  e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+  ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+  ed:	0f b6 1e             	movzbl (%esi),%ebx
+  f0:	83 c6 01             	add    $0x1,%esi
+  f3:	84 db                	test   %bl,%bl
+  f5:	74 29                	je     120 <printf+0x80>
+    c = fmt[i] & 0xff;
+  f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+  fa:	85 d2                	test   %edx,%edx
+  fc:	74 ca                	je     c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+  fe:	83 fa 25             	cmp    $0x25,%edx
+ 101:	75 ea                	jne    ed <printf+0x4d>
+      if(c == 'd'){
+ 103:	83 f8 25             	cmp    $0x25,%eax
+ 106:	0f 84 24 01 00 00    	je     230 <printf+0x190>
+ 10c:	83 e8 63             	sub    $0x63,%eax
+ 10f:	83 f8 15             	cmp    $0x15,%eax
+ 112:	77 1c                	ja     130 <printf+0x90>
+ 114:	ff 24 85 f0 06 00 00 	jmp    *0x6f0(,%eax,4)
+ 11b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 11f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 120:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 123:	5b                   	pop    %ebx
+ 124:	5e                   	pop    %esi
+ 125:	5f                   	pop    %edi
+ 126:	5d                   	pop    %ebp
+ 127:	c3                   	ret
+ 128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12f:	90                   	nop
+  write(fd, &c, 1);
+ 130:	83 ec 04             	sub    $0x4,%esp
+ 133:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 136:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 13a:	6a 01                	push   $0x1
+ 13c:	52                   	push   %edx
+ 13d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 140:	57                   	push   %edi
+ 141:	e8 6d 03 00 00       	call   4b3 <write>
+ 146:	83 c4 0c             	add    $0xc,%esp
+ 149:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 14c:	6a 01                	push   $0x1
+ 14e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 151:	52                   	push   %edx
+ 152:	57                   	push   %edi
+ 153:	e8 5b 03 00 00       	call   4b3 <write>
+        putc(fd, c);
+ 158:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 15b:	31 d2                	xor    %edx,%edx
+ 15d:	eb 8e                	jmp    ed <printf+0x4d>
+ 15f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 160:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 163:	83 ec 0c             	sub    $0xc,%esp
+ 166:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 16b:	8b 13                	mov    (%ebx),%edx
+ 16d:	6a 00                	push   $0x0
+ 16f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 171:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 174:	e8 87 fe ff ff       	call   0 <printint>
+        ap++;
+ 179:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 17c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 17f:	31 d2                	xor    %edx,%edx
+ 181:	e9 67 ff ff ff       	jmp    ed <printf+0x4d>
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 190:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 193:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 195:	83 c0 04             	add    $0x4,%eax
+ 198:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 19b:	85 db                	test   %ebx,%ebx
+ 19d:	0f 84 9d 00 00 00    	je     240 <printf+0x1a0>
+        while(*s != 0){
+ 1a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 1a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 1a8:	84 c0                	test   %al,%al
+ 1aa:	0f 84 3d ff ff ff    	je     ed <printf+0x4d>
+ 1b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 1b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 1b6:	89 de                	mov    %ebx,%esi
+ 1b8:	89 d3                	mov    %edx,%ebx
+ 1ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 1c0:	83 ec 04             	sub    $0x4,%esp
+ 1c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 1c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 1c9:	6a 01                	push   $0x1
+ 1cb:	53                   	push   %ebx
+ 1cc:	57                   	push   %edi
+ 1cd:	e8 e1 02 00 00       	call   4b3 <write>
+        while(*s != 0){
+ 1d2:	0f b6 06             	movzbl (%esi),%eax
+ 1d5:	83 c4 10             	add    $0x10,%esp
+ 1d8:	84 c0                	test   %al,%al
+ 1da:	75 e4                	jne    1c0 <printf+0x120>
+      state = 0;
+ 1dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 1df:	31 d2                	xor    %edx,%edx
+ 1e1:	e9 07 ff ff ff       	jmp    ed <printf+0x4d>
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 1f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 1f3:	83 ec 0c             	sub    $0xc,%esp
+ 1f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 1fb:	8b 13                	mov    (%ebx),%edx
+ 1fd:	6a 01                	push   $0x1
+ 1ff:	e9 6b ff ff ff       	jmp    16f <printf+0xcf>
+ 204:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 208:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 20b:	83 ec 04             	sub    $0x4,%esp
+ 20e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 211:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 213:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 216:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 219:	6a 01                	push   $0x1
+ 21b:	52                   	push   %edx
+ 21c:	57                   	push   %edi
+ 21d:	e8 91 02 00 00       	call   4b3 <write>
+        ap++;
+ 222:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 225:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 228:	31 d2                	xor    %edx,%edx
+ 22a:	e9 be fe ff ff       	jmp    ed <printf+0x4d>
+ 22f:	90                   	nop
+  write(fd, &c, 1);
+ 230:	83 ec 04             	sub    $0x4,%esp
+ 233:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 236:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 239:	6a 01                	push   $0x1
+ 23b:	e9 11 ff ff ff       	jmp    151 <printf+0xb1>
+ 240:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 245:	bb e8 06 00 00       	mov    $0x6e8,%ebx
+ 24a:	e9 61 ff ff ff       	jmp    1b0 <printf+0x110>
+ 24f:	90                   	nop
+
+00000250 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 250:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 251:	31 c0                	xor    %eax,%eax
+{
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	53                   	push   %ebx
+ 256:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 260:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 264:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 267:	83 c0 01             	add    $0x1,%eax
+ 26a:	84 d2                	test   %dl,%dl
+ 26c:	75 f2                	jne    260 <strcpy+0x10>
+    ;
+  return os;
+}
+ 26e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 271:	89 c8                	mov    %ecx,%eax
+ 273:	c9                   	leave
+ 274:	c3                   	ret
+ 275:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	53                   	push   %ebx
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+ 287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 28a:	0f b6 02             	movzbl (%edx),%eax
+ 28d:	84 c0                	test   %al,%al
+ 28f:	75 17                	jne    2a8 <strcmp+0x28>
+ 291:	eb 3a                	jmp    2cd <strcmp+0x4d>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 29c:	83 c2 01             	add    $0x1,%edx
+ 29f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2a2:	84 c0                	test   %al,%al
+ 2a4:	74 1a                	je     2c0 <strcmp+0x40>
+    p++, q++;
+ 2a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2ab:	38 c3                	cmp    %al,%bl
+ 2ad:	74 e9                	je     298 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2af:	29 d8                	sub    %ebx,%eax
+}
+ 2b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b4:	c9                   	leave
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2c4:	31 c0                	xor    %eax,%eax
+ 2c6:	29 d8                	sub    %ebx,%eax
+}
+ 2c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2d0:	31 c0                	xor    %eax,%eax
+ 2d2:	eb db                	jmp    2af <strcmp+0x2f>
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2e9:	74 15                	je     300 <strlen+0x20>
+ 2eb:	31 c0                	xor    %eax,%eax
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 2f0:	83 c0 01             	add    $0x1,%eax
+ 2f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2f7:	89 c1                	mov    %eax,%ecx
+ 2f9:	75 f5                	jne    2f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2fb:	89 c8                	mov    %ecx,%eax
+ 2fd:	5d                   	pop    %ebp
+ 2fe:	c3                   	ret
+ 2ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 300:	31 c9                	xor    %ecx,%ecx
+}
+ 302:	5d                   	pop    %ebp
+ 303:	89 c8                	mov    %ecx,%eax
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 317:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 31a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 31d:	89 d7                	mov    %edx,%edi
+ 31f:	fc                   	cld
+ 320:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 322:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 325:	89 d0                	mov    %edx,%eax
+ 327:	c9                   	leave
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 33a:	0f b6 10             	movzbl (%eax),%edx
+ 33d:	84 d2                	test   %dl,%dl
+ 33f:	75 12                	jne    353 <strchr+0x23>
+ 341:	eb 1d                	jmp    360 <strchr+0x30>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 34c:	83 c0 01             	add    $0x1,%eax
+ 34f:	84 d2                	test   %dl,%dl
+ 351:	74 0d                	je     360 <strchr+0x30>
+    if(*s == c)
+ 353:	38 d1                	cmp    %dl,%cl
+ 355:	75 f1                	jne    348 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 357:	5d                   	pop    %ebp
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 360:	31 c0                	xor    %eax,%eax
+}
+ 362:	5d                   	pop    %ebp
+ 363:	c3                   	ret
+ 364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 375:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 378:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 379:	31 db                	xor    %ebx,%ebx
+{
+ 37b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 37e:	eb 27                	jmp    3a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 380:	83 ec 04             	sub    $0x4,%esp
+ 383:	6a 01                	push   $0x1
+ 385:	56                   	push   %esi
+ 386:	6a 00                	push   $0x0
+ 388:	e8 1e 01 00 00       	call   4ab <read>
+    if(cc < 1)
+ 38d:	83 c4 10             	add    $0x10,%esp
+ 390:	85 c0                	test   %eax,%eax
+ 392:	7e 1d                	jle    3b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 394:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 39f:	3c 0a                	cmp    $0xa,%al
+ 3a1:	74 10                	je     3b3 <gets+0x43>
+ 3a3:	3c 0d                	cmp    $0xd,%al
+ 3a5:	74 0c                	je     3b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3a7:	89 df                	mov    %ebx,%edi
+ 3a9:	83 c3 01             	add    $0x1,%ebx
+ 3ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3af:	7c cf                	jl     380 <gets+0x10>
+ 3b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3bd:	5b                   	pop    %ebx
+ 3be:	5e                   	pop    %esi
+ 3bf:	5f                   	pop    %edi
+ 3c0:	5d                   	pop    %ebp
+ 3c1:	c3                   	ret
+ 3c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+ 3d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3d5:	83 ec 08             	sub    $0x8,%esp
+ 3d8:	6a 00                	push   $0x0
+ 3da:	ff 75 08             	push   0x8(%ebp)
+ 3dd:	e8 f1 00 00 00       	call   4d3 <open>
+  if(fd < 0)
+ 3e2:	83 c4 10             	add    $0x10,%esp
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	78 27                	js     410 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3e9:	83 ec 08             	sub    $0x8,%esp
+ 3ec:	ff 75 0c             	push   0xc(%ebp)
+ 3ef:	89 c3                	mov    %eax,%ebx
+ 3f1:	50                   	push   %eax
+ 3f2:	e8 f4 00 00 00       	call   4eb <fstat>
+  close(fd);
+ 3f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3fc:	e8 ba 00 00 00       	call   4bb <close>
+  return r;
+ 401:	83 c4 10             	add    $0x10,%esp
+}
+ 404:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 407:	89 f0                	mov    %esi,%eax
+ 409:	5b                   	pop    %ebx
+ 40a:	5e                   	pop    %esi
+ 40b:	5d                   	pop    %ebp
+ 40c:	c3                   	ret
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 415:	eb ed                	jmp    404 <stat+0x34>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 427:	0f be 02             	movsbl (%edx),%eax
+ 42a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 42d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 435:	77 1e                	ja     455 <atoi+0x35>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 440:	83 c2 01             	add    $0x1,%edx
+ 443:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 446:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 44a:	0f be 02             	movsbl (%edx),%eax
+ 44d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 450:	80 fb 09             	cmp    $0x9,%bl
+ 453:	76 eb                	jbe    440 <atoi+0x20>
+  return n;
+}
+ 455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 458:	89 c8                	mov    %ecx,%eax
+ 45a:	c9                   	leave
+ 45b:	c3                   	ret
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	8b 45 10             	mov    0x10(%ebp),%eax
+ 468:	8b 55 08             	mov    0x8(%ebp),%edx
+ 46b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 46e:	85 c0                	test   %eax,%eax
+ 470:	7e 13                	jle    485 <memmove+0x25>
+ 472:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 474:	89 d7                	mov    %edx,%edi
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 480:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 481:	39 f8                	cmp    %edi,%eax
+ 483:	75 fb                	jne    480 <memmove+0x20>
+  return vdst;
+}
+ 485:	5e                   	pop    %esi
+ 486:	89 d0                	mov    %edx,%eax
+ 488:	5f                   	pop    %edi
+ 489:	5d                   	pop    %ebp
+ 48a:	c3                   	ret
+
+0000048b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 48b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <exit>:
+SYSCALL(exit)
+ 493:	b8 02 00 00 00       	mov    $0x2,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <wait>:
+SYSCALL(wait)
+ 49b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <pipe>:
+SYSCALL(pipe)
+ 4a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <read>:
+SYSCALL(read)
+ 4ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <write>:
+SYSCALL(write)
+ 4b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <close>:
+SYSCALL(close)
+ 4bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <kill>:
+SYSCALL(kill)
+ 4c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <exec>:
+SYSCALL(exec)
+ 4cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <open>:
+SYSCALL(open)
+ 4d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mknod>:
+SYSCALL(mknod)
+ 4db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <unlink>:
+SYSCALL(unlink)
+ 4e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <fstat>:
+SYSCALL(fstat)
+ 4eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <link>:
+SYSCALL(link)
+ 4f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <mkdir>:
+SYSCALL(mkdir)
+ 4fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <chdir>:
+SYSCALL(chdir)
+ 503:	b8 09 00 00 00       	mov    $0x9,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <dup>:
+SYSCALL(dup)
+ 50b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <getpid>:
+SYSCALL(getpid)
+ 513:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <sbrk>:
+SYSCALL(sbrk)
+ 51b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <sleep>:
+SYSCALL(sleep)
+ 523:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <uptime>:
+SYSCALL(uptime)
+ 52b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <getdate>:
+SYSCALL(getdate)
+ 533:	b8 16 00 00 00       	mov    $0x16,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <setdate>:
+SYSCALL(setdate)
+ 53b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <mount>:
+SYSCALL(mount)
+ 543:	b8 18 00 00 00       	mov    $0x18,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <unmount>:
+SYSCALL(unmount)
+ 54b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <lseek>:
+SYSCALL(lseek)
+ 553:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <mmap>:
+SYSCALL(mmap)
+ 55b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <munmap>:
+SYSCALL(munmap)
+ 563:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+ 56b:	66 90                	xchg   %ax,%ax
+ 56d:	66 90                	xchg   %ax,%ax
+ 56f:	90                   	nop
+
+00000570 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 570:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 571:	a1 c0 09 00 00       	mov    0x9c0,%eax
+{
+ 576:	89 e5                	mov    %esp,%ebp
+ 578:	57                   	push   %edi
+ 579:	56                   	push   %esi
+ 57a:	53                   	push   %ebx
+ 57b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 57e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 581:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 588:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 58a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 58c:	39 ca                	cmp    %ecx,%edx
+ 58e:	73 30                	jae    5c0 <free+0x50>
+ 590:	39 c1                	cmp    %eax,%ecx
+ 592:	72 04                	jb     598 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 594:	39 c2                	cmp    %eax,%edx
+ 596:	72 f0                	jb     588 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 598:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 59b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 59e:	39 f8                	cmp    %edi,%eax
+ 5a0:	74 2e                	je     5d0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5a2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 5a5:	8b 42 04             	mov    0x4(%edx),%eax
+ 5a8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 5ab:	39 f1                	cmp    %esi,%ecx
+ 5ad:	74 38                	je     5e7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 5af:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 5b1:	5b                   	pop    %ebx
+  freep = p;
+ 5b2:	89 15 c0 09 00 00    	mov    %edx,0x9c0
+}
+ 5b8:	5e                   	pop    %esi
+ 5b9:	5f                   	pop    %edi
+ 5ba:	5d                   	pop    %ebp
+ 5bb:	c3                   	ret
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 5c0:	39 c1                	cmp    %eax,%ecx
+ 5c2:	72 d0                	jb     594 <free+0x24>
+ 5c4:	eb c2                	jmp    588 <free+0x18>
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 5d0:	03 70 04             	add    0x4(%eax),%esi
+ 5d3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 5d6:	8b 02                	mov    (%edx),%eax
+ 5d8:	8b 00                	mov    (%eax),%eax
+ 5da:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 5dd:	8b 42 04             	mov    0x4(%edx),%eax
+ 5e0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 5e3:	39 f1                	cmp    %esi,%ecx
+ 5e5:	75 c8                	jne    5af <free+0x3f>
+    p->s.size += bp->s.size;
+ 5e7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 5ea:	89 15 c0 09 00 00    	mov    %edx,0x9c0
+    p->s.size += bp->s.size;
+ 5f0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 5f3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 5f6:	89 0a                	mov    %ecx,(%edx)
+}
+ 5f8:	5b                   	pop    %ebx
+ 5f9:	5e                   	pop    %esi
+ 5fa:	5f                   	pop    %edi
+ 5fb:	5d                   	pop    %ebp
+ 5fc:	c3                   	ret
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000600 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	53                   	push   %ebx
+ 606:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 609:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 60c:	8b 15 c0 09 00 00    	mov    0x9c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 612:	8d 78 07             	lea    0x7(%eax),%edi
+ 615:	c1 ef 03             	shr    $0x3,%edi
+ 618:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 61b:	85 d2                	test   %edx,%edx
+ 61d:	0f 84 8d 00 00 00    	je     6b0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 623:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 625:	8b 48 04             	mov    0x4(%eax),%ecx
+ 628:	39 f9                	cmp    %edi,%ecx
+ 62a:	73 64                	jae    690 <malloc+0x90>
+  if(nu < 4096)
+ 62c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 631:	39 df                	cmp    %ebx,%edi
+ 633:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 636:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 63d:	eb 0a                	jmp    649 <malloc+0x49>
+ 63f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 640:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 642:	8b 48 04             	mov    0x4(%eax),%ecx
+ 645:	39 f9                	cmp    %edi,%ecx
+ 647:	73 47                	jae    690 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 649:	89 c2                	mov    %eax,%edx
+ 64b:	39 05 c0 09 00 00    	cmp    %eax,0x9c0
+ 651:	75 ed                	jne    640 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 653:	83 ec 0c             	sub    $0xc,%esp
+ 656:	56                   	push   %esi
+ 657:	e8 bf fe ff ff       	call   51b <sbrk>
+  if(p == (char*)-1)
+ 65c:	83 c4 10             	add    $0x10,%esp
+ 65f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 662:	74 1c                	je     680 <malloc+0x80>
+  hp->s.size = nu;
+ 664:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 667:	83 ec 0c             	sub    $0xc,%esp
+ 66a:	83 c0 08             	add    $0x8,%eax
+ 66d:	50                   	push   %eax
+ 66e:	e8 fd fe ff ff       	call   570 <free>
+  return freep;
+ 673:	8b 15 c0 09 00 00    	mov    0x9c0,%edx
+      if((p = morecore(nunits)) == 0)
+ 679:	83 c4 10             	add    $0x10,%esp
+ 67c:	85 d2                	test   %edx,%edx
+ 67e:	75 c0                	jne    640 <malloc+0x40>
+        return 0;
+  }
+}
+ 680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 683:	31 c0                	xor    %eax,%eax
+}
+ 685:	5b                   	pop    %ebx
+ 686:	5e                   	pop    %esi
+ 687:	5f                   	pop    %edi
+ 688:	5d                   	pop    %ebp
+ 689:	c3                   	ret
+ 68a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 690:	39 cf                	cmp    %ecx,%edi
+ 692:	74 4c                	je     6e0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 694:	29 f9                	sub    %edi,%ecx
+ 696:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 699:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 69c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 69f:	89 15 c0 09 00 00    	mov    %edx,0x9c0
+}
+ 6a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 6a8:	83 c0 08             	add    $0x8,%eax
+}
+ 6ab:	5b                   	pop    %ebx
+ 6ac:	5e                   	pop    %esi
+ 6ad:	5f                   	pop    %edi
+ 6ae:	5d                   	pop    %ebp
+ 6af:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 6b0:	c7 05 c0 09 00 00 c4 	movl   $0x9c4,0x9c0
+ 6b7:	09 00 00 
+    base.s.size = 0;
+ 6ba:	b8 c4 09 00 00       	mov    $0x9c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 6bf:	c7 05 c4 09 00 00 c4 	movl   $0x9c4,0x9c4
+ 6c6:	09 00 00 
+    base.s.size = 0;
+ 6c9:	c7 05 c8 09 00 00 00 	movl   $0x0,0x9c8
+ 6d0:	00 00 00 
+    if(p->s.size >= nunits){
+ 6d3:	e9 54 ff ff ff       	jmp    62c <malloc+0x2c>
+ 6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 6e0:	8b 08                	mov    (%eax),%ecx
+ 6e2:	89 0a                	mov    %ecx,(%edx)
+ 6e4:	eb b9                	jmp    69f <malloc+0x9f>
@@ -81,3 +81,27 @@ printf(int fd, char *fmt, ...) {
     }
   }
 }
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+  int n;
+
+  printf(fd, "%s", s);
+  for(n = strlen(s); n < w; n++)
+    putc(fd, ' ');
+}
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+  for(; n < w; n++)
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+}
@@ -0,0 +1,24 @@
+#include "kernel/types.h"
+#include "kernel/stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+  int n;
+
+  if(argc > 2){
+    printf(2, "usage: proclimit [max processes]\n");
+    exit(1);
+  }
+  if(argc == 1){
+    printf(1, "process limit: %d\n", proclimit(0));
+    exit(0);
+  }
+  if((n = atoi(argv[1])) <= 0){
+    printf(2, "proclimit: limit must be positive\n");
+    exit(1);
+  }
+  printf(1, "process limit: %d -> %d\n", proclimit(n), n);
+  exit(0);
+}
@@ -0,0 +1,1874 @@
+
+_schedstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    printf(1, "\n");
+  }
+}
+
+int
+main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec 18 07 00 00    	sub    $0x718,%esp
+  struct schedstat before[MAXCPU], after[MAXCPU];
+  int secs, n, i;
+
+  secs = argc > 1 ? atoi(argv[1]) : 0;
+  17:	83 39 01             	cmpl   $0x1,(%ecx)
+main(int argc, char *argv[]) {
+  1a:	8b 41 04             	mov    0x4(%ecx),%eax
+  secs = argc > 1 ? atoi(argv[1]) : 0;
+  1d:	0f 8e 2c 01 00 00    	jle    14f <main+0x14f>
+  23:	83 ec 0c             	sub    $0xc,%esp
+  26:	ff 70 04             	push   0x4(%eax)
+  29:	e8 f2 06 00 00       	call   720 <atoi>
+  if(secs < 0) {
+  2e:	83 c4 10             	add    $0x10,%esp
+  31:	85 c0                	test   %eax,%eax
+  33:	0f 88 5c 01 00 00    	js     195 <main+0x195>
+    printf(2, "usage: schedstat [seconds]\n");
+    exit(1);
+  }
+
+  if((n = schedstat(before, MAXCPU)) < 0) {
+  39:	8d b5 e8 f8 ff ff    	lea    -0x718(%ebp),%esi
+  3f:	89 85 e4 f8 ff ff    	mov    %eax,-0x71c(%ebp)
+  45:	53                   	push   %ebx
+  46:	53                   	push   %ebx
+  47:	6a 08                	push   $0x8
+  49:	56                   	push   %esi
+  4a:	e8 54 08 00 00       	call   8a3 <schedstat>
+  4f:	83 c4 10             	add    $0x10,%esp
+  52:	8b 95 e4 f8 ff ff    	mov    -0x71c(%ebp),%edx
+  58:	85 c0                	test   %eax,%eax
+  5a:	0f 88 1b 01 00 00    	js     17b <main+0x17b>
+    printf(2, "schedstat: cannot read scheduler statistics\n");
+    exit(1);
+  }
+  if(secs == 0) {
+  60:	85 d2                	test   %edx,%edx
+  62:	0f 84 fe 00 00 00    	je     166 <main+0x166>
+    /* Totals since boot */
+    show(before, n, 0);
+    exit(0);
+  }
+
+  sleep(secs * 100);
+  68:	6b c2 64             	imul   $0x64,%edx,%eax
+  6b:	83 ec 0c             	sub    $0xc,%esp
+  6e:	89 95 e4 f8 ff ff    	mov    %edx,-0x71c(%ebp)
+  if((n = schedstat(after, MAXCPU)) < 0) {
+  74:	8d 9d 68 fc ff ff    	lea    -0x398(%ebp),%ebx
+  sleep(secs * 100);
+  7a:	50                   	push   %eax
+  7b:	e8 a3 07 00 00       	call   823 <sleep>
+  if((n = schedstat(after, MAXCPU)) < 0) {
+  80:	58                   	pop    %eax
+  81:	5a                   	pop    %edx
+  82:	6a 08                	push   $0x8
+  84:	53                   	push   %ebx
+  85:	e8 19 08 00 00       	call   8a3 <schedstat>
+  8a:	83 c4 10             	add    $0x10,%esp
+  8d:	85 c0                	test   %eax,%eax
+  8f:	0f 88 e6 00 00 00    	js     17b <main+0x17b>
+    printf(2, "schedstat: cannot read scheduler statistics\n");
+    exit(1);
+  }
+  for(i = 0; i < n; ++i)
+  95:	8b 95 e4 f8 ff ff    	mov    -0x71c(%ebp),%edx
+  9b:	0f 84 99 00 00 00    	je     13a <main+0x13a>
+  a1:	8d 48 01             	lea    0x1(%eax),%ecx
+  a4:	89 95 e0 f8 ff ff    	mov    %edx,-0x720(%ebp)
+  aa:	8d bd 6c fc ff ff    	lea    -0x394(%ebp),%edi
+  b0:	6b c9 70             	imul   $0x70,%ecx,%ecx
+  b3:	89 85 dc f8 ff ff    	mov    %eax,-0x724(%ebp)
+  b9:	89 8d e4 f8 ff ff    	mov    %ecx,-0x71c(%ebp)
+  bf:	b9 70 00 00 00       	mov    $0x70,%ecx
+  c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b->nvcsw -= a->nvcsw;
+  c8:	8b 84 0d 7c f8 ff ff 	mov    -0x784(%ebp,%ecx,1),%eax
+  cf:	29 07                	sub    %eax,(%edi)
+  b->nivcsw -= a->nivcsw;
+  d1:	8b 84 0d 80 f8 ff ff 	mov    -0x780(%ebp,%ecx,1),%eax
+  d8:	29 47 04             	sub    %eax,0x4(%edi)
+  b->nmigrate -= a->nmigrate;
+  db:	8b 84 0d 84 f8 ff ff 	mov    -0x77c(%ebp,%ecx,1),%eax
+  e2:	29 47 08             	sub    %eax,0x8(%edi)
+  b->nhandoff -= a->nhandoff;
+  e5:	8b 84 0d 88 f8 ff ff 	mov    -0x778(%ebp,%ecx,1),%eax
+  ec:	29 47 0c             	sub    %eax,0xc(%edi)
+  b->nwait -= a->nwait;
+  ef:	8b 84 0d 8c f8 ff ff 	mov    -0x774(%ebp,%ecx,1),%eax
+  f6:	29 47 10             	sub    %eax,0x10(%edi)
+  b->waitus -= a->waitus;
+  f9:	8b 84 0d 90 f8 ff ff 	mov    -0x770(%ebp,%ecx,1),%eax
+ 100:	29 47 14             	sub    %eax,0x14(%edi)
+  for(i = 0; i < NWAITHIST; ++i)
+ 103:	8d 41 b0             	lea    -0x50(%ecx),%eax
+ 106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+    b->waithist[i] -= a->waithist[i];
+ 110:	8b 14 03             	mov    (%ebx,%eax,1),%edx
+ 113:	2b 14 06             	sub    (%esi,%eax,1),%edx
+ 116:	89 14 03             	mov    %edx,(%ebx,%eax,1)
+  for(i = 0; i < NWAITHIST; ++i)
+ 119:	83 c0 04             	add    $0x4,%eax
+ 11c:	39 c1                	cmp    %eax,%ecx
+ 11e:	75 f0                	jne    110 <main+0x110>
+  for(i = 0; i < n; ++i)
+ 120:	83 c7 70             	add    $0x70,%edi
+ 123:	83 c1 70             	add    $0x70,%ecx
+ 126:	39 8d e4 f8 ff ff    	cmp    %ecx,-0x71c(%ebp)
+ 12c:	75 9a                	jne    c8 <main+0xc8>
+ 12e:	8b 95 e0 f8 ff ff    	mov    -0x720(%ebp),%edx
+ 134:	8b 85 dc f8 ff ff    	mov    -0x724(%ebp),%eax
+    delta(&before[i], &after[i]);
+  show(after, n, secs);
+ 13a:	89 d1                	mov    %edx,%ecx
+ 13c:	89 c2                	mov    %eax,%edx
+ 13e:	89 d8                	mov    %ebx,%eax
+ 140:	e8 6b 00 00 00       	call   1b0 <show>
+  exit(0);
+ 145:	83 ec 0c             	sub    $0xc,%esp
+ 148:	6a 00                	push   $0x0
+ 14a:	e8 44 06 00 00       	call   793 <exit>
+  if((n = schedstat(before, MAXCPU)) < 0) {
+ 14f:	56                   	push   %esi
+ 150:	56                   	push   %esi
+ 151:	8d b5 e8 f8 ff ff    	lea    -0x718(%ebp),%esi
+ 157:	6a 08                	push   $0x8
+ 159:	56                   	push   %esi
+ 15a:	e8 44 07 00 00       	call   8a3 <schedstat>
+ 15f:	83 c4 10             	add    $0x10,%esp
+ 162:	85 c0                	test   %eax,%eax
+ 164:	78 15                	js     17b <main+0x17b>
+    show(before, n, 0);
+ 166:	89 c2                	mov    %eax,%edx
+ 168:	31 c9                	xor    %ecx,%ecx
+ 16a:	89 f0                	mov    %esi,%eax
+ 16c:	e8 3f 00 00 00       	call   1b0 <show>
+    exit(0);
+ 171:	83 ec 0c             	sub    $0xc,%esp
+ 174:	6a 00                	push   $0x0
+ 176:	e8 18 06 00 00       	call   793 <exit>
+    printf(2, "schedstat: cannot read scheduler statistics\n");
+ 17b:	51                   	push   %ecx
+ 17c:	51                   	push   %ecx
+ 17d:	68 e0 0d 00 00       	push   $0xde0
+ 182:	6a 02                	push   $0x2
+ 184:	e8 e7 07 00 00       	call   970 <printf>
+    exit(1);
+ 189:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 190:	e8 fe 05 00 00       	call   793 <exit>
+    printf(2, "usage: schedstat [seconds]\n");
+ 195:	57                   	push   %edi
+ 196:	57                   	push   %edi
+ 197:	68 48 0e 00 00       	push   $0xe48
+ 19c:	6a 02                	push   $0x2
+ 19e:	e8 cd 07 00 00       	call   970 <printf>
+    exit(1);
+ 1a3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 1aa:	e8 e4 05 00 00       	call   793 <exit>
+ 1af:	90                   	nop
+
+000001b0 <show>:
+show(struct schedstat *ss, int n, int secs) {
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	56                   	push   %esi
+ 1b5:	89 c6                	mov    %eax,%esi
+ 1b7:	53                   	push   %ebx
+ 1b8:	89 d3                	mov    %edx,%ebx
+ 1ba:	83 ec 24             	sub    $0x24,%esp
+ 1bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 1c0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  printf(1, "CPU   VCSW  IVCSW   MIGR HANDOFF   PICKS  AVGWAIT(us) MAXWAIT(us)\n");
+ 1c3:	68 78 0d 00 00       	push   $0xd78
+ 1c8:	6a 01                	push   $0x1
+ 1ca:	e8 a1 07 00 00       	call   970 <printf>
+  for(i = 0; i < n; ++i) {
+ 1cf:	83 c4 10             	add    $0x10,%esp
+ 1d2:	85 db                	test   %ebx,%ebx
+ 1d4:	0f 8e 55 03 00 00    	jle    52f <show+0x37f>
+ 1da:	89 75 dc             	mov    %esi,-0x24(%ebp)
+ 1dd:	31 c0                	xor    %eax,%eax
+ 1df:	89 c7                	mov    %eax,%edi
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    padd(1, ss[i].cpu, 3);
+ 1e8:	83 ec 04             	sub    $0x4,%esp
+ 1eb:	6a 03                	push   $0x3
+ 1ed:	ff 36                	push   (%esi)
+ 1ef:	6a 01                	push   $0x1
+ 1f1:	e8 8a 09 00 00       	call   b80 <padd>
+    padd(1, ss[i].nvcsw, 7);
+ 1f6:	83 c4 0c             	add    $0xc,%esp
+ 1f9:	6a 07                	push   $0x7
+ 1fb:	ff 76 04             	push   0x4(%esi)
+ 1fe:	6a 01                	push   $0x1
+ 200:	e8 7b 09 00 00       	call   b80 <padd>
+    padd(1, ss[i].nivcsw, 7);
+ 205:	83 c4 0c             	add    $0xc,%esp
+ 208:	6a 07                	push   $0x7
+ 20a:	ff 76 08             	push   0x8(%esi)
+ 20d:	6a 01                	push   $0x1
+ 20f:	e8 6c 09 00 00       	call   b80 <padd>
+    padd(1, ss[i].nmigrate, 7);
+ 214:	83 c4 0c             	add    $0xc,%esp
+ 217:	6a 07                	push   $0x7
+ 219:	ff 76 0c             	push   0xc(%esi)
+ 21c:	6a 01                	push   $0x1
+ 21e:	e8 5d 09 00 00       	call   b80 <padd>
+    padd(1, ss[i].nhandoff, 8);
+ 223:	83 c4 0c             	add    $0xc,%esp
+ 226:	6a 08                	push   $0x8
+ 228:	ff 76 10             	push   0x10(%esi)
+ 22b:	6a 01                	push   $0x1
+ 22d:	e8 4e 09 00 00       	call   b80 <padd>
+    padd(1, ss[i].nwait, 8);
+ 232:	83 c4 0c             	add    $0xc,%esp
+ 235:	6a 08                	push   $0x8
+ 237:	ff 76 14             	push   0x14(%esi)
+ 23a:	6a 01                	push   $0x1
+ 23c:	e8 3f 09 00 00       	call   b80 <padd>
+    padd(1, ss[i].nwait ? ss[i].waitus / ss[i].nwait : 0, 13);
+ 241:	8b 4e 14             	mov    0x14(%esi),%ecx
+ 244:	83 c4 10             	add    $0x10,%esp
+ 247:	85 c9                	test   %ecx,%ecx
+ 249:	74 09                	je     254 <show+0xa4>
+ 24b:	8b 46 18             	mov    0x18(%esi),%eax
+ 24e:	31 d2                	xor    %edx,%edx
+ 250:	f7 f1                	div    %ecx
+ 252:	89 c1                	mov    %eax,%ecx
+ 254:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < n; ++i) {
+ 257:	83 c7 01             	add    $0x1,%edi
+ 25a:	83 c6 70             	add    $0x70,%esi
+    padd(1, ss[i].nwait ? ss[i].waitus / ss[i].nwait : 0, 13);
+ 25d:	6a 0d                	push   $0xd
+ 25f:	51                   	push   %ecx
+ 260:	6a 01                	push   $0x1
+ 262:	e8 19 09 00 00       	call   b80 <padd>
+    padd(1, ss[i].maxwaitus, 12);
+ 267:	83 c4 0c             	add    $0xc,%esp
+ 26a:	6a 0c                	push   $0xc
+ 26c:	ff 76 ac             	push   -0x54(%esi)
+ 26f:	6a 01                	push   $0x1
+ 271:	e8 0a 09 00 00       	call   b80 <padd>
+    printf(1, "\n");
+ 276:	58                   	pop    %eax
+ 277:	5a                   	pop    %edx
+ 278:	68 19 0e 00 00       	push   $0xe19
+ 27d:	6a 01                	push   $0x1
+ 27f:	e8 ec 06 00 00       	call   970 <printf>
+  for(i = 0; i < n; ++i) {
+ 284:	83 c4 10             	add    $0x10,%esp
+ 287:	39 fb                	cmp    %edi,%ebx
+ 289:	0f 85 59 ff ff ff    	jne    1e8 <show+0x38>
+  if(secs > 0) {
+ 28f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 292:	8b 7d dc             	mov    -0x24(%ebp),%edi
+ 295:	85 c0                	test   %eax,%eax
+ 297:	0f 85 35 02 00 00    	jne    4d2 <show+0x322>
+  for(last = NWAITHIST-1; last > 0; --last) {
+ 29d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    for(i = 0; i < n; ++i)
+ 2a0:	b9 13 00 00 00       	mov    $0x13,%ecx
+ 2a5:	8d 78 6c             	lea    0x6c(%eax),%edi
+ 2a8:	85 db                	test   %ebx,%ebx
+ 2aa:	0f 8e 6a 01 00 00    	jle    41a <show+0x26a>
+ 2b0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  for(i = 0; i < n; ++i) {
+ 2b3:	89 fa                	mov    %edi,%edx
+    for(i = 0; i < n; ++i)
+ 2b5:	31 c0                	xor    %eax,%eax
+ 2b7:	eb 11                	jmp    2ca <show+0x11a>
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	83 c0 01             	add    $0x1,%eax
+ 2c3:	83 c2 70             	add    $0x70,%edx
+ 2c6:	39 c3                	cmp    %eax,%ebx
+ 2c8:	74 36                	je     300 <show+0x150>
+      if(ss[i].waithist[last])
+ 2ca:	8b 32                	mov    (%edx),%esi
+ 2cc:	85 f6                	test   %esi,%esi
+ 2ce:	74 f0                	je     2c0 <show+0x110>
+    if(i < n)
+ 2d0:	39 c3                	cmp    %eax,%ebx
+ 2d2:	0f 8f 53 01 00 00    	jg     42b <show+0x27b>
+  for(last = NWAITHIST-1; last > 0; --last) {
+ 2d8:	83 ef 04             	sub    $0x4,%edi
+ 2db:	83 e9 01             	sub    $0x1,%ecx
+ 2de:	75 d0                	jne    2b0 <show+0x100>
+  printf(1, "\nrun-queue wait");
+ 2e0:	50                   	push   %eax
+ 2e1:	50                   	push   %eax
+ 2e2:	68 1b 0e 00 00       	push   $0xe1b
+ 2e7:	6a 01                	push   $0x1
+ 2e9:	e8 82 06 00 00       	call   970 <printf>
+ 2ee:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; ++i)
+ 2f1:	31 ff                	xor    %edi,%edi
+ 2f3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 2f6:	e9 41 01 00 00       	jmp    43c <show+0x28c>
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+  for(last = NWAITHIST-1; last > 0; --last) {
+ 300:	83 ef 04             	sub    $0x4,%edi
+ 303:	83 e9 01             	sub    $0x1,%ecx
+ 306:	75 a8                	jne    2b0 <show+0x100>
+  printf(1, "\nrun-queue wait");
+ 308:	50                   	push   %eax
+ 309:	50                   	push   %eax
+ 30a:	68 1b 0e 00 00       	push   $0xe1b
+ 30f:	6a 01                	push   $0x1
+ 311:	e8 5a 06 00 00       	call   970 <printf>
+  for(i = 0; i < n; ++i) {
+ 316:	31 c0                	xor    %eax,%eax
+ 318:	83 c4 10             	add    $0x10,%esp
+ 31b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 31e:	85 db                	test   %ebx,%ebx
+ 320:	7f cf                	jg     2f1 <show+0x141>
+ 322:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "\n");
+ 328:	83 ec 08             	sub    $0x8,%esp
+ 32b:	68 19 0e 00 00       	push   $0xe19
+ 330:	6a 01                	push   $0x1
+ 332:	e8 39 06 00 00       	call   970 <printf>
+  for(j = 0; j <= last; ++j) {
+ 337:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 33a:	83 c0 20             	add    $0x20,%eax
+ 33d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 340:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 343:	83 c0 01             	add    $0x1,%eax
+ 346:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    printf(1, "    ");
+ 349:	58                   	pop    %eax
+ 34a:	5a                   	pop    %edx
+ 34b:	68 33 0e 00 00       	push   $0xe33
+ 350:	6a 01                	push   $0x1
+ 352:	e8 19 06 00 00       	call   970 <printf>
+    printf(1, "     <1us");
+ 357:	59                   	pop    %ecx
+ 358:	5e                   	pop    %esi
+ 359:	68 38 0e 00 00       	push   $0xe38
+ 35e:	6a 01                	push   $0x1
+ 360:	e8 0b 06 00 00       	call   970 <printf>
+  for(j = 0; j <= last; ++j) {
+ 365:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 36c:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; ++i)
+ 36f:	85 db                	test   %ebx,%ebx
+ 371:	7e 29                	jle    39c <show+0x1ec>
+  for(j = 0; j <= last; ++j) {
+ 373:	8b 75 e0             	mov    -0x20(%ebp),%esi
+ 376:	31 ff                	xor    %edi,%edi
+ 378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37f:	90                   	nop
+      padd(1, ss[i].waithist[j], 8);
+ 380:	83 ec 04             	sub    $0x4,%esp
+    for(i = 0; i < n; ++i)
+ 383:	83 c7 01             	add    $0x1,%edi
+ 386:	83 c6 70             	add    $0x70,%esi
+      padd(1, ss[i].waithist[j], 8);
+ 389:	6a 08                	push   $0x8
+ 38b:	ff 76 90             	push   -0x70(%esi)
+ 38e:	6a 01                	push   $0x1
+ 390:	e8 eb 07 00 00       	call   b80 <padd>
+    for(i = 0; i < n; ++i)
+ 395:	83 c4 10             	add    $0x10,%esp
+ 398:	39 fb                	cmp    %edi,%ebx
+ 39a:	7f e4                	jg     380 <show+0x1d0>
+    printf(1, "\n");
+ 39c:	83 ec 08             	sub    $0x8,%esp
+ 39f:	68 19 0e 00 00       	push   $0xe19
+ 3a4:	6a 01                	push   $0x1
+ 3a6:	e8 c5 05 00 00       	call   970 <printf>
+  for(j = 0; j <= last; ++j) {
+ 3ab:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 3af:	83 c4 10             	add    $0x10,%esp
+ 3b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 3b5:	83 45 e0 04          	addl   $0x4,-0x20(%ebp)
+ 3b9:	39 7d dc             	cmp    %edi,-0x24(%ebp)
+ 3bc:	0f 84 08 01 00 00    	je     4ca <show+0x31a>
+    printf(1, "    ");
+ 3c2:	83 ec 08             	sub    $0x8,%esp
+ 3c5:	68 33 0e 00 00       	push   $0xe33
+ 3ca:	6a 01                	push   $0x1
+ 3cc:	e8 9f 05 00 00       	call   970 <printf>
+  else if(i == NWAITHIST-1) {
+ 3d1:	83 c4 10             	add    $0x10,%esp
+ 3d4:	83 ff 13             	cmp    $0x13,%edi
+ 3d7:	0f 84 a3 00 00 00    	je     480 <show+0x2d0>
+    printf(1, " <");
+ 3dd:	83 ec 08             	sub    $0x8,%esp
+ 3e0:	68 45 0e 00 00       	push   $0xe45
+ 3e5:	6a 01                	push   $0x1
+ 3e7:	e8 84 05 00 00       	call   970 <printf>
+    padd(1, 1 << i, 6);
+ 3ec:	83 c4 0c             	add    $0xc,%esp
+ 3ef:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3f4:	6a 06                	push   $0x6
+ 3f6:	0f b6 4d e4          	movzbl -0x1c(%ebp),%ecx
+ 3fa:	d3 e0                	shl    %cl,%eax
+ 3fc:	50                   	push   %eax
+ 3fd:	6a 01                	push   $0x1
+ 3ff:	e8 7c 07 00 00       	call   b80 <padd>
+    printf(1, "us");
+ 404:	5a                   	pop    %edx
+ 405:	59                   	pop    %ecx
+ 406:	68 3f 0e 00 00       	push   $0xe3f
+ 40b:	6a 01                	push   $0x1
+ 40d:	e8 5e 05 00 00       	call   970 <printf>
+ 412:	83 c4 10             	add    $0x10,%esp
+ 415:	e9 55 ff ff ff       	jmp    36f <show+0x1bf>
+  for(last = NWAITHIST-1; last > 0; --last) {
+ 41a:	83 ef 04             	sub    $0x4,%edi
+ 41d:	83 e9 01             	sub    $0x1,%ecx
+ 420:	0f 85 82 fe ff ff    	jne    2a8 <show+0xf8>
+ 426:	e9 dd fe ff ff       	jmp    308 <show+0x158>
+  printf(1, "\nrun-queue wait");
+ 42b:	50                   	push   %eax
+ 42c:	50                   	push   %eax
+ 42d:	68 1b 0e 00 00       	push   $0xe1b
+ 432:	6a 01                	push   $0x1
+ 434:	e8 37 05 00 00       	call   970 <printf>
+ 439:	83 c4 10             	add    $0x10,%esp
+ 43c:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; i < n; ++i) {
+ 43f:	31 f6                	xor    %esi,%esi
+ 441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, "    cpu");
+ 448:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < n; ++i) {
+ 44b:	83 c6 01             	add    $0x1,%esi
+ 44e:	83 c7 70             	add    $0x70,%edi
+    printf(1, "    cpu");
+ 451:	68 2b 0e 00 00       	push   $0xe2b
+ 456:	6a 01                	push   $0x1
+ 458:	e8 13 05 00 00       	call   970 <printf>
+    padd(1, ss[i].cpu, 1);
+ 45d:	83 c4 0c             	add    $0xc,%esp
+ 460:	6a 01                	push   $0x1
+ 462:	ff 77 90             	push   -0x70(%edi)
+ 465:	6a 01                	push   $0x1
+ 467:	e8 14 07 00 00       	call   b80 <padd>
+  for(i = 0; i < n; ++i) {
+ 46c:	83 c4 10             	add    $0x10,%esp
+ 46f:	39 f3                	cmp    %esi,%ebx
+ 471:	75 d5                	jne    448 <show+0x298>
+ 473:	e9 b0 fe ff ff       	jmp    328 <show+0x178>
+ 478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+    printf(1, ">=");
+ 480:	83 ec 08             	sub    $0x8,%esp
+ 483:	68 42 0e 00 00       	push   $0xe42
+ 488:	6a 01                	push   $0x1
+ 48a:	e8 e1 04 00 00       	call   970 <printf>
+    padd(1, 1 << (i-1), 5);
+ 48f:	83 c4 0c             	add    $0xc,%esp
+ 492:	6a 05                	push   $0x5
+ 494:	68 00 00 04 00       	push   $0x40000
+ 499:	6a 01                	push   $0x1
+ 49b:	e8 e0 06 00 00       	call   b80 <padd>
+    printf(1, "us");
+ 4a0:	5e                   	pop    %esi
+ 4a1:	5f                   	pop    %edi
+ 4a2:	68 3f 0e 00 00       	push   $0xe3f
+ 4a7:	6a 01                	push   $0x1
+ 4a9:	e8 c2 04 00 00       	call   970 <printf>
+    for(i = 0; i < n; ++i)
+ 4ae:	83 c4 10             	add    $0x10,%esp
+ 4b1:	85 db                	test   %ebx,%ebx
+ 4b3:	0f 8f ba fe ff ff    	jg     373 <show+0x1c3>
+    printf(1, "\n");
+ 4b9:	50                   	push   %eax
+ 4ba:	50                   	push   %eax
+ 4bb:	68 19 0e 00 00       	push   $0xe19
+ 4c0:	6a 01                	push   $0x1
+ 4c2:	e8 a9 04 00 00       	call   970 <printf>
+ 4c7:	83 c4 10             	add    $0x10,%esp
+}
+ 4ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4cd:	5b                   	pop    %ebx
+ 4ce:	5e                   	pop    %esi
+ 4cf:	5f                   	pop    %edi
+ 4d0:	5d                   	pop    %ebp
+ 4d1:	c3                   	ret
+    printf(1, "\nper second:\n");
+ 4d2:	50                   	push   %eax
+ 4d3:	6b f3 70             	imul   $0x70,%ebx,%esi
+ 4d6:	50                   	push   %eax
+ 4d7:	68 0d 0e 00 00       	push   $0xe0d
+ 4dc:	6a 01                	push   $0x1
+ 4de:	e8 8d 04 00 00       	call   970 <printf>
+    for(i = 0; i < n; ++i)
+ 4e3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 4e6:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+ 4e9:	89 fb                	mov    %edi,%ebx
+ 4eb:	83 c4 10             	add    $0x10,%esp
+ 4ee:	01 ce                	add    %ecx,%esi
+ 4f0:	89 f7                	mov    %esi,%edi
+ 4f2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ 4f5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(1, "cpu%d: %d switches, %d migrations\n", ss[i].cpu,
+ 4f8:	8b 43 0c             	mov    0xc(%ebx),%eax
+ 4fb:	31 d2                	xor    %edx,%edx
+ 4fd:	83 ec 0c             	sub    $0xc,%esp
+    for(i = 0; i < n; ++i)
+ 500:	83 c3 70             	add    $0x70,%ebx
+      printf(1, "cpu%d: %d switches, %d migrations\n", ss[i].cpu,
+ 503:	f7 f6                	div    %esi
+ 505:	31 d2                	xor    %edx,%edx
+ 507:	50                   	push   %eax
+             (ss[i].nvcsw + ss[i].nivcsw) / secs, ss[i].nmigrate / secs);
+ 508:	8b 43 98             	mov    -0x68(%ebx),%eax
+ 50b:	03 43 94             	add    -0x6c(%ebx),%eax
+      printf(1, "cpu%d: %d switches, %d migrations\n", ss[i].cpu,
+ 50e:	f7 f6                	div    %esi
+ 510:	50                   	push   %eax
+ 511:	ff 73 90             	push   -0x70(%ebx)
+ 514:	68 bc 0d 00 00       	push   $0xdbc
+ 519:	6a 01                	push   $0x1
+ 51b:	e8 50 04 00 00       	call   970 <printf>
+    for(i = 0; i < n; ++i)
+ 520:	83 c4 20             	add    $0x20,%esp
+ 523:	39 fb                	cmp    %edi,%ebx
+ 525:	75 d1                	jne    4f8 <show+0x348>
+ 527:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ 52a:	e9 6e fd ff ff       	jmp    29d <show+0xed>
+  if(secs > 0) {
+ 52f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 533:	0f 84 64 fd ff ff    	je     29d <show+0xed>
+    printf(1, "\nper second:\n");
+ 539:	50                   	push   %eax
+ 53a:	50                   	push   %eax
+ 53b:	68 0d 0e 00 00       	push   $0xe0d
+ 540:	6a 01                	push   $0x1
+ 542:	e8 29 04 00 00       	call   970 <printf>
+ 547:	83 c4 10             	add    $0x10,%esp
+ 54a:	e9 4e fd ff ff       	jmp    29d <show+0xed>
+ 54f:	90                   	nop
+
+00000550 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 550:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 551:	31 c0                	xor    %eax,%eax
+{
+ 553:	89 e5                	mov    %esp,%ebp
+ 555:	53                   	push   %ebx
+ 556:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 559:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 55c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 560:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 564:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 567:	83 c0 01             	add    $0x1,%eax
+ 56a:	84 d2                	test   %dl,%dl
+ 56c:	75 f2                	jne    560 <strcpy+0x10>
+    ;
+  return os;
+}
+ 56e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 571:	89 c8                	mov    %ecx,%eax
+ 573:	c9                   	leave
+ 574:	c3                   	ret
+ 575:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	53                   	push   %ebx
+ 584:	8b 55 08             	mov    0x8(%ebp),%edx
+ 587:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 58a:	0f b6 02             	movzbl (%edx),%eax
+ 58d:	84 c0                	test   %al,%al
+ 58f:	75 17                	jne    5a8 <strcmp+0x28>
+ 591:	eb 3a                	jmp    5cd <strcmp+0x4d>
+ 593:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 597:	90                   	nop
+ 598:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 59c:	83 c2 01             	add    $0x1,%edx
+ 59f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 5a2:	84 c0                	test   %al,%al
+ 5a4:	74 1a                	je     5c0 <strcmp+0x40>
+    p++, q++;
+ 5a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 5a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 5ab:	38 c3                	cmp    %al,%bl
+ 5ad:	74 e9                	je     598 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 5af:	29 d8                	sub    %ebx,%eax
+}
+ 5b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5b4:	c9                   	leave
+ 5b5:	c3                   	ret
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 5c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 5c4:	31 c0                	xor    %eax,%eax
+ 5c6:	29 d8                	sub    %ebx,%eax
+}
+ 5c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5cb:	c9                   	leave
+ 5cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 5cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 5d0:	31 c0                	xor    %eax,%eax
+ 5d2:	eb db                	jmp    5af <strcmp+0x2f>
+ 5d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+
+000005e0 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 5e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 5e9:	74 15                	je     600 <strlen+0x20>
+ 5eb:	31 c0                	xor    %eax,%eax
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 5f0:	83 c0 01             	add    $0x1,%eax
+ 5f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 5f7:	89 c1                	mov    %eax,%ecx
+ 5f9:	75 f5                	jne    5f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 5fb:	89 c8                	mov    %ecx,%eax
+ 5fd:	5d                   	pop    %ebp
+ 5fe:	c3                   	ret
+ 5ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 600:	31 c9                	xor    %ecx,%ecx
+}
+ 602:	5d                   	pop    %ebp
+ 603:	89 c8                	mov    %ecx,%eax
+ 605:	c3                   	ret
+ 606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000610 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 617:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 61a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 61d:	89 d7                	mov    %edx,%edi
+ 61f:	fc                   	cld
+ 620:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 622:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 625:	89 d0                	mov    %edx,%eax
+ 627:	c9                   	leave
+ 628:	c3                   	ret
+ 629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	8b 45 08             	mov    0x8(%ebp),%eax
+ 636:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 63a:	0f b6 10             	movzbl (%eax),%edx
+ 63d:	84 d2                	test   %dl,%dl
+ 63f:	75 12                	jne    653 <strchr+0x23>
+ 641:	eb 1d                	jmp    660 <strchr+0x30>
+ 643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 647:	90                   	nop
+ 648:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 64c:	83 c0 01             	add    $0x1,%eax
+ 64f:	84 d2                	test   %dl,%dl
+ 651:	74 0d                	je     660 <strchr+0x30>
+    if(*s == c)
+ 653:	38 d1                	cmp    %dl,%cl
+ 655:	75 f1                	jne    648 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 657:	5d                   	pop    %ebp
+ 658:	c3                   	ret
+ 659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 660:	31 c0                	xor    %eax,%eax
+}
+ 662:	5d                   	pop    %ebp
+ 663:	c3                   	ret
+ 664:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+
+00000670 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 675:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 678:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 679:	31 db                	xor    %ebx,%ebx
+{
+ 67b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 67e:	eb 27                	jmp    6a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	6a 01                	push   $0x1
+ 685:	56                   	push   %esi
+ 686:	6a 00                	push   $0x0
+ 688:	e8 1e 01 00 00       	call   7ab <read>
+    if(cc < 1)
+ 68d:	83 c4 10             	add    $0x10,%esp
+ 690:	85 c0                	test   %eax,%eax
+ 692:	7e 1d                	jle    6b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 694:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 698:	8b 55 08             	mov    0x8(%ebp),%edx
+ 69b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 69f:	3c 0a                	cmp    $0xa,%al
+ 6a1:	74 10                	je     6b3 <gets+0x43>
+ 6a3:	3c 0d                	cmp    $0xd,%al
+ 6a5:	74 0c                	je     6b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 6a7:	89 df                	mov    %ebx,%edi
+ 6a9:	83 c3 01             	add    $0x1,%ebx
+ 6ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 6af:	7c cf                	jl     680 <gets+0x10>
+ 6b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 6b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 6ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6bd:	5b                   	pop    %ebx
+ 6be:	5e                   	pop    %esi
+ 6bf:	5f                   	pop    %edi
+ 6c0:	5d                   	pop    %ebp
+ 6c1:	c3                   	ret
+ 6c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006d0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	56                   	push   %esi
+ 6d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 6d5:	83 ec 08             	sub    $0x8,%esp
+ 6d8:	6a 00                	push   $0x0
+ 6da:	ff 75 08             	push   0x8(%ebp)
+ 6dd:	e8 f1 00 00 00       	call   7d3 <open>
+  if(fd < 0)
+ 6e2:	83 c4 10             	add    $0x10,%esp
+ 6e5:	85 c0                	test   %eax,%eax
+ 6e7:	78 27                	js     710 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 6e9:	83 ec 08             	sub    $0x8,%esp
+ 6ec:	ff 75 0c             	push   0xc(%ebp)
+ 6ef:	89 c3                	mov    %eax,%ebx
+ 6f1:	50                   	push   %eax
+ 6f2:	e8 f4 00 00 00       	call   7eb <fstat>
+  close(fd);
+ 6f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 6fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 6fc:	e8 ba 00 00 00       	call   7bb <close>
+  return r;
+ 701:	83 c4 10             	add    $0x10,%esp
+}
+ 704:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 707:	89 f0                	mov    %esi,%eax
+ 709:	5b                   	pop    %ebx
+ 70a:	5e                   	pop    %esi
+ 70b:	5d                   	pop    %ebp
+ 70c:	c3                   	ret
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 710:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 715:	eb ed                	jmp    704 <stat+0x34>
+ 717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71e:	66 90                	xchg   %ax,%ax
+
+00000720 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	53                   	push   %ebx
+ 724:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 727:	0f be 02             	movsbl (%edx),%eax
+ 72a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 72d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 730:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 735:	77 1e                	ja     755 <atoi+0x35>
+ 737:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 740:	83 c2 01             	add    $0x1,%edx
+ 743:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 746:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 74a:	0f be 02             	movsbl (%edx),%eax
+ 74d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 750:	80 fb 09             	cmp    $0x9,%bl
+ 753:	76 eb                	jbe    740 <atoi+0x20>
+  return n;
+}
+ 755:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 758:	89 c8                	mov    %ecx,%eax
+ 75a:	c9                   	leave
+ 75b:	c3                   	ret
+ 75c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	57                   	push   %edi
+ 764:	56                   	push   %esi
+ 765:	8b 45 10             	mov    0x10(%ebp),%eax
+ 768:	8b 55 08             	mov    0x8(%ebp),%edx
+ 76b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 76e:	85 c0                	test   %eax,%eax
+ 770:	7e 13                	jle    785 <memmove+0x25>
+ 772:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 774:	89 d7                	mov    %edx,%edi
+ 776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 780:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 781:	39 f8                	cmp    %edi,%eax
+ 783:	75 fb                	jne    780 <memmove+0x20>
+  return vdst;
+}
+ 785:	5e                   	pop    %esi
+ 786:	89 d0                	mov    %edx,%eax
+ 788:	5f                   	pop    %edi
+ 789:	5d                   	pop    %ebp
+ 78a:	c3                   	ret
+
+0000078b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 78b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <exit>:
+SYSCALL(exit)
+ 793:	b8 02 00 00 00       	mov    $0x2,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <wait>:
+SYSCALL(wait)
+ 79b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <pipe>:
+SYSCALL(pipe)
+ 7a3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <read>:
+SYSCALL(read)
+ 7ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <write>:
+SYSCALL(write)
+ 7b3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <close>:
+SYSCALL(close)
+ 7bb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <kill>:
+SYSCALL(kill)
+ 7c3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <exec>:
+SYSCALL(exec)
+ 7cb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <open>:
+SYSCALL(open)
+ 7d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7d8:	cd 40                	int    $0x40
+ 7da:	c3                   	ret
+
+000007db <mknod>:
+SYSCALL(mknod)
+ 7db:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <unlink>:
+SYSCALL(unlink)
+ 7e3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7e8:	cd 40                	int    $0x40
+ 7ea:	c3                   	ret
+
+000007eb <fstat>:
+SYSCALL(fstat)
+ 7eb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <link>:
+SYSCALL(link)
+ 7f3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7f8:	cd 40                	int    $0x40
+ 7fa:	c3                   	ret
+
+000007fb <mkdir>:
+SYSCALL(mkdir)
+ 7fb:	b8 14 00 00 00       	mov    $0x14,%eax
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <chdir>:
+SYSCALL(chdir)
+ 803:	b8 09 00 00 00       	mov    $0x9,%eax
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <dup>:
+SYSCALL(dup)
+ 80b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <getpid>:
+SYSCALL(getpid)
+ 813:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <sbrk>:
+SYSCALL(sbrk)
+ 81b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <sleep>:
+SYSCALL(sleep)
+ 823:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <uptime>:
+SYSCALL(uptime)
+ 82b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <getdate>:
+SYSCALL(getdate)
+ 833:	b8 16 00 00 00       	mov    $0x16,%eax
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <setdate>:
+SYSCALL(setdate)
+ 83b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <mount>:
+SYSCALL(mount)
+ 843:	b8 18 00 00 00       	mov    $0x18,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <unmount>:
+SYSCALL(unmount)
+ 84b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <lseek>:
+SYSCALL(lseek)
+ 853:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <mmap>:
+SYSCALL(mmap)
+ 85b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <munmap>:
+SYSCALL(munmap)
+ 863:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <clock_gettime>:
+SYSCALL(clock_gettime)
+ 86b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <nanosleep>:
+SYSCALL(nanosleep)
+ 873:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 87b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 883:	b8 20 00 00 00       	mov    $0x20,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <proclimit>:
+SYSCALL(proclimit)
+ 88b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <procinfo>:
+SYSCALL(procinfo)
+ 893:	b8 22 00 00 00       	mov    $0x22,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <cpuinfo>:
+SYSCALL(cpuinfo)
+ 89b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <schedstat>:
+SYSCALL(schedstat)
+ 8a3:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8a8:	cd 40                	int    $0x40
+ 8aa:	c3                   	ret
+
+000008ab <lockstat>:
+SYSCALL(lockstat)
+ 8ab:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+000008b3 <bcachestat>:
+SYSCALL(bcachestat)
+ 8b3:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8b8:	cd 40                	int    $0x40
+ 8ba:	c3                   	ret
+
+000008bb <diskstat>:
+SYSCALL(diskstat)
+ 8bb:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	c3                   	ret
+
+000008c3 <iosched>:
+SYSCALL(iosched)
+ 8c3:	b8 28 00 00 00       	mov    $0x28,%eax
+ 8c8:	cd 40                	int    $0x40
+ 8ca:	c3                   	ret
+ 8cb:	66 90                	xchg   %ax,%ax
+ 8cd:	66 90                	xchg   %ax,%ax
+ 8cf:	90                   	nop
+
+000008d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8d8:	89 d1                	mov    %edx,%ecx
+{
+ 8da:	83 ec 3c             	sub    $0x3c,%esp
+ 8dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8e0:	85 d2                	test   %edx,%edx
+ 8e2:	0f 89 80 00 00 00    	jns    968 <printint+0x98>
+ 8e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8ec:	74 7a                	je     968 <printint+0x98>
+    x = -xx;
+ 8ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8f8:	31 f6                	xor    %esi,%esi
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 900:	89 c8                	mov    %ecx,%eax
+ 902:	31 d2                	xor    %edx,%edx
+ 904:	89 f7                	mov    %esi,%edi
+ 906:	f7 f3                	div    %ebx
+ 908:	8d 76 01             	lea    0x1(%esi),%esi
+ 90b:	0f b6 92 c8 0e 00 00 	movzbl 0xec8(%edx),%edx
+ 912:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 916:	89 ca                	mov    %ecx,%edx
+ 918:	89 c1                	mov    %eax,%ecx
+ 91a:	39 da                	cmp    %ebx,%edx
+ 91c:	73 e2                	jae    900 <printint+0x30>
+  if(neg)
+ 91e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 921:	85 c0                	test   %eax,%eax
+ 923:	74 07                	je     92c <printint+0x5c>
+    buf[i++] = '-';
+ 925:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 92a:	89 f7                	mov    %esi,%edi
+ 92c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 92f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 932:	01 df                	add    %ebx,%edi
+ 934:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 938:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 93b:	83 ec 04             	sub    $0x4,%esp
+ 93e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 941:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 944:	6a 01                	push   $0x1
+ 946:	50                   	push   %eax
+ 947:	56                   	push   %esi
+ 948:	e8 66 fe ff ff       	call   7b3 <write>
+  while(--i >= 0)
+ 94d:	89 f8                	mov    %edi,%eax
+ 94f:	83 c4 10             	add    $0x10,%esp
+ 952:	83 ef 01             	sub    $0x1,%edi
+ 955:	39 d8                	cmp    %ebx,%eax
+ 957:	75 df                	jne    938 <printint+0x68>
+}
+ 959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 95c:	5b                   	pop    %ebx
+ 95d:	5e                   	pop    %esi
+ 95e:	5f                   	pop    %edi
+ 95f:	5d                   	pop    %ebp
+ 960:	c3                   	ret
+ 961:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 968:	31 c0                	xor    %eax,%eax
+ 96a:	eb 89                	jmp    8f5 <printint+0x25>
+ 96c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000970 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 979:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+ 97c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 97f:	0f b6 1e             	movzbl (%esi),%ebx
+ 982:	83 c6 01             	add    $0x1,%esi
+ 985:	84 db                	test   %bl,%bl
+ 987:	74 67                	je     9f0 <printf+0x80>
+ 989:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 98c:	31 d2                	xor    %edx,%edx
+ 98e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 991:	eb 34                	jmp    9c7 <printf+0x57>
+ 993:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 997:	90                   	nop
+ 998:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 99b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9a0:	83 f8 25             	cmp    $0x25,%eax
+ 9a3:	74 18                	je     9bd <printf+0x4d>
+  write(fd, &c, 1);
+ 9a5:	83 ec 04             	sub    $0x4,%esp
+ 9a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ae:	6a 01                	push   $0x1
+ 9b0:	50                   	push   %eax
+ 9b1:	57                   	push   %edi
+ 9b2:	e8 fc fd ff ff       	call   7b3 <write>
+ 9b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 9c0:	83 c6 01             	add    $0x1,%esi
+ 9c3:	84 db                	test   %bl,%bl
+ 9c5:	74 29                	je     9f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9ca:	85 d2                	test   %edx,%edx
+ 9cc:	74 ca                	je     998 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9ce:	83 fa 25             	cmp    $0x25,%edx
+ 9d1:	75 ea                	jne    9bd <printf+0x4d>
+      if(c == 'd'){
+ 9d3:	83 f8 25             	cmp    $0x25,%eax
+ 9d6:	0f 84 24 01 00 00    	je     b00 <printf+0x190>
+ 9dc:	83 e8 63             	sub    $0x63,%eax
+ 9df:	83 f8 15             	cmp    $0x15,%eax
+ 9e2:	77 1c                	ja     a00 <printf+0x90>
+ 9e4:	ff 24 85 70 0e 00 00 	jmp    *0xe70(,%eax,4)
+ 9eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9f3:	5b                   	pop    %ebx
+ 9f4:	5e                   	pop    %esi
+ 9f5:	5f                   	pop    %edi
+ 9f6:	5d                   	pop    %ebp
+ 9f7:	c3                   	ret
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+  write(fd, &c, 1);
+ a00:	83 ec 04             	sub    $0x4,%esp
+ a03:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a06:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a0a:	6a 01                	push   $0x1
+ a0c:	52                   	push   %edx
+ a0d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a10:	57                   	push   %edi
+ a11:	e8 9d fd ff ff       	call   7b3 <write>
+ a16:	83 c4 0c             	add    $0xc,%esp
+ a19:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a1c:	6a 01                	push   $0x1
+ a1e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a21:	52                   	push   %edx
+ a22:	57                   	push   %edi
+ a23:	e8 8b fd ff ff       	call   7b3 <write>
+        putc(fd, c);
+ a28:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a2b:	31 d2                	xor    %edx,%edx
+ a2d:	eb 8e                	jmp    9bd <printf+0x4d>
+ a2f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a33:	83 ec 0c             	sub    $0xc,%esp
+ a36:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a3b:	8b 13                	mov    (%ebx),%edx
+ a3d:	6a 00                	push   $0x0
+ a3f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a41:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a44:	e8 87 fe ff ff       	call   8d0 <printint>
+        ap++;
+ a49:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a4c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a4f:	31 d2                	xor    %edx,%edx
+ a51:	e9 67 ff ff ff       	jmp    9bd <printf+0x4d>
+ a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a60:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a63:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a65:	83 c0 04             	add    $0x4,%eax
+ a68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a6b:	85 db                	test   %ebx,%ebx
+ a6d:	0f 84 9d 00 00 00    	je     b10 <printf+0x1a0>
+        while(*s != 0){
+ a73:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a76:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a78:	84 c0                	test   %al,%al
+ a7a:	0f 84 3d ff ff ff    	je     9bd <printf+0x4d>
+ a80:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a83:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a86:	89 de                	mov    %ebx,%esi
+ a88:	89 d3                	mov    %edx,%ebx
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a90:	83 ec 04             	sub    $0x4,%esp
+ a93:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a96:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a99:	6a 01                	push   $0x1
+ a9b:	53                   	push   %ebx
+ a9c:	57                   	push   %edi
+ a9d:	e8 11 fd ff ff       	call   7b3 <write>
+        while(*s != 0){
+ aa2:	0f b6 06             	movzbl (%esi),%eax
+ aa5:	83 c4 10             	add    $0x10,%esp
+ aa8:	84 c0                	test   %al,%al
+ aaa:	75 e4                	jne    a90 <printf+0x120>
+      state = 0;
+ aac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ aaf:	31 d2                	xor    %edx,%edx
+ ab1:	e9 07 ff ff ff       	jmp    9bd <printf+0x4d>
+ ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ac0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ac3:	83 ec 0c             	sub    $0xc,%esp
+ ac6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ acb:	8b 13                	mov    (%ebx),%edx
+ acd:	6a 01                	push   $0x1
+ acf:	e9 6b ff ff ff       	jmp    a3f <printf+0xcf>
+ ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ ad8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ adb:	83 ec 04             	sub    $0x4,%esp
+ ade:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ae1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ae3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ae6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ae9:	6a 01                	push   $0x1
+ aeb:	52                   	push   %edx
+ aec:	57                   	push   %edi
+ aed:	e8 c1 fc ff ff       	call   7b3 <write>
+        ap++;
+ af2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ af5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ af8:	31 d2                	xor    %edx,%edx
+ afa:	e9 be fe ff ff       	jmp    9bd <printf+0x4d>
+ aff:	90                   	nop
+  write(fd, &c, 1);
+ b00:	83 ec 04             	sub    $0x4,%esp
+ b03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b09:	6a 01                	push   $0x1
+ b0b:	e9 11 ff ff ff       	jmp    a21 <printf+0xb1>
+ b10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b15:	bb 64 0e 00 00       	mov    $0xe64,%ebx
+ b1a:	e9 61 ff ff ff       	jmp    a80 <printf+0x110>
+ b1f:	90                   	nop
+
+00000b20 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+ b23:	57                   	push   %edi
+ b24:	56                   	push   %esi
+ b25:	53                   	push   %ebx
+ b26:	83 ec 20             	sub    $0x20,%esp
+ b29:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ b2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+ b2f:	57                   	push   %edi
+ b30:	68 6b 0e 00 00       	push   $0xe6b
+ b35:	53                   	push   %ebx
+ b36:	e8 35 fe ff ff       	call   970 <printf>
+  for(n = strlen(s); n < w; n++)
+ b3b:	89 3c 24             	mov    %edi,(%esp)
+ b3e:	e8 9d fa ff ff       	call   5e0 <strlen>
+ b43:	83 c4 10             	add    $0x10,%esp
+ b46:	3b 45 10             	cmp    0x10(%ebp),%eax
+ b49:	7d 20                	jge    b6b <pads+0x4b>
+ b4b:	89 c6                	mov    %eax,%esi
+ b4d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+ b50:	83 ec 04             	sub    $0x4,%esp
+ b53:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+ b57:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b5a:	6a 01                	push   $0x1
+ b5c:	57                   	push   %edi
+ b5d:	53                   	push   %ebx
+ b5e:	e8 50 fc ff ff       	call   7b3 <write>
+  for(n = strlen(s); n < w; n++)
+ b63:	83 c4 10             	add    $0x10,%esp
+ b66:	39 75 10             	cmp    %esi,0x10(%ebp)
+ b69:	75 e5                	jne    b50 <pads+0x30>
+    putc(fd, ' ');
+}
+ b6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b6e:	5b                   	pop    %ebx
+ b6f:	5e                   	pop    %esi
+ b70:	5f                   	pop    %edi
+ b71:	5d                   	pop    %ebp
+ b72:	c3                   	ret
+ b73:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000b80 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+ b80:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+ b81:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+ b86:	89 e5                	mov    %esp,%ebp
+ b88:	57                   	push   %edi
+ b89:	56                   	push   %esi
+ b8a:	53                   	push   %ebx
+  int n = 0;
+ b8b:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+ b8d:	83 ec 2c             	sub    $0x2c,%esp
+ b90:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b93:	8b 45 10             	mov    0x10(%ebp),%eax
+ b96:	8b 75 08             	mov    0x8(%ebp),%esi
+ b99:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ b9c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ b9f:	90                   	nop
+  }while((x /= 10) != 0);
+ ba0:	89 d0                	mov    %edx,%eax
+ ba2:	89 d7                	mov    %edx,%edi
+    n++;
+ ba4:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+ ba7:	f7 e1                	mul    %ecx
+ ba9:	c1 ea 03             	shr    $0x3,%edx
+ bac:	83 ff 09             	cmp    $0x9,%edi
+ baf:	77 ef                	ja     ba0 <padd+0x20>
+  for(; n < w; n++)
+ bb1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ bb4:	39 c3                	cmp    %eax,%ebx
+ bb6:	7d 23                	jge    bdb <padd+0x5b>
+ bb8:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ bbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bbf:	90                   	nop
+  write(fd, &c, 1);
+ bc0:	83 ec 04             	sub    $0x4,%esp
+ bc3:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+ bc7:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+ bca:	6a 01                	push   $0x1
+ bcc:	57                   	push   %edi
+ bcd:	56                   	push   %esi
+ bce:	e8 e0 fb ff ff       	call   7b3 <write>
+  for(; n < w; n++)
+ bd3:	83 c4 10             	add    $0x10,%esp
+ bd6:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+ bd9:	75 e5                	jne    bc0 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+ bdb:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+ be2:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+ be5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+ be8:	89 f0                	mov    %esi,%eax
+}
+ bea:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+ beb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+ bf0:	5e                   	pop    %esi
+ bf1:	5f                   	pop    %edi
+ bf2:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+ bf3:	e9 d8 fc ff ff       	jmp    8d0 <printint>
+ bf8:	66 90                	xchg   %ax,%ax
+ bfa:	66 90                	xchg   %ax,%ax
+ bfc:	66 90                	xchg   %ax,%ax
+ bfe:	66 90                	xchg   %ax,%ax
+
+00000c00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c01:	a1 fc 11 00 00       	mov    0x11fc,%eax
+{
+ c06:	89 e5                	mov    %esp,%ebp
+ c08:	57                   	push   %edi
+ c09:	56                   	push   %esi
+ c0a:	53                   	push   %ebx
+ c0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c1c:	39 ca                	cmp    %ecx,%edx
+ c1e:	73 30                	jae    c50 <free+0x50>
+ c20:	39 c1                	cmp    %eax,%ecx
+ c22:	72 04                	jb     c28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c24:	39 c2                	cmp    %eax,%edx
+ c26:	72 f0                	jb     c18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c2e:	39 f8                	cmp    %edi,%eax
+ c30:	74 2e                	je     c60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c35:	8b 42 04             	mov    0x4(%edx),%eax
+ c38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c3b:	39 f1                	cmp    %esi,%ecx
+ c3d:	74 38                	je     c77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c41:	5b                   	pop    %ebx
+  freep = p;
+ c42:	89 15 fc 11 00 00    	mov    %edx,0x11fc
+}
+ c48:	5e                   	pop    %esi
+ c49:	5f                   	pop    %edi
+ c4a:	5d                   	pop    %ebp
+ c4b:	c3                   	ret
+ c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c50:	39 c1                	cmp    %eax,%ecx
+ c52:	72 d0                	jb     c24 <free+0x24>
+ c54:	eb c2                	jmp    c18 <free+0x18>
+ c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c60:	03 70 04             	add    0x4(%eax),%esi
+ c63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c66:	8b 02                	mov    (%edx),%eax
+ c68:	8b 00                	mov    (%eax),%eax
+ c6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c6d:	8b 42 04             	mov    0x4(%edx),%eax
+ c70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c73:	39 f1                	cmp    %esi,%ecx
+ c75:	75 c8                	jne    c3f <free+0x3f>
+    p->s.size += bp->s.size;
+ c77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c7a:	89 15 fc 11 00 00    	mov    %edx,0x11fc
+    p->s.size += bp->s.size;
+ c80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c86:	89 0a                	mov    %ecx,(%edx)
+}
+ c88:	5b                   	pop    %ebx
+ c89:	5e                   	pop    %esi
+ c8a:	5f                   	pop    %edi
+ c8b:	5d                   	pop    %ebp
+ c8c:	c3                   	ret
+ c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c90 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+ c90:	55                   	push   %ebp
+ c91:	89 e5                	mov    %esp,%ebp
+ c93:	57                   	push   %edi
+ c94:	56                   	push   %esi
+ c95:	53                   	push   %ebx
+ c96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c9c:	8b 15 fc 11 00 00    	mov    0x11fc,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ca2:	8d 78 07             	lea    0x7(%eax),%edi
+ ca5:	c1 ef 03             	shr    $0x3,%edi
+ ca8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ cab:	85 d2                	test   %edx,%edx
+ cad:	0f 84 8d 00 00 00    	je     d40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cb3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cb5:	8b 48 04             	mov    0x4(%eax),%ecx
+ cb8:	39 f9                	cmp    %edi,%ecx
+ cba:	73 64                	jae    d20 <malloc+0x90>
+  if(nu < 4096)
+ cbc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ cc1:	39 df                	cmp    %ebx,%edi
+ cc3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ cc6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ ccd:	eb 0a                	jmp    cd9 <malloc+0x49>
+ ccf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cd2:	8b 48 04             	mov    0x4(%eax),%ecx
+ cd5:	39 f9                	cmp    %edi,%ecx
+ cd7:	73 47                	jae    d20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ cd9:	89 c2                	mov    %eax,%edx
+ cdb:	39 05 fc 11 00 00    	cmp    %eax,0x11fc
+ ce1:	75 ed                	jne    cd0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ce3:	83 ec 0c             	sub    $0xc,%esp
+ ce6:	56                   	push   %esi
+ ce7:	e8 2f fb ff ff       	call   81b <sbrk>
+  if(p == (char*)-1)
+ cec:	83 c4 10             	add    $0x10,%esp
+ cef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cf2:	74 1c                	je     d10 <malloc+0x80>
+  hp->s.size = nu;
+ cf4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ cf7:	83 ec 0c             	sub    $0xc,%esp
+ cfa:	83 c0 08             	add    $0x8,%eax
+ cfd:	50                   	push   %eax
+ cfe:	e8 fd fe ff ff       	call   c00 <free>
+  return freep;
+ d03:	8b 15 fc 11 00 00    	mov    0x11fc,%edx
+      if((p = morecore(nunits)) == 0)
+ d09:	83 c4 10             	add    $0x10,%esp
+ d0c:	85 d2                	test   %edx,%edx
+ d0e:	75 c0                	jne    cd0 <malloc+0x40>
+        return 0;
+  }
+}
+ d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d13:	31 c0                	xor    %eax,%eax
+}
+ d15:	5b                   	pop    %ebx
+ d16:	5e                   	pop    %esi
+ d17:	5f                   	pop    %edi
+ d18:	5d                   	pop    %ebp
+ d19:	c3                   	ret
+ d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d20:	39 cf                	cmp    %ecx,%edi
+ d22:	74 4c                	je     d70 <malloc+0xe0>
+        p->s.size -= nunits;
+ d24:	29 f9                	sub    %edi,%ecx
+ d26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d2f:	89 15 fc 11 00 00    	mov    %edx,0x11fc
+}
+ d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d38:	83 c0 08             	add    $0x8,%eax
+}
+ d3b:	5b                   	pop    %ebx
+ d3c:	5e                   	pop    %esi
+ d3d:	5f                   	pop    %edi
+ d3e:	5d                   	pop    %ebp
+ d3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d40:	c7 05 fc 11 00 00 00 	movl   $0x1200,0x11fc
+ d47:	12 00 00 
+    base.s.size = 0;
+ d4a:	b8 00 12 00 00       	mov    $0x1200,%eax
+    base.s.ptr = freep = prevp = &base;
+ d4f:	c7 05 00 12 00 00 00 	movl   $0x1200,0x1200
+ d56:	12 00 00 
+    base.s.size = 0;
+ d59:	c7 05 04 12 00 00 00 	movl   $0x0,0x1204
+ d60:	00 00 00 
+    if(p->s.size >= nunits){
+ d63:	e9 54 ff ff ff       	jmp    cbc <malloc+0x2c>
+ d68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d70:	8b 08                	mov    (%eax),%ecx
+ d72:	89 0a                	mov    %ecx,(%edx)
+ d74:	eb b9                	jmp    d2f <malloc+0x9f>
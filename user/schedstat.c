@@ -0,0 +1,114 @@
+#include "kernel/types.h"
+#include "kernel/procinfo.h"
+#include "user.h"
+
+#define MAXCPU 8
+
+/* Upper bound (us) of histogram bucket i, as text */
+static void
+bucket(int i) {
+  if(i == 0)
+    printf(1, "     <1us");
+  else if(i == NWAITHIST-1) {
+    printf(1, ">=");
+    padd(1, 1 << (i-1), 5);
+    printf(1, "us");
+  } else {
+    printf(1, " <");
+    padd(1, 1 << i, 6);
+    printf(1, "us");
+  }
+}
+
+/* Subtract the counters in a from those in b */
+static void
+delta(struct schedstat *a, struct schedstat *b) {
+  int i;
+
+  b->nvcsw -= a->nvcsw;
+  b->nivcsw -= a->nivcsw;
+  b->nmigrate -= a->nmigrate;
+  b->nhandoff -= a->nhandoff;
+  b->nwait -= a->nwait;
+  b->waitus -= a->waitus;
+  for(i = 0; i < NWAITHIST; ++i)
+    b->waithist[i] -= a->waithist[i];
+}
+
+static void
+show(struct schedstat *ss, int n, int secs) {
+  int i, j, last;
+
+  printf(1, "CPU   VCSW  IVCSW   MIGR HANDOFF   PICKS  AVGWAIT(us) MAXWAIT(us)\n");
+  for(i = 0; i < n; ++i) {
+    padd(1, ss[i].cpu, 3);
+    padd(1, ss[i].nvcsw, 7);
+    padd(1, ss[i].nivcsw, 7);
+    padd(1, ss[i].nmigrate, 7);
+    padd(1, ss[i].nhandoff, 8);
+    padd(1, ss[i].nwait, 8);
+    padd(1, ss[i].nwait ? ss[i].waitus / ss[i].nwait : 0, 13);
+    padd(1, ss[i].maxwaitus, 12);
+    printf(1, "\n");
+  }
+  if(secs > 0) {
+    printf(1, "\nper second:\n");
+    for(i = 0; i < n; ++i)
+      printf(1, "cpu%d: %d switches, %d migrations\n", ss[i].cpu,
+             (ss[i].nvcsw + ss[i].nivcsw) / secs, ss[i].nmigrate / secs);
+  }
+
+  /* Run-queue wait histogram, one column per CPU */
+  for(last = NWAITHIST-1; last > 0; --last) {
+    for(i = 0; i < n; ++i)
+      if(ss[i].waithist[last])
+        break;
+    if(i < n)
+      break;
+  }
+  printf(1, "\nrun-queue wait");
+  for(i = 0; i < n; ++i) {
+    printf(1, "    cpu");
+    padd(1, ss[i].cpu, 1);
+  }
+  printf(1, "\n");
+  for(j = 0; j <= last; ++j) {
+    printf(1, "    ");
+    bucket(j);
+    for(i = 0; i < n; ++i)
+      padd(1, ss[i].waithist[j], 8);
+    printf(1, "\n");
+  }
+}
+
+int
+main(int argc, char *argv[]) {
+  struct schedstat before[MAXCPU], after[MAXCPU];
+  int secs, n, i;
+
+  secs = argc > 1 ? atoi(argv[1]) : 0;
+  if(secs < 0) {
+    printf(2, "usage: schedstat [seconds]\n");
+    exit(1);
+  }
+
+  if((n = schedstat(before, MAXCPU)) < 0) {
+    printf(2, "schedstat: cannot read scheduler statistics\n");
+    exit(1);
+  }
+  if(secs == 0) {
+    /* Totals since boot */
+    show(before, n, 0);
+    exit(0);
+  }
+
+  sleep(secs * 100);
+  if((n = schedstat(after, MAXCPU)) < 0) {
+    printf(2, "schedstat: cannot read scheduler statistics\n");
+    exit(1);
+  }
+  for(i = 0; i < n; ++i)
+    delta(&before[i], &after[i]);
+  show(after, n, secs);
+  exit(0);
+}
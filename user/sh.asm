@@ -0,0 +1,3061 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    return -1;
+  return 0;
+}
+
+int
+main(void) {
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0) {
+      11:	eb 0e                	jmp    21 <main+0x21>
+      13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      17:	90                   	nop
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 37 01 00 00    	jg     158 <main+0x158>
+  while((fd = open("console", O_RDWR)) >= 0) {
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 8b 16 00 00       	push   $0x168b
+      2b:	e8 f3 0f 00 00       	call   1023 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3e:	66 90                	xchg   %ax,%ax
+  printf(2, "$ ");
+      40:	83 ec 08             	sub    $0x8,%esp
+      43:	68 c8 15 00 00       	push   $0x15c8
+      48:	6a 02                	push   $0x2
+      4a:	e8 71 11 00 00       	call   11c0 <printf>
+  memset(buf, 0, nbuf);
+      4f:	83 c4 0c             	add    $0xc,%esp
+      52:	6a 64                	push   $0x64
+      54:	6a 00                	push   $0x0
+      56:	68 80 1d 00 00       	push   $0x1d80
+      5b:	e8 00 0e 00 00       	call   e60 <memset>
+  gets(buf, nbuf);
+      60:	58                   	pop    %eax
+      61:	5a                   	pop    %edx
+      62:	6a 64                	push   $0x64
+      64:	68 80 1d 00 00       	push   $0x1d80
+      69:	e8 52 0e 00 00       	call   ec0 <gets>
+  if(buf[0] == 0) // EOF
+      6e:	0f b6 05 80 1d 00 00 	movzbl 0x1d80,%eax
+      75:	83 c4 10             	add    $0x10,%esp
+      78:	84 c0                	test   %al,%al
+      7a:	0f 84 ce 00 00 00    	je     14e <main+0x14e>
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0) {
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      80:	3c 63                	cmp    $0x63,%al
+      82:	75 09                	jne    8d <main+0x8d>
+      84:	80 3d 81 1d 00 00 64 	cmpb   $0x64,0x1d81
+      8b:	74 73                	je     100 <main+0x100>
+
+int
+fork1(void) {
+  int pid;
+
+  pid = fork();
+      8d:	e8 49 0f 00 00       	call   fdb <fork>
+  if(pid == -1)
+      92:	83 f8 ff             	cmp    $0xffffffff,%eax
+      95:	0f 84 e3 00 00 00    	je     17e <main+0x17e>
+    if(fork1() == 0)
+      9b:	85 c0                	test   %eax,%eax
+      9d:	0f 84 c6 00 00 00    	je     169 <main+0x169>
+    wait(&estatus);
+      a3:	83 ec 0c             	sub    $0xc,%esp
+      a6:	68 60 1d 00 00       	push   $0x1d60
+      ab:	e8 3b 0f 00 00       	call   feb <wait>
+    if(estatus == -1) {
+      b0:	a1 60 1d 00 00       	mov    0x1d60,%eax
+      b5:	83 c4 10             	add    $0x10,%esp
+      b8:	83 f8 ff             	cmp    $0xffffffff,%eax
+      bb:	74 23                	je     e0 <main+0xe0>
+    } else if(estatus > 0) {
+      bd:	85 c0                	test   %eax,%eax
+      bf:	0f 8e 7b ff ff ff    	jle    40 <main+0x40>
+      printf(1, "Exit: %d\n", estatus);
+      c5:	83 ec 04             	sub    $0x4,%esp
+      c8:	50                   	push   %eax
+      c9:	68 ff 15 00 00       	push   $0x15ff
+      ce:	6a 01                	push   $0x1
+      d0:	e8 eb 10 00 00       	call   11c0 <printf>
+      d5:	83 c4 10             	add    $0x10,%esp
+      d8:	e9 63 ff ff ff       	jmp    40 <main+0x40>
+      dd:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(1, "Killed\n");
+      e0:	83 ec 08             	sub    $0x8,%esp
+      e3:	68 f7 15 00 00       	push   $0x15f7
+      e8:	6a 01                	push   $0x1
+      ea:	e8 d1 10 00 00       	call   11c0 <printf>
+      ef:	83 c4 10             	add    $0x10,%esp
+      f2:	e9 49 ff ff ff       	jmp    40 <main+0x40>
+      f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fe:	66 90                	xchg   %ax,%ax
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     100:	80 3d 82 1d 00 00 20 	cmpb   $0x20,0x1d82
+     107:	75 84                	jne    8d <main+0x8d>
+      buf[strlen(buf)-1] = 0;  // chop \n
+     109:	83 ec 0c             	sub    $0xc,%esp
+     10c:	68 80 1d 00 00       	push   $0x1d80
+     111:	e8 1a 0d 00 00       	call   e30 <strlen>
+      if(chdir(buf+3) < 0)
+     116:	c7 04 24 83 1d 00 00 	movl   $0x1d83,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+     11d:	c6 80 7f 1d 00 00 00 	movb   $0x0,0x1d7f(%eax)
+      if(chdir(buf+3) < 0)
+     124:	e8 2a 0f 00 00       	call   1053 <chdir>
+     129:	83 c4 10             	add    $0x10,%esp
+     12c:	85 c0                	test   %eax,%eax
+     12e:	0f 89 0c ff ff ff    	jns    40 <main+0x40>
+        printf(2, "cannot cd %s\n", buf+3);
+     134:	51                   	push   %ecx
+     135:	68 83 1d 00 00       	push   $0x1d83
+     13a:	68 93 16 00 00       	push   $0x1693
+     13f:	6a 02                	push   $0x2
+     141:	e8 7a 10 00 00       	call   11c0 <printf>
+     146:	83 c4 10             	add    $0x10,%esp
+     149:	e9 f2 fe ff ff       	jmp    40 <main+0x40>
+  exit(0);
+     14e:	83 ec 0c             	sub    $0xc,%esp
+     151:	6a 00                	push   $0x0
+     153:	e8 8b 0e 00 00       	call   fe3 <exit>
+      close(fd);
+     158:	83 ec 0c             	sub    $0xc,%esp
+     15b:	50                   	push   %eax
+     15c:	e8 aa 0e 00 00       	call   100b <close>
+      break;
+     161:	83 c4 10             	add    $0x10,%esp
+     164:	e9 d7 fe ff ff       	jmp    40 <main+0x40>
+      runcmd(parsecmd(buf));
+     169:	83 ec 0c             	sub    $0xc,%esp
+     16c:	68 80 1d 00 00       	push   $0x1d80
+     171:	e8 ba 0b 00 00       	call   d30 <parsecmd>
+     176:	89 04 24             	mov    %eax,(%esp)
+     179:	e8 a2 00 00 00       	call   220 <runcmd>
+    panic("fork");
+     17e:	83 ec 0c             	sub    $0xc,%esp
+     181:	68 cb 15 00 00       	push   $0x15cb
+     186:	e8 45 00 00 00       	call   1d0 <panic>
+     18b:	66 90                	xchg   %ax,%ax
+     18d:	66 90                	xchg   %ax,%ax
+     18f:	90                   	nop
+
+00000190 <getcmd>:
+getcmd(char *buf, int nbuf) {
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	56                   	push   %esi
+     194:	53                   	push   %ebx
+     195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     19b:	83 ec 08             	sub    $0x8,%esp
+     19e:	68 c8 15 00 00       	push   $0x15c8
+     1a3:	6a 02                	push   $0x2
+     1a5:	e8 16 10 00 00       	call   11c0 <printf>
+  memset(buf, 0, nbuf);
+     1aa:	83 c4 0c             	add    $0xc,%esp
+     1ad:	56                   	push   %esi
+     1ae:	6a 00                	push   $0x0
+     1b0:	53                   	push   %ebx
+     1b1:	e8 aa 0c 00 00       	call   e60 <memset>
+  gets(buf, nbuf);
+     1b6:	58                   	pop    %eax
+     1b7:	5a                   	pop    %edx
+     1b8:	56                   	push   %esi
+     1b9:	53                   	push   %ebx
+     1ba:	e8 01 0d 00 00       	call   ec0 <gets>
+  if(buf[0] == 0) // EOF
+     1bf:	83 c4 10             	add    $0x10,%esp
+     1c2:	80 3b 01             	cmpb   $0x1,(%ebx)
+     1c5:	19 c0                	sbb    %eax,%eax
+}
+     1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1ca:	5b                   	pop    %ebx
+     1cb:	5e                   	pop    %esi
+     1cc:	5d                   	pop    %ebp
+     1cd:	c3                   	ret
+     1ce:	66 90                	xchg   %ax,%ax
+
+000001d0 <panic>:
+panic(char *s) {
+     1d0:	55                   	push   %ebp
+     1d1:	89 e5                	mov    %esp,%ebp
+     1d3:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     1d6:	ff 75 08             	push   0x8(%ebp)
+     1d9:	68 87 16 00 00       	push   $0x1687
+     1de:	6a 02                	push   $0x2
+     1e0:	e8 db 0f 00 00       	call   11c0 <printf>
+  exit(1);
+     1e5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     1ec:	e8 f2 0d 00 00       	call   fe3 <exit>
+     1f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ff:	90                   	nop
+
+00000200 <fork1>:
+fork1(void) {
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     206:	e8 d0 0d 00 00       	call   fdb <fork>
+  if(pid == -1)
+     20b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     20e:	74 02                	je     212 <fork1+0x12>
+  return pid;
+}
+     210:	c9                   	leave
+     211:	c3                   	ret
+    panic("fork");
+     212:	83 ec 0c             	sub    $0xc,%esp
+     215:	68 cb 15 00 00       	push   $0x15cb
+     21a:	e8 b1 ff ff ff       	call   1d0 <panic>
+     21f:	90                   	nop
+
+00000220 <runcmd>:
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	53                   	push   %ebx
+     224:	83 ec 14             	sub    $0x14,%esp
+     227:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     22a:	85 db                	test   %ebx,%ebx
+     22c:	0f 84 5d 01 00 00    	je     38f <runcmd+0x16f>
+  switch(cmd->type){
+     232:	83 3b 05             	cmpl   $0x5,(%ebx)
+     235:	0f 87 5e 01 00 00    	ja     399 <runcmd+0x179>
+     23b:	8b 03                	mov    (%ebx),%eax
+     23d:	ff 24 85 a4 16 00 00 	jmp    *0x16a4(,%eax,4)
+    if(fork1() == 0)
+     244:	e8 b7 ff ff ff       	call   200 <fork1>
+     249:	85 c0                	test   %eax,%eax
+     24b:	0f 84 33 01 00 00    	je     384 <runcmd+0x164>
+      exit(0);
+     251:	83 ec 0c             	sub    $0xc,%esp
+     254:	6a 00                	push   $0x0
+     256:	e8 88 0d 00 00       	call   fe3 <exit>
+    if(ecmd->argv[0] == 0)
+     25b:	8b 43 04             	mov    0x4(%ebx),%eax
+     25e:	85 c0                	test   %eax,%eax
+     260:	74 ef                	je     251 <runcmd+0x31>
+    exec(ecmd->argv[0], ecmd->argv);
+     262:	8d 53 04             	lea    0x4(%ebx),%edx
+     265:	51                   	push   %ecx
+     266:	51                   	push   %ecx
+     267:	52                   	push   %edx
+     268:	50                   	push   %eax
+     269:	e8 ad 0d 00 00       	call   101b <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     26e:	83 c4 0c             	add    $0xc,%esp
+     271:	ff 73 04             	push   0x4(%ebx)
+     274:	68 d7 15 00 00       	push   $0x15d7
+     279:	6a 02                	push   $0x2
+     27b:	e8 40 0f 00 00       	call   11c0 <printf>
+    break;
+     280:	83 c4 10             	add    $0x10,%esp
+     283:	eb cc                	jmp    251 <runcmd+0x31>
+    if(pipe(p) < 0)
+     285:	83 ec 0c             	sub    $0xc,%esp
+     288:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     28b:	50                   	push   %eax
+     28c:	e8 62 0d 00 00       	call   ff3 <pipe>
+     291:	83 c4 10             	add    $0x10,%esp
+     294:	85 c0                	test   %eax,%eax
+     296:	0f 88 26 01 00 00    	js     3c2 <runcmd+0x1a2>
+    if(fork1() == 0){
+     29c:	e8 5f ff ff ff       	call   200 <fork1>
+     2a1:	85 c0                	test   %eax,%eax
+     2a3:	0f 84 02 02 00 00    	je     4ab <runcmd+0x28b>
+    if(fork1() == 0){
+     2a9:	e8 52 ff ff ff       	call   200 <fork1>
+     2ae:	85 c0                	test   %eax,%eax
+     2b0:	0f 84 c7 01 00 00    	je     47d <runcmd+0x25d>
+    close(p[0]);
+     2b6:	83 ec 0c             	sub    $0xc,%esp
+     2b9:	ff 75 f0             	push   -0x10(%ebp)
+     2bc:	e8 4a 0d 00 00       	call   100b <close>
+    close(p[1]);
+     2c1:	58                   	pop    %eax
+     2c2:	ff 75 f4             	push   -0xc(%ebp)
+     2c5:	e8 41 0d 00 00       	call   100b <close>
+    wait(&estatus);
+     2ca:	c7 04 24 60 1d 00 00 	movl   $0x1d60,(%esp)
+     2d1:	e8 15 0d 00 00       	call   feb <wait>
+    if(estatus == -1) {
+     2d6:	a1 60 1d 00 00       	mov    0x1d60,%eax
+     2db:	83 c4 10             	add    $0x10,%esp
+     2de:	83 f8 ff             	cmp    $0xffffffff,%eax
+     2e1:	0f 84 08 02 00 00    	je     4ef <runcmd+0x2cf>
+    } else if(estatus > 0) {
+     2e7:	85 c0                	test   %eax,%eax
+     2e9:	0f 8f e0 00 00 00    	jg     3cf <runcmd+0x1af>
+    wait(&estatus);
+     2ef:	83 ec 0c             	sub    $0xc,%esp
+     2f2:	68 60 1d 00 00       	push   $0x1d60
+     2f7:	e8 ef 0c 00 00       	call   feb <wait>
+    if(estatus == -1) {
+     2fc:	a1 60 1d 00 00       	mov    0x1d60,%eax
+     301:	83 c4 10             	add    $0x10,%esp
+     304:	83 f8 ff             	cmp    $0xffffffff,%eax
+     307:	0f 84 cc 01 00 00    	je     4d9 <runcmd+0x2b9>
+    } else if(estatus > 0) {
+     30d:	85 c0                	test   %eax,%eax
+     30f:	0f 8e 3c ff ff ff    	jle    251 <runcmd+0x31>
+      printf(1, "Exit: %d\n", estatus);
+     315:	52                   	push   %edx
+     316:	50                   	push   %eax
+     317:	68 ff 15 00 00       	push   $0x15ff
+     31c:	6a 01                	push   $0x1
+     31e:	e8 9d 0e 00 00       	call   11c0 <printf>
+     323:	83 c4 10             	add    $0x10,%esp
+     326:	e9 26 ff ff ff       	jmp    251 <runcmd+0x31>
+    if(fork1() == 0)
+     32b:	e8 d0 fe ff ff       	call   200 <fork1>
+     330:	85 c0                	test   %eax,%eax
+     332:	74 50                	je     384 <runcmd+0x164>
+    wait(&estatus);
+     334:	83 ec 0c             	sub    $0xc,%esp
+     337:	68 60 1d 00 00       	push   $0x1d60
+     33c:	e8 aa 0c 00 00       	call   feb <wait>
+    if(estatus == -1) {
+     341:	a1 60 1d 00 00       	mov    0x1d60,%eax
+     346:	83 c4 10             	add    $0x10,%esp
+     349:	83 f8 ff             	cmp    $0xffffffff,%eax
+     34c:	0f 84 ef 00 00 00    	je     441 <runcmd+0x221>
+    } else if(estatus > 0) {
+     352:	85 c0                	test   %eax,%eax
+     354:	0f 8f 8b 00 00 00    	jg     3e5 <runcmd+0x1c5>
+    runcmd(lcmd->right);
+     35a:	83 ec 0c             	sub    $0xc,%esp
+     35d:	ff 73 08             	push   0x8(%ebx)
+     360:	e8 bb fe ff ff       	call   220 <runcmd>
+    close(rcmd->fd);
+     365:	83 ec 0c             	sub    $0xc,%esp
+     368:	ff 73 14             	push   0x14(%ebx)
+     36b:	e8 9b 0c 00 00       	call   100b <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     370:	58                   	pop    %eax
+     371:	5a                   	pop    %edx
+     372:	ff 73 10             	push   0x10(%ebx)
+     375:	ff 73 08             	push   0x8(%ebx)
+     378:	e8 a6 0c 00 00       	call   1023 <open>
+     37d:	83 c4 10             	add    $0x10,%esp
+     380:	85 c0                	test   %eax,%eax
+     382:	78 22                	js     3a6 <runcmd+0x186>
+      runcmd(bcmd->cmd);
+     384:	83 ec 0c             	sub    $0xc,%esp
+     387:	ff 73 04             	push   0x4(%ebx)
+     38a:	e8 91 fe ff ff       	call   220 <runcmd>
+    exit(1);
+     38f:	83 ec 0c             	sub    $0xc,%esp
+     392:	6a 01                	push   $0x1
+     394:	e8 4a 0c 00 00       	call   fe3 <exit>
+    panic("runcmd");
+     399:	83 ec 0c             	sub    $0xc,%esp
+     39c:	68 d0 15 00 00       	push   $0x15d0
+     3a1:	e8 2a fe ff ff       	call   1d0 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     3a6:	50                   	push   %eax
+     3a7:	ff 73 08             	push   0x8(%ebx)
+     3aa:	68 e7 15 00 00       	push   $0x15e7
+     3af:	6a 02                	push   $0x2
+     3b1:	e8 0a 0e 00 00       	call   11c0 <printf>
+      exit(1);
+     3b6:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     3bd:	e8 21 0c 00 00       	call   fe3 <exit>
+      panic("pipe");
+     3c2:	83 ec 0c             	sub    $0xc,%esp
+     3c5:	68 19 16 00 00       	push   $0x1619
+     3ca:	e8 01 fe ff ff       	call   1d0 <panic>
+      printf(1, "Exit: %d\n", estatus);
+     3cf:	53                   	push   %ebx
+     3d0:	50                   	push   %eax
+     3d1:	68 ff 15 00 00       	push   $0x15ff
+     3d6:	6a 01                	push   $0x1
+     3d8:	e8 e3 0d 00 00       	call   11c0 <printf>
+     3dd:	83 c4 10             	add    $0x10,%esp
+     3e0:	e9 0a ff ff ff       	jmp    2ef <runcmd+0xcf>
+      printf(1, "Exit: %d\n", estatus);
+     3e5:	52                   	push   %edx
+     3e6:	50                   	push   %eax
+     3e7:	68 ff 15 00 00       	push   $0x15ff
+     3ec:	6a 01                	push   $0x1
+     3ee:	e8 cd 0d 00 00       	call   11c0 <printf>
+     3f3:	83 c4 10             	add    $0x10,%esp
+    if(estatus == -1) {
+     3f6:	a1 60 1d 00 00       	mov    0x1d60,%eax
+     3fb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     3fe:	74 6a                	je     46a <runcmd+0x24a>
+    } else if(estatus > 0) {
+     400:	85 c0                	test   %eax,%eax
+     402:	0f 8e 52 ff ff ff    	jle    35a <runcmd+0x13a>
+      printf(1, "Exit: %d", estatus);
+     408:	52                   	push   %edx
+     409:	50                   	push   %eax
+     40a:	68 10 16 00 00       	push   $0x1610
+     40f:	6a 01                	push   $0x1
+     411:	e8 aa 0d 00 00       	call   11c0 <printf>
+     416:	83 c4 10             	add    $0x10,%esp
+    if(estatus == -1) {
+     419:	a1 60 1d 00 00       	mov    0x1d60,%eax
+     41e:	83 f8 ff             	cmp    $0xffffffff,%eax
+     421:	74 31                	je     454 <runcmd+0x234>
+    } else if(estatus > 0) {
+     423:	85 c0                	test   %eax,%eax
+     425:	0f 8e 2f ff ff ff    	jle    35a <runcmd+0x13a>
+      printf(2, "Exit: %d", estatus);
+     42b:	52                   	push   %edx
+     42c:	50                   	push   %eax
+     42d:	68 10 16 00 00       	push   $0x1610
+     432:	6a 02                	push   $0x2
+     434:	e8 87 0d 00 00       	call   11c0 <printf>
+     439:	83 c4 10             	add    $0x10,%esp
+     43c:	e9 19 ff ff ff       	jmp    35a <runcmd+0x13a>
+      printf(1, "Killed\n");
+     441:	51                   	push   %ecx
+     442:	51                   	push   %ecx
+     443:	68 f7 15 00 00       	push   $0x15f7
+     448:	6a 01                	push   $0x1
+     44a:	e8 71 0d 00 00       	call   11c0 <printf>
+     44f:	83 c4 10             	add    $0x10,%esp
+     452:	eb a2                	jmp    3f6 <runcmd+0x1d6>
+      printf(2, "Killed");
+     454:	51                   	push   %ecx
+     455:	51                   	push   %ecx
+     456:	68 09 16 00 00       	push   $0x1609
+     45b:	6a 02                	push   $0x2
+     45d:	e8 5e 0d 00 00       	call   11c0 <printf>
+     462:	83 c4 10             	add    $0x10,%esp
+     465:	e9 f0 fe ff ff       	jmp    35a <runcmd+0x13a>
+      printf(1, "Killed");
+     46a:	51                   	push   %ecx
+     46b:	51                   	push   %ecx
+     46c:	68 09 16 00 00       	push   $0x1609
+     471:	6a 01                	push   $0x1
+     473:	e8 48 0d 00 00       	call   11c0 <printf>
+     478:	83 c4 10             	add    $0x10,%esp
+     47b:	eb 9c                	jmp    419 <runcmd+0x1f9>
+      close(0);
+     47d:	83 ec 0c             	sub    $0xc,%esp
+     480:	6a 00                	push   $0x0
+     482:	e8 84 0b 00 00       	call   100b <close>
+      dup(p[0]);
+     487:	58                   	pop    %eax
+     488:	ff 75 f0             	push   -0x10(%ebp)
+     48b:	e8 cb 0b 00 00       	call   105b <dup>
+      close(p[0]);
+     490:	58                   	pop    %eax
+     491:	ff 75 f0             	push   -0x10(%ebp)
+     494:	e8 72 0b 00 00       	call   100b <close>
+      close(p[1]);
+     499:	58                   	pop    %eax
+     49a:	ff 75 f4             	push   -0xc(%ebp)
+     49d:	e8 69 0b 00 00       	call   100b <close>
+      runcmd(pcmd->right);
+     4a2:	5a                   	pop    %edx
+     4a3:	ff 73 08             	push   0x8(%ebx)
+     4a6:	e8 75 fd ff ff       	call   220 <runcmd>
+      close(1);
+     4ab:	83 ec 0c             	sub    $0xc,%esp
+     4ae:	6a 01                	push   $0x1
+     4b0:	e8 56 0b 00 00       	call   100b <close>
+      dup(p[1]);
+     4b5:	59                   	pop    %ecx
+     4b6:	ff 75 f4             	push   -0xc(%ebp)
+     4b9:	e8 9d 0b 00 00       	call   105b <dup>
+      close(p[0]);
+     4be:	58                   	pop    %eax
+     4bf:	ff 75 f0             	push   -0x10(%ebp)
+     4c2:	e8 44 0b 00 00       	call   100b <close>
+      close(p[1]);
+     4c7:	58                   	pop    %eax
+     4c8:	ff 75 f4             	push   -0xc(%ebp)
+     4cb:	e8 3b 0b 00 00       	call   100b <close>
+      runcmd(pcmd->left);
+     4d0:	58                   	pop    %eax
+     4d1:	ff 73 04             	push   0x4(%ebx)
+     4d4:	e8 47 fd ff ff       	call   220 <runcmd>
+      printf(1, "Killed\n");
+     4d9:	51                   	push   %ecx
+     4da:	51                   	push   %ecx
+     4db:	68 f7 15 00 00       	push   $0x15f7
+     4e0:	6a 01                	push   $0x1
+     4e2:	e8 d9 0c 00 00       	call   11c0 <printf>
+     4e7:	83 c4 10             	add    $0x10,%esp
+     4ea:	e9 62 fd ff ff       	jmp    251 <runcmd+0x31>
+      printf(1, "Killed\n");
+     4ef:	50                   	push   %eax
+     4f0:	50                   	push   %eax
+     4f1:	68 f7 15 00 00       	push   $0x15f7
+     4f6:	6a 01                	push   $0x1
+     4f8:	e8 c3 0c 00 00       	call   11c0 <printf>
+     4fd:	83 c4 10             	add    $0x10,%esp
+     500:	e9 ea fd ff ff       	jmp    2ef <runcmd+0xcf>
+     505:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	53                   	push   %ebx
+     514:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     517:	6a 54                	push   $0x54
+     519:	e8 c2 0f 00 00       	call   14e0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     51e:	83 c4 0c             	add    $0xc,%esp
+     521:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     523:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     525:	6a 00                	push   $0x0
+     527:	50                   	push   %eax
+     528:	e8 33 09 00 00       	call   e60 <memset>
+  cmd->type = EXEC;
+     52d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     533:	89 d8                	mov    %ebx,%eax
+     535:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     538:	c9                   	leave
+     539:	c3                   	ret
+     53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000540 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     540:	55                   	push   %ebp
+     541:	89 e5                	mov    %esp,%ebp
+     543:	53                   	push   %ebx
+     544:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     547:	6a 18                	push   $0x18
+     549:	e8 92 0f 00 00       	call   14e0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     54e:	83 c4 0c             	add    $0xc,%esp
+     551:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     553:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     555:	6a 00                	push   $0x0
+     557:	50                   	push   %eax
+     558:	e8 03 09 00 00       	call   e60 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     55d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     560:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     566:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     569:	8b 45 0c             	mov    0xc(%ebp),%eax
+     56c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     56f:	8b 45 10             	mov    0x10(%ebp),%eax
+     572:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     575:	8b 45 14             	mov    0x14(%ebp),%eax
+     578:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     57b:	8b 45 18             	mov    0x18(%ebp),%eax
+     57e:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     581:	89 d8                	mov    %ebx,%eax
+     583:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     586:	c9                   	leave
+     587:	c3                   	ret
+     588:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58f:	90                   	nop
+
+00000590 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     590:	55                   	push   %ebp
+     591:	89 e5                	mov    %esp,%ebp
+     593:	53                   	push   %ebx
+     594:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     597:	6a 0c                	push   $0xc
+     599:	e8 42 0f 00 00       	call   14e0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     59e:	83 c4 0c             	add    $0xc,%esp
+     5a1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     5a3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     5a5:	6a 00                	push   $0x0
+     5a7:	50                   	push   %eax
+     5a8:	e8 b3 08 00 00       	call   e60 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     5ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     5b0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     5b6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     5b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5bc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     5bf:	89 d8                	mov    %ebx,%eax
+     5c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5c4:	c9                   	leave
+     5c5:	c3                   	ret
+     5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005d0 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	53                   	push   %ebx
+     5d4:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     5d7:	6a 0c                	push   $0xc
+     5d9:	e8 02 0f 00 00       	call   14e0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     5de:	83 c4 0c             	add    $0xc,%esp
+     5e1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     5e3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     5e5:	6a 00                	push   $0x0
+     5e7:	50                   	push   %eax
+     5e8:	e8 73 08 00 00       	call   e60 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     5ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     5f0:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     5f6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     5f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5fc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     5ff:	89 d8                	mov    %ebx,%eax
+     601:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     604:	c9                   	leave
+     605:	c3                   	ret
+     606:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     60d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000610 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	53                   	push   %ebx
+     614:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     617:	6a 08                	push   $0x8
+     619:	e8 c2 0e 00 00       	call   14e0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     61e:	83 c4 0c             	add    $0xc,%esp
+     621:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     623:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     625:	6a 00                	push   $0x0
+     627:	50                   	push   %eax
+     628:	e8 33 08 00 00       	call   e60 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     62d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     630:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     636:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     639:	89 d8                	mov    %ebx,%eax
+     63b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     63e:	c9                   	leave
+     63f:	c3                   	ret
+
+00000640 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     640:	55                   	push   %ebp
+     641:	89 e5                	mov    %esp,%ebp
+     643:	57                   	push   %edi
+     644:	56                   	push   %esi
+     645:	53                   	push   %ebx
+     646:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     649:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     64c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     64f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     652:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     654:	39 df                	cmp    %ebx,%edi
+     656:	72 0f                	jb     667 <gettoken+0x27>
+     658:	eb 25                	jmp    67f <gettoken+0x3f>
+     65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     660:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     663:	39 fb                	cmp    %edi,%ebx
+     665:	74 18                	je     67f <gettoken+0x3f>
+     667:	0f be 07             	movsbl (%edi),%eax
+     66a:	83 ec 08             	sub    $0x8,%esp
+     66d:	50                   	push   %eax
+     66e:	68 48 1d 00 00       	push   $0x1d48
+     673:	e8 08 08 00 00       	call   e80 <strchr>
+     678:	83 c4 10             	add    $0x10,%esp
+     67b:	85 c0                	test   %eax,%eax
+     67d:	75 e1                	jne    660 <gettoken+0x20>
+  if(q)
+     67f:	85 f6                	test   %esi,%esi
+     681:	74 02                	je     685 <gettoken+0x45>
+    *q = s;
+     683:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     685:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     688:	3c 3c                	cmp    $0x3c,%al
+     68a:	0f 8f d0 00 00 00    	jg     760 <gettoken+0x120>
+     690:	3c 3a                	cmp    $0x3a,%al
+     692:	0f 8f bc 00 00 00    	jg     754 <gettoken+0x114>
+     698:	84 c0                	test   %al,%al
+     69a:	75 44                	jne    6e0 <gettoken+0xa0>
+     69c:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     69e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     6a1:	85 c9                	test   %ecx,%ecx
+     6a3:	74 05                	je     6aa <gettoken+0x6a>
+    *eq = s;
+     6a5:	8b 45 14             	mov    0x14(%ebp),%eax
+     6a8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     6aa:	39 df                	cmp    %ebx,%edi
+     6ac:	72 09                	jb     6b7 <gettoken+0x77>
+     6ae:	eb 1f                	jmp    6cf <gettoken+0x8f>
+    s++;
+     6b0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     6b3:	39 fb                	cmp    %edi,%ebx
+     6b5:	74 18                	je     6cf <gettoken+0x8f>
+     6b7:	0f be 07             	movsbl (%edi),%eax
+     6ba:	83 ec 08             	sub    $0x8,%esp
+     6bd:	50                   	push   %eax
+     6be:	68 48 1d 00 00       	push   $0x1d48
+     6c3:	e8 b8 07 00 00       	call   e80 <strchr>
+     6c8:	83 c4 10             	add    $0x10,%esp
+     6cb:	85 c0                	test   %eax,%eax
+     6cd:	75 e1                	jne    6b0 <gettoken+0x70>
+  *ps = s;
+     6cf:	8b 45 08             	mov    0x8(%ebp),%eax
+     6d2:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     6d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6d7:	89 f0                	mov    %esi,%eax
+     6d9:	5b                   	pop    %ebx
+     6da:	5e                   	pop    %esi
+     6db:	5f                   	pop    %edi
+     6dc:	5d                   	pop    %ebp
+     6dd:	c3                   	ret
+     6de:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     6e0:	79 66                	jns    748 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     6e2:	39 df                	cmp    %ebx,%edi
+     6e4:	72 39                	jb     71f <gettoken+0xdf>
+  if(eq)
+     6e6:	8b 55 14             	mov    0x14(%ebp),%edx
+     6e9:	85 d2                	test   %edx,%edx
+     6eb:	0f 84 b3 00 00 00    	je     7a4 <gettoken+0x164>
+    *eq = s;
+     6f1:	8b 45 14             	mov    0x14(%ebp),%eax
+     6f4:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     6f6:	e9 a9 00 00 00       	jmp    7a4 <gettoken+0x164>
+     6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6ff:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     700:	0f be 07             	movsbl (%edi),%eax
+     703:	83 ec 08             	sub    $0x8,%esp
+     706:	50                   	push   %eax
+     707:	68 40 1d 00 00       	push   $0x1d40
+     70c:	e8 6f 07 00 00       	call   e80 <strchr>
+     711:	83 c4 10             	add    $0x10,%esp
+     714:	85 c0                	test   %eax,%eax
+     716:	75 1f                	jne    737 <gettoken+0xf7>
+      s++;
+     718:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     71b:	39 fb                	cmp    %edi,%ebx
+     71d:	74 77                	je     796 <gettoken+0x156>
+     71f:	0f be 07             	movsbl (%edi),%eax
+     722:	83 ec 08             	sub    $0x8,%esp
+     725:	50                   	push   %eax
+     726:	68 48 1d 00 00       	push   $0x1d48
+     72b:	e8 50 07 00 00       	call   e80 <strchr>
+     730:	83 c4 10             	add    $0x10,%esp
+     733:	85 c0                	test   %eax,%eax
+     735:	74 c9                	je     700 <gettoken+0xc0>
+    ret = 'a';
+     737:	be 61 00 00 00       	mov    $0x61,%esi
+     73c:	e9 5d ff ff ff       	jmp    69e <gettoken+0x5e>
+     741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     748:	3c 26                	cmp    $0x26,%al
+     74a:	74 08                	je     754 <gettoken+0x114>
+     74c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     74f:	80 f9 01             	cmp    $0x1,%cl
+     752:	77 8e                	ja     6e2 <gettoken+0xa2>
+  ret = *s;
+     754:	0f be f0             	movsbl %al,%esi
+    s++;
+     757:	83 c7 01             	add    $0x1,%edi
+    break;
+     75a:	e9 3f ff ff ff       	jmp    69e <gettoken+0x5e>
+     75f:	90                   	nop
+  switch(*s){
+     760:	3c 3e                	cmp    $0x3e,%al
+     762:	75 1c                	jne    780 <gettoken+0x140>
+    if(*s == '>'){
+     764:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     768:	74 1f                	je     789 <gettoken+0x149>
+    s++;
+     76a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     76d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     772:	e9 27 ff ff ff       	jmp    69e <gettoken+0x5e>
+     777:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     780:	3c 7c                	cmp    $0x7c,%al
+     782:	74 d0                	je     754 <gettoken+0x114>
+     784:	e9 59 ff ff ff       	jmp    6e2 <gettoken+0xa2>
+      s++;
+     789:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     78c:	be 2b 00 00 00       	mov    $0x2b,%esi
+     791:	e9 08 ff ff ff       	jmp    69e <gettoken+0x5e>
+  if(eq)
+     796:	8b 45 14             	mov    0x14(%ebp),%eax
+     799:	85 c0                	test   %eax,%eax
+     79b:	74 05                	je     7a2 <gettoken+0x162>
+    *eq = s;
+     79d:	8b 45 14             	mov    0x14(%ebp),%eax
+     7a0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     7a2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     7a4:	be 61 00 00 00       	mov    $0x61,%esi
+     7a9:	e9 21 ff ff ff       	jmp    6cf <gettoken+0x8f>
+     7ae:	66 90                	xchg   %ax,%ax
+
+000007b0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+     7b3:	57                   	push   %edi
+     7b4:	56                   	push   %esi
+     7b5:	53                   	push   %ebx
+     7b6:	83 ec 0c             	sub    $0xc,%esp
+     7b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     7bc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     7bf:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     7c1:	39 f3                	cmp    %esi,%ebx
+     7c3:	72 12                	jb     7d7 <peek+0x27>
+     7c5:	eb 28                	jmp    7ef <peek+0x3f>
+     7c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ce:	66 90                	xchg   %ax,%ax
+    s++;
+     7d0:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     7d3:	39 de                	cmp    %ebx,%esi
+     7d5:	74 18                	je     7ef <peek+0x3f>
+     7d7:	0f be 03             	movsbl (%ebx),%eax
+     7da:	83 ec 08             	sub    $0x8,%esp
+     7dd:	50                   	push   %eax
+     7de:	68 48 1d 00 00       	push   $0x1d48
+     7e3:	e8 98 06 00 00       	call   e80 <strchr>
+     7e8:	83 c4 10             	add    $0x10,%esp
+     7eb:	85 c0                	test   %eax,%eax
+     7ed:	75 e1                	jne    7d0 <peek+0x20>
+  *ps = s;
+     7ef:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     7f1:	0f be 03             	movsbl (%ebx),%eax
+     7f4:	31 d2                	xor    %edx,%edx
+     7f6:	84 c0                	test   %al,%al
+     7f8:	75 0e                	jne    808 <peek+0x58>
+}
+     7fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7fd:	89 d0                	mov    %edx,%eax
+     7ff:	5b                   	pop    %ebx
+     800:	5e                   	pop    %esi
+     801:	5f                   	pop    %edi
+     802:	5d                   	pop    %ebp
+     803:	c3                   	ret
+     804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     808:	83 ec 08             	sub    $0x8,%esp
+     80b:	50                   	push   %eax
+     80c:	ff 75 10             	push   0x10(%ebp)
+     80f:	e8 6c 06 00 00       	call   e80 <strchr>
+     814:	83 c4 10             	add    $0x10,%esp
+     817:	31 d2                	xor    %edx,%edx
+     819:	85 c0                	test   %eax,%eax
+     81b:	0f 95 c2             	setne  %dl
+}
+     81e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     821:	5b                   	pop    %ebx
+     822:	89 d0                	mov    %edx,%eax
+     824:	5e                   	pop    %esi
+     825:	5f                   	pop    %edi
+     826:	5d                   	pop    %ebp
+     827:	c3                   	ret
+     828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82f:	90                   	nop
+
+00000830 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	57                   	push   %edi
+     834:	56                   	push   %esi
+     835:	53                   	push   %ebx
+     836:	83 ec 2c             	sub    $0x2c,%esp
+     839:	8b 75 0c             	mov    0xc(%ebp),%esi
+     83c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     83f:	90                   	nop
+     840:	83 ec 04             	sub    $0x4,%esp
+     843:	68 3b 16 00 00       	push   $0x163b
+     848:	53                   	push   %ebx
+     849:	56                   	push   %esi
+     84a:	e8 61 ff ff ff       	call   7b0 <peek>
+     84f:	83 c4 10             	add    $0x10,%esp
+     852:	85 c0                	test   %eax,%eax
+     854:	0f 84 f6 00 00 00    	je     950 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     85a:	6a 00                	push   $0x0
+     85c:	6a 00                	push   $0x0
+     85e:	53                   	push   %ebx
+     85f:	56                   	push   %esi
+     860:	e8 db fd ff ff       	call   640 <gettoken>
+     865:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     867:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     86a:	50                   	push   %eax
+     86b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     86e:	50                   	push   %eax
+     86f:	53                   	push   %ebx
+     870:	56                   	push   %esi
+     871:	e8 ca fd ff ff       	call   640 <gettoken>
+     876:	83 c4 20             	add    $0x20,%esp
+     879:	83 f8 61             	cmp    $0x61,%eax
+     87c:	0f 85 d9 00 00 00    	jne    95b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     882:	83 ff 3c             	cmp    $0x3c,%edi
+     885:	74 69                	je     8f0 <parseredirs+0xc0>
+     887:	83 ff 3e             	cmp    $0x3e,%edi
+     88a:	74 05                	je     891 <parseredirs+0x61>
+     88c:	83 ff 2b             	cmp    $0x2b,%edi
+     88f:	75 af                	jne    840 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     891:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     894:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     897:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     89a:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     89d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     8a0:	6a 18                	push   $0x18
+     8a2:	e8 39 0c 00 00       	call   14e0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     8a7:	83 c4 0c             	add    $0xc,%esp
+     8aa:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     8ac:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     8ae:	6a 00                	push   $0x0
+     8b0:	50                   	push   %eax
+     8b1:	e8 aa 05 00 00       	call   e60 <memset>
+  cmd->type = REDIR;
+     8b6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     8bc:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     8bf:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     8c2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     8c5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     8c8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     8cb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     8ce:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     8d5:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     8d8:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     8df:	89 7d 08             	mov    %edi,0x8(%ebp)
+     8e2:	e9 59 ff ff ff       	jmp    840 <parseredirs+0x10>
+     8e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ee:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     8f0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     8f3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     8f6:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     8f9:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     8fc:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     8ff:	6a 18                	push   $0x18
+     901:	e8 da 0b 00 00       	call   14e0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     906:	83 c4 0c             	add    $0xc,%esp
+     909:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     90b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     90d:	6a 00                	push   $0x0
+     90f:	50                   	push   %eax
+     910:	e8 4b 05 00 00       	call   e60 <memset>
+  cmd->cmd = subcmd;
+     915:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     918:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     91b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     91e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     921:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     927:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     92a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     92d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     930:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     933:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     93a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     941:	e9 fa fe ff ff       	jmp    840 <parseredirs+0x10>
+     946:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     950:	8b 45 08             	mov    0x8(%ebp),%eax
+     953:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     956:	5b                   	pop    %ebx
+     957:	5e                   	pop    %esi
+     958:	5f                   	pop    %edi
+     959:	5d                   	pop    %ebp
+     95a:	c3                   	ret
+      panic("missing file for redirection");
+     95b:	83 ec 0c             	sub    $0xc,%esp
+     95e:	68 1e 16 00 00       	push   $0x161e
+     963:	e8 68 f8 ff ff       	call   1d0 <panic>
+     968:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     96f:	90                   	nop
+
+00000970 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	57                   	push   %edi
+     974:	56                   	push   %esi
+     975:	53                   	push   %ebx
+     976:	83 ec 30             	sub    $0x30,%esp
+     979:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     97c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     97f:	68 3e 16 00 00       	push   $0x163e
+     984:	56                   	push   %esi
+     985:	53                   	push   %ebx
+     986:	e8 25 fe ff ff       	call   7b0 <peek>
+     98b:	83 c4 10             	add    $0x10,%esp
+     98e:	85 c0                	test   %eax,%eax
+     990:	0f 85 aa 00 00 00    	jne    a40 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     996:	83 ec 0c             	sub    $0xc,%esp
+     999:	89 c7                	mov    %eax,%edi
+     99b:	6a 54                	push   $0x54
+     99d:	e8 3e 0b 00 00       	call   14e0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     9a2:	83 c4 0c             	add    $0xc,%esp
+     9a5:	6a 54                	push   $0x54
+     9a7:	6a 00                	push   $0x0
+     9a9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     9ac:	50                   	push   %eax
+     9ad:	e8 ae 04 00 00       	call   e60 <memset>
+  cmd->type = EXEC;
+     9b2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     9b5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     9b8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     9be:	56                   	push   %esi
+     9bf:	53                   	push   %ebx
+     9c0:	50                   	push   %eax
+     9c1:	e8 6a fe ff ff       	call   830 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     9c6:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     9c9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     9cc:	eb 15                	jmp    9e3 <parseexec+0x73>
+     9ce:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     9d0:	83 ec 04             	sub    $0x4,%esp
+     9d3:	56                   	push   %esi
+     9d4:	53                   	push   %ebx
+     9d5:	ff 75 d4             	push   -0x2c(%ebp)
+     9d8:	e8 53 fe ff ff       	call   830 <parseredirs>
+     9dd:	83 c4 10             	add    $0x10,%esp
+     9e0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     9e3:	83 ec 04             	sub    $0x4,%esp
+     9e6:	68 55 16 00 00       	push   $0x1655
+     9eb:	56                   	push   %esi
+     9ec:	53                   	push   %ebx
+     9ed:	e8 be fd ff ff       	call   7b0 <peek>
+     9f2:	83 c4 10             	add    $0x10,%esp
+     9f5:	85 c0                	test   %eax,%eax
+     9f7:	75 5f                	jne    a58 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     9f9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     9fc:	50                   	push   %eax
+     9fd:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     a00:	50                   	push   %eax
+     a01:	56                   	push   %esi
+     a02:	53                   	push   %ebx
+     a03:	e8 38 fc ff ff       	call   640 <gettoken>
+     a08:	83 c4 10             	add    $0x10,%esp
+     a0b:	85 c0                	test   %eax,%eax
+     a0d:	74 49                	je     a58 <parseexec+0xe8>
+    if(tok != 'a')
+     a0f:	83 f8 61             	cmp    $0x61,%eax
+     a12:	75 62                	jne    a76 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     a14:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     a17:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     a1a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     a1e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a21:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     a25:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     a28:	83 ff 0a             	cmp    $0xa,%edi
+     a2b:	75 a3                	jne    9d0 <parseexec+0x60>
+      panic("too many args");
+     a2d:	83 ec 0c             	sub    $0xc,%esp
+     a30:	68 47 16 00 00       	push   $0x1647
+     a35:	e8 96 f7 ff ff       	call   1d0 <panic>
+     a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     a40:	89 75 0c             	mov    %esi,0xc(%ebp)
+     a43:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     a46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a49:	5b                   	pop    %ebx
+     a4a:	5e                   	pop    %esi
+     a4b:	5f                   	pop    %edi
+     a4c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     a4d:	e9 ae 01 00 00       	jmp    c00 <parseblock>
+     a52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     a58:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     a5b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     a62:	00 
+  cmd->eargv[argc] = 0;
+     a63:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     a6a:	00 
+}
+     a6b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     a6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a71:	5b                   	pop    %ebx
+     a72:	5e                   	pop    %esi
+     a73:	5f                   	pop    %edi
+     a74:	5d                   	pop    %ebp
+     a75:	c3                   	ret
+      panic("syntax");
+     a76:	83 ec 0c             	sub    $0xc,%esp
+     a79:	68 40 16 00 00       	push   $0x1640
+     a7e:	e8 4d f7 ff ff       	call   1d0 <panic>
+     a83:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000a90 <parsepipe>:
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	57                   	push   %edi
+     a94:	56                   	push   %esi
+     a95:	53                   	push   %ebx
+     a96:	83 ec 14             	sub    $0x14,%esp
+     a99:	8b 75 08             	mov    0x8(%ebp),%esi
+     a9c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     a9f:	57                   	push   %edi
+     aa0:	56                   	push   %esi
+     aa1:	e8 ca fe ff ff       	call   970 <parseexec>
+  if(peek(ps, es, "|")){
+     aa6:	83 c4 0c             	add    $0xc,%esp
+     aa9:	68 5a 16 00 00       	push   $0x165a
+  cmd = parseexec(ps, es);
+     aae:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     ab0:	57                   	push   %edi
+     ab1:	56                   	push   %esi
+     ab2:	e8 f9 fc ff ff       	call   7b0 <peek>
+     ab7:	83 c4 10             	add    $0x10,%esp
+     aba:	85 c0                	test   %eax,%eax
+     abc:	75 12                	jne    ad0 <parsepipe+0x40>
+}
+     abe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ac1:	89 d8                	mov    %ebx,%eax
+     ac3:	5b                   	pop    %ebx
+     ac4:	5e                   	pop    %esi
+     ac5:	5f                   	pop    %edi
+     ac6:	5d                   	pop    %ebp
+     ac7:	c3                   	ret
+     ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     acf:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     ad0:	6a 00                	push   $0x0
+     ad2:	6a 00                	push   $0x0
+     ad4:	57                   	push   %edi
+     ad5:	56                   	push   %esi
+     ad6:	e8 65 fb ff ff       	call   640 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     adb:	58                   	pop    %eax
+     adc:	5a                   	pop    %edx
+     add:	57                   	push   %edi
+     ade:	56                   	push   %esi
+     adf:	e8 ac ff ff ff       	call   a90 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     ae4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     aeb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     aed:	e8 ee 09 00 00       	call   14e0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     af2:	83 c4 0c             	add    $0xc,%esp
+     af5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     af7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     af9:	6a 00                	push   $0x0
+     afb:	50                   	push   %eax
+     afc:	e8 5f 03 00 00       	call   e60 <memset>
+  cmd->left = left;
+     b01:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     b04:	83 c4 10             	add    $0x10,%esp
+     b07:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     b09:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     b0f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     b11:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     b14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b17:	5b                   	pop    %ebx
+     b18:	5e                   	pop    %esi
+     b19:	5f                   	pop    %edi
+     b1a:	5d                   	pop    %ebp
+     b1b:	c3                   	ret
+     b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b20 <parseline>:
+{
+     b20:	55                   	push   %ebp
+     b21:	89 e5                	mov    %esp,%ebp
+     b23:	57                   	push   %edi
+     b24:	56                   	push   %esi
+     b25:	53                   	push   %ebx
+     b26:	83 ec 24             	sub    $0x24,%esp
+     b29:	8b 75 08             	mov    0x8(%ebp),%esi
+     b2c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     b2f:	57                   	push   %edi
+     b30:	56                   	push   %esi
+     b31:	e8 5a ff ff ff       	call   a90 <parsepipe>
+  while(peek(ps, es, "&")){
+     b36:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     b39:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     b3b:	eb 3b                	jmp    b78 <parseline+0x58>
+     b3d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     b40:	6a 00                	push   $0x0
+     b42:	6a 00                	push   $0x0
+     b44:	57                   	push   %edi
+     b45:	56                   	push   %esi
+     b46:	e8 f5 fa ff ff       	call   640 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     b4b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     b52:	e8 89 09 00 00       	call   14e0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     b57:	83 c4 0c             	add    $0xc,%esp
+     b5a:	6a 08                	push   $0x8
+     b5c:	6a 00                	push   $0x0
+     b5e:	50                   	push   %eax
+     b5f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     b62:	e8 f9 02 00 00       	call   e60 <memset>
+  cmd->type = BACK;
+     b67:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     b6a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     b6d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     b73:	89 5a 04             	mov    %ebx,0x4(%edx)
+     b76:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     b78:	83 ec 04             	sub    $0x4,%esp
+     b7b:	68 5c 16 00 00       	push   $0x165c
+     b80:	57                   	push   %edi
+     b81:	56                   	push   %esi
+     b82:	e8 29 fc ff ff       	call   7b0 <peek>
+     b87:	83 c4 10             	add    $0x10,%esp
+     b8a:	85 c0                	test   %eax,%eax
+     b8c:	75 b2                	jne    b40 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     b8e:	83 ec 04             	sub    $0x4,%esp
+     b91:	68 58 16 00 00       	push   $0x1658
+     b96:	57                   	push   %edi
+     b97:	56                   	push   %esi
+     b98:	e8 13 fc ff ff       	call   7b0 <peek>
+     b9d:	83 c4 10             	add    $0x10,%esp
+     ba0:	85 c0                	test   %eax,%eax
+     ba2:	75 0c                	jne    bb0 <parseline+0x90>
+}
+     ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ba7:	89 d8                	mov    %ebx,%eax
+     ba9:	5b                   	pop    %ebx
+     baa:	5e                   	pop    %esi
+     bab:	5f                   	pop    %edi
+     bac:	5d                   	pop    %ebp
+     bad:	c3                   	ret
+     bae:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     bb0:	6a 00                	push   $0x0
+     bb2:	6a 00                	push   $0x0
+     bb4:	57                   	push   %edi
+     bb5:	56                   	push   %esi
+     bb6:	e8 85 fa ff ff       	call   640 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     bbb:	58                   	pop    %eax
+     bbc:	5a                   	pop    %edx
+     bbd:	57                   	push   %edi
+     bbe:	56                   	push   %esi
+     bbf:	e8 5c ff ff ff       	call   b20 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     bc4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     bcb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     bcd:	e8 0e 09 00 00       	call   14e0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     bd2:	83 c4 0c             	add    $0xc,%esp
+     bd5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     bd7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     bd9:	6a 00                	push   $0x0
+     bdb:	50                   	push   %eax
+     bdc:	e8 7f 02 00 00       	call   e60 <memset>
+  cmd->left = left;
+     be1:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     be4:	83 c4 10             	add    $0x10,%esp
+     be7:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     be9:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     bef:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     bf1:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     bf4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bf7:	5b                   	pop    %ebx
+     bf8:	5e                   	pop    %esi
+     bf9:	5f                   	pop    %edi
+     bfa:	5d                   	pop    %ebp
+     bfb:	c3                   	ret
+     bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c00 <parseblock>:
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	57                   	push   %edi
+     c04:	56                   	push   %esi
+     c05:	53                   	push   %ebx
+     c06:	83 ec 10             	sub    $0x10,%esp
+     c09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     c0c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     c0f:	68 3e 16 00 00       	push   $0x163e
+     c14:	56                   	push   %esi
+     c15:	53                   	push   %ebx
+     c16:	e8 95 fb ff ff       	call   7b0 <peek>
+     c1b:	83 c4 10             	add    $0x10,%esp
+     c1e:	85 c0                	test   %eax,%eax
+     c20:	74 4a                	je     c6c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     c22:	6a 00                	push   $0x0
+     c24:	6a 00                	push   $0x0
+     c26:	56                   	push   %esi
+     c27:	53                   	push   %ebx
+     c28:	e8 13 fa ff ff       	call   640 <gettoken>
+  cmd = parseline(ps, es);
+     c2d:	58                   	pop    %eax
+     c2e:	5a                   	pop    %edx
+     c2f:	56                   	push   %esi
+     c30:	53                   	push   %ebx
+     c31:	e8 ea fe ff ff       	call   b20 <parseline>
+  if(!peek(ps, es, ")"))
+     c36:	83 c4 0c             	add    $0xc,%esp
+     c39:	68 7a 16 00 00       	push   $0x167a
+  cmd = parseline(ps, es);
+     c3e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     c40:	56                   	push   %esi
+     c41:	53                   	push   %ebx
+     c42:	e8 69 fb ff ff       	call   7b0 <peek>
+     c47:	83 c4 10             	add    $0x10,%esp
+     c4a:	85 c0                	test   %eax,%eax
+     c4c:	74 2b                	je     c79 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     c4e:	6a 00                	push   $0x0
+     c50:	6a 00                	push   $0x0
+     c52:	56                   	push   %esi
+     c53:	53                   	push   %ebx
+     c54:	e8 e7 f9 ff ff       	call   640 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     c59:	83 c4 0c             	add    $0xc,%esp
+     c5c:	56                   	push   %esi
+     c5d:	53                   	push   %ebx
+     c5e:	57                   	push   %edi
+     c5f:	e8 cc fb ff ff       	call   830 <parseredirs>
+}
+     c64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     c67:	5b                   	pop    %ebx
+     c68:	5e                   	pop    %esi
+     c69:	5f                   	pop    %edi
+     c6a:	5d                   	pop    %ebp
+     c6b:	c3                   	ret
+    panic("parseblock");
+     c6c:	83 ec 0c             	sub    $0xc,%esp
+     c6f:	68 5e 16 00 00       	push   $0x165e
+     c74:	e8 57 f5 ff ff       	call   1d0 <panic>
+    panic("syntax - missing )");
+     c79:	83 ec 0c             	sub    $0xc,%esp
+     c7c:	68 69 16 00 00       	push   $0x1669
+     c81:	e8 4a f5 ff ff       	call   1d0 <panic>
+     c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c90 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	53                   	push   %ebx
+     c94:	83 ec 04             	sub    $0x4,%esp
+     c97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     c9a:	85 db                	test   %ebx,%ebx
+     c9c:	0f 84 7e 00 00 00    	je     d20 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     ca2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     ca5:	77 20                	ja     cc7 <nulterminate+0x37>
+     ca7:	8b 03                	mov    (%ebx),%eax
+     ca9:	ff 24 85 bc 16 00 00 	jmp    *0x16bc(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     cb0:	83 ec 0c             	sub    $0xc,%esp
+     cb3:	ff 73 04             	push   0x4(%ebx)
+     cb6:	e8 d5 ff ff ff       	call   c90 <nulterminate>
+    nulterminate(lcmd->right);
+     cbb:	58                   	pop    %eax
+     cbc:	ff 73 08             	push   0x8(%ebx)
+     cbf:	e8 cc ff ff ff       	call   c90 <nulterminate>
+    break;
+     cc4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     cc7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     cc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ccc:	c9                   	leave
+     ccd:	c3                   	ret
+     cce:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     cd0:	83 ec 0c             	sub    $0xc,%esp
+     cd3:	ff 73 04             	push   0x4(%ebx)
+     cd6:	e8 b5 ff ff ff       	call   c90 <nulterminate>
+    break;
+     cdb:	83 c4 10             	add    $0x10,%esp
+     cde:	eb e7                	jmp    cc7 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     ce0:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     ce3:	8d 43 08             	lea    0x8(%ebx),%eax
+     ce6:	85 c9                	test   %ecx,%ecx
+     ce8:	74 dd                	je     cc7 <nulterminate+0x37>
+     cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     cf0:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     cf3:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     cf6:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     cf9:	8b 50 fc             	mov    -0x4(%eax),%edx
+     cfc:	85 d2                	test   %edx,%edx
+     cfe:	75 f0                	jne    cf0 <nulterminate+0x60>
+     d00:	eb c5                	jmp    cc7 <nulterminate+0x37>
+     d02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     d08:	83 ec 0c             	sub    $0xc,%esp
+     d0b:	ff 73 04             	push   0x4(%ebx)
+     d0e:	e8 7d ff ff ff       	call   c90 <nulterminate>
+    *rcmd->efile = 0;
+     d13:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     d16:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     d19:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     d1c:	eb a9                	jmp    cc7 <nulterminate+0x37>
+     d1e:	66 90                	xchg   %ax,%ax
+    return 0;
+     d20:	31 c0                	xor    %eax,%eax
+     d22:	eb a5                	jmp    cc9 <nulterminate+0x39>
+     d24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d2f:	90                   	nop
+
+00000d30 <parsecmd>:
+{
+     d30:	55                   	push   %ebp
+     d31:	89 e5                	mov    %esp,%ebp
+     d33:	57                   	push   %edi
+     d34:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     d35:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     d38:	53                   	push   %ebx
+     d39:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     d3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     d3f:	53                   	push   %ebx
+     d40:	e8 eb 00 00 00       	call   e30 <strlen>
+  cmd = parseline(&s, es);
+     d45:	59                   	pop    %ecx
+     d46:	5e                   	pop    %esi
+  es = s + strlen(s);
+     d47:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     d49:	53                   	push   %ebx
+     d4a:	57                   	push   %edi
+     d4b:	e8 d0 fd ff ff       	call   b20 <parseline>
+  peek(&s, es, "");
+     d50:	83 c4 0c             	add    $0xc,%esp
+     d53:	68 08 16 00 00       	push   $0x1608
+  cmd = parseline(&s, es);
+     d58:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     d5a:	53                   	push   %ebx
+     d5b:	57                   	push   %edi
+     d5c:	e8 4f fa ff ff       	call   7b0 <peek>
+  if(s != es){
+     d61:	8b 45 08             	mov    0x8(%ebp),%eax
+     d64:	83 c4 10             	add    $0x10,%esp
+     d67:	39 d8                	cmp    %ebx,%eax
+     d69:	75 13                	jne    d7e <parsecmd+0x4e>
+  nulterminate(cmd);
+     d6b:	83 ec 0c             	sub    $0xc,%esp
+     d6e:	56                   	push   %esi
+     d6f:	e8 1c ff ff ff       	call   c90 <nulterminate>
+}
+     d74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d77:	89 f0                	mov    %esi,%eax
+     d79:	5b                   	pop    %ebx
+     d7a:	5e                   	pop    %esi
+     d7b:	5f                   	pop    %edi
+     d7c:	5d                   	pop    %ebp
+     d7d:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     d7e:	52                   	push   %edx
+     d7f:	50                   	push   %eax
+     d80:	68 7c 16 00 00       	push   $0x167c
+     d85:	6a 02                	push   $0x2
+     d87:	e8 34 04 00 00       	call   11c0 <printf>
+    panic("syntax");
+     d8c:	c7 04 24 40 16 00 00 	movl   $0x1640,(%esp)
+     d93:	e8 38 f4 ff ff       	call   1d0 <panic>
+     d98:	66 90                	xchg   %ax,%ax
+     d9a:	66 90                	xchg   %ax,%ax
+     d9c:	66 90                	xchg   %ax,%ax
+     d9e:	66 90                	xchg   %ax,%ax
+
+00000da0 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     da0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     da1:	31 c0                	xor    %eax,%eax
+{
+     da3:	89 e5                	mov    %esp,%ebp
+     da5:	53                   	push   %ebx
+     da6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     da9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     dac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     db0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     db4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     db7:	83 c0 01             	add    $0x1,%eax
+     dba:	84 d2                	test   %dl,%dl
+     dbc:	75 f2                	jne    db0 <strcpy+0x10>
+    ;
+  return os;
+}
+     dbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dc1:	89 c8                	mov    %ecx,%eax
+     dc3:	c9                   	leave
+     dc4:	c3                   	ret
+     dc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000dd0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	53                   	push   %ebx
+     dd4:	8b 55 08             	mov    0x8(%ebp),%edx
+     dd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     dda:	0f b6 02             	movzbl (%edx),%eax
+     ddd:	84 c0                	test   %al,%al
+     ddf:	75 17                	jne    df8 <strcmp+0x28>
+     de1:	eb 3a                	jmp    e1d <strcmp+0x4d>
+     de3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     de7:	90                   	nop
+     de8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     dec:	83 c2 01             	add    $0x1,%edx
+     def:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     df2:	84 c0                	test   %al,%al
+     df4:	74 1a                	je     e10 <strcmp+0x40>
+    p++, q++;
+     df6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     df8:	0f b6 19             	movzbl (%ecx),%ebx
+     dfb:	38 c3                	cmp    %al,%bl
+     dfd:	74 e9                	je     de8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     dff:	29 d8                	sub    %ebx,%eax
+}
+     e01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e04:	c9                   	leave
+     e05:	c3                   	ret
+     e06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     e10:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     e14:	31 c0                	xor    %eax,%eax
+     e16:	29 d8                	sub    %ebx,%eax
+}
+     e18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e1b:	c9                   	leave
+     e1c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     e1d:	0f b6 19             	movzbl (%ecx),%ebx
+     e20:	31 c0                	xor    %eax,%eax
+     e22:	eb db                	jmp    dff <strcmp+0x2f>
+     e24:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e2f:	90                   	nop
+
+00000e30 <strlen>:
+
+uint
+strlen(char *s)
+{
+     e30:	55                   	push   %ebp
+     e31:	89 e5                	mov    %esp,%ebp
+     e33:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     e36:	80 3a 00             	cmpb   $0x0,(%edx)
+     e39:	74 15                	je     e50 <strlen+0x20>
+     e3b:	31 c0                	xor    %eax,%eax
+     e3d:	8d 76 00             	lea    0x0(%esi),%esi
+     e40:	83 c0 01             	add    $0x1,%eax
+     e43:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     e47:	89 c1                	mov    %eax,%ecx
+     e49:	75 f5                	jne    e40 <strlen+0x10>
+    ;
+  return n;
+}
+     e4b:	89 c8                	mov    %ecx,%eax
+     e4d:	5d                   	pop    %ebp
+     e4e:	c3                   	ret
+     e4f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     e50:	31 c9                	xor    %ecx,%ecx
+}
+     e52:	5d                   	pop    %ebp
+     e53:	89 c8                	mov    %ecx,%eax
+     e55:	c3                   	ret
+     e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e60 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     e60:	55                   	push   %ebp
+     e61:	89 e5                	mov    %esp,%ebp
+     e63:	57                   	push   %edi
+     e64:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     e67:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     e6a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e6d:	89 d7                	mov    %edx,%edi
+     e6f:	fc                   	cld
+     e70:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     e72:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     e75:	89 d0                	mov    %edx,%eax
+     e77:	c9                   	leave
+     e78:	c3                   	ret
+     e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e80 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	8b 45 08             	mov    0x8(%ebp),%eax
+     e86:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     e8a:	0f b6 10             	movzbl (%eax),%edx
+     e8d:	84 d2                	test   %dl,%dl
+     e8f:	75 12                	jne    ea3 <strchr+0x23>
+     e91:	eb 1d                	jmp    eb0 <strchr+0x30>
+     e93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e97:	90                   	nop
+     e98:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     e9c:	83 c0 01             	add    $0x1,%eax
+     e9f:	84 d2                	test   %dl,%dl
+     ea1:	74 0d                	je     eb0 <strchr+0x30>
+    if(*s == c)
+     ea3:	38 d1                	cmp    %dl,%cl
+     ea5:	75 f1                	jne    e98 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     ea7:	5d                   	pop    %ebp
+     ea8:	c3                   	ret
+     ea9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     eb0:	31 c0                	xor    %eax,%eax
+}
+     eb2:	5d                   	pop    %ebp
+     eb3:	c3                   	ret
+     eb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ebb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ebf:	90                   	nop
+
+00000ec0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     ec0:	55                   	push   %ebp
+     ec1:	89 e5                	mov    %esp,%ebp
+     ec3:	57                   	push   %edi
+     ec4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     ec5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     ec8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     ec9:	31 db                	xor    %ebx,%ebx
+{
+     ecb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     ece:	eb 27                	jmp    ef7 <gets+0x37>
+    cc = read(0, &c, 1);
+     ed0:	83 ec 04             	sub    $0x4,%esp
+     ed3:	6a 01                	push   $0x1
+     ed5:	56                   	push   %esi
+     ed6:	6a 00                	push   $0x0
+     ed8:	e8 1e 01 00 00       	call   ffb <read>
+    if(cc < 1)
+     edd:	83 c4 10             	add    $0x10,%esp
+     ee0:	85 c0                	test   %eax,%eax
+     ee2:	7e 1d                	jle    f01 <gets+0x41>
+      break;
+    buf[i++] = c;
+     ee4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+     eeb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     eef:	3c 0a                	cmp    $0xa,%al
+     ef1:	74 10                	je     f03 <gets+0x43>
+     ef3:	3c 0d                	cmp    $0xd,%al
+     ef5:	74 0c                	je     f03 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     ef7:	89 df                	mov    %ebx,%edi
+     ef9:	83 c3 01             	add    $0x1,%ebx
+     efc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     eff:	7c cf                	jl     ed0 <gets+0x10>
+     f01:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     f03:	8b 45 08             	mov    0x8(%ebp),%eax
+     f06:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     f0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f0d:	5b                   	pop    %ebx
+     f0e:	5e                   	pop    %esi
+     f0f:	5f                   	pop    %edi
+     f10:	5d                   	pop    %ebp
+     f11:	c3                   	ret
+     f12:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000f20 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     f20:	55                   	push   %ebp
+     f21:	89 e5                	mov    %esp,%ebp
+     f23:	56                   	push   %esi
+     f24:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     f25:	83 ec 08             	sub    $0x8,%esp
+     f28:	6a 00                	push   $0x0
+     f2a:	ff 75 08             	push   0x8(%ebp)
+     f2d:	e8 f1 00 00 00       	call   1023 <open>
+  if(fd < 0)
+     f32:	83 c4 10             	add    $0x10,%esp
+     f35:	85 c0                	test   %eax,%eax
+     f37:	78 27                	js     f60 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     f39:	83 ec 08             	sub    $0x8,%esp
+     f3c:	ff 75 0c             	push   0xc(%ebp)
+     f3f:	89 c3                	mov    %eax,%ebx
+     f41:	50                   	push   %eax
+     f42:	e8 f4 00 00 00       	call   103b <fstat>
+  close(fd);
+     f47:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     f4a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     f4c:	e8 ba 00 00 00       	call   100b <close>
+  return r;
+     f51:	83 c4 10             	add    $0x10,%esp
+}
+     f54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f57:	89 f0                	mov    %esi,%eax
+     f59:	5b                   	pop    %ebx
+     f5a:	5e                   	pop    %esi
+     f5b:	5d                   	pop    %ebp
+     f5c:	c3                   	ret
+     f5d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     f60:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     f65:	eb ed                	jmp    f54 <stat+0x34>
+     f67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f6e:	66 90                	xchg   %ax,%ax
+
+00000f70 <atoi>:
+
+int
+atoi(const char *s)
+{
+     f70:	55                   	push   %ebp
+     f71:	89 e5                	mov    %esp,%ebp
+     f73:	53                   	push   %ebx
+     f74:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     f77:	0f be 02             	movsbl (%edx),%eax
+     f7a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     f7d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     f80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     f85:	77 1e                	ja     fa5 <atoi+0x35>
+     f87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f8e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     f90:	83 c2 01             	add    $0x1,%edx
+     f93:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     f96:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     f9a:	0f be 02             	movsbl (%edx),%eax
+     f9d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     fa0:	80 fb 09             	cmp    $0x9,%bl
+     fa3:	76 eb                	jbe    f90 <atoi+0x20>
+  return n;
+}
+     fa5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fa8:	89 c8                	mov    %ecx,%eax
+     faa:	c9                   	leave
+     fab:	c3                   	ret
+     fac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000fb0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	57                   	push   %edi
+     fb4:	56                   	push   %esi
+     fb5:	8b 45 10             	mov    0x10(%ebp),%eax
+     fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+     fbb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     fbe:	85 c0                	test   %eax,%eax
+     fc0:	7e 13                	jle    fd5 <memmove+0x25>
+     fc2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     fc4:	89 d7                	mov    %edx,%edi
+     fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     fd0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     fd1:	39 f8                	cmp    %edi,%eax
+     fd3:	75 fb                	jne    fd0 <memmove+0x20>
+  return vdst;
+}
+     fd5:	5e                   	pop    %esi
+     fd6:	89 d0                	mov    %edx,%eax
+     fd8:	5f                   	pop    %edi
+     fd9:	5d                   	pop    %ebp
+     fda:	c3                   	ret
+
+00000fdb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     fdb:	b8 01 00 00 00       	mov    $0x1,%eax
+     fe0:	cd 40                	int    $0x40
+     fe2:	c3                   	ret
+
+00000fe3 <exit>:
+SYSCALL(exit)
+     fe3:	b8 02 00 00 00       	mov    $0x2,%eax
+     fe8:	cd 40                	int    $0x40
+     fea:	c3                   	ret
+
+00000feb <wait>:
+SYSCALL(wait)
+     feb:	b8 03 00 00 00       	mov    $0x3,%eax
+     ff0:	cd 40                	int    $0x40
+     ff2:	c3                   	ret
+
+00000ff3 <pipe>:
+SYSCALL(pipe)
+     ff3:	b8 04 00 00 00       	mov    $0x4,%eax
+     ff8:	cd 40                	int    $0x40
+     ffa:	c3                   	ret
+
+00000ffb <read>:
+SYSCALL(read)
+     ffb:	b8 05 00 00 00       	mov    $0x5,%eax
+    1000:	cd 40                	int    $0x40
+    1002:	c3                   	ret
+
+00001003 <write>:
+SYSCALL(write)
+    1003:	b8 10 00 00 00       	mov    $0x10,%eax
+    1008:	cd 40                	int    $0x40
+    100a:	c3                   	ret
+
+0000100b <close>:
+SYSCALL(close)
+    100b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1010:	cd 40                	int    $0x40
+    1012:	c3                   	ret
+
+00001013 <kill>:
+SYSCALL(kill)
+    1013:	b8 06 00 00 00       	mov    $0x6,%eax
+    1018:	cd 40                	int    $0x40
+    101a:	c3                   	ret
+
+0000101b <exec>:
+SYSCALL(exec)
+    101b:	b8 07 00 00 00       	mov    $0x7,%eax
+    1020:	cd 40                	int    $0x40
+    1022:	c3                   	ret
+
+00001023 <open>:
+SYSCALL(open)
+    1023:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1028:	cd 40                	int    $0x40
+    102a:	c3                   	ret
+
+0000102b <mknod>:
+SYSCALL(mknod)
+    102b:	b8 11 00 00 00       	mov    $0x11,%eax
+    1030:	cd 40                	int    $0x40
+    1032:	c3                   	ret
+
+00001033 <unlink>:
+SYSCALL(unlink)
+    1033:	b8 12 00 00 00       	mov    $0x12,%eax
+    1038:	cd 40                	int    $0x40
+    103a:	c3                   	ret
+
+0000103b <fstat>:
+SYSCALL(fstat)
+    103b:	b8 08 00 00 00       	mov    $0x8,%eax
+    1040:	cd 40                	int    $0x40
+    1042:	c3                   	ret
+
+00001043 <link>:
+SYSCALL(link)
+    1043:	b8 13 00 00 00       	mov    $0x13,%eax
+    1048:	cd 40                	int    $0x40
+    104a:	c3                   	ret
+
+0000104b <mkdir>:
+SYSCALL(mkdir)
+    104b:	b8 14 00 00 00       	mov    $0x14,%eax
+    1050:	cd 40                	int    $0x40
+    1052:	c3                   	ret
+
+00001053 <chdir>:
+SYSCALL(chdir)
+    1053:	b8 09 00 00 00       	mov    $0x9,%eax
+    1058:	cd 40                	int    $0x40
+    105a:	c3                   	ret
+
+0000105b <dup>:
+SYSCALL(dup)
+    105b:	b8 0a 00 00 00       	mov    $0xa,%eax
+    1060:	cd 40                	int    $0x40
+    1062:	c3                   	ret
+
+00001063 <getpid>:
+SYSCALL(getpid)
+    1063:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1068:	cd 40                	int    $0x40
+    106a:	c3                   	ret
+
+0000106b <sbrk>:
+SYSCALL(sbrk)
+    106b:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1070:	cd 40                	int    $0x40
+    1072:	c3                   	ret
+
+00001073 <sleep>:
+SYSCALL(sleep)
+    1073:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1078:	cd 40                	int    $0x40
+    107a:	c3                   	ret
+
+0000107b <uptime>:
+SYSCALL(uptime)
+    107b:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1080:	cd 40                	int    $0x40
+    1082:	c3                   	ret
+
+00001083 <getdate>:
+SYSCALL(getdate)
+    1083:	b8 16 00 00 00       	mov    $0x16,%eax
+    1088:	cd 40                	int    $0x40
+    108a:	c3                   	ret
+
+0000108b <setdate>:
+SYSCALL(setdate)
+    108b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1090:	cd 40                	int    $0x40
+    1092:	c3                   	ret
+
+00001093 <mount>:
+SYSCALL(mount)
+    1093:	b8 18 00 00 00       	mov    $0x18,%eax
+    1098:	cd 40                	int    $0x40
+    109a:	c3                   	ret
+
+0000109b <unmount>:
+SYSCALL(unmount)
+    109b:	b8 19 00 00 00       	mov    $0x19,%eax
+    10a0:	cd 40                	int    $0x40
+    10a2:	c3                   	ret
+
+000010a3 <lseek>:
+SYSCALL(lseek)
+    10a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    10a8:	cd 40                	int    $0x40
+    10aa:	c3                   	ret
+
+000010ab <mmap>:
+SYSCALL(mmap)
+    10ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    10b0:	cd 40                	int    $0x40
+    10b2:	c3                   	ret
+
+000010b3 <munmap>:
+SYSCALL(munmap)
+    10b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    10b8:	cd 40                	int    $0x40
+    10ba:	c3                   	ret
+
+000010bb <clock_gettime>:
+SYSCALL(clock_gettime)
+    10bb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    10c0:	cd 40                	int    $0x40
+    10c2:	c3                   	ret
+
+000010c3 <nanosleep>:
+SYSCALL(nanosleep)
+    10c3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    10c8:	cd 40                	int    $0x40
+    10ca:	c3                   	ret
+
+000010cb <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+    10cb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    10d0:	cd 40                	int    $0x40
+    10d2:	c3                   	ret
+
+000010d3 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+    10d3:	b8 20 00 00 00       	mov    $0x20,%eax
+    10d8:	cd 40                	int    $0x40
+    10da:	c3                   	ret
+
+000010db <proclimit>:
+SYSCALL(proclimit)
+    10db:	b8 21 00 00 00       	mov    $0x21,%eax
+    10e0:	cd 40                	int    $0x40
+    10e2:	c3                   	ret
+
+000010e3 <procinfo>:
+SYSCALL(procinfo)
+    10e3:	b8 22 00 00 00       	mov    $0x22,%eax
+    10e8:	cd 40                	int    $0x40
+    10ea:	c3                   	ret
+
+000010eb <cpuinfo>:
+SYSCALL(cpuinfo)
+    10eb:	b8 23 00 00 00       	mov    $0x23,%eax
+    10f0:	cd 40                	int    $0x40
+    10f2:	c3                   	ret
+
+000010f3 <schedstat>:
+SYSCALL(schedstat)
+    10f3:	b8 24 00 00 00       	mov    $0x24,%eax
+    10f8:	cd 40                	int    $0x40
+    10fa:	c3                   	ret
+
+000010fb <lockstat>:
+SYSCALL(lockstat)
+    10fb:	b8 25 00 00 00       	mov    $0x25,%eax
+    1100:	cd 40                	int    $0x40
+    1102:	c3                   	ret
+
+00001103 <bcachestat>:
+SYSCALL(bcachestat)
+    1103:	b8 26 00 00 00       	mov    $0x26,%eax
+    1108:	cd 40                	int    $0x40
+    110a:	c3                   	ret
+
+0000110b <diskstat>:
+SYSCALL(diskstat)
+    110b:	b8 27 00 00 00       	mov    $0x27,%eax
+    1110:	cd 40                	int    $0x40
+    1112:	c3                   	ret
+
+00001113 <iosched>:
+SYSCALL(iosched)
+    1113:	b8 28 00 00 00       	mov    $0x28,%eax
+    1118:	cd 40                	int    $0x40
+    111a:	c3                   	ret
+    111b:	66 90                	xchg   %ax,%ax
+    111d:	66 90                	xchg   %ax,%ax
+    111f:	90                   	nop
+
+00001120 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	57                   	push   %edi
+    1124:	56                   	push   %esi
+    1125:	53                   	push   %ebx
+    1126:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    1128:	89 d1                	mov    %edx,%ecx
+{
+    112a:	83 ec 3c             	sub    $0x3c,%esp
+    112d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    1130:	85 d2                	test   %edx,%edx
+    1132:	0f 89 80 00 00 00    	jns    11b8 <printint+0x98>
+    1138:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    113c:	74 7a                	je     11b8 <printint+0x98>
+    x = -xx;
+    113e:	f7 d9                	neg    %ecx
+    neg = 1;
+    1140:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1145:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1148:	31 f6                	xor    %esi,%esi
+    114a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1150:	89 c8                	mov    %ecx,%eax
+    1152:	31 d2                	xor    %edx,%edx
+    1154:	89 f7                	mov    %esi,%edi
+    1156:	f7 f3                	div    %ebx
+    1158:	8d 76 01             	lea    0x1(%esi),%esi
+    115b:	0f b6 92 38 17 00 00 	movzbl 0x1738(%edx),%edx
+    1162:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1166:	89 ca                	mov    %ecx,%edx
+    1168:	89 c1                	mov    %eax,%ecx
+    116a:	39 da                	cmp    %ebx,%edx
+    116c:	73 e2                	jae    1150 <printint+0x30>
+  if(neg)
+    116e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1171:	85 c0                	test   %eax,%eax
+    1173:	74 07                	je     117c <printint+0x5c>
+    buf[i++] = '-';
+    1175:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    117a:	89 f7                	mov    %esi,%edi
+    117c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    117f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1182:	01 df                	add    %ebx,%edi
+    1184:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1188:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    118b:	83 ec 04             	sub    $0x4,%esp
+    118e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1191:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1194:	6a 01                	push   $0x1
+    1196:	50                   	push   %eax
+    1197:	56                   	push   %esi
+    1198:	e8 66 fe ff ff       	call   1003 <write>
+  while(--i >= 0)
+    119d:	89 f8                	mov    %edi,%eax
+    119f:	83 c4 10             	add    $0x10,%esp
+    11a2:	83 ef 01             	sub    $0x1,%edi
+    11a5:	39 d8                	cmp    %ebx,%eax
+    11a7:	75 df                	jne    1188 <printint+0x68>
+}
+    11a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11ac:	5b                   	pop    %ebx
+    11ad:	5e                   	pop    %esi
+    11ae:	5f                   	pop    %edi
+    11af:	5d                   	pop    %ebp
+    11b0:	c3                   	ret
+    11b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    11b8:	31 c0                	xor    %eax,%eax
+    11ba:	eb 89                	jmp    1145 <printint+0x25>
+    11bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000011c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+    11c0:	55                   	push   %ebp
+    11c1:	89 e5                	mov    %esp,%ebp
+    11c3:	57                   	push   %edi
+    11c4:	56                   	push   %esi
+    11c5:	53                   	push   %ebx
+    11c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    11c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+    11cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    11cf:	0f b6 1e             	movzbl (%esi),%ebx
+    11d2:	83 c6 01             	add    $0x1,%esi
+    11d5:	84 db                	test   %bl,%bl
+    11d7:	74 67                	je     1240 <printf+0x80>
+    11d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    11dc:	31 d2                	xor    %edx,%edx
+    11de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    11e1:	eb 34                	jmp    1217 <printf+0x57>
+    11e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    11e7:	90                   	nop
+    11e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    11eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    11f0:	83 f8 25             	cmp    $0x25,%eax
+    11f3:	74 18                	je     120d <printf+0x4d>
+  write(fd, &c, 1);
+    11f5:	83 ec 04             	sub    $0x4,%esp
+    11f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    11fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    11fe:	6a 01                	push   $0x1
+    1200:	50                   	push   %eax
+    1201:	57                   	push   %edi
+    1202:	e8 fc fd ff ff       	call   1003 <write>
+    1207:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    120a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    120d:	0f b6 1e             	movzbl (%esi),%ebx
+    1210:	83 c6 01             	add    $0x1,%esi
+    1213:	84 db                	test   %bl,%bl
+    1215:	74 29                	je     1240 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1217:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    121a:	85 d2                	test   %edx,%edx
+    121c:	74 ca                	je     11e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    121e:	83 fa 25             	cmp    $0x25,%edx
+    1221:	75 ea                	jne    120d <printf+0x4d>
+      if(c == 'd'){
+    1223:	83 f8 25             	cmp    $0x25,%eax
+    1226:	0f 84 24 01 00 00    	je     1350 <printf+0x190>
+    122c:	83 e8 63             	sub    $0x63,%eax
+    122f:	83 f8 15             	cmp    $0x15,%eax
+    1232:	77 1c                	ja     1250 <printf+0x90>
+    1234:	ff 24 85 e0 16 00 00 	jmp    *0x16e0(,%eax,4)
+    123b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    123f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1243:	5b                   	pop    %ebx
+    1244:	5e                   	pop    %esi
+    1245:	5f                   	pop    %edi
+    1246:	5d                   	pop    %ebp
+    1247:	c3                   	ret
+    1248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    124f:	90                   	nop
+  write(fd, &c, 1);
+    1250:	83 ec 04             	sub    $0x4,%esp
+    1253:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1256:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    125a:	6a 01                	push   $0x1
+    125c:	52                   	push   %edx
+    125d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1260:	57                   	push   %edi
+    1261:	e8 9d fd ff ff       	call   1003 <write>
+    1266:	83 c4 0c             	add    $0xc,%esp
+    1269:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    126c:	6a 01                	push   $0x1
+    126e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1271:	52                   	push   %edx
+    1272:	57                   	push   %edi
+    1273:	e8 8b fd ff ff       	call   1003 <write>
+        putc(fd, c);
+    1278:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    127b:	31 d2                	xor    %edx,%edx
+    127d:	eb 8e                	jmp    120d <printf+0x4d>
+    127f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1280:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1283:	83 ec 0c             	sub    $0xc,%esp
+    1286:	b9 10 00 00 00       	mov    $0x10,%ecx
+    128b:	8b 13                	mov    (%ebx),%edx
+    128d:	6a 00                	push   $0x0
+    128f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1291:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1294:	e8 87 fe ff ff       	call   1120 <printint>
+        ap++;
+    1299:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    129c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    129f:	31 d2                	xor    %edx,%edx
+    12a1:	e9 67 ff ff ff       	jmp    120d <printf+0x4d>
+    12a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12ad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    12b0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    12b3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    12b5:	83 c0 04             	add    $0x4,%eax
+    12b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    12bb:	85 db                	test   %ebx,%ebx
+    12bd:	0f 84 9d 00 00 00    	je     1360 <printf+0x1a0>
+        while(*s != 0){
+    12c3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    12c6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    12c8:	84 c0                	test   %al,%al
+    12ca:	0f 84 3d ff ff ff    	je     120d <printf+0x4d>
+    12d0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    12d3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    12d6:	89 de                	mov    %ebx,%esi
+    12d8:	89 d3                	mov    %edx,%ebx
+    12da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    12e0:	83 ec 04             	sub    $0x4,%esp
+    12e3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    12e6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    12e9:	6a 01                	push   $0x1
+    12eb:	53                   	push   %ebx
+    12ec:	57                   	push   %edi
+    12ed:	e8 11 fd ff ff       	call   1003 <write>
+        while(*s != 0){
+    12f2:	0f b6 06             	movzbl (%esi),%eax
+    12f5:	83 c4 10             	add    $0x10,%esp
+    12f8:	84 c0                	test   %al,%al
+    12fa:	75 e4                	jne    12e0 <printf+0x120>
+      state = 0;
+    12fc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    12ff:	31 d2                	xor    %edx,%edx
+    1301:	e9 07 ff ff ff       	jmp    120d <printf+0x4d>
+    1306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    130d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1310:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1313:	83 ec 0c             	sub    $0xc,%esp
+    1316:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    131b:	8b 13                	mov    (%ebx),%edx
+    131d:	6a 01                	push   $0x1
+    131f:	e9 6b ff ff ff       	jmp    128f <printf+0xcf>
+    1324:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    1328:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    132b:	83 ec 04             	sub    $0x4,%esp
+    132e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1331:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1333:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1336:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1339:	6a 01                	push   $0x1
+    133b:	52                   	push   %edx
+    133c:	57                   	push   %edi
+    133d:	e8 c1 fc ff ff       	call   1003 <write>
+        ap++;
+    1342:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1345:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1348:	31 d2                	xor    %edx,%edx
+    134a:	e9 be fe ff ff       	jmp    120d <printf+0x4d>
+    134f:	90                   	nop
+  write(fd, &c, 1);
+    1350:	83 ec 04             	sub    $0x4,%esp
+    1353:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1356:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1359:	6a 01                	push   $0x1
+    135b:	e9 11 ff ff ff       	jmp    1271 <printf+0xb1>
+    1360:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1365:	bb d4 16 00 00       	mov    $0x16d4,%ebx
+    136a:	e9 61 ff ff ff       	jmp    12d0 <printf+0x110>
+    136f:	90                   	nop
+
+00001370 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	57                   	push   %edi
+    1374:	56                   	push   %esi
+    1375:	53                   	push   %ebx
+    1376:	83 ec 20             	sub    $0x20,%esp
+    1379:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    137c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+    137f:	57                   	push   %edi
+    1380:	68 db 16 00 00       	push   $0x16db
+    1385:	53                   	push   %ebx
+    1386:	e8 35 fe ff ff       	call   11c0 <printf>
+  for(n = strlen(s); n < w; n++)
+    138b:	89 3c 24             	mov    %edi,(%esp)
+    138e:	e8 9d fa ff ff       	call   e30 <strlen>
+    1393:	83 c4 10             	add    $0x10,%esp
+    1396:	3b 45 10             	cmp    0x10(%ebp),%eax
+    1399:	7d 20                	jge    13bb <pads+0x4b>
+    139b:	89 c6                	mov    %eax,%esi
+    139d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+    13a0:	83 ec 04             	sub    $0x4,%esp
+    13a3:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+    13a7:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    13aa:	6a 01                	push   $0x1
+    13ac:	57                   	push   %edi
+    13ad:	53                   	push   %ebx
+    13ae:	e8 50 fc ff ff       	call   1003 <write>
+  for(n = strlen(s); n < w; n++)
+    13b3:	83 c4 10             	add    $0x10,%esp
+    13b6:	39 75 10             	cmp    %esi,0x10(%ebp)
+    13b9:	75 e5                	jne    13a0 <pads+0x30>
+    putc(fd, ' ');
+}
+    13bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13be:	5b                   	pop    %ebx
+    13bf:	5e                   	pop    %esi
+    13c0:	5f                   	pop    %edi
+    13c1:	5d                   	pop    %ebp
+    13c2:	c3                   	ret
+    13c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000013d0 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+    13d0:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+    13d1:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+    13d6:	89 e5                	mov    %esp,%ebp
+    13d8:	57                   	push   %edi
+    13d9:	56                   	push   %esi
+    13da:	53                   	push   %ebx
+  int n = 0;
+    13db:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+    13dd:	83 ec 2c             	sub    $0x2c,%esp
+    13e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+    13e3:	8b 45 10             	mov    0x10(%ebp),%eax
+    13e6:	8b 75 08             	mov    0x8(%ebp),%esi
+    13e9:	89 55 d0             	mov    %edx,-0x30(%ebp)
+    13ec:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    13ef:	90                   	nop
+  }while((x /= 10) != 0);
+    13f0:	89 d0                	mov    %edx,%eax
+    13f2:	89 d7                	mov    %edx,%edi
+    n++;
+    13f4:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+    13f7:	f7 e1                	mul    %ecx
+    13f9:	c1 ea 03             	shr    $0x3,%edx
+    13fc:	83 ff 09             	cmp    $0x9,%edi
+    13ff:	77 ef                	ja     13f0 <padd+0x20>
+  for(; n < w; n++)
+    1401:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1404:	39 c3                	cmp    %eax,%ebx
+    1406:	7d 23                	jge    142b <padd+0x5b>
+    1408:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    140b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    140f:	90                   	nop
+  write(fd, &c, 1);
+    1410:	83 ec 04             	sub    $0x4,%esp
+    1413:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+    1417:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+    141a:	6a 01                	push   $0x1
+    141c:	57                   	push   %edi
+    141d:	56                   	push   %esi
+    141e:	e8 e0 fb ff ff       	call   1003 <write>
+  for(; n < w; n++)
+    1423:	83 c4 10             	add    $0x10,%esp
+    1426:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+    1429:	75 e5                	jne    1410 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+    142b:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+    1432:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+    1435:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+    1438:	89 f0                	mov    %esi,%eax
+}
+    143a:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+    143b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+    1440:	5e                   	pop    %esi
+    1441:	5f                   	pop    %edi
+    1442:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+    1443:	e9 d8 fc ff ff       	jmp    1120 <printint>
+    1448:	66 90                	xchg   %ax,%ax
+    144a:	66 90                	xchg   %ax,%ax
+    144c:	66 90                	xchg   %ax,%ax
+    144e:	66 90                	xchg   %ax,%ax
+
+00001450 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1450:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1451:	a1 e4 1d 00 00       	mov    0x1de4,%eax
+{
+    1456:	89 e5                	mov    %esp,%ebp
+    1458:	57                   	push   %edi
+    1459:	56                   	push   %esi
+    145a:	53                   	push   %ebx
+    145b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    145e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1468:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    146a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    146c:	39 ca                	cmp    %ecx,%edx
+    146e:	73 30                	jae    14a0 <free+0x50>
+    1470:	39 c1                	cmp    %eax,%ecx
+    1472:	72 04                	jb     1478 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1474:	39 c2                	cmp    %eax,%edx
+    1476:	72 f0                	jb     1468 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1478:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    147b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    147e:	39 f8                	cmp    %edi,%eax
+    1480:	74 2e                	je     14b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1482:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1485:	8b 42 04             	mov    0x4(%edx),%eax
+    1488:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    148b:	39 f1                	cmp    %esi,%ecx
+    148d:	74 38                	je     14c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    148f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1491:	5b                   	pop    %ebx
+  freep = p;
+    1492:	89 15 e4 1d 00 00    	mov    %edx,0x1de4
+}
+    1498:	5e                   	pop    %esi
+    1499:	5f                   	pop    %edi
+    149a:	5d                   	pop    %ebp
+    149b:	c3                   	ret
+    149c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    14a0:	39 c1                	cmp    %eax,%ecx
+    14a2:	72 d0                	jb     1474 <free+0x24>
+    14a4:	eb c2                	jmp    1468 <free+0x18>
+    14a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    14ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    14b0:	03 70 04             	add    0x4(%eax),%esi
+    14b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    14b6:	8b 02                	mov    (%edx),%eax
+    14b8:	8b 00                	mov    (%eax),%eax
+    14ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    14bd:	8b 42 04             	mov    0x4(%edx),%eax
+    14c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    14c3:	39 f1                	cmp    %esi,%ecx
+    14c5:	75 c8                	jne    148f <free+0x3f>
+    p->s.size += bp->s.size;
+    14c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    14ca:	89 15 e4 1d 00 00    	mov    %edx,0x1de4
+    p->s.size += bp->s.size;
+    14d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    14d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    14d6:	89 0a                	mov    %ecx,(%edx)
+}
+    14d8:	5b                   	pop    %ebx
+    14d9:	5e                   	pop    %esi
+    14da:	5f                   	pop    %edi
+    14db:	5d                   	pop    %ebp
+    14dc:	c3                   	ret
+    14dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014e0 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+    14e0:	55                   	push   %ebp
+    14e1:	89 e5                	mov    %esp,%ebp
+    14e3:	57                   	push   %edi
+    14e4:	56                   	push   %esi
+    14e5:	53                   	push   %ebx
+    14e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    14e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    14ec:	8b 15 e4 1d 00 00    	mov    0x1de4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    14f2:	8d 78 07             	lea    0x7(%eax),%edi
+    14f5:	c1 ef 03             	shr    $0x3,%edi
+    14f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    14fb:	85 d2                	test   %edx,%edx
+    14fd:	0f 84 8d 00 00 00    	je     1590 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1503:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1505:	8b 48 04             	mov    0x4(%eax),%ecx
+    1508:	39 f9                	cmp    %edi,%ecx
+    150a:	73 64                	jae    1570 <malloc+0x90>
+  if(nu < 4096)
+    150c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1511:	39 df                	cmp    %ebx,%edi
+    1513:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1516:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    151d:	eb 0a                	jmp    1529 <malloc+0x49>
+    151f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1520:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1522:	8b 48 04             	mov    0x4(%eax),%ecx
+    1525:	39 f9                	cmp    %edi,%ecx
+    1527:	73 47                	jae    1570 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1529:	89 c2                	mov    %eax,%edx
+    152b:	39 05 e4 1d 00 00    	cmp    %eax,0x1de4
+    1531:	75 ed                	jne    1520 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1533:	83 ec 0c             	sub    $0xc,%esp
+    1536:	56                   	push   %esi
+    1537:	e8 2f fb ff ff       	call   106b <sbrk>
+  if(p == (char*)-1)
+    153c:	83 c4 10             	add    $0x10,%esp
+    153f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1542:	74 1c                	je     1560 <malloc+0x80>
+  hp->s.size = nu;
+    1544:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1547:	83 ec 0c             	sub    $0xc,%esp
+    154a:	83 c0 08             	add    $0x8,%eax
+    154d:	50                   	push   %eax
+    154e:	e8 fd fe ff ff       	call   1450 <free>
+  return freep;
+    1553:	8b 15 e4 1d 00 00    	mov    0x1de4,%edx
+      if((p = morecore(nunits)) == 0)
+    1559:	83 c4 10             	add    $0x10,%esp
+    155c:	85 d2                	test   %edx,%edx
+    155e:	75 c0                	jne    1520 <malloc+0x40>
+        return 0;
+  }
+}
+    1560:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1563:	31 c0                	xor    %eax,%eax
+}
+    1565:	5b                   	pop    %ebx
+    1566:	5e                   	pop    %esi
+    1567:	5f                   	pop    %edi
+    1568:	5d                   	pop    %ebp
+    1569:	c3                   	ret
+    156a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1570:	39 cf                	cmp    %ecx,%edi
+    1572:	74 4c                	je     15c0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1574:	29 f9                	sub    %edi,%ecx
+    1576:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1579:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    157c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    157f:	89 15 e4 1d 00 00    	mov    %edx,0x1de4
+}
+    1585:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1588:	83 c0 08             	add    $0x8,%eax
+}
+    158b:	5b                   	pop    %ebx
+    158c:	5e                   	pop    %esi
+    158d:	5f                   	pop    %edi
+    158e:	5d                   	pop    %ebp
+    158f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1590:	c7 05 e4 1d 00 00 e8 	movl   $0x1de8,0x1de4
+    1597:	1d 00 00 
+    base.s.size = 0;
+    159a:	b8 e8 1d 00 00       	mov    $0x1de8,%eax
+    base.s.ptr = freep = prevp = &base;
+    159f:	c7 05 e8 1d 00 00 e8 	movl   $0x1de8,0x1de8
+    15a6:	1d 00 00 
+    base.s.size = 0;
+    15a9:	c7 05 ec 1d 00 00 00 	movl   $0x0,0x1dec
+    15b0:	00 00 00 
+    if(p->s.size >= nunits){
+    15b3:	e9 54 ff ff ff       	jmp    150c <malloc+0x2c>
+    15b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    15c0:	8b 08                	mov    (%eax),%ecx
+    15c2:	89 0a                	mov    %ecx,(%edx)
+    15c4:	eb b9                	jmp    157f <malloc+0x9f>
@@ -0,0 +1,1878 @@
+
+_top:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec a8 01 00 00    	sub    $0x1a8,%esp
+  struct sample s[2];
+  int maxproc, count, i;
+
+  count = argc > 1 ? atoi(argv[1]) : 5;
+  17:	83 39 01             	cmpl   $0x1,(%ecx)
+main(int argc, char *argv[]) {
+  1a:	8b 41 04             	mov    0x4(%ecx),%eax
+  count = argc > 1 ? atoi(argv[1]) : 5;
+  1d:	0f 8e 26 05 00 00    	jle    549 <main+0x549>
+  23:	83 ec 0c             	sub    $0xc,%esp
+  26:	ff 70 04             	push   0x4(%eax)
+  29:	e8 a2 07 00 00       	call   7d0 <atoi>
+  if(count <= 0) {
+  2e:	83 c4 10             	add    $0x10,%esp
+  count = argc > 1 ? atoi(argv[1]) : 5;
+  31:	89 85 4c fe ff ff    	mov    %eax,-0x1b4(%ebp)
+  if(count <= 0) {
+  37:	85 c0                	test   %eax,%eax
+  39:	0f 8e 19 05 00 00    	jle    558 <main+0x558>
+    printf(2, "usage: top [updates]\n");
+    exit(1);
+  }
+
+  /* Room for every process the kernel allows */
+  maxproc = proclimit(0);
+  3f:	83 ec 0c             	sub    $0xc,%esp
+  42:	6a 00                	push   $0x0
+  44:	e8 f2 08 00 00       	call   93b <proclimit>
+  s[0].pi = malloc(maxproc * sizeof(struct procinfo));
+  49:	6b d8 2c             	imul   $0x2c,%eax,%ebx
+  maxproc = proclimit(0);
+  4c:	89 85 50 fe ff ff    	mov    %eax,-0x1b0(%ebp)
+  52:	89 c7                	mov    %eax,%edi
+  s[0].pi = malloc(maxproc * sizeof(struct procinfo));
+  54:	89 1c 24             	mov    %ebx,(%esp)
+  57:	e8 e4 0c 00 00       	call   d40 <malloc>
+  5c:	89 85 88 fe ff ff    	mov    %eax,-0x178(%ebp)
+  s[1].pi = malloc(maxproc * sizeof(struct procinfo));
+  62:	89 1c 24             	mov    %ebx,(%esp)
+  65:	e8 d6 0c 00 00       	call   d40 <malloc>
+  if(s[0].pi == 0 || s[1].pi == 0 || take(&s[0], maxproc) < 0) {
+  6a:	8b 95 88 fe ff ff    	mov    -0x178(%ebp),%edx
+  70:	83 c4 10             	add    $0x10,%esp
+  s[1].pi = malloc(maxproc * sizeof(struct procinfo));
+  73:	89 85 38 ff ff ff    	mov    %eax,-0xc8(%ebp)
+  if(s[0].pi == 0 || s[1].pi == 0 || take(&s[0], maxproc) < 0) {
+  79:	85 d2                	test   %edx,%edx
+  7b:	0f 84 4b 04 00 00    	je     4cc <main+0x4cc>
+  81:	85 c0                	test   %eax,%eax
+  83:	0f 84 43 04 00 00    	je     4cc <main+0x4cc>
+  89:	89 fa                	mov    %edi,%edx
+  8b:	8d 85 88 fe ff ff    	lea    -0x178(%ebp),%eax
+  91:	e8 ea 04 00 00       	call   580 <take>
+  96:	85 c0                	test   %eax,%eax
+  98:	0f 88 2e 04 00 00    	js     4cc <main+0x4cc>
+    printf(2, "top: cannot read process information\n");
+    exit(1);
+  }
+
+  for(i = 0; i < count; ++i) {
+  9e:	31 c0                	xor    %eax,%eax
+  a0:	89 85 60 fe ff ff    	mov    %eax,-0x1a0(%ebp)
+  a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ad:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(INTERVAL);
+  b0:	83 ec 0c             	sub    $0xc,%esp
+    if(take(&s[(i+1) % 2], maxproc) < 0) {
+  b3:	8d bd 88 fe ff ff    	lea    -0x178(%ebp),%edi
+    sleep(INTERVAL);
+  b9:	6a 64                	push   $0x64
+  bb:	e8 13 08 00 00       	call   8d3 <sleep>
+    if(take(&s[(i+1) % 2], maxproc) < 0) {
+  c0:	8b 85 60 fe ff ff    	mov    -0x1a0(%ebp),%eax
+  c6:	8b 95 50 fe ff ff    	mov    -0x1b0(%ebp),%edx
+  cc:	89 c6                	mov    %eax,%esi
+  ce:	83 c0 01             	add    $0x1,%eax
+  d1:	89 85 60 fe ff ff    	mov    %eax,-0x1a0(%ebp)
+  d7:	83 e0 01             	and    $0x1,%eax
+  da:	89 85 5c fe ff ff    	mov    %eax,-0x1a4(%ebp)
+  e0:	69 c0 b0 00 00 00    	imul   $0xb0,%eax,%eax
+  e6:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  e9:	89 85 74 fe ff ff    	mov    %eax,-0x18c(%ebp)
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	e8 8a 04 00 00       	call   580 <take>
+  f6:	83 c4 10             	add    $0x10,%esp
+  f9:	85 c0                	test   %eax,%eax
+  fb:	0f 88 cb 03 00 00    	js     4cc <main+0x4cc>
+      printf(2, "top: cannot read process information\n");
+      exit(1);
+    }
+    show(&s[i % 2], &s[(i+1) % 2]);
+ 101:	83 e6 01             	and    $0x1,%esi
+show(struct sample *prev, struct sample *cur) {
+ 104:	89 a5 58 fe ff ff    	mov    %esp,-0x1a8(%ebp)
+    show(&s[i % 2], &s[(i+1) % 2]);
+ 10a:	69 c6 b0 00 00 00    	imul   $0xb0,%esi,%eax
+  uint du, ds, di, total, ms, d[cur->nproc];
+ 110:	8b b5 74 fe ff ff    	mov    -0x18c(%ebp),%esi
+ 116:	8b 94 35 8c fe ff ff 	mov    -0x174(%ebp,%esi,1),%edx
+  ms = cur->ms - prev->ms;
+ 11d:	8d 48 e8             	lea    -0x18(%eax),%ecx
+    show(&s[i % 2], &s[(i+1) % 2]);
+ 120:	01 c7                	add    %eax,%edi
+  uint du, ds, di, total, ms, d[cur->nproc];
+ 122:	8d 14 95 0f 00 00 00 	lea    0xf(,%edx,4),%edx
+  ms = cur->ms - prev->ms;
+ 129:	01 e9                	add    %ebp,%ecx
+  uint du, ds, di, total, ms, d[cur->nproc];
+ 12b:	c1 ea 04             	shr    $0x4,%edx
+  ms = cur->ms - prev->ms;
+ 12e:	89 8d 68 fe ff ff    	mov    %ecx,-0x198(%ebp)
+ 134:	89 d9                	mov    %ebx,%ecx
+  uint du, ds, di, total, ms, d[cur->nproc];
+ 136:	c1 e2 04             	shl    $0x4,%edx
+ 139:	29 d4                	sub    %edx,%esp
+ 13b:	89 a5 70 fe ff ff    	mov    %esp,-0x190(%ebp)
+  int i, j, order[cur->nproc];
+ 141:	29 d4                	sub    %edx,%esp
+  ms = cur->ms - prev->ms;
+ 143:	8b 94 35 34 ff ff ff 	mov    -0xcc(%ebp,%esi,1),%edx
+ 14a:	2b 94 05 34 ff ff ff 	sub    -0xcc(%ebp,%eax,1),%edx
+ 151:	b8 01 00 00 00       	mov    $0x1,%eax
+  int i, j, order[cur->nproc];
+ 156:	89 a5 6c fe ff ff    	mov    %esp,-0x194(%ebp)
+  if(ms == 0)
+ 15c:	0f 45 c2             	cmovne %edx,%eax
+  for(i = 0; i < cur->ncpu && i < prev->ncpu; ++i) {
+ 15f:	31 db                	xor    %ebx,%ebx
+ 161:	89 85 64 fe ff ff    	mov    %eax,-0x19c(%ebp)
+ 167:	8b 85 74 fe ff ff    	mov    -0x18c(%ebp),%eax
+ 16d:	8b 84 05 30 ff ff ff 	mov    -0xd0(%ebp,%eax,1),%eax
+ 174:	85 c0                	test   %eax,%eax
+ 176:	0f 8e 15 01 00 00    	jle    291 <main+0x291>
+ 17c:	89 c8                	mov    %ecx,%eax
+ 17e:	89 bd 54 fe ff ff    	mov    %edi,-0x1ac(%ebp)
+ 184:	89 f9                	mov    %edi,%ecx
+ 186:	89 c6                	mov    %eax,%esi
+ 188:	e9 ec 00 00 00       	jmp    279 <main+0x279>
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+    du = cur->ci[i].utime - prev->ci[i].utime;
+ 190:	8b 46 0c             	mov    0xc(%esi),%eax
+ 193:	2b 41 0c             	sub    0xc(%ecx),%eax
+    di = cur->ci[i].idle - prev->ci[i].idle;
+ 196:	89 8d 78 fe ff ff    	mov    %ecx,-0x188(%ebp)
+    ds = cur->ci[i].stime - prev->ci[i].stime;
+ 19c:	8b 7e 10             	mov    0x10(%esi),%edi
+    du = cur->ci[i].utime - prev->ci[i].utime;
+ 19f:	89 c2                	mov    %eax,%edx
+    ds = cur->ci[i].stime - prev->ci[i].stime;
+ 1a1:	2b 79 10             	sub    0x10(%ecx),%edi
+    di = cur->ci[i].idle - prev->ci[i].idle;
+ 1a4:	8b 46 14             	mov    0x14(%esi),%eax
+ 1a7:	2b 41 14             	sub    0x14(%ecx),%eax
+    if((total = du + ds + di) == 0)
+ 1aa:	89 bd 84 fe ff ff    	mov    %edi,-0x17c(%ebp)
+    di = cur->ci[i].idle - prev->ci[i].idle;
+ 1b0:	89 c1                	mov    %eax,%ecx
+    if((total = du + ds + di) == 0)
+ 1b2:	8d 04 3a             	lea    (%edx,%edi,1),%eax
+ 1b5:	89 95 7c fe ff ff    	mov    %edx,-0x184(%ebp)
+ 1bb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+ 1be:	b8 01 00 00 00       	mov    $0x1,%eax
+ 1c3:	89 8d 80 fe ff ff    	mov    %ecx,-0x180(%ebp)
+ 1c9:	85 ff                	test   %edi,%edi
+ 1cb:	0f 44 f8             	cmove  %eax,%edi
+    printf(1, "cpu%d:", cur->ci[i].cpu);
+ 1ce:	83 ec 04             	sub    $0x4,%esp
+ 1d1:	ff 76 08             	push   0x8(%esi)
+  for(i = 0; i < cur->ncpu && i < prev->ncpu; ++i) {
+ 1d4:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "cpu%d:", cur->ci[i].cpu);
+ 1d7:	68 42 0e 00 00       	push   $0xe42
+  for(i = 0; i < cur->ncpu && i < prev->ncpu; ++i) {
+ 1dc:	83 c6 14             	add    $0x14,%esi
+    printf(1, "cpu%d:", cur->ci[i].cpu);
+ 1df:	6a 01                	push   $0x1
+ 1e1:	e8 3a 08 00 00       	call   a20 <printf>
+    padd(1, du * 100 / total, 4);
+ 1e6:	83 c4 0c             	add    $0xc,%esp
+ 1e9:	6a 04                	push   $0x4
+ 1eb:	8b 95 7c fe ff ff    	mov    -0x184(%ebp),%edx
+ 1f1:	6b c2 64             	imul   $0x64,%edx,%eax
+ 1f4:	31 d2                	xor    %edx,%edx
+ 1f6:	f7 f7                	div    %edi
+ 1f8:	50                   	push   %eax
+ 1f9:	6a 01                	push   $0x1
+ 1fb:	e8 30 0a 00 00       	call   c30 <padd>
+    printf(1, "%% user");
+ 200:	58                   	pop    %eax
+ 201:	5a                   	pop    %edx
+ 202:	68 49 0e 00 00       	push   $0xe49
+ 207:	6a 01                	push   $0x1
+ 209:	e8 12 08 00 00       	call   a20 <printf>
+    padd(1, ds * 100 / total, 4);
+ 20e:	83 c4 0c             	add    $0xc,%esp
+ 211:	31 d2                	xor    %edx,%edx
+ 213:	6a 04                	push   $0x4
+ 215:	6b 85 84 fe ff ff 64 	imul   $0x64,-0x17c(%ebp),%eax
+ 21c:	f7 f7                	div    %edi
+ 21e:	50                   	push   %eax
+ 21f:	6a 01                	push   $0x1
+ 221:	e8 0a 0a 00 00       	call   c30 <padd>
+    printf(1, "%% sys");
+ 226:	59                   	pop    %ecx
+ 227:	58                   	pop    %eax
+ 228:	68 51 0e 00 00       	push   $0xe51
+ 22d:	6a 01                	push   $0x1
+ 22f:	e8 ec 07 00 00       	call   a20 <printf>
+    padd(1, di * 100 / total, 4);
+ 234:	83 c4 0c             	add    $0xc,%esp
+ 237:	31 d2                	xor    %edx,%edx
+ 239:	6a 04                	push   $0x4
+ 23b:	6b 85 80 fe ff ff 64 	imul   $0x64,-0x180(%ebp),%eax
+ 242:	f7 f7                	div    %edi
+ 244:	50                   	push   %eax
+ 245:	6a 01                	push   $0x1
+ 247:	e8 e4 09 00 00       	call   c30 <padd>
+    printf(1, "%% idle  pid %d\n", cur->ci[i].pid);
+ 24c:	83 c4 0c             	add    $0xc,%esp
+ 24f:	ff 76 04             	push   0x4(%esi)
+ 252:	68 58 0e 00 00       	push   $0xe58
+ 257:	6a 01                	push   $0x1
+ 259:	e8 c2 07 00 00       	call   a20 <printf>
+  for(i = 0; i < cur->ncpu && i < prev->ncpu; ++i) {
+ 25e:	8b 8d 78 fe ff ff    	mov    -0x188(%ebp),%ecx
+ 264:	8b 85 74 fe ff ff    	mov    -0x18c(%ebp),%eax
+ 26a:	83 c4 10             	add    $0x10,%esp
+ 26d:	83 c1 14             	add    $0x14,%ecx
+ 270:	3b 9c 05 30 ff ff ff 	cmp    -0xd0(%ebp,%eax,1),%ebx
+ 277:	7d 12                	jge    28b <main+0x28b>
+ 279:	8b 85 68 fe ff ff    	mov    -0x198(%ebp),%eax
+ 27f:	39 98 48 ff ff ff    	cmp    %ebx,-0xb8(%eax)
+ 285:	0f 8f 05 ff ff ff    	jg     190 <main+0x190>
+ 28b:	8b bd 54 fe ff ff    	mov    -0x1ac(%ebp),%edi
+  for(i = 0; i < cur->nproc; ++i) {
+ 291:	69 85 5c fe ff ff b0 	imul   $0xb0,-0x1a4(%ebp),%eax
+ 298:	00 00 00 
+ 29b:	8b 8c 05 8c fe ff ff 	mov    -0x174(%ebp,%eax,1),%ecx
+ 2a2:	89 8d 78 fe ff ff    	mov    %ecx,-0x188(%ebp)
+ 2a8:	85 c9                	test   %ecx,%ecx
+ 2aa:	0f 8e d6 00 00 00    	jle    386 <main+0x386>
+ 2b0:	8b 0f                	mov    (%edi),%ecx
+ 2b2:	8b 94 05 88 fe ff ff 	mov    -0x178(%ebp,%eax,1),%edx
+    d[i] = used(prev, &cur->pi[i]);
+ 2b9:	31 db                	xor    %ebx,%ebx
+ 2bb:	8b 7f 04             	mov    0x4(%edi),%edi
+ 2be:	89 9d 84 fe ff ff    	mov    %ebx,-0x17c(%ebp)
+ 2c4:	89 8d 74 fe ff ff    	mov    %ecx,-0x18c(%ebp)
+ 2ca:	8b 8d 6c fe ff ff    	mov    -0x194(%ebp),%ecx
+ 2d0:	89 95 80 fe ff ff    	mov    %edx,-0x180(%ebp)
+ 2d6:	89 fa                	mov    %edi,%edx
+ 2d8:	8b bd 70 fe ff ff    	mov    -0x190(%ebp),%edi
+ 2de:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < s->nproc; ++i)
+ 2e0:	85 d2                	test   %edx,%edx
+ 2e2:	0f 8e 18 02 00 00    	jle    500 <main+0x500>
+    if(s->pi[i].pid == pi->pid)
+ 2e8:	8b 85 80 fe ff ff    	mov    -0x180(%ebp),%eax
+  for(i = 0; i < s->nproc; ++i)
+ 2ee:	31 db                	xor    %ebx,%ebx
+    if(s->pi[i].pid == pi->pid)
+ 2f0:	8b 30                	mov    (%eax),%esi
+ 2f2:	8b 85 74 fe ff ff    	mov    -0x18c(%ebp),%eax
+ 2f8:	eb 14                	jmp    30e <main+0x30e>
+ 2fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < s->nproc; ++i)
+ 300:	83 c3 01             	add    $0x1,%ebx
+ 303:	83 c0 2c             	add    $0x2c,%eax
+ 306:	39 da                	cmp    %ebx,%edx
+ 308:	0f 84 f2 01 00 00    	je     500 <main+0x500>
+    if(s->pi[i].pid == pi->pid)
+ 30e:	39 30                	cmp    %esi,(%eax)
+ 310:	75 ee                	jne    300 <main+0x300>
+      return pi->utime + pi->stime - s->pi[i].utime - s->pi[i].stime;
+ 312:	8b b5 80 fe ff ff    	mov    -0x180(%ebp),%esi
+ 318:	8b 5e 14             	mov    0x14(%esi),%ebx
+ 31b:	03 5e 10             	add    0x10(%esi),%ebx
+ 31e:	2b 58 10             	sub    0x10(%eax),%ebx
+ 321:	2b 58 14             	sub    0x14(%eax),%ebx
+    d[i] = used(prev, &cur->pi[i]);
+ 324:	8b b5 84 fe ff ff    	mov    -0x17c(%ebp),%esi
+ 32a:	89 1c b7             	mov    %ebx,(%edi,%esi,4)
+ 32d:	89 f0                	mov    %esi,%eax
+    for(j = i; j > 0 && d[order[j-1]] < d[i]; --j)
+ 32f:	85 f6                	test   %esi,%esi
+ 331:	0f 84 bf 01 00 00    	je     4f6 <main+0x4f6>
+ 337:	89 95 7c fe ff ff    	mov    %edx,-0x184(%ebp)
+ 33d:	eb 0d                	jmp    34c <main+0x34c>
+ 33f:	90                   	nop
+      order[j] = order[j-1];
+ 340:	89 54 81 04          	mov    %edx,0x4(%ecx,%eax,4)
+    for(j = i; j > 0 && d[order[j-1]] < d[i]; --j)
+ 344:	85 c0                	test   %eax,%eax
+ 346:	0f 84 a4 01 00 00    	je     4f0 <main+0x4f0>
+ 34c:	89 c6                	mov    %eax,%esi
+ 34e:	83 e8 01             	sub    $0x1,%eax
+ 351:	8b 14 81             	mov    (%ecx,%eax,4),%edx
+ 354:	39 1c 97             	cmp    %ebx,(%edi,%edx,4)
+ 357:	72 e7                	jb     340 <main+0x340>
+ 359:	8b 95 7c fe ff ff    	mov    -0x184(%ebp),%edx
+    order[j] = i;
+ 35f:	8b 85 84 fe ff ff    	mov    -0x17c(%ebp),%eax
+  for(i = 0; i < cur->nproc; ++i) {
+ 365:	83 85 80 fe ff ff 2c 	addl   $0x2c,-0x180(%ebp)
+    order[j] = i;
+ 36c:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+  for(i = 0; i < cur->nproc; ++i) {
+ 36f:	8b b5 78 fe ff ff    	mov    -0x188(%ebp),%esi
+ 375:	83 c0 01             	add    $0x1,%eax
+ 378:	89 85 84 fe ff ff    	mov    %eax,-0x17c(%ebp)
+ 37e:	39 f0                	cmp    %esi,%eax
+ 380:	0f 85 5a ff ff ff    	jne    2e0 <main+0x2e0>
+  printf(1, "\n  PID  PPID STATE  CPU %%CPU  USER(ms)   SYS(ms) NAME\n");
+ 386:	83 ec 08             	sub    $0x8,%esp
+ 389:	68 c4 0e 00 00       	push   $0xec4
+ 38e:	6a 01                	push   $0x1
+ 390:	e8 8b 06 00 00       	call   a20 <printf>
+  for(i = 0; i < cur->nproc; ++i) {
+ 395:	83 c4 10             	add    $0x10,%esp
+ 398:	69 85 5c fe ff ff b0 	imul   $0xb0,-0x1a4(%ebp),%eax
+ 39f:	00 00 00 
+ 3a2:	8b 9c 05 8c fe ff ff 	mov    -0x174(%ebp,%eax,1),%ebx
+ 3a9:	8d 78 e8             	lea    -0x18(%eax),%edi
+ 3ac:	8d 0c 2f             	lea    (%edi,%ebp,1),%ecx
+ 3af:	85 db                	test   %ebx,%ebx
+ 3b1:	0f 8e 61 01 00 00    	jle    518 <main+0x518>
+ 3b7:	89 8d 84 fe ff ff    	mov    %ecx,-0x17c(%ebp)
+ 3bd:	31 ff                	xor    %edi,%edi
+ 3bf:	eb 7f                	jmp    440 <main+0x440>
+ 3c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      padd(1, pi->cpu, 5);
+ 3c8:	83 ec 04             	sub    $0x4,%esp
+ 3cb:	6a 05                	push   $0x5
+ 3cd:	50                   	push   %eax
+ 3ce:	6a 01                	push   $0x1
+ 3d0:	e8 5b 08 00 00       	call   c30 <padd>
+ 3d5:	83 c4 10             	add    $0x10,%esp
+    padd(1, d[order[i]] * 100 / ms, 5);
+ 3d8:	83 ec 04             	sub    $0x4,%esp
+ 3db:	31 d2                	xor    %edx,%edx
+    printf(1, " %s\n", pi->name);
+ 3dd:	83 c3 1c             	add    $0x1c,%ebx
+  for(i = 0; i < cur->nproc; ++i) {
+ 3e0:	83 c7 01             	add    $0x1,%edi
+    padd(1, d[order[i]] * 100 / ms, 5);
+ 3e3:	6a 05                	push   $0x5
+ 3e5:	8b 85 70 fe ff ff    	mov    -0x190(%ebp),%eax
+ 3eb:	6b 04 b0 64          	imul   $0x64,(%eax,%esi,4),%eax
+ 3ef:	f7 b5 64 fe ff ff    	divl   -0x19c(%ebp)
+ 3f5:	50                   	push   %eax
+ 3f6:	6a 01                	push   $0x1
+ 3f8:	e8 33 08 00 00       	call   c30 <padd>
+    padd(1, pi->utime, 10);
+ 3fd:	83 c4 0c             	add    $0xc,%esp
+ 400:	6a 0a                	push   $0xa
+ 402:	ff 73 f4             	push   -0xc(%ebx)
+ 405:	6a 01                	push   $0x1
+ 407:	e8 24 08 00 00       	call   c30 <padd>
+    padd(1, pi->stime, 10);
+ 40c:	83 c4 0c             	add    $0xc,%esp
+ 40f:	6a 0a                	push   $0xa
+ 411:	ff 73 f8             	push   -0x8(%ebx)
+ 414:	6a 01                	push   $0x1
+ 416:	e8 15 08 00 00       	call   c30 <padd>
+    printf(1, " %s\n", pi->name);
+ 41b:	83 c4 0c             	add    $0xc,%esp
+ 41e:	53                   	push   %ebx
+ 41f:	68 71 0e 00 00       	push   $0xe71
+ 424:	6a 01                	push   $0x1
+ 426:	e8 f5 05 00 00       	call   a20 <printf>
+  for(i = 0; i < cur->nproc; ++i) {
+ 42b:	8b 85 84 fe ff ff    	mov    -0x17c(%ebp),%eax
+ 431:	83 c4 10             	add    $0x10,%esp
+ 434:	3b b8 a4 fe ff ff    	cmp    -0x15c(%eax),%edi
+ 43a:	0f 8d d8 00 00 00    	jge    518 <main+0x518>
+    struct procinfo *pi = &cur->pi[order[i]];
+ 440:	8b 85 6c fe ff ff    	mov    -0x194(%ebp),%eax
+    padd(1, pi->pid, 5);
+ 446:	83 ec 04             	sub    $0x4,%esp
+    struct procinfo *pi = &cur->pi[order[i]];
+ 449:	8b 34 b8             	mov    (%eax,%edi,4),%esi
+ 44c:	8b 85 84 fe ff ff    	mov    -0x17c(%ebp),%eax
+ 452:	6b de 2c             	imul   $0x2c,%esi,%ebx
+ 455:	03 98 a0 fe ff ff    	add    -0x160(%eax),%ebx
+    padd(1, pi->pid, 5);
+ 45b:	6a 05                	push   $0x5
+ 45d:	ff 33                	push   (%ebx)
+ 45f:	6a 01                	push   $0x1
+ 461:	e8 ca 07 00 00       	call   c30 <padd>
+    padd(1, pi->ppid, 6);
+ 466:	83 c4 0c             	add    $0xc,%esp
+ 469:	6a 06                	push   $0x6
+ 46b:	ff 73 04             	push   0x4(%ebx)
+ 46e:	6a 01                	push   $0x1
+ 470:	e8 bb 07 00 00       	call   c30 <padd>
+    printf(1, " ");
+ 475:	58                   	pop    %eax
+ 476:	5a                   	pop    %edx
+ 477:	68 69 0e 00 00       	push   $0xe69
+ 47c:	6a 01                	push   $0x1
+ 47e:	e8 9d 05 00 00       	call   a20 <printf>
+    pads(1, pi->state >= 0 && pi->state <= PI_ZOMBIE ? states[pi->state] : "???", 6);
+ 483:	8b 53 08             	mov    0x8(%ebx),%edx
+ 486:	83 c4 10             	add    $0x10,%esp
+ 489:	b8 28 0e 00 00       	mov    $0xe28,%eax
+ 48e:	83 fa 05             	cmp    $0x5,%edx
+ 491:	77 07                	ja     49a <main+0x49a>
+ 493:	8b 04 95 fc 0e 00 00 	mov    0xefc(,%edx,4),%eax
+ 49a:	83 ec 04             	sub    $0x4,%esp
+ 49d:	6a 06                	push   $0x6
+ 49f:	50                   	push   %eax
+ 4a0:	6a 01                	push   $0x1
+ 4a2:	e8 29 07 00 00       	call   bd0 <pads>
+    if(pi->cpu < 0)
+ 4a7:	8b 43 0c             	mov    0xc(%ebx),%eax
+ 4aa:	83 c4 10             	add    $0x10,%esp
+ 4ad:	85 c0                	test   %eax,%eax
+ 4af:	0f 89 13 ff ff ff    	jns    3c8 <main+0x3c8>
+      printf(1, "    -");
+ 4b5:	83 ec 08             	sub    $0x8,%esp
+ 4b8:	68 6b 0e 00 00       	push   $0xe6b
+ 4bd:	6a 01                	push   $0x1
+ 4bf:	e8 5c 05 00 00       	call   a20 <printf>
+ 4c4:	83 c4 10             	add    $0x10,%esp
+ 4c7:	e9 0c ff ff ff       	jmp    3d8 <main+0x3d8>
+    printf(2, "top: cannot read process information\n");
+ 4cc:	83 ec 08             	sub    $0x8,%esp
+ 4cf:	68 9c 0e 00 00       	push   $0xe9c
+ 4d4:	6a 02                	push   $0x2
+ 4d6:	e8 45 05 00 00       	call   a20 <printf>
+    exit(1);
+ 4db:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 4e2:	e8 5c 03 00 00       	call   843 <exit>
+ 4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ee:	66 90                	xchg   %ax,%ax
+ 4f0:	8b 95 7c fe ff ff    	mov    -0x184(%ebp),%edx
+    for(j = i; j > 0 && d[order[j-1]] < d[i]; --j)
+ 4f6:	31 f6                	xor    %esi,%esi
+ 4f8:	e9 62 fe ff ff       	jmp    35f <main+0x35f>
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return pi->utime + pi->stime;
+ 500:	8b 85 80 fe ff ff    	mov    -0x180(%ebp),%eax
+ 506:	8b 58 14             	mov    0x14(%eax),%ebx
+ 509:	03 58 10             	add    0x10(%eax),%ebx
+ 50c:	e9 13 fe ff ff       	jmp    324 <main+0x324>
+ 511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  printf(1, "\n");
+ 518:	83 ec 08             	sub    $0x8,%esp
+ 51b:	68 40 0e 00 00       	push   $0xe40
+ 520:	6a 01                	push   $0x1
+ 522:	e8 f9 04 00 00       	call   a20 <printf>
+ 527:	8b a5 58 fe ff ff    	mov    -0x1a8(%ebp),%esp
+  for(i = 0; i < count; ++i) {
+ 52d:	8b bd 4c fe ff ff    	mov    -0x1b4(%ebp),%edi
+ 533:	39 bd 60 fe ff ff    	cmp    %edi,-0x1a0(%ebp)
+ 539:	0f 85 71 fb ff ff    	jne    b0 <main+0xb0>
+  }
+  exit(0);
+ 53f:	83 ec 0c             	sub    $0xc,%esp
+ 542:	6a 00                	push   $0x0
+ 544:	e8 fa 02 00 00       	call   843 <exit>
+  count = argc > 1 ? atoi(argv[1]) : 5;
+ 549:	c7 85 4c fe ff ff 05 	movl   $0x5,-0x1b4(%ebp)
+ 550:	00 00 00 
+ 553:	e9 e7 fa ff ff       	jmp    3f <main+0x3f>
+    printf(2, "usage: top [updates]\n");
+ 558:	51                   	push   %ecx
+ 559:	51                   	push   %ecx
+ 55a:	68 2c 0e 00 00       	push   $0xe2c
+ 55f:	6a 02                	push   $0x2
+ 561:	e8 ba 04 00 00       	call   a20 <printf>
+    exit(1);
+ 566:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 56d:	e8 d1 02 00 00       	call   843 <exit>
+ 572:	66 90                	xchg   %ax,%ax
+ 574:	66 90                	xchg   %ax,%ax
+ 576:	66 90                	xchg   %ax,%ax
+ 578:	66 90                	xchg   %ax,%ax
+ 57a:	66 90                	xchg   %ax,%ax
+ 57c:	66 90                	xchg   %ax,%ax
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <take>:
+take(struct sample *s, int maxproc) {
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	56                   	push   %esi
+ 584:	89 d6                	mov    %edx,%esi
+ 586:	53                   	push   %ebx
+ 587:	89 c3                	mov    %eax,%ebx
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+ 589:	8d 45 f0             	lea    -0x10(%ebp),%eax
+take(struct sample *s, int maxproc) {
+ 58c:	83 ec 18             	sub    $0x18,%esp
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+ 58f:	50                   	push   %eax
+ 590:	6a 01                	push   $0x1
+ 592:	e8 84 03 00 00       	call   91b <clock_gettime>
+  return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+ 597:	b8 83 de 1b 43       	mov    $0x431bde83,%eax
+ 59c:	f7 65 f4             	mull   -0xc(%ebp)
+ 59f:	69 4d f0 e8 03 00 00 	imul   $0x3e8,-0x10(%ebp),%ecx
+ 5a6:	c1 ea 12             	shr    $0x12,%edx
+ 5a9:	01 d1                	add    %edx,%ecx
+  s->ms = msnow();
+ 5ab:	89 8b ac 00 00 00    	mov    %ecx,0xac(%ebx)
+  if((s->nproc = procinfo(s->pi, maxproc)) < 0 ||
+ 5b1:	58                   	pop    %eax
+ 5b2:	5a                   	pop    %edx
+ 5b3:	56                   	push   %esi
+ 5b4:	ff 33                	push   (%ebx)
+ 5b6:	e8 88 03 00 00       	call   943 <procinfo>
+ 5bb:	83 c4 10             	add    $0x10,%esp
+ 5be:	89 43 04             	mov    %eax,0x4(%ebx)
+ 5c1:	85 c0                	test   %eax,%eax
+ 5c3:	78 2b                	js     5f0 <take+0x70>
+     (s->ncpu = cpuinfo(s->ci, MAXCPU)) < 0)
+ 5c5:	83 ec 08             	sub    $0x8,%esp
+ 5c8:	8d 43 08             	lea    0x8(%ebx),%eax
+ 5cb:	6a 08                	push   $0x8
+ 5cd:	50                   	push   %eax
+ 5ce:	e8 78 03 00 00       	call   94b <cpuinfo>
+ 5d3:	83 c4 10             	add    $0x10,%esp
+ 5d6:	89 83 a8 00 00 00    	mov    %eax,0xa8(%ebx)
+  if((s->nproc = procinfo(s->pi, maxproc)) < 0 ||
+ 5dc:	c1 f8 1f             	sar    $0x1f,%eax
+}
+ 5df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5e2:	5b                   	pop    %ebx
+ 5e3:	5e                   	pop    %esi
+ 5e4:	5d                   	pop    %ebp
+ 5e5:	c3                   	ret
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 5f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 5f5:	eb e8                	jmp    5df <take+0x5f>
+ 5f7:	66 90                	xchg   %ax,%ax
+ 5f9:	66 90                	xchg   %ax,%ax
+ 5fb:	66 90                	xchg   %ax,%ax
+ 5fd:	66 90                	xchg   %ax,%ax
+ 5ff:	90                   	nop
+
+00000600 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 600:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 601:	31 c0                	xor    %eax,%eax
+{
+ 603:	89 e5                	mov    %esp,%ebp
+ 605:	53                   	push   %ebx
+ 606:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 609:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 60c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 610:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 614:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 617:	83 c0 01             	add    $0x1,%eax
+ 61a:	84 d2                	test   %dl,%dl
+ 61c:	75 f2                	jne    610 <strcpy+0x10>
+    ;
+  return os;
+}
+ 61e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 621:	89 c8                	mov    %ecx,%eax
+ 623:	c9                   	leave
+ 624:	c3                   	ret
+ 625:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	53                   	push   %ebx
+ 634:	8b 55 08             	mov    0x8(%ebp),%edx
+ 637:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 63a:	0f b6 02             	movzbl (%edx),%eax
+ 63d:	84 c0                	test   %al,%al
+ 63f:	75 17                	jne    658 <strcmp+0x28>
+ 641:	eb 3a                	jmp    67d <strcmp+0x4d>
+ 643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 647:	90                   	nop
+ 648:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 64c:	83 c2 01             	add    $0x1,%edx
+ 64f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 652:	84 c0                	test   %al,%al
+ 654:	74 1a                	je     670 <strcmp+0x40>
+    p++, q++;
+ 656:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 658:	0f b6 19             	movzbl (%ecx),%ebx
+ 65b:	38 c3                	cmp    %al,%bl
+ 65d:	74 e9                	je     648 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 65f:	29 d8                	sub    %ebx,%eax
+}
+ 661:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 664:	c9                   	leave
+ 665:	c3                   	ret
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 670:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 674:	31 c0                	xor    %eax,%eax
+ 676:	29 d8                	sub    %ebx,%eax
+}
+ 678:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 67b:	c9                   	leave
+ 67c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 67d:	0f b6 19             	movzbl (%ecx),%ebx
+ 680:	31 c0                	xor    %eax,%eax
+ 682:	eb db                	jmp    65f <strcmp+0x2f>
+ 684:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 68f:	90                   	nop
+
+00000690 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 696:	80 3a 00             	cmpb   $0x0,(%edx)
+ 699:	74 15                	je     6b0 <strlen+0x20>
+ 69b:	31 c0                	xor    %eax,%eax
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+ 6a0:	83 c0 01             	add    $0x1,%eax
+ 6a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 6a7:	89 c1                	mov    %eax,%ecx
+ 6a9:	75 f5                	jne    6a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 6ab:	89 c8                	mov    %ecx,%eax
+ 6ad:	5d                   	pop    %ebp
+ 6ae:	c3                   	ret
+ 6af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 6b0:	31 c9                	xor    %ecx,%ecx
+}
+ 6b2:	5d                   	pop    %ebp
+ 6b3:	89 c8                	mov    %ecx,%eax
+ 6b5:	c3                   	ret
+ 6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	57                   	push   %edi
+ 6c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 6c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6cd:	89 d7                	mov    %edx,%edi
+ 6cf:	fc                   	cld
+ 6d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 6d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 6d5:	89 d0                	mov    %edx,%eax
+ 6d7:	c9                   	leave
+ 6d8:	c3                   	ret
+ 6d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 6ea:	0f b6 10             	movzbl (%eax),%edx
+ 6ed:	84 d2                	test   %dl,%dl
+ 6ef:	75 12                	jne    703 <strchr+0x23>
+ 6f1:	eb 1d                	jmp    710 <strchr+0x30>
+ 6f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6f7:	90                   	nop
+ 6f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 6fc:	83 c0 01             	add    $0x1,%eax
+ 6ff:	84 d2                	test   %dl,%dl
+ 701:	74 0d                	je     710 <strchr+0x30>
+    if(*s == c)
+ 703:	38 d1                	cmp    %dl,%cl
+ 705:	75 f1                	jne    6f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 707:	5d                   	pop    %ebp
+ 708:	c3                   	ret
+ 709:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 710:	31 c0                	xor    %eax,%eax
+}
+ 712:	5d                   	pop    %ebp
+ 713:	c3                   	ret
+ 714:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 71f:	90                   	nop
+
+00000720 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 725:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 728:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 729:	31 db                	xor    %ebx,%ebx
+{
+ 72b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 72e:	eb 27                	jmp    757 <gets+0x37>
+    cc = read(0, &c, 1);
+ 730:	83 ec 04             	sub    $0x4,%esp
+ 733:	6a 01                	push   $0x1
+ 735:	56                   	push   %esi
+ 736:	6a 00                	push   $0x0
+ 738:	e8 1e 01 00 00       	call   85b <read>
+    if(cc < 1)
+ 73d:	83 c4 10             	add    $0x10,%esp
+ 740:	85 c0                	test   %eax,%eax
+ 742:	7e 1d                	jle    761 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 744:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 748:	8b 55 08             	mov    0x8(%ebp),%edx
+ 74b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 74f:	3c 0a                	cmp    $0xa,%al
+ 751:	74 10                	je     763 <gets+0x43>
+ 753:	3c 0d                	cmp    $0xd,%al
+ 755:	74 0c                	je     763 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 757:	89 df                	mov    %ebx,%edi
+ 759:	83 c3 01             	add    $0x1,%ebx
+ 75c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 75f:	7c cf                	jl     730 <gets+0x10>
+ 761:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 763:	8b 45 08             	mov    0x8(%ebp),%eax
+ 766:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 76a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 76d:	5b                   	pop    %ebx
+ 76e:	5e                   	pop    %esi
+ 76f:	5f                   	pop    %edi
+ 770:	5d                   	pop    %ebp
+ 771:	c3                   	ret
+ 772:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000780 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	56                   	push   %esi
+ 784:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 785:	83 ec 08             	sub    $0x8,%esp
+ 788:	6a 00                	push   $0x0
+ 78a:	ff 75 08             	push   0x8(%ebp)
+ 78d:	e8 f1 00 00 00       	call   883 <open>
+  if(fd < 0)
+ 792:	83 c4 10             	add    $0x10,%esp
+ 795:	85 c0                	test   %eax,%eax
+ 797:	78 27                	js     7c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 799:	83 ec 08             	sub    $0x8,%esp
+ 79c:	ff 75 0c             	push   0xc(%ebp)
+ 79f:	89 c3                	mov    %eax,%ebx
+ 7a1:	50                   	push   %eax
+ 7a2:	e8 f4 00 00 00       	call   89b <fstat>
+  close(fd);
+ 7a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 7aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 7ac:	e8 ba 00 00 00       	call   86b <close>
+  return r;
+ 7b1:	83 c4 10             	add    $0x10,%esp
+}
+ 7b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 7b7:	89 f0                	mov    %esi,%eax
+ 7b9:	5b                   	pop    %ebx
+ 7ba:	5e                   	pop    %esi
+ 7bb:	5d                   	pop    %ebp
+ 7bc:	c3                   	ret
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 7c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 7c5:	eb ed                	jmp    7b4 <stat+0x34>
+ 7c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ce:	66 90                	xchg   %ax,%ax
+
+000007d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	53                   	push   %ebx
+ 7d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 7d7:	0f be 02             	movsbl (%edx),%eax
+ 7da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 7dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 7e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 7e5:	77 1e                	ja     805 <atoi+0x35>
+ 7e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 7f0:	83 c2 01             	add    $0x1,%edx
+ 7f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 7f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 7fa:	0f be 02             	movsbl (%edx),%eax
+ 7fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 800:	80 fb 09             	cmp    $0x9,%bl
+ 803:	76 eb                	jbe    7f0 <atoi+0x20>
+  return n;
+}
+ 805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 808:	89 c8                	mov    %ecx,%eax
+ 80a:	c9                   	leave
+ 80b:	c3                   	ret
+ 80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000810 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 810:	55                   	push   %ebp
+ 811:	89 e5                	mov    %esp,%ebp
+ 813:	57                   	push   %edi
+ 814:	56                   	push   %esi
+ 815:	8b 45 10             	mov    0x10(%ebp),%eax
+ 818:	8b 55 08             	mov    0x8(%ebp),%edx
+ 81b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 81e:	85 c0                	test   %eax,%eax
+ 820:	7e 13                	jle    835 <memmove+0x25>
+ 822:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 824:	89 d7                	mov    %edx,%edi
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 830:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 831:	39 f8                	cmp    %edi,%eax
+ 833:	75 fb                	jne    830 <memmove+0x20>
+  return vdst;
+}
+ 835:	5e                   	pop    %esi
+ 836:	89 d0                	mov    %edx,%eax
+ 838:	5f                   	pop    %edi
+ 839:	5d                   	pop    %ebp
+ 83a:	c3                   	ret
+
+0000083b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 83b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 840:	cd 40                	int    $0x40
+ 842:	c3                   	ret
+
+00000843 <exit>:
+SYSCALL(exit)
+ 843:	b8 02 00 00 00       	mov    $0x2,%eax
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <wait>:
+SYSCALL(wait)
+ 84b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 850:	cd 40                	int    $0x40
+ 852:	c3                   	ret
+
+00000853 <pipe>:
+SYSCALL(pipe)
+ 853:	b8 04 00 00 00       	mov    $0x4,%eax
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <read>:
+SYSCALL(read)
+ 85b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 860:	cd 40                	int    $0x40
+ 862:	c3                   	ret
+
+00000863 <write>:
+SYSCALL(write)
+ 863:	b8 10 00 00 00       	mov    $0x10,%eax
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <close>:
+SYSCALL(close)
+ 86b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <kill>:
+SYSCALL(kill)
+ 873:	b8 06 00 00 00       	mov    $0x6,%eax
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <exec>:
+SYSCALL(exec)
+ 87b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <open>:
+SYSCALL(open)
+ 883:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <mknod>:
+SYSCALL(mknod)
+ 88b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <unlink>:
+SYSCALL(unlink)
+ 893:	b8 12 00 00 00       	mov    $0x12,%eax
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <fstat>:
+SYSCALL(fstat)
+ 89b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <link>:
+SYSCALL(link)
+ 8a3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 8a8:	cd 40                	int    $0x40
+ 8aa:	c3                   	ret
+
+000008ab <mkdir>:
+SYSCALL(mkdir)
+ 8ab:	b8 14 00 00 00       	mov    $0x14,%eax
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+000008b3 <chdir>:
+SYSCALL(chdir)
+ 8b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 8b8:	cd 40                	int    $0x40
+ 8ba:	c3                   	ret
+
+000008bb <dup>:
+SYSCALL(dup)
+ 8bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	c3                   	ret
+
+000008c3 <getpid>:
+SYSCALL(getpid)
+ 8c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 8c8:	cd 40                	int    $0x40
+ 8ca:	c3                   	ret
+
+000008cb <sbrk>:
+SYSCALL(sbrk)
+ 8cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 8d0:	cd 40                	int    $0x40
+ 8d2:	c3                   	ret
+
+000008d3 <sleep>:
+SYSCALL(sleep)
+ 8d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8d8:	cd 40                	int    $0x40
+ 8da:	c3                   	ret
+
+000008db <uptime>:
+SYSCALL(uptime)
+ 8db:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8e0:	cd 40                	int    $0x40
+ 8e2:	c3                   	ret
+
+000008e3 <getdate>:
+SYSCALL(getdate)
+ 8e3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8e8:	cd 40                	int    $0x40
+ 8ea:	c3                   	ret
+
+000008eb <setdate>:
+SYSCALL(setdate)
+ 8eb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8f0:	cd 40                	int    $0x40
+ 8f2:	c3                   	ret
+
+000008f3 <mount>:
+SYSCALL(mount)
+ 8f3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8f8:	cd 40                	int    $0x40
+ 8fa:	c3                   	ret
+
+000008fb <unmount>:
+SYSCALL(unmount)
+ 8fb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 900:	cd 40                	int    $0x40
+ 902:	c3                   	ret
+
+00000903 <lseek>:
+SYSCALL(lseek)
+ 903:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 908:	cd 40                	int    $0x40
+ 90a:	c3                   	ret
+
+0000090b <mmap>:
+SYSCALL(mmap)
+ 90b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 910:	cd 40                	int    $0x40
+ 912:	c3                   	ret
+
+00000913 <munmap>:
+SYSCALL(munmap)
+ 913:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 918:	cd 40                	int    $0x40
+ 91a:	c3                   	ret
+
+0000091b <clock_gettime>:
+SYSCALL(clock_gettime)
+ 91b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 920:	cd 40                	int    $0x40
+ 922:	c3                   	ret
+
+00000923 <nanosleep>:
+SYSCALL(nanosleep)
+ 923:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 928:	cd 40                	int    $0x40
+ 92a:	c3                   	ret
+
+0000092b <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+ 92b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 930:	cd 40                	int    $0x40
+ 932:	c3                   	ret
+
+00000933 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+ 933:	b8 20 00 00 00       	mov    $0x20,%eax
+ 938:	cd 40                	int    $0x40
+ 93a:	c3                   	ret
+
+0000093b <proclimit>:
+SYSCALL(proclimit)
+ 93b:	b8 21 00 00 00       	mov    $0x21,%eax
+ 940:	cd 40                	int    $0x40
+ 942:	c3                   	ret
+
+00000943 <procinfo>:
+SYSCALL(procinfo)
+ 943:	b8 22 00 00 00       	mov    $0x22,%eax
+ 948:	cd 40                	int    $0x40
+ 94a:	c3                   	ret
+
+0000094b <cpuinfo>:
+SYSCALL(cpuinfo)
+ 94b:	b8 23 00 00 00       	mov    $0x23,%eax
+ 950:	cd 40                	int    $0x40
+ 952:	c3                   	ret
+
+00000953 <schedstat>:
+SYSCALL(schedstat)
+ 953:	b8 24 00 00 00       	mov    $0x24,%eax
+ 958:	cd 40                	int    $0x40
+ 95a:	c3                   	ret
+
+0000095b <lockstat>:
+SYSCALL(lockstat)
+ 95b:	b8 25 00 00 00       	mov    $0x25,%eax
+ 960:	cd 40                	int    $0x40
+ 962:	c3                   	ret
+
+00000963 <bcachestat>:
+SYSCALL(bcachestat)
+ 963:	b8 26 00 00 00       	mov    $0x26,%eax
+ 968:	cd 40                	int    $0x40
+ 96a:	c3                   	ret
+
+0000096b <diskstat>:
+SYSCALL(diskstat)
+ 96b:	b8 27 00 00 00       	mov    $0x27,%eax
+ 970:	cd 40                	int    $0x40
+ 972:	c3                   	ret
+
+00000973 <iosched>:
+SYSCALL(iosched)
+ 973:	b8 28 00 00 00       	mov    $0x28,%eax
+ 978:	cd 40                	int    $0x40
+ 97a:	c3                   	ret
+ 97b:	66 90                	xchg   %ax,%ax
+ 97d:	66 90                	xchg   %ax,%ax
+ 97f:	90                   	nop
+
+00000980 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 988:	89 d1                	mov    %edx,%ecx
+{
+ 98a:	83 ec 3c             	sub    $0x3c,%esp
+ 98d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 990:	85 d2                	test   %edx,%edx
+ 992:	0f 89 80 00 00 00    	jns    a18 <printint+0x98>
+ 998:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 99c:	74 7a                	je     a18 <printint+0x98>
+    x = -xx;
+ 99e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9a8:	31 f6                	xor    %esi,%esi
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9b0:	89 c8                	mov    %ecx,%eax
+ 9b2:	31 d2                	xor    %edx,%edx
+ 9b4:	89 f7                	mov    %esi,%edi
+ 9b6:	f7 f3                	div    %ebx
+ 9b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9bb:	0f b6 92 78 0f 00 00 	movzbl 0xf78(%edx),%edx
+ 9c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9c6:	89 ca                	mov    %ecx,%edx
+ 9c8:	89 c1                	mov    %eax,%ecx
+ 9ca:	39 da                	cmp    %ebx,%edx
+ 9cc:	73 e2                	jae    9b0 <printint+0x30>
+  if(neg)
+ 9ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9d1:	85 c0                	test   %eax,%eax
+ 9d3:	74 07                	je     9dc <printint+0x5c>
+    buf[i++] = '-';
+ 9d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9da:	89 f7                	mov    %esi,%edi
+ 9dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9e2:	01 df                	add    %ebx,%edi
+ 9e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 9eb:	83 ec 04             	sub    $0x4,%esp
+ 9ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 9f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 9f4:	6a 01                	push   $0x1
+ 9f6:	50                   	push   %eax
+ 9f7:	56                   	push   %esi
+ 9f8:	e8 66 fe ff ff       	call   863 <write>
+  while(--i >= 0)
+ 9fd:	89 f8                	mov    %edi,%eax
+ 9ff:	83 c4 10             	add    $0x10,%esp
+ a02:	83 ef 01             	sub    $0x1,%edi
+ a05:	39 d8                	cmp    %ebx,%eax
+ a07:	75 df                	jne    9e8 <printint+0x68>
+}
+ a09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a0c:	5b                   	pop    %ebx
+ a0d:	5e                   	pop    %esi
+ a0e:	5f                   	pop    %edi
+ a0f:	5d                   	pop    %ebp
+ a10:	c3                   	ret
+ a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a18:	31 c0                	xor    %eax,%eax
+ a1a:	eb 89                	jmp    9a5 <printint+0x25>
+ a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	57                   	push   %edi
+ a24:	56                   	push   %esi
+ a25:	53                   	push   %ebx
+ a26:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a29:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+ a2c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a2f:	0f b6 1e             	movzbl (%esi),%ebx
+ a32:	83 c6 01             	add    $0x1,%esi
+ a35:	84 db                	test   %bl,%bl
+ a37:	74 67                	je     aa0 <printf+0x80>
+ a39:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a3c:	31 d2                	xor    %edx,%edx
+ a3e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a41:	eb 34                	jmp    a77 <printf+0x57>
+ a43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a47:	90                   	nop
+ a48:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a4b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a50:	83 f8 25             	cmp    $0x25,%eax
+ a53:	74 18                	je     a6d <printf+0x4d>
+  write(fd, &c, 1);
+ a55:	83 ec 04             	sub    $0x4,%esp
+ a58:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a5b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a5e:	6a 01                	push   $0x1
+ a60:	50                   	push   %eax
+ a61:	57                   	push   %edi
+ a62:	e8 fc fd ff ff       	call   863 <write>
+ a67:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a6a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a6d:	0f b6 1e             	movzbl (%esi),%ebx
+ a70:	83 c6 01             	add    $0x1,%esi
+ a73:	84 db                	test   %bl,%bl
+ a75:	74 29                	je     aa0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a77:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a7a:	85 d2                	test   %edx,%edx
+ a7c:	74 ca                	je     a48 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a7e:	83 fa 25             	cmp    $0x25,%edx
+ a81:	75 ea                	jne    a6d <printf+0x4d>
+      if(c == 'd'){
+ a83:	83 f8 25             	cmp    $0x25,%eax
+ a86:	0f 84 24 01 00 00    	je     bb0 <printf+0x190>
+ a8c:	83 e8 63             	sub    $0x63,%eax
+ a8f:	83 f8 15             	cmp    $0x15,%eax
+ a92:	77 1c                	ja     ab0 <printf+0x90>
+ a94:	ff 24 85 20 0f 00 00 	jmp    *0xf20(,%eax,4)
+ a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ aa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aa3:	5b                   	pop    %ebx
+ aa4:	5e                   	pop    %esi
+ aa5:	5f                   	pop    %edi
+ aa6:	5d                   	pop    %ebp
+ aa7:	c3                   	ret
+ aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aaf:	90                   	nop
+  write(fd, &c, 1);
+ ab0:	83 ec 04             	sub    $0x4,%esp
+ ab3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ab6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ aba:	6a 01                	push   $0x1
+ abc:	52                   	push   %edx
+ abd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ ac0:	57                   	push   %edi
+ ac1:	e8 9d fd ff ff       	call   863 <write>
+ ac6:	83 c4 0c             	add    $0xc,%esp
+ ac9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ acc:	6a 01                	push   $0x1
+ ace:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ ad1:	52                   	push   %edx
+ ad2:	57                   	push   %edi
+ ad3:	e8 8b fd ff ff       	call   863 <write>
+        putc(fd, c);
+ ad8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ adb:	31 d2                	xor    %edx,%edx
+ add:	eb 8e                	jmp    a6d <printf+0x4d>
+ adf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ ae0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ae3:	83 ec 0c             	sub    $0xc,%esp
+ ae6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ aeb:	8b 13                	mov    (%ebx),%edx
+ aed:	6a 00                	push   $0x0
+ aef:	89 f8                	mov    %edi,%eax
+        ap++;
+ af1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ af4:	e8 87 fe ff ff       	call   980 <printint>
+        ap++;
+ af9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ afc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aff:	31 d2                	xor    %edx,%edx
+ b01:	e9 67 ff ff ff       	jmp    a6d <printf+0x4d>
+ b06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b15:	83 c0 04             	add    $0x4,%eax
+ b18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b1b:	85 db                	test   %ebx,%ebx
+ b1d:	0f 84 9d 00 00 00    	je     bc0 <printf+0x1a0>
+        while(*s != 0){
+ b23:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b26:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b28:	84 c0                	test   %al,%al
+ b2a:	0f 84 3d ff ff ff    	je     a6d <printf+0x4d>
+ b30:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b33:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b36:	89 de                	mov    %ebx,%esi
+ b38:	89 d3                	mov    %edx,%ebx
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b40:	83 ec 04             	sub    $0x4,%esp
+ b43:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b46:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b49:	6a 01                	push   $0x1
+ b4b:	53                   	push   %ebx
+ b4c:	57                   	push   %edi
+ b4d:	e8 11 fd ff ff       	call   863 <write>
+        while(*s != 0){
+ b52:	0f b6 06             	movzbl (%esi),%eax
+ b55:	83 c4 10             	add    $0x10,%esp
+ b58:	84 c0                	test   %al,%al
+ b5a:	75 e4                	jne    b40 <printf+0x120>
+      state = 0;
+ b5c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b5f:	31 d2                	xor    %edx,%edx
+ b61:	e9 07 ff ff ff       	jmp    a6d <printf+0x4d>
+ b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b73:	83 ec 0c             	sub    $0xc,%esp
+ b76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b7b:	8b 13                	mov    (%ebx),%edx
+ b7d:	6a 01                	push   $0x1
+ b7f:	e9 6b ff ff ff       	jmp    aef <printf+0xcf>
+ b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b88:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b8b:	83 ec 04             	sub    $0x4,%esp
+ b8e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b91:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b93:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b96:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b99:	6a 01                	push   $0x1
+ b9b:	52                   	push   %edx
+ b9c:	57                   	push   %edi
+ b9d:	e8 c1 fc ff ff       	call   863 <write>
+        ap++;
+ ba2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ ba5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ba8:	31 d2                	xor    %edx,%edx
+ baa:	e9 be fe ff ff       	jmp    a6d <printf+0x4d>
+ baf:	90                   	nop
+  write(fd, &c, 1);
+ bb0:	83 ec 04             	sub    $0x4,%esp
+ bb3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bb6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bb9:	6a 01                	push   $0x1
+ bbb:	e9 11 ff ff ff       	jmp    ad1 <printf+0xb1>
+ bc0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ bc5:	bb 14 0f 00 00       	mov    $0xf14,%ebx
+ bca:	e9 61 ff ff ff       	jmp    b30 <printf+0x110>
+ bcf:	90                   	nop
+
+00000bd0 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+ bd0:	55                   	push   %ebp
+ bd1:	89 e5                	mov    %esp,%ebp
+ bd3:	57                   	push   %edi
+ bd4:	56                   	push   %esi
+ bd5:	53                   	push   %ebx
+ bd6:	83 ec 20             	sub    $0x20,%esp
+ bd9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ bdc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+ bdf:	57                   	push   %edi
+ be0:	68 1b 0f 00 00       	push   $0xf1b
+ be5:	53                   	push   %ebx
+ be6:	e8 35 fe ff ff       	call   a20 <printf>
+  for(n = strlen(s); n < w; n++)
+ beb:	89 3c 24             	mov    %edi,(%esp)
+ bee:	e8 9d fa ff ff       	call   690 <strlen>
+ bf3:	83 c4 10             	add    $0x10,%esp
+ bf6:	3b 45 10             	cmp    0x10(%ebp),%eax
+ bf9:	7d 20                	jge    c1b <pads+0x4b>
+ bfb:	89 c6                	mov    %eax,%esi
+ bfd:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+ c00:	83 ec 04             	sub    $0x4,%esp
+ c03:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+ c07:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ c0a:	6a 01                	push   $0x1
+ c0c:	57                   	push   %edi
+ c0d:	53                   	push   %ebx
+ c0e:	e8 50 fc ff ff       	call   863 <write>
+  for(n = strlen(s); n < w; n++)
+ c13:	83 c4 10             	add    $0x10,%esp
+ c16:	39 75 10             	cmp    %esi,0x10(%ebp)
+ c19:	75 e5                	jne    c00 <pads+0x30>
+    putc(fd, ' ');
+}
+ c1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c1e:	5b                   	pop    %ebx
+ c1f:	5e                   	pop    %esi
+ c20:	5f                   	pop    %edi
+ c21:	5d                   	pop    %ebp
+ c22:	c3                   	ret
+ c23:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000c30 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+ c30:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+ c31:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+ c36:	89 e5                	mov    %esp,%ebp
+ c38:	57                   	push   %edi
+ c39:	56                   	push   %esi
+ c3a:	53                   	push   %ebx
+  int n = 0;
+ c3b:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+ c3d:	83 ec 2c             	sub    $0x2c,%esp
+ c40:	8b 55 0c             	mov    0xc(%ebp),%edx
+ c43:	8b 45 10             	mov    0x10(%ebp),%eax
+ c46:	8b 75 08             	mov    0x8(%ebp),%esi
+ c49:	89 55 d0             	mov    %edx,-0x30(%ebp)
+ c4c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ c4f:	90                   	nop
+  }while((x /= 10) != 0);
+ c50:	89 d0                	mov    %edx,%eax
+ c52:	89 d7                	mov    %edx,%edi
+    n++;
+ c54:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+ c57:	f7 e1                	mul    %ecx
+ c59:	c1 ea 03             	shr    $0x3,%edx
+ c5c:	83 ff 09             	cmp    $0x9,%edi
+ c5f:	77 ef                	ja     c50 <padd+0x20>
+  for(; n < w; n++)
+ c61:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ c64:	39 c3                	cmp    %eax,%ebx
+ c66:	7d 23                	jge    c8b <padd+0x5b>
+ c68:	8d 7d e7             	lea    -0x19(%ebp),%edi
+ c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c6f:	90                   	nop
+  write(fd, &c, 1);
+ c70:	83 ec 04             	sub    $0x4,%esp
+ c73:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+ c77:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+ c7a:	6a 01                	push   $0x1
+ c7c:	57                   	push   %edi
+ c7d:	56                   	push   %esi
+ c7e:	e8 e0 fb ff ff       	call   863 <write>
+  for(; n < w; n++)
+ c83:	83 c4 10             	add    $0x10,%esp
+ c86:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+ c89:	75 e5                	jne    c70 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+ c8b:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+ c92:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+ c95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+ c98:	89 f0                	mov    %esi,%eax
+}
+ c9a:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+ c9b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+ ca0:	5e                   	pop    %esi
+ ca1:	5f                   	pop    %edi
+ ca2:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+ ca3:	e9 d8 fc ff ff       	jmp    980 <printint>
+ ca8:	66 90                	xchg   %ax,%ax
+ caa:	66 90                	xchg   %ax,%ax
+ cac:	66 90                	xchg   %ax,%ax
+ cae:	66 90                	xchg   %ax,%ax
+
+00000cb0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ cb0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cb1:	a1 a4 12 00 00       	mov    0x12a4,%eax
+{
+ cb6:	89 e5                	mov    %esp,%ebp
+ cb8:	57                   	push   %edi
+ cb9:	56                   	push   %esi
+ cba:	53                   	push   %ebx
+ cbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ cbe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cc8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ccc:	39 ca                	cmp    %ecx,%edx
+ cce:	73 30                	jae    d00 <free+0x50>
+ cd0:	39 c1                	cmp    %eax,%ecx
+ cd2:	72 04                	jb     cd8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cd4:	39 c2                	cmp    %eax,%edx
+ cd6:	72 f0                	jb     cc8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ cd8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ cdb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cde:	39 f8                	cmp    %edi,%eax
+ ce0:	74 2e                	je     d10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ce2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ ce5:	8b 42 04             	mov    0x4(%edx),%eax
+ ce8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ceb:	39 f1                	cmp    %esi,%ecx
+ ced:	74 38                	je     d27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cf1:	5b                   	pop    %ebx
+  freep = p;
+ cf2:	89 15 a4 12 00 00    	mov    %edx,0x12a4
+}
+ cf8:	5e                   	pop    %esi
+ cf9:	5f                   	pop    %edi
+ cfa:	5d                   	pop    %ebp
+ cfb:	c3                   	ret
+ cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d00:	39 c1                	cmp    %eax,%ecx
+ d02:	72 d0                	jb     cd4 <free+0x24>
+ d04:	eb c2                	jmp    cc8 <free+0x18>
+ d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d10:	03 70 04             	add    0x4(%eax),%esi
+ d13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d16:	8b 02                	mov    (%edx),%eax
+ d18:	8b 00                	mov    (%eax),%eax
+ d1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d1d:	8b 42 04             	mov    0x4(%edx),%eax
+ d20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d23:	39 f1                	cmp    %esi,%ecx
+ d25:	75 c8                	jne    cef <free+0x3f>
+    p->s.size += bp->s.size;
+ d27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d2a:	89 15 a4 12 00 00    	mov    %edx,0x12a4
+    p->s.size += bp->s.size;
+ d30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d36:	89 0a                	mov    %ecx,(%edx)
+}
+ d38:	5b                   	pop    %ebx
+ d39:	5e                   	pop    %esi
+ d3a:	5f                   	pop    %edi
+ d3b:	5d                   	pop    %ebp
+ d3c:	c3                   	ret
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d40 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+ d40:	55                   	push   %ebp
+ d41:	89 e5                	mov    %esp,%ebp
+ d43:	57                   	push   %edi
+ d44:	56                   	push   %esi
+ d45:	53                   	push   %ebx
+ d46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d4c:	8b 15 a4 12 00 00    	mov    0x12a4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d52:	8d 78 07             	lea    0x7(%eax),%edi
+ d55:	c1 ef 03             	shr    $0x3,%edi
+ d58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d5b:	85 d2                	test   %edx,%edx
+ d5d:	0f 84 8d 00 00 00    	je     df0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d65:	8b 48 04             	mov    0x4(%eax),%ecx
+ d68:	39 f9                	cmp    %edi,%ecx
+ d6a:	73 64                	jae    dd0 <malloc+0x90>
+  if(nu < 4096)
+ d6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d71:	39 df                	cmp    %ebx,%edi
+ d73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d7d:	eb 0a                	jmp    d89 <malloc+0x49>
+ d7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d82:	8b 48 04             	mov    0x4(%eax),%ecx
+ d85:	39 f9                	cmp    %edi,%ecx
+ d87:	73 47                	jae    dd0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d89:	89 c2                	mov    %eax,%edx
+ d8b:	39 05 a4 12 00 00    	cmp    %eax,0x12a4
+ d91:	75 ed                	jne    d80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d93:	83 ec 0c             	sub    $0xc,%esp
+ d96:	56                   	push   %esi
+ d97:	e8 2f fb ff ff       	call   8cb <sbrk>
+  if(p == (char*)-1)
+ d9c:	83 c4 10             	add    $0x10,%esp
+ d9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ da2:	74 1c                	je     dc0 <malloc+0x80>
+  hp->s.size = nu;
+ da4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ da7:	83 ec 0c             	sub    $0xc,%esp
+ daa:	83 c0 08             	add    $0x8,%eax
+ dad:	50                   	push   %eax
+ dae:	e8 fd fe ff ff       	call   cb0 <free>
+  return freep;
+ db3:	8b 15 a4 12 00 00    	mov    0x12a4,%edx
+      if((p = morecore(nunits)) == 0)
+ db9:	83 c4 10             	add    $0x10,%esp
+ dbc:	85 d2                	test   %edx,%edx
+ dbe:	75 c0                	jne    d80 <malloc+0x40>
+        return 0;
+  }
+}
+ dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ dc3:	31 c0                	xor    %eax,%eax
+}
+ dc5:	5b                   	pop    %ebx
+ dc6:	5e                   	pop    %esi
+ dc7:	5f                   	pop    %edi
+ dc8:	5d                   	pop    %ebp
+ dc9:	c3                   	ret
+ dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ dd0:	39 cf                	cmp    %ecx,%edi
+ dd2:	74 4c                	je     e20 <malloc+0xe0>
+        p->s.size -= nunits;
+ dd4:	29 f9                	sub    %edi,%ecx
+ dd6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ dd9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ ddc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ ddf:	89 15 a4 12 00 00    	mov    %edx,0x12a4
+}
+ de5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ de8:	83 c0 08             	add    $0x8,%eax
+}
+ deb:	5b                   	pop    %ebx
+ dec:	5e                   	pop    %esi
+ ded:	5f                   	pop    %edi
+ dee:	5d                   	pop    %ebp
+ def:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ df0:	c7 05 a4 12 00 00 a8 	movl   $0x12a8,0x12a4
+ df7:	12 00 00 
+    base.s.size = 0;
+ dfa:	b8 a8 12 00 00       	mov    $0x12a8,%eax
+    base.s.ptr = freep = prevp = &base;
+ dff:	c7 05 a8 12 00 00 a8 	movl   $0x12a8,0x12a8
+ e06:	12 00 00 
+    base.s.size = 0;
+ e09:	c7 05 ac 12 00 00 00 	movl   $0x0,0x12ac
+ e10:	00 00 00 
+    if(p->s.size >= nunits){
+ e13:	e9 54 ff ff ff       	jmp    d6c <malloc+0x2c>
+ e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e20:	8b 08                	mov    (%eax),%ecx
+ e22:	89 0a                	mov    %ecx,(%edx)
+ e24:	eb b9                	jmp    ddf <malloc+0x9f>
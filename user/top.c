@@ -0,0 +1,135 @@
+#include "kernel/types.h"
+#include "kernel/date.h"
+#include "kernel/procinfo.h"
+#include "user.h"
+
+#define MAXCPU   8
+#define INTERVAL 100  // Clock ticks between updates (one second)
+
+static char *states[] = {
+  [PI_UNUSED]   "unused",
+  [PI_EMBRYO]   "embryo",
+  [PI_SLEEPING] "sleep",
+  [PI_RUNNABLE] "runble",
+  [PI_RUNNING]  "run",
+  [PI_ZOMBIE]   "zombie"
+};
+
+struct sample {
+  struct procinfo *pi;
+  int nproc;
+  struct cpuinfo ci[MAXCPU];
+  int ncpu;
+  uint ms;                 // Time the sample was taken
+};
+
+static uint
+msnow(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static int
+take(struct sample *s, int maxproc) {
+  s->ms = msnow();
+  if((s->nproc = procinfo(s->pi, maxproc)) < 0 ||
+     (s->ncpu = cpuinfo(s->ci, MAXCPU)) < 0)
+    return -1;
+  return 0;
+}
+
+/* CPU time used by process pi since sample s, in ms */
+static uint
+used(struct sample *s, struct procinfo *pi) {
+  int i;
+
+  for(i = 0; i < s->nproc; ++i)
+    if(s->pi[i].pid == pi->pid)
+      return pi->utime + pi->stime - s->pi[i].utime - s->pi[i].stime;
+  return pi->utime + pi->stime;
+}
+
+static void
+show(struct sample *prev, struct sample *cur) {
+  uint du, ds, di, total, ms, d[cur->nproc];
+  int i, j, order[cur->nproc];
+
+  ms = cur->ms - prev->ms;
+  if(ms == 0)
+    ms = 1;
+
+  /* One line per CPU */
+  for(i = 0; i < cur->ncpu && i < prev->ncpu; ++i) {
+    du = cur->ci[i].utime - prev->ci[i].utime;
+    ds = cur->ci[i].stime - prev->ci[i].stime;
+    di = cur->ci[i].idle - prev->ci[i].idle;
+    if((total = du + ds + di) == 0)
+      total = 1;
+    printf(1, "cpu%d:", cur->ci[i].cpu);
+    padd(1, du * 100 / total, 4);
+    printf(1, "%% user");
+    padd(1, ds * 100 / total, 4);
+    printf(1, "%% sys");
+    padd(1, di * 100 / total, 4);
+    printf(1, "%% idle  pid %d\n", cur->ci[i].pid);
+  }
+
+  /* Processes, busiest first */
+  for(i = 0; i < cur->nproc; ++i) {
+    d[i] = used(prev, &cur->pi[i]);
+    for(j = i; j > 0 && d[order[j-1]] < d[i]; --j)
+      order[j] = order[j-1];
+    order[j] = i;
+  }
+  printf(1, "\n  PID  PPID STATE  CPU %%CPU  USER(ms)   SYS(ms) NAME\n");
+  for(i = 0; i < cur->nproc; ++i) {
+    struct procinfo *pi = &cur->pi[order[i]];
+
+    padd(1, pi->pid, 5);
+    padd(1, pi->ppid, 6);
+    printf(1, " ");
+    pads(1, pi->state >= 0 && pi->state <= PI_ZOMBIE ? states[pi->state] : "???", 6);
+    if(pi->cpu < 0)
+      printf(1, "    -");
+    else
+      padd(1, pi->cpu, 5);
+    padd(1, d[order[i]] * 100 / ms, 5);
+    padd(1, pi->utime, 10);
+    padd(1, pi->stime, 10);
+    printf(1, " %s\n", pi->name);
+  }
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[]) {
+  struct sample s[2];
+  int maxproc, count, i;
+
+  count = argc > 1 ? atoi(argv[1]) : 5;
+  if(count <= 0) {
+    printf(2, "usage: top [updates]\n");
+    exit(1);
+  }
+
+  /* Room for every process the kernel allows */
+  maxproc = proclimit(0);
+  s[0].pi = malloc(maxproc * sizeof(struct procinfo));
+  s[1].pi = malloc(maxproc * sizeof(struct procinfo));
+  if(s[0].pi == 0 || s[1].pi == 0 || take(&s[0], maxproc) < 0) {
+    printf(2, "top: cannot read process information\n");
+    exit(1);
+  }
+
+  for(i = 0; i < count; ++i) {
+    sleep(INTERVAL);
+    if(take(&s[(i+1) % 2], maxproc) < 0) {
+      printf(2, "top: cannot read process information\n");
+      exit(1);
+    }
+    show(&s[i % 2], &s[(i+1) % 2]);
+  }
+  exit(0);
+}
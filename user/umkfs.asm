@@ -0,0 +1,2328 @@
+
+_umkfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+}
+
+uint stdout = 1, stderr = 2;
+
+int
+main(int argc, char *argv[]) {
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	81 ec 58 02 00 00    	sub    $0x258,%esp
+    struct dinode din;
+
+    static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
+
+    /* Make sure user passsed in disk node name argument */
+    if(argc < 2){
+      17:	83 39 01             	cmpl   $0x1,(%ecx)
+main(int argc, char *argv[]) {
+      1a:	8b 41 04             	mov    0x4(%ecx),%eax
+    if(argc < 2){
+      1d:	0f 8e cd 01 00 00    	jle    1f0 <main+0x1f0>
+        printf(stderr, "Usage: umkfs [disk_node]\n");
+        exit(1);
+    }
+
+    /* Open Disk Node */
+    fsfd = open(argv[1], O_RDWR);
+      23:	52                   	push   %edx
+      24:	52                   	push   %edx
+      25:	6a 02                	push   $0x2
+      27:	ff 70 04             	push   0x4(%eax)
+      2a:	e8 14 0b 00 00       	call   b43 <open>
+    if(fsfd < 0){
+      2f:	83 c4 10             	add    $0x10,%esp
+    fsfd = open(argv[1], O_RDWR);
+      32:	a3 5c 19 00 00       	mov    %eax,0x195c
+    if(fsfd < 0){
+      37:	85 c0                	test   %eax,%eax
+      39:	0f 88 93 01 00 00    	js     1d2 <main+0x1d2>
+      printf(stderr, "Open Error");
+      exit(1);
+    }
+
+    /* 1 fs block = 1 disk sector */
+    nmeta = 2 + nlog + ninodeblocks + nbitmap;
+      3f:	8b 0d fc 16 00 00    	mov    0x16fc,%ecx
+    nblocks = FSSIZE - nmeta;
+      45:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+    sb.nlog = xint(nlog);
+    sb.logstart = xint(2);
+    sb.inodestart = xint(2+nlog);
+    sb.bmapstart = xint(2+nlog+ninodeblocks);
+
+    printf(stdout, "nmeta %d (boot, super, log blocks %d inode blocks %d, bitmap blocks %d) blocks %d total %d\n",
+      4a:	68 e8 03 00 00       	push   $0x3e8
+    nmeta = 2 + nlog + ninodeblocks + nbitmap;
+      4f:	8b 35 00 17 00 00    	mov    0x1700,%esi
+      55:	8b 1d 04 17 00 00    	mov    0x1704,%ebx
+    sb.size = xint(FSSIZE);
+      5b:	c7 05 40 19 00 00 e8 	movl   $0x3e8,0x1940
+      62:	03 00 00 
+    nmeta = 2 + nlog + ninodeblocks + nbitmap;
+      65:	8d 79 02             	lea    0x2(%ecx),%edi
+    sb.ninodes = xint(NINODES);
+      68:	c7 05 48 19 00 00 c8 	movl   $0xc8,0x1948
+      6f:	00 00 00 
+    nmeta = 2 + nlog + ninodeblocks + nbitmap;
+      72:	01 fe                	add    %edi,%esi
+    sb.nlog = xint(nlog);
+      74:	89 0d 4c 19 00 00    	mov    %ecx,0x194c
+    nmeta = 2 + nlog + ninodeblocks + nbitmap;
+      7a:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+    sb.inodestart = xint(2+nlog);
+      7d:	89 3d 54 19 00 00    	mov    %edi,0x1954
+    nblocks = FSSIZE - nmeta;
+      83:	29 d0                	sub    %edx,%eax
+    nmeta = 2 + nlog + ninodeblocks + nbitmap;
+      85:	89 15 64 19 00 00    	mov    %edx,0x1964
+    printf(stdout, "nmeta %d (boot, super, log blocks %d inode blocks %d, bitmap blocks %d) blocks %d total %d\n",
+      8b:	50                   	push   %eax
+      8c:	53                   	push   %ebx
+
+    /* The first free block that we can allocate */
+    freeblock = nmeta;     
+
+    /* Zero out all FS blocks */
+    for(uint i = 0; i < FSSIZE; i++)
+      8d:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "nmeta %d (boot, super, log blocks %d inode blocks %d, bitmap blocks %d) blocks %d total %d\n",
+      8f:	ff 35 00 17 00 00    	push   0x1700
+      95:	51                   	push   %ecx
+      96:	52                   	push   %edx
+      97:	68 84 11 00 00       	push   $0x1184
+      9c:	ff 35 f4 16 00 00    	push   0x16f4
+    nblocks = FSSIZE - nmeta;
+      a2:	a3 60 19 00 00       	mov    %eax,0x1960
+    sb.nblocks = xint(nblocks);
+      a7:	a3 44 19 00 00       	mov    %eax,0x1944
+    sb.logstart = xint(2);
+      ac:	c7 05 50 19 00 00 02 	movl   $0x2,0x1950
+      b3:	00 00 00 
+    sb.bmapstart = xint(2+nlog+ninodeblocks);
+      b6:	89 35 58 19 00 00    	mov    %esi,0x1958
+    printf(stdout, "nmeta %d (boot, super, log blocks %d inode blocks %d, bitmap blocks %d) blocks %d total %d\n",
+      bc:	e8 1f 0c 00 00       	call   ce0 <printf>
+    freeblock = nmeta;     
+      c1:	a1 64 19 00 00       	mov    0x1964,%eax
+      c6:	83 c4 20             	add    $0x20,%esp
+      c9:	a3 20 17 00 00       	mov    %eax,0x1720
+    for(uint i = 0; i < FSSIZE; i++)
+      ce:	66 90                	xchg   %ax,%ax
+    wsect(i, zeroes);
+      d0:	83 ec 08             	sub    $0x8,%esp
+      d3:	68 40 17 00 00       	push   $0x1740
+      d8:	53                   	push   %ebx
+    for(uint i = 0; i < FSSIZE; i++)
+      d9:	83 c3 01             	add    $0x1,%ebx
+    wsect(i, zeroes);
+      dc:	e8 8f 01 00 00       	call   270 <wsect>
+    for(uint i = 0; i < FSSIZE; i++)
+      e1:	83 c4 10             	add    $0x10,%esp
+      e4:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+      ea:	75 e4                	jne    d0 <main+0xd0>
+
+    /* Write the Super Block to the first block in Disk */
+    memset(buf, 0, sizeof(buf)); 
+      ec:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+      f2:	50                   	push   %eax
+    exit(0);
+}
+
+void 
+bzero(void *s, int n) {
+  memset(s, 0, n);
+      f3:	8d b5 98 fd ff ff    	lea    -0x268(%ebp),%esi
+    memset(buf, 0, sizeof(buf)); 
+      f9:	68 00 02 00 00       	push   $0x200
+      fe:	6a 00                	push   $0x0
+     100:	53                   	push   %ebx
+     101:	e8 7a 08 00 00       	call   980 <memset>
+    memmove(buf, &sb, sizeof(sb));
+     106:	83 c4 0c             	add    $0xc,%esp
+     109:	6a 1c                	push   $0x1c
+     10b:	68 40 19 00 00       	push   $0x1940
+     110:	53                   	push   %ebx
+     111:	e8 ba 09 00 00       	call   ad0 <memmove>
+    wsect(1, buf);
+     116:	5a                   	pop    %edx
+     117:	59                   	pop    %ecx
+     118:	53                   	push   %ebx
+     119:	6a 01                	push   $0x1
+     11b:	e8 50 01 00 00       	call   270 <wsect>
+    rootino = ialloc(T_DIR);
+     120:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     127:	e8 d4 03 00 00       	call   500 <ialloc>
+  memset(s, 0, n);
+     12c:	83 c4 0c             	add    $0xc,%esp
+     12f:	6a 10                	push   $0x10
+    rootino = ialloc(T_DIR);
+     131:	89 c3                	mov    %eax,%ebx
+  memset(s, 0, n);
+     133:	6a 00                	push   $0x0
+     135:	56                   	push   %esi
+     136:	e8 45 08 00 00       	call   980 <memset>
+    de.inum = xshort(rootino);
+     13b:	66 89 9d 98 fd ff ff 	mov    %bx,-0x268(%ebp)
+    strcpy(de.name, ".");
+     142:	5f                   	pop    %edi
+     143:	8d bd 9a fd ff ff    	lea    -0x266(%ebp),%edi
+     149:	58                   	pop    %eax
+     14a:	68 26 11 00 00       	push   $0x1126
+     14f:	57                   	push   %edi
+     150:	e8 6b 07 00 00       	call   8c0 <strcpy>
+    iappend(rootino, &de, sizeof(de));
+     155:	83 c4 0c             	add    $0xc,%esp
+     158:	6a 10                	push   $0x10
+     15a:	56                   	push   %esi
+     15b:	53                   	push   %ebx
+     15c:	e8 8f 04 00 00       	call   5f0 <iappend>
+  memset(s, 0, n);
+     161:	83 c4 0c             	add    $0xc,%esp
+     164:	6a 10                	push   $0x10
+     166:	6a 00                	push   $0x0
+     168:	56                   	push   %esi
+     169:	e8 12 08 00 00       	call   980 <memset>
+    de.inum = xshort(rootino);
+     16e:	66 89 9d 98 fd ff ff 	mov    %bx,-0x268(%ebp)
+    strcpy(de.name, "..");
+     175:	58                   	pop    %eax
+     176:	5a                   	pop    %edx
+     177:	68 25 11 00 00       	push   $0x1125
+     17c:	57                   	push   %edi
+     17d:	e8 3e 07 00 00       	call   8c0 <strcpy>
+    iappend(rootino, &de, sizeof(de));
+     182:	83 c4 0c             	add    $0xc,%esp
+     185:	6a 10                	push   $0x10
+     187:	56                   	push   %esi
+     188:	53                   	push   %ebx
+     189:	e8 62 04 00 00       	call   5f0 <iappend>
+    rinode(rootino, &din);
+     18e:	59                   	pop    %ecx
+     18f:	5e                   	pop    %esi
+     190:	8d b5 a8 fd ff ff    	lea    -0x258(%ebp),%esi
+     196:	56                   	push   %esi
+     197:	53                   	push   %ebx
+     198:	e8 b3 02 00 00       	call   450 <rinode>
+    off = ((off/BSIZE) + 1) * BSIZE;
+     19d:	8b 85 b0 fd ff ff    	mov    -0x250(%ebp),%eax
+     1a3:	25 00 fe ff ff       	and    $0xfffffe00,%eax
+    a[3] = x >> 24;
+     1a8:	05 00 02 00 00       	add    $0x200,%eax
+    din.size = xint(off);
+     1ad:	89 85 b0 fd ff ff    	mov    %eax,-0x250(%ebp)
+    winode(rootino, &din);
+     1b3:	5f                   	pop    %edi
+     1b4:	58                   	pop    %eax
+     1b5:	56                   	push   %esi
+     1b6:	53                   	push   %ebx
+     1b7:	e8 d4 01 00 00       	call   390 <winode>
+    balloc(freeblock);
+     1bc:	58                   	pop    %eax
+     1bd:	ff 35 20 17 00 00    	push   0x1720
+     1c3:	e8 88 03 00 00       	call   550 <balloc>
+    exit(0);
+     1c8:	31 c0                	xor    %eax,%eax
+     1ca:	89 04 24             	mov    %eax,(%esp)
+     1cd:	e8 31 09 00 00       	call   b03 <exit>
+      printf(stderr, "Open Error");
+     1d2:	50                   	push   %eax
+     1d3:	50                   	push   %eax
+     1d4:	68 1a 11 00 00       	push   $0x111a
+     1d9:	ff 35 f0 16 00 00    	push   0x16f0
+     1df:	e8 fc 0a 00 00       	call   ce0 <printf>
+      exit(1);
+     1e4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     1eb:	e8 13 09 00 00       	call   b03 <exit>
+        printf(stderr, "Usage: umkfs [disk_node]\n");
+     1f0:	51                   	push   %ecx
+     1f1:	51                   	push   %ecx
+     1f2:	68 00 11 00 00       	push   $0x1100
+     1f7:	ff 35 f0 16 00 00    	push   0x16f0
+     1fd:	e8 de 0a 00 00       	call   ce0 <printf>
+        exit(1);
+     202:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     209:	e8 f5 08 00 00       	call   b03 <exit>
+     20e:	66 90                	xchg   %ax,%ax
+
+00000210 <xshort>:
+xshort(ushort x) {
+     210:	55                   	push   %ebp
+     211:	89 e5                	mov    %esp,%ebp
+}
+     213:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+     217:	5d                   	pop    %ebp
+     218:	c3                   	ret
+     219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <xint>:
+xint(uint x) {
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+}
+     223:	8b 45 08             	mov    0x8(%ebp),%eax
+     226:	5d                   	pop    %ebp
+     227:	c3                   	ret
+     228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22f:	90                   	nop
+
+00000230 <bzero>:
+bzero(void *s, int n) {
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	83 ec 0c             	sub    $0xc,%esp
+  memset(s, 0, n);
+     236:	ff 75 0c             	push   0xc(%ebp)
+     239:	6a 00                	push   $0x0
+     23b:	ff 75 08             	push   0x8(%ebp)
+     23e:	e8 3d 07 00 00       	call   980 <memset>
+}
+     243:	83 c4 10             	add    $0x10,%esp
+     246:	c9                   	leave
+     247:	c3                   	ret
+     248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     24f:	90                   	nop
+
+00000250 <bcopy>:
+
+void
+bcopy(void *src, void *dst, int n) {
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	8b 45 0c             	mov    0xc(%ebp),%eax
+  memmove(dst, src, n);
+     256:	8b 55 08             	mov    0x8(%ebp),%edx
+     259:	89 45 08             	mov    %eax,0x8(%ebp)
+     25c:	89 55 0c             	mov    %edx,0xc(%ebp)
+}
+     25f:	5d                   	pop    %ebp
+  memmove(dst, src, n);
+     260:	e9 6b 08 00 00       	jmp    ad0 <memmove>
+     265:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <wsect>:
+
+void
+wsect(uint sec, void *buf) {
+     270:	55                   	push   %ebp
+     271:	89 e5                	mov    %esp,%ebp
+     273:	53                   	push   %ebx
+     274:	83 ec 08             	sub    $0x8,%esp
+  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+     277:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     27a:	6a 00                	push   $0x0
+     27c:	c1 e3 09             	shl    $0x9,%ebx
+     27f:	53                   	push   %ebx
+     280:	ff 35 5c 19 00 00    	push   0x195c
+     286:	e8 38 09 00 00       	call   bc3 <lseek>
+     28b:	83 c4 10             	add    $0x10,%esp
+     28e:	39 c3                	cmp    %eax,%ebx
+     290:	75 25                	jne    2b7 <wsect+0x47>
+    printf(stderr, "lseek Error");
+    exit(1);
+  }
+  if(write(fsfd, buf, BSIZE) != BSIZE){
+     292:	83 ec 04             	sub    $0x4,%esp
+     295:	68 00 02 00 00       	push   $0x200
+     29a:	ff 75 0c             	push   0xc(%ebp)
+     29d:	ff 35 5c 19 00 00    	push   0x195c
+     2a3:	e8 7b 08 00 00       	call   b23 <write>
+     2a8:	83 c4 10             	add    $0x10,%esp
+     2ab:	3d 00 02 00 00       	cmp    $0x200,%eax
+     2b0:	75 23                	jne    2d5 <wsect+0x65>
+    printf(stderr, "Write Error");
+    exit(1);
+  }
+}
+     2b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2b5:	c9                   	leave
+     2b6:	c3                   	ret
+    printf(stderr, "lseek Error");
+     2b7:	52                   	push   %edx
+     2b8:	52                   	push   %edx
+     2b9:	68 e8 10 00 00       	push   $0x10e8
+     2be:	ff 35 f0 16 00 00    	push   0x16f0
+     2c4:	e8 17 0a 00 00       	call   ce0 <printf>
+    exit(1);
+     2c9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     2d0:	e8 2e 08 00 00       	call   b03 <exit>
+    printf(stderr, "Write Error");
+     2d5:	50                   	push   %eax
+     2d6:	50                   	push   %eax
+     2d7:	68 f4 10 00 00       	push   $0x10f4
+     2dc:	ff 35 f0 16 00 00    	push   0x16f0
+     2e2:	e8 f9 09 00 00       	call   ce0 <printf>
+    exit(1);
+     2e7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     2ee:	e8 10 08 00 00       	call   b03 <exit>
+     2f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000300 <rsect>:
+  dip = ((struct dinode*)buf) + (inum % IPB);
+  *ip = *dip;
+}
+
+void
+rsect(uint sec, void *buf) {
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	53                   	push   %ebx
+     304:	83 ec 08             	sub    $0x8,%esp
+  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+     307:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     30a:	6a 00                	push   $0x0
+     30c:	c1 e3 09             	shl    $0x9,%ebx
+     30f:	53                   	push   %ebx
+     310:	ff 35 5c 19 00 00    	push   0x195c
+     316:	e8 a8 08 00 00       	call   bc3 <lseek>
+     31b:	83 c4 10             	add    $0x10,%esp
+     31e:	39 c3                	cmp    %eax,%ebx
+     320:	75 25                	jne    347 <rsect+0x47>
+    printf(stderr, "lseek Error");
+    exit(1);
+  }
+  if(read(fsfd, buf, BSIZE) != BSIZE){
+     322:	83 ec 04             	sub    $0x4,%esp
+     325:	68 00 02 00 00       	push   $0x200
+     32a:	ff 75 0c             	push   0xc(%ebp)
+     32d:	ff 35 5c 19 00 00    	push   0x195c
+     333:	e8 e3 07 00 00       	call   b1b <read>
+     338:	83 c4 10             	add    $0x10,%esp
+     33b:	3d 00 02 00 00       	cmp    $0x200,%eax
+     340:	75 23                	jne    365 <rsect+0x65>
+    printf(stderr, "Write Error");
+    exit(1);
+  }
+}
+     342:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     345:	c9                   	leave
+     346:	c3                   	ret
+    printf(stderr, "lseek Error");
+     347:	52                   	push   %edx
+     348:	52                   	push   %edx
+     349:	68 e8 10 00 00       	push   $0x10e8
+     34e:	ff 35 f0 16 00 00    	push   0x16f0
+     354:	e8 87 09 00 00       	call   ce0 <printf>
+    exit(1);
+     359:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     360:	e8 9e 07 00 00       	call   b03 <exit>
+    printf(stderr, "Write Error");
+     365:	50                   	push   %eax
+     366:	50                   	push   %eax
+     367:	68 f4 10 00 00       	push   $0x10f4
+     36c:	ff 35 f0 16 00 00    	push   0x16f0
+     372:	e8 69 09 00 00       	call   ce0 <printf>
+    exit(1);
+     377:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     37e:	e8 80 07 00 00       	call   b03 <exit>
+     383:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000390 <winode>:
+winode(uint inum, struct dinode *ip) {
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	57                   	push   %edi
+     394:	56                   	push   %esi
+  rsect(bn, buf);
+     395:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+winode(uint inum, struct dinode *ip) {
+     39b:	53                   	push   %ebx
+     39c:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     3a2:	8b 75 08             	mov    0x8(%ebp),%esi
+     3a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  bn = IBLOCK(inum, sb);
+     3a8:	89 f7                	mov    %esi,%edi
+  dip = ((struct dinode*)buf) + (inum % IPB);
+     3aa:	83 e6 07             	and    $0x7,%esi
+  bn = IBLOCK(inum, sb);
+     3ad:	c1 ef 03             	shr    $0x3,%edi
+     3b0:	03 3d 54 19 00 00    	add    0x1954,%edi
+  rsect(bn, buf);
+     3b6:	52                   	push   %edx
+  *dip = *ip;
+     3b7:	c1 e6 06             	shl    $0x6,%esi
+  rsect(bn, buf);
+     3ba:	57                   	push   %edi
+     3bb:	e8 40 ff ff ff       	call   300 <rsect>
+  *dip = *ip;
+     3c0:	8b 0b                	mov    (%ebx),%ecx
+     3c2:	8d 84 35 e8 fd ff ff 	lea    -0x218(%ebp,%esi,1),%eax
+     3c9:	89 8c 35 e8 fd ff ff 	mov    %ecx,-0x218(%ebp,%esi,1)
+     3d0:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     3d3:	89 48 04             	mov    %ecx,0x4(%eax)
+     3d6:	8b 4b 08             	mov    0x8(%ebx),%ecx
+     3d9:	89 48 08             	mov    %ecx,0x8(%eax)
+     3dc:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+     3df:	89 48 0c             	mov    %ecx,0xc(%eax)
+     3e2:	8b 4b 10             	mov    0x10(%ebx),%ecx
+     3e5:	89 48 10             	mov    %ecx,0x10(%eax)
+     3e8:	8b 4b 14             	mov    0x14(%ebx),%ecx
+     3eb:	89 48 14             	mov    %ecx,0x14(%eax)
+     3ee:	8b 4b 18             	mov    0x18(%ebx),%ecx
+     3f1:	89 48 18             	mov    %ecx,0x18(%eax)
+     3f4:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+     3f7:	89 48 1c             	mov    %ecx,0x1c(%eax)
+     3fa:	8b 4b 20             	mov    0x20(%ebx),%ecx
+     3fd:	89 48 20             	mov    %ecx,0x20(%eax)
+     400:	8b 4b 24             	mov    0x24(%ebx),%ecx
+     403:	89 48 24             	mov    %ecx,0x24(%eax)
+     406:	8b 4b 28             	mov    0x28(%ebx),%ecx
+     409:	89 48 28             	mov    %ecx,0x28(%eax)
+     40c:	8b 4b 2c             	mov    0x2c(%ebx),%ecx
+     40f:	89 48 2c             	mov    %ecx,0x2c(%eax)
+     412:	8b 4b 30             	mov    0x30(%ebx),%ecx
+     415:	89 48 30             	mov    %ecx,0x30(%eax)
+     418:	8b 4b 34             	mov    0x34(%ebx),%ecx
+     41b:	89 48 34             	mov    %ecx,0x34(%eax)
+     41e:	8b 4b 38             	mov    0x38(%ebx),%ecx
+     421:	89 48 38             	mov    %ecx,0x38(%eax)
+     424:	8b 4b 3c             	mov    0x3c(%ebx),%ecx
+     427:	89 48 3c             	mov    %ecx,0x3c(%eax)
+  wsect(bn, buf);
+     42a:	58                   	pop    %eax
+     42b:	5a                   	pop    %edx
+     42c:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+     432:	52                   	push   %edx
+     433:	57                   	push   %edi
+     434:	e8 37 fe ff ff       	call   270 <wsect>
+}
+     439:	83 c4 10             	add    $0x10,%esp
+     43c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     43f:	5b                   	pop    %ebx
+     440:	5e                   	pop    %esi
+     441:	5f                   	pop    %edi
+     442:	5d                   	pop    %ebp
+     443:	c3                   	ret
+     444:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     44f:	90                   	nop
+
+00000450 <rinode>:
+rinode(uint inum, struct dinode *ip) {
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	56                   	push   %esi
+     454:	53                   	push   %ebx
+  rsect(bn, buf);
+     455:	8d 85 f8 fd ff ff    	lea    -0x208(%ebp),%eax
+rinode(uint inum, struct dinode *ip) {
+     45b:	81 ec 08 02 00 00    	sub    $0x208,%esp
+     461:	8b 75 08             	mov    0x8(%ebp),%esi
+     464:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  rsect(bn, buf);
+     467:	50                   	push   %eax
+  bn = IBLOCK(inum, sb);
+     468:	89 f0                	mov    %esi,%eax
+  dip = ((struct dinode*)buf) + (inum % IPB);
+     46a:	83 e6 07             	and    $0x7,%esi
+  bn = IBLOCK(inum, sb);
+     46d:	c1 e8 03             	shr    $0x3,%eax
+     470:	03 05 54 19 00 00    	add    0x1954,%eax
+  *ip = *dip;
+     476:	c1 e6 06             	shl    $0x6,%esi
+  rsect(bn, buf);
+     479:	50                   	push   %eax
+     47a:	e8 81 fe ff ff       	call   300 <rsect>
+  *ip = *dip;
+     47f:	8b 94 35 f8 fd ff ff 	mov    -0x208(%ebp,%esi,1),%edx
+     486:	8d 84 35 f8 fd ff ff 	lea    -0x208(%ebp,%esi,1),%eax
+}
+     48d:	83 c4 10             	add    $0x10,%esp
+  *ip = *dip;
+     490:	89 13                	mov    %edx,(%ebx)
+     492:	8b 50 04             	mov    0x4(%eax),%edx
+     495:	89 53 04             	mov    %edx,0x4(%ebx)
+     498:	8b 50 08             	mov    0x8(%eax),%edx
+     49b:	89 53 08             	mov    %edx,0x8(%ebx)
+     49e:	8b 50 0c             	mov    0xc(%eax),%edx
+     4a1:	89 53 0c             	mov    %edx,0xc(%ebx)
+     4a4:	8b 50 10             	mov    0x10(%eax),%edx
+     4a7:	89 53 10             	mov    %edx,0x10(%ebx)
+     4aa:	8b 50 14             	mov    0x14(%eax),%edx
+     4ad:	89 53 14             	mov    %edx,0x14(%ebx)
+     4b0:	8b 50 18             	mov    0x18(%eax),%edx
+     4b3:	89 53 18             	mov    %edx,0x18(%ebx)
+     4b6:	8b 50 1c             	mov    0x1c(%eax),%edx
+     4b9:	89 53 1c             	mov    %edx,0x1c(%ebx)
+     4bc:	8b 50 20             	mov    0x20(%eax),%edx
+     4bf:	89 53 20             	mov    %edx,0x20(%ebx)
+     4c2:	8b 50 24             	mov    0x24(%eax),%edx
+     4c5:	89 53 24             	mov    %edx,0x24(%ebx)
+     4c8:	8b 50 28             	mov    0x28(%eax),%edx
+     4cb:	89 53 28             	mov    %edx,0x28(%ebx)
+     4ce:	8b 50 2c             	mov    0x2c(%eax),%edx
+     4d1:	89 53 2c             	mov    %edx,0x2c(%ebx)
+     4d4:	8b 50 30             	mov    0x30(%eax),%edx
+     4d7:	89 53 30             	mov    %edx,0x30(%ebx)
+     4da:	8b 50 34             	mov    0x34(%eax),%edx
+     4dd:	89 53 34             	mov    %edx,0x34(%ebx)
+     4e0:	8b 50 38             	mov    0x38(%eax),%edx
+     4e3:	8b 40 3c             	mov    0x3c(%eax),%eax
+     4e6:	89 53 38             	mov    %edx,0x38(%ebx)
+     4e9:	89 43 3c             	mov    %eax,0x3c(%ebx)
+}
+     4ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4ef:	5b                   	pop    %ebx
+     4f0:	5e                   	pop    %esi
+     4f1:	5d                   	pop    %ebp
+     4f2:	c3                   	ret
+     4f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000500 <ialloc>:
+
+uint
+ialloc(ushort type) {
+     500:	55                   	push   %ebp
+     501:	89 e5                	mov    %esp,%ebp
+     503:	57                   	push   %edi
+     504:	56                   	push   %esi
+  memset(s, 0, n);
+     505:	8d 75 a8             	lea    -0x58(%ebp),%esi
+ialloc(ushort type) {
+     508:	53                   	push   %ebx
+     509:	83 ec 50             	sub    $0x50,%esp
+  uint inum = freeinode++;
+     50c:	8b 1d f8 16 00 00    	mov    0x16f8,%ebx
+ialloc(ushort type) {
+     512:	8b 7d 08             	mov    0x8(%ebp),%edi
+  uint inum = freeinode++;
+     515:	8d 43 01             	lea    0x1(%ebx),%eax
+     518:	a3 f8 16 00 00       	mov    %eax,0x16f8
+  memset(s, 0, n);
+     51d:	6a 40                	push   $0x40
+     51f:	6a 00                	push   $0x0
+     521:	56                   	push   %esi
+     522:	e8 59 04 00 00       	call   980 <memset>
+
+  /* Zero the inode struct */
+  bzero(&din, sizeof(din));
+  /* Mark it as allocated */
+  din.type = xshort(type);
+  din.nlink = xshort(1);
+     527:	b8 01 00 00 00       	mov    $0x1,%eax
+  din.type = xshort(type);
+     52c:	66 89 7d a8          	mov    %di,-0x58(%ebp)
+  din.nlink = xshort(1);
+     530:	66 89 45 ae          	mov    %ax,-0x52(%ebp)
+  din.size = xint(0);
+     534:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%ebp)
+  winode(inum, &din);
+     53b:	5a                   	pop    %edx
+     53c:	59                   	pop    %ecx
+     53d:	56                   	push   %esi
+     53e:	53                   	push   %ebx
+     53f:	e8 4c fe ff ff       	call   390 <winode>
+  return inum;
+}
+     544:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     547:	89 d8                	mov    %ebx,%eax
+     549:	5b                   	pop    %ebx
+     54a:	5e                   	pop    %esi
+     54b:	5f                   	pop    %edi
+     54c:	5d                   	pop    %ebp
+     54d:	c3                   	ret
+     54e:	66 90                	xchg   %ax,%ax
+
+00000550 <balloc>:
+
+void
+balloc(int used) {
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	57                   	push   %edi
+     554:	56                   	push   %esi
+     555:	53                   	push   %ebx
+     556:	81 ec 10 02 00 00    	sub    $0x210,%esp
+     55c:	8b 75 08             	mov    0x8(%ebp),%esi
+  uchar buf[BSIZE];
+  int i;
+
+  printf(stdout, "balloc: first %d blocks have been allocated\n", used);
+     55f:	56                   	push   %esi
+     560:	68 28 11 00 00       	push   $0x1128
+     565:	ff 35 f4 16 00 00    	push   0x16f4
+     56b:	e8 70 07 00 00       	call   ce0 <printf>
+  memset(s, 0, n);
+     570:	83 c4 0c             	add    $0xc,%esp
+     573:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     579:	68 00 02 00 00       	push   $0x200
+     57e:	6a 00                	push   $0x0
+     580:	50                   	push   %eax
+     581:	e8 fa 03 00 00       	call   980 <memset>
+  bzero(buf, BSIZE);
+  for(i = 0; i < used; i++){
+     586:	83 c4 10             	add    $0x10,%esp
+     589:	85 f6                	test   %esi,%esi
+     58b:	7e 27                	jle    5b4 <balloc+0x64>
+     58d:	31 c0                	xor    %eax,%eax
+    buf[i/8] = buf[i/8] | (0x1 << (i%8));
+     58f:	bf 01 00 00 00       	mov    $0x1,%edi
+     594:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     598:	89 c2                	mov    %eax,%edx
+     59a:	89 c1                	mov    %eax,%ecx
+     59c:	89 fb                	mov    %edi,%ebx
+  for(i = 0; i < used; i++){
+     59e:	83 c0 01             	add    $0x1,%eax
+    buf[i/8] = buf[i/8] | (0x1 << (i%8));
+     5a1:	c1 fa 03             	sar    $0x3,%edx
+     5a4:	83 e1 07             	and    $0x7,%ecx
+     5a7:	d3 e3                	shl    %cl,%ebx
+     5a9:	08 9c 15 e8 fd ff ff 	or     %bl,-0x218(%ebp,%edx,1)
+  for(i = 0; i < used; i++){
+     5b0:	39 c6                	cmp    %eax,%esi
+     5b2:	75 e4                	jne    598 <balloc+0x48>
+  }
+  printf(stdout, "balloc: write bitmap block at sector %d\n", sb.bmapstart);
+     5b4:	83 ec 04             	sub    $0x4,%esp
+     5b7:	ff 35 58 19 00 00    	push   0x1958
+     5bd:	68 58 11 00 00       	push   $0x1158
+     5c2:	ff 35 f4 16 00 00    	push   0x16f4
+     5c8:	e8 13 07 00 00       	call   ce0 <printf>
+  wsect(sb.bmapstart, buf);
+     5cd:	58                   	pop    %eax
+     5ce:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     5d4:	5a                   	pop    %edx
+     5d5:	50                   	push   %eax
+     5d6:	ff 35 58 19 00 00    	push   0x1958
+     5dc:	e8 8f fc ff ff       	call   270 <wsect>
+}
+     5e1:	83 c4 10             	add    $0x10,%esp
+     5e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5e7:	5b                   	pop    %ebx
+     5e8:	5e                   	pop    %esi
+     5e9:	5f                   	pop    %edi
+     5ea:	5d                   	pop    %ebp
+     5eb:	c3                   	ret
+     5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <iappend>:
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+
+void
+iappend(uint inum, void *xp, int n) {
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+     5f3:	57                   	push   %edi
+     5f4:	56                   	push   %esi
+  rsect(bn, buf);
+     5f5:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+iappend(uint inum, void *xp, int n) {
+     5fb:	53                   	push   %ebx
+     5fc:	81 ec 64 04 00 00    	sub    $0x464,%esp
+     602:	8b 75 08             	mov    0x8(%ebp),%esi
+  rsect(bn, buf);
+     605:	50                   	push   %eax
+  bn = IBLOCK(inum, sb);
+     606:	89 f0                	mov    %esi,%eax
+     608:	c1 e8 03             	shr    $0x3,%eax
+     60b:	03 05 54 19 00 00    	add    0x1954,%eax
+  rsect(bn, buf);
+     611:	50                   	push   %eax
+     612:	e8 e9 fc ff ff       	call   300 <rsect>
+  dip = ((struct dinode*)buf) + (inum % IPB);
+     617:	89 f2                	mov    %esi,%edx
+  uint indirect[NINDIRECT];
+  uint x;
+
+  rinode(inum, &din);
+  off = xint(din.size);
+  while(n > 0){
+     619:	83 c4 10             	add    $0x10,%esp
+  dip = ((struct dinode*)buf) + (inum % IPB);
+     61c:	83 e2 07             	and    $0x7,%edx
+  *ip = *dip;
+     61f:	c1 e2 06             	shl    $0x6,%edx
+     622:	8d 84 15 e8 fd ff ff 	lea    -0x218(%ebp,%edx,1),%eax
+     629:	8b 94 15 e8 fd ff ff 	mov    -0x218(%ebp,%edx,1),%edx
+     630:	8b 48 0c             	mov    0xc(%eax),%ecx
+     633:	89 95 a8 fb ff ff    	mov    %edx,-0x458(%ebp)
+     639:	8b 50 04             	mov    0x4(%eax),%edx
+     63c:	89 8d b4 fb ff ff    	mov    %ecx,-0x44c(%ebp)
+     642:	8b 48 10             	mov    0x10(%eax),%ecx
+     645:	89 95 ac fb ff ff    	mov    %edx,-0x454(%ebp)
+     64b:	8b 50 08             	mov    0x8(%eax),%edx
+     64e:	89 8d b8 fb ff ff    	mov    %ecx,-0x448(%ebp)
+     654:	8b 48 14             	mov    0x14(%eax),%ecx
+     657:	89 95 b0 fb ff ff    	mov    %edx,-0x450(%ebp)
+    a[0] = x;
+     65d:	89 d7                	mov    %edx,%edi
+  *ip = *dip;
+     65f:	89 8d bc fb ff ff    	mov    %ecx,-0x444(%ebp)
+     665:	8b 48 18             	mov    0x18(%eax),%ecx
+     668:	89 8d c0 fb ff ff    	mov    %ecx,-0x440(%ebp)
+     66e:	8b 48 1c             	mov    0x1c(%eax),%ecx
+     671:	89 8d c4 fb ff ff    	mov    %ecx,-0x43c(%ebp)
+     677:	8b 48 20             	mov    0x20(%eax),%ecx
+     67a:	89 8d c8 fb ff ff    	mov    %ecx,-0x438(%ebp)
+     680:	8b 48 24             	mov    0x24(%eax),%ecx
+     683:	89 8d cc fb ff ff    	mov    %ecx,-0x434(%ebp)
+     689:	8b 48 28             	mov    0x28(%eax),%ecx
+     68c:	89 8d d0 fb ff ff    	mov    %ecx,-0x430(%ebp)
+     692:	8b 48 2c             	mov    0x2c(%eax),%ecx
+     695:	89 8d d4 fb ff ff    	mov    %ecx,-0x42c(%ebp)
+     69b:	8b 48 30             	mov    0x30(%eax),%ecx
+     69e:	89 8d d8 fb ff ff    	mov    %ecx,-0x428(%ebp)
+     6a4:	8b 48 34             	mov    0x34(%eax),%ecx
+     6a7:	89 8d dc fb ff ff    	mov    %ecx,-0x424(%ebp)
+     6ad:	8b 48 38             	mov    0x38(%eax),%ecx
+     6b0:	8b 40 3c             	mov    0x3c(%eax),%eax
+     6b3:	89 8d e0 fb ff ff    	mov    %ecx,-0x420(%ebp)
+     6b9:	89 85 e4 fb ff ff    	mov    %eax,-0x41c(%ebp)
+  while(n > 0){
+     6bf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     6c2:	85 c9                	test   %ecx,%ecx
+     6c4:	0f 8e d1 01 00 00    	jle    89b <iappend+0x2ab>
+      x = xint(din.addrs[fbn]);
+    } else {
+      if(xint(din.addrs[NDIRECT]) == 0){
+        din.addrs[NDIRECT] = xint(freeblock++);
+      }
+      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+     6ca:	89 75 08             	mov    %esi,0x8(%ebp)
+     6cd:	e9 d8 00 00 00       	jmp    7aa <iappend+0x1ba>
+     6d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(xint(din.addrs[fbn]) == 0){
+     6d8:	8b 94 85 b4 fb ff ff 	mov    -0x44c(%ebp,%eax,4),%edx
+    a[2] = x >> 16;
+     6df:	89 d1                	mov    %edx,%ecx
+    a[0] = x;
+     6e1:	89 d6                	mov    %edx,%esi
+    a[1] = x >> 8;
+     6e3:	0f b6 de             	movzbl %dh,%ebx
+    a[3] = x >> 24;
+     6e6:	c1 ea 18             	shr    $0x18,%edx
+     6e9:	89 95 a0 fb ff ff    	mov    %edx,-0x460(%ebp)
+      if(xint(din.addrs[fbn]) == 0){
+     6ef:	8b 94 85 b4 fb ff ff 	mov    -0x44c(%ebp,%eax,4),%edx
+    a[2] = x >> 16;
+     6f6:	c1 e9 10             	shr    $0x10,%ecx
+      if(xint(din.addrs[fbn]) == 0){
+     6f9:	85 d2                	test   %edx,%edx
+     6fb:	75 27                	jne    724 <iappend+0x134>
+        din.addrs[fbn] = xint(freeblock++);
+     6fd:	8b 15 20 17 00 00    	mov    0x1720,%edx
+     703:	83 05 20 17 00 00 01 	addl   $0x1,0x1720
+    a[2] = x >> 16;
+     70a:	89 d1                	mov    %edx,%ecx
+        din.addrs[fbn] = xint(freeblock++);
+     70c:	89 94 85 b4 fb ff ff 	mov    %edx,-0x44c(%ebp,%eax,4)
+    a[0] = x;
+     713:	89 d6                	mov    %edx,%esi
+    a[1] = x >> 8;
+     715:	0f b6 de             	movzbl %dh,%ebx
+    a[3] = x >> 24;
+     718:	c1 ea 18             	shr    $0x18,%edx
+    a[2] = x >> 16;
+     71b:	c1 e9 10             	shr    $0x10,%ecx
+    a[3] = x >> 24;
+     71e:	89 95 a0 fb ff ff    	mov    %edx,-0x460(%ebp)
+    a[0] = x;
+     724:	89 f2                	mov    %esi,%edx
+     726:	31 c0                	xor    %eax,%eax
+     728:	0f b6 c9             	movzbl %cl,%ecx
+     72b:	88 d0                	mov    %dl,%al
+     72d:	8b 95 a0 fb ff ff    	mov    -0x460(%ebp),%edx
+     733:	c1 e1 10             	shl    $0x10,%ecx
+     736:	88 dc                	mov    %bl,%ah
+     738:	0f b7 c0             	movzwl %ax,%eax
+     73b:	c1 e2 18             	shl    $0x18,%edx
+     73e:	09 c8                	or     %ecx,%eax
+     740:	09 d0                	or     %edx,%eax
+     742:	89 c3                	mov    %eax,%ebx
+        indirect[fbn - NDIRECT] = xint(freeblock++);
+        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+      }
+      x = xint(indirect[fbn-NDIRECT]);
+    }
+    n1 = min(n, (fbn + 1) * BSIZE - off);
+     744:	8b b5 a4 fb ff ff    	mov    -0x45c(%ebp),%esi
+    rsect(x, buf);
+     74a:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+    n1 = min(n, (fbn + 1) * BSIZE - off);
+     750:	83 c6 01             	add    $0x1,%esi
+     753:	c1 e6 09             	shl    $0x9,%esi
+     756:	29 fe                	sub    %edi,%esi
+     758:	3b 75 10             	cmp    0x10(%ebp),%esi
+     75b:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+    rsect(x, buf);
+     75f:	83 ec 08             	sub    $0x8,%esp
+     762:	50                   	push   %eax
+     763:	53                   	push   %ebx
+     764:	e8 97 fb ff ff       	call   300 <rsect>
+    bcopy(p, buf + off - (fbn * BSIZE), n1);
+     769:	89 f8                	mov    %edi,%eax
+     76b:	8d 95 e8 fd ff ff    	lea    -0x218(%ebp),%edx
+  memmove(dst, src, n);
+     771:	83 c4 0c             	add    $0xc,%esp
+    bcopy(p, buf + off - (fbn * BSIZE), n1);
+     774:	25 ff 01 00 00       	and    $0x1ff,%eax
+  memmove(dst, src, n);
+     779:	56                   	push   %esi
+    wsect(x, buf);
+    n -= n1;
+    off += n1;
+     77a:	01 f7                	add    %esi,%edi
+    bcopy(p, buf + off - (fbn * BSIZE), n1);
+     77c:	01 d0                	add    %edx,%eax
+  memmove(dst, src, n);
+     77e:	ff 75 0c             	push   0xc(%ebp)
+     781:	50                   	push   %eax
+     782:	e8 49 03 00 00       	call   ad0 <memmove>
+    wsect(x, buf);
+     787:	58                   	pop    %eax
+     788:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     78e:	5a                   	pop    %edx
+     78f:	50                   	push   %eax
+     790:	53                   	push   %ebx
+     791:	e8 da fa ff ff       	call   270 <wsect>
+    n -= n1;
+     796:	29 75 10             	sub    %esi,0x10(%ebp)
+  while(n > 0){
+     799:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     79c:	83 c4 10             	add    $0x10,%esp
+    p += n1;
+     79f:	01 75 0c             	add    %esi,0xc(%ebp)
+  while(n > 0){
+     7a2:	85 c9                	test   %ecx,%ecx
+     7a4:	0f 8e ee 00 00 00    	jle    898 <iappend+0x2a8>
+    fbn = off / BSIZE;
+     7aa:	89 f8                	mov    %edi,%eax
+     7ac:	c1 e8 09             	shr    $0x9,%eax
+     7af:	89 85 a4 fb ff ff    	mov    %eax,-0x45c(%ebp)
+    if(fbn < NDIRECT){
+     7b5:	81 ff ff 17 00 00    	cmp    $0x17ff,%edi
+     7bb:	0f 86 17 ff ff ff    	jbe    6d8 <iappend+0xe8>
+      if(xint(din.addrs[NDIRECT]) == 0){
+     7c1:	8b 85 e4 fb ff ff    	mov    -0x41c(%ebp),%eax
+    a[2] = x >> 16;
+     7c7:	89 c1                	mov    %eax,%ecx
+    a[0] = x;
+     7c9:	89 c6                	mov    %eax,%esi
+    a[1] = x >> 8;
+     7cb:	0f b6 dc             	movzbl %ah,%ebx
+    a[3] = x >> 24;
+     7ce:	c1 e8 18             	shr    $0x18,%eax
+     7d1:	89 85 a0 fb ff ff    	mov    %eax,-0x460(%ebp)
+      if(xint(din.addrs[NDIRECT]) == 0){
+     7d7:	8b 85 e4 fb ff ff    	mov    -0x41c(%ebp),%eax
+    a[2] = x >> 16;
+     7dd:	c1 e9 10             	shr    $0x10,%ecx
+      if(xint(din.addrs[NDIRECT]) == 0){
+     7e0:	85 c0                	test   %eax,%eax
+     7e2:	75 25                	jne    809 <iappend+0x219>
+        din.addrs[NDIRECT] = xint(freeblock++);
+     7e4:	a1 20 17 00 00       	mov    0x1720,%eax
+     7e9:	83 05 20 17 00 00 01 	addl   $0x1,0x1720
+    a[2] = x >> 16;
+     7f0:	89 c1                	mov    %eax,%ecx
+        din.addrs[NDIRECT] = xint(freeblock++);
+     7f2:	89 85 e4 fb ff ff    	mov    %eax,-0x41c(%ebp)
+    a[0] = x;
+     7f8:	89 c6                	mov    %eax,%esi
+    a[1] = x >> 8;
+     7fa:	0f b6 dc             	movzbl %ah,%ebx
+    a[3] = x >> 24;
+     7fd:	c1 e8 18             	shr    $0x18,%eax
+    a[2] = x >> 16;
+     800:	c1 e9 10             	shr    $0x10,%ecx
+    a[3] = x >> 24;
+     803:	89 85 a0 fb ff ff    	mov    %eax,-0x460(%ebp)
+    a[0] = x;
+     809:	89 f0                	mov    %esi,%eax
+     80b:	31 d2                	xor    %edx,%edx
+     80d:	0f b6 c9             	movzbl %cl,%ecx
+      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+     810:	83 ec 08             	sub    $0x8,%esp
+    a[0] = x;
+     813:	88 c2                	mov    %al,%dl
+     815:	8b 85 a0 fb ff ff    	mov    -0x460(%ebp),%eax
+     81b:	c1 e1 10             	shl    $0x10,%ecx
+     81e:	88 de                	mov    %bl,%dh
+     820:	0f b7 f2             	movzwl %dx,%esi
+     823:	c1 e0 18             	shl    $0x18,%eax
+     826:	09 ce                	or     %ecx,%esi
+     828:	09 c6                	or     %eax,%esi
+      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+     82a:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+     830:	50                   	push   %eax
+     831:	56                   	push   %esi
+     832:	e8 c9 fa ff ff       	call   300 <rsect>
+      if(indirect[fbn - NDIRECT] == 0){
+     837:	8b 85 a4 fb ff ff    	mov    -0x45c(%ebp),%eax
+     83d:	83 c4 10             	add    $0x10,%esp
+     840:	83 e8 0c             	sub    $0xc,%eax
+     843:	8b 9c 85 e8 fb ff ff 	mov    -0x418(%ebp,%eax,4),%ebx
+     84a:	85 db                	test   %ebx,%ebx
+     84c:	0f 85 f2 fe ff ff    	jne    744 <iappend+0x154>
+        indirect[fbn - NDIRECT] = xint(freeblock++);
+     852:	8b 15 20 17 00 00    	mov    0x1720,%edx
+     858:	89 85 a0 fb ff ff    	mov    %eax,-0x460(%ebp)
+        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+     85e:	83 ec 08             	sub    $0x8,%esp
+        indirect[fbn - NDIRECT] = xint(freeblock++);
+     861:	83 05 20 17 00 00 01 	addl   $0x1,0x1720
+     868:	89 94 85 e8 fb ff ff 	mov    %edx,-0x418(%ebp,%eax,4)
+        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+     86f:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+     875:	50                   	push   %eax
+     876:	56                   	push   %esi
+     877:	e8 f4 f9 ff ff       	call   270 <wsect>
+      x = xint(indirect[fbn-NDIRECT]);
+     87c:	8b 85 a0 fb ff ff    	mov    -0x460(%ebp),%eax
+     882:	83 c4 10             	add    $0x10,%esp
+     885:	8b 9c 85 e8 fb ff ff 	mov    -0x418(%ebp,%eax,4),%ebx
+     88c:	e9 b3 fe ff ff       	jmp    744 <iappend+0x154>
+     891:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     898:	8b 75 08             	mov    0x8(%ebp),%esi
+  }
+  din.size = xint(off);
+  winode(inum, &din);
+     89b:	83 ec 08             	sub    $0x8,%esp
+     89e:	8d 85 a8 fb ff ff    	lea    -0x458(%ebp),%eax
+  din.size = xint(off);
+     8a4:	89 bd b0 fb ff ff    	mov    %edi,-0x450(%ebp)
+  winode(inum, &din);
+     8aa:	50                   	push   %eax
+     8ab:	56                   	push   %esi
+     8ac:	e8 df fa ff ff       	call   390 <winode>
+}
+     8b1:	83 c4 10             	add    $0x10,%esp
+     8b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8b7:	5b                   	pop    %ebx
+     8b8:	5e                   	pop    %esi
+     8b9:	5f                   	pop    %edi
+     8ba:	5d                   	pop    %ebp
+     8bb:	c3                   	ret
+     8bc:	66 90                	xchg   %ax,%ax
+     8be:	66 90                	xchg   %ax,%ax
+
+000008c0 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     8c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     8c1:	31 c0                	xor    %eax,%eax
+{
+     8c3:	89 e5                	mov    %esp,%ebp
+     8c5:	53                   	push   %ebx
+     8c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     8c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     8d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     8d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     8d7:	83 c0 01             	add    $0x1,%eax
+     8da:	84 d2                	test   %dl,%dl
+     8dc:	75 f2                	jne    8d0 <strcpy+0x10>
+    ;
+  return os;
+}
+     8de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8e1:	89 c8                	mov    %ecx,%eax
+     8e3:	c9                   	leave
+     8e4:	c3                   	ret
+     8e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     8f0:	55                   	push   %ebp
+     8f1:	89 e5                	mov    %esp,%ebp
+     8f3:	53                   	push   %ebx
+     8f4:	8b 55 08             	mov    0x8(%ebp),%edx
+     8f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     8fa:	0f b6 02             	movzbl (%edx),%eax
+     8fd:	84 c0                	test   %al,%al
+     8ff:	75 17                	jne    918 <strcmp+0x28>
+     901:	eb 3a                	jmp    93d <strcmp+0x4d>
+     903:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     907:	90                   	nop
+     908:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     90c:	83 c2 01             	add    $0x1,%edx
+     90f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     912:	84 c0                	test   %al,%al
+     914:	74 1a                	je     930 <strcmp+0x40>
+    p++, q++;
+     916:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     918:	0f b6 19             	movzbl (%ecx),%ebx
+     91b:	38 c3                	cmp    %al,%bl
+     91d:	74 e9                	je     908 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     91f:	29 d8                	sub    %ebx,%eax
+}
+     921:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     924:	c9                   	leave
+     925:	c3                   	ret
+     926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     92d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     930:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     934:	31 c0                	xor    %eax,%eax
+     936:	29 d8                	sub    %ebx,%eax
+}
+     938:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     93b:	c9                   	leave
+     93c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     93d:	0f b6 19             	movzbl (%ecx),%ebx
+     940:	31 c0                	xor    %eax,%eax
+     942:	eb db                	jmp    91f <strcmp+0x2f>
+     944:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     94b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     94f:	90                   	nop
+
+00000950 <strlen>:
+
+uint
+strlen(char *s)
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     956:	80 3a 00             	cmpb   $0x0,(%edx)
+     959:	74 15                	je     970 <strlen+0x20>
+     95b:	31 c0                	xor    %eax,%eax
+     95d:	8d 76 00             	lea    0x0(%esi),%esi
+     960:	83 c0 01             	add    $0x1,%eax
+     963:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     967:	89 c1                	mov    %eax,%ecx
+     969:	75 f5                	jne    960 <strlen+0x10>
+    ;
+  return n;
+}
+     96b:	89 c8                	mov    %ecx,%eax
+     96d:	5d                   	pop    %ebp
+     96e:	c3                   	ret
+     96f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     970:	31 c9                	xor    %ecx,%ecx
+}
+     972:	5d                   	pop    %ebp
+     973:	89 c8                	mov    %ecx,%eax
+     975:	c3                   	ret
+     976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     97d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000980 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	57                   	push   %edi
+     984:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     987:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     98a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     98d:	89 d7                	mov    %edx,%edi
+     98f:	fc                   	cld
+     990:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     992:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     995:	89 d0                	mov    %edx,%eax
+     997:	c9                   	leave
+     998:	c3                   	ret
+     999:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     9a0:	55                   	push   %ebp
+     9a1:	89 e5                	mov    %esp,%ebp
+     9a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     9a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     9aa:	0f b6 10             	movzbl (%eax),%edx
+     9ad:	84 d2                	test   %dl,%dl
+     9af:	75 12                	jne    9c3 <strchr+0x23>
+     9b1:	eb 1d                	jmp    9d0 <strchr+0x30>
+     9b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9b7:	90                   	nop
+     9b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     9bc:	83 c0 01             	add    $0x1,%eax
+     9bf:	84 d2                	test   %dl,%dl
+     9c1:	74 0d                	je     9d0 <strchr+0x30>
+    if(*s == c)
+     9c3:	38 d1                	cmp    %dl,%cl
+     9c5:	75 f1                	jne    9b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     9c7:	5d                   	pop    %ebp
+     9c8:	c3                   	ret
+     9c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     9d0:	31 c0                	xor    %eax,%eax
+}
+     9d2:	5d                   	pop    %ebp
+     9d3:	c3                   	ret
+     9d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9df:	90                   	nop
+
+000009e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	57                   	push   %edi
+     9e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     9e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     9e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     9e9:	31 db                	xor    %ebx,%ebx
+{
+     9eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     9ee:	eb 27                	jmp    a17 <gets+0x37>
+    cc = read(0, &c, 1);
+     9f0:	83 ec 04             	sub    $0x4,%esp
+     9f3:	6a 01                	push   $0x1
+     9f5:	56                   	push   %esi
+     9f6:	6a 00                	push   $0x0
+     9f8:	e8 1e 01 00 00       	call   b1b <read>
+    if(cc < 1)
+     9fd:	83 c4 10             	add    $0x10,%esp
+     a00:	85 c0                	test   %eax,%eax
+     a02:	7e 1d                	jle    a21 <gets+0x41>
+      break;
+    buf[i++] = c;
+     a04:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     a08:	8b 55 08             	mov    0x8(%ebp),%edx
+     a0b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     a0f:	3c 0a                	cmp    $0xa,%al
+     a11:	74 10                	je     a23 <gets+0x43>
+     a13:	3c 0d                	cmp    $0xd,%al
+     a15:	74 0c                	je     a23 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     a17:	89 df                	mov    %ebx,%edi
+     a19:	83 c3 01             	add    $0x1,%ebx
+     a1c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     a1f:	7c cf                	jl     9f0 <gets+0x10>
+     a21:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     a23:	8b 45 08             	mov    0x8(%ebp),%eax
+     a26:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     a2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a2d:	5b                   	pop    %ebx
+     a2e:	5e                   	pop    %esi
+     a2f:	5f                   	pop    %edi
+     a30:	5d                   	pop    %ebp
+     a31:	c3                   	ret
+     a32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a40 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     a40:	55                   	push   %ebp
+     a41:	89 e5                	mov    %esp,%ebp
+     a43:	56                   	push   %esi
+     a44:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     a45:	83 ec 08             	sub    $0x8,%esp
+     a48:	6a 00                	push   $0x0
+     a4a:	ff 75 08             	push   0x8(%ebp)
+     a4d:	e8 f1 00 00 00       	call   b43 <open>
+  if(fd < 0)
+     a52:	83 c4 10             	add    $0x10,%esp
+     a55:	85 c0                	test   %eax,%eax
+     a57:	78 27                	js     a80 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     a59:	83 ec 08             	sub    $0x8,%esp
+     a5c:	ff 75 0c             	push   0xc(%ebp)
+     a5f:	89 c3                	mov    %eax,%ebx
+     a61:	50                   	push   %eax
+     a62:	e8 f4 00 00 00       	call   b5b <fstat>
+  close(fd);
+     a67:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     a6a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     a6c:	e8 ba 00 00 00       	call   b2b <close>
+  return r;
+     a71:	83 c4 10             	add    $0x10,%esp
+}
+     a74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a77:	89 f0                	mov    %esi,%eax
+     a79:	5b                   	pop    %ebx
+     a7a:	5e                   	pop    %esi
+     a7b:	5d                   	pop    %ebp
+     a7c:	c3                   	ret
+     a7d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     a80:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     a85:	eb ed                	jmp    a74 <stat+0x34>
+     a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a8e:	66 90                	xchg   %ax,%ax
+
+00000a90 <atoi>:
+
+int
+atoi(const char *s)
+{
+     a90:	55                   	push   %ebp
+     a91:	89 e5                	mov    %esp,%ebp
+     a93:	53                   	push   %ebx
+     a94:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     a97:	0f be 02             	movsbl (%edx),%eax
+     a9a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     a9d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     aa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     aa5:	77 1e                	ja     ac5 <atoi+0x35>
+     aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     ab0:	83 c2 01             	add    $0x1,%edx
+     ab3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     ab6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     aba:	0f be 02             	movsbl (%edx),%eax
+     abd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     ac0:	80 fb 09             	cmp    $0x9,%bl
+     ac3:	76 eb                	jbe    ab0 <atoi+0x20>
+  return n;
+}
+     ac5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ac8:	89 c8                	mov    %ecx,%eax
+     aca:	c9                   	leave
+     acb:	c3                   	ret
+     acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ad0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     ad0:	55                   	push   %ebp
+     ad1:	89 e5                	mov    %esp,%ebp
+     ad3:	57                   	push   %edi
+     ad4:	56                   	push   %esi
+     ad5:	8b 45 10             	mov    0x10(%ebp),%eax
+     ad8:	8b 55 08             	mov    0x8(%ebp),%edx
+     adb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     ade:	85 c0                	test   %eax,%eax
+     ae0:	7e 13                	jle    af5 <memmove+0x25>
+     ae2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     ae4:	89 d7                	mov    %edx,%edi
+     ae6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     af0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     af1:	39 f8                	cmp    %edi,%eax
+     af3:	75 fb                	jne    af0 <memmove+0x20>
+  return vdst;
+}
+     af5:	5e                   	pop    %esi
+     af6:	89 d0                	mov    %edx,%eax
+     af8:	5f                   	pop    %edi
+     af9:	5d                   	pop    %ebp
+     afa:	c3                   	ret
+
+00000afb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     afb:	b8 01 00 00 00       	mov    $0x1,%eax
+     b00:	cd 40                	int    $0x40
+     b02:	c3                   	ret
+
+00000b03 <exit>:
+SYSCALL(exit)
+     b03:	b8 02 00 00 00       	mov    $0x2,%eax
+     b08:	cd 40                	int    $0x40
+     b0a:	c3                   	ret
+
+00000b0b <wait>:
+SYSCALL(wait)
+     b0b:	b8 03 00 00 00       	mov    $0x3,%eax
+     b10:	cd 40                	int    $0x40
+     b12:	c3                   	ret
+
+00000b13 <pipe>:
+SYSCALL(pipe)
+     b13:	b8 04 00 00 00       	mov    $0x4,%eax
+     b18:	cd 40                	int    $0x40
+     b1a:	c3                   	ret
+
+00000b1b <read>:
+SYSCALL(read)
+     b1b:	b8 05 00 00 00       	mov    $0x5,%eax
+     b20:	cd 40                	int    $0x40
+     b22:	c3                   	ret
+
+00000b23 <write>:
+SYSCALL(write)
+     b23:	b8 10 00 00 00       	mov    $0x10,%eax
+     b28:	cd 40                	int    $0x40
+     b2a:	c3                   	ret
+
+00000b2b <close>:
+SYSCALL(close)
+     b2b:	b8 15 00 00 00       	mov    $0x15,%eax
+     b30:	cd 40                	int    $0x40
+     b32:	c3                   	ret
+
+00000b33 <kill>:
+SYSCALL(kill)
+     b33:	b8 06 00 00 00       	mov    $0x6,%eax
+     b38:	cd 40                	int    $0x40
+     b3a:	c3                   	ret
+
+00000b3b <exec>:
+SYSCALL(exec)
+     b3b:	b8 07 00 00 00       	mov    $0x7,%eax
+     b40:	cd 40                	int    $0x40
+     b42:	c3                   	ret
+
+00000b43 <open>:
+SYSCALL(open)
+     b43:	b8 0f 00 00 00       	mov    $0xf,%eax
+     b48:	cd 40                	int    $0x40
+     b4a:	c3                   	ret
+
+00000b4b <mknod>:
+SYSCALL(mknod)
+     b4b:	b8 11 00 00 00       	mov    $0x11,%eax
+     b50:	cd 40                	int    $0x40
+     b52:	c3                   	ret
+
+00000b53 <unlink>:
+SYSCALL(unlink)
+     b53:	b8 12 00 00 00       	mov    $0x12,%eax
+     b58:	cd 40                	int    $0x40
+     b5a:	c3                   	ret
+
+00000b5b <fstat>:
+SYSCALL(fstat)
+     b5b:	b8 08 00 00 00       	mov    $0x8,%eax
+     b60:	cd 40                	int    $0x40
+     b62:	c3                   	ret
+
+00000b63 <link>:
+SYSCALL(link)
+     b63:	b8 13 00 00 00       	mov    $0x13,%eax
+     b68:	cd 40                	int    $0x40
+     b6a:	c3                   	ret
+
+00000b6b <mkdir>:
+SYSCALL(mkdir)
+     b6b:	b8 14 00 00 00       	mov    $0x14,%eax
+     b70:	cd 40                	int    $0x40
+     b72:	c3                   	ret
+
+00000b73 <chdir>:
+SYSCALL(chdir)
+     b73:	b8 09 00 00 00       	mov    $0x9,%eax
+     b78:	cd 40                	int    $0x40
+     b7a:	c3                   	ret
+
+00000b7b <dup>:
+SYSCALL(dup)
+     b7b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     b80:	cd 40                	int    $0x40
+     b82:	c3                   	ret
+
+00000b83 <getpid>:
+SYSCALL(getpid)
+     b83:	b8 0b 00 00 00       	mov    $0xb,%eax
+     b88:	cd 40                	int    $0x40
+     b8a:	c3                   	ret
+
+00000b8b <sbrk>:
+SYSCALL(sbrk)
+     b8b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     b90:	cd 40                	int    $0x40
+     b92:	c3                   	ret
+
+00000b93 <sleep>:
+SYSCALL(sleep)
+     b93:	b8 0d 00 00 00       	mov    $0xd,%eax
+     b98:	cd 40                	int    $0x40
+     b9a:	c3                   	ret
+
+00000b9b <uptime>:
+SYSCALL(uptime)
+     b9b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ba0:	cd 40                	int    $0x40
+     ba2:	c3                   	ret
+
+00000ba3 <getdate>:
+SYSCALL(getdate)
+     ba3:	b8 16 00 00 00       	mov    $0x16,%eax
+     ba8:	cd 40                	int    $0x40
+     baa:	c3                   	ret
+
+00000bab <setdate>:
+SYSCALL(setdate)
+     bab:	b8 17 00 00 00       	mov    $0x17,%eax
+     bb0:	cd 40                	int    $0x40
+     bb2:	c3                   	ret
+
+00000bb3 <mount>:
+SYSCALL(mount)
+     bb3:	b8 18 00 00 00       	mov    $0x18,%eax
+     bb8:	cd 40                	int    $0x40
+     bba:	c3                   	ret
+
+00000bbb <unmount>:
+SYSCALL(unmount)
+     bbb:	b8 19 00 00 00       	mov    $0x19,%eax
+     bc0:	cd 40                	int    $0x40
+     bc2:	c3                   	ret
+
+00000bc3 <lseek>:
+SYSCALL(lseek)
+     bc3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     bc8:	cd 40                	int    $0x40
+     bca:	c3                   	ret
+
+00000bcb <mmap>:
+SYSCALL(mmap)
+     bcb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     bd0:	cd 40                	int    $0x40
+     bd2:	c3                   	ret
+
+00000bd3 <munmap>:
+SYSCALL(munmap)
+     bd3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     bd8:	cd 40                	int    $0x40
+     bda:	c3                   	ret
+
+00000bdb <clock_gettime>:
+SYSCALL(clock_gettime)
+     bdb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     be0:	cd 40                	int    $0x40
+     be2:	c3                   	ret
+
+00000be3 <nanosleep>:
+SYSCALL(nanosleep)
+     be3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     be8:	cd 40                	int    $0x40
+     bea:	c3                   	ret
+
+00000beb <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+     beb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     bf0:	cd 40                	int    $0x40
+     bf2:	c3                   	ret
+
+00000bf3 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+     bf3:	b8 20 00 00 00       	mov    $0x20,%eax
+     bf8:	cd 40                	int    $0x40
+     bfa:	c3                   	ret
+
+00000bfb <proclimit>:
+SYSCALL(proclimit)
+     bfb:	b8 21 00 00 00       	mov    $0x21,%eax
+     c00:	cd 40                	int    $0x40
+     c02:	c3                   	ret
+
+00000c03 <procinfo>:
+SYSCALL(procinfo)
+     c03:	b8 22 00 00 00       	mov    $0x22,%eax
+     c08:	cd 40                	int    $0x40
+     c0a:	c3                   	ret
+
+00000c0b <cpuinfo>:
+SYSCALL(cpuinfo)
+     c0b:	b8 23 00 00 00       	mov    $0x23,%eax
+     c10:	cd 40                	int    $0x40
+     c12:	c3                   	ret
+
+00000c13 <schedstat>:
+SYSCALL(schedstat)
+     c13:	b8 24 00 00 00       	mov    $0x24,%eax
+     c18:	cd 40                	int    $0x40
+     c1a:	c3                   	ret
+
+00000c1b <lockstat>:
+SYSCALL(lockstat)
+     c1b:	b8 25 00 00 00       	mov    $0x25,%eax
+     c20:	cd 40                	int    $0x40
+     c22:	c3                   	ret
+
+00000c23 <bcachestat>:
+SYSCALL(bcachestat)
+     c23:	b8 26 00 00 00       	mov    $0x26,%eax
+     c28:	cd 40                	int    $0x40
+     c2a:	c3                   	ret
+
+00000c2b <diskstat>:
+SYSCALL(diskstat)
+     c2b:	b8 27 00 00 00       	mov    $0x27,%eax
+     c30:	cd 40                	int    $0x40
+     c32:	c3                   	ret
+
+00000c33 <iosched>:
+SYSCALL(iosched)
+     c33:	b8 28 00 00 00       	mov    $0x28,%eax
+     c38:	cd 40                	int    $0x40
+     c3a:	c3                   	ret
+     c3b:	66 90                	xchg   %ax,%ax
+     c3d:	66 90                	xchg   %ax,%ax
+     c3f:	90                   	nop
+
+00000c40 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c40:	55                   	push   %ebp
+     c41:	89 e5                	mov    %esp,%ebp
+     c43:	57                   	push   %edi
+     c44:	56                   	push   %esi
+     c45:	53                   	push   %ebx
+     c46:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     c48:	89 d1                	mov    %edx,%ecx
+{
+     c4a:	83 ec 3c             	sub    $0x3c,%esp
+     c4d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     c50:	85 d2                	test   %edx,%edx
+     c52:	0f 89 80 00 00 00    	jns    cd8 <printint+0x98>
+     c58:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     c5c:	74 7a                	je     cd8 <printint+0x98>
+    x = -xx;
+     c5e:	f7 d9                	neg    %ecx
+    neg = 1;
+     c60:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c65:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c68:	31 f6                	xor    %esi,%esi
+     c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c70:	89 c8                	mov    %ecx,%eax
+     c72:	31 d2                	xor    %edx,%edx
+     c74:	89 f7                	mov    %esi,%edi
+     c76:	f7 f3                	div    %ebx
+     c78:	8d 76 01             	lea    0x1(%esi),%esi
+     c7b:	0f b6 92 44 12 00 00 	movzbl 0x1244(%edx),%edx
+     c82:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c86:	89 ca                	mov    %ecx,%edx
+     c88:	89 c1                	mov    %eax,%ecx
+     c8a:	39 da                	cmp    %ebx,%edx
+     c8c:	73 e2                	jae    c70 <printint+0x30>
+  if(neg)
+     c8e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     c91:	85 c0                	test   %eax,%eax
+     c93:	74 07                	je     c9c <printint+0x5c>
+    buf[i++] = '-';
+     c95:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     c9a:	89 f7                	mov    %esi,%edi
+     c9c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     c9f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     ca2:	01 df                	add    %ebx,%edi
+     ca4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     ca8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     cab:	83 ec 04             	sub    $0x4,%esp
+     cae:	88 45 d7             	mov    %al,-0x29(%ebp)
+     cb1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     cb4:	6a 01                	push   $0x1
+     cb6:	50                   	push   %eax
+     cb7:	56                   	push   %esi
+     cb8:	e8 66 fe ff ff       	call   b23 <write>
+  while(--i >= 0)
+     cbd:	89 f8                	mov    %edi,%eax
+     cbf:	83 c4 10             	add    $0x10,%esp
+     cc2:	83 ef 01             	sub    $0x1,%edi
+     cc5:	39 d8                	cmp    %ebx,%eax
+     cc7:	75 df                	jne    ca8 <printint+0x68>
+}
+     cc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ccc:	5b                   	pop    %ebx
+     ccd:	5e                   	pop    %esi
+     cce:	5f                   	pop    %edi
+     ccf:	5d                   	pop    %ebp
+     cd0:	c3                   	ret
+     cd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     cd8:	31 c0                	xor    %eax,%eax
+     cda:	eb 89                	jmp    c65 <printint+0x25>
+     cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ce0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+     ce0:	55                   	push   %ebp
+     ce1:	89 e5                	mov    %esp,%ebp
+     ce3:	57                   	push   %edi
+     ce4:	56                   	push   %esi
+     ce5:	53                   	push   %ebx
+     ce6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     ce9:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+     cec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     cef:	0f b6 1e             	movzbl (%esi),%ebx
+     cf2:	83 c6 01             	add    $0x1,%esi
+     cf5:	84 db                	test   %bl,%bl
+     cf7:	74 67                	je     d60 <printf+0x80>
+     cf9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     cfc:	31 d2                	xor    %edx,%edx
+     cfe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     d01:	eb 34                	jmp    d37 <printf+0x57>
+     d03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d07:	90                   	nop
+     d08:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     d0b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     d10:	83 f8 25             	cmp    $0x25,%eax
+     d13:	74 18                	je     d2d <printf+0x4d>
+  write(fd, &c, 1);
+     d15:	83 ec 04             	sub    $0x4,%esp
+     d18:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     d1b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d1e:	6a 01                	push   $0x1
+     d20:	50                   	push   %eax
+     d21:	57                   	push   %edi
+     d22:	e8 fc fd ff ff       	call   b23 <write>
+     d27:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     d2a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     d2d:	0f b6 1e             	movzbl (%esi),%ebx
+     d30:	83 c6 01             	add    $0x1,%esi
+     d33:	84 db                	test   %bl,%bl
+     d35:	74 29                	je     d60 <printf+0x80>
+    c = fmt[i] & 0xff;
+     d37:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     d3a:	85 d2                	test   %edx,%edx
+     d3c:	74 ca                	je     d08 <printf+0x28>
+      }
+    } else if(state == '%'){
+     d3e:	83 fa 25             	cmp    $0x25,%edx
+     d41:	75 ea                	jne    d2d <printf+0x4d>
+      if(c == 'd'){
+     d43:	83 f8 25             	cmp    $0x25,%eax
+     d46:	0f 84 24 01 00 00    	je     e70 <printf+0x190>
+     d4c:	83 e8 63             	sub    $0x63,%eax
+     d4f:	83 f8 15             	cmp    $0x15,%eax
+     d52:	77 1c                	ja     d70 <printf+0x90>
+     d54:	ff 24 85 ec 11 00 00 	jmp    *0x11ec(,%eax,4)
+     d5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d5f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d63:	5b                   	pop    %ebx
+     d64:	5e                   	pop    %esi
+     d65:	5f                   	pop    %edi
+     d66:	5d                   	pop    %ebp
+     d67:	c3                   	ret
+     d68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+  write(fd, &c, 1);
+     d70:	83 ec 04             	sub    $0x4,%esp
+     d73:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     d76:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     d7a:	6a 01                	push   $0x1
+     d7c:	52                   	push   %edx
+     d7d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     d80:	57                   	push   %edi
+     d81:	e8 9d fd ff ff       	call   b23 <write>
+     d86:	83 c4 0c             	add    $0xc,%esp
+     d89:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d8c:	6a 01                	push   $0x1
+     d8e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     d91:	52                   	push   %edx
+     d92:	57                   	push   %edi
+     d93:	e8 8b fd ff ff       	call   b23 <write>
+        putc(fd, c);
+     d98:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d9b:	31 d2                	xor    %edx,%edx
+     d9d:	eb 8e                	jmp    d2d <printf+0x4d>
+     d9f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     da0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     da3:	83 ec 0c             	sub    $0xc,%esp
+     da6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     dab:	8b 13                	mov    (%ebx),%edx
+     dad:	6a 00                	push   $0x0
+     daf:	89 f8                	mov    %edi,%eax
+        ap++;
+     db1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     db4:	e8 87 fe ff ff       	call   c40 <printint>
+        ap++;
+     db9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     dbc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     dbf:	31 d2                	xor    %edx,%edx
+     dc1:	e9 67 ff ff ff       	jmp    d2d <printf+0x4d>
+     dc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dcd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     dd0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     dd3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     dd5:	83 c0 04             	add    $0x4,%eax
+     dd8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     ddb:	85 db                	test   %ebx,%ebx
+     ddd:	0f 84 9d 00 00 00    	je     e80 <printf+0x1a0>
+        while(*s != 0){
+     de3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     de6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     de8:	84 c0                	test   %al,%al
+     dea:	0f 84 3d ff ff ff    	je     d2d <printf+0x4d>
+     df0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     df3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     df6:	89 de                	mov    %ebx,%esi
+     df8:	89 d3                	mov    %edx,%ebx
+     dfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     e00:	83 ec 04             	sub    $0x4,%esp
+     e03:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     e06:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     e09:	6a 01                	push   $0x1
+     e0b:	53                   	push   %ebx
+     e0c:	57                   	push   %edi
+     e0d:	e8 11 fd ff ff       	call   b23 <write>
+        while(*s != 0){
+     e12:	0f b6 06             	movzbl (%esi),%eax
+     e15:	83 c4 10             	add    $0x10,%esp
+     e18:	84 c0                	test   %al,%al
+     e1a:	75 e4                	jne    e00 <printf+0x120>
+      state = 0;
+     e1c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     e1f:	31 d2                	xor    %edx,%edx
+     e21:	e9 07 ff ff ff       	jmp    d2d <printf+0x4d>
+     e26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     e30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     e33:	83 ec 0c             	sub    $0xc,%esp
+     e36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e3b:	8b 13                	mov    (%ebx),%edx
+     e3d:	6a 01                	push   $0x1
+     e3f:	e9 6b ff ff ff       	jmp    daf <printf+0xcf>
+     e44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     e48:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     e4b:	83 ec 04             	sub    $0x4,%esp
+     e4e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     e51:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     e53:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     e56:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     e59:	6a 01                	push   $0x1
+     e5b:	52                   	push   %edx
+     e5c:	57                   	push   %edi
+     e5d:	e8 c1 fc ff ff       	call   b23 <write>
+        ap++;
+     e62:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     e65:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e68:	31 d2                	xor    %edx,%edx
+     e6a:	e9 be fe ff ff       	jmp    d2d <printf+0x4d>
+     e6f:	90                   	nop
+  write(fd, &c, 1);
+     e70:	83 ec 04             	sub    $0x4,%esp
+     e73:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     e76:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     e79:	6a 01                	push   $0x1
+     e7b:	e9 11 ff ff ff       	jmp    d91 <printf+0xb1>
+     e80:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     e85:	bb e0 11 00 00       	mov    $0x11e0,%ebx
+     e8a:	e9 61 ff ff ff       	jmp    df0 <printf+0x110>
+     e8f:	90                   	nop
+
+00000e90 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+     e90:	55                   	push   %ebp
+     e91:	89 e5                	mov    %esp,%ebp
+     e93:	57                   	push   %edi
+     e94:	56                   	push   %esi
+     e95:	53                   	push   %ebx
+     e96:	83 ec 20             	sub    $0x20,%esp
+     e99:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     e9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+     e9f:	57                   	push   %edi
+     ea0:	68 e7 11 00 00       	push   $0x11e7
+     ea5:	53                   	push   %ebx
+     ea6:	e8 35 fe ff ff       	call   ce0 <printf>
+  for(n = strlen(s); n < w; n++)
+     eab:	89 3c 24             	mov    %edi,(%esp)
+     eae:	e8 9d fa ff ff       	call   950 <strlen>
+     eb3:	83 c4 10             	add    $0x10,%esp
+     eb6:	3b 45 10             	cmp    0x10(%ebp),%eax
+     eb9:	7d 20                	jge    edb <pads+0x4b>
+     ebb:	89 c6                	mov    %eax,%esi
+     ebd:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+     ec0:	83 ec 04             	sub    $0x4,%esp
+     ec3:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+     ec7:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     eca:	6a 01                	push   $0x1
+     ecc:	57                   	push   %edi
+     ecd:	53                   	push   %ebx
+     ece:	e8 50 fc ff ff       	call   b23 <write>
+  for(n = strlen(s); n < w; n++)
+     ed3:	83 c4 10             	add    $0x10,%esp
+     ed6:	39 75 10             	cmp    %esi,0x10(%ebp)
+     ed9:	75 e5                	jne    ec0 <pads+0x30>
+    putc(fd, ' ');
+}
+     edb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ede:	5b                   	pop    %ebx
+     edf:	5e                   	pop    %esi
+     ee0:	5f                   	pop    %edi
+     ee1:	5d                   	pop    %ebp
+     ee2:	c3                   	ret
+     ee3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ef0 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+     ef0:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+     ef1:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+     ef6:	89 e5                	mov    %esp,%ebp
+     ef8:	57                   	push   %edi
+     ef9:	56                   	push   %esi
+     efa:	53                   	push   %ebx
+  int n = 0;
+     efb:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+     efd:	83 ec 2c             	sub    $0x2c,%esp
+     f00:	8b 55 0c             	mov    0xc(%ebp),%edx
+     f03:	8b 45 10             	mov    0x10(%ebp),%eax
+     f06:	8b 75 08             	mov    0x8(%ebp),%esi
+     f09:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     f0c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     f0f:	90                   	nop
+  }while((x /= 10) != 0);
+     f10:	89 d0                	mov    %edx,%eax
+     f12:	89 d7                	mov    %edx,%edi
+    n++;
+     f14:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+     f17:	f7 e1                	mul    %ecx
+     f19:	c1 ea 03             	shr    $0x3,%edx
+     f1c:	83 ff 09             	cmp    $0x9,%edi
+     f1f:	77 ef                	ja     f10 <padd+0x20>
+  for(; n < w; n++)
+     f21:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     f24:	39 c3                	cmp    %eax,%ebx
+     f26:	7d 23                	jge    f4b <padd+0x5b>
+     f28:	8d 7d e7             	lea    -0x19(%ebp),%edi
+     f2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+  write(fd, &c, 1);
+     f30:	83 ec 04             	sub    $0x4,%esp
+     f33:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+     f37:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+     f3a:	6a 01                	push   $0x1
+     f3c:	57                   	push   %edi
+     f3d:	56                   	push   %esi
+     f3e:	e8 e0 fb ff ff       	call   b23 <write>
+  for(; n < w; n++)
+     f43:	83 c4 10             	add    $0x10,%esp
+     f46:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+     f49:	75 e5                	jne    f30 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+     f4b:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+     f52:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+     f55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+     f58:	89 f0                	mov    %esi,%eax
+}
+     f5a:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+     f5b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+     f60:	5e                   	pop    %esi
+     f61:	5f                   	pop    %edi
+     f62:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+     f63:	e9 d8 fc ff ff       	jmp    c40 <printint>
+     f68:	66 90                	xchg   %ax,%ax
+     f6a:	66 90                	xchg   %ax,%ax
+     f6c:	66 90                	xchg   %ax,%ax
+     f6e:	66 90                	xchg   %ax,%ax
+
+00000f70 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     f70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f71:	a1 68 19 00 00       	mov    0x1968,%eax
+{
+     f76:	89 e5                	mov    %esp,%ebp
+     f78:	57                   	push   %edi
+     f79:	56                   	push   %esi
+     f7a:	53                   	push   %ebx
+     f7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     f7e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f88:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f8a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f8c:	39 ca                	cmp    %ecx,%edx
+     f8e:	73 30                	jae    fc0 <free+0x50>
+     f90:	39 c1                	cmp    %eax,%ecx
+     f92:	72 04                	jb     f98 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f94:	39 c2                	cmp    %eax,%edx
+     f96:	72 f0                	jb     f88 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f98:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f9b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f9e:	39 f8                	cmp    %edi,%eax
+     fa0:	74 2e                	je     fd0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     fa2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     fa5:	8b 42 04             	mov    0x4(%edx),%eax
+     fa8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     fab:	39 f1                	cmp    %esi,%ecx
+     fad:	74 38                	je     fe7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     faf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     fb1:	5b                   	pop    %ebx
+  freep = p;
+     fb2:	89 15 68 19 00 00    	mov    %edx,0x1968
+}
+     fb8:	5e                   	pop    %esi
+     fb9:	5f                   	pop    %edi
+     fba:	5d                   	pop    %ebp
+     fbb:	c3                   	ret
+     fbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     fc0:	39 c1                	cmp    %eax,%ecx
+     fc2:	72 d0                	jb     f94 <free+0x24>
+     fc4:	eb c2                	jmp    f88 <free+0x18>
+     fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     fd0:	03 70 04             	add    0x4(%eax),%esi
+     fd3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     fd6:	8b 02                	mov    (%edx),%eax
+     fd8:	8b 00                	mov    (%eax),%eax
+     fda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     fdd:	8b 42 04             	mov    0x4(%edx),%eax
+     fe0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     fe3:	39 f1                	cmp    %esi,%ecx
+     fe5:	75 c8                	jne    faf <free+0x3f>
+    p->s.size += bp->s.size;
+     fe7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     fea:	89 15 68 19 00 00    	mov    %edx,0x1968
+    p->s.size += bp->s.size;
+     ff0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     ff3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     ff6:	89 0a                	mov    %ecx,(%edx)
+}
+     ff8:	5b                   	pop    %ebx
+     ff9:	5e                   	pop    %esi
+     ffa:	5f                   	pop    %edi
+     ffb:	5d                   	pop    %ebp
+     ffc:	c3                   	ret
+     ffd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001000 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+    1000:	55                   	push   %ebp
+    1001:	89 e5                	mov    %esp,%ebp
+    1003:	57                   	push   %edi
+    1004:	56                   	push   %esi
+    1005:	53                   	push   %ebx
+    1006:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1009:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    100c:	8b 15 68 19 00 00    	mov    0x1968,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1012:	8d 78 07             	lea    0x7(%eax),%edi
+    1015:	c1 ef 03             	shr    $0x3,%edi
+    1018:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    101b:	85 d2                	test   %edx,%edx
+    101d:	0f 84 8d 00 00 00    	je     10b0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1023:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1025:	8b 48 04             	mov    0x4(%eax),%ecx
+    1028:	39 f9                	cmp    %edi,%ecx
+    102a:	73 64                	jae    1090 <malloc+0x90>
+  if(nu < 4096)
+    102c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1031:	39 df                	cmp    %ebx,%edi
+    1033:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1036:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    103d:	eb 0a                	jmp    1049 <malloc+0x49>
+    103f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1040:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1042:	8b 48 04             	mov    0x4(%eax),%ecx
+    1045:	39 f9                	cmp    %edi,%ecx
+    1047:	73 47                	jae    1090 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1049:	89 c2                	mov    %eax,%edx
+    104b:	39 05 68 19 00 00    	cmp    %eax,0x1968
+    1051:	75 ed                	jne    1040 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1053:	83 ec 0c             	sub    $0xc,%esp
+    1056:	56                   	push   %esi
+    1057:	e8 2f fb ff ff       	call   b8b <sbrk>
+  if(p == (char*)-1)
+    105c:	83 c4 10             	add    $0x10,%esp
+    105f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1062:	74 1c                	je     1080 <malloc+0x80>
+  hp->s.size = nu;
+    1064:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1067:	83 ec 0c             	sub    $0xc,%esp
+    106a:	83 c0 08             	add    $0x8,%eax
+    106d:	50                   	push   %eax
+    106e:	e8 fd fe ff ff       	call   f70 <free>
+  return freep;
+    1073:	8b 15 68 19 00 00    	mov    0x1968,%edx
+      if((p = morecore(nunits)) == 0)
+    1079:	83 c4 10             	add    $0x10,%esp
+    107c:	85 d2                	test   %edx,%edx
+    107e:	75 c0                	jne    1040 <malloc+0x40>
+        return 0;
+  }
+}
+    1080:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1083:	31 c0                	xor    %eax,%eax
+}
+    1085:	5b                   	pop    %ebx
+    1086:	5e                   	pop    %esi
+    1087:	5f                   	pop    %edi
+    1088:	5d                   	pop    %ebp
+    1089:	c3                   	ret
+    108a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1090:	39 cf                	cmp    %ecx,%edi
+    1092:	74 4c                	je     10e0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1094:	29 f9                	sub    %edi,%ecx
+    1096:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1099:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    109c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    109f:	89 15 68 19 00 00    	mov    %edx,0x1968
+}
+    10a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    10a8:	83 c0 08             	add    $0x8,%eax
+}
+    10ab:	5b                   	pop    %ebx
+    10ac:	5e                   	pop    %esi
+    10ad:	5f                   	pop    %edi
+    10ae:	5d                   	pop    %ebp
+    10af:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    10b0:	c7 05 68 19 00 00 6c 	movl   $0x196c,0x1968
+    10b7:	19 00 00 
+    base.s.size = 0;
+    10ba:	b8 6c 19 00 00       	mov    $0x196c,%eax
+    base.s.ptr = freep = prevp = &base;
+    10bf:	c7 05 6c 19 00 00 6c 	movl   $0x196c,0x196c
+    10c6:	19 00 00 
+    base.s.size = 0;
+    10c9:	c7 05 70 19 00 00 00 	movl   $0x0,0x1970
+    10d0:	00 00 00 
+    if(p->s.size >= nunits){
+    10d3:	e9 54 ff ff ff       	jmp    102c <malloc+0x2c>
+    10d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10df:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    10e0:	8b 08                	mov    (%eax),%ecx
+    10e2:	89 0a                	mov    %ecx,(%edx)
+    10e4:	eb b9                	jmp    109f <malloc+0x9f>
@@ -3,6 +3,13 @@
 
 struct stat;
 struct rtcdate;
+struct timespec;
+struct procinfo;
+struct cpuinfo;
+struct schedstat;
+struct lockinfo;
+struct bcachestat;
+struct diskstat;
 struct file;
 
 // system calls
@@ -34,6 +41,18 @@ int mount(char *, char *);
 int unmount(char *);
 void *mmap(int, uint, uint, int);
 int munmap(void *);
+int clock_gettime(int, struct timespec *);
+int nanosleep(struct timespec *);
+int sched_setaffinity(int, uint);
+int sched_getaffinity(int);
+int proclimit(int);
+int procinfo(struct procinfo *, int);
+int cpuinfo(struct cpuinfo *, int);
+int schedstat(struct schedstat *, int);
+int lockstat(struct lockinfo *, int);
+int bcachestat(struct bcachestat *);
+int diskstat(struct diskstat *, int);
+int iosched(char *);
 
 // ulib.c
 int stat(char*, struct stat*);
@@ -42,6 +61,8 @@ void *memmove(void*, void*, int);
 char* strchr(const char*, char);
 int strcmp(const char*, const char*);
 void printf(int, char*, ...);
+void pads(int, char*, int);
+void padd(int, uint, int);
 char* gets(char*, int);
 uint strlen(char*);
 void* memset(void*, int, uint);
@@ -0,0 +1,7379 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 ce 57 00 00       	push   $0x57ce
+      16:	6a 01                	push   $0x1
+      18:	e8 13 43 00 00       	call   4330 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	58                   	pop    %eax
+      1e:	5a                   	pop    %edx
+      1f:	6a 00                	push   $0x0
+      21:	68 e2 57 00 00       	push   $0x57e2
+      26:	e8 68 41 00 00       	call   4193 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 18                	js     4a <main+0x4a>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	51                   	push   %ecx
+      33:	51                   	push   %ecx
+      34:	68 a0 5f 00 00       	push   $0x5fa0
+      39:	6a 01                	push   $0x1
+      3b:	e8 f0 42 00 00       	call   4330 <printf>
+    exit(0);
+      40:	31 c0                	xor    %eax,%eax
+      42:	89 04 24             	mov    %eax,(%esp)
+      45:	e8 09 41 00 00       	call   4153 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      4a:	50                   	push   %eax
+      4b:	50                   	push   %eax
+      4c:	68 00 02 00 00       	push   $0x200
+      51:	68 e2 57 00 00       	push   $0x57e2
+      56:	e8 38 41 00 00       	call   4193 <open>
+      5b:	89 04 24             	mov    %eax,(%esp)
+      5e:	e8 18 41 00 00       	call   417b <close>
+
+  argptest();
+      63:	e8 18 3e 00 00       	call   3e80 <argptest>
+  createdelete();
+      68:	e8 93 16 00 00       	call   1700 <createdelete>
+  linkunlink();
+      6d:	e8 2e 20 00 00       	call   20a0 <linkunlink>
+  concreate();
+      72:	e8 e9 1c 00 00       	call   1d60 <concreate>
+  fourfiles();
+      77:	e8 44 14 00 00       	call   14c0 <fourfiles>
+  sharedfd();
+      7c:	e8 7f 12 00 00       	call   1300 <sharedfd>
+
+  bigargtest();
+      81:	e8 7a 3a 00 00       	call   3b00 <bigargtest>
+  bigwrite();
+      86:	e8 45 2a 00 00       	call   2ad0 <bigwrite>
+  bigargtest();
+      8b:	e8 70 3a 00 00       	call   3b00 <bigargtest>
+  bsstest();
+      90:	e8 fb 39 00 00       	call   3a90 <bsstest>
+  sbrktest();
+      95:	e8 76 34 00 00       	call   3510 <sbrktest>
+  validatetest();
+      9a:	e8 31 39 00 00       	call   39d0 <validatetest>
+
+  opentest();
+      9f:	e8 ec 03 00 00       	call   490 <opentest>
+  writetest();
+      a4:	e8 87 04 00 00       	call   530 <writetest>
+  writetest1();
+      a9:	e8 92 06 00 00       	call   740 <writetest1>
+  createtest();
+      ae:	e8 8d 08 00 00       	call   940 <createtest>
+
+  openiputtest();
+      b3:	e8 a8 02 00 00       	call   360 <openiputtest>
+  exitiputtest();
+      b8:	e8 73 01 00 00       	call   230 <exitiputtest>
+  iputtest();
+      bd:	e8 6e 00 00 00       	call   130 <iputtest>
+
+  mem();
+      c2:	e8 59 11 00 00       	call   1220 <mem>
+  bcachegrow();
+      c7:	e8 74 0a 00 00       	call   b40 <bcachegrow>
+  pipe1();
+      cc:	e8 7f 0d 00 00       	call   e50 <pipe1>
+  preempt();
+      d1:	e8 4a 0f 00 00       	call   1020 <preempt>
+  exitwait();
+      d6:	e8 b5 10 00 00       	call   1190 <exitwait>
+
+  rmdot();
+      db:	e8 40 2e 00 00       	call   2f20 <rmdot>
+  fourteen();
+      e0:	e8 db 2c 00 00       	call   2dc0 <fourteen>
+  bigfile();
+      e5:	e8 d6 2a 00 00       	call   2bc0 <bigfile>
+  subdir();
+      ea:	e8 21 22 00 00       	call   2310 <subdir>
+  linktest();
+      ef:	e8 1c 1a 00 00       	call   1b10 <linktest>
+  unlinkread();
+      f4:	e8 57 18 00 00       	call   1950 <unlinkread>
+  dirfile();
+      f9:	e8 d2 2f 00 00       	call   30d0 <dirfile>
+  iref();
+      fe:	e8 fd 31 00 00       	call   3300 <iref>
+  forktest();
+     103:	e8 28 33 00 00       	call   3430 <forktest>
+  bigdir(); // slow
+     108:	e8 b3 20 00 00       	call   21c0 <bigdir>
+
+  uio();
+     10d:	e8 de 3c 00 00       	call   3df0 <uio>
+
+  exectest();
+     112:	e8 d9 09 00 00       	call   af0 <exectest>
+
+  exit(0);
+     117:	31 d2                	xor    %edx,%edx
+     119:	89 14 24             	mov    %edx,(%esp)
+     11c:	e8 32 40 00 00       	call   4153 <exit>
+     121:	66 90                	xchg   %ax,%ax
+     123:	66 90                	xchg   %ax,%ax
+     125:	66 90                	xchg   %ax,%ax
+     127:	66 90                	xchg   %ax,%ax
+     129:	66 90                	xchg   %ax,%ax
+     12b:	66 90                	xchg   %ax,%ax
+     12d:	66 90                	xchg   %ax,%ax
+     12f:	90                   	nop
+
+00000130 <iputtest>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     136:	68 cc 47 00 00       	push   $0x47cc
+     13b:	ff 35 a0 69 00 00    	push   0x69a0
+     141:	e8 ea 41 00 00       	call   4330 <printf>
+  if(mkdir("iputdir") < 0){
+     146:	c7 04 24 5f 47 00 00 	movl   $0x475f,(%esp)
+     14d:	e8 69 40 00 00       	call   41bb <mkdir>
+     152:	83 c4 10             	add    $0x10,%esp
+     155:	85 c0                	test   %eax,%eax
+     157:	78 58                	js     1b1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     159:	83 ec 0c             	sub    $0xc,%esp
+     15c:	68 5f 47 00 00       	push   $0x475f
+     161:	e8 5d 40 00 00       	call   41c3 <chdir>
+     166:	83 c4 10             	add    $0x10,%esp
+     169:	85 c0                	test   %eax,%eax
+     16b:	0f 88 9a 00 00 00    	js     20b <iputtest+0xdb>
+  if(unlink("../iputdir") < 0){
+     171:	83 ec 0c             	sub    $0xc,%esp
+     174:	68 5c 47 00 00       	push   $0x475c
+     179:	e8 25 40 00 00       	call   41a3 <unlink>
+     17e:	83 c4 10             	add    $0x10,%esp
+     181:	85 c0                	test   %eax,%eax
+     183:	78 68                	js     1ed <iputtest+0xbd>
+  if(chdir("/") < 0){
+     185:	83 ec 0c             	sub    $0xc,%esp
+     188:	68 81 47 00 00       	push   $0x4781
+     18d:	e8 31 40 00 00       	call   41c3 <chdir>
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	85 c0                	test   %eax,%eax
+     197:	78 36                	js     1cf <iputtest+0x9f>
+  printf(stdout, "iput test ok\n");
+     199:	83 ec 08             	sub    $0x8,%esp
+     19c:	68 04 48 00 00       	push   $0x4804
+     1a1:	ff 35 a0 69 00 00    	push   0x69a0
+     1a7:	e8 84 41 00 00       	call   4330 <printf>
+}
+     1ac:	83 c4 10             	add    $0x10,%esp
+     1af:	c9                   	leave
+     1b0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1b1:	50                   	push   %eax
+     1b2:	50                   	push   %eax
+     1b3:	68 38 47 00 00       	push   $0x4738
+     1b8:	ff 35 a0 69 00 00    	push   0x69a0
+     1be:	e8 6d 41 00 00       	call   4330 <printf>
+    exit(1);
+     1c3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     1ca:	e8 84 3f 00 00       	call   4153 <exit>
+    printf(stdout, "chdir / failed\n");
+     1cf:	50                   	push   %eax
+     1d0:	50                   	push   %eax
+     1d1:	68 83 47 00 00       	push   $0x4783
+     1d6:	ff 35 a0 69 00 00    	push   0x69a0
+     1dc:	e8 4f 41 00 00       	call   4330 <printf>
+    exit(1);
+     1e1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     1e8:	e8 66 3f 00 00       	call   4153 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1ed:	52                   	push   %edx
+     1ee:	52                   	push   %edx
+     1ef:	68 67 47 00 00       	push   $0x4767
+     1f4:	ff 35 a0 69 00 00    	push   0x69a0
+     1fa:	e8 31 41 00 00       	call   4330 <printf>
+    exit(1);
+     1ff:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     206:	e8 48 3f 00 00       	call   4153 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     20b:	51                   	push   %ecx
+     20c:	51                   	push   %ecx
+     20d:	68 46 47 00 00       	push   $0x4746
+     212:	ff 35 a0 69 00 00    	push   0x69a0
+     218:	e8 13 41 00 00       	call   4330 <printf>
+    exit(1);
+     21d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     224:	e8 2a 3f 00 00       	call   4153 <exit>
+     229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <exitiputtest>:
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     236:	68 93 47 00 00       	push   $0x4793
+     23b:	ff 35 a0 69 00 00    	push   0x69a0
+     241:	e8 ea 40 00 00       	call   4330 <printf>
+  pid = fork();
+     246:	e8 00 3f 00 00       	call   414b <fork>
+  if(pid < 0){
+     24b:	83 c4 10             	add    $0x10,%esp
+     24e:	85 c0                	test   %eax,%eax
+     250:	0f 88 a1 00 00 00    	js     2f7 <exitiputtest+0xc7>
+  if(pid == 0){
+     256:	75 58                	jne    2b0 <exitiputtest+0x80>
+    if(mkdir("iputdir") < 0){
+     258:	83 ec 0c             	sub    $0xc,%esp
+     25b:	68 5f 47 00 00       	push   $0x475f
+     260:	e8 56 3f 00 00       	call   41bb <mkdir>
+     265:	83 c4 10             	add    $0x10,%esp
+     268:	85 c0                	test   %eax,%eax
+     26a:	0f 88 a5 00 00 00    	js     315 <exitiputtest+0xe5>
+    if(chdir("iputdir") < 0){
+     270:	83 ec 0c             	sub    $0xc,%esp
+     273:	68 5f 47 00 00       	push   $0x475f
+     278:	e8 46 3f 00 00       	call   41c3 <chdir>
+     27d:	83 c4 10             	add    $0x10,%esp
+     280:	85 c0                	test   %eax,%eax
+     282:	0f 88 ab 00 00 00    	js     333 <exitiputtest+0x103>
+    if(unlink("../iputdir") < 0){
+     288:	83 ec 0c             	sub    $0xc,%esp
+     28b:	68 5c 47 00 00       	push   $0x475c
+     290:	e8 0e 3f 00 00       	call   41a3 <unlink>
+     295:	83 c4 10             	add    $0x10,%esp
+     298:	85 c0                	test   %eax,%eax
+     29a:	78 3c                	js     2d8 <exitiputtest+0xa8>
+    exit(0);
+     29c:	83 ec 0c             	sub    $0xc,%esp
+     29f:	6a 00                	push   $0x0
+     2a1:	e8 ad 3e 00 00       	call   4153 <exit>
+     2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2ad:	8d 76 00             	lea    0x0(%esi),%esi
+  wait(&estatus);
+     2b0:	83 ec 0c             	sub    $0xc,%esp
+     2b3:	68 d0 90 00 00       	push   $0x90d0
+     2b8:	e8 9e 3e 00 00       	call   415b <wait>
+  printf(stdout, "exitiput test ok\n");
+     2bd:	58                   	pop    %eax
+     2be:	5a                   	pop    %edx
+     2bf:	68 b6 47 00 00       	push   $0x47b6
+     2c4:	ff 35 a0 69 00 00    	push   0x69a0
+     2ca:	e8 61 40 00 00       	call   4330 <printf>
+}
+     2cf:	83 c4 10             	add    $0x10,%esp
+     2d2:	c9                   	leave
+     2d3:	c3                   	ret
+     2d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2d8:	83 ec 08             	sub    $0x8,%esp
+     2db:	68 67 47 00 00       	push   $0x4767
+     2e0:	ff 35 a0 69 00 00    	push   0x69a0
+     2e6:	e8 45 40 00 00       	call   4330 <printf>
+      exit(1);
+     2eb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     2f2:	e8 5c 3e 00 00       	call   4153 <exit>
+    printf(stdout, "fork failed\n");
+     2f7:	50                   	push   %eax
+     2f8:	50                   	push   %eax
+     2f9:	68 21 57 00 00       	push   $0x5721
+     2fe:	ff 35 a0 69 00 00    	push   0x69a0
+     304:	e8 27 40 00 00       	call   4330 <printf>
+    exit(1);
+     309:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     310:	e8 3e 3e 00 00       	call   4153 <exit>
+      printf(stdout, "mkdir failed\n");
+     315:	50                   	push   %eax
+     316:	50                   	push   %eax
+     317:	68 38 47 00 00       	push   $0x4738
+     31c:	ff 35 a0 69 00 00    	push   0x69a0
+     322:	e8 09 40 00 00       	call   4330 <printf>
+      exit(1);
+     327:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     32e:	e8 20 3e 00 00       	call   4153 <exit>
+      printf(stdout, "child chdir failed\n");
+     333:	51                   	push   %ecx
+     334:	51                   	push   %ecx
+     335:	68 a2 47 00 00       	push   $0x47a2
+     33a:	ff 35 a0 69 00 00    	push   0x69a0
+     340:	e8 eb 3f 00 00       	call   4330 <printf>
+      exit(1);
+     345:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     34c:	e8 02 3e 00 00       	call   4153 <exit>
+     351:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35f:	90                   	nop
+
+00000360 <openiputtest>:
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     366:	68 c8 47 00 00       	push   $0x47c8
+     36b:	ff 35 a0 69 00 00    	push   0x69a0
+     371:	e8 ba 3f 00 00       	call   4330 <printf>
+  if(mkdir("oidir") < 0){
+     376:	c7 04 24 d7 47 00 00 	movl   $0x47d7,(%esp)
+     37d:	e8 39 3e 00 00       	call   41bb <mkdir>
+     382:	83 c4 10             	add    $0x10,%esp
+     385:	85 c0                	test   %eax,%eax
+     387:	0f 88 bb 00 00 00    	js     448 <openiputtest+0xe8>
+  pid = fork();
+     38d:	e8 b9 3d 00 00       	call   414b <fork>
+  if(pid < 0){
+     392:	85 c0                	test   %eax,%eax
+     394:	0f 88 90 00 00 00    	js     42a <openiputtest+0xca>
+  if(pid == 0){
+     39a:	75 3c                	jne    3d8 <openiputtest+0x78>
+    int fd = open("oidir", O_RDWR);
+     39c:	83 ec 08             	sub    $0x8,%esp
+     39f:	6a 02                	push   $0x2
+     3a1:	68 d7 47 00 00       	push   $0x47d7
+     3a6:	e8 e8 3d 00 00       	call   4193 <open>
+    if(fd >= 0){
+     3ab:	83 c4 10             	add    $0x10,%esp
+     3ae:	85 c0                	test   %eax,%eax
+     3b0:	78 6e                	js     420 <openiputtest+0xc0>
+      printf(stdout, "open directory for write succeeded\n");
+     3b2:	83 ec 08             	sub    $0x8,%esp
+     3b5:	68 04 58 00 00       	push   $0x5804
+     3ba:	ff 35 a0 69 00 00    	push   0x69a0
+     3c0:	e8 6b 3f 00 00       	call   4330 <printf>
+      exit(0);
+     3c5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+     3cc:	e8 82 3d 00 00       	call   4153 <exit>
+     3d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sleep(1);
+     3d8:	83 ec 0c             	sub    $0xc,%esp
+     3db:	6a 01                	push   $0x1
+     3dd:	e8 01 3e 00 00       	call   41e3 <sleep>
+  if(unlink("oidir") != 0){
+     3e2:	c7 04 24 d7 47 00 00 	movl   $0x47d7,(%esp)
+     3e9:	e8 b5 3d 00 00       	call   41a3 <unlink>
+     3ee:	83 c4 10             	add    $0x10,%esp
+     3f1:	85 c0                	test   %eax,%eax
+     3f3:	75 71                	jne    466 <openiputtest+0x106>
+  wait(&estatus);
+     3f5:	83 ec 0c             	sub    $0xc,%esp
+     3f8:	68 d0 90 00 00       	push   $0x90d0
+     3fd:	e8 59 3d 00 00       	call   415b <wait>
+  printf(stdout, "openiput test ok\n");
+     402:	58                   	pop    %eax
+     403:	5a                   	pop    %edx
+     404:	68 00 48 00 00       	push   $0x4800
+     409:	ff 35 a0 69 00 00    	push   0x69a0
+     40f:	e8 1c 3f 00 00       	call   4330 <printf>
+}
+     414:	83 c4 10             	add    $0x10,%esp
+     417:	c9                   	leave
+     418:	c3                   	ret
+     419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    exit(0);
+     420:	83 ec 0c             	sub    $0xc,%esp
+     423:	6a 00                	push   $0x0
+     425:	e8 29 3d 00 00       	call   4153 <exit>
+    printf(stdout, "fork failed\n");
+     42a:	50                   	push   %eax
+     42b:	50                   	push   %eax
+     42c:	68 21 57 00 00       	push   $0x5721
+     431:	ff 35 a0 69 00 00    	push   0x69a0
+     437:	e8 f4 3e 00 00       	call   4330 <printf>
+    exit(1);
+     43c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     443:	e8 0b 3d 00 00       	call   4153 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     448:	50                   	push   %eax
+     449:	50                   	push   %eax
+     44a:	68 dd 47 00 00       	push   $0x47dd
+     44f:	ff 35 a0 69 00 00    	push   0x69a0
+     455:	e8 d6 3e 00 00       	call   4330 <printf>
+    exit(1);
+     45a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     461:	e8 ed 3c 00 00       	call   4153 <exit>
+    printf(stdout, "unlink failed\n");
+     466:	51                   	push   %ecx
+     467:	51                   	push   %ecx
+     468:	68 f1 47 00 00       	push   $0x47f1
+     46d:	ff 35 a0 69 00 00    	push   0x69a0
+     473:	e8 b8 3e 00 00       	call   4330 <printf>
+    exit(1);
+     478:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     47f:	e8 cf 3c 00 00       	call   4153 <exit>
+     484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     48f:	90                   	nop
+
+00000490 <opentest>:
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     496:	68 12 48 00 00       	push   $0x4812
+     49b:	ff 35 a0 69 00 00    	push   0x69a0
+     4a1:	e8 8a 3e 00 00       	call   4330 <printf>
+  fd = open("echo", 0);
+     4a6:	58                   	pop    %eax
+     4a7:	5a                   	pop    %edx
+     4a8:	6a 00                	push   $0x0
+     4aa:	68 1d 48 00 00       	push   $0x481d
+     4af:	e8 df 3c 00 00       	call   4193 <open>
+  if(fd < 0){
+     4b4:	83 c4 10             	add    $0x10,%esp
+     4b7:	85 c0                	test   %eax,%eax
+     4b9:	78 36                	js     4f1 <opentest+0x61>
+  close(fd);
+     4bb:	83 ec 0c             	sub    $0xc,%esp
+     4be:	50                   	push   %eax
+     4bf:	e8 b7 3c 00 00       	call   417b <close>
+  fd = open("doesnotexist", 0);
+     4c4:	5a                   	pop    %edx
+     4c5:	59                   	pop    %ecx
+     4c6:	6a 00                	push   $0x0
+     4c8:	68 35 48 00 00       	push   $0x4835
+     4cd:	e8 c1 3c 00 00       	call   4193 <open>
+  if(fd >= 0){
+     4d2:	83 c4 10             	add    $0x10,%esp
+     4d5:	85 c0                	test   %eax,%eax
+     4d7:	79 36                	jns    50f <opentest+0x7f>
+  printf(stdout, "open test ok\n");
+     4d9:	83 ec 08             	sub    $0x8,%esp
+     4dc:	68 60 48 00 00       	push   $0x4860
+     4e1:	ff 35 a0 69 00 00    	push   0x69a0
+     4e7:	e8 44 3e 00 00       	call   4330 <printf>
+}
+     4ec:	83 c4 10             	add    $0x10,%esp
+     4ef:	c9                   	leave
+     4f0:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     4f1:	50                   	push   %eax
+     4f2:	50                   	push   %eax
+     4f3:	68 22 48 00 00       	push   $0x4822
+     4f8:	ff 35 a0 69 00 00    	push   0x69a0
+     4fe:	e8 2d 3e 00 00       	call   4330 <printf>
+    exit(1);
+     503:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     50a:	e8 44 3c 00 00       	call   4153 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     50f:	50                   	push   %eax
+     510:	50                   	push   %eax
+     511:	68 42 48 00 00       	push   $0x4842
+     516:	ff 35 a0 69 00 00    	push   0x69a0
+     51c:	e8 0f 3e 00 00       	call   4330 <printf>
+    exit(1);
+     521:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     528:	e8 26 3c 00 00       	call   4153 <exit>
+     52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <writetest>:
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	56                   	push   %esi
+     534:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     535:	83 ec 08             	sub    $0x8,%esp
+     538:	68 6e 48 00 00       	push   $0x486e
+     53d:	ff 35 a0 69 00 00    	push   0x69a0
+     543:	e8 e8 3d 00 00       	call   4330 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     548:	58                   	pop    %eax
+     549:	5a                   	pop    %edx
+     54a:	68 02 02 00 00       	push   $0x202
+     54f:	68 7f 48 00 00       	push   $0x487f
+     554:	e8 3a 3c 00 00       	call   4193 <open>
+  if(fd >= 0){
+     559:	83 c4 10             	add    $0x10,%esp
+     55c:	85 c0                	test   %eax,%eax
+     55e:	0f 88 af 01 00 00    	js     713 <writetest+0x1e3>
+    printf(stdout, "creat small succeeded; ok\n");
+     564:	83 ec 08             	sub    $0x8,%esp
+     567:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     569:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     56b:	68 85 48 00 00       	push   $0x4885
+     570:	ff 35 a0 69 00 00    	push   0x69a0
+     576:	e8 b5 3d 00 00       	call   4330 <printf>
+     57b:	83 c4 10             	add    $0x10,%esp
+     57e:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     580:	83 ec 04             	sub    $0x4,%esp
+     583:	6a 0a                	push   $0xa
+     585:	68 bc 48 00 00       	push   $0x48bc
+     58a:	56                   	push   %esi
+     58b:	e8 e3 3b 00 00       	call   4173 <write>
+     590:	83 c4 10             	add    $0x10,%esp
+     593:	83 f8 0a             	cmp    $0xa,%eax
+     596:	0f 85 dd 00 00 00    	jne    679 <writetest+0x149>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     59c:	83 ec 04             	sub    $0x4,%esp
+     59f:	6a 0a                	push   $0xa
+     5a1:	68 c7 48 00 00       	push   $0x48c7
+     5a6:	56                   	push   %esi
+     5a7:	e8 c7 3b 00 00       	call   4173 <write>
+     5ac:	83 c4 10             	add    $0x10,%esp
+     5af:	83 f8 0a             	cmp    $0xa,%eax
+     5b2:	0f 85 e1 00 00 00    	jne    699 <writetest+0x169>
+  for(i = 0; i < 100; i++){
+     5b8:	83 c3 01             	add    $0x1,%ebx
+     5bb:	83 fb 64             	cmp    $0x64,%ebx
+     5be:	75 c0                	jne    580 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     5c0:	83 ec 08             	sub    $0x8,%esp
+     5c3:	68 d2 48 00 00       	push   $0x48d2
+     5c8:	ff 35 a0 69 00 00    	push   0x69a0
+     5ce:	e8 5d 3d 00 00       	call   4330 <printf>
+  close(fd);
+     5d3:	89 34 24             	mov    %esi,(%esp)
+     5d6:	e8 a0 3b 00 00       	call   417b <close>
+  fd = open("small", O_RDONLY);
+     5db:	5b                   	pop    %ebx
+     5dc:	5e                   	pop    %esi
+     5dd:	6a 00                	push   $0x0
+     5df:	68 7f 48 00 00       	push   $0x487f
+     5e4:	e8 aa 3b 00 00       	call   4193 <open>
+  if(fd >= 0){
+     5e9:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     5ec:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     5ee:	85 c0                	test   %eax,%eax
+     5f0:	0f 88 c3 00 00 00    	js     6b9 <writetest+0x189>
+    printf(stdout, "open small succeeded ok\n");
+     5f6:	83 ec 08             	sub    $0x8,%esp
+     5f9:	68 dd 48 00 00       	push   $0x48dd
+     5fe:	ff 35 a0 69 00 00    	push   0x69a0
+     604:	e8 27 3d 00 00       	call   4330 <printf>
+  i = read(fd, buf, 2000);
+     609:	83 c4 0c             	add    $0xc,%esp
+     60c:	68 d0 07 00 00       	push   $0x7d0
+     611:	68 e0 90 00 00       	push   $0x90e0
+     616:	53                   	push   %ebx
+     617:	e8 4f 3b 00 00       	call   416b <read>
+  if(i == 2000){
+     61c:	83 c4 10             	add    $0x10,%esp
+     61f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     624:	0f 85 ad 00 00 00    	jne    6d7 <writetest+0x1a7>
+    printf(stdout, "read succeeded ok\n");
+     62a:	83 ec 08             	sub    $0x8,%esp
+     62d:	68 11 49 00 00       	push   $0x4911
+     632:	ff 35 a0 69 00 00    	push   0x69a0
+     638:	e8 f3 3c 00 00       	call   4330 <printf>
+  close(fd);
+     63d:	89 1c 24             	mov    %ebx,(%esp)
+     640:	e8 36 3b 00 00       	call   417b <close>
+  if(unlink("small") < 0){
+     645:	c7 04 24 7f 48 00 00 	movl   $0x487f,(%esp)
+     64c:	e8 52 3b 00 00       	call   41a3 <unlink>
+     651:	83 c4 10             	add    $0x10,%esp
+     654:	85 c0                	test   %eax,%eax
+     656:	0f 88 99 00 00 00    	js     6f5 <writetest+0x1c5>
+  printf(stdout, "small file test ok\n");
+     65c:	83 ec 08             	sub    $0x8,%esp
+     65f:	68 39 49 00 00       	push   $0x4939
+     664:	ff 35 a0 69 00 00    	push   0x69a0
+     66a:	e8 c1 3c 00 00       	call   4330 <printf>
+}
+     66f:	83 c4 10             	add    $0x10,%esp
+     672:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     675:	5b                   	pop    %ebx
+     676:	5e                   	pop    %esi
+     677:	5d                   	pop    %ebp
+     678:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     679:	83 ec 04             	sub    $0x4,%esp
+     67c:	53                   	push   %ebx
+     67d:	68 28 58 00 00       	push   $0x5828
+     682:	ff 35 a0 69 00 00    	push   0x69a0
+     688:	e8 a3 3c 00 00       	call   4330 <printf>
+      exit(1);
+     68d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     694:	e8 ba 3a 00 00       	call   4153 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     699:	83 ec 04             	sub    $0x4,%esp
+     69c:	53                   	push   %ebx
+     69d:	68 4c 58 00 00       	push   $0x584c
+     6a2:	ff 35 a0 69 00 00    	push   0x69a0
+     6a8:	e8 83 3c 00 00       	call   4330 <printf>
+      exit(1);
+     6ad:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     6b4:	e8 9a 3a 00 00       	call   4153 <exit>
+    printf(stdout, "error: open small failed!\n");
+     6b9:	51                   	push   %ecx
+     6ba:	51                   	push   %ecx
+     6bb:	68 f6 48 00 00       	push   $0x48f6
+     6c0:	ff 35 a0 69 00 00    	push   0x69a0
+     6c6:	e8 65 3c 00 00       	call   4330 <printf>
+    exit(1);
+     6cb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     6d2:	e8 7c 3a 00 00       	call   4153 <exit>
+    printf(stdout, "read failed\n");
+     6d7:	52                   	push   %edx
+     6d8:	52                   	push   %edx
+     6d9:	68 e5 4c 00 00       	push   $0x4ce5
+     6de:	ff 35 a0 69 00 00    	push   0x69a0
+     6e4:	e8 47 3c 00 00       	call   4330 <printf>
+    exit(1);
+     6e9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     6f0:	e8 5e 3a 00 00       	call   4153 <exit>
+    printf(stdout, "unlink small failed\n");
+     6f5:	50                   	push   %eax
+     6f6:	50                   	push   %eax
+     6f7:	68 24 49 00 00       	push   $0x4924
+     6fc:	ff 35 a0 69 00 00    	push   0x69a0
+     702:	e8 29 3c 00 00       	call   4330 <printf>
+    exit(1);
+     707:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     70e:	e8 40 3a 00 00       	call   4153 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     713:	50                   	push   %eax
+     714:	50                   	push   %eax
+     715:	68 a0 48 00 00       	push   $0x48a0
+     71a:	ff 35 a0 69 00 00    	push   0x69a0
+     720:	e8 0b 3c 00 00       	call   4330 <printf>
+    exit(1);
+     725:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     72c:	e8 22 3a 00 00       	call   4153 <exit>
+     731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73f:	90                   	nop
+
+00000740 <writetest1>:
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	56                   	push   %esi
+     744:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     745:	83 ec 08             	sub    $0x8,%esp
+     748:	68 4d 49 00 00       	push   $0x494d
+     74d:	ff 35 a0 69 00 00    	push   0x69a0
+     753:	e8 d8 3b 00 00       	call   4330 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     758:	58                   	pop    %eax
+     759:	5a                   	pop    %edx
+     75a:	68 02 02 00 00       	push   $0x202
+     75f:	68 c7 49 00 00       	push   $0x49c7
+     764:	e8 2a 3a 00 00       	call   4193 <open>
+  if(fd < 0){
+     769:	83 c4 10             	add    $0x10,%esp
+     76c:	85 c0                	test   %eax,%eax
+     76e:	0f 88 88 01 00 00    	js     8fc <writetest1+0x1bc>
+     774:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     776:	31 db                	xor    %ebx,%ebx
+     778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77f:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     780:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     783:	89 1d e0 90 00 00    	mov    %ebx,0x90e0
+    if(write(fd, buf, 512) != 512){
+     789:	68 00 02 00 00       	push   $0x200
+     78e:	68 e0 90 00 00       	push   $0x90e0
+     793:	56                   	push   %esi
+     794:	e8 da 39 00 00       	call   4173 <write>
+     799:	83 c4 10             	add    $0x10,%esp
+     79c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7a1:	0f 85 b7 00 00 00    	jne    85e <writetest1+0x11e>
+  for(i = 0; i < MAXFILE; i++){
+     7a7:	83 c3 01             	add    $0x1,%ebx
+     7aa:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     7b0:	75 ce                	jne    780 <writetest1+0x40>
+  close(fd);
+     7b2:	83 ec 0c             	sub    $0xc,%esp
+     7b5:	56                   	push   %esi
+     7b6:	e8 c0 39 00 00       	call   417b <close>
+  fd = open("big", O_RDONLY);
+     7bb:	5b                   	pop    %ebx
+     7bc:	5e                   	pop    %esi
+     7bd:	6a 00                	push   $0x0
+     7bf:	68 c7 49 00 00       	push   $0x49c7
+     7c4:	e8 ca 39 00 00       	call   4193 <open>
+  if(fd < 0){
+     7c9:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     7cc:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     7ce:	85 c0                	test   %eax,%eax
+     7d0:	0f 88 08 01 00 00    	js     8de <writetest1+0x19e>
+  n = 0;
+     7d6:	31 f6                	xor    %esi,%esi
+     7d8:	eb 21                	jmp    7fb <writetest1+0xbb>
+     7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     7e0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7e5:	0f 85 b1 00 00 00    	jne    89c <writetest1+0x15c>
+    if(((int*)buf)[0] != n){
+     7eb:	a1 e0 90 00 00       	mov    0x90e0,%eax
+     7f0:	39 f0                	cmp    %esi,%eax
+     7f2:	0f 85 86 00 00 00    	jne    87e <writetest1+0x13e>
+    n++;
+     7f8:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     7fb:	83 ec 04             	sub    $0x4,%esp
+     7fe:	68 00 02 00 00       	push   $0x200
+     803:	68 e0 90 00 00       	push   $0x90e0
+     808:	53                   	push   %ebx
+     809:	e8 5d 39 00 00       	call   416b <read>
+    if(i == 0){
+     80e:	83 c4 10             	add    $0x10,%esp
+     811:	85 c0                	test   %eax,%eax
+     813:	75 cb                	jne    7e0 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     815:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     81b:	0f 84 9b 00 00 00    	je     8bc <writetest1+0x17c>
+  close(fd);
+     821:	83 ec 0c             	sub    $0xc,%esp
+     824:	53                   	push   %ebx
+     825:	e8 51 39 00 00       	call   417b <close>
+  if(unlink("big") < 0){
+     82a:	c7 04 24 c7 49 00 00 	movl   $0x49c7,(%esp)
+     831:	e8 6d 39 00 00       	call   41a3 <unlink>
+     836:	83 c4 10             	add    $0x10,%esp
+     839:	85 c0                	test   %eax,%eax
+     83b:	0f 88 d9 00 00 00    	js     91a <writetest1+0x1da>
+  printf(stdout, "big files ok\n");
+     841:	83 ec 08             	sub    $0x8,%esp
+     844:	68 ee 49 00 00       	push   $0x49ee
+     849:	ff 35 a0 69 00 00    	push   0x69a0
+     84f:	e8 dc 3a 00 00       	call   4330 <printf>
+}
+     854:	83 c4 10             	add    $0x10,%esp
+     857:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     85a:	5b                   	pop    %ebx
+     85b:	5e                   	pop    %esi
+     85c:	5d                   	pop    %ebp
+     85d:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     85e:	83 ec 04             	sub    $0x4,%esp
+     861:	53                   	push   %ebx
+     862:	68 77 49 00 00       	push   $0x4977
+     867:	ff 35 a0 69 00 00    	push   0x69a0
+     86d:	e8 be 3a 00 00       	call   4330 <printf>
+      exit(1);
+     872:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     879:	e8 d5 38 00 00       	call   4153 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     87e:	50                   	push   %eax
+     87f:	56                   	push   %esi
+     880:	68 70 58 00 00       	push   $0x5870
+     885:	ff 35 a0 69 00 00    	push   0x69a0
+     88b:	e8 a0 3a 00 00       	call   4330 <printf>
+      exit(1);
+     890:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     897:	e8 b7 38 00 00       	call   4153 <exit>
+      printf(stdout, "read failed %d\n", i);
+     89c:	83 ec 04             	sub    $0x4,%esp
+     89f:	50                   	push   %eax
+     8a0:	68 cb 49 00 00       	push   $0x49cb
+     8a5:	ff 35 a0 69 00 00    	push   0x69a0
+     8ab:	e8 80 3a 00 00       	call   4330 <printf>
+      exit(1);
+     8b0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     8b7:	e8 97 38 00 00       	call   4153 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     8bc:	52                   	push   %edx
+     8bd:	68 8b 00 00 00       	push   $0x8b
+     8c2:	68 ae 49 00 00       	push   $0x49ae
+     8c7:	ff 35 a0 69 00 00    	push   0x69a0
+     8cd:	e8 5e 3a 00 00       	call   4330 <printf>
+        exit(1);
+     8d2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     8d9:	e8 75 38 00 00       	call   4153 <exit>
+    printf(stdout, "error: open big failed!\n");
+     8de:	51                   	push   %ecx
+     8df:	51                   	push   %ecx
+     8e0:	68 95 49 00 00       	push   $0x4995
+     8e5:	ff 35 a0 69 00 00    	push   0x69a0
+     8eb:	e8 40 3a 00 00       	call   4330 <printf>
+    exit(1);
+     8f0:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     8f7:	e8 57 38 00 00       	call   4153 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     8fc:	50                   	push   %eax
+     8fd:	50                   	push   %eax
+     8fe:	68 5d 49 00 00       	push   $0x495d
+     903:	ff 35 a0 69 00 00    	push   0x69a0
+     909:	e8 22 3a 00 00       	call   4330 <printf>
+    exit(1);
+     90e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     915:	e8 39 38 00 00       	call   4153 <exit>
+    printf(stdout, "unlink big failed\n");
+     91a:	50                   	push   %eax
+     91b:	50                   	push   %eax
+     91c:	68 db 49 00 00       	push   $0x49db
+     921:	ff 35 a0 69 00 00    	push   0x69a0
+     927:	e8 04 3a 00 00       	call   4330 <printf>
+    exit(1);
+     92c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     933:	e8 1b 38 00 00       	call   4153 <exit>
+     938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     93f:	90                   	nop
+
+00000940 <createtest>:
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	53                   	push   %ebx
+  name[2] = '\0';
+     944:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     949:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     94c:	68 90 58 00 00       	push   $0x5890
+     951:	ff 35 a0 69 00 00    	push   0x69a0
+     957:	e8 d4 39 00 00       	call   4330 <printf>
+  name[0] = 'a';
+     95c:	c6 05 d4 90 00 00 61 	movb   $0x61,0x90d4
+  name[2] = '\0';
+     963:	83 c4 10             	add    $0x10,%esp
+     966:	c6 05 d6 90 00 00 00 	movb   $0x0,0x90d6
+  for(i = 0; i < 52; i++){
+     96d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     970:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     973:	88 1d d5 90 00 00    	mov    %bl,0x90d5
+  for(i = 0; i < 52; i++){
+     979:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     97c:	68 02 02 00 00       	push   $0x202
+     981:	68 d4 90 00 00       	push   $0x90d4
+     986:	e8 08 38 00 00       	call   4193 <open>
+    close(fd);
+     98b:	89 04 24             	mov    %eax,(%esp)
+     98e:	e8 e8 37 00 00       	call   417b <close>
+  for(i = 0; i < 52; i++){
+     993:	83 c4 10             	add    $0x10,%esp
+     996:	80 fb 64             	cmp    $0x64,%bl
+     999:	75 d5                	jne    970 <createtest+0x30>
+  name[0] = 'a';
+     99b:	c6 05 d4 90 00 00 61 	movb   $0x61,0x90d4
+  name[2] = '\0';
+     9a2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     9a7:	c6 05 d6 90 00 00 00 	movb   $0x0,0x90d6
+  for(i = 0; i < 52; i++){
+     9ae:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     9b0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     9b3:	88 1d d5 90 00 00    	mov    %bl,0x90d5
+  for(i = 0; i < 52; i++){
+     9b9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     9bc:	68 d4 90 00 00       	push   $0x90d4
+     9c1:	e8 dd 37 00 00       	call   41a3 <unlink>
+  for(i = 0; i < 52; i++){
+     9c6:	83 c4 10             	add    $0x10,%esp
+     9c9:	80 fb 64             	cmp    $0x64,%bl
+     9cc:	75 e2                	jne    9b0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     9ce:	83 ec 08             	sub    $0x8,%esp
+     9d1:	68 b8 58 00 00       	push   $0x58b8
+     9d6:	ff 35 a0 69 00 00    	push   0x69a0
+     9dc:	e8 4f 39 00 00       	call   4330 <printf>
+}
+     9e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     9e4:	83 c4 10             	add    $0x10,%esp
+     9e7:	c9                   	leave
+     9e8:	c3                   	ret
+     9e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009f0 <dirtest>:
+{
+     9f0:	55                   	push   %ebp
+     9f1:	89 e5                	mov    %esp,%ebp
+     9f3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     9f6:	68 fc 49 00 00       	push   $0x49fc
+     9fb:	ff 35 a0 69 00 00    	push   0x69a0
+     a01:	e8 2a 39 00 00       	call   4330 <printf>
+  if(mkdir("dir0") < 0){
+     a06:	c7 04 24 08 4a 00 00 	movl   $0x4a08,(%esp)
+     a0d:	e8 a9 37 00 00       	call   41bb <mkdir>
+     a12:	83 c4 10             	add    $0x10,%esp
+     a15:	85 c0                	test   %eax,%eax
+     a17:	78 58                	js     a71 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     a19:	83 ec 0c             	sub    $0xc,%esp
+     a1c:	68 08 4a 00 00       	push   $0x4a08
+     a21:	e8 9d 37 00 00       	call   41c3 <chdir>
+     a26:	83 c4 10             	add    $0x10,%esp
+     a29:	85 c0                	test   %eax,%eax
+     a2b:	0f 88 9a 00 00 00    	js     acb <dirtest+0xdb>
+  if(chdir("..") < 0){
+     a31:	83 ec 0c             	sub    $0xc,%esp
+     a34:	68 55 50 00 00       	push   $0x5055
+     a39:	e8 85 37 00 00       	call   41c3 <chdir>
+     a3e:	83 c4 10             	add    $0x10,%esp
+     a41:	85 c0                	test   %eax,%eax
+     a43:	78 68                	js     aad <dirtest+0xbd>
+  if(unlink("dir0") < 0){
+     a45:	83 ec 0c             	sub    $0xc,%esp
+     a48:	68 08 4a 00 00       	push   $0x4a08
+     a4d:	e8 51 37 00 00       	call   41a3 <unlink>
+     a52:	83 c4 10             	add    $0x10,%esp
+     a55:	85 c0                	test   %eax,%eax
+     a57:	78 36                	js     a8f <dirtest+0x9f>
+  printf(stdout, "mkdir test ok\n");
+     a59:	83 ec 08             	sub    $0x8,%esp
+     a5c:	68 45 4a 00 00       	push   $0x4a45
+     a61:	ff 35 a0 69 00 00    	push   0x69a0
+     a67:	e8 c4 38 00 00       	call   4330 <printf>
+}
+     a6c:	83 c4 10             	add    $0x10,%esp
+     a6f:	c9                   	leave
+     a70:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     a71:	50                   	push   %eax
+     a72:	50                   	push   %eax
+     a73:	68 38 47 00 00       	push   $0x4738
+     a78:	ff 35 a0 69 00 00    	push   0x69a0
+     a7e:	e8 ad 38 00 00       	call   4330 <printf>
+    exit(1);
+     a83:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     a8a:	e8 c4 36 00 00       	call   4153 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     a8f:	50                   	push   %eax
+     a90:	50                   	push   %eax
+     a91:	68 31 4a 00 00       	push   $0x4a31
+     a96:	ff 35 a0 69 00 00    	push   0x69a0
+     a9c:	e8 8f 38 00 00       	call   4330 <printf>
+    exit(1);
+     aa1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     aa8:	e8 a6 36 00 00       	call   4153 <exit>
+    printf(stdout, "chdir .. failed\n");
+     aad:	52                   	push   %edx
+     aae:	52                   	push   %edx
+     aaf:	68 20 4a 00 00       	push   $0x4a20
+     ab4:	ff 35 a0 69 00 00    	push   0x69a0
+     aba:	e8 71 38 00 00       	call   4330 <printf>
+    exit(1);
+     abf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     ac6:	e8 88 36 00 00       	call   4153 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     acb:	51                   	push   %ecx
+     acc:	51                   	push   %ecx
+     acd:	68 0d 4a 00 00       	push   $0x4a0d
+     ad2:	ff 35 a0 69 00 00    	push   0x69a0
+     ad8:	e8 53 38 00 00       	call   4330 <printf>
+    exit(1);
+     add:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     ae4:	e8 6a 36 00 00       	call   4153 <exit>
+     ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000af0 <exectest>:
+{
+     af0:	55                   	push   %ebp
+     af1:	89 e5                	mov    %esp,%ebp
+     af3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     af6:	68 54 4a 00 00       	push   $0x4a54
+     afb:	ff 35 a0 69 00 00    	push   0x69a0
+     b01:	e8 2a 38 00 00       	call   4330 <printf>
+  if(exec("echo", echoargv) < 0){
+     b06:	5a                   	pop    %edx
+     b07:	59                   	pop    %ecx
+     b08:	68 a4 69 00 00       	push   $0x69a4
+     b0d:	68 1d 48 00 00       	push   $0x481d
+     b12:	e8 74 36 00 00       	call   418b <exec>
+     b17:	83 c4 10             	add    $0x10,%esp
+     b1a:	85 c0                	test   %eax,%eax
+     b1c:	78 02                	js     b20 <exectest+0x30>
+}
+     b1e:	c9                   	leave
+     b1f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     b20:	50                   	push   %eax
+     b21:	50                   	push   %eax
+     b22:	68 5f 4a 00 00       	push   $0x4a5f
+     b27:	ff 35 a0 69 00 00    	push   0x69a0
+     b2d:	e8 fe 37 00 00       	call   4330 <printf>
+    exit(1);
+     b32:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     b39:	e8 15 36 00 00       	call   4153 <exit>
+     b3e:	66 90                	xchg   %ax,%ax
+
+00000b40 <bcachegrow>:
+{
+     b40:	55                   	push   %ebp
+     b41:	89 e5                	mov    %esp,%ebp
+     b43:	57                   	push   %edi
+     b44:	56                   	push   %esi
+     b45:	53                   	push   %ebx
+     b46:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "bcachegrow test\n");
+     b49:	68 71 4a 00 00       	push   $0x4a71
+     b4e:	6a 01                	push   $0x1
+     b50:	e8 db 37 00 00       	call   4330 <printf>
+  fd = open("bcgrow", O_CREATE | O_RDWR);
+     b55:	58                   	pop    %eax
+     b56:	5a                   	pop    %edx
+     b57:	68 02 02 00 00       	push   $0x202
+     b5c:	68 82 4a 00 00       	push   $0x4a82
+     b61:	e8 2d 36 00 00       	call   4193 <open>
+  if(fd < 0){
+     b66:	83 c4 10             	add    $0x10,%esp
+     b69:	85 c0                	test   %eax,%eax
+     b6b:	0f 88 aa 02 00 00    	js     e1b <bcachegrow+0x2db>
+     b71:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BCGROWBLOCKS; i++){
+     b73:	31 db                	xor    %ebx,%ebx
+     b75:	8d 76 00             	lea    0x0(%esi),%esi
+    memset(buf, i, BSIZE);
+     b78:	83 ec 04             	sub    $0x4,%esp
+     b7b:	68 00 02 00 00       	push   $0x200
+     b80:	53                   	push   %ebx
+     b81:	68 e0 90 00 00       	push   $0x90e0
+     b86:	e8 45 34 00 00       	call   3fd0 <memset>
+    if(write(fd, buf, BSIZE) != BSIZE){
+     b8b:	83 c4 0c             	add    $0xc,%esp
+     b8e:	68 00 02 00 00       	push   $0x200
+     b93:	68 e0 90 00 00       	push   $0x90e0
+     b98:	56                   	push   %esi
+     b99:	e8 d5 35 00 00       	call   4173 <write>
+     b9e:	83 c4 10             	add    $0x10,%esp
+     ba1:	3d 00 02 00 00       	cmp    $0x200,%eax
+     ba6:	0f 85 54 02 00 00    	jne    e00 <bcachegrow+0x2c0>
+  for(i = 0; i < BCGROWBLOCKS; i++){
+     bac:	83 c3 01             	add    $0x1,%ebx
+     baf:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+     bb5:	75 c1                	jne    b78 <bcachegrow+0x38>
+  close(fd);
+     bb7:	83 ec 0c             	sub    $0xc,%esp
+     bba:	56                   	push   %esi
+     bbb:	e8 bb 35 00 00       	call   417b <close>
+  if(bcachestat(&st0) < 0){
+     bc0:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     bc3:	89 04 24             	mov    %eax,(%esp)
+     bc6:	e8 a8 36 00 00       	call   4273 <bcachestat>
+     bcb:	83 c4 10             	add    $0x10,%esp
+     bce:	85 c0                	test   %eax,%eax
+     bd0:	0f 88 f5 01 00 00    	js     dcb <bcachegrow+0x28b>
+  if((pid = fork()) < 0){
+     bd6:	e8 70 35 00 00       	call   414b <fork>
+     bdb:	85 c0                	test   %eax,%eax
+     bdd:	0f 88 ce 01 00 00    	js     db1 <bcachegrow+0x271>
+  for(pass = 0; pass < (pid == 0 ? 8 : 3); pass++){
+     be3:	be 00 00 00 00       	mov    $0x0,%esi
+     be8:	0f 85 99 00 00 00    	jne    c87 <bcachegrow+0x147>
+     bee:	83 fe 08             	cmp    $0x8,%esi
+     bf1:	0f 84 b0 01 00 00    	je     da7 <bcachegrow+0x267>
+      if((fd = open("bcgrow", 0)) < 0){
+     bf7:	83 ec 08             	sub    $0x8,%esp
+     bfa:	6a 00                	push   $0x0
+     bfc:	68 82 4a 00 00       	push   $0x4a82
+     c01:	e8 8d 35 00 00       	call   4193 <open>
+     c06:	83 c4 10             	add    $0x10,%esp
+     c09:	89 c7                	mov    %eax,%edi
+     c0b:	85 c0                	test   %eax,%eax
+     c0d:	0f 88 7a 01 00 00    	js     d8d <bcachegrow+0x24d>
+      for(i = 0; i < BCGROWBLOCKS; i++){
+     c13:	31 db                	xor    %ebx,%ebx
+     c15:	8d 76 00             	lea    0x0(%esi),%esi
+        if(read(fd, buf, BSIZE) != BSIZE){
+     c18:	83 ec 04             	sub    $0x4,%esp
+     c1b:	68 00 02 00 00       	push   $0x200
+     c20:	68 e0 90 00 00       	push   $0x90e0
+     c25:	57                   	push   %edi
+     c26:	e8 40 35 00 00       	call   416b <read>
+     c2b:	83 c4 10             	add    $0x10,%esp
+     c2e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c33:	0f 85 39 01 00 00    	jne    d72 <bcachegrow+0x232>
+        for(j = 0; j < BSIZE; j++){
+     c39:	31 c0                	xor    %eax,%eax
+     c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c3f:	90                   	nop
+          if(buf[j] != (char)i){
+     c40:	38 98 e0 90 00 00    	cmp    %bl,0x90e0(%eax)
+     c46:	75 62                	jne    caa <bcachegrow+0x16a>
+        for(j = 0; j < BSIZE; j++){
+     c48:	83 c0 01             	add    $0x1,%eax
+     c4b:	3d 00 02 00 00       	cmp    $0x200,%eax
+     c50:	75 ee                	jne    c40 <bcachegrow+0x100>
+      for(i = 0; i < BCGROWBLOCKS; i++){
+     c52:	83 c3 01             	add    $0x1,%ebx
+     c55:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+     c5b:	75 bb                	jne    c18 <bcachegrow+0xd8>
+      close(fd);
+     c5d:	83 ec 0c             	sub    $0xc,%esp
+  for(pass = 0; pass < (pid == 0 ? 8 : 3); pass++){
+     c60:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+     c63:	57                   	push   %edi
+     c64:	e8 12 35 00 00       	call   417b <close>
+  for(pass = 0; pass < (pid == 0 ? 8 : 3); pass++){
+     c69:	83 c4 10             	add    $0x10,%esp
+     c6c:	e9 7d ff ff ff       	jmp    bee <bcachegrow+0xae>
+      sbrk(-n * 4096);
+     c71:	89 d8                	mov    %ebx,%eax
+     c73:	83 ec 0c             	sub    $0xc,%esp
+  for(pass = 0; pass < (pid == 0 ? 8 : 3); pass++){
+     c76:	83 c6 01             	add    $0x1,%esi
+      sbrk(-n * 4096);
+     c79:	f7 d8                	neg    %eax
+     c7b:	c1 e0 0c             	shl    $0xc,%eax
+     c7e:	50                   	push   %eax
+     c7f:	e8 57 35 00 00       	call   41db <sbrk>
+  for(pass = 0; pass < (pid == 0 ? 8 : 3); pass++){
+     c84:	83 c4 10             	add    $0x10,%esp
+     c87:	83 fe 03             	cmp    $0x3,%esi
+     c8a:	74 3a                	je     cc6 <bcachegrow+0x186>
+      for(n = 0; sbrk(4096) != (char*)-1; n++)
+     c8c:	31 db                	xor    %ebx,%ebx
+     c8e:	eb 03                	jmp    c93 <bcachegrow+0x153>
+     c90:	83 c3 01             	add    $0x1,%ebx
+     c93:	83 ec 0c             	sub    $0xc,%esp
+     c96:	68 00 10 00 00       	push   $0x1000
+     c9b:	e8 3b 35 00 00       	call   41db <sbrk>
+     ca0:	83 c4 10             	add    $0x10,%esp
+     ca3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ca6:	75 e8                	jne    c90 <bcachegrow+0x150>
+     ca8:	eb c7                	jmp    c71 <bcachegrow+0x131>
+            printf(1, "bcgrow: wrong data in block %d\n", i);
+     caa:	83 ec 04             	sub    $0x4,%esp
+     cad:	53                   	push   %ebx
+     cae:	68 e0 58 00 00       	push   $0x58e0
+     cb3:	6a 01                	push   $0x1
+     cb5:	e8 76 36 00 00       	call   4330 <printf>
+            exit(1);
+     cba:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     cc1:	e8 8d 34 00 00       	call   4153 <exit>
+  wait(&estatus);
+     cc6:	83 ec 0c             	sub    $0xc,%esp
+     cc9:	68 d0 90 00 00       	push   $0x90d0
+     cce:	e8 88 34 00 00       	call   415b <wait>
+  if(estatus != 0){
+     cd3:	8b 0d d0 90 00 00    	mov    0x90d0,%ecx
+     cd9:	83 c4 10             	add    $0x10,%esp
+     cdc:	85 c9                	test   %ecx,%ecx
+     cde:	0f 85 51 01 00 00    	jne    e35 <bcachegrow+0x2f5>
+  fd = open("bcgrow", 0);
+     ce4:	83 ec 08             	sub    $0x8,%esp
+     ce7:	6a 00                	push   $0x0
+     ce9:	68 82 4a 00 00       	push   $0x4a82
+     cee:	e8 a0 34 00 00       	call   4193 <open>
+  while(read(fd, buf, BSIZE) == BSIZE)
+     cf3:	83 c4 10             	add    $0x10,%esp
+  fd = open("bcgrow", 0);
+     cf6:	89 c3                	mov    %eax,%ebx
+  while(read(fd, buf, BSIZE) == BSIZE)
+     cf8:	83 ec 04             	sub    $0x4,%esp
+     cfb:	68 00 02 00 00       	push   $0x200
+     d00:	68 e0 90 00 00       	push   $0x90e0
+     d05:	53                   	push   %ebx
+     d06:	e8 60 34 00 00       	call   416b <read>
+     d0b:	83 c4 10             	add    $0x10,%esp
+     d0e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     d13:	74 e3                	je     cf8 <bcachegrow+0x1b8>
+  close(fd);
+     d15:	83 ec 0c             	sub    $0xc,%esp
+     d18:	53                   	push   %ebx
+     d19:	e8 5d 34 00 00       	call   417b <close>
+  unlink("bcgrow");
+     d1e:	c7 04 24 82 4a 00 00 	movl   $0x4a82,(%esp)
+     d25:	e8 79 34 00 00       	call   41a3 <unlink>
+  if(bcachestat(&st) < 0){
+     d2a:	8d 45 c8             	lea    -0x38(%ebp),%eax
+     d2d:	89 04 24             	mov    %eax,(%esp)
+     d30:	e8 3e 35 00 00       	call   4273 <bcachestat>
+     d35:	83 c4 10             	add    $0x10,%esp
+     d38:	85 c0                	test   %eax,%eax
+     d3a:	0f 88 8b 00 00 00    	js     dcb <bcachegrow+0x28b>
+  if(st.shrinks == st0.shrinks || st.grows == st0.grows){
+     d40:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     d43:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+     d46:	0f 84 99 00 00 00    	je     de5 <bcachegrow+0x2a5>
+     d4c:	8b 45 b8             	mov    -0x48(%ebp),%eax
+     d4f:	39 45 d8             	cmp    %eax,-0x28(%ebp)
+     d52:	0f 84 8d 00 00 00    	je     de5 <bcachegrow+0x2a5>
+  printf(1, "bcachegrow ok\n");
+     d58:	83 ec 08             	sub    $0x8,%esp
+     d5b:	68 0a 4b 00 00       	push   $0x4b0a
+     d60:	6a 01                	push   $0x1
+     d62:	e8 c9 35 00 00       	call   4330 <printf>
+}
+     d67:	83 c4 10             	add    $0x10,%esp
+     d6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d6d:	5b                   	pop    %ebx
+     d6e:	5e                   	pop    %esi
+     d6f:	5f                   	pop    %edi
+     d70:	5d                   	pop    %ebp
+     d71:	c3                   	ret
+          printf(1, "read bcgrow failed\n");
+     d72:	83 ec 08             	sub    $0x8,%esp
+     d75:	68 db 4a 00 00       	push   $0x4adb
+     d7a:	6a 01                	push   $0x1
+     d7c:	e8 af 35 00 00       	call   4330 <printf>
+          exit(1);
+     d81:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     d88:	e8 c6 33 00 00       	call   4153 <exit>
+        printf(1, "cannot open bcgrow\n");
+     d8d:	53                   	push   %ebx
+     d8e:	53                   	push   %ebx
+     d8f:	68 c7 4a 00 00       	push   $0x4ac7
+     d94:	6a 01                	push   $0x1
+     d96:	e8 95 35 00 00       	call   4330 <printf>
+        exit(1);
+     d9b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     da2:	e8 ac 33 00 00       	call   4153 <exit>
+    exit(0);
+     da7:	83 ec 0c             	sub    $0xc,%esp
+     daa:	6a 00                	push   $0x0
+     dac:	e8 a2 33 00 00       	call   4153 <exit>
+    printf(1, "fork failed\n");
+     db1:	56                   	push   %esi
+     db2:	56                   	push   %esi
+     db3:	68 21 57 00 00       	push   $0x5721
+     db8:	6a 01                	push   $0x1
+     dba:	e8 71 35 00 00       	call   4330 <printf>
+    exit(1);
+     dbf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     dc6:	e8 88 33 00 00       	call   4153 <exit>
+    printf(1, "bcachestat failed\n");
+     dcb:	57                   	push   %edi
+     dcc:	57                   	push   %edi
+     dcd:	68 b4 4a 00 00       	push   $0x4ab4
+     dd2:	6a 01                	push   $0x1
+     dd4:	e8 57 35 00 00       	call   4330 <printf>
+    exit(1);
+     dd9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     de0:	e8 6e 33 00 00       	call   4153 <exit>
+    printf(1, "bcachegrow: cache did not shrink and grow again\n");
+     de5:	50                   	push   %eax
+     de6:	50                   	push   %eax
+     de7:	68 00 59 00 00       	push   $0x5900
+     dec:	6a 01                	push   $0x1
+     dee:	e8 3d 35 00 00       	call   4330 <printf>
+    exit(1);
+     df3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     dfa:	e8 54 33 00 00       	call   4153 <exit>
+     dff:	90                   	nop
+      printf(1, "write bcgrow failed\n");
+     e00:	83 ec 08             	sub    $0x8,%esp
+     e03:	68 9f 4a 00 00       	push   $0x4a9f
+     e08:	6a 01                	push   $0x1
+     e0a:	e8 21 35 00 00       	call   4330 <printf>
+      exit(1);
+     e0f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     e16:	e8 38 33 00 00       	call   4153 <exit>
+    printf(1, "cannot create bcgrow\n");
+     e1b:	50                   	push   %eax
+     e1c:	50                   	push   %eax
+     e1d:	68 89 4a 00 00       	push   $0x4a89
+     e22:	6a 01                	push   $0x1
+     e24:	e8 07 35 00 00       	call   4330 <printf>
+    exit(1);
+     e29:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     e30:	e8 1e 33 00 00       	call   4153 <exit>
+    printf(1, "bcachegrow: reader failed\n");
+     e35:	52                   	push   %edx
+     e36:	52                   	push   %edx
+     e37:	68 ef 4a 00 00       	push   $0x4aef
+     e3c:	6a 01                	push   $0x1
+     e3e:	e8 ed 34 00 00       	call   4330 <printf>
+    exit(1);
+     e43:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     e4a:	e8 04 33 00 00       	call   4153 <exit>
+     e4f:	90                   	nop
+
+00000e50 <pipe1>:
+{
+     e50:	55                   	push   %ebp
+     e51:	89 e5                	mov    %esp,%ebp
+     e53:	57                   	push   %edi
+     e54:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     e55:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     e58:	53                   	push   %ebx
+     e59:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     e5c:	50                   	push   %eax
+     e5d:	e8 01 33 00 00       	call   4163 <pipe>
+     e62:	83 c4 10             	add    $0x10,%esp
+     e65:	85 c0                	test   %eax,%eax
+     e67:	0f 85 58 01 00 00    	jne    fc5 <pipe1+0x175>
+     e6d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     e6f:	e8 d7 32 00 00       	call   414b <fork>
+  if(pid == 0){
+     e74:	85 c0                	test   %eax,%eax
+     e76:	0f 84 92 00 00 00    	je     f0e <pipe1+0xbe>
+  } else if(pid > 0){
+     e7c:	0f 8e 5d 01 00 00    	jle    fdf <pipe1+0x18f>
+    close(fds[1]);
+     e82:	83 ec 0c             	sub    $0xc,%esp
+     e85:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     e88:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     e8a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     e8f:	e8 e7 32 00 00       	call   417b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     e94:	83 c4 10             	add    $0x10,%esp
+     e97:	83 ec 04             	sub    $0x4,%esp
+     e9a:	57                   	push   %edi
+     e9b:	68 e0 90 00 00       	push   $0x90e0
+     ea0:	ff 75 e0             	push   -0x20(%ebp)
+     ea3:	e8 c3 32 00 00       	call   416b <read>
+     ea8:	83 c4 10             	add    $0x10,%esp
+     eab:	89 c1                	mov    %eax,%ecx
+     ead:	85 c0                	test   %eax,%eax
+     eaf:	0f 8e c1 00 00 00    	jle    f76 <pipe1+0x126>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     eb5:	89 f0                	mov    %esi,%eax
+     eb7:	32 05 e0 90 00 00    	xor    0x90e0,%al
+     ebd:	0f b6 c0             	movzbl %al,%eax
+     ec0:	85 c0                	test   %eax,%eax
+     ec2:	75 30                	jne    ef4 <pipe1+0xa4>
+     ec4:	83 c6 01             	add    $0x1,%esi
+     ec7:	eb 0f                	jmp    ed8 <pipe1+0x88>
+     ec9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ed0:	38 90 e0 90 00 00    	cmp    %dl,0x90e0(%eax)
+     ed6:	75 1c                	jne    ef4 <pipe1+0xa4>
+     ed8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     edb:	83 c0 01             	add    $0x1,%eax
+     ede:	39 c1                	cmp    %eax,%ecx
+     ee0:	75 ee                	jne    ed0 <pipe1+0x80>
+      cc = cc * 2;
+     ee2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ee4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ee9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     eeb:	89 d6                	mov    %edx,%esi
+     eed:	39 c7                	cmp    %eax,%edi
+     eef:	0f 4f f8             	cmovg  %eax,%edi
+     ef2:	eb a3                	jmp    e97 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ef4:	83 ec 08             	sub    $0x8,%esp
+     ef7:	68 36 4b 00 00       	push   $0x4b36
+     efc:	6a 01                	push   $0x1
+     efe:	e8 2d 34 00 00       	call   4330 <printf>
+     f03:	83 c4 10             	add    $0x10,%esp
+}
+     f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f09:	5b                   	pop    %ebx
+     f0a:	5e                   	pop    %esi
+     f0b:	5f                   	pop    %edi
+     f0c:	5d                   	pop    %ebp
+     f0d:	c3                   	ret
+    close(fds[0]);
+     f0e:	83 ec 0c             	sub    $0xc,%esp
+     f11:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     f14:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     f16:	e8 60 32 00 00       	call   417b <close>
+     f1b:	83 c4 10             	add    $0x10,%esp
+     f1e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     f20:	31 c0                	xor    %eax,%eax
+     f22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     f28:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     f2b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     f2e:	88 90 df 90 00 00    	mov    %dl,0x90df(%eax)
+      for(i = 0; i < 1033; i++)
+     f34:	3d 09 04 00 00       	cmp    $0x409,%eax
+     f39:	75 ed                	jne    f28 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     f3b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     f3e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     f44:	68 09 04 00 00       	push   $0x409
+     f49:	68 e0 90 00 00       	push   $0x90e0
+     f4e:	ff 75 e4             	push   -0x1c(%ebp)
+     f51:	e8 1d 32 00 00       	call   4173 <write>
+     f56:	83 c4 10             	add    $0x10,%esp
+     f59:	3d 09 04 00 00       	cmp    $0x409,%eax
+     f5e:	0f 85 95 00 00 00    	jne    ff9 <pipe1+0x1a9>
+    for(n = 0; n < 5; n++){
+     f64:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     f6a:	75 b4                	jne    f20 <pipe1+0xd0>
+    exit(0);
+     f6c:	83 ec 0c             	sub    $0xc,%esp
+     f6f:	6a 00                	push   $0x0
+     f71:	e8 dd 31 00 00       	call   4153 <exit>
+    if(total != 5 * 1033){
+     f76:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     f7c:	75 2d                	jne    fab <pipe1+0x15b>
+    close(fds[0]);
+     f7e:	83 ec 0c             	sub    $0xc,%esp
+     f81:	ff 75 e0             	push   -0x20(%ebp)
+     f84:	e8 f2 31 00 00       	call   417b <close>
+    wait(&estatus);
+     f89:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+     f90:	e8 c6 31 00 00       	call   415b <wait>
+  printf(1, "pipe1 ok\n");
+     f95:	5a                   	pop    %edx
+     f96:	59                   	pop    %ecx
+     f97:	68 5b 4b 00 00       	push   $0x4b5b
+     f9c:	6a 01                	push   $0x1
+     f9e:	e8 8d 33 00 00       	call   4330 <printf>
+     fa3:	83 c4 10             	add    $0x10,%esp
+     fa6:	e9 5b ff ff ff       	jmp    f06 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     fab:	56                   	push   %esi
+     fac:	53                   	push   %ebx
+     fad:	68 44 4b 00 00       	push   $0x4b44
+     fb2:	6a 01                	push   $0x1
+     fb4:	e8 77 33 00 00       	call   4330 <printf>
+      exit(1);
+     fb9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     fc0:	e8 8e 31 00 00       	call   4153 <exit>
+    printf(1, "pipe() failed\n");
+     fc5:	50                   	push   %eax
+     fc6:	50                   	push   %eax
+     fc7:	68 19 4b 00 00       	push   $0x4b19
+     fcc:	6a 01                	push   $0x1
+     fce:	e8 5d 33 00 00       	call   4330 <printf>
+    exit(1);
+     fd3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     fda:	e8 74 31 00 00       	call   4153 <exit>
+    printf(1, "fork() failed\n");
+     fdf:	50                   	push   %eax
+     fe0:	50                   	push   %eax
+     fe1:	68 65 4b 00 00       	push   $0x4b65
+     fe6:	6a 01                	push   $0x1
+     fe8:	e8 43 33 00 00       	call   4330 <printf>
+    exit(1);
+     fed:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+     ff4:	e8 5a 31 00 00       	call   4153 <exit>
+        printf(1, "pipe1 oops 1\n");
+     ff9:	57                   	push   %edi
+     ffa:	57                   	push   %edi
+     ffb:	68 28 4b 00 00       	push   $0x4b28
+    1000:	6a 01                	push   $0x1
+    1002:	e8 29 33 00 00       	call   4330 <printf>
+        exit(1);
+    1007:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    100e:	e8 40 31 00 00       	call   4153 <exit>
+    1013:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    101a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001020 <preempt>:
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	57                   	push   %edi
+    1024:	56                   	push   %esi
+    1025:	53                   	push   %ebx
+    1026:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+    1029:	68 74 4b 00 00       	push   $0x4b74
+    102e:	6a 01                	push   $0x1
+    1030:	e8 fb 32 00 00       	call   4330 <printf>
+  pid1 = fork();
+    1035:	e8 11 31 00 00       	call   414b <fork>
+  if(pid1 == 0)
+    103a:	83 c4 10             	add    $0x10,%esp
+    103d:	85 c0                	test   %eax,%eax
+    103f:	75 07                	jne    1048 <preempt+0x28>
+    for(;;)
+    1041:	eb fe                	jmp    1041 <preempt+0x21>
+    1043:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1047:	90                   	nop
+    1048:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+    104a:	e8 fc 30 00 00       	call   414b <fork>
+    104f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+    1051:	85 c0                	test   %eax,%eax
+    1053:	75 0b                	jne    1060 <preempt+0x40>
+    for(;;)
+    1055:	eb fe                	jmp    1055 <preempt+0x35>
+    1057:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    105e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+    1060:	83 ec 0c             	sub    $0xc,%esp
+    1063:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1066:	50                   	push   %eax
+    1067:	e8 f7 30 00 00       	call   4163 <pipe>
+  pid3 = fork();
+    106c:	e8 da 30 00 00       	call   414b <fork>
+  if(pid3 == 0){
+    1071:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    1074:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+    1076:	85 c0                	test   %eax,%eax
+    1078:	75 3e                	jne    10b8 <preempt+0x98>
+    close(pfds[0]);
+    107a:	83 ec 0c             	sub    $0xc,%esp
+    107d:	ff 75 e0             	push   -0x20(%ebp)
+    1080:	e8 f6 30 00 00       	call   417b <close>
+    if(write(pfds[1], "x", 1) != 1)
+    1085:	83 c4 0c             	add    $0xc,%esp
+    1088:	6a 01                	push   $0x1
+    108a:	68 39 51 00 00       	push   $0x5139
+    108f:	ff 75 e4             	push   -0x1c(%ebp)
+    1092:	e8 dc 30 00 00       	call   4173 <write>
+    1097:	83 c4 10             	add    $0x10,%esp
+    109a:	83 f8 01             	cmp    $0x1,%eax
+    109d:	0f 85 cd 00 00 00    	jne    1170 <preempt+0x150>
+    close(pfds[1]);
+    10a3:	83 ec 0c             	sub    $0xc,%esp
+    10a6:	ff 75 e4             	push   -0x1c(%ebp)
+    10a9:	e8 cd 30 00 00       	call   417b <close>
+    10ae:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    10b1:	eb fe                	jmp    10b1 <preempt+0x91>
+    10b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10b7:	90                   	nop
+  close(pfds[1]);
+    10b8:	83 ec 0c             	sub    $0xc,%esp
+    10bb:	ff 75 e4             	push   -0x1c(%ebp)
+    10be:	e8 b8 30 00 00       	call   417b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    10c3:	83 c4 0c             	add    $0xc,%esp
+    10c6:	68 00 20 00 00       	push   $0x2000
+    10cb:	68 e0 90 00 00       	push   $0x90e0
+    10d0:	ff 75 e0             	push   -0x20(%ebp)
+    10d3:	e8 93 30 00 00       	call   416b <read>
+    10d8:	83 c4 10             	add    $0x10,%esp
+    10db:	83 f8 01             	cmp    $0x1,%eax
+    10de:	75 7c                	jne    115c <preempt+0x13c>
+  close(pfds[0]);
+    10e0:	83 ec 0c             	sub    $0xc,%esp
+    10e3:	ff 75 e0             	push   -0x20(%ebp)
+    10e6:	e8 90 30 00 00       	call   417b <close>
+  printf(1, "kill... ");
+    10eb:	58                   	pop    %eax
+    10ec:	5a                   	pop    %edx
+    10ed:	68 a5 4b 00 00       	push   $0x4ba5
+    10f2:	6a 01                	push   $0x1
+    10f4:	e8 37 32 00 00       	call   4330 <printf>
+  kill(pid1);
+    10f9:	89 1c 24             	mov    %ebx,(%esp)
+    10fc:	e8 82 30 00 00       	call   4183 <kill>
+  kill(pid2);
+    1101:	89 34 24             	mov    %esi,(%esp)
+    1104:	e8 7a 30 00 00       	call   4183 <kill>
+  kill(pid3);
+    1109:	89 3c 24             	mov    %edi,(%esp)
+    110c:	e8 72 30 00 00       	call   4183 <kill>
+  printf(1, "wait... ");
+    1111:	59                   	pop    %ecx
+    1112:	5b                   	pop    %ebx
+    1113:	68 ae 4b 00 00       	push   $0x4bae
+    1118:	6a 01                	push   $0x1
+    111a:	e8 11 32 00 00       	call   4330 <printf>
+  wait(&estatus);
+    111f:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+    1126:	e8 30 30 00 00       	call   415b <wait>
+  wait(&estatus);
+    112b:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+    1132:	e8 24 30 00 00       	call   415b <wait>
+  wait(&estatus);
+    1137:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+    113e:	e8 18 30 00 00       	call   415b <wait>
+  printf(1, "preempt ok\n");
+    1143:	5e                   	pop    %esi
+    1144:	5f                   	pop    %edi
+    1145:	68 b7 4b 00 00       	push   $0x4bb7
+    114a:	6a 01                	push   $0x1
+    114c:	e8 df 31 00 00       	call   4330 <printf>
+    1151:	83 c4 10             	add    $0x10,%esp
+}
+    1154:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1157:	5b                   	pop    %ebx
+    1158:	5e                   	pop    %esi
+    1159:	5f                   	pop    %edi
+    115a:	5d                   	pop    %ebp
+    115b:	c3                   	ret
+    printf(1, "preempt read error");
+    115c:	83 ec 08             	sub    $0x8,%esp
+    115f:	68 92 4b 00 00       	push   $0x4b92
+    1164:	6a 01                	push   $0x1
+    1166:	e8 c5 31 00 00       	call   4330 <printf>
+    116b:	83 c4 10             	add    $0x10,%esp
+    116e:	eb e4                	jmp    1154 <preempt+0x134>
+      printf(1, "preempt write error");
+    1170:	83 ec 08             	sub    $0x8,%esp
+    1173:	68 7e 4b 00 00       	push   $0x4b7e
+    1178:	6a 01                	push   $0x1
+    117a:	e8 b1 31 00 00       	call   4330 <printf>
+    117f:	83 c4 10             	add    $0x10,%esp
+    1182:	e9 1c ff ff ff       	jmp    10a3 <preempt+0x83>
+    1187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    118e:	66 90                	xchg   %ax,%ax
+
+00001190 <exitwait>:
+{
+    1190:	55                   	push   %ebp
+    1191:	89 e5                	mov    %esp,%ebp
+    1193:	56                   	push   %esi
+    1194:	be 64 00 00 00       	mov    $0x64,%esi
+    1199:	53                   	push   %ebx
+    119a:	eb 1f                	jmp    11bb <exitwait+0x2b>
+    119c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+    11a0:	74 70                	je     1212 <exitwait+0x82>
+      if(wait(&estatus) != pid){
+    11a2:	83 ec 0c             	sub    $0xc,%esp
+    11a5:	68 d0 90 00 00       	push   $0x90d0
+    11aa:	e8 ac 2f 00 00       	call   415b <wait>
+    11af:	83 c4 10             	add    $0x10,%esp
+    11b2:	39 d8                	cmp    %ebx,%eax
+    11b4:	75 2a                	jne    11e0 <exitwait+0x50>
+  for(i = 0; i < 100; i++){
+    11b6:	83 ee 01             	sub    $0x1,%esi
+    11b9:	74 3e                	je     11f9 <exitwait+0x69>
+    pid = fork();
+    11bb:	e8 8b 2f 00 00       	call   414b <fork>
+    11c0:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    11c2:	85 c0                	test   %eax,%eax
+    11c4:	79 da                	jns    11a0 <exitwait+0x10>
+      printf(1, "fork failed\n");
+    11c6:	83 ec 08             	sub    $0x8,%esp
+    11c9:	68 21 57 00 00       	push   $0x5721
+    11ce:	6a 01                	push   $0x1
+    11d0:	e8 5b 31 00 00       	call   4330 <printf>
+      return;
+    11d5:	83 c4 10             	add    $0x10,%esp
+}
+    11d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11db:	5b                   	pop    %ebx
+    11dc:	5e                   	pop    %esi
+    11dd:	5d                   	pop    %ebp
+    11de:	c3                   	ret
+    11df:	90                   	nop
+        printf(1, "wait wrong pid\n");
+    11e0:	83 ec 08             	sub    $0x8,%esp
+    11e3:	68 c3 4b 00 00       	push   $0x4bc3
+    11e8:	6a 01                	push   $0x1
+    11ea:	e8 41 31 00 00       	call   4330 <printf>
+        return;
+    11ef:	83 c4 10             	add    $0x10,%esp
+}
+    11f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11f5:	5b                   	pop    %ebx
+    11f6:	5e                   	pop    %esi
+    11f7:	5d                   	pop    %ebp
+    11f8:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    11f9:	83 ec 08             	sub    $0x8,%esp
+    11fc:	68 d3 4b 00 00       	push   $0x4bd3
+    1201:	6a 01                	push   $0x1
+    1203:	e8 28 31 00 00       	call   4330 <printf>
+    1208:	83 c4 10             	add    $0x10,%esp
+}
+    120b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    120e:	5b                   	pop    %ebx
+    120f:	5e                   	pop    %esi
+    1210:	5d                   	pop    %ebp
+    1211:	c3                   	ret
+      exit(0);
+    1212:	83 ec 0c             	sub    $0xc,%esp
+    1215:	6a 00                	push   $0x0
+    1217:	e8 37 2f 00 00       	call   4153 <exit>
+    121c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001220 <mem>:
+{
+    1220:	55                   	push   %ebp
+    1221:	89 e5                	mov    %esp,%ebp
+    1223:	56                   	push   %esi
+    1224:	31 f6                	xor    %esi,%esi
+    1226:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    1227:	83 ec 08             	sub    $0x8,%esp
+    122a:	68 e0 4b 00 00       	push   $0x4be0
+    122f:	6a 01                	push   $0x1
+    1231:	e8 fa 30 00 00       	call   4330 <printf>
+  ppid = getpid();
+    1236:	e8 98 2f 00 00       	call   41d3 <getpid>
+    123b:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    123d:	e8 09 2f 00 00       	call   414b <fork>
+    1242:	83 c4 10             	add    $0x10,%esp
+    1245:	85 c0                	test   %eax,%eax
+    1247:	74 0b                	je     1254 <mem+0x34>
+    1249:	e9 9a 00 00 00       	jmp    12e8 <mem+0xc8>
+    124e:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    1250:	89 30                	mov    %esi,(%eax)
+    1252:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    1254:	83 ec 0c             	sub    $0xc,%esp
+    1257:	68 11 27 00 00       	push   $0x2711
+    125c:	e8 ef 33 00 00       	call   4650 <malloc>
+    1261:	83 c4 10             	add    $0x10,%esp
+    1264:	85 c0                	test   %eax,%eax
+    1266:	75 e8                	jne    1250 <mem+0x30>
+    while(m1){
+    1268:	85 f6                	test   %esi,%esi
+    126a:	74 18                	je     1284 <mem+0x64>
+    126c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    1270:	89 f0                	mov    %esi,%eax
+      free(m1);
+    1272:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    1275:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    1277:	50                   	push   %eax
+    1278:	e8 43 33 00 00       	call   45c0 <free>
+    while(m1){
+    127d:	83 c4 10             	add    $0x10,%esp
+    1280:	85 f6                	test   %esi,%esi
+    1282:	75 ec                	jne    1270 <mem+0x50>
+    m1 = malloc(1024*20);
+    1284:	83 ec 0c             	sub    $0xc,%esp
+    1287:	68 00 50 00 00       	push   $0x5000
+    128c:	e8 bf 33 00 00       	call   4650 <malloc>
+    if(m1 == 0){
+    1291:	83 c4 10             	add    $0x10,%esp
+    1294:	85 c0                	test   %eax,%eax
+    1296:	74 28                	je     12c0 <mem+0xa0>
+    free(m1);
+    1298:	83 ec 0c             	sub    $0xc,%esp
+    129b:	50                   	push   %eax
+    129c:	e8 1f 33 00 00       	call   45c0 <free>
+    printf(1, "mem ok\n");
+    12a1:	58                   	pop    %eax
+    12a2:	5a                   	pop    %edx
+    12a3:	68 04 4c 00 00       	push   $0x4c04
+    12a8:	6a 01                	push   $0x1
+    12aa:	e8 81 30 00 00       	call   4330 <printf>
+    exit(0);
+    12af:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    12b6:	e8 98 2e 00 00       	call   4153 <exit>
+    12bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12bf:	90                   	nop
+      printf(1, "couldn't allocate mem?!!\n");
+    12c0:	83 ec 08             	sub    $0x8,%esp
+    12c3:	68 ea 4b 00 00       	push   $0x4bea
+    12c8:	6a 01                	push   $0x1
+    12ca:	e8 61 30 00 00       	call   4330 <printf>
+      kill(ppid);
+    12cf:	89 1c 24             	mov    %ebx,(%esp)
+    12d2:	e8 ac 2e 00 00       	call   4183 <kill>
+      exit(1);
+    12d7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    12de:	e8 70 2e 00 00       	call   4153 <exit>
+    12e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12e7:	90                   	nop
+    wait(&estatus);
+    12e8:	83 ec 0c             	sub    $0xc,%esp
+    12eb:	68 d0 90 00 00       	push   $0x90d0
+    12f0:	e8 66 2e 00 00       	call   415b <wait>
+}
+    12f5:	83 c4 10             	add    $0x10,%esp
+    12f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12fb:	5b                   	pop    %ebx
+    12fc:	5e                   	pop    %esi
+    12fd:	5d                   	pop    %ebp
+    12fe:	c3                   	ret
+    12ff:	90                   	nop
+
+00001300 <sharedfd>:
+{
+    1300:	55                   	push   %ebp
+    1301:	89 e5                	mov    %esp,%ebp
+    1303:	57                   	push   %edi
+    1304:	56                   	push   %esi
+    1305:	53                   	push   %ebx
+    1306:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    1309:	68 0c 4c 00 00       	push   $0x4c0c
+    130e:	6a 01                	push   $0x1
+    1310:	e8 1b 30 00 00       	call   4330 <printf>
+  unlink("sharedfd");
+    1315:	c7 04 24 1b 4c 00 00 	movl   $0x4c1b,(%esp)
+    131c:	e8 82 2e 00 00       	call   41a3 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1321:	5b                   	pop    %ebx
+    1322:	5e                   	pop    %esi
+    1323:	68 02 02 00 00       	push   $0x202
+    1328:	68 1b 4c 00 00       	push   $0x4c1b
+    132d:	e8 61 2e 00 00       	call   4193 <open>
+  if(fd < 0){
+    1332:	83 c4 10             	add    $0x10,%esp
+    1335:	85 c0                	test   %eax,%eax
+    1337:	0f 88 2a 01 00 00    	js     1467 <sharedfd+0x167>
+    133d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    133f:	8d 75 de             	lea    -0x22(%ebp),%esi
+    1342:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    1347:	e8 ff 2d 00 00       	call   414b <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    134c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    134f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1352:	19 c0                	sbb    %eax,%eax
+    1354:	83 ec 04             	sub    $0x4,%esp
+    1357:	83 e0 f3             	and    $0xfffffff3,%eax
+    135a:	6a 0a                	push   $0xa
+    135c:	83 c0 70             	add    $0x70,%eax
+    135f:	50                   	push   %eax
+    1360:	56                   	push   %esi
+    1361:	e8 6a 2c 00 00       	call   3fd0 <memset>
+    1366:	83 c4 10             	add    $0x10,%esp
+    1369:	eb 0a                	jmp    1375 <sharedfd+0x75>
+    136b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    136f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    1370:	83 eb 01             	sub    $0x1,%ebx
+    1373:	74 26                	je     139b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1375:	83 ec 04             	sub    $0x4,%esp
+    1378:	6a 0a                	push   $0xa
+    137a:	56                   	push   %esi
+    137b:	57                   	push   %edi
+    137c:	e8 f2 2d 00 00       	call   4173 <write>
+    1381:	83 c4 10             	add    $0x10,%esp
+    1384:	83 f8 0a             	cmp    $0xa,%eax
+    1387:	74 e7                	je     1370 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    1389:	83 ec 08             	sub    $0x8,%esp
+    138c:	68 60 59 00 00       	push   $0x5960
+    1391:	6a 01                	push   $0x1
+    1393:	e8 98 2f 00 00       	call   4330 <printf>
+      break;
+    1398:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    139b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    139e:	85 c9                	test   %ecx,%ecx
+    13a0:	0f 84 f5 00 00 00    	je     149b <sharedfd+0x19b>
+    wait(&estatus);
+    13a6:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    13a9:	31 db                	xor    %ebx,%ebx
+    wait(&estatus);
+    13ab:	68 d0 90 00 00       	push   $0x90d0
+    13b0:	e8 a6 2d 00 00       	call   415b <wait>
+  close(fd);
+    13b5:	89 3c 24             	mov    %edi,(%esp)
+    13b8:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    13bb:	e8 bb 2d 00 00       	call   417b <close>
+  fd = open("sharedfd", 0);
+    13c0:	58                   	pop    %eax
+    13c1:	5a                   	pop    %edx
+    13c2:	6a 00                	push   $0x0
+    13c4:	68 1b 4c 00 00       	push   $0x4c1b
+    13c9:	e8 c5 2d 00 00       	call   4193 <open>
+  if(fd < 0){
+    13ce:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    13d1:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    13d3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    13d6:	85 c0                	test   %eax,%eax
+    13d8:	0f 88 a3 00 00 00    	js     1481 <sharedfd+0x181>
+    13de:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    13e0:	83 ec 04             	sub    $0x4,%esp
+    13e3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    13e6:	6a 0a                	push   $0xa
+    13e8:	56                   	push   %esi
+    13e9:	ff 75 d0             	push   -0x30(%ebp)
+    13ec:	e8 7a 2d 00 00       	call   416b <read>
+    13f1:	83 c4 10             	add    $0x10,%esp
+    13f4:	85 c0                	test   %eax,%eax
+    13f6:	7e 28                	jle    1420 <sharedfd+0x120>
+    13f8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    13fb:	89 f0                	mov    %esi,%eax
+    13fd:	eb 13                	jmp    1412 <sharedfd+0x112>
+    13ff:	90                   	nop
+        np++;
+    1400:	80 f9 70             	cmp    $0x70,%cl
+    1403:	0f 94 c1             	sete   %cl
+    1406:	0f b6 c9             	movzbl %cl,%ecx
+    1409:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    140b:	83 c0 01             	add    $0x1,%eax
+    140e:	39 f8                	cmp    %edi,%eax
+    1410:	74 ce                	je     13e0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1412:	0f b6 08             	movzbl (%eax),%ecx
+    1415:	80 f9 63             	cmp    $0x63,%cl
+    1418:	75 e6                	jne    1400 <sharedfd+0x100>
+        nc++;
+    141a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    141d:	eb ec                	jmp    140b <sharedfd+0x10b>
+    141f:	90                   	nop
+  close(fd);
+    1420:	83 ec 0c             	sub    $0xc,%esp
+    1423:	ff 75 d0             	push   -0x30(%ebp)
+    1426:	e8 50 2d 00 00       	call   417b <close>
+  unlink("sharedfd");
+    142b:	c7 04 24 1b 4c 00 00 	movl   $0x4c1b,(%esp)
+    1432:	e8 6c 2d 00 00       	call   41a3 <unlink>
+  if(nc == 10000 && np == 10000){
+    1437:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    143a:	83 c4 10             	add    $0x10,%esp
+    143d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1443:	75 60                	jne    14a5 <sharedfd+0x1a5>
+    1445:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    144b:	75 58                	jne    14a5 <sharedfd+0x1a5>
+    printf(1, "sharedfd ok\n");
+    144d:	83 ec 08             	sub    $0x8,%esp
+    1450:	68 24 4c 00 00       	push   $0x4c24
+    1455:	6a 01                	push   $0x1
+    1457:	e8 d4 2e 00 00       	call   4330 <printf>
+    145c:	83 c4 10             	add    $0x10,%esp
+}
+    145f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1462:	5b                   	pop    %ebx
+    1463:	5e                   	pop    %esi
+    1464:	5f                   	pop    %edi
+    1465:	5d                   	pop    %ebp
+    1466:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1467:	83 ec 08             	sub    $0x8,%esp
+    146a:	68 34 59 00 00       	push   $0x5934
+    146f:	6a 01                	push   $0x1
+    1471:	e8 ba 2e 00 00       	call   4330 <printf>
+    return;
+    1476:	83 c4 10             	add    $0x10,%esp
+}
+    1479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    147c:	5b                   	pop    %ebx
+    147d:	5e                   	pop    %esi
+    147e:	5f                   	pop    %edi
+    147f:	5d                   	pop    %ebp
+    1480:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1481:	83 ec 08             	sub    $0x8,%esp
+    1484:	68 80 59 00 00       	push   $0x5980
+    1489:	6a 01                	push   $0x1
+    148b:	e8 a0 2e 00 00       	call   4330 <printf>
+    return;
+    1490:	83 c4 10             	add    $0x10,%esp
+}
+    1493:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1496:	5b                   	pop    %ebx
+    1497:	5e                   	pop    %esi
+    1498:	5f                   	pop    %edi
+    1499:	5d                   	pop    %ebp
+    149a:	c3                   	ret
+    exit(0);
+    149b:	83 ec 0c             	sub    $0xc,%esp
+    149e:	6a 00                	push   $0x0
+    14a0:	e8 ae 2c 00 00       	call   4153 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    14a5:	53                   	push   %ebx
+    14a6:	52                   	push   %edx
+    14a7:	68 31 4c 00 00       	push   $0x4c31
+    14ac:	6a 01                	push   $0x1
+    14ae:	e8 7d 2e 00 00       	call   4330 <printf>
+    exit(1);
+    14b3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    14ba:	e8 94 2c 00 00       	call   4153 <exit>
+    14bf:	90                   	nop
+
+000014c0 <fourfiles>:
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 e5                	mov    %esp,%ebp
+    14c3:	57                   	push   %edi
+    14c4:	56                   	push   %esi
+    14c5:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    14c6:	31 db                	xor    %ebx,%ebx
+{
+    14c8:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    14cb:	c7 45 d8 46 4c 00 00 	movl   $0x4c46,-0x28(%ebp)
+    14d2:	c7 45 dc 8f 4d 00 00 	movl   $0x4d8f,-0x24(%ebp)
+    14d9:	c7 45 e0 93 4d 00 00 	movl   $0x4d93,-0x20(%ebp)
+    14e0:	c7 45 e4 49 4c 00 00 	movl   $0x4c49,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    14e7:	68 4c 4c 00 00       	push   $0x4c4c
+    14ec:	6a 01                	push   $0x1
+    14ee:	e8 3d 2e 00 00       	call   4330 <printf>
+    14f3:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    14f6:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    14fa:	83 ec 0c             	sub    $0xc,%esp
+    14fd:	56                   	push   %esi
+    14fe:	e8 a0 2c 00 00       	call   41a3 <unlink>
+    pid = fork();
+    1503:	e8 43 2c 00 00       	call   414b <fork>
+    if(pid < 0){
+    1508:	83 c4 10             	add    $0x10,%esp
+    150b:	85 c0                	test   %eax,%eax
+    150d:	0f 88 9d 01 00 00    	js     16b0 <fourfiles+0x1f0>
+    if(pid == 0){
+    1513:	0f 84 12 01 00 00    	je     162b <fourfiles+0x16b>
+  for(pi = 0; pi < 4; pi++){
+    1519:	83 c3 01             	add    $0x1,%ebx
+    151c:	83 fb 04             	cmp    $0x4,%ebx
+    151f:	75 d5                	jne    14f6 <fourfiles+0x36>
+    wait(&estatus);
+    1521:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 2; i++){
+    1524:	31 f6                	xor    %esi,%esi
+    wait(&estatus);
+    1526:	68 d0 90 00 00       	push   $0x90d0
+    152b:	e8 2b 2c 00 00       	call   415b <wait>
+    1530:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+    1537:	e8 1f 2c 00 00       	call   415b <wait>
+    153c:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+    1543:	e8 13 2c 00 00       	call   415b <wait>
+    1548:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+    154f:	e8 07 2c 00 00       	call   415b <wait>
+    1554:	83 c4 10             	add    $0x10,%esp
+    fname = names[i];
+    1557:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    155b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    155e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    1560:	6a 00                	push   $0x0
+    1562:	53                   	push   %ebx
+    1563:	e8 2b 2c 00 00       	call   4193 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1568:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    156b:	83 c4 10             	add    $0x10,%esp
+    156e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1578:	83 ec 04             	sub    $0x4,%esp
+    157b:	68 00 20 00 00       	push   $0x2000
+    1580:	68 e0 90 00 00       	push   $0x90e0
+    1585:	ff 75 d4             	push   -0x2c(%ebp)
+    1588:	e8 de 2b 00 00       	call   416b <read>
+    158d:	83 c4 10             	add    $0x10,%esp
+    1590:	89 c3                	mov    %eax,%ebx
+    1592:	85 c0                	test   %eax,%eax
+    1594:	7e 28                	jle    15be <fourfiles+0xfe>
+      for(j = 0; j < n; j++){
+    1596:	31 c0                	xor    %eax,%eax
+    1598:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    159f:	90                   	nop
+        if(buf[j] != '0'+i){
+    15a0:	83 fe 01             	cmp    $0x1,%esi
+    15a3:	0f be 88 e0 90 00 00 	movsbl 0x90e0(%eax),%ecx
+    15aa:	19 d2                	sbb    %edx,%edx
+    15ac:	83 c2 31             	add    $0x31,%edx
+    15af:	39 d1                	cmp    %edx,%ecx
+    15b1:	75 5d                	jne    1610 <fourfiles+0x150>
+      for(j = 0; j < n; j++){
+    15b3:	83 c0 01             	add    $0x1,%eax
+    15b6:	39 c3                	cmp    %eax,%ebx
+    15b8:	75 e6                	jne    15a0 <fourfiles+0xe0>
+      total += n;
+    15ba:	01 df                	add    %ebx,%edi
+    15bc:	eb ba                	jmp    1578 <fourfiles+0xb8>
+    close(fd);
+    15be:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    15c1:	83 ec 0c             	sub    $0xc,%esp
+    15c4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    15c7:	51                   	push   %ecx
+    15c8:	e8 ae 2b 00 00       	call   417b <close>
+    if(total != 12*500){
+    15cd:	83 c4 10             	add    $0x10,%esp
+    15d0:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    15d6:	0f 85 ef 00 00 00    	jne    16cb <fourfiles+0x20b>
+    unlink(fname);
+    15dc:	83 ec 0c             	sub    $0xc,%esp
+    15df:	53                   	push   %ebx
+    15e0:	e8 be 2b 00 00       	call   41a3 <unlink>
+  for(i = 0; i < 2; i++){
+    15e5:	83 c4 10             	add    $0x10,%esp
+    15e8:	85 f6                	test   %esi,%esi
+    15ea:	75 0a                	jne    15f6 <fourfiles+0x136>
+    15ec:	be 01 00 00 00       	mov    $0x1,%esi
+    15f1:	e9 61 ff ff ff       	jmp    1557 <fourfiles+0x97>
+  printf(1, "fourfiles ok\n");
+    15f6:	83 ec 08             	sub    $0x8,%esp
+    15f9:	68 8a 4c 00 00       	push   $0x4c8a
+    15fe:	6a 01                	push   $0x1
+    1600:	e8 2b 2d 00 00       	call   4330 <printf>
+}
+    1605:	83 c4 10             	add    $0x10,%esp
+    1608:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    160b:	5b                   	pop    %ebx
+    160c:	5e                   	pop    %esi
+    160d:	5f                   	pop    %edi
+    160e:	5d                   	pop    %ebp
+    160f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1610:	83 ec 08             	sub    $0x8,%esp
+    1613:	68 6d 4c 00 00       	push   $0x4c6d
+    1618:	6a 01                	push   $0x1
+    161a:	e8 11 2d 00 00       	call   4330 <printf>
+          exit(1);
+    161f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1626:	e8 28 2b 00 00       	call   4153 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    162b:	83 ec 08             	sub    $0x8,%esp
+    162e:	68 02 02 00 00       	push   $0x202
+    1633:	56                   	push   %esi
+    1634:	e8 5a 2b 00 00       	call   4193 <open>
+      if(fd < 0){
+    1639:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    163c:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    163e:	85 c0                	test   %eax,%eax
+    1640:	78 4a                	js     168c <fourfiles+0x1cc>
+      memset(buf, '0'+pi, 512);
+    1642:	83 ec 04             	sub    $0x4,%esp
+    1645:	83 c3 30             	add    $0x30,%ebx
+    1648:	68 00 02 00 00       	push   $0x200
+    164d:	53                   	push   %ebx
+    164e:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    1653:	68 e0 90 00 00       	push   $0x90e0
+    1658:	e8 73 29 00 00       	call   3fd0 <memset>
+    165d:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1660:	83 ec 04             	sub    $0x4,%esp
+    1663:	68 f4 01 00 00       	push   $0x1f4
+    1668:	68 e0 90 00 00       	push   $0x90e0
+    166d:	56                   	push   %esi
+    166e:	e8 00 2b 00 00       	call   4173 <write>
+    1673:	83 c4 10             	add    $0x10,%esp
+    1676:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    167b:	75 68                	jne    16e5 <fourfiles+0x225>
+      for(i = 0; i < 12; i++){
+    167d:	83 eb 01             	sub    $0x1,%ebx
+    1680:	75 de                	jne    1660 <fourfiles+0x1a0>
+      exit(0);
+    1682:	83 ec 0c             	sub    $0xc,%esp
+    1685:	6a 00                	push   $0x0
+    1687:	e8 c7 2a 00 00       	call   4153 <exit>
+        printf(1, "create failed\n");
+    168c:	51                   	push   %ecx
+    168d:	51                   	push   %ecx
+    168e:	68 e7 4e 00 00       	push   $0x4ee7
+    1693:	6a 01                	push   $0x1
+    1695:	e8 96 2c 00 00       	call   4330 <printf>
+        exit(1);
+    169a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    16a1:	e8 ad 2a 00 00       	call   4153 <exit>
+    16a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16ad:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(1, "fork failed\n");
+    16b0:	83 ec 08             	sub    $0x8,%esp
+    16b3:	68 21 57 00 00       	push   $0x5721
+    16b8:	6a 01                	push   $0x1
+    16ba:	e8 71 2c 00 00       	call   4330 <printf>
+      exit(1);
+    16bf:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    16c6:	e8 88 2a 00 00       	call   4153 <exit>
+      printf(1, "wrong length %d\n", total);
+    16cb:	50                   	push   %eax
+    16cc:	57                   	push   %edi
+    16cd:	68 79 4c 00 00       	push   $0x4c79
+    16d2:	6a 01                	push   $0x1
+    16d4:	e8 57 2c 00 00       	call   4330 <printf>
+      exit(1);
+    16d9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    16e0:	e8 6e 2a 00 00       	call   4153 <exit>
+          printf(1, "write failed %d\n", n);
+    16e5:	52                   	push   %edx
+    16e6:	50                   	push   %eax
+    16e7:	68 5c 4c 00 00       	push   $0x4c5c
+    16ec:	6a 01                	push   $0x1
+    16ee:	e8 3d 2c 00 00       	call   4330 <printf>
+          exit(1);
+    16f3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    16fa:	e8 54 2a 00 00       	call   4153 <exit>
+    16ff:	90                   	nop
+
+00001700 <createdelete>:
+createdelete(void) {
+    1700:	55                   	push   %ebp
+    1701:	89 e5                	mov    %esp,%ebp
+    1703:	57                   	push   %edi
+    1704:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1705:	31 f6                	xor    %esi,%esi
+createdelete(void) {
+    1707:	53                   	push   %ebx
+    1708:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    170b:	68 98 4c 00 00       	push   $0x4c98
+    1710:	6a 01                	push   $0x1
+    1712:	e8 19 2c 00 00       	call   4330 <printf>
+    1717:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    171a:	e8 2c 2a 00 00       	call   414b <fork>
+    171f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1721:	85 c0                	test   %eax,%eax
+    1723:	0f 88 e3 01 00 00    	js     190c <createdelete+0x20c>
+    if(pid == 0){
+    1729:	0f 84 21 01 00 00    	je     1850 <createdelete+0x150>
+  for(pi = 0; pi < 4; pi++){
+    172f:	83 c6 01             	add    $0x1,%esi
+    1732:	83 fe 04             	cmp    $0x4,%esi
+    1735:	75 e3                	jne    171a <createdelete+0x1a>
+    wait(&estatus);
+    1737:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < N; i++){
+    173a:	31 ff                	xor    %edi,%edi
+    173c:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait(&estatus);
+    173f:	68 d0 90 00 00       	push   $0x90d0
+    1744:	e8 12 2a 00 00       	call   415b <wait>
+    1749:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+    1750:	e8 06 2a 00 00       	call   415b <wait>
+    1755:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+    175c:	e8 fa 29 00 00       	call   415b <wait>
+    1761:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+    1768:	e8 ee 29 00 00       	call   415b <wait>
+  name[0] = name[1] = name[2] = 0;
+    176d:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1771:	83 c4 10             	add    $0x10,%esp
+    1774:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1778:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    177a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    177d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1782:	0f 94 c2             	sete   %dl
+    1785:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1788:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    178b:	0f 9f c0             	setg   %al
+    178e:	09 c2                	or     %eax,%edx
+    1790:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1793:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1797:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    179a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    179d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    17a0:	6a 00                	push   $0x0
+    17a2:	56                   	push   %esi
+    17a3:	e8 eb 29 00 00       	call   4193 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    17a8:	83 c4 10             	add    $0x10,%esp
+    17ab:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    17af:	74 7f                	je     1830 <createdelete+0x130>
+    17b1:	85 c0                	test   %eax,%eax
+    17b3:	0f 88 37 01 00 00    	js     18f0 <createdelete+0x1f0>
+        close(fd);
+    17b9:	83 ec 0c             	sub    $0xc,%esp
+    17bc:	50                   	push   %eax
+    17bd:	e8 b9 29 00 00       	call   417b <close>
+    17c2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    17c5:	83 c3 01             	add    $0x1,%ebx
+    17c8:	80 fb 74             	cmp    $0x74,%bl
+    17cb:	75 c6                	jne    1793 <createdelete+0x93>
+  for(i = 0; i < N; i++){
+    17cd:	83 c7 01             	add    $0x1,%edi
+    17d0:	83 ff 14             	cmp    $0x14,%edi
+    17d3:	75 a3                	jne    1778 <createdelete+0x78>
+    17d5:	bf 70 00 00 00       	mov    $0x70,%edi
+    17da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    17e0:	8d 47 c0             	lea    -0x40(%edi),%eax
+    17e3:	bb 04 00 00 00       	mov    $0x4,%ebx
+    17e8:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    17eb:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    17ed:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    17f0:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    17f3:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    17f7:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    17fa:	56                   	push   %esi
+    17fb:	e8 a3 29 00 00       	call   41a3 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1800:	83 c4 10             	add    $0x10,%esp
+    1803:	83 eb 01             	sub    $0x1,%ebx
+    1806:	75 e3                	jne    17eb <createdelete+0xeb>
+  for(i = 0; i < N; i++){
+    1808:	83 c7 01             	add    $0x1,%edi
+    180b:	89 f8                	mov    %edi,%eax
+    180d:	3c 84                	cmp    $0x84,%al
+    180f:	75 cf                	jne    17e0 <createdelete+0xe0>
+  printf(1, "createdelete ok\n");
+    1811:	83 ec 08             	sub    $0x8,%esp
+    1814:	68 ab 4c 00 00       	push   $0x4cab
+    1819:	6a 01                	push   $0x1
+    181b:	e8 10 2b 00 00       	call   4330 <printf>
+}
+    1820:	83 c4 10             	add    $0x10,%esp
+    1823:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1826:	5b                   	pop    %ebx
+    1827:	5e                   	pop    %esi
+    1828:	5f                   	pop    %edi
+    1829:	5d                   	pop    %ebp
+    182a:	c3                   	ret
+    182b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    182f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1830:	85 c0                	test   %eax,%eax
+    1832:	78 91                	js     17c5 <createdelete+0xc5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1834:	50                   	push   %eax
+    1835:	56                   	push   %esi
+    1836:	68 d0 59 00 00       	push   $0x59d0
+    183b:	6a 01                	push   $0x1
+    183d:	e8 ee 2a 00 00       	call   4330 <printf>
+        exit(1);
+    1842:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1849:	e8 05 29 00 00       	call   4153 <exit>
+    184e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1850:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1853:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1857:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    185a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    185d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1860:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1863:	8d 43 30             	lea    0x30(%ebx),%eax
+    1866:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1869:	68 02 02 00 00       	push   $0x202
+    186e:	56                   	push   %esi
+    186f:	e8 1f 29 00 00       	call   4193 <open>
+        if(fd < 0){
+    1874:	83 c4 10             	add    $0x10,%esp
+    1877:	85 c0                	test   %eax,%eax
+    1879:	0f 88 a8 00 00 00    	js     1927 <createdelete+0x227>
+        close(fd);
+    187f:	83 ec 0c             	sub    $0xc,%esp
+    1882:	50                   	push   %eax
+    1883:	e8 f3 28 00 00       	call   417b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1888:	83 c4 10             	add    $0x10,%esp
+    188b:	85 db                	test   %ebx,%ebx
+    188d:	74 21                	je     18b0 <createdelete+0x1b0>
+    188f:	f6 c3 01             	test   $0x1,%bl
+    1892:	74 23                	je     18b7 <createdelete+0x1b7>
+      for(i = 0; i < N; i++){
+    1894:	83 c3 01             	add    $0x1,%ebx
+    1897:	83 fb 14             	cmp    $0x14,%ebx
+    189a:	75 c4                	jne    1860 <createdelete+0x160>
+      exit(0);
+    189c:	83 ec 0c             	sub    $0xc,%esp
+    189f:	6a 00                	push   $0x0
+    18a1:	e8 ad 28 00 00       	call   4153 <exit>
+    18a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    18ad:	8d 76 00             	lea    0x0(%esi),%esi
+      for(i = 0; i < N; i++){
+    18b0:	bb 01 00 00 00       	mov    $0x1,%ebx
+    18b5:	eb a9                	jmp    1860 <createdelete+0x160>
+          name[1] = '0' + (i / 2);
+    18b7:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    18b9:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    18bc:	d1 f8                	sar    %eax
+    18be:	83 c0 30             	add    $0x30,%eax
+    18c1:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    18c4:	56                   	push   %esi
+    18c5:	e8 d9 28 00 00       	call   41a3 <unlink>
+    18ca:	83 c4 10             	add    $0x10,%esp
+    18cd:	85 c0                	test   %eax,%eax
+    18cf:	79 c3                	jns    1894 <createdelete+0x194>
+            printf(1, "unlink failed\n");
+    18d1:	52                   	push   %edx
+    18d2:	52                   	push   %edx
+    18d3:	68 f1 47 00 00       	push   $0x47f1
+    18d8:	6a 01                	push   $0x1
+    18da:	e8 51 2a 00 00       	call   4330 <printf>
+            exit(1);
+    18df:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    18e6:	e8 68 28 00 00       	call   4153 <exit>
+    18eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18ef:	90                   	nop
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    18f0:	83 ec 04             	sub    $0x4,%esp
+    18f3:	56                   	push   %esi
+    18f4:	68 ac 59 00 00       	push   $0x59ac
+    18f9:	6a 01                	push   $0x1
+    18fb:	e8 30 2a 00 00       	call   4330 <printf>
+        exit(1);
+    1900:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1907:	e8 47 28 00 00       	call   4153 <exit>
+      printf(1, "fork failed\n");
+    190c:	83 ec 08             	sub    $0x8,%esp
+    190f:	68 21 57 00 00       	push   $0x5721
+    1914:	6a 01                	push   $0x1
+    1916:	e8 15 2a 00 00       	call   4330 <printf>
+      exit(1);
+    191b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1922:	e8 2c 28 00 00       	call   4153 <exit>
+          printf(1, "create failed\n");
+    1927:	83 ec 08             	sub    $0x8,%esp
+    192a:	68 e7 4e 00 00       	push   $0x4ee7
+    192f:	6a 01                	push   $0x1
+    1931:	e8 fa 29 00 00       	call   4330 <printf>
+          exit(1);
+    1936:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    193d:	e8 11 28 00 00       	call   4153 <exit>
+    1942:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001950 <unlinkread>:
+{
+    1950:	55                   	push   %ebp
+    1951:	89 e5                	mov    %esp,%ebp
+    1953:	56                   	push   %esi
+    1954:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1955:	83 ec 08             	sub    $0x8,%esp
+    1958:	68 bc 4c 00 00       	push   $0x4cbc
+    195d:	6a 01                	push   $0x1
+    195f:	e8 cc 29 00 00       	call   4330 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1964:	5b                   	pop    %ebx
+    1965:	5e                   	pop    %esi
+    1966:	68 02 02 00 00       	push   $0x202
+    196b:	68 cd 4c 00 00       	push   $0x4ccd
+    1970:	e8 1e 28 00 00       	call   4193 <open>
+  if(fd < 0){
+    1975:	83 c4 10             	add    $0x10,%esp
+    1978:	85 c0                	test   %eax,%eax
+    197a:	0f 88 e6 00 00 00    	js     1a66 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1980:	83 ec 04             	sub    $0x4,%esp
+    1983:	89 c3                	mov    %eax,%ebx
+    1985:	6a 05                	push   $0x5
+    1987:	68 f2 4c 00 00       	push   $0x4cf2
+    198c:	50                   	push   %eax
+    198d:	e8 e1 27 00 00       	call   4173 <write>
+  close(fd);
+    1992:	89 1c 24             	mov    %ebx,(%esp)
+    1995:	e8 e1 27 00 00       	call   417b <close>
+  fd = open("unlinkread", O_RDWR);
+    199a:	58                   	pop    %eax
+    199b:	5a                   	pop    %edx
+    199c:	6a 02                	push   $0x2
+    199e:	68 cd 4c 00 00       	push   $0x4ccd
+    19a3:	e8 eb 27 00 00       	call   4193 <open>
+  if(fd < 0){
+    19a8:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    19ab:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    19ad:	85 c0                	test   %eax,%eax
+    19af:	0f 88 33 01 00 00    	js     1ae8 <unlinkread+0x198>
+  if(unlink("unlinkread") != 0){
+    19b5:	83 ec 0c             	sub    $0xc,%esp
+    19b8:	68 cd 4c 00 00       	push   $0x4ccd
+    19bd:	e8 e1 27 00 00       	call   41a3 <unlink>
+    19c2:	83 c4 10             	add    $0x10,%esp
+    19c5:	85 c0                	test   %eax,%eax
+    19c7:	0f 85 01 01 00 00    	jne    1ace <unlinkread+0x17e>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    19cd:	83 ec 08             	sub    $0x8,%esp
+    19d0:	68 02 02 00 00       	push   $0x202
+    19d5:	68 cd 4c 00 00       	push   $0x4ccd
+    19da:	e8 b4 27 00 00       	call   4193 <open>
+  write(fd1, "yyy", 3);
+    19df:	83 c4 0c             	add    $0xc,%esp
+    19e2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    19e4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    19e6:	68 2a 4d 00 00       	push   $0x4d2a
+    19eb:	50                   	push   %eax
+    19ec:	e8 82 27 00 00       	call   4173 <write>
+  close(fd1);
+    19f1:	89 34 24             	mov    %esi,(%esp)
+    19f4:	e8 82 27 00 00       	call   417b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    19f9:	83 c4 0c             	add    $0xc,%esp
+    19fc:	68 00 20 00 00       	push   $0x2000
+    1a01:	68 e0 90 00 00       	push   $0x90e0
+    1a06:	53                   	push   %ebx
+    1a07:	e8 5f 27 00 00       	call   416b <read>
+    1a0c:	83 c4 10             	add    $0x10,%esp
+    1a0f:	83 f8 05             	cmp    $0x5,%eax
+    1a12:	0f 85 9c 00 00 00    	jne    1ab4 <unlinkread+0x164>
+  if(buf[0] != 'h'){
+    1a18:	80 3d e0 90 00 00 68 	cmpb   $0x68,0x90e0
+    1a1f:	75 79                	jne    1a9a <unlinkread+0x14a>
+  if(write(fd, buf, 10) != 10){
+    1a21:	83 ec 04             	sub    $0x4,%esp
+    1a24:	6a 0a                	push   $0xa
+    1a26:	68 e0 90 00 00       	push   $0x90e0
+    1a2b:	53                   	push   %ebx
+    1a2c:	e8 42 27 00 00       	call   4173 <write>
+    1a31:	83 c4 10             	add    $0x10,%esp
+    1a34:	83 f8 0a             	cmp    $0xa,%eax
+    1a37:	75 47                	jne    1a80 <unlinkread+0x130>
+  close(fd);
+    1a39:	83 ec 0c             	sub    $0xc,%esp
+    1a3c:	53                   	push   %ebx
+    1a3d:	e8 39 27 00 00       	call   417b <close>
+  unlink("unlinkread");
+    1a42:	c7 04 24 cd 4c 00 00 	movl   $0x4ccd,(%esp)
+    1a49:	e8 55 27 00 00       	call   41a3 <unlink>
+  printf(1, "unlinkread ok\n");
+    1a4e:	58                   	pop    %eax
+    1a4f:	5a                   	pop    %edx
+    1a50:	68 75 4d 00 00       	push   $0x4d75
+    1a55:	6a 01                	push   $0x1
+    1a57:	e8 d4 28 00 00       	call   4330 <printf>
+}
+    1a5c:	83 c4 10             	add    $0x10,%esp
+    1a5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1a62:	5b                   	pop    %ebx
+    1a63:	5e                   	pop    %esi
+    1a64:	5d                   	pop    %ebp
+    1a65:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1a66:	51                   	push   %ecx
+    1a67:	51                   	push   %ecx
+    1a68:	68 d8 4c 00 00       	push   $0x4cd8
+    1a6d:	6a 01                	push   $0x1
+    1a6f:	e8 bc 28 00 00       	call   4330 <printf>
+    exit(1);
+    1a74:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1a7b:	e8 d3 26 00 00       	call   4153 <exit>
+    printf(1, "unlinkread write failed\n");
+    1a80:	51                   	push   %ecx
+    1a81:	51                   	push   %ecx
+    1a82:	68 5c 4d 00 00       	push   $0x4d5c
+    1a87:	6a 01                	push   $0x1
+    1a89:	e8 a2 28 00 00       	call   4330 <printf>
+    exit(1);
+    1a8e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1a95:	e8 b9 26 00 00       	call   4153 <exit>
+    printf(1, "unlinkread wrong data\n");
+    1a9a:	53                   	push   %ebx
+    1a9b:	53                   	push   %ebx
+    1a9c:	68 45 4d 00 00       	push   $0x4d45
+    1aa1:	6a 01                	push   $0x1
+    1aa3:	e8 88 28 00 00       	call   4330 <printf>
+    exit(1);
+    1aa8:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1aaf:	e8 9f 26 00 00       	call   4153 <exit>
+    printf(1, "unlinkread read failed");
+    1ab4:	56                   	push   %esi
+    1ab5:	56                   	push   %esi
+    1ab6:	68 2e 4d 00 00       	push   $0x4d2e
+    1abb:	6a 01                	push   $0x1
+    1abd:	e8 6e 28 00 00       	call   4330 <printf>
+    exit(1);
+    1ac2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1ac9:	e8 85 26 00 00       	call   4153 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1ace:	50                   	push   %eax
+    1acf:	50                   	push   %eax
+    1ad0:	68 10 4d 00 00       	push   $0x4d10
+    1ad5:	6a 01                	push   $0x1
+    1ad7:	e8 54 28 00 00       	call   4330 <printf>
+    exit(1);
+    1adc:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1ae3:	e8 6b 26 00 00       	call   4153 <exit>
+    printf(1, "open unlinkread failed\n");
+    1ae8:	50                   	push   %eax
+    1ae9:	50                   	push   %eax
+    1aea:	68 f8 4c 00 00       	push   $0x4cf8
+    1aef:	6a 01                	push   $0x1
+    1af1:	e8 3a 28 00 00       	call   4330 <printf>
+    exit(1);
+    1af6:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1afd:	e8 51 26 00 00       	call   4153 <exit>
+    1b02:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b09:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001b10 <linktest>:
+{
+    1b10:	55                   	push   %ebp
+    1b11:	89 e5                	mov    %esp,%ebp
+    1b13:	53                   	push   %ebx
+    1b14:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    1b17:	68 84 4d 00 00       	push   $0x4d84
+    1b1c:	6a 01                	push   $0x1
+    1b1e:	e8 0d 28 00 00       	call   4330 <printf>
+  unlink("lf1");
+    1b23:	c7 04 24 8e 4d 00 00 	movl   $0x4d8e,(%esp)
+    1b2a:	e8 74 26 00 00       	call   41a3 <unlink>
+  unlink("lf2");
+    1b2f:	c7 04 24 92 4d 00 00 	movl   $0x4d92,(%esp)
+    1b36:	e8 68 26 00 00       	call   41a3 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    1b3b:	58                   	pop    %eax
+    1b3c:	5a                   	pop    %edx
+    1b3d:	68 02 02 00 00       	push   $0x202
+    1b42:	68 8e 4d 00 00       	push   $0x4d8e
+    1b47:	e8 47 26 00 00       	call   4193 <open>
+  if(fd < 0){
+    1b4c:	83 c4 10             	add    $0x10,%esp
+    1b4f:	85 c0                	test   %eax,%eax
+    1b51:	0f 88 1e 01 00 00    	js     1c75 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1b57:	83 ec 04             	sub    $0x4,%esp
+    1b5a:	89 c3                	mov    %eax,%ebx
+    1b5c:	6a 05                	push   $0x5
+    1b5e:	68 f2 4c 00 00       	push   $0x4cf2
+    1b63:	50                   	push   %eax
+    1b64:	e8 0a 26 00 00       	call   4173 <write>
+    1b69:	83 c4 10             	add    $0x10,%esp
+    1b6c:	83 f8 05             	cmp    $0x5,%eax
+    1b6f:	0f 85 d0 01 00 00    	jne    1d45 <linktest+0x235>
+  close(fd);
+    1b75:	83 ec 0c             	sub    $0xc,%esp
+    1b78:	53                   	push   %ebx
+    1b79:	e8 fd 25 00 00       	call   417b <close>
+  if(link("lf1", "lf2") < 0){
+    1b7e:	5b                   	pop    %ebx
+    1b7f:	58                   	pop    %eax
+    1b80:	68 92 4d 00 00       	push   $0x4d92
+    1b85:	68 8e 4d 00 00       	push   $0x4d8e
+    1b8a:	e8 24 26 00 00       	call   41b3 <link>
+    1b8f:	83 c4 10             	add    $0x10,%esp
+    1b92:	85 c0                	test   %eax,%eax
+    1b94:	0f 88 91 01 00 00    	js     1d2b <linktest+0x21b>
+  unlink("lf1");
+    1b9a:	83 ec 0c             	sub    $0xc,%esp
+    1b9d:	68 8e 4d 00 00       	push   $0x4d8e
+    1ba2:	e8 fc 25 00 00       	call   41a3 <unlink>
+  if(open("lf1", 0) >= 0){
+    1ba7:	58                   	pop    %eax
+    1ba8:	5a                   	pop    %edx
+    1ba9:	6a 00                	push   $0x0
+    1bab:	68 8e 4d 00 00       	push   $0x4d8e
+    1bb0:	e8 de 25 00 00       	call   4193 <open>
+    1bb5:	83 c4 10             	add    $0x10,%esp
+    1bb8:	85 c0                	test   %eax,%eax
+    1bba:	0f 89 51 01 00 00    	jns    1d11 <linktest+0x201>
+  fd = open("lf2", 0);
+    1bc0:	83 ec 08             	sub    $0x8,%esp
+    1bc3:	6a 00                	push   $0x0
+    1bc5:	68 92 4d 00 00       	push   $0x4d92
+    1bca:	e8 c4 25 00 00       	call   4193 <open>
+  if(fd < 0){
+    1bcf:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1bd2:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1bd4:	85 c0                	test   %eax,%eax
+    1bd6:	0f 88 1b 01 00 00    	js     1cf7 <linktest+0x1e7>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1bdc:	83 ec 04             	sub    $0x4,%esp
+    1bdf:	68 00 20 00 00       	push   $0x2000
+    1be4:	68 e0 90 00 00       	push   $0x90e0
+    1be9:	50                   	push   %eax
+    1bea:	e8 7c 25 00 00       	call   416b <read>
+    1bef:	83 c4 10             	add    $0x10,%esp
+    1bf2:	83 f8 05             	cmp    $0x5,%eax
+    1bf5:	0f 85 e2 00 00 00    	jne    1cdd <linktest+0x1cd>
+  close(fd);
+    1bfb:	83 ec 0c             	sub    $0xc,%esp
+    1bfe:	53                   	push   %ebx
+    1bff:	e8 77 25 00 00       	call   417b <close>
+  if(link("lf2", "lf2") >= 0){
+    1c04:	58                   	pop    %eax
+    1c05:	5a                   	pop    %edx
+    1c06:	68 92 4d 00 00       	push   $0x4d92
+    1c0b:	68 92 4d 00 00       	push   $0x4d92
+    1c10:	e8 9e 25 00 00       	call   41b3 <link>
+    1c15:	83 c4 10             	add    $0x10,%esp
+    1c18:	85 c0                	test   %eax,%eax
+    1c1a:	0f 89 a3 00 00 00    	jns    1cc3 <linktest+0x1b3>
+  unlink("lf2");
+    1c20:	83 ec 0c             	sub    $0xc,%esp
+    1c23:	68 92 4d 00 00       	push   $0x4d92
+    1c28:	e8 76 25 00 00       	call   41a3 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    1c2d:	59                   	pop    %ecx
+    1c2e:	5b                   	pop    %ebx
+    1c2f:	68 8e 4d 00 00       	push   $0x4d8e
+    1c34:	68 92 4d 00 00       	push   $0x4d92
+    1c39:	e8 75 25 00 00       	call   41b3 <link>
+    1c3e:	83 c4 10             	add    $0x10,%esp
+    1c41:	85 c0                	test   %eax,%eax
+    1c43:	79 64                	jns    1ca9 <linktest+0x199>
+  if(link(".", "lf1") >= 0){
+    1c45:	83 ec 08             	sub    $0x8,%esp
+    1c48:	68 8e 4d 00 00       	push   $0x4d8e
+    1c4d:	68 56 50 00 00       	push   $0x5056
+    1c52:	e8 5c 25 00 00       	call   41b3 <link>
+    1c57:	83 c4 10             	add    $0x10,%esp
+    1c5a:	85 c0                	test   %eax,%eax
+    1c5c:	79 31                	jns    1c8f <linktest+0x17f>
+  printf(1, "linktest ok\n");
+    1c5e:	83 ec 08             	sub    $0x8,%esp
+    1c61:	68 2c 4e 00 00       	push   $0x4e2c
+    1c66:	6a 01                	push   $0x1
+    1c68:	e8 c3 26 00 00       	call   4330 <printf>
+}
+    1c6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c70:	83 c4 10             	add    $0x10,%esp
+    1c73:	c9                   	leave
+    1c74:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1c75:	50                   	push   %eax
+    1c76:	50                   	push   %eax
+    1c77:	68 96 4d 00 00       	push   $0x4d96
+    1c7c:	6a 01                	push   $0x1
+    1c7e:	e8 ad 26 00 00       	call   4330 <printf>
+    exit(1);
+    1c83:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1c8a:	e8 c4 24 00 00       	call   4153 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1c8f:	50                   	push   %eax
+    1c90:	50                   	push   %eax
+    1c91:	68 10 4e 00 00       	push   $0x4e10
+    1c96:	6a 01                	push   $0x1
+    1c98:	e8 93 26 00 00       	call   4330 <printf>
+    exit(1);
+    1c9d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1ca4:	e8 aa 24 00 00       	call   4153 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    1ca9:	52                   	push   %edx
+    1caa:	52                   	push   %edx
+    1cab:	68 18 5a 00 00       	push   $0x5a18
+    1cb0:	6a 01                	push   $0x1
+    1cb2:	e8 79 26 00 00       	call   4330 <printf>
+    exit(1);
+    1cb7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1cbe:	e8 90 24 00 00       	call   4153 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1cc3:	50                   	push   %eax
+    1cc4:	50                   	push   %eax
+    1cc5:	68 f2 4d 00 00       	push   $0x4df2
+    1cca:	6a 01                	push   $0x1
+    1ccc:	e8 5f 26 00 00       	call   4330 <printf>
+    exit(1);
+    1cd1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1cd8:	e8 76 24 00 00       	call   4153 <exit>
+    printf(1, "read lf2 failed\n");
+    1cdd:	51                   	push   %ecx
+    1cde:	51                   	push   %ecx
+    1cdf:	68 e1 4d 00 00       	push   $0x4de1
+    1ce4:	6a 01                	push   $0x1
+    1ce6:	e8 45 26 00 00       	call   4330 <printf>
+    exit(1);
+    1ceb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1cf2:	e8 5c 24 00 00       	call   4153 <exit>
+    printf(1, "open lf2 failed\n");
+    1cf7:	53                   	push   %ebx
+    1cf8:	53                   	push   %ebx
+    1cf9:	68 d0 4d 00 00       	push   $0x4dd0
+    1cfe:	6a 01                	push   $0x1
+    1d00:	e8 2b 26 00 00       	call   4330 <printf>
+    exit(1);
+    1d05:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1d0c:	e8 42 24 00 00       	call   4153 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1d11:	50                   	push   %eax
+    1d12:	50                   	push   %eax
+    1d13:	68 f0 59 00 00       	push   $0x59f0
+    1d18:	6a 01                	push   $0x1
+    1d1a:	e8 11 26 00 00       	call   4330 <printf>
+    exit(1);
+    1d1f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1d26:	e8 28 24 00 00       	call   4153 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1d2b:	51                   	push   %ecx
+    1d2c:	51                   	push   %ecx
+    1d2d:	68 bb 4d 00 00       	push   $0x4dbb
+    1d32:	6a 01                	push   $0x1
+    1d34:	e8 f7 25 00 00       	call   4330 <printf>
+    exit(1);
+    1d39:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1d40:	e8 0e 24 00 00       	call   4153 <exit>
+    printf(1, "write lf1 failed\n");
+    1d45:	50                   	push   %eax
+    1d46:	50                   	push   %eax
+    1d47:	68 a9 4d 00 00       	push   $0x4da9
+    1d4c:	6a 01                	push   $0x1
+    1d4e:	e8 dd 25 00 00       	call   4330 <printf>
+    exit(1);
+    1d53:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1d5a:	e8 f4 23 00 00       	call   4153 <exit>
+    1d5f:	90                   	nop
+
+00001d60 <concreate>:
+{
+    1d60:	55                   	push   %ebp
+    1d61:	89 e5                	mov    %esp,%ebp
+    1d63:	57                   	push   %edi
+    1d64:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1d65:	31 f6                	xor    %esi,%esi
+{
+    1d67:	53                   	push   %ebx
+    1d68:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    1d6b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    1d6e:	68 39 4e 00 00       	push   $0x4e39
+    1d73:	6a 01                	push   $0x1
+    1d75:	e8 b6 25 00 00       	call   4330 <printf>
+  file[0] = 'C';
+    1d7a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    1d7e:	83 c4 10             	add    $0x10,%esp
+    1d81:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1d85:	eb 57                	jmp    1dde <concreate+0x7e>
+    1d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d8e:	66 90                	xchg   %ax,%ax
+    1d90:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1d96:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    1d9b:	0f 83 9f 00 00 00    	jae    1e40 <concreate+0xe0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1da1:	83 ec 08             	sub    $0x8,%esp
+    1da4:	68 02 02 00 00       	push   $0x202
+    1da9:	53                   	push   %ebx
+    1daa:	e8 e4 23 00 00       	call   4193 <open>
+      if(fd < 0){
+    1daf:	83 c4 10             	add    $0x10,%esp
+    1db2:	85 c0                	test   %eax,%eax
+    1db4:	78 6a                	js     1e20 <concreate+0xc0>
+      close(fd);
+    1db6:	83 ec 0c             	sub    $0xc,%esp
+    1db9:	50                   	push   %eax
+    1dba:	e8 bc 23 00 00       	call   417b <close>
+    1dbf:	83 c4 10             	add    $0x10,%esp
+      wait(&estatus);
+    1dc2:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1dc5:	83 c6 01             	add    $0x1,%esi
+      wait(&estatus);
+    1dc8:	68 d0 90 00 00       	push   $0x90d0
+    1dcd:	e8 89 23 00 00       	call   415b <wait>
+  for(i = 0; i < 40; i++){
+    1dd2:	83 c4 10             	add    $0x10,%esp
+    1dd5:	83 fe 28             	cmp    $0x28,%esi
+    1dd8:	0f 84 a2 00 00 00    	je     1e80 <concreate+0x120>
+    unlink(file);
+    1dde:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1de1:	8d 46 30             	lea    0x30(%esi),%eax
+    1de4:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    1de7:	53                   	push   %ebx
+    1de8:	e8 b6 23 00 00       	call   41a3 <unlink>
+    pid = fork();
+    1ded:	e8 59 23 00 00       	call   414b <fork>
+    if(pid && (i % 3) == 1){
+    1df2:	83 c4 10             	add    $0x10,%esp
+    1df5:	85 c0                	test   %eax,%eax
+    1df7:	75 97                	jne    1d90 <concreate+0x30>
+      link("C0", file);
+    1df9:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1dff:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    1e05:	73 59                	jae    1e60 <concreate+0x100>
+      fd = open(file, O_CREATE | O_RDWR);
+    1e07:	83 ec 08             	sub    $0x8,%esp
+    1e0a:	68 02 02 00 00       	push   $0x202
+    1e0f:	53                   	push   %ebx
+    1e10:	e8 7e 23 00 00       	call   4193 <open>
+      if(fd < 0){
+    1e15:	83 c4 10             	add    $0x10,%esp
+    1e18:	85 c0                	test   %eax,%eax
+    1e1a:	0f 89 0a 02 00 00    	jns    202a <concreate+0x2ca>
+        printf(1, "concreate create %s failed\n", file);
+    1e20:	83 ec 04             	sub    $0x4,%esp
+    1e23:	53                   	push   %ebx
+    1e24:	68 4c 4e 00 00       	push   $0x4e4c
+    1e29:	6a 01                	push   $0x1
+    1e2b:	e8 00 25 00 00       	call   4330 <printf>
+        exit(1);
+    1e30:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    1e37:	e8 17 23 00 00       	call   4153 <exit>
+    1e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1e40:	83 ec 08             	sub    $0x8,%esp
+    1e43:	53                   	push   %ebx
+    1e44:	68 49 4e 00 00       	push   $0x4e49
+    1e49:	e8 65 23 00 00       	call   41b3 <link>
+    1e4e:	83 c4 10             	add    $0x10,%esp
+    1e51:	e9 6c ff ff ff       	jmp    1dc2 <concreate+0x62>
+    1e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e5d:	8d 76 00             	lea    0x0(%esi),%esi
+      link("C0", file);
+    1e60:	83 ec 08             	sub    $0x8,%esp
+    1e63:	53                   	push   %ebx
+    1e64:	68 49 4e 00 00       	push   $0x4e49
+    1e69:	e8 45 23 00 00       	call   41b3 <link>
+    1e6e:	83 c4 10             	add    $0x10,%esp
+      exit(0);
+    1e71:	83 ec 0c             	sub    $0xc,%esp
+    1e74:	6a 00                	push   $0x0
+    1e76:	e8 d8 22 00 00       	call   4153 <exit>
+    1e7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1e7f:	90                   	nop
+  memset(fa, 0, sizeof(fa));
+    1e80:	83 ec 04             	sub    $0x4,%esp
+    1e83:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    1e86:	6a 28                	push   $0x28
+    1e88:	6a 00                	push   $0x0
+    1e8a:	50                   	push   %eax
+    1e8b:	e8 40 21 00 00       	call   3fd0 <memset>
+  fd = open(".", 0);
+    1e90:	5e                   	pop    %esi
+    1e91:	5f                   	pop    %edi
+    1e92:	6a 00                	push   $0x0
+    1e94:	68 56 50 00 00       	push   $0x5056
+    1e99:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    1e9c:	e8 f2 22 00 00       	call   4193 <open>
+  n = 0;
+    1ea1:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1ea8:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1eab:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1ead:	8d 76 00             	lea    0x0(%esi),%esi
+    1eb0:	83 ec 04             	sub    $0x4,%esp
+    1eb3:	6a 10                	push   $0x10
+    1eb5:	57                   	push   %edi
+    1eb6:	56                   	push   %esi
+    1eb7:	e8 af 22 00 00       	call   416b <read>
+    1ebc:	83 c4 10             	add    $0x10,%esp
+    1ebf:	85 c0                	test   %eax,%eax
+    1ec1:	7e 3d                	jle    1f00 <concreate+0x1a0>
+    if(de.inum == 0)
+    1ec3:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1ec8:	74 e6                	je     1eb0 <concreate+0x150>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1eca:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    1ece:	75 e0                	jne    1eb0 <concreate+0x150>
+    1ed0:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1ed4:	75 da                	jne    1eb0 <concreate+0x150>
+      i = de.name[1] - '0';
+    1ed6:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    1eda:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1edd:	83 f8 27             	cmp    $0x27,%eax
+    1ee0:	0f 87 55 01 00 00    	ja     203b <concreate+0x2db>
+      if(fa[i]){
+    1ee6:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    1eeb:	0f 85 83 01 00 00    	jne    2074 <concreate+0x314>
+      n++;
+    1ef1:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1ef5:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    1efa:	eb b4                	jmp    1eb0 <concreate+0x150>
+    1efc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  close(fd);
+    1f00:	83 ec 0c             	sub    $0xc,%esp
+    1f03:	56                   	push   %esi
+    1f04:	e8 72 22 00 00       	call   417b <close>
+  if(n != 40){
+    1f09:	83 c4 10             	add    $0x10,%esp
+    1f0c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1f10:	0f 85 44 01 00 00    	jne    205a <concreate+0x2fa>
+  for(i = 0; i < 40; i++){
+    1f16:	31 f6                	xor    %esi,%esi
+    1f18:	eb 57                	jmp    1f71 <concreate+0x211>
+    1f1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1f20:	85 ff                	test   %edi,%edi
+    1f22:	74 05                	je     1f29 <concreate+0x1c9>
+    1f24:	83 f8 01             	cmp    $0x1,%eax
+    1f27:	74 77                	je     1fa0 <concreate+0x240>
+      unlink(file);
+    1f29:	83 ec 0c             	sub    $0xc,%esp
+    1f2c:	53                   	push   %ebx
+    1f2d:	e8 71 22 00 00       	call   41a3 <unlink>
+      unlink(file);
+    1f32:	89 1c 24             	mov    %ebx,(%esp)
+    1f35:	e8 69 22 00 00       	call   41a3 <unlink>
+      unlink(file);
+    1f3a:	89 1c 24             	mov    %ebx,(%esp)
+    1f3d:	e8 61 22 00 00       	call   41a3 <unlink>
+      unlink(file);
+    1f42:	89 1c 24             	mov    %ebx,(%esp)
+    1f45:	e8 59 22 00 00       	call   41a3 <unlink>
+    1f4a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1f4d:	85 ff                	test   %edi,%edi
+    1f4f:	0f 84 1c ff ff ff    	je     1e71 <concreate+0x111>
+      wait(&estatus);
+    1f55:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1f58:	83 c6 01             	add    $0x1,%esi
+      wait(&estatus);
+    1f5b:	68 d0 90 00 00       	push   $0x90d0
+    1f60:	e8 f6 21 00 00       	call   415b <wait>
+  for(i = 0; i < 40; i++){
+    1f65:	83 c4 10             	add    $0x10,%esp
+    1f68:	83 fe 28             	cmp    $0x28,%esi
+    1f6b:	0f 84 87 00 00 00    	je     1ff8 <concreate+0x298>
+    file[1] = '0' + i;
+    1f71:	8d 46 30             	lea    0x30(%esi),%eax
+    1f74:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1f77:	e8 cf 21 00 00       	call   414b <fork>
+    1f7c:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1f7e:	85 c0                	test   %eax,%eax
+    1f80:	0f 88 89 00 00 00    	js     200f <concreate+0x2af>
+    if(((i % 3) == 0 && pid == 0) ||
+    1f86:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1f8b:	f7 e6                	mul    %esi
+    1f8d:	89 d0                	mov    %edx,%eax
+    1f8f:	83 e2 fe             	and    $0xfffffffe,%edx
+    1f92:	d1 e8                	shr    %eax
+    1f94:	01 c2                	add    %eax,%edx
+    1f96:	89 f0                	mov    %esi,%eax
+    1f98:	29 d0                	sub    %edx,%eax
+    1f9a:	89 c1                	mov    %eax,%ecx
+    1f9c:	09 f9                	or     %edi,%ecx
+    1f9e:	75 80                	jne    1f20 <concreate+0x1c0>
+      close(open(file, 0));
+    1fa0:	83 ec 08             	sub    $0x8,%esp
+    1fa3:	6a 00                	push   $0x0
+    1fa5:	53                   	push   %ebx
+    1fa6:	e8 e8 21 00 00       	call   4193 <open>
+    1fab:	89 04 24             	mov    %eax,(%esp)
+    1fae:	e8 c8 21 00 00       	call   417b <close>
+      close(open(file, 0));
+    1fb3:	58                   	pop    %eax
+    1fb4:	5a                   	pop    %edx
+    1fb5:	6a 00                	push   $0x0
+    1fb7:	53                   	push   %ebx
+    1fb8:	e8 d6 21 00 00       	call   4193 <open>
+    1fbd:	89 04 24             	mov    %eax,(%esp)
+    1fc0:	e8 b6 21 00 00       	call   417b <close>
+      close(open(file, 0));
+    1fc5:	59                   	pop    %ecx
+    1fc6:	58                   	pop    %eax
+    1fc7:	6a 00                	push   $0x0
+    1fc9:	53                   	push   %ebx
+    1fca:	e8 c4 21 00 00       	call   4193 <open>
+    1fcf:	89 04 24             	mov    %eax,(%esp)
+    1fd2:	e8 a4 21 00 00       	call   417b <close>
+      close(open(file, 0));
+    1fd7:	58                   	pop    %eax
+    1fd8:	5a                   	pop    %edx
+    1fd9:	6a 00                	push   $0x0
+    1fdb:	53                   	push   %ebx
+    1fdc:	e8 b2 21 00 00       	call   4193 <open>
+    1fe1:	89 04 24             	mov    %eax,(%esp)
+    1fe4:	e8 92 21 00 00       	call   417b <close>
+    1fe9:	83 c4 10             	add    $0x10,%esp
+    1fec:	e9 5c ff ff ff       	jmp    1f4d <concreate+0x1ed>
+    1ff1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  printf(1, "concreate ok\n");
+    1ff8:	83 ec 08             	sub    $0x8,%esp
+    1ffb:	68 9e 4e 00 00       	push   $0x4e9e
+    2000:	6a 01                	push   $0x1
+    2002:	e8 29 23 00 00       	call   4330 <printf>
+}
+    2007:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    200a:	5b                   	pop    %ebx
+    200b:	5e                   	pop    %esi
+    200c:	5f                   	pop    %edi
+    200d:	5d                   	pop    %ebp
+    200e:	c3                   	ret
+      printf(1, "fork failed\n");
+    200f:	83 ec 08             	sub    $0x8,%esp
+    2012:	68 21 57 00 00       	push   $0x5721
+    2017:	6a 01                	push   $0x1
+    2019:	e8 12 23 00 00       	call   4330 <printf>
+      exit(1);
+    201e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2025:	e8 29 21 00 00       	call   4153 <exit>
+      close(fd);
+    202a:	83 ec 0c             	sub    $0xc,%esp
+    202d:	50                   	push   %eax
+    202e:	e8 48 21 00 00       	call   417b <close>
+    2033:	83 c4 10             	add    $0x10,%esp
+    2036:	e9 36 fe ff ff       	jmp    1e71 <concreate+0x111>
+        printf(1, "concreate weird file %s\n", de.name);
+    203b:	83 ec 04             	sub    $0x4,%esp
+    203e:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    2041:	50                   	push   %eax
+    2042:	68 68 4e 00 00       	push   $0x4e68
+    2047:	6a 01                	push   $0x1
+    2049:	e8 e2 22 00 00       	call   4330 <printf>
+        exit(1);
+    204e:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2055:	e8 f9 20 00 00       	call   4153 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    205a:	51                   	push   %ecx
+    205b:	51                   	push   %ecx
+    205c:	68 3c 5a 00 00       	push   $0x5a3c
+    2061:	6a 01                	push   $0x1
+    2063:	e8 c8 22 00 00       	call   4330 <printf>
+    exit(1);
+    2068:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    206f:	e8 df 20 00 00       	call   4153 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    2074:	83 ec 04             	sub    $0x4,%esp
+    2077:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    207a:	50                   	push   %eax
+    207b:	68 81 4e 00 00       	push   $0x4e81
+    2080:	6a 01                	push   $0x1
+    2082:	e8 a9 22 00 00       	call   4330 <printf>
+        exit(1);
+    2087:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    208e:	e8 c0 20 00 00       	call   4153 <exit>
+    2093:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    209a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000020a0 <linkunlink>:
+{
+    20a0:	55                   	push   %ebp
+    20a1:	89 e5                	mov    %esp,%ebp
+    20a3:	57                   	push   %edi
+    20a4:	56                   	push   %esi
+    20a5:	53                   	push   %ebx
+    20a6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    20a9:	68 ac 4e 00 00       	push   $0x4eac
+    20ae:	6a 01                	push   $0x1
+    20b0:	e8 7b 22 00 00       	call   4330 <printf>
+  unlink("x");
+    20b5:	c7 04 24 39 51 00 00 	movl   $0x5139,(%esp)
+    20bc:	e8 e2 20 00 00       	call   41a3 <unlink>
+  pid = fork();
+    20c1:	e8 85 20 00 00       	call   414b <fork>
+  if(pid < 0){
+    20c6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    20c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    20cc:	85 c0                	test   %eax,%eax
+    20ce:	0f 88 c6 00 00 00    	js     219a <linkunlink+0xfa>
+  unsigned int x = (pid ? 1 : 97);
+    20d4:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    20d8:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    20dd:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    20e2:	19 ff                	sbb    %edi,%edi
+    20e4:	83 e7 60             	and    $0x60,%edi
+    20e7:	83 c7 01             	add    $0x1,%edi
+    20ea:	eb 22                	jmp    210e <linkunlink+0x6e>
+    20ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    20f0:	83 f8 01             	cmp    $0x1,%eax
+    20f3:	0f 84 87 00 00 00    	je     2180 <linkunlink+0xe0>
+      unlink("x");
+    20f9:	83 ec 0c             	sub    $0xc,%esp
+    20fc:	68 39 51 00 00       	push   $0x5139
+    2101:	e8 9d 20 00 00       	call   41a3 <unlink>
+    2106:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2109:	83 eb 01             	sub    $0x1,%ebx
+    210c:	74 41                	je     214f <linkunlink+0xaf>
+    x = x * 1103515245 + 12345;
+    210e:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    2114:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    211a:	89 f8                	mov    %edi,%eax
+    211c:	f7 e6                	mul    %esi
+    211e:	89 d0                	mov    %edx,%eax
+    2120:	83 e2 fe             	and    $0xfffffffe,%edx
+    2123:	d1 e8                	shr    %eax
+    2125:	01 c2                	add    %eax,%edx
+    2127:	89 f8                	mov    %edi,%eax
+    2129:	29 d0                	sub    %edx,%eax
+    212b:	75 c3                	jne    20f0 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    212d:	83 ec 08             	sub    $0x8,%esp
+    2130:	68 02 02 00 00       	push   $0x202
+    2135:	68 39 51 00 00       	push   $0x5139
+    213a:	e8 54 20 00 00       	call   4193 <open>
+    213f:	89 04 24             	mov    %eax,(%esp)
+    2142:	e8 34 20 00 00       	call   417b <close>
+    2147:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    214a:	83 eb 01             	sub    $0x1,%ebx
+    214d:	75 bf                	jne    210e <linkunlink+0x6e>
+  if(pid)
+    214f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    2152:	85 c9                	test   %ecx,%ecx
+    2154:	74 5e                	je     21b4 <linkunlink+0x114>
+    wait(&estatus);
+    2156:	83 ec 0c             	sub    $0xc,%esp
+    2159:	68 d0 90 00 00       	push   $0x90d0
+    215e:	e8 f8 1f 00 00       	call   415b <wait>
+  printf(1, "linkunlink ok\n");
+    2163:	58                   	pop    %eax
+    2164:	5a                   	pop    %edx
+    2165:	68 c1 4e 00 00       	push   $0x4ec1
+    216a:	6a 01                	push   $0x1
+    216c:	e8 bf 21 00 00       	call   4330 <printf>
+}
+    2171:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2174:	5b                   	pop    %ebx
+    2175:	5e                   	pop    %esi
+    2176:	5f                   	pop    %edi
+    2177:	5d                   	pop    %ebp
+    2178:	c3                   	ret
+    2179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      link("cat", "x");
+    2180:	83 ec 08             	sub    $0x8,%esp
+    2183:	68 39 51 00 00       	push   $0x5139
+    2188:	68 bd 4e 00 00       	push   $0x4ebd
+    218d:	e8 21 20 00 00       	call   41b3 <link>
+    2192:	83 c4 10             	add    $0x10,%esp
+    2195:	e9 6f ff ff ff       	jmp    2109 <linkunlink+0x69>
+    printf(1, "fork failed\n");
+    219a:	53                   	push   %ebx
+    219b:	53                   	push   %ebx
+    219c:	68 21 57 00 00       	push   $0x5721
+    21a1:	6a 01                	push   $0x1
+    21a3:	e8 88 21 00 00       	call   4330 <printf>
+    exit(1);
+    21a8:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    21af:	e8 9f 1f 00 00       	call   4153 <exit>
+    exit(0);
+    21b4:	83 ec 0c             	sub    $0xc,%esp
+    21b7:	6a 00                	push   $0x0
+    21b9:	e8 95 1f 00 00       	call   4153 <exit>
+    21be:	66 90                	xchg   %ax,%ax
+
+000021c0 <bigdir>:
+{
+    21c0:	55                   	push   %ebp
+    21c1:	89 e5                	mov    %esp,%ebp
+    21c3:	57                   	push   %edi
+    21c4:	56                   	push   %esi
+    21c5:	53                   	push   %ebx
+    21c6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    21c9:	68 d0 4e 00 00       	push   $0x4ed0
+    21ce:	6a 01                	push   $0x1
+    21d0:	e8 5b 21 00 00       	call   4330 <printf>
+  unlink("bd");
+    21d5:	c7 04 24 dd 4e 00 00 	movl   $0x4edd,(%esp)
+    21dc:	e8 c2 1f 00 00       	call   41a3 <unlink>
+  fd = open("bd", O_CREATE);
+    21e1:	5a                   	pop    %edx
+    21e2:	59                   	pop    %ecx
+    21e3:	68 00 02 00 00       	push   $0x200
+    21e8:	68 dd 4e 00 00       	push   $0x4edd
+    21ed:	e8 a1 1f 00 00       	call   4193 <open>
+  if(fd < 0){
+    21f2:	83 c4 10             	add    $0x10,%esp
+    21f5:	85 c0                	test   %eax,%eax
+    21f7:	0f 88 ec 00 00 00    	js     22e9 <bigdir+0x129>
+  close(fd);
+    21fd:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    2200:	31 f6                	xor    %esi,%esi
+    2202:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    2205:	50                   	push   %eax
+    2206:	e8 70 1f 00 00       	call   417b <close>
+    220b:	83 c4 10             	add    $0x10,%esp
+    220e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    2210:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    2212:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    2215:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2219:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    221c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2220:	83 c0 30             	add    $0x30,%eax
+    2223:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2226:	89 f0                	mov    %esi,%eax
+    2228:	83 e0 3f             	and    $0x3f,%eax
+    222b:	83 c0 30             	add    $0x30,%eax
+    222e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    2231:	57                   	push   %edi
+    2232:	68 dd 4e 00 00       	push   $0x4edd
+    2237:	e8 77 1f 00 00       	call   41b3 <link>
+    223c:	83 c4 10             	add    $0x10,%esp
+    223f:	89 c3                	mov    %eax,%ebx
+    2241:	85 c0                	test   %eax,%eax
+    2243:	75 6e                	jne    22b3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    2245:	83 c6 01             	add    $0x1,%esi
+    2248:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    224e:	75 c0                	jne    2210 <bigdir+0x50>
+  unlink("bd");
+    2250:	83 ec 0c             	sub    $0xc,%esp
+    2253:	68 dd 4e 00 00       	push   $0x4edd
+    2258:	e8 46 1f 00 00       	call   41a3 <unlink>
+    225d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    2260:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    2262:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    2265:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2269:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    226c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2270:	83 c0 30             	add    $0x30,%eax
+    2273:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2276:	89 d8                	mov    %ebx,%eax
+    2278:	83 e0 3f             	and    $0x3f,%eax
+    227b:	83 c0 30             	add    $0x30,%eax
+    227e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    2281:	57                   	push   %edi
+    2282:	e8 1c 1f 00 00       	call   41a3 <unlink>
+    2287:	83 c4 10             	add    $0x10,%esp
+    228a:	85 c0                	test   %eax,%eax
+    228c:	75 40                	jne    22ce <bigdir+0x10e>
+  for(i = 0; i < 500; i++){
+    228e:	83 c3 01             	add    $0x1,%ebx
+    2291:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    2297:	75 c7                	jne    2260 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    2299:	83 ec 08             	sub    $0x8,%esp
+    229c:	68 1f 4f 00 00       	push   $0x4f1f
+    22a1:	6a 01                	push   $0x1
+    22a3:	e8 88 20 00 00       	call   4330 <printf>
+    22a8:	83 c4 10             	add    $0x10,%esp
+}
+    22ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    22ae:	5b                   	pop    %ebx
+    22af:	5e                   	pop    %esi
+    22b0:	5f                   	pop    %edi
+    22b1:	5d                   	pop    %ebp
+    22b2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    22b3:	83 ec 08             	sub    $0x8,%esp
+    22b6:	68 f6 4e 00 00       	push   $0x4ef6
+    22bb:	6a 01                	push   $0x1
+    22bd:	e8 6e 20 00 00       	call   4330 <printf>
+      exit(1);
+    22c2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    22c9:	e8 85 1e 00 00       	call   4153 <exit>
+      printf(1, "bigdir unlink failed");
+    22ce:	83 ec 08             	sub    $0x8,%esp
+    22d1:	68 0a 4f 00 00       	push   $0x4f0a
+    22d6:	6a 01                	push   $0x1
+    22d8:	e8 53 20 00 00       	call   4330 <printf>
+      exit(1);
+    22dd:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    22e4:	e8 6a 1e 00 00       	call   4153 <exit>
+    printf(1, "bigdir create failed\n");
+    22e9:	50                   	push   %eax
+    22ea:	50                   	push   %eax
+    22eb:	68 e0 4e 00 00       	push   $0x4ee0
+    22f0:	6a 01                	push   $0x1
+    22f2:	e8 39 20 00 00       	call   4330 <printf>
+    exit(1);
+    22f7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    22fe:	e8 50 1e 00 00       	call   4153 <exit>
+    2303:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    230a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002310 <subdir>:
+{
+    2310:	55                   	push   %ebp
+    2311:	89 e5                	mov    %esp,%ebp
+    2313:	53                   	push   %ebx
+    2314:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    2317:	68 2a 4f 00 00       	push   $0x4f2a
+    231c:	6a 01                	push   $0x1
+    231e:	e8 0d 20 00 00       	call   4330 <printf>
+  unlink("ff");
+    2323:	c7 04 24 b3 4f 00 00 	movl   $0x4fb3,(%esp)
+    232a:	e8 74 1e 00 00       	call   41a3 <unlink>
+  if(mkdir("dd") != 0){
+    232f:	c7 04 24 50 50 00 00 	movl   $0x5050,(%esp)
+    2336:	e8 80 1e 00 00       	call   41bb <mkdir>
+    233b:	83 c4 10             	add    $0x10,%esp
+    233e:	85 c0                	test   %eax,%eax
+    2340:	0f 85 39 06 00 00    	jne    297f <subdir+0x66f>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2346:	83 ec 08             	sub    $0x8,%esp
+    2349:	68 02 02 00 00       	push   $0x202
+    234e:	68 89 4f 00 00       	push   $0x4f89
+    2353:	e8 3b 1e 00 00       	call   4193 <open>
+  if(fd < 0){
+    2358:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    235b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    235d:	85 c0                	test   %eax,%eax
+    235f:	0f 88 00 06 00 00    	js     2965 <subdir+0x655>
+  write(fd, "ff", 2);
+    2365:	83 ec 04             	sub    $0x4,%esp
+    2368:	6a 02                	push   $0x2
+    236a:	68 b3 4f 00 00       	push   $0x4fb3
+    236f:	50                   	push   %eax
+    2370:	e8 fe 1d 00 00       	call   4173 <write>
+  close(fd);
+    2375:	89 1c 24             	mov    %ebx,(%esp)
+    2378:	e8 fe 1d 00 00       	call   417b <close>
+  if(unlink("dd") >= 0){
+    237d:	c7 04 24 50 50 00 00 	movl   $0x5050,(%esp)
+    2384:	e8 1a 1e 00 00       	call   41a3 <unlink>
+    2389:	83 c4 10             	add    $0x10,%esp
+    238c:	85 c0                	test   %eax,%eax
+    238e:	0f 89 b7 05 00 00    	jns    294b <subdir+0x63b>
+  if(mkdir("/dd/dd") != 0){
+    2394:	83 ec 0c             	sub    $0xc,%esp
+    2397:	68 64 4f 00 00       	push   $0x4f64
+    239c:	e8 1a 1e 00 00       	call   41bb <mkdir>
+    23a1:	83 c4 10             	add    $0x10,%esp
+    23a4:	85 c0                	test   %eax,%eax
+    23a6:	0f 85 85 05 00 00    	jne    2931 <subdir+0x621>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    23ac:	83 ec 08             	sub    $0x8,%esp
+    23af:	68 02 02 00 00       	push   $0x202
+    23b4:	68 86 4f 00 00       	push   $0x4f86
+    23b9:	e8 d5 1d 00 00       	call   4193 <open>
+  if(fd < 0){
+    23be:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    23c1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    23c3:	85 c0                	test   %eax,%eax
+    23c5:	0f 88 54 04 00 00    	js     281f <subdir+0x50f>
+  write(fd, "FF", 2);
+    23cb:	83 ec 04             	sub    $0x4,%esp
+    23ce:	6a 02                	push   $0x2
+    23d0:	68 a7 4f 00 00       	push   $0x4fa7
+    23d5:	50                   	push   %eax
+    23d6:	e8 98 1d 00 00       	call   4173 <write>
+  close(fd);
+    23db:	89 1c 24             	mov    %ebx,(%esp)
+    23de:	e8 98 1d 00 00       	call   417b <close>
+  fd = open("dd/dd/../ff", 0);
+    23e3:	58                   	pop    %eax
+    23e4:	5a                   	pop    %edx
+    23e5:	6a 00                	push   $0x0
+    23e7:	68 aa 4f 00 00       	push   $0x4faa
+    23ec:	e8 a2 1d 00 00       	call   4193 <open>
+  if(fd < 0){
+    23f1:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    23f4:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    23f6:	85 c0                	test   %eax,%eax
+    23f8:	0f 88 07 04 00 00    	js     2805 <subdir+0x4f5>
+  cc = read(fd, buf, sizeof(buf));
+    23fe:	83 ec 04             	sub    $0x4,%esp
+    2401:	68 00 20 00 00       	push   $0x2000
+    2406:	68 e0 90 00 00       	push   $0x90e0
+    240b:	50                   	push   %eax
+    240c:	e8 5a 1d 00 00       	call   416b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2411:	83 c4 10             	add    $0x10,%esp
+    2414:	83 f8 02             	cmp    $0x2,%eax
+    2417:	0f 85 3a 03 00 00    	jne    2757 <subdir+0x447>
+    241d:	80 3d e0 90 00 00 66 	cmpb   $0x66,0x90e0
+    2424:	0f 85 2d 03 00 00    	jne    2757 <subdir+0x447>
+  close(fd);
+    242a:	83 ec 0c             	sub    $0xc,%esp
+    242d:	53                   	push   %ebx
+    242e:	e8 48 1d 00 00       	call   417b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2433:	59                   	pop    %ecx
+    2434:	5b                   	pop    %ebx
+    2435:	68 ea 4f 00 00       	push   $0x4fea
+    243a:	68 86 4f 00 00       	push   $0x4f86
+    243f:	e8 6f 1d 00 00       	call   41b3 <link>
+    2444:	83 c4 10             	add    $0x10,%esp
+    2447:	85 c0                	test   %eax,%eax
+    2449:	0f 85 04 04 00 00    	jne    2853 <subdir+0x543>
+  if(unlink("dd/dd/ff") != 0){
+    244f:	83 ec 0c             	sub    $0xc,%esp
+    2452:	68 86 4f 00 00       	push   $0x4f86
+    2457:	e8 47 1d 00 00       	call   41a3 <unlink>
+    245c:	83 c4 10             	add    $0x10,%esp
+    245f:	85 c0                	test   %eax,%eax
+    2461:	0f 85 24 03 00 00    	jne    278b <subdir+0x47b>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2467:	83 ec 08             	sub    $0x8,%esp
+    246a:	6a 00                	push   $0x0
+    246c:	68 86 4f 00 00       	push   $0x4f86
+    2471:	e8 1d 1d 00 00       	call   4193 <open>
+    2476:	83 c4 10             	add    $0x10,%esp
+    2479:	85 c0                	test   %eax,%eax
+    247b:	0f 89 96 04 00 00    	jns    2917 <subdir+0x607>
+  if(chdir("dd") != 0){
+    2481:	83 ec 0c             	sub    $0xc,%esp
+    2484:	68 50 50 00 00       	push   $0x5050
+    2489:	e8 35 1d 00 00       	call   41c3 <chdir>
+    248e:	83 c4 10             	add    $0x10,%esp
+    2491:	85 c0                	test   %eax,%eax
+    2493:	0f 85 64 04 00 00    	jne    28fd <subdir+0x5ed>
+  if(chdir("dd/../../dd") != 0){
+    2499:	83 ec 0c             	sub    $0xc,%esp
+    249c:	68 1e 50 00 00       	push   $0x501e
+    24a1:	e8 1d 1d 00 00       	call   41c3 <chdir>
+    24a6:	83 c4 10             	add    $0x10,%esp
+    24a9:	85 c0                	test   %eax,%eax
+    24ab:	0f 85 c0 02 00 00    	jne    2771 <subdir+0x461>
+  if(chdir("dd/../../../dd") != 0){
+    24b1:	83 ec 0c             	sub    $0xc,%esp
+    24b4:	68 44 50 00 00       	push   $0x5044
+    24b9:	e8 05 1d 00 00       	call   41c3 <chdir>
+    24be:	83 c4 10             	add    $0x10,%esp
+    24c1:	85 c0                	test   %eax,%eax
+    24c3:	0f 85 a8 02 00 00    	jne    2771 <subdir+0x461>
+  if(chdir("./..") != 0){
+    24c9:	83 ec 0c             	sub    $0xc,%esp
+    24cc:	68 53 50 00 00       	push   $0x5053
+    24d1:	e8 ed 1c 00 00       	call   41c3 <chdir>
+    24d6:	83 c4 10             	add    $0x10,%esp
+    24d9:	85 c0                	test   %eax,%eax
+    24db:	0f 85 58 03 00 00    	jne    2839 <subdir+0x529>
+  fd = open("dd/dd/ffff", 0);
+    24e1:	83 ec 08             	sub    $0x8,%esp
+    24e4:	6a 00                	push   $0x0
+    24e6:	68 ea 4f 00 00       	push   $0x4fea
+    24eb:	e8 a3 1c 00 00       	call   4193 <open>
+  if(fd < 0){
+    24f0:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    24f3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    24f5:	85 c0                	test   %eax,%eax
+    24f7:	0f 88 aa 05 00 00    	js     2aa7 <subdir+0x797>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    24fd:	83 ec 04             	sub    $0x4,%esp
+    2500:	68 00 20 00 00       	push   $0x2000
+    2505:	68 e0 90 00 00       	push   $0x90e0
+    250a:	50                   	push   %eax
+    250b:	e8 5b 1c 00 00       	call   416b <read>
+    2510:	83 c4 10             	add    $0x10,%esp
+    2513:	83 f8 02             	cmp    $0x2,%eax
+    2516:	0f 85 71 05 00 00    	jne    2a8d <subdir+0x77d>
+  close(fd);
+    251c:	83 ec 0c             	sub    $0xc,%esp
+    251f:	53                   	push   %ebx
+    2520:	e8 56 1c 00 00       	call   417b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2525:	58                   	pop    %eax
+    2526:	5a                   	pop    %edx
+    2527:	6a 00                	push   $0x0
+    2529:	68 86 4f 00 00       	push   $0x4f86
+    252e:	e8 60 1c 00 00       	call   4193 <open>
+    2533:	83 c4 10             	add    $0x10,%esp
+    2536:	85 c0                	test   %eax,%eax
+    2538:	0f 89 7f 02 00 00    	jns    27bd <subdir+0x4ad>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    253e:	83 ec 08             	sub    $0x8,%esp
+    2541:	68 02 02 00 00       	push   $0x202
+    2546:	68 9e 50 00 00       	push   $0x509e
+    254b:	e8 43 1c 00 00       	call   4193 <open>
+    2550:	83 c4 10             	add    $0x10,%esp
+    2553:	85 c0                	test   %eax,%eax
+    2555:	0f 89 4a 02 00 00    	jns    27a5 <subdir+0x495>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    255b:	83 ec 08             	sub    $0x8,%esp
+    255e:	68 02 02 00 00       	push   $0x202
+    2563:	68 c3 50 00 00       	push   $0x50c3
+    2568:	e8 26 1c 00 00       	call   4193 <open>
+    256d:	83 c4 10             	add    $0x10,%esp
+    2570:	85 c0                	test   %eax,%eax
+    2572:	0f 89 6d 03 00 00    	jns    28e5 <subdir+0x5d5>
+  if(open("dd", O_CREATE) >= 0){
+    2578:	83 ec 08             	sub    $0x8,%esp
+    257b:	68 00 02 00 00       	push   $0x200
+    2580:	68 50 50 00 00       	push   $0x5050
+    2585:	e8 09 1c 00 00       	call   4193 <open>
+    258a:	83 c4 10             	add    $0x10,%esp
+    258d:	85 c0                	test   %eax,%eax
+    258f:	0f 89 38 03 00 00    	jns    28cd <subdir+0x5bd>
+  if(open("dd", O_RDWR) >= 0){
+    2595:	83 ec 08             	sub    $0x8,%esp
+    2598:	6a 02                	push   $0x2
+    259a:	68 50 50 00 00       	push   $0x5050
+    259f:	e8 ef 1b 00 00       	call   4193 <open>
+    25a4:	83 c4 10             	add    $0x10,%esp
+    25a7:	85 c0                	test   %eax,%eax
+    25a9:	0f 89 06 03 00 00    	jns    28b5 <subdir+0x5a5>
+  if(open("dd", O_WRONLY) >= 0){
+    25af:	83 ec 08             	sub    $0x8,%esp
+    25b2:	6a 01                	push   $0x1
+    25b4:	68 50 50 00 00       	push   $0x5050
+    25b9:	e8 d5 1b 00 00       	call   4193 <open>
+    25be:	83 c4 10             	add    $0x10,%esp
+    25c1:	85 c0                	test   %eax,%eax
+    25c3:	0f 89 d4 02 00 00    	jns    289d <subdir+0x58d>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    25c9:	83 ec 08             	sub    $0x8,%esp
+    25cc:	68 32 51 00 00       	push   $0x5132
+    25d1:	68 9e 50 00 00       	push   $0x509e
+    25d6:	e8 d8 1b 00 00       	call   41b3 <link>
+    25db:	83 c4 10             	add    $0x10,%esp
+    25de:	85 c0                	test   %eax,%eax
+    25e0:	0f 84 9f 02 00 00    	je     2885 <subdir+0x575>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    25e6:	83 ec 08             	sub    $0x8,%esp
+    25e9:	68 32 51 00 00       	push   $0x5132
+    25ee:	68 c3 50 00 00       	push   $0x50c3
+    25f3:	e8 bb 1b 00 00       	call   41b3 <link>
+    25f8:	83 c4 10             	add    $0x10,%esp
+    25fb:	85 c0                	test   %eax,%eax
+    25fd:	0f 84 6a 02 00 00    	je     286d <subdir+0x55d>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2603:	83 ec 08             	sub    $0x8,%esp
+    2606:	68 ea 4f 00 00       	push   $0x4fea
+    260b:	68 89 4f 00 00       	push   $0x4f89
+    2610:	e8 9e 1b 00 00       	call   41b3 <link>
+    2615:	83 c4 10             	add    $0x10,%esp
+    2618:	85 c0                	test   %eax,%eax
+    261a:	0f 84 cd 01 00 00    	je     27ed <subdir+0x4dd>
+  if(mkdir("dd/ff/ff") == 0){
+    2620:	83 ec 0c             	sub    $0xc,%esp
+    2623:	68 9e 50 00 00       	push   $0x509e
+    2628:	e8 8e 1b 00 00       	call   41bb <mkdir>
+    262d:	83 c4 10             	add    $0x10,%esp
+    2630:	85 c0                	test   %eax,%eax
+    2632:	0f 84 9d 01 00 00    	je     27d5 <subdir+0x4c5>
+  if(mkdir("dd/xx/ff") == 0){
+    2638:	83 ec 0c             	sub    $0xc,%esp
+    263b:	68 c3 50 00 00       	push   $0x50c3
+    2640:	e8 76 1b 00 00       	call   41bb <mkdir>
+    2645:	83 c4 10             	add    $0x10,%esp
+    2648:	85 c0                	test   %eax,%eax
+    264a:	0f 84 25 04 00 00    	je     2a75 <subdir+0x765>
+  if(mkdir("dd/dd/ffff") == 0){
+    2650:	83 ec 0c             	sub    $0xc,%esp
+    2653:	68 ea 4f 00 00       	push   $0x4fea
+    2658:	e8 5e 1b 00 00       	call   41bb <mkdir>
+    265d:	83 c4 10             	add    $0x10,%esp
+    2660:	85 c0                	test   %eax,%eax
+    2662:	0f 84 f5 03 00 00    	je     2a5d <subdir+0x74d>
+  if(unlink("dd/xx/ff") == 0){
+    2668:	83 ec 0c             	sub    $0xc,%esp
+    266b:	68 c3 50 00 00       	push   $0x50c3
+    2670:	e8 2e 1b 00 00       	call   41a3 <unlink>
+    2675:	83 c4 10             	add    $0x10,%esp
+    2678:	85 c0                	test   %eax,%eax
+    267a:	0f 84 c5 03 00 00    	je     2a45 <subdir+0x735>
+  if(unlink("dd/ff/ff") == 0){
+    2680:	83 ec 0c             	sub    $0xc,%esp
+    2683:	68 9e 50 00 00       	push   $0x509e
+    2688:	e8 16 1b 00 00       	call   41a3 <unlink>
+    268d:	83 c4 10             	add    $0x10,%esp
+    2690:	85 c0                	test   %eax,%eax
+    2692:	0f 84 95 03 00 00    	je     2a2d <subdir+0x71d>
+  if(chdir("dd/ff") == 0){
+    2698:	83 ec 0c             	sub    $0xc,%esp
+    269b:	68 89 4f 00 00       	push   $0x4f89
+    26a0:	e8 1e 1b 00 00       	call   41c3 <chdir>
+    26a5:	83 c4 10             	add    $0x10,%esp
+    26a8:	85 c0                	test   %eax,%eax
+    26aa:	0f 84 65 03 00 00    	je     2a15 <subdir+0x705>
+  if(chdir("dd/xx") == 0){
+    26b0:	83 ec 0c             	sub    $0xc,%esp
+    26b3:	68 35 51 00 00       	push   $0x5135
+    26b8:	e8 06 1b 00 00       	call   41c3 <chdir>
+    26bd:	83 c4 10             	add    $0x10,%esp
+    26c0:	85 c0                	test   %eax,%eax
+    26c2:	0f 84 35 03 00 00    	je     29fd <subdir+0x6ed>
+  if(unlink("dd/dd/ffff") != 0){
+    26c8:	83 ec 0c             	sub    $0xc,%esp
+    26cb:	68 ea 4f 00 00       	push   $0x4fea
+    26d0:	e8 ce 1a 00 00       	call   41a3 <unlink>
+    26d5:	83 c4 10             	add    $0x10,%esp
+    26d8:	85 c0                	test   %eax,%eax
+    26da:	0f 85 ab 00 00 00    	jne    278b <subdir+0x47b>
+  if(unlink("dd/ff") != 0){
+    26e0:	83 ec 0c             	sub    $0xc,%esp
+    26e3:	68 89 4f 00 00       	push   $0x4f89
+    26e8:	e8 b6 1a 00 00       	call   41a3 <unlink>
+    26ed:	83 c4 10             	add    $0x10,%esp
+    26f0:	85 c0                	test   %eax,%eax
+    26f2:	0f 85 eb 02 00 00    	jne    29e3 <subdir+0x6d3>
+  if(unlink("dd") == 0){
+    26f8:	83 ec 0c             	sub    $0xc,%esp
+    26fb:	68 50 50 00 00       	push   $0x5050
+    2700:	e8 9e 1a 00 00       	call   41a3 <unlink>
+    2705:	83 c4 10             	add    $0x10,%esp
+    2708:	85 c0                	test   %eax,%eax
+    270a:	0f 84 bb 02 00 00    	je     29cb <subdir+0x6bb>
+  if(unlink("dd/dd") < 0){
+    2710:	83 ec 0c             	sub    $0xc,%esp
+    2713:	68 65 4f 00 00       	push   $0x4f65
+    2718:	e8 86 1a 00 00       	call   41a3 <unlink>
+    271d:	83 c4 10             	add    $0x10,%esp
+    2720:	85 c0                	test   %eax,%eax
+    2722:	0f 88 8b 02 00 00    	js     29b3 <subdir+0x6a3>
+  if(unlink("dd") < 0){
+    2728:	83 ec 0c             	sub    $0xc,%esp
+    272b:	68 50 50 00 00       	push   $0x5050
+    2730:	e8 6e 1a 00 00       	call   41a3 <unlink>
+    2735:	83 c4 10             	add    $0x10,%esp
+    2738:	85 c0                	test   %eax,%eax
+    273a:	0f 88 59 02 00 00    	js     2999 <subdir+0x689>
+  printf(1, "subdir ok\n");
+    2740:	83 ec 08             	sub    $0x8,%esp
+    2743:	68 32 52 00 00       	push   $0x5232
+    2748:	6a 01                	push   $0x1
+    274a:	e8 e1 1b 00 00       	call   4330 <printf>
+}
+    274f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2752:	83 c4 10             	add    $0x10,%esp
+    2755:	c9                   	leave
+    2756:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2757:	50                   	push   %eax
+    2758:	50                   	push   %eax
+    2759:	68 cf 4f 00 00       	push   $0x4fcf
+    275e:	6a 01                	push   $0x1
+    2760:	e8 cb 1b 00 00       	call   4330 <printf>
+    exit(1);
+    2765:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    276c:	e8 e2 19 00 00       	call   4153 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    2771:	50                   	push   %eax
+    2772:	50                   	push   %eax
+    2773:	68 2a 50 00 00       	push   $0x502a
+    2778:	6a 01                	push   $0x1
+    277a:	e8 b1 1b 00 00       	call   4330 <printf>
+    exit(1);
+    277f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2786:	e8 c8 19 00 00       	call   4153 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    278b:	50                   	push   %eax
+    278c:	50                   	push   %eax
+    278d:	68 f5 4f 00 00       	push   $0x4ff5
+    2792:	6a 01                	push   $0x1
+    2794:	e8 97 1b 00 00       	call   4330 <printf>
+    exit(1);
+    2799:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    27a0:	e8 ae 19 00 00       	call   4153 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    27a5:	51                   	push   %ecx
+    exit(0);
+    27a6:	31 db                	xor    %ebx,%ebx
+    printf(1, "create dd/ff/ff succeeded!\n");
+    27a8:	51                   	push   %ecx
+    27a9:	68 a7 50 00 00       	push   $0x50a7
+    27ae:	6a 01                	push   $0x1
+    27b0:	e8 7b 1b 00 00       	call   4330 <printf>
+    exit(0);
+    27b5:	89 1c 24             	mov    %ebx,(%esp)
+    27b8:	e8 96 19 00 00       	call   4153 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    27bd:	50                   	push   %eax
+    27be:	50                   	push   %eax
+    27bf:	68 e0 5a 00 00       	push   $0x5ae0
+    27c4:	6a 01                	push   $0x1
+    27c6:	e8 65 1b 00 00       	call   4330 <printf>
+    exit(0);
+    27cb:	31 c0                	xor    %eax,%eax
+    27cd:	89 04 24             	mov    %eax,(%esp)
+    27d0:	e8 7e 19 00 00       	call   4153 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    27d5:	51                   	push   %ecx
+    exit(0);
+    27d6:	31 db                	xor    %ebx,%ebx
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    27d8:	51                   	push   %ecx
+    27d9:	68 3b 51 00 00       	push   $0x513b
+    27de:	6a 01                	push   $0x1
+    27e0:	e8 4b 1b 00 00       	call   4330 <printf>
+    exit(0);
+    27e5:	89 1c 24             	mov    %ebx,(%esp)
+    27e8:	e8 66 19 00 00       	call   4153 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    27ed:	50                   	push   %eax
+    27ee:	50                   	push   %eax
+    27ef:	68 50 5b 00 00       	push   $0x5b50
+    27f4:	6a 01                	push   $0x1
+    27f6:	e8 35 1b 00 00       	call   4330 <printf>
+    exit(0);
+    27fb:	31 c0                	xor    %eax,%eax
+    27fd:	89 04 24             	mov    %eax,(%esp)
+    2800:	e8 4e 19 00 00       	call   4153 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    2805:	50                   	push   %eax
+    2806:	50                   	push   %eax
+    2807:	68 b6 4f 00 00       	push   $0x4fb6
+    280c:	6a 01                	push   $0x1
+    280e:	e8 1d 1b 00 00       	call   4330 <printf>
+    exit(1);
+    2813:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    281a:	e8 34 19 00 00       	call   4153 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    281f:	51                   	push   %ecx
+    2820:	51                   	push   %ecx
+    2821:	68 8f 4f 00 00       	push   $0x4f8f
+    2826:	6a 01                	push   $0x1
+    2828:	e8 03 1b 00 00       	call   4330 <printf>
+    exit(1);
+    282d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2834:	e8 1a 19 00 00       	call   4153 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2839:	50                   	push   %eax
+    283a:	50                   	push   %eax
+    283b:	68 58 50 00 00       	push   $0x5058
+    2840:	6a 01                	push   $0x1
+    2842:	e8 e9 1a 00 00       	call   4330 <printf>
+    exit(1);
+    2847:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    284e:	e8 00 19 00 00       	call   4153 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2853:	52                   	push   %edx
+    2854:	52                   	push   %edx
+    2855:	68 98 5a 00 00       	push   $0x5a98
+    285a:	6a 01                	push   $0x1
+    285c:	e8 cf 1a 00 00       	call   4330 <printf>
+    exit(1);
+    2861:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2868:	e8 e6 18 00 00       	call   4153 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    286d:	50                   	push   %eax
+    286e:	50                   	push   %eax
+    286f:	68 2c 5b 00 00       	push   $0x5b2c
+    2874:	6a 01                	push   $0x1
+    2876:	e8 b5 1a 00 00       	call   4330 <printf>
+    exit(0);
+    287b:	31 c0                	xor    %eax,%eax
+    287d:	89 04 24             	mov    %eax,(%esp)
+    2880:	e8 ce 18 00 00       	call   4153 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    2885:	50                   	push   %eax
+    2886:	50                   	push   %eax
+    2887:	68 08 5b 00 00       	push   $0x5b08
+    288c:	6a 01                	push   $0x1
+    288e:	e8 9d 1a 00 00       	call   4330 <printf>
+    exit(0);
+    2893:	31 d2                	xor    %edx,%edx
+    2895:	89 14 24             	mov    %edx,(%esp)
+    2898:	e8 b6 18 00 00       	call   4153 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    289d:	51                   	push   %ecx
+    exit(0);
+    289e:	31 db                	xor    %ebx,%ebx
+    printf(1, "open dd wronly succeeded!\n");
+    28a0:	51                   	push   %ecx
+    28a1:	68 17 51 00 00       	push   $0x5117
+    28a6:	6a 01                	push   $0x1
+    28a8:	e8 83 1a 00 00       	call   4330 <printf>
+    exit(0);
+    28ad:	89 1c 24             	mov    %ebx,(%esp)
+    28b0:	e8 9e 18 00 00       	call   4153 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    28b5:	50                   	push   %eax
+    28b6:	50                   	push   %eax
+    28b7:	68 fe 50 00 00       	push   $0x50fe
+    28bc:	6a 01                	push   $0x1
+    28be:	e8 6d 1a 00 00       	call   4330 <printf>
+    exit(0);
+    28c3:	31 c0                	xor    %eax,%eax
+    28c5:	89 04 24             	mov    %eax,(%esp)
+    28c8:	e8 86 18 00 00       	call   4153 <exit>
+    printf(1, "create dd succeeded!\n");
+    28cd:	50                   	push   %eax
+    28ce:	50                   	push   %eax
+    28cf:	68 e8 50 00 00       	push   $0x50e8
+    28d4:	6a 01                	push   $0x1
+    28d6:	e8 55 1a 00 00       	call   4330 <printf>
+    exit(0);
+    28db:	31 c0                	xor    %eax,%eax
+    28dd:	89 04 24             	mov    %eax,(%esp)
+    28e0:	e8 6e 18 00 00       	call   4153 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    28e5:	50                   	push   %eax
+    28e6:	50                   	push   %eax
+    28e7:	68 cc 50 00 00       	push   $0x50cc
+    28ec:	6a 01                	push   $0x1
+    28ee:	e8 3d 1a 00 00       	call   4330 <printf>
+    exit(0);
+    28f3:	31 d2                	xor    %edx,%edx
+    28f5:	89 14 24             	mov    %edx,(%esp)
+    28f8:	e8 56 18 00 00       	call   4153 <exit>
+    printf(1, "chdir dd failed\n");
+    28fd:	50                   	push   %eax
+    28fe:	50                   	push   %eax
+    28ff:	68 0d 50 00 00       	push   $0x500d
+    2904:	6a 01                	push   $0x1
+    2906:	e8 25 1a 00 00       	call   4330 <printf>
+    exit(1);
+    290b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2912:	e8 3c 18 00 00       	call   4153 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    2917:	50                   	push   %eax
+    2918:	50                   	push   %eax
+    2919:	68 bc 5a 00 00       	push   $0x5abc
+    291e:	6a 01                	push   $0x1
+    2920:	e8 0b 1a 00 00       	call   4330 <printf>
+    exit(1);
+    2925:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    292c:	e8 22 18 00 00       	call   4153 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2931:	53                   	push   %ebx
+    2932:	53                   	push   %ebx
+    2933:	68 6b 4f 00 00       	push   $0x4f6b
+    2938:	6a 01                	push   $0x1
+    293a:	e8 f1 19 00 00       	call   4330 <printf>
+    exit(1);
+    293f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2946:	e8 08 18 00 00       	call   4153 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    294b:	50                   	push   %eax
+    294c:	50                   	push   %eax
+    294d:	68 70 5a 00 00       	push   $0x5a70
+    2952:	6a 01                	push   $0x1
+    2954:	e8 d7 19 00 00       	call   4330 <printf>
+    exit(1);
+    2959:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2960:	e8 ee 17 00 00       	call   4153 <exit>
+    printf(1, "create dd/ff failed\n");
+    2965:	50                   	push   %eax
+    2966:	50                   	push   %eax
+    2967:	68 4f 4f 00 00       	push   $0x4f4f
+    296c:	6a 01                	push   $0x1
+    296e:	e8 bd 19 00 00       	call   4330 <printf>
+    exit(1);
+    2973:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    297a:	e8 d4 17 00 00       	call   4153 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    297f:	50                   	push   %eax
+    2980:	50                   	push   %eax
+    2981:	68 37 4f 00 00       	push   $0x4f37
+    2986:	6a 01                	push   $0x1
+    2988:	e8 a3 19 00 00       	call   4330 <printf>
+    exit(1);
+    298d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2994:	e8 ba 17 00 00       	call   4153 <exit>
+    printf(1, "unlink dd failed\n");
+    2999:	50                   	push   %eax
+    299a:	50                   	push   %eax
+    299b:	68 20 52 00 00       	push   $0x5220
+    29a0:	6a 01                	push   $0x1
+    29a2:	e8 89 19 00 00       	call   4330 <printf>
+    exit(1);
+    29a7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    29ae:	e8 a0 17 00 00       	call   4153 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    29b3:	52                   	push   %edx
+    29b4:	52                   	push   %edx
+    29b5:	68 0b 52 00 00       	push   $0x520b
+    29ba:	6a 01                	push   $0x1
+    29bc:	e8 6f 19 00 00       	call   4330 <printf>
+    exit(0);
+    29c1:	31 c9                	xor    %ecx,%ecx
+    29c3:	89 0c 24             	mov    %ecx,(%esp)
+    29c6:	e8 88 17 00 00       	call   4153 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    29cb:	53                   	push   %ebx
+    29cc:	53                   	push   %ebx
+    29cd:	68 74 5b 00 00       	push   $0x5b74
+    29d2:	6a 01                	push   $0x1
+    29d4:	e8 57 19 00 00       	call   4330 <printf>
+    exit(0);
+    29d9:	31 c0                	xor    %eax,%eax
+    29db:	89 04 24             	mov    %eax,(%esp)
+    29de:	e8 70 17 00 00       	call   4153 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    29e3:	50                   	push   %eax
+    29e4:	50                   	push   %eax
+    29e5:	68 f6 51 00 00       	push   $0x51f6
+    29ea:	6a 01                	push   $0x1
+    29ec:	e8 3f 19 00 00       	call   4330 <printf>
+    exit(1);
+    29f1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    29f8:	e8 56 17 00 00       	call   4153 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    29fd:	50                   	push   %eax
+    29fe:	50                   	push   %eax
+    29ff:	68 de 51 00 00       	push   $0x51de
+    2a04:	6a 01                	push   $0x1
+    2a06:	e8 25 19 00 00       	call   4330 <printf>
+    exit(0);
+    2a0b:	31 c0                	xor    %eax,%eax
+    2a0d:	89 04 24             	mov    %eax,(%esp)
+    2a10:	e8 3e 17 00 00       	call   4153 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    2a15:	50                   	push   %eax
+    2a16:	50                   	push   %eax
+    2a17:	68 c6 51 00 00       	push   $0x51c6
+    2a1c:	6a 01                	push   $0x1
+    2a1e:	e8 0d 19 00 00       	call   4330 <printf>
+    exit(0);
+    2a23:	31 d2                	xor    %edx,%edx
+    2a25:	89 14 24             	mov    %edx,(%esp)
+    2a28:	e8 26 17 00 00       	call   4153 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2a2d:	51                   	push   %ecx
+    exit(0);
+    2a2e:	31 db                	xor    %ebx,%ebx
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2a30:	51                   	push   %ecx
+    2a31:	68 aa 51 00 00       	push   $0x51aa
+    2a36:	6a 01                	push   $0x1
+    2a38:	e8 f3 18 00 00       	call   4330 <printf>
+    exit(0);
+    2a3d:	89 1c 24             	mov    %ebx,(%esp)
+    2a40:	e8 0e 17 00 00       	call   4153 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2a45:	50                   	push   %eax
+    2a46:	50                   	push   %eax
+    2a47:	68 8e 51 00 00       	push   $0x518e
+    2a4c:	6a 01                	push   $0x1
+    2a4e:	e8 dd 18 00 00       	call   4330 <printf>
+    exit(0);
+    2a53:	31 c0                	xor    %eax,%eax
+    2a55:	89 04 24             	mov    %eax,(%esp)
+    2a58:	e8 f6 16 00 00       	call   4153 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2a5d:	50                   	push   %eax
+    2a5e:	50                   	push   %eax
+    2a5f:	68 71 51 00 00       	push   $0x5171
+    2a64:	6a 01                	push   $0x1
+    2a66:	e8 c5 18 00 00       	call   4330 <printf>
+    exit(0);
+    2a6b:	31 c0                	xor    %eax,%eax
+    2a6d:	89 04 24             	mov    %eax,(%esp)
+    2a70:	e8 de 16 00 00       	call   4153 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2a75:	50                   	push   %eax
+    2a76:	50                   	push   %eax
+    2a77:	68 56 51 00 00       	push   $0x5156
+    2a7c:	6a 01                	push   $0x1
+    2a7e:	e8 ad 18 00 00       	call   4330 <printf>
+    exit(0);
+    2a83:	31 d2                	xor    %edx,%edx
+    2a85:	89 14 24             	mov    %edx,(%esp)
+    2a88:	e8 c6 16 00 00       	call   4153 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    2a8d:	51                   	push   %ecx
+    2a8e:	51                   	push   %ecx
+    2a8f:	68 83 50 00 00       	push   $0x5083
+    2a94:	6a 01                	push   $0x1
+    2a96:	e8 95 18 00 00       	call   4330 <printf>
+    exit(1);
+    2a9b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2aa2:	e8 ac 16 00 00       	call   4153 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    2aa7:	53                   	push   %ebx
+    2aa8:	53                   	push   %ebx
+    2aa9:	68 6b 50 00 00       	push   $0x506b
+    2aae:	6a 01                	push   $0x1
+    2ab0:	e8 7b 18 00 00       	call   4330 <printf>
+    exit(1);
+    2ab5:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2abc:	e8 92 16 00 00       	call   4153 <exit>
+    2ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2acf:	90                   	nop
+
+00002ad0 <bigwrite>:
+{
+    2ad0:	55                   	push   %ebp
+    2ad1:	89 e5                	mov    %esp,%ebp
+    2ad3:	56                   	push   %esi
+    2ad4:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2ad5:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    2ada:	83 ec 08             	sub    $0x8,%esp
+    2add:	68 3d 52 00 00       	push   $0x523d
+    2ae2:	6a 01                	push   $0x1
+    2ae4:	e8 47 18 00 00       	call   4330 <printf>
+  unlink("bigwrite");
+    2ae9:	c7 04 24 4c 52 00 00 	movl   $0x524c,(%esp)
+    2af0:	e8 ae 16 00 00       	call   41a3 <unlink>
+    2af5:	83 c4 10             	add    $0x10,%esp
+    2af8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2aff:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2b00:	83 ec 08             	sub    $0x8,%esp
+    2b03:	68 02 02 00 00       	push   $0x202
+    2b08:	68 4c 52 00 00       	push   $0x524c
+    2b0d:	e8 81 16 00 00       	call   4193 <open>
+    if(fd < 0){
+    2b12:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2b15:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2b17:	85 c0                	test   %eax,%eax
+    2b19:	0f 88 85 00 00 00    	js     2ba4 <bigwrite+0xd4>
+      int cc = write(fd, buf, sz);
+    2b1f:	83 ec 04             	sub    $0x4,%esp
+    2b22:	53                   	push   %ebx
+    2b23:	68 e0 90 00 00       	push   $0x90e0
+    2b28:	50                   	push   %eax
+    2b29:	e8 45 16 00 00       	call   4173 <write>
+      if(cc != sz){
+    2b2e:	83 c4 10             	add    $0x10,%esp
+    2b31:	39 d8                	cmp    %ebx,%eax
+    2b33:	75 55                	jne    2b8a <bigwrite+0xba>
+      int cc = write(fd, buf, sz);
+    2b35:	83 ec 04             	sub    $0x4,%esp
+    2b38:	53                   	push   %ebx
+    2b39:	68 e0 90 00 00       	push   $0x90e0
+    2b3e:	56                   	push   %esi
+    2b3f:	e8 2f 16 00 00       	call   4173 <write>
+      if(cc != sz){
+    2b44:	83 c4 10             	add    $0x10,%esp
+    2b47:	39 c3                	cmp    %eax,%ebx
+    2b49:	75 3f                	jne    2b8a <bigwrite+0xba>
+    close(fd);
+    2b4b:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    2b4e:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2b54:	56                   	push   %esi
+    2b55:	e8 21 16 00 00       	call   417b <close>
+    unlink("bigwrite");
+    2b5a:	c7 04 24 4c 52 00 00 	movl   $0x524c,(%esp)
+    2b61:	e8 3d 16 00 00       	call   41a3 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2b66:	83 c4 10             	add    $0x10,%esp
+    2b69:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    2b6f:	75 8f                	jne    2b00 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    2b71:	83 ec 08             	sub    $0x8,%esp
+    2b74:	68 7f 52 00 00       	push   $0x527f
+    2b79:	6a 01                	push   $0x1
+    2b7b:	e8 b0 17 00 00       	call   4330 <printf>
+}
+    2b80:	83 c4 10             	add    $0x10,%esp
+    2b83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2b86:	5b                   	pop    %ebx
+    2b87:	5e                   	pop    %esi
+    2b88:	5d                   	pop    %ebp
+    2b89:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2b8a:	50                   	push   %eax
+    2b8b:	53                   	push   %ebx
+    2b8c:	68 6d 52 00 00       	push   $0x526d
+    2b91:	6a 01                	push   $0x1
+    2b93:	e8 98 17 00 00       	call   4330 <printf>
+        exit(0);
+    2b98:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2b9f:	e8 af 15 00 00       	call   4153 <exit>
+      printf(1, "cannot create bigwrite\n");
+    2ba4:	83 ec 08             	sub    $0x8,%esp
+    2ba7:	68 55 52 00 00       	push   $0x5255
+    2bac:	6a 01                	push   $0x1
+    2bae:	e8 7d 17 00 00       	call   4330 <printf>
+      exit(1);
+    2bb3:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2bba:	e8 94 15 00 00       	call   4153 <exit>
+    2bbf:	90                   	nop
+
+00002bc0 <bigfile>:
+{
+    2bc0:	55                   	push   %ebp
+    2bc1:	89 e5                	mov    %esp,%ebp
+    2bc3:	57                   	push   %edi
+    2bc4:	56                   	push   %esi
+    2bc5:	53                   	push   %ebx
+    2bc6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    2bc9:	68 8c 52 00 00       	push   $0x528c
+    2bce:	6a 01                	push   $0x1
+    2bd0:	e8 5b 17 00 00       	call   4330 <printf>
+  unlink("bigfile");
+    2bd5:	c7 04 24 a8 52 00 00 	movl   $0x52a8,(%esp)
+    2bdc:	e8 c2 15 00 00       	call   41a3 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2be1:	58                   	pop    %eax
+    2be2:	5a                   	pop    %edx
+    2be3:	68 02 02 00 00       	push   $0x202
+    2be8:	68 a8 52 00 00       	push   $0x52a8
+    2bed:	e8 a1 15 00 00       	call   4193 <open>
+  if(fd < 0){
+    2bf2:	83 c4 10             	add    $0x10,%esp
+    2bf5:	85 c0                	test   %eax,%eax
+    2bf7:	0f 88 81 01 00 00    	js     2d7e <bigfile+0x1be>
+    2bfd:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    2bff:	31 db                	xor    %ebx,%ebx
+    2c01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2c08:	83 ec 04             	sub    $0x4,%esp
+    2c0b:	68 58 02 00 00       	push   $0x258
+    2c10:	53                   	push   %ebx
+    2c11:	68 e0 90 00 00       	push   $0x90e0
+    2c16:	e8 b5 13 00 00       	call   3fd0 <memset>
+    if(write(fd, buf, 600) != 600){
+    2c1b:	83 c4 0c             	add    $0xc,%esp
+    2c1e:	68 58 02 00 00       	push   $0x258
+    2c23:	68 e0 90 00 00       	push   $0x90e0
+    2c28:	56                   	push   %esi
+    2c29:	e8 45 15 00 00       	call   4173 <write>
+    2c2e:	83 c4 10             	add    $0x10,%esp
+    2c31:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2c36:	0f 85 0d 01 00 00    	jne    2d49 <bigfile+0x189>
+  for(i = 0; i < 20; i++){
+    2c3c:	83 c3 01             	add    $0x1,%ebx
+    2c3f:	83 fb 14             	cmp    $0x14,%ebx
+    2c42:	75 c4                	jne    2c08 <bigfile+0x48>
+  close(fd);
+    2c44:	83 ec 0c             	sub    $0xc,%esp
+    2c47:	56                   	push   %esi
+    2c48:	e8 2e 15 00 00       	call   417b <close>
+  fd = open("bigfile", 0);
+    2c4d:	5e                   	pop    %esi
+    2c4e:	5f                   	pop    %edi
+    2c4f:	6a 00                	push   $0x0
+    2c51:	68 a8 52 00 00       	push   $0x52a8
+    2c56:	e8 38 15 00 00       	call   4193 <open>
+  if(fd < 0){
+    2c5b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    2c5e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2c60:	85 c0                	test   %eax,%eax
+    2c62:	0f 88 fc 00 00 00    	js     2d64 <bigfile+0x1a4>
+  total = 0;
+    2c68:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    2c6a:	31 ff                	xor    %edi,%edi
+    2c6c:	eb 30                	jmp    2c9e <bigfile+0xde>
+    2c6e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2c70:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2c75:	0f 85 98 00 00 00    	jne    2d13 <bigfile+0x153>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    2c7b:	89 fa                	mov    %edi,%edx
+    2c7d:	0f be 05 e0 90 00 00 	movsbl 0x90e0,%eax
+    2c84:	d1 fa                	sar    %edx
+    2c86:	39 d0                	cmp    %edx,%eax
+    2c88:	75 6e                	jne    2cf8 <bigfile+0x138>
+    2c8a:	0f be 15 0b 92 00 00 	movsbl 0x920b,%edx
+    2c91:	39 d0                	cmp    %edx,%eax
+    2c93:	75 63                	jne    2cf8 <bigfile+0x138>
+    total += cc;
+    2c95:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    2c9b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    2c9e:	83 ec 04             	sub    $0x4,%esp
+    2ca1:	68 2c 01 00 00       	push   $0x12c
+    2ca6:	68 e0 90 00 00       	push   $0x90e0
+    2cab:	56                   	push   %esi
+    2cac:	e8 ba 14 00 00       	call   416b <read>
+    if(cc < 0){
+    2cb1:	83 c4 10             	add    $0x10,%esp
+    2cb4:	85 c0                	test   %eax,%eax
+    2cb6:	78 76                	js     2d2e <bigfile+0x16e>
+    if(cc == 0)
+    2cb8:	75 b6                	jne    2c70 <bigfile+0xb0>
+  close(fd);
+    2cba:	83 ec 0c             	sub    $0xc,%esp
+    2cbd:	56                   	push   %esi
+    2cbe:	e8 b8 14 00 00       	call   417b <close>
+  if(total != 20*600){
+    2cc3:	83 c4 10             	add    $0x10,%esp
+    2cc6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    2ccc:	0f 85 c6 00 00 00    	jne    2d98 <bigfile+0x1d8>
+  unlink("bigfile");
+    2cd2:	83 ec 0c             	sub    $0xc,%esp
+    2cd5:	68 a8 52 00 00       	push   $0x52a8
+    2cda:	e8 c4 14 00 00       	call   41a3 <unlink>
+  printf(1, "bigfile test ok\n");
+    2cdf:	58                   	pop    %eax
+    2ce0:	5a                   	pop    %edx
+    2ce1:	68 37 53 00 00       	push   $0x5337
+    2ce6:	6a 01                	push   $0x1
+    2ce8:	e8 43 16 00 00       	call   4330 <printf>
+}
+    2ced:	83 c4 10             	add    $0x10,%esp
+    2cf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2cf3:	5b                   	pop    %ebx
+    2cf4:	5e                   	pop    %esi
+    2cf5:	5f                   	pop    %edi
+    2cf6:	5d                   	pop    %ebp
+    2cf7:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2cf8:	83 ec 08             	sub    $0x8,%esp
+    2cfb:	68 04 53 00 00       	push   $0x5304
+    2d00:	6a 01                	push   $0x1
+    2d02:	e8 29 16 00 00       	call   4330 <printf>
+      exit(1);
+    2d07:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2d0e:	e8 40 14 00 00       	call   4153 <exit>
+      printf(1, "short read bigfile\n");
+    2d13:	83 ec 08             	sub    $0x8,%esp
+    2d16:	68 f0 52 00 00       	push   $0x52f0
+    2d1b:	6a 01                	push   $0x1
+    2d1d:	e8 0e 16 00 00       	call   4330 <printf>
+      exit(1);
+    2d22:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2d29:	e8 25 14 00 00       	call   4153 <exit>
+      printf(1, "read bigfile failed\n");
+    2d2e:	83 ec 08             	sub    $0x8,%esp
+    2d31:	68 db 52 00 00       	push   $0x52db
+    2d36:	6a 01                	push   $0x1
+    2d38:	e8 f3 15 00 00       	call   4330 <printf>
+      exit(1);
+    2d3d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2d44:	e8 0a 14 00 00       	call   4153 <exit>
+      printf(1, "write bigfile failed\n");
+    2d49:	83 ec 08             	sub    $0x8,%esp
+    2d4c:	68 b0 52 00 00       	push   $0x52b0
+    2d51:	6a 01                	push   $0x1
+    2d53:	e8 d8 15 00 00       	call   4330 <printf>
+      exit(1);
+    2d58:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2d5f:	e8 ef 13 00 00       	call   4153 <exit>
+    printf(1, "cannot open bigfile\n");
+    2d64:	53                   	push   %ebx
+    2d65:	53                   	push   %ebx
+    2d66:	68 c6 52 00 00       	push   $0x52c6
+    2d6b:	6a 01                	push   $0x1
+    2d6d:	e8 be 15 00 00       	call   4330 <printf>
+    exit(1);
+    2d72:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2d79:	e8 d5 13 00 00       	call   4153 <exit>
+    printf(1, "cannot create bigfile");
+    2d7e:	50                   	push   %eax
+    2d7f:	50                   	push   %eax
+    2d80:	68 9a 52 00 00       	push   $0x529a
+    2d85:	6a 01                	push   $0x1
+    2d87:	e8 a4 15 00 00       	call   4330 <printf>
+    exit(1);
+    2d8c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2d93:	e8 bb 13 00 00       	call   4153 <exit>
+    printf(1, "read bigfile wrong total\n");
+    2d98:	51                   	push   %ecx
+    2d99:	51                   	push   %ecx
+    2d9a:	68 1d 53 00 00       	push   $0x531d
+    2d9f:	6a 01                	push   $0x1
+    2da1:	e8 8a 15 00 00       	call   4330 <printf>
+    exit(1);
+    2da6:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2dad:	e8 a1 13 00 00       	call   4153 <exit>
+    2db2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002dc0 <fourteen>:
+{
+    2dc0:	55                   	push   %ebp
+    2dc1:	89 e5                	mov    %esp,%ebp
+    2dc3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    2dc6:	68 48 53 00 00       	push   $0x5348
+    2dcb:	6a 01                	push   $0x1
+    2dcd:	e8 5e 15 00 00       	call   4330 <printf>
+  if(mkdir("12345678901234") != 0){
+    2dd2:	c7 04 24 83 53 00 00 	movl   $0x5383,(%esp)
+    2dd9:	e8 dd 13 00 00       	call   41bb <mkdir>
+    2dde:	83 c4 10             	add    $0x10,%esp
+    2de1:	85 c0                	test   %eax,%eax
+    2de3:	0f 85 9b 00 00 00    	jne    2e84 <fourteen+0xc4>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2de9:	83 ec 0c             	sub    $0xc,%esp
+    2dec:	68 94 5b 00 00       	push   $0x5b94
+    2df1:	e8 c5 13 00 00       	call   41bb <mkdir>
+    2df6:	83 c4 10             	add    $0x10,%esp
+    2df9:	85 c0                	test   %eax,%eax
+    2dfb:	0f 85 01 01 00 00    	jne    2f02 <fourteen+0x142>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2e01:	83 ec 08             	sub    $0x8,%esp
+    2e04:	68 00 02 00 00       	push   $0x200
+    2e09:	68 e4 5b 00 00       	push   $0x5be4
+    2e0e:	e8 80 13 00 00       	call   4193 <open>
+  if(fd < 0){
+    2e13:	83 c4 10             	add    $0x10,%esp
+    2e16:	85 c0                	test   %eax,%eax
+    2e18:	0f 88 ca 00 00 00    	js     2ee8 <fourteen+0x128>
+  close(fd);
+    2e1e:	83 ec 0c             	sub    $0xc,%esp
+    2e21:	50                   	push   %eax
+    2e22:	e8 54 13 00 00       	call   417b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2e27:	58                   	pop    %eax
+    2e28:	5a                   	pop    %edx
+    2e29:	6a 00                	push   $0x0
+    2e2b:	68 54 5c 00 00       	push   $0x5c54
+    2e30:	e8 5e 13 00 00       	call   4193 <open>
+  if(fd < 0){
+    2e35:	83 c4 10             	add    $0x10,%esp
+    2e38:	85 c0                	test   %eax,%eax
+    2e3a:	0f 88 8e 00 00 00    	js     2ece <fourteen+0x10e>
+  close(fd);
+    2e40:	83 ec 0c             	sub    $0xc,%esp
+    2e43:	50                   	push   %eax
+    2e44:	e8 32 13 00 00       	call   417b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2e49:	c7 04 24 74 53 00 00 	movl   $0x5374,(%esp)
+    2e50:	e8 66 13 00 00       	call   41bb <mkdir>
+    2e55:	83 c4 10             	add    $0x10,%esp
+    2e58:	85 c0                	test   %eax,%eax
+    2e5a:	74 5a                	je     2eb6 <fourteen+0xf6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2e5c:	83 ec 0c             	sub    $0xc,%esp
+    2e5f:	68 f0 5c 00 00       	push   $0x5cf0
+    2e64:	e8 52 13 00 00       	call   41bb <mkdir>
+    2e69:	83 c4 10             	add    $0x10,%esp
+    2e6c:	85 c0                	test   %eax,%eax
+    2e6e:	74 2e                	je     2e9e <fourteen+0xde>
+  printf(1, "fourteen ok\n");
+    2e70:	83 ec 08             	sub    $0x8,%esp
+    2e73:	68 92 53 00 00       	push   $0x5392
+    2e78:	6a 01                	push   $0x1
+    2e7a:	e8 b1 14 00 00       	call   4330 <printf>
+}
+    2e7f:	83 c4 10             	add    $0x10,%esp
+    2e82:	c9                   	leave
+    2e83:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2e84:	50                   	push   %eax
+    2e85:	50                   	push   %eax
+    2e86:	68 57 53 00 00       	push   $0x5357
+    2e8b:	6a 01                	push   $0x1
+    2e8d:	e8 9e 14 00 00       	call   4330 <printf>
+    exit(1);
+    2e92:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2e99:	e8 b5 12 00 00       	call   4153 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2e9e:	50                   	push   %eax
+    2e9f:	50                   	push   %eax
+    2ea0:	68 10 5d 00 00       	push   $0x5d10
+    2ea5:	6a 01                	push   $0x1
+    2ea7:	e8 84 14 00 00       	call   4330 <printf>
+    exit(0);
+    2eac:	31 d2                	xor    %edx,%edx
+    2eae:	89 14 24             	mov    %edx,(%esp)
+    2eb1:	e8 9d 12 00 00       	call   4153 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2eb6:	51                   	push   %ecx
+    2eb7:	51                   	push   %ecx
+    2eb8:	68 c0 5c 00 00       	push   $0x5cc0
+    2ebd:	6a 01                	push   $0x1
+    2ebf:	e8 6c 14 00 00       	call   4330 <printf>
+    exit(0);
+    2ec4:	31 c0                	xor    %eax,%eax
+    2ec6:	89 04 24             	mov    %eax,(%esp)
+    2ec9:	e8 85 12 00 00       	call   4153 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2ece:	50                   	push   %eax
+    2ecf:	50                   	push   %eax
+    2ed0:	68 84 5c 00 00       	push   $0x5c84
+    2ed5:	6a 01                	push   $0x1
+    2ed7:	e8 54 14 00 00       	call   4330 <printf>
+    exit(1);
+    2edc:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2ee3:	e8 6b 12 00 00       	call   4153 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    2ee8:	51                   	push   %ecx
+    2ee9:	51                   	push   %ecx
+    2eea:	68 14 5c 00 00       	push   $0x5c14
+    2eef:	6a 01                	push   $0x1
+    2ef1:	e8 3a 14 00 00       	call   4330 <printf>
+    exit(1);
+    2ef6:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2efd:	e8 51 12 00 00       	call   4153 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2f02:	50                   	push   %eax
+    2f03:	50                   	push   %eax
+    2f04:	68 b4 5b 00 00       	push   $0x5bb4
+    2f09:	6a 01                	push   $0x1
+    2f0b:	e8 20 14 00 00       	call   4330 <printf>
+    exit(1);
+    2f10:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    2f17:	e8 37 12 00 00       	call   4153 <exit>
+    2f1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00002f20 <rmdot>:
+{
+    2f20:	55                   	push   %ebp
+    2f21:	89 e5                	mov    %esp,%ebp
+    2f23:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2f26:	68 9f 53 00 00       	push   $0x539f
+    2f2b:	6a 01                	push   $0x1
+    2f2d:	e8 fe 13 00 00       	call   4330 <printf>
+  if(mkdir("dots") != 0){
+    2f32:	c7 04 24 ab 53 00 00 	movl   $0x53ab,(%esp)
+    2f39:	e8 7d 12 00 00       	call   41bb <mkdir>
+    2f3e:	83 c4 10             	add    $0x10,%esp
+    2f41:	85 c0                	test   %eax,%eax
+    2f43:	0f 85 b4 00 00 00    	jne    2ffd <rmdot+0xdd>
+  if(chdir("dots") != 0){
+    2f49:	83 ec 0c             	sub    $0xc,%esp
+    2f4c:	68 ab 53 00 00       	push   $0x53ab
+    2f51:	e8 6d 12 00 00       	call   41c3 <chdir>
+    2f56:	83 c4 10             	add    $0x10,%esp
+    2f59:	85 c0                	test   %eax,%eax
+    2f5b:	0f 85 4a 01 00 00    	jne    30ab <rmdot+0x18b>
+  if(unlink(".") == 0){
+    2f61:	83 ec 0c             	sub    $0xc,%esp
+    2f64:	68 56 50 00 00       	push   $0x5056
+    2f69:	e8 35 12 00 00       	call   41a3 <unlink>
+    2f6e:	83 c4 10             	add    $0x10,%esp
+    2f71:	85 c0                	test   %eax,%eax
+    2f73:	0f 84 1a 01 00 00    	je     3093 <rmdot+0x173>
+  if(unlink("..") == 0){
+    2f79:	83 ec 0c             	sub    $0xc,%esp
+    2f7c:	68 55 50 00 00       	push   $0x5055
+    2f81:	e8 1d 12 00 00       	call   41a3 <unlink>
+    2f86:	83 c4 10             	add    $0x10,%esp
+    2f89:	85 c0                	test   %eax,%eax
+    2f8b:	0f 84 ea 00 00 00    	je     307b <rmdot+0x15b>
+  if(chdir("/") != 0){
+    2f91:	83 ec 0c             	sub    $0xc,%esp
+    2f94:	68 81 47 00 00       	push   $0x4781
+    2f99:	e8 25 12 00 00       	call   41c3 <chdir>
+    2f9e:	83 c4 10             	add    $0x10,%esp
+    2fa1:	85 c0                	test   %eax,%eax
+    2fa3:	0f 85 b8 00 00 00    	jne    3061 <rmdot+0x141>
+  if(unlink("dots/.") == 0){
+    2fa9:	83 ec 0c             	sub    $0xc,%esp
+    2fac:	68 f3 53 00 00       	push   $0x53f3
+    2fb1:	e8 ed 11 00 00       	call   41a3 <unlink>
+    2fb6:	83 c4 10             	add    $0x10,%esp
+    2fb9:	85 c0                	test   %eax,%eax
+    2fbb:	0f 84 88 00 00 00    	je     3049 <rmdot+0x129>
+  if(unlink("dots/..") == 0){
+    2fc1:	83 ec 0c             	sub    $0xc,%esp
+    2fc4:	68 11 54 00 00       	push   $0x5411
+    2fc9:	e8 d5 11 00 00       	call   41a3 <unlink>
+    2fce:	83 c4 10             	add    $0x10,%esp
+    2fd1:	85 c0                	test   %eax,%eax
+    2fd3:	74 5c                	je     3031 <rmdot+0x111>
+  if(unlink("dots") != 0){
+    2fd5:	83 ec 0c             	sub    $0xc,%esp
+    2fd8:	68 ab 53 00 00       	push   $0x53ab
+    2fdd:	e8 c1 11 00 00       	call   41a3 <unlink>
+    2fe2:	83 c4 10             	add    $0x10,%esp
+    2fe5:	85 c0                	test   %eax,%eax
+    2fe7:	75 2e                	jne    3017 <rmdot+0xf7>
+  printf(1, "rmdot ok\n");
+    2fe9:	83 ec 08             	sub    $0x8,%esp
+    2fec:	68 46 54 00 00       	push   $0x5446
+    2ff1:	6a 01                	push   $0x1
+    2ff3:	e8 38 13 00 00       	call   4330 <printf>
+}
+    2ff8:	83 c4 10             	add    $0x10,%esp
+    2ffb:	c9                   	leave
+    2ffc:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2ffd:	50                   	push   %eax
+    2ffe:	50                   	push   %eax
+    2fff:	68 b0 53 00 00       	push   $0x53b0
+    3004:	6a 01                	push   $0x1
+    3006:	e8 25 13 00 00       	call   4330 <printf>
+    exit(1);
+    300b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3012:	e8 3c 11 00 00       	call   4153 <exit>
+    printf(1, "unlink dots failed!\n");
+    3017:	50                   	push   %eax
+    3018:	50                   	push   %eax
+    3019:	68 31 54 00 00       	push   $0x5431
+    301e:	6a 01                	push   $0x1
+    3020:	e8 0b 13 00 00       	call   4330 <printf>
+    exit(1);
+    3025:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    302c:	e8 22 11 00 00       	call   4153 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    3031:	52                   	push   %edx
+    3032:	52                   	push   %edx
+    3033:	68 19 54 00 00       	push   $0x5419
+    3038:	6a 01                	push   $0x1
+    303a:	e8 f1 12 00 00       	call   4330 <printf>
+    exit(0);
+    303f:	31 c9                	xor    %ecx,%ecx
+    3041:	89 0c 24             	mov    %ecx,(%esp)
+    3044:	e8 0a 11 00 00       	call   4153 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    3049:	50                   	push   %eax
+    304a:	50                   	push   %eax
+    304b:	68 fa 53 00 00       	push   $0x53fa
+    3050:	6a 01                	push   $0x1
+    3052:	e8 d9 12 00 00       	call   4330 <printf>
+    exit(0);
+    3057:	31 c0                	xor    %eax,%eax
+    3059:	89 04 24             	mov    %eax,(%esp)
+    305c:	e8 f2 10 00 00       	call   4153 <exit>
+    printf(1, "chdir / failed\n");
+    3061:	50                   	push   %eax
+    3062:	50                   	push   %eax
+    3063:	68 83 47 00 00       	push   $0x4783
+    3068:	6a 01                	push   $0x1
+    306a:	e8 c1 12 00 00       	call   4330 <printf>
+    exit(1);
+    306f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3076:	e8 d8 10 00 00       	call   4153 <exit>
+    printf(1, "rm .. worked!\n");
+    307b:	50                   	push   %eax
+    307c:	50                   	push   %eax
+    307d:	68 e4 53 00 00       	push   $0x53e4
+    3082:	6a 01                	push   $0x1
+    3084:	e8 a7 12 00 00       	call   4330 <printf>
+    exit(0);
+    3089:	31 c0                	xor    %eax,%eax
+    308b:	89 04 24             	mov    %eax,(%esp)
+    308e:	e8 c0 10 00 00       	call   4153 <exit>
+    printf(1, "rm . worked!\n");
+    3093:	52                   	push   %edx
+    3094:	52                   	push   %edx
+    3095:	68 d6 53 00 00       	push   $0x53d6
+    309a:	6a 01                	push   $0x1
+    309c:	e8 8f 12 00 00       	call   4330 <printf>
+    exit(0);
+    30a1:	31 c9                	xor    %ecx,%ecx
+    30a3:	89 0c 24             	mov    %ecx,(%esp)
+    30a6:	e8 a8 10 00 00       	call   4153 <exit>
+    printf(1, "chdir dots failed\n");
+    30ab:	50                   	push   %eax
+    30ac:	50                   	push   %eax
+    30ad:	68 c3 53 00 00       	push   $0x53c3
+    30b2:	6a 01                	push   $0x1
+    30b4:	e8 77 12 00 00       	call   4330 <printf>
+    exit(1);
+    30b9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    30c0:	e8 8e 10 00 00       	call   4153 <exit>
+    30c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    30cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000030d0 <dirfile>:
+{
+    30d0:	55                   	push   %ebp
+    30d1:	89 e5                	mov    %esp,%ebp
+    30d3:	53                   	push   %ebx
+    30d4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    30d7:	68 50 54 00 00       	push   $0x5450
+    30dc:	6a 01                	push   $0x1
+    30de:	e8 4d 12 00 00       	call   4330 <printf>
+  fd = open("dirfile", O_CREATE);
+    30e3:	59                   	pop    %ecx
+    30e4:	5b                   	pop    %ebx
+    30e5:	68 00 02 00 00       	push   $0x200
+    30ea:	68 5d 54 00 00       	push   $0x545d
+    30ef:	e8 9f 10 00 00       	call   4193 <open>
+  if(fd < 0){
+    30f4:	83 c4 10             	add    $0x10,%esp
+    30f7:	85 c0                	test   %eax,%eax
+    30f9:	0f 88 4d 01 00 00    	js     324c <dirfile+0x17c>
+  close(fd);
+    30ff:	83 ec 0c             	sub    $0xc,%esp
+    3102:	50                   	push   %eax
+    3103:	e8 73 10 00 00       	call   417b <close>
+  if(chdir("dirfile") == 0){
+    3108:	c7 04 24 5d 54 00 00 	movl   $0x545d,(%esp)
+    310f:	e8 af 10 00 00       	call   41c3 <chdir>
+    3114:	83 c4 10             	add    $0x10,%esp
+    3117:	85 c0                	test   %eax,%eax
+    3119:	0f 84 15 01 00 00    	je     3234 <dirfile+0x164>
+  fd = open("dirfile/xx", 0);
+    311f:	83 ec 08             	sub    $0x8,%esp
+    3122:	6a 00                	push   $0x0
+    3124:	68 96 54 00 00       	push   $0x5496
+    3129:	e8 65 10 00 00       	call   4193 <open>
+  if(fd >= 0){
+    312e:	83 c4 10             	add    $0x10,%esp
+    3131:	85 c0                	test   %eax,%eax
+    3133:	0f 89 e3 00 00 00    	jns    321c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    3139:	83 ec 08             	sub    $0x8,%esp
+    313c:	68 00 02 00 00       	push   $0x200
+    3141:	68 96 54 00 00       	push   $0x5496
+    3146:	e8 48 10 00 00       	call   4193 <open>
+  if(fd >= 0){
+    314b:	83 c4 10             	add    $0x10,%esp
+    314e:	85 c0                	test   %eax,%eax
+    3150:	0f 89 c6 00 00 00    	jns    321c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    3156:	83 ec 0c             	sub    $0xc,%esp
+    3159:	68 96 54 00 00       	push   $0x5496
+    315e:	e8 58 10 00 00       	call   41bb <mkdir>
+    3163:	83 c4 10             	add    $0x10,%esp
+    3166:	85 c0                	test   %eax,%eax
+    3168:	0f 84 72 01 00 00    	je     32e0 <dirfile+0x210>
+  if(unlink("dirfile/xx") == 0){
+    316e:	83 ec 0c             	sub    $0xc,%esp
+    3171:	68 96 54 00 00       	push   $0x5496
+    3176:	e8 28 10 00 00       	call   41a3 <unlink>
+    317b:	83 c4 10             	add    $0x10,%esp
+    317e:	85 c0                	test   %eax,%eax
+    3180:	0f 84 42 01 00 00    	je     32c8 <dirfile+0x1f8>
+  if(link("README", "dirfile/xx") == 0){
+    3186:	83 ec 08             	sub    $0x8,%esp
+    3189:	68 96 54 00 00       	push   $0x5496
+    318e:	68 fa 54 00 00       	push   $0x54fa
+    3193:	e8 1b 10 00 00       	call   41b3 <link>
+    3198:	83 c4 10             	add    $0x10,%esp
+    319b:	85 c0                	test   %eax,%eax
+    319d:	0f 84 0d 01 00 00    	je     32b0 <dirfile+0x1e0>
+  if(unlink("dirfile") != 0){
+    31a3:	83 ec 0c             	sub    $0xc,%esp
+    31a6:	68 5d 54 00 00       	push   $0x545d
+    31ab:	e8 f3 0f 00 00       	call   41a3 <unlink>
+    31b0:	83 c4 10             	add    $0x10,%esp
+    31b3:	85 c0                	test   %eax,%eax
+    31b5:	0f 85 db 00 00 00    	jne    3296 <dirfile+0x1c6>
+  fd = open(".", O_RDWR);
+    31bb:	83 ec 08             	sub    $0x8,%esp
+    31be:	6a 02                	push   $0x2
+    31c0:	68 56 50 00 00       	push   $0x5056
+    31c5:	e8 c9 0f 00 00       	call   4193 <open>
+  if(fd >= 0){
+    31ca:	83 c4 10             	add    $0x10,%esp
+    31cd:	85 c0                	test   %eax,%eax
+    31cf:	0f 89 a9 00 00 00    	jns    327e <dirfile+0x1ae>
+  fd = open(".", 0);
+    31d5:	83 ec 08             	sub    $0x8,%esp
+    31d8:	6a 00                	push   $0x0
+    31da:	68 56 50 00 00       	push   $0x5056
+    31df:	e8 af 0f 00 00       	call   4193 <open>
+  if(write(fd, "x", 1) > 0){
+    31e4:	83 c4 0c             	add    $0xc,%esp
+    31e7:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    31e9:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    31eb:	68 39 51 00 00       	push   $0x5139
+    31f0:	50                   	push   %eax
+    31f1:	e8 7d 0f 00 00       	call   4173 <write>
+    31f6:	83 c4 10             	add    $0x10,%esp
+    31f9:	85 c0                	test   %eax,%eax
+    31fb:	7f 69                	jg     3266 <dirfile+0x196>
+  close(fd);
+    31fd:	83 ec 0c             	sub    $0xc,%esp
+    3200:	53                   	push   %ebx
+    3201:	e8 75 0f 00 00       	call   417b <close>
+  printf(1, "dir vs file OK\n");
+    3206:	58                   	pop    %eax
+    3207:	5a                   	pop    %edx
+    3208:	68 2d 55 00 00       	push   $0x552d
+    320d:	6a 01                	push   $0x1
+    320f:	e8 1c 11 00 00       	call   4330 <printf>
+}
+    3214:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3217:	83 c4 10             	add    $0x10,%esp
+    321a:	c9                   	leave
+    321b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    321c:	50                   	push   %eax
+    321d:	50                   	push   %eax
+    321e:	68 a1 54 00 00       	push   $0x54a1
+    3223:	6a 01                	push   $0x1
+    3225:	e8 06 11 00 00       	call   4330 <printf>
+    exit(0);
+    322a:	31 c0                	xor    %eax,%eax
+    322c:	89 04 24             	mov    %eax,(%esp)
+    322f:	e8 1f 0f 00 00       	call   4153 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    3234:	50                   	push   %eax
+    3235:	50                   	push   %eax
+    3236:	68 7c 54 00 00       	push   $0x547c
+    323b:	6a 01                	push   $0x1
+    323d:	e8 ee 10 00 00       	call   4330 <printf>
+    exit(0);
+    3242:	31 c0                	xor    %eax,%eax
+    3244:	89 04 24             	mov    %eax,(%esp)
+    3247:	e8 07 0f 00 00       	call   4153 <exit>
+    printf(1, "create dirfile failed\n");
+    324c:	52                   	push   %edx
+    324d:	52                   	push   %edx
+    324e:	68 65 54 00 00       	push   $0x5465
+    3253:	6a 01                	push   $0x1
+    3255:	e8 d6 10 00 00       	call   4330 <printf>
+    exit(1);
+    325a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3261:	e8 ed 0e 00 00       	call   4153 <exit>
+    printf(1, "write . succeeded!\n");
+    3266:	51                   	push   %ecx
+    exit(0);
+    3267:	31 db                	xor    %ebx,%ebx
+    printf(1, "write . succeeded!\n");
+    3269:	51                   	push   %ecx
+    326a:	68 19 55 00 00       	push   $0x5519
+    326f:	6a 01                	push   $0x1
+    3271:	e8 ba 10 00 00       	call   4330 <printf>
+    exit(0);
+    3276:	89 1c 24             	mov    %ebx,(%esp)
+    3279:	e8 d5 0e 00 00       	call   4153 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    327e:	50                   	push   %eax
+    327f:	50                   	push   %eax
+    3280:	68 64 5d 00 00       	push   $0x5d64
+    3285:	6a 01                	push   $0x1
+    3287:	e8 a4 10 00 00       	call   4330 <printf>
+    exit(0);
+    328c:	31 c0                	xor    %eax,%eax
+    328e:	89 04 24             	mov    %eax,(%esp)
+    3291:	e8 bd 0e 00 00       	call   4153 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    3296:	50                   	push   %eax
+    3297:	50                   	push   %eax
+    3298:	68 01 55 00 00       	push   $0x5501
+    329d:	6a 01                	push   $0x1
+    329f:	e8 8c 10 00 00       	call   4330 <printf>
+    exit(1);
+    32a4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    32ab:	e8 a3 0e 00 00       	call   4153 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    32b0:	50                   	push   %eax
+    32b1:	50                   	push   %eax
+    32b2:	68 44 5d 00 00       	push   $0x5d44
+    32b7:	6a 01                	push   $0x1
+    32b9:	e8 72 10 00 00       	call   4330 <printf>
+    exit(0);
+    32be:	31 c0                	xor    %eax,%eax
+    32c0:	89 04 24             	mov    %eax,(%esp)
+    32c3:	e8 8b 0e 00 00       	call   4153 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    32c8:	52                   	push   %edx
+    32c9:	52                   	push   %edx
+    32ca:	68 dc 54 00 00       	push   $0x54dc
+    32cf:	6a 01                	push   $0x1
+    32d1:	e8 5a 10 00 00       	call   4330 <printf>
+    exit(0);
+    32d6:	31 c9                	xor    %ecx,%ecx
+    32d8:	89 0c 24             	mov    %ecx,(%esp)
+    32db:	e8 73 0e 00 00       	call   4153 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    32e0:	53                   	push   %ebx
+    32e1:	53                   	push   %ebx
+    32e2:	68 bf 54 00 00       	push   $0x54bf
+    32e7:	6a 01                	push   $0x1
+    32e9:	e8 42 10 00 00       	call   4330 <printf>
+    exit(0);
+    32ee:	31 c0                	xor    %eax,%eax
+    32f0:	89 04 24             	mov    %eax,(%esp)
+    32f3:	e8 5b 0e 00 00       	call   4153 <exit>
+    32f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    32ff:	90                   	nop
+
+00003300 <iref>:
+{
+    3300:	55                   	push   %ebp
+    3301:	89 e5                	mov    %esp,%ebp
+    3303:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    3304:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    3309:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    330c:	68 3d 55 00 00       	push   $0x553d
+    3311:	6a 01                	push   $0x1
+    3313:	e8 18 10 00 00       	call   4330 <printf>
+    3318:	83 c4 10             	add    $0x10,%esp
+    331b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    331f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    3320:	83 ec 0c             	sub    $0xc,%esp
+    3323:	68 4e 55 00 00       	push   $0x554e
+    3328:	e8 8e 0e 00 00       	call   41bb <mkdir>
+    332d:	83 c4 10             	add    $0x10,%esp
+    3330:	85 c0                	test   %eax,%eax
+    3332:	0f 85 bb 00 00 00    	jne    33f3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    3338:	83 ec 0c             	sub    $0xc,%esp
+    333b:	68 4e 55 00 00       	push   $0x554e
+    3340:	e8 7e 0e 00 00       	call   41c3 <chdir>
+    3345:	83 c4 10             	add    $0x10,%esp
+    3348:	85 c0                	test   %eax,%eax
+    334a:	0f 85 be 00 00 00    	jne    340e <iref+0x10e>
+    mkdir("");
+    3350:	83 ec 0c             	sub    $0xc,%esp
+    3353:	68 03 4c 00 00       	push   $0x4c03
+    3358:	e8 5e 0e 00 00       	call   41bb <mkdir>
+    link("README", "");
+    335d:	59                   	pop    %ecx
+    335e:	58                   	pop    %eax
+    335f:	68 03 4c 00 00       	push   $0x4c03
+    3364:	68 fa 54 00 00       	push   $0x54fa
+    3369:	e8 45 0e 00 00       	call   41b3 <link>
+    fd = open("", O_CREATE);
+    336e:	58                   	pop    %eax
+    336f:	5a                   	pop    %edx
+    3370:	68 00 02 00 00       	push   $0x200
+    3375:	68 03 4c 00 00       	push   $0x4c03
+    337a:	e8 14 0e 00 00       	call   4193 <open>
+    if(fd >= 0)
+    337f:	83 c4 10             	add    $0x10,%esp
+    3382:	85 c0                	test   %eax,%eax
+    3384:	78 0c                	js     3392 <iref+0x92>
+      close(fd);
+    3386:	83 ec 0c             	sub    $0xc,%esp
+    3389:	50                   	push   %eax
+    338a:	e8 ec 0d 00 00       	call   417b <close>
+    338f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3392:	83 ec 08             	sub    $0x8,%esp
+    3395:	68 00 02 00 00       	push   $0x200
+    339a:	68 38 51 00 00       	push   $0x5138
+    339f:	e8 ef 0d 00 00       	call   4193 <open>
+    if(fd >= 0)
+    33a4:	83 c4 10             	add    $0x10,%esp
+    33a7:	85 c0                	test   %eax,%eax
+    33a9:	78 0c                	js     33b7 <iref+0xb7>
+      close(fd);
+    33ab:	83 ec 0c             	sub    $0xc,%esp
+    33ae:	50                   	push   %eax
+    33af:	e8 c7 0d 00 00       	call   417b <close>
+    33b4:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    33b7:	83 ec 0c             	sub    $0xc,%esp
+    33ba:	68 38 51 00 00       	push   $0x5138
+    33bf:	e8 df 0d 00 00       	call   41a3 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    33c4:	83 c4 10             	add    $0x10,%esp
+    33c7:	83 eb 01             	sub    $0x1,%ebx
+    33ca:	0f 85 50 ff ff ff    	jne    3320 <iref+0x20>
+  chdir("/");
+    33d0:	83 ec 0c             	sub    $0xc,%esp
+    33d3:	68 81 47 00 00       	push   $0x4781
+    33d8:	e8 e6 0d 00 00       	call   41c3 <chdir>
+  printf(1, "empty file name OK\n");
+    33dd:	58                   	pop    %eax
+    33de:	5a                   	pop    %edx
+    33df:	68 7c 55 00 00       	push   $0x557c
+    33e4:	6a 01                	push   $0x1
+    33e6:	e8 45 0f 00 00       	call   4330 <printf>
+}
+    33eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    33ee:	83 c4 10             	add    $0x10,%esp
+    33f1:	c9                   	leave
+    33f2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    33f3:	83 ec 08             	sub    $0x8,%esp
+    33f6:	68 54 55 00 00       	push   $0x5554
+    33fb:	6a 01                	push   $0x1
+    33fd:	e8 2e 0f 00 00       	call   4330 <printf>
+      exit(1);
+    3402:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3409:	e8 45 0d 00 00       	call   4153 <exit>
+      printf(1, "chdir irefd failed\n");
+    340e:	83 ec 08             	sub    $0x8,%esp
+    3411:	68 68 55 00 00       	push   $0x5568
+    3416:	6a 01                	push   $0x1
+    3418:	e8 13 0f 00 00       	call   4330 <printf>
+      exit(1);
+    341d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3424:	e8 2a 0d 00 00       	call   4153 <exit>
+    3429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003430 <forktest>:
+{
+    3430:	55                   	push   %ebp
+    3431:	89 e5                	mov    %esp,%ebp
+    3433:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    3434:	31 db                	xor    %ebx,%ebx
+{
+    3436:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    3439:	68 90 55 00 00       	push   $0x5590
+    343e:	6a 01                	push   $0x1
+    3440:	e8 eb 0e 00 00       	call   4330 <printf>
+    3445:	83 c4 10             	add    $0x10,%esp
+    3448:	eb 17                	jmp    3461 <forktest+0x31>
+    344a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    3450:	74 63                	je     34b5 <forktest+0x85>
+  for(n=0; n<1000; n++){
+    3452:	83 c3 01             	add    $0x1,%ebx
+    3455:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    345b:	0f 84 93 00 00 00    	je     34f4 <forktest+0xc4>
+    pid = fork();
+    3461:	e8 e5 0c 00 00       	call   414b <fork>
+    if(pid < 0)
+    3466:	85 c0                	test   %eax,%eax
+    3468:	79 e6                	jns    3450 <forktest+0x20>
+  for(; n > 0; n--){
+    346a:	85 db                	test   %ebx,%ebx
+    346c:	74 1b                	je     3489 <forktest+0x59>
+    346e:	66 90                	xchg   %ax,%ax
+    if(wait(&estatus) < 0){
+    3470:	83 ec 0c             	sub    $0xc,%esp
+    3473:	68 d0 90 00 00       	push   $0x90d0
+    3478:	e8 de 0c 00 00       	call   415b <wait>
+    347d:	83 c4 10             	add    $0x10,%esp
+    3480:	85 c0                	test   %eax,%eax
+    3482:	78 3b                	js     34bf <forktest+0x8f>
+  for(; n > 0; n--){
+    3484:	83 eb 01             	sub    $0x1,%ebx
+    3487:	75 e7                	jne    3470 <forktest+0x40>
+  if(wait(&estatus) != -1){
+    3489:	83 ec 0c             	sub    $0xc,%esp
+    348c:	68 d0 90 00 00       	push   $0x90d0
+    3491:	e8 c5 0c 00 00       	call   415b <wait>
+    3496:	83 c4 10             	add    $0x10,%esp
+    3499:	83 f8 ff             	cmp    $0xffffffff,%eax
+    349c:	75 3c                	jne    34da <forktest+0xaa>
+  printf(1, "fork test OK\n");
+    349e:	83 ec 08             	sub    $0x8,%esp
+    34a1:	68 c2 55 00 00       	push   $0x55c2
+    34a6:	6a 01                	push   $0x1
+    34a8:	e8 83 0e 00 00       	call   4330 <printf>
+}
+    34ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    34b0:	83 c4 10             	add    $0x10,%esp
+    34b3:	c9                   	leave
+    34b4:	c3                   	ret
+      exit(0);
+    34b5:	83 ec 0c             	sub    $0xc,%esp
+    34b8:	6a 00                	push   $0x0
+    34ba:	e8 94 0c 00 00       	call   4153 <exit>
+      printf(1, "wait stopped early\n");
+    34bf:	83 ec 08             	sub    $0x8,%esp
+    34c2:	68 9b 55 00 00       	push   $0x559b
+    34c7:	6a 01                	push   $0x1
+    34c9:	e8 62 0e 00 00       	call   4330 <printf>
+      exit(1);
+    34ce:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    34d5:	e8 79 0c 00 00       	call   4153 <exit>
+    printf(1, "wait got too many\n");
+    34da:	50                   	push   %eax
+    34db:	50                   	push   %eax
+    34dc:	68 af 55 00 00       	push   $0x55af
+    34e1:	6a 01                	push   $0x1
+    34e3:	e8 48 0e 00 00       	call   4330 <printf>
+    exit(1);
+    34e8:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    34ef:	e8 5f 0c 00 00       	call   4153 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    34f4:	52                   	push   %edx
+    34f5:	52                   	push   %edx
+    34f6:	68 84 5d 00 00       	push   $0x5d84
+    34fb:	6a 01                	push   $0x1
+    34fd:	e8 2e 0e 00 00       	call   4330 <printf>
+    exit(1);
+    3502:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3509:	e8 45 0c 00 00       	call   4153 <exit>
+    350e:	66 90                	xchg   %ax,%ax
+
+00003510 <sbrktest>:
+{
+    3510:	55                   	push   %ebp
+    3511:	89 e5                	mov    %esp,%ebp
+    3513:	57                   	push   %edi
+    3514:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    3515:	31 f6                	xor    %esi,%esi
+{
+    3517:	53                   	push   %ebx
+    3518:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    351b:	68 d0 55 00 00       	push   $0x55d0
+    3520:	ff 35 a0 69 00 00    	push   0x69a0
+    3526:	e8 05 0e 00 00       	call   4330 <printf>
+  oldbrk = sbrk(0);
+    352b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3532:	e8 a4 0c 00 00       	call   41db <sbrk>
+    3537:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    353a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3541:	e8 95 0c 00 00       	call   41db <sbrk>
+    3546:	83 c4 10             	add    $0x10,%esp
+    3549:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    354b:	eb 05                	jmp    3552 <sbrktest+0x42>
+    354d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3550:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3552:	83 ec 0c             	sub    $0xc,%esp
+    3555:	6a 01                	push   $0x1
+    3557:	e8 7f 0c 00 00       	call   41db <sbrk>
+    if(b != a){
+    355c:	83 c4 10             	add    $0x10,%esp
+    355f:	39 d8                	cmp    %ebx,%eax
+    3561:	0f 85 bc 02 00 00    	jne    3823 <sbrktest+0x313>
+  for(i = 0; i < 5000; i++){
+    3567:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    356a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    356d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3570:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3576:	75 d8                	jne    3550 <sbrktest+0x40>
+  pid = fork();
+    3578:	e8 ce 0b 00 00       	call   414b <fork>
+    357d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    357f:	85 c0                	test   %eax,%eax
+    3581:	0f 88 40 03 00 00    	js     38c7 <sbrktest+0x3b7>
+  c = sbrk(1);
+    3587:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    358a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    358d:	6a 01                	push   $0x1
+    358f:	e8 47 0c 00 00       	call   41db <sbrk>
+  c = sbrk(1);
+    3594:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    359b:	e8 3b 0c 00 00       	call   41db <sbrk>
+  if(c != a + 1){
+    35a0:	83 c4 10             	add    $0x10,%esp
+    35a3:	39 c3                	cmp    %eax,%ebx
+    35a5:	0f 85 9a 03 00 00    	jne    3945 <sbrktest+0x435>
+  if(pid == 0)
+    35ab:	85 f6                	test   %esi,%esi
+    35ad:	0f 84 88 03 00 00    	je     393b <sbrktest+0x42b>
+  wait(&estatus);
+    35b3:	83 ec 0c             	sub    $0xc,%esp
+    35b6:	68 d0 90 00 00       	push   $0x90d0
+    35bb:	e8 9b 0b 00 00       	call   415b <wait>
+  a = sbrk(0);
+    35c0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    35c7:	e8 0f 0c 00 00       	call   41db <sbrk>
+    35cc:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    35ce:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    35d3:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    35d5:	89 04 24             	mov    %eax,(%esp)
+    35d8:	e8 fe 0b 00 00       	call   41db <sbrk>
+  if (p != a) {
+    35dd:	83 c4 10             	add    $0x10,%esp
+    35e0:	39 c3                	cmp    %eax,%ebx
+    35e2:	0f 85 c1 02 00 00    	jne    38a9 <sbrktest+0x399>
+  a = sbrk(0);
+    35e8:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    35eb:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    35f2:	6a 00                	push   $0x0
+    35f4:	e8 e2 0b 00 00       	call   41db <sbrk>
+  c = sbrk(-4096);
+    35f9:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3600:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3602:	e8 d4 0b 00 00       	call   41db <sbrk>
+  if(c == (char*)0xffffffff){
+    3607:	83 c4 10             	add    $0x10,%esp
+    360a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    360d:	0f 84 8c 03 00 00    	je     399f <sbrktest+0x48f>
+  c = sbrk(0);
+    3613:	83 ec 0c             	sub    $0xc,%esp
+    3616:	6a 00                	push   $0x0
+    3618:	e8 be 0b 00 00       	call   41db <sbrk>
+  if(c != a - 4096){
+    361d:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3623:	83 c4 10             	add    $0x10,%esp
+    3626:	39 d0                	cmp    %edx,%eax
+    3628:	0f 85 53 03 00 00    	jne    3981 <sbrktest+0x471>
+  a = sbrk(0);
+    362e:	83 ec 0c             	sub    $0xc,%esp
+    3631:	6a 00                	push   $0x0
+    3633:	e8 a3 0b 00 00       	call   41db <sbrk>
+  c = sbrk(4096);
+    3638:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    363f:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3641:	e8 95 0b 00 00       	call   41db <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    3646:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    3649:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    364b:	39 c3                	cmp    %eax,%ebx
+    364d:	0f 85 10 03 00 00    	jne    3963 <sbrktest+0x453>
+    3653:	83 ec 0c             	sub    $0xc,%esp
+    3656:	6a 00                	push   $0x0
+    3658:	e8 7e 0b 00 00       	call   41db <sbrk>
+    365d:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3663:	83 c4 10             	add    $0x10,%esp
+    3666:	39 c2                	cmp    %eax,%edx
+    3668:	0f 85 f5 02 00 00    	jne    3963 <sbrktest+0x453>
+  if(*lastaddr == 99){
+    366e:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    3675:	0f 84 6a 02 00 00    	je     38e5 <sbrktest+0x3d5>
+  a = sbrk(0);
+    367b:	83 ec 0c             	sub    $0xc,%esp
+    367e:	6a 00                	push   $0x0
+    3680:	e8 56 0b 00 00       	call   41db <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3685:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    368c:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    368e:	e8 48 0b 00 00       	call   41db <sbrk>
+    3693:	89 c2                	mov    %eax,%edx
+    3695:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3698:	29 d0                	sub    %edx,%eax
+    369a:	89 04 24             	mov    %eax,(%esp)
+    369d:	e8 39 0b 00 00       	call   41db <sbrk>
+  if(c != a){
+    36a2:	83 c4 10             	add    $0x10,%esp
+    36a5:	39 c3                	cmp    %eax,%ebx
+    36a7:	0f 85 de 01 00 00    	jne    388b <sbrktest+0x37b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    36ad:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    36b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    ppid = getpid();
+    36b8:	e8 16 0b 00 00       	call   41d3 <getpid>
+    36bd:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    36bf:	e8 87 0a 00 00       	call   414b <fork>
+    if(pid < 0){
+    36c4:	85 c0                	test   %eax,%eax
+    36c6:	0f 88 77 01 00 00    	js     3843 <sbrktest+0x333>
+    if(pid == 0){
+    36cc:	0f 84 90 01 00 00    	je     3862 <sbrktest+0x352>
+    wait(&estatus);
+    36d2:	83 ec 0c             	sub    $0xc,%esp
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    36d5:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    wait(&estatus);
+    36db:	68 d0 90 00 00       	push   $0x90d0
+    36e0:	e8 76 0a 00 00       	call   415b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    36e5:	83 c4 10             	add    $0x10,%esp
+    36e8:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    36ee:	75 c8                	jne    36b8 <sbrktest+0x1a8>
+  if(pipe(fds) != 0){
+    36f0:	83 ec 0c             	sub    $0xc,%esp
+    36f3:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    36f6:	50                   	push   %eax
+    36f7:	e8 67 0a 00 00       	call   4163 <pipe>
+    36fc:	83 c4 10             	add    $0x10,%esp
+    36ff:	85 c0                	test   %eax,%eax
+    3701:	0f 85 1a 02 00 00    	jne    3921 <sbrktest+0x411>
+    3707:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    370a:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    370d:	89 df                	mov    %ebx,%edi
+    370f:	90                   	nop
+    if((pids[i] = fork()) == 0){
+    3710:	e8 36 0a 00 00       	call   414b <fork>
+    3715:	89 07                	mov    %eax,(%edi)
+    3717:	85 c0                	test   %eax,%eax
+    3719:	0f 84 98 00 00 00    	je     37b7 <sbrktest+0x2a7>
+    if(pids[i] != -1)
+    371f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3722:	74 14                	je     3738 <sbrktest+0x228>
+      read(fds[0], &scratch, 1);
+    3724:	83 ec 04             	sub    $0x4,%esp
+    3727:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    372a:	6a 01                	push   $0x1
+    372c:	50                   	push   %eax
+    372d:	ff 75 b8             	push   -0x48(%ebp)
+    3730:	e8 36 0a 00 00       	call   416b <read>
+    3735:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3738:	83 c7 04             	add    $0x4,%edi
+    373b:	39 f7                	cmp    %esi,%edi
+    373d:	75 d1                	jne    3710 <sbrktest+0x200>
+  c = sbrk(4096);
+    373f:	83 ec 0c             	sub    $0xc,%esp
+    3742:	68 00 10 00 00       	push   $0x1000
+    3747:	e8 8f 0a 00 00       	call   41db <sbrk>
+    374c:	83 c4 10             	add    $0x10,%esp
+    374f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3758:	8b 03                	mov    (%ebx),%eax
+    375a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    375d:	74 18                	je     3777 <sbrktest+0x267>
+    kill(pids[i]);
+    375f:	83 ec 0c             	sub    $0xc,%esp
+    3762:	50                   	push   %eax
+    3763:	e8 1b 0a 00 00       	call   4183 <kill>
+    wait(&estatus);
+    3768:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+    376f:	e8 e7 09 00 00       	call   415b <wait>
+    3774:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3777:	83 c3 04             	add    $0x4,%ebx
+    377a:	39 f3                	cmp    %esi,%ebx
+    377c:	75 da                	jne    3758 <sbrktest+0x248>
+  if(c == (char*)0xffffffff){
+    377e:	83 ff ff             	cmp    $0xffffffff,%edi
+    3781:	0f 84 7c 01 00 00    	je     3903 <sbrktest+0x3f3>
+  if(sbrk(0) > oldbrk)
+    3787:	83 ec 0c             	sub    $0xc,%esp
+    378a:	6a 00                	push   $0x0
+    378c:	e8 4a 0a 00 00       	call   41db <sbrk>
+    3791:	83 c4 10             	add    $0x10,%esp
+    3794:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3797:	72 69                	jb     3802 <sbrktest+0x2f2>
+  printf(stdout, "sbrk test OK\n");
+    3799:	83 ec 08             	sub    $0x8,%esp
+    379c:	68 78 56 00 00       	push   $0x5678
+    37a1:	ff 35 a0 69 00 00    	push   0x69a0
+    37a7:	e8 84 0b 00 00       	call   4330 <printf>
+}
+    37ac:	83 c4 10             	add    $0x10,%esp
+    37af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    37b2:	5b                   	pop    %ebx
+    37b3:	5e                   	pop    %esi
+    37b4:	5f                   	pop    %edi
+    37b5:	5d                   	pop    %ebp
+    37b6:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    37b7:	83 ec 0c             	sub    $0xc,%esp
+    37ba:	6a 00                	push   $0x0
+    37bc:	e8 1a 0a 00 00       	call   41db <sbrk>
+    37c1:	89 c2                	mov    %eax,%edx
+    37c3:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    37c8:	29 d0                	sub    %edx,%eax
+    37ca:	89 04 24             	mov    %eax,(%esp)
+    37cd:	e8 09 0a 00 00       	call   41db <sbrk>
+      write(fds[1], "x", 1);
+    37d2:	83 c4 0c             	add    $0xc,%esp
+    37d5:	6a 01                	push   $0x1
+    37d7:	68 39 51 00 00       	push   $0x5139
+    37dc:	ff 75 bc             	push   -0x44(%ebp)
+    37df:	e8 8f 09 00 00       	call   4173 <write>
+    37e4:	83 c4 10             	add    $0x10,%esp
+    37e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37ee:	66 90                	xchg   %ax,%ax
+      for(;;) sleep(1000);
+    37f0:	83 ec 0c             	sub    $0xc,%esp
+    37f3:	68 e8 03 00 00       	push   $0x3e8
+    37f8:	e8 e6 09 00 00       	call   41e3 <sleep>
+    37fd:	83 c4 10             	add    $0x10,%esp
+    3800:	eb ee                	jmp    37f0 <sbrktest+0x2e0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3802:	83 ec 0c             	sub    $0xc,%esp
+    3805:	6a 00                	push   $0x0
+    3807:	e8 cf 09 00 00       	call   41db <sbrk>
+    380c:	89 c2                	mov    %eax,%edx
+    380e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3811:	29 d0                	sub    %edx,%eax
+    3813:	89 04 24             	mov    %eax,(%esp)
+    3816:	e8 c0 09 00 00       	call   41db <sbrk>
+    381b:	83 c4 10             	add    $0x10,%esp
+    381e:	e9 76 ff ff ff       	jmp    3799 <sbrktest+0x289>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3823:	83 ec 0c             	sub    $0xc,%esp
+    3826:	50                   	push   %eax
+    3827:	53                   	push   %ebx
+    3828:	56                   	push   %esi
+    3829:	68 db 55 00 00       	push   $0x55db
+    382e:	ff 35 a0 69 00 00    	push   0x69a0
+    3834:	e8 f7 0a 00 00       	call   4330 <printf>
+      exit(1);
+    3839:	83 c4 14             	add    $0x14,%esp
+    383c:	6a 01                	push   $0x1
+    383e:	e8 10 09 00 00       	call   4153 <exit>
+      printf(stdout, "fork failed\n");
+    3843:	83 ec 08             	sub    $0x8,%esp
+    3846:	68 21 57 00 00       	push   $0x5721
+    384b:	ff 35 a0 69 00 00    	push   0x69a0
+    3851:	e8 da 0a 00 00       	call   4330 <printf>
+      exit(1);
+    3856:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    385d:	e8 f1 08 00 00       	call   4153 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3862:	0f be 03             	movsbl (%ebx),%eax
+    3865:	50                   	push   %eax
+    3866:	53                   	push   %ebx
+    3867:	68 44 56 00 00       	push   $0x5644
+    386c:	ff 35 a0 69 00 00    	push   0x69a0
+    3872:	e8 b9 0a 00 00       	call   4330 <printf>
+      kill(ppid);
+    3877:	89 34 24             	mov    %esi,(%esp)
+    387a:	e8 04 09 00 00       	call   4183 <kill>
+      exit(1);
+    387f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3886:	e8 c8 08 00 00       	call   4153 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    388b:	50                   	push   %eax
+    388c:	53                   	push   %ebx
+    388d:	68 78 5e 00 00       	push   $0x5e78
+    3892:	ff 35 a0 69 00 00    	push   0x69a0
+    3898:	e8 93 0a 00 00       	call   4330 <printf>
+    exit(1);
+    389d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    38a4:	e8 aa 08 00 00       	call   4153 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    38a9:	56                   	push   %esi
+    38aa:	56                   	push   %esi
+    38ab:	68 a8 5d 00 00       	push   $0x5da8
+    38b0:	ff 35 a0 69 00 00    	push   0x69a0
+    38b6:	e8 75 0a 00 00       	call   4330 <printf>
+    exit(1);
+    38bb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    38c2:	e8 8c 08 00 00       	call   4153 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    38c7:	50                   	push   %eax
+    38c8:	50                   	push   %eax
+    38c9:	68 f6 55 00 00       	push   $0x55f6
+    38ce:	ff 35 a0 69 00 00    	push   0x69a0
+    38d4:	e8 57 0a 00 00       	call   4330 <printf>
+    exit(1);
+    38d9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    38e0:	e8 6e 08 00 00       	call   4153 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    38e5:	51                   	push   %ecx
+    38e6:	51                   	push   %ecx
+    38e7:	68 48 5e 00 00       	push   $0x5e48
+    38ec:	ff 35 a0 69 00 00    	push   0x69a0
+    38f2:	e8 39 0a 00 00       	call   4330 <printf>
+    exit(1);
+    38f7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    38fe:	e8 50 08 00 00       	call   4153 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3903:	50                   	push   %eax
+    3904:	50                   	push   %eax
+    3905:	68 5d 56 00 00       	push   $0x565d
+    390a:	ff 35 a0 69 00 00    	push   0x69a0
+    3910:	e8 1b 0a 00 00       	call   4330 <printf>
+    exit(1);
+    3915:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    391c:	e8 32 08 00 00       	call   4153 <exit>
+    printf(1, "pipe() failed\n");
+    3921:	52                   	push   %edx
+    3922:	52                   	push   %edx
+    3923:	68 19 4b 00 00       	push   $0x4b19
+    3928:	6a 01                	push   $0x1
+    392a:	e8 01 0a 00 00       	call   4330 <printf>
+    exit(1);
+    392f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3936:	e8 18 08 00 00       	call   4153 <exit>
+    exit(0);
+    393b:	83 ec 0c             	sub    $0xc,%esp
+    393e:	6a 00                	push   $0x0
+    3940:	e8 0e 08 00 00       	call   4153 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3945:	57                   	push   %edi
+    3946:	57                   	push   %edi
+    3947:	68 0d 56 00 00       	push   $0x560d
+    394c:	ff 35 a0 69 00 00    	push   0x69a0
+    3952:	e8 d9 09 00 00       	call   4330 <printf>
+    exit(1);
+    3957:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    395e:	e8 f0 07 00 00       	call   4153 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3963:	56                   	push   %esi
+    3964:	53                   	push   %ebx
+    3965:	68 20 5e 00 00       	push   $0x5e20
+    396a:	ff 35 a0 69 00 00    	push   0x69a0
+    3970:	e8 bb 09 00 00       	call   4330 <printf>
+    exit(1);
+    3975:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    397c:	e8 d2 07 00 00       	call   4153 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3981:	50                   	push   %eax
+    3982:	53                   	push   %ebx
+    3983:	68 e8 5d 00 00       	push   $0x5de8
+    3988:	ff 35 a0 69 00 00    	push   0x69a0
+    398e:	e8 9d 09 00 00       	call   4330 <printf>
+    exit(1);
+    3993:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    399a:	e8 b4 07 00 00       	call   4153 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    399f:	53                   	push   %ebx
+    39a0:	53                   	push   %ebx
+    39a1:	68 29 56 00 00       	push   $0x5629
+    39a6:	ff 35 a0 69 00 00    	push   0x69a0
+    39ac:	e8 7f 09 00 00       	call   4330 <printf>
+    exit(1);
+    39b1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    39b8:	e8 96 07 00 00       	call   4153 <exit>
+    39bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000039c0 <validateint>:
+}
+    39c0:	c3                   	ret
+    39c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39cf:	90                   	nop
+
+000039d0 <validatetest>:
+{
+    39d0:	55                   	push   %ebp
+    39d1:	89 e5                	mov    %esp,%ebp
+    39d3:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    39d4:	31 f6                	xor    %esi,%esi
+{
+    39d6:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    39d7:	83 ec 08             	sub    $0x8,%esp
+    39da:	68 86 56 00 00       	push   $0x5686
+    39df:	ff 35 a0 69 00 00    	push   0x69a0
+    39e5:	e8 46 09 00 00       	call   4330 <printf>
+    39ea:	83 c4 10             	add    $0x10,%esp
+    39ed:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    39f0:	e8 56 07 00 00       	call   414b <fork>
+    39f5:	89 c3                	mov    %eax,%ebx
+    39f7:	85 c0                	test   %eax,%eax
+    39f9:	74 6a                	je     3a65 <validatetest+0x95>
+    sleep(0);
+    39fb:	83 ec 0c             	sub    $0xc,%esp
+    39fe:	6a 00                	push   $0x0
+    3a00:	e8 de 07 00 00       	call   41e3 <sleep>
+    sleep(0);
+    3a05:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3a0c:	e8 d2 07 00 00       	call   41e3 <sleep>
+    kill(pid);
+    3a11:	89 1c 24             	mov    %ebx,(%esp)
+    3a14:	e8 6a 07 00 00       	call   4183 <kill>
+    wait(&estatus);
+    3a19:	c7 04 24 d0 90 00 00 	movl   $0x90d0,(%esp)
+    3a20:	e8 36 07 00 00       	call   415b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3a25:	58                   	pop    %eax
+    3a26:	5a                   	pop    %edx
+    3a27:	56                   	push   %esi
+    3a28:	68 95 56 00 00       	push   $0x5695
+    3a2d:	e8 81 07 00 00       	call   41b3 <link>
+    3a32:	83 c4 10             	add    $0x10,%esp
+    3a35:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3a38:	75 35                	jne    3a6f <validatetest+0x9f>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3a3a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3a40:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    3a46:	75 a8                	jne    39f0 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    3a48:	83 ec 08             	sub    $0x8,%esp
+    3a4b:	68 b9 56 00 00       	push   $0x56b9
+    3a50:	ff 35 a0 69 00 00    	push   0x69a0
+    3a56:	e8 d5 08 00 00       	call   4330 <printf>
+}
+    3a5b:	83 c4 10             	add    $0x10,%esp
+    3a5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3a61:	5b                   	pop    %ebx
+    3a62:	5e                   	pop    %esi
+    3a63:	5d                   	pop    %ebp
+    3a64:	c3                   	ret
+      exit(0);
+    3a65:	83 ec 0c             	sub    $0xc,%esp
+    3a68:	6a 00                	push   $0x0
+    3a6a:	e8 e4 06 00 00       	call   4153 <exit>
+      printf(stdout, "link should not succeed\n");
+    3a6f:	83 ec 08             	sub    $0x8,%esp
+    3a72:	68 a0 56 00 00       	push   $0x56a0
+    3a77:	ff 35 a0 69 00 00    	push   0x69a0
+    3a7d:	e8 ae 08 00 00       	call   4330 <printf>
+      exit(1);
+    3a82:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3a89:	e8 c5 06 00 00       	call   4153 <exit>
+    3a8e:	66 90                	xchg   %ax,%ax
+
+00003a90 <bsstest>:
+{
+    3a90:	55                   	push   %ebp
+    3a91:	89 e5                	mov    %esp,%ebp
+    3a93:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3a96:	68 c6 56 00 00       	push   $0x56c6
+    3a9b:	ff 35 a0 69 00 00    	push   0x69a0
+    3aa1:	e8 8a 08 00 00       	call   4330 <printf>
+    3aa6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3aa9:	31 c0                	xor    %eax,%eax
+    3aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3aaf:	90                   	nop
+    if(uninit[i] != '\0'){
+    3ab0:	80 b8 c0 69 00 00 00 	cmpb   $0x0,0x69c0(%eax)
+    3ab7:	75 22                	jne    3adb <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3ab9:	83 c0 01             	add    $0x1,%eax
+    3abc:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3ac1:	75 ed                	jne    3ab0 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3ac3:	83 ec 08             	sub    $0x8,%esp
+    3ac6:	68 e1 56 00 00       	push   $0x56e1
+    3acb:	ff 35 a0 69 00 00    	push   0x69a0
+    3ad1:	e8 5a 08 00 00       	call   4330 <printf>
+}
+    3ad6:	83 c4 10             	add    $0x10,%esp
+    3ad9:	c9                   	leave
+    3ada:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    3adb:	83 ec 08             	sub    $0x8,%esp
+    3ade:	68 d0 56 00 00       	push   $0x56d0
+    3ae3:	ff 35 a0 69 00 00    	push   0x69a0
+    3ae9:	e8 42 08 00 00       	call   4330 <printf>
+      exit(1);
+    3aee:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3af5:	e8 59 06 00 00       	call   4153 <exit>
+    3afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003b00 <bigargtest>:
+{
+    3b00:	55                   	push   %ebp
+    3b01:	89 e5                	mov    %esp,%ebp
+    3b03:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3b06:	68 ee 56 00 00       	push   $0x56ee
+    3b0b:	e8 93 06 00 00       	call   41a3 <unlink>
+  pid = fork();
+    3b10:	e8 36 06 00 00       	call   414b <fork>
+  if(pid == 0){
+    3b15:	83 c4 10             	add    $0x10,%esp
+    3b18:	85 c0                	test   %eax,%eax
+    3b1a:	74 4c                	je     3b68 <bigargtest+0x68>
+  } else if(pid < 0){
+    3b1c:	0f 88 d6 00 00 00    	js     3bf8 <bigargtest+0xf8>
+  wait(&estatus);
+    3b22:	83 ec 0c             	sub    $0xc,%esp
+    3b25:	68 d0 90 00 00       	push   $0x90d0
+    3b2a:	e8 2c 06 00 00       	call   415b <wait>
+  fd = open("bigarg-ok", 0);
+    3b2f:	5a                   	pop    %edx
+    3b30:	59                   	pop    %ecx
+    3b31:	6a 00                	push   $0x0
+    3b33:	68 ee 56 00 00       	push   $0x56ee
+    3b38:	e8 56 06 00 00       	call   4193 <open>
+  if(fd < 0){
+    3b3d:	83 c4 10             	add    $0x10,%esp
+    3b40:	85 c0                	test   %eax,%eax
+    3b42:	0f 88 92 00 00 00    	js     3bda <bigargtest+0xda>
+  close(fd);
+    3b48:	83 ec 0c             	sub    $0xc,%esp
+    3b4b:	50                   	push   %eax
+    3b4c:	e8 2a 06 00 00       	call   417b <close>
+  unlink("bigarg-ok");
+    3b51:	c7 04 24 ee 56 00 00 	movl   $0x56ee,(%esp)
+    3b58:	e8 46 06 00 00       	call   41a3 <unlink>
+}
+    3b5d:	83 c4 10             	add    $0x10,%esp
+    3b60:	c9                   	leave
+    3b61:	c3                   	ret
+    3b62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3b68:	c7 04 85 e0 b0 00 00 	movl   $0x5e9c,0xb0e0(,%eax,4)
+    3b6f:	9c 5e 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3b73:	83 c0 01             	add    $0x1,%eax
+    3b76:	83 f8 1f             	cmp    $0x1f,%eax
+    3b79:	75 ed                	jne    3b68 <bigargtest+0x68>
+    args[MAXARG-1] = 0;
+    3b7b:	31 c0                	xor    %eax,%eax
+    3b7d:	a3 5c b1 00 00       	mov    %eax,0xb15c
+    printf(stdout, "bigarg test\n");
+    3b82:	50                   	push   %eax
+    3b83:	50                   	push   %eax
+    3b84:	68 f8 56 00 00       	push   $0x56f8
+    3b89:	ff 35 a0 69 00 00    	push   0x69a0
+    3b8f:	e8 9c 07 00 00       	call   4330 <printf>
+    exec("echo", args);
+    3b94:	58                   	pop    %eax
+    3b95:	5a                   	pop    %edx
+    3b96:	68 e0 b0 00 00       	push   $0xb0e0
+    3b9b:	68 1d 48 00 00       	push   $0x481d
+    3ba0:	e8 e6 05 00 00       	call   418b <exec>
+    printf(stdout, "bigarg test ok\n");
+    3ba5:	59                   	pop    %ecx
+    3ba6:	58                   	pop    %eax
+    3ba7:	68 05 57 00 00       	push   $0x5705
+    3bac:	ff 35 a0 69 00 00    	push   0x69a0
+    3bb2:	e8 79 07 00 00       	call   4330 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3bb7:	58                   	pop    %eax
+    3bb8:	5a                   	pop    %edx
+    3bb9:	68 00 02 00 00       	push   $0x200
+    3bbe:	68 ee 56 00 00       	push   $0x56ee
+    3bc3:	e8 cb 05 00 00       	call   4193 <open>
+    close(fd);
+    3bc8:	89 04 24             	mov    %eax,(%esp)
+    3bcb:	e8 ab 05 00 00       	call   417b <close>
+    exit(0);
+    3bd0:	31 c9                	xor    %ecx,%ecx
+    3bd2:	89 0c 24             	mov    %ecx,(%esp)
+    3bd5:	e8 79 05 00 00       	call   4153 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    3bda:	50                   	push   %eax
+    3bdb:	50                   	push   %eax
+    3bdc:	68 2e 57 00 00       	push   $0x572e
+    3be1:	ff 35 a0 69 00 00    	push   0x69a0
+    3be7:	e8 44 07 00 00       	call   4330 <printf>
+    exit(1);
+    3bec:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3bf3:	e8 5b 05 00 00       	call   4153 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3bf8:	50                   	push   %eax
+    3bf9:	50                   	push   %eax
+    3bfa:	68 15 57 00 00       	push   $0x5715
+    3bff:	ff 35 a0 69 00 00    	push   0x69a0
+    3c05:	e8 26 07 00 00       	call   4330 <printf>
+    exit(1);
+    3c0a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3c11:	e8 3d 05 00 00       	call   4153 <exit>
+    3c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003c20 <fsfull>:
+{
+    3c20:	55                   	push   %ebp
+    3c21:	89 e5                	mov    %esp,%ebp
+    3c23:	57                   	push   %edi
+    3c24:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    3c25:	31 f6                	xor    %esi,%esi
+{
+    3c27:	53                   	push   %ebx
+    3c28:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    3c2b:	68 43 57 00 00       	push   $0x5743
+    3c30:	6a 01                	push   $0x1
+    3c32:	e8 f9 06 00 00       	call   4330 <printf>
+    3c37:	83 c4 10             	add    $0x10,%esp
+    3c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3c40:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3c45:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    3c4a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    3c4d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3c51:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    3c53:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3c57:	c1 ea 06             	shr    $0x6,%edx
+    3c5a:	8d 42 30             	lea    0x30(%edx),%eax
+    3c5d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3c60:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    3c66:	89 f2                	mov    %esi,%edx
+    3c68:	29 c2                	sub    %eax,%edx
+    3c6a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    3c6f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3c71:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3c76:	c1 ea 05             	shr    $0x5,%edx
+    3c79:	83 c2 30             	add    $0x30,%edx
+    3c7c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3c7f:	f7 e6                	mul    %esi
+    3c81:	c1 ea 05             	shr    $0x5,%edx
+    3c84:	6b c2 64             	imul   $0x64,%edx,%eax
+    3c87:	89 f2                	mov    %esi,%edx
+    3c89:	29 c2                	sub    %eax,%edx
+    3c8b:	89 d0                	mov    %edx,%eax
+    3c8d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3c8f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3c91:	c1 ea 03             	shr    $0x3,%edx
+    3c94:	83 c2 30             	add    $0x30,%edx
+    3c97:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3c9a:	f7 e1                	mul    %ecx
+    3c9c:	89 f0                	mov    %esi,%eax
+    3c9e:	c1 ea 03             	shr    $0x3,%edx
+    3ca1:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3ca4:	01 d2                	add    %edx,%edx
+    3ca6:	29 d0                	sub    %edx,%eax
+    3ca8:	83 c0 30             	add    $0x30,%eax
+    3cab:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    3cae:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3cb1:	50                   	push   %eax
+    3cb2:	68 50 57 00 00       	push   $0x5750
+    3cb7:	6a 01                	push   $0x1
+    3cb9:	e8 72 06 00 00       	call   4330 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    3cbe:	58                   	pop    %eax
+    3cbf:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3cc2:	5a                   	pop    %edx
+    3cc3:	68 02 02 00 00       	push   $0x202
+    3cc8:	50                   	push   %eax
+    3cc9:	e8 c5 04 00 00       	call   4193 <open>
+    if(fd < 0){
+    3cce:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3cd1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3cd3:	85 c0                	test   %eax,%eax
+    3cd5:	78 4f                	js     3d26 <fsfull+0x106>
+    int total = 0;
+    3cd7:	31 db                	xor    %ebx,%ebx
+    3cd9:	eb 07                	jmp    3ce2 <fsfull+0xc2>
+    3cdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3cdf:	90                   	nop
+      total += cc;
+    3ce0:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    3ce2:	83 ec 04             	sub    $0x4,%esp
+    3ce5:	68 00 02 00 00       	push   $0x200
+    3cea:	68 e0 90 00 00       	push   $0x90e0
+    3cef:	57                   	push   %edi
+    3cf0:	e8 7e 04 00 00       	call   4173 <write>
+      if(cc < 512)
+    3cf5:	83 c4 10             	add    $0x10,%esp
+    3cf8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    3cfd:	7f e1                	jg     3ce0 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    3cff:	83 ec 04             	sub    $0x4,%esp
+    3d02:	53                   	push   %ebx
+    3d03:	68 6c 57 00 00       	push   $0x576c
+    3d08:	6a 01                	push   $0x1
+    3d0a:	e8 21 06 00 00       	call   4330 <printf>
+    close(fd);
+    3d0f:	89 3c 24             	mov    %edi,(%esp)
+    3d12:	e8 64 04 00 00       	call   417b <close>
+    if(total == 0)
+    3d17:	83 c4 10             	add    $0x10,%esp
+    3d1a:	85 db                	test   %ebx,%ebx
+    3d1c:	74 1e                	je     3d3c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    3d1e:	83 c6 01             	add    $0x1,%esi
+    3d21:	e9 1a ff ff ff       	jmp    3c40 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    3d26:	83 ec 04             	sub    $0x4,%esp
+    3d29:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3d2c:	50                   	push   %eax
+    3d2d:	68 5c 57 00 00       	push   $0x575c
+    3d32:	6a 01                	push   $0x1
+    3d34:	e8 f7 05 00 00       	call   4330 <printf>
+      break;
+    3d39:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    3d3c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3d41:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    3d46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d4d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3d50:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    3d52:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    3d55:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3d59:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    3d5b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3d5f:	c1 ea 06             	shr    $0x6,%edx
+    3d62:	8d 42 30             	lea    0x30(%edx),%eax
+    3d65:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3d68:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    3d6e:	89 f2                	mov    %esi,%edx
+    3d70:	29 c2                	sub    %eax,%edx
+    3d72:	89 d0                	mov    %edx,%eax
+    3d74:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3d76:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3d78:	c1 ea 05             	shr    $0x5,%edx
+    3d7b:	83 c2 30             	add    $0x30,%edx
+    3d7e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3d81:	f7 e3                	mul    %ebx
+    3d83:	c1 ea 05             	shr    $0x5,%edx
+    3d86:	6b ca 64             	imul   $0x64,%edx,%ecx
+    3d89:	89 f2                	mov    %esi,%edx
+    3d8b:	29 ca                	sub    %ecx,%edx
+    3d8d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    3d92:	89 d0                	mov    %edx,%eax
+    3d94:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3d96:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3d98:	c1 ea 03             	shr    $0x3,%edx
+    3d9b:	83 c2 30             	add    $0x30,%edx
+    3d9e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3da1:	f7 e1                	mul    %ecx
+    3da3:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3da5:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3da8:	c1 ea 03             	shr    $0x3,%edx
+    3dab:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3dae:	01 d2                	add    %edx,%edx
+    3db0:	29 d0                	sub    %edx,%eax
+    3db2:	83 c0 30             	add    $0x30,%eax
+    3db5:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3db8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3dbb:	50                   	push   %eax
+    3dbc:	e8 e2 03 00 00       	call   41a3 <unlink>
+  while(nfiles >= 0){
+    3dc1:	83 c4 10             	add    $0x10,%esp
+    3dc4:	83 fe ff             	cmp    $0xffffffff,%esi
+    3dc7:	75 87                	jne    3d50 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3dc9:	83 ec 08             	sub    $0x8,%esp
+    3dcc:	68 7c 57 00 00       	push   $0x577c
+    3dd1:	6a 01                	push   $0x1
+    3dd3:	e8 58 05 00 00       	call   4330 <printf>
+}
+    3dd8:	83 c4 10             	add    $0x10,%esp
+    3ddb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3dde:	5b                   	pop    %ebx
+    3ddf:	5e                   	pop    %esi
+    3de0:	5f                   	pop    %edi
+    3de1:	5d                   	pop    %ebp
+    3de2:	c3                   	ret
+    3de3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3dea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003df0 <uio>:
+{
+    3df0:	55                   	push   %ebp
+    3df1:	89 e5                	mov    %esp,%ebp
+    3df3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    3df6:	68 92 57 00 00       	push   $0x5792
+    3dfb:	6a 01                	push   $0x1
+    3dfd:	e8 2e 05 00 00       	call   4330 <printf>
+  pid = fork();
+    3e02:	e8 44 03 00 00       	call   414b <fork>
+  if(pid == 0){
+    3e07:	83 c4 10             	add    $0x10,%esp
+    3e0a:	85 c0                	test   %eax,%eax
+    3e0c:	74 22                	je     3e30 <uio+0x40>
+  } else if(pid < 0){
+    3e0e:	78 4b                	js     3e5b <uio+0x6b>
+  wait(&estatus);
+    3e10:	83 ec 0c             	sub    $0xc,%esp
+    3e13:	68 d0 90 00 00       	push   $0x90d0
+    3e18:	e8 3e 03 00 00       	call   415b <wait>
+  printf(1, "uio test done\n");
+    3e1d:	58                   	pop    %eax
+    3e1e:	5a                   	pop    %edx
+    3e1f:	68 9c 57 00 00       	push   $0x579c
+    3e24:	6a 01                	push   $0x1
+    3e26:	e8 05 05 00 00       	call   4330 <printf>
+}
+    3e2b:	83 c4 10             	add    $0x10,%esp
+    3e2e:	c9                   	leave
+    3e2f:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    3e30:	b8 09 00 00 00       	mov    $0x9,%eax
+    3e35:	ba 70 00 00 00       	mov    $0x70,%edx
+    3e3a:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    3e3b:	ba 71 00 00 00       	mov    $0x71,%edx
+    3e40:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    3e41:	50                   	push   %eax
+    3e42:	50                   	push   %eax
+    3e43:	68 7c 5f 00 00       	push   $0x5f7c
+    3e48:	6a 01                	push   $0x1
+    3e4a:	e8 e1 04 00 00       	call   4330 <printf>
+    exit(1);
+    3e4f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3e56:	e8 f8 02 00 00       	call   4153 <exit>
+    printf (1, "fork failed\n");
+    3e5b:	51                   	push   %ecx
+    3e5c:	51                   	push   %ecx
+    3e5d:	68 21 57 00 00       	push   $0x5721
+    3e62:	6a 01                	push   $0x1
+    3e64:	e8 c7 04 00 00       	call   4330 <printf>
+    exit(1);
+    3e69:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3e70:	e8 de 02 00 00       	call   4153 <exit>
+    3e75:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003e80 <argptest>:
+{
+    3e80:	55                   	push   %ebp
+    3e81:	89 e5                	mov    %esp,%ebp
+    3e83:	53                   	push   %ebx
+    3e84:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    3e87:	6a 00                	push   $0x0
+    3e89:	68 ab 57 00 00       	push   $0x57ab
+    3e8e:	e8 00 03 00 00       	call   4193 <open>
+  if (fd < 0) {
+    3e93:	83 c4 10             	add    $0x10,%esp
+    3e96:	85 c0                	test   %eax,%eax
+    3e98:	78 39                	js     3ed3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    3e9a:	83 ec 0c             	sub    $0xc,%esp
+    3e9d:	89 c3                	mov    %eax,%ebx
+    3e9f:	6a 00                	push   $0x0
+    3ea1:	e8 35 03 00 00       	call   41db <sbrk>
+    3ea6:	83 c4 0c             	add    $0xc,%esp
+    3ea9:	83 e8 01             	sub    $0x1,%eax
+    3eac:	6a ff                	push   $0xffffffff
+    3eae:	50                   	push   %eax
+    3eaf:	53                   	push   %ebx
+    3eb0:	e8 b6 02 00 00       	call   416b <read>
+  close(fd);
+    3eb5:	89 1c 24             	mov    %ebx,(%esp)
+    3eb8:	e8 be 02 00 00       	call   417b <close>
+  printf(1, "arg test passed\n");
+    3ebd:	58                   	pop    %eax
+    3ebe:	5a                   	pop    %edx
+    3ebf:	68 bd 57 00 00       	push   $0x57bd
+    3ec4:	6a 01                	push   $0x1
+    3ec6:	e8 65 04 00 00       	call   4330 <printf>
+}
+    3ecb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3ece:	83 c4 10             	add    $0x10,%esp
+    3ed1:	c9                   	leave
+    3ed2:	c3                   	ret
+    printf(2, "open failed\n");
+    3ed3:	51                   	push   %ecx
+    3ed4:	51                   	push   %ecx
+    3ed5:	68 b0 57 00 00       	push   $0x57b0
+    3eda:	6a 02                	push   $0x2
+    3edc:	e8 4f 04 00 00       	call   4330 <printf>
+    exit(1);
+    3ee1:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    3ee8:	e8 66 02 00 00       	call   4153 <exit>
+    3eed:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003ef0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    3ef0:	69 05 9c 69 00 00 0d 	imul   $0x19660d,0x699c,%eax
+    3ef7:	66 19 00 
+    3efa:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    3eff:	a3 9c 69 00 00       	mov    %eax,0x699c
+}
+    3f04:	c3                   	ret
+    3f05:	66 90                	xchg   %ax,%ax
+    3f07:	66 90                	xchg   %ax,%ax
+    3f09:	66 90                	xchg   %ax,%ax
+    3f0b:	66 90                	xchg   %ax,%ax
+    3f0d:	66 90                	xchg   %ax,%ax
+    3f0f:	90                   	nop
+
+00003f10 <strcpy>:
+#include "kernel/x86.h"
+#include "user.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    3f10:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    3f11:	31 c0                	xor    %eax,%eax
+{
+    3f13:	89 e5                	mov    %esp,%ebp
+    3f15:	53                   	push   %ebx
+    3f16:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    3f19:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    3f1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    3f20:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    3f24:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    3f27:	83 c0 01             	add    $0x1,%eax
+    3f2a:	84 d2                	test   %dl,%dl
+    3f2c:	75 f2                	jne    3f20 <strcpy+0x10>
+    ;
+  return os;
+}
+    3f2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3f31:	89 c8                	mov    %ecx,%eax
+    3f33:	c9                   	leave
+    3f34:	c3                   	ret
+    3f35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003f40 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    3f40:	55                   	push   %ebp
+    3f41:	89 e5                	mov    %esp,%ebp
+    3f43:	53                   	push   %ebx
+    3f44:	8b 55 08             	mov    0x8(%ebp),%edx
+    3f47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    3f4a:	0f b6 02             	movzbl (%edx),%eax
+    3f4d:	84 c0                	test   %al,%al
+    3f4f:	75 17                	jne    3f68 <strcmp+0x28>
+    3f51:	eb 3a                	jmp    3f8d <strcmp+0x4d>
+    3f53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3f57:	90                   	nop
+    3f58:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    3f5c:	83 c2 01             	add    $0x1,%edx
+    3f5f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    3f62:	84 c0                	test   %al,%al
+    3f64:	74 1a                	je     3f80 <strcmp+0x40>
+    p++, q++;
+    3f66:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    3f68:	0f b6 19             	movzbl (%ecx),%ebx
+    3f6b:	38 c3                	cmp    %al,%bl
+    3f6d:	74 e9                	je     3f58 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    3f6f:	29 d8                	sub    %ebx,%eax
+}
+    3f71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3f74:	c9                   	leave
+    3f75:	c3                   	ret
+    3f76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f7d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    3f80:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    3f84:	31 c0                	xor    %eax,%eax
+    3f86:	29 d8                	sub    %ebx,%eax
+}
+    3f88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3f8b:	c9                   	leave
+    3f8c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    3f8d:	0f b6 19             	movzbl (%ecx),%ebx
+    3f90:	31 c0                	xor    %eax,%eax
+    3f92:	eb db                	jmp    3f6f <strcmp+0x2f>
+    3f94:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3f9f:	90                   	nop
+
+00003fa0 <strlen>:
+
+uint
+strlen(char *s)
+{
+    3fa0:	55                   	push   %ebp
+    3fa1:	89 e5                	mov    %esp,%ebp
+    3fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    3fa6:	80 3a 00             	cmpb   $0x0,(%edx)
+    3fa9:	74 15                	je     3fc0 <strlen+0x20>
+    3fab:	31 c0                	xor    %eax,%eax
+    3fad:	8d 76 00             	lea    0x0(%esi),%esi
+    3fb0:	83 c0 01             	add    $0x1,%eax
+    3fb3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    3fb7:	89 c1                	mov    %eax,%ecx
+    3fb9:	75 f5                	jne    3fb0 <strlen+0x10>
+    ;
+  return n;
+}
+    3fbb:	89 c8                	mov    %ecx,%eax
+    3fbd:	5d                   	pop    %ebp
+    3fbe:	c3                   	ret
+    3fbf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    3fc0:	31 c9                	xor    %ecx,%ecx
+}
+    3fc2:	5d                   	pop    %ebp
+    3fc3:	89 c8                	mov    %ecx,%eax
+    3fc5:	c3                   	ret
+    3fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003fd0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    3fd0:	55                   	push   %ebp
+    3fd1:	89 e5                	mov    %esp,%ebp
+    3fd3:	57                   	push   %edi
+    3fd4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    3fd7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    3fda:	8b 45 0c             	mov    0xc(%ebp),%eax
+    3fdd:	89 d7                	mov    %edx,%edi
+    3fdf:	fc                   	cld
+    3fe0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    3fe2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    3fe5:	89 d0                	mov    %edx,%eax
+    3fe7:	c9                   	leave
+    3fe8:	c3                   	ret
+    3fe9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003ff0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    3ff0:	55                   	push   %ebp
+    3ff1:	89 e5                	mov    %esp,%ebp
+    3ff3:	8b 45 08             	mov    0x8(%ebp),%eax
+    3ff6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    3ffa:	0f b6 10             	movzbl (%eax),%edx
+    3ffd:	84 d2                	test   %dl,%dl
+    3fff:	75 12                	jne    4013 <strchr+0x23>
+    4001:	eb 1d                	jmp    4020 <strchr+0x30>
+    4003:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4007:	90                   	nop
+    4008:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    400c:	83 c0 01             	add    $0x1,%eax
+    400f:	84 d2                	test   %dl,%dl
+    4011:	74 0d                	je     4020 <strchr+0x30>
+    if(*s == c)
+    4013:	38 d1                	cmp    %dl,%cl
+    4015:	75 f1                	jne    4008 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4017:	5d                   	pop    %ebp
+    4018:	c3                   	ret
+    4019:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4020:	31 c0                	xor    %eax,%eax
+}
+    4022:	5d                   	pop    %ebp
+    4023:	c3                   	ret
+    4024:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    402b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    402f:	90                   	nop
+
+00004030 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4030:	55                   	push   %ebp
+    4031:	89 e5                	mov    %esp,%ebp
+    4033:	57                   	push   %edi
+    4034:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    4035:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    4038:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    4039:	31 db                	xor    %ebx,%ebx
+{
+    403b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    403e:	eb 27                	jmp    4067 <gets+0x37>
+    cc = read(0, &c, 1);
+    4040:	83 ec 04             	sub    $0x4,%esp
+    4043:	6a 01                	push   $0x1
+    4045:	56                   	push   %esi
+    4046:	6a 00                	push   $0x0
+    4048:	e8 1e 01 00 00       	call   416b <read>
+    if(cc < 1)
+    404d:	83 c4 10             	add    $0x10,%esp
+    4050:	85 c0                	test   %eax,%eax
+    4052:	7e 1d                	jle    4071 <gets+0x41>
+      break;
+    buf[i++] = c;
+    4054:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    4058:	8b 55 08             	mov    0x8(%ebp),%edx
+    405b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    405f:	3c 0a                	cmp    $0xa,%al
+    4061:	74 10                	je     4073 <gets+0x43>
+    4063:	3c 0d                	cmp    $0xd,%al
+    4065:	74 0c                	je     4073 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    4067:	89 df                	mov    %ebx,%edi
+    4069:	83 c3 01             	add    $0x1,%ebx
+    406c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    406f:	7c cf                	jl     4040 <gets+0x10>
+    4071:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    4073:	8b 45 08             	mov    0x8(%ebp),%eax
+    4076:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    407a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    407d:	5b                   	pop    %ebx
+    407e:	5e                   	pop    %esi
+    407f:	5f                   	pop    %edi
+    4080:	5d                   	pop    %ebp
+    4081:	c3                   	ret
+    4082:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4089:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004090 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    4090:	55                   	push   %ebp
+    4091:	89 e5                	mov    %esp,%ebp
+    4093:	56                   	push   %esi
+    4094:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    4095:	83 ec 08             	sub    $0x8,%esp
+    4098:	6a 00                	push   $0x0
+    409a:	ff 75 08             	push   0x8(%ebp)
+    409d:	e8 f1 00 00 00       	call   4193 <open>
+  if(fd < 0)
+    40a2:	83 c4 10             	add    $0x10,%esp
+    40a5:	85 c0                	test   %eax,%eax
+    40a7:	78 27                	js     40d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    40a9:	83 ec 08             	sub    $0x8,%esp
+    40ac:	ff 75 0c             	push   0xc(%ebp)
+    40af:	89 c3                	mov    %eax,%ebx
+    40b1:	50                   	push   %eax
+    40b2:	e8 f4 00 00 00       	call   41ab <fstat>
+  close(fd);
+    40b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    40ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+    40bc:	e8 ba 00 00 00       	call   417b <close>
+  return r;
+    40c1:	83 c4 10             	add    $0x10,%esp
+}
+    40c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    40c7:	89 f0                	mov    %esi,%eax
+    40c9:	5b                   	pop    %ebx
+    40ca:	5e                   	pop    %esi
+    40cb:	5d                   	pop    %ebp
+    40cc:	c3                   	ret
+    40cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    40d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    40d5:	eb ed                	jmp    40c4 <stat+0x34>
+    40d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    40de:	66 90                	xchg   %ax,%ax
+
+000040e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    40e0:	55                   	push   %ebp
+    40e1:	89 e5                	mov    %esp,%ebp
+    40e3:	53                   	push   %ebx
+    40e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    40e7:	0f be 02             	movsbl (%edx),%eax
+    40ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    40ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    40f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    40f5:	77 1e                	ja     4115 <atoi+0x35>
+    40f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    40fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    4100:	83 c2 01             	add    $0x1,%edx
+    4103:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    4106:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    410a:	0f be 02             	movsbl (%edx),%eax
+    410d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    4110:	80 fb 09             	cmp    $0x9,%bl
+    4113:	76 eb                	jbe    4100 <atoi+0x20>
+  return n;
+}
+    4115:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4118:	89 c8                	mov    %ecx,%eax
+    411a:	c9                   	leave
+    411b:	c3                   	ret
+    411c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004120 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    4120:	55                   	push   %ebp
+    4121:	89 e5                	mov    %esp,%ebp
+    4123:	57                   	push   %edi
+    4124:	56                   	push   %esi
+    4125:	8b 45 10             	mov    0x10(%ebp),%eax
+    4128:	8b 55 08             	mov    0x8(%ebp),%edx
+    412b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst, *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    412e:	85 c0                	test   %eax,%eax
+    4130:	7e 13                	jle    4145 <memmove+0x25>
+    4132:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    4134:	89 d7                	mov    %edx,%edi
+    4136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    413d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    4140:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    4141:	39 f8                	cmp    %edi,%eax
+    4143:	75 fb                	jne    4140 <memmove+0x20>
+  return vdst;
+}
+    4145:	5e                   	pop    %esi
+    4146:	89 d0                	mov    %edx,%eax
+    4148:	5f                   	pop    %edi
+    4149:	5d                   	pop    %ebp
+    414a:	c3                   	ret
+
+0000414b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    414b:	b8 01 00 00 00       	mov    $0x1,%eax
+    4150:	cd 40                	int    $0x40
+    4152:	c3                   	ret
+
+00004153 <exit>:
+SYSCALL(exit)
+    4153:	b8 02 00 00 00       	mov    $0x2,%eax
+    4158:	cd 40                	int    $0x40
+    415a:	c3                   	ret
+
+0000415b <wait>:
+SYSCALL(wait)
+    415b:	b8 03 00 00 00       	mov    $0x3,%eax
+    4160:	cd 40                	int    $0x40
+    4162:	c3                   	ret
+
+00004163 <pipe>:
+SYSCALL(pipe)
+    4163:	b8 04 00 00 00       	mov    $0x4,%eax
+    4168:	cd 40                	int    $0x40
+    416a:	c3                   	ret
+
+0000416b <read>:
+SYSCALL(read)
+    416b:	b8 05 00 00 00       	mov    $0x5,%eax
+    4170:	cd 40                	int    $0x40
+    4172:	c3                   	ret
+
+00004173 <write>:
+SYSCALL(write)
+    4173:	b8 10 00 00 00       	mov    $0x10,%eax
+    4178:	cd 40                	int    $0x40
+    417a:	c3                   	ret
+
+0000417b <close>:
+SYSCALL(close)
+    417b:	b8 15 00 00 00       	mov    $0x15,%eax
+    4180:	cd 40                	int    $0x40
+    4182:	c3                   	ret
+
+00004183 <kill>:
+SYSCALL(kill)
+    4183:	b8 06 00 00 00       	mov    $0x6,%eax
+    4188:	cd 40                	int    $0x40
+    418a:	c3                   	ret
+
+0000418b <exec>:
+SYSCALL(exec)
+    418b:	b8 07 00 00 00       	mov    $0x7,%eax
+    4190:	cd 40                	int    $0x40
+    4192:	c3                   	ret
+
+00004193 <open>:
+SYSCALL(open)
+    4193:	b8 0f 00 00 00       	mov    $0xf,%eax
+    4198:	cd 40                	int    $0x40
+    419a:	c3                   	ret
+
+0000419b <mknod>:
+SYSCALL(mknod)
+    419b:	b8 11 00 00 00       	mov    $0x11,%eax
+    41a0:	cd 40                	int    $0x40
+    41a2:	c3                   	ret
+
+000041a3 <unlink>:
+SYSCALL(unlink)
+    41a3:	b8 12 00 00 00       	mov    $0x12,%eax
+    41a8:	cd 40                	int    $0x40
+    41aa:	c3                   	ret
+
+000041ab <fstat>:
+SYSCALL(fstat)
+    41ab:	b8 08 00 00 00       	mov    $0x8,%eax
+    41b0:	cd 40                	int    $0x40
+    41b2:	c3                   	ret
+
+000041b3 <link>:
+SYSCALL(link)
+    41b3:	b8 13 00 00 00       	mov    $0x13,%eax
+    41b8:	cd 40                	int    $0x40
+    41ba:	c3                   	ret
+
+000041bb <mkdir>:
+SYSCALL(mkdir)
+    41bb:	b8 14 00 00 00       	mov    $0x14,%eax
+    41c0:	cd 40                	int    $0x40
+    41c2:	c3                   	ret
+
+000041c3 <chdir>:
+SYSCALL(chdir)
+    41c3:	b8 09 00 00 00       	mov    $0x9,%eax
+    41c8:	cd 40                	int    $0x40
+    41ca:	c3                   	ret
+
+000041cb <dup>:
+SYSCALL(dup)
+    41cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+    41d0:	cd 40                	int    $0x40
+    41d2:	c3                   	ret
+
+000041d3 <getpid>:
+SYSCALL(getpid)
+    41d3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    41d8:	cd 40                	int    $0x40
+    41da:	c3                   	ret
+
+000041db <sbrk>:
+SYSCALL(sbrk)
+    41db:	b8 0c 00 00 00       	mov    $0xc,%eax
+    41e0:	cd 40                	int    $0x40
+    41e2:	c3                   	ret
+
+000041e3 <sleep>:
+SYSCALL(sleep)
+    41e3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    41e8:	cd 40                	int    $0x40
+    41ea:	c3                   	ret
+
+000041eb <uptime>:
+SYSCALL(uptime)
+    41eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    41f0:	cd 40                	int    $0x40
+    41f2:	c3                   	ret
+
+000041f3 <getdate>:
+SYSCALL(getdate)
+    41f3:	b8 16 00 00 00       	mov    $0x16,%eax
+    41f8:	cd 40                	int    $0x40
+    41fa:	c3                   	ret
+
+000041fb <setdate>:
+SYSCALL(setdate)
+    41fb:	b8 17 00 00 00       	mov    $0x17,%eax
+    4200:	cd 40                	int    $0x40
+    4202:	c3                   	ret
+
+00004203 <mount>:
+SYSCALL(mount)
+    4203:	b8 18 00 00 00       	mov    $0x18,%eax
+    4208:	cd 40                	int    $0x40
+    420a:	c3                   	ret
+
+0000420b <unmount>:
+SYSCALL(unmount)
+    420b:	b8 19 00 00 00       	mov    $0x19,%eax
+    4210:	cd 40                	int    $0x40
+    4212:	c3                   	ret
+
+00004213 <lseek>:
+SYSCALL(lseek)
+    4213:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4218:	cd 40                	int    $0x40
+    421a:	c3                   	ret
+
+0000421b <mmap>:
+SYSCALL(mmap)
+    421b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4220:	cd 40                	int    $0x40
+    4222:	c3                   	ret
+
+00004223 <munmap>:
+SYSCALL(munmap)
+    4223:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    4228:	cd 40                	int    $0x40
+    422a:	c3                   	ret
+
+0000422b <clock_gettime>:
+SYSCALL(clock_gettime)
+    422b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    4230:	cd 40                	int    $0x40
+    4232:	c3                   	ret
+
+00004233 <nanosleep>:
+SYSCALL(nanosleep)
+    4233:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    4238:	cd 40                	int    $0x40
+    423a:	c3                   	ret
+
+0000423b <sched_setaffinity>:
+SYSCALL(sched_setaffinity)
+    423b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    4240:	cd 40                	int    $0x40
+    4242:	c3                   	ret
+
+00004243 <sched_getaffinity>:
+SYSCALL(sched_getaffinity)
+    4243:	b8 20 00 00 00       	mov    $0x20,%eax
+    4248:	cd 40                	int    $0x40
+    424a:	c3                   	ret
+
+0000424b <proclimit>:
+SYSCALL(proclimit)
+    424b:	b8 21 00 00 00       	mov    $0x21,%eax
+    4250:	cd 40                	int    $0x40
+    4252:	c3                   	ret
+
+00004253 <procinfo>:
+SYSCALL(procinfo)
+    4253:	b8 22 00 00 00       	mov    $0x22,%eax
+    4258:	cd 40                	int    $0x40
+    425a:	c3                   	ret
+
+0000425b <cpuinfo>:
+SYSCALL(cpuinfo)
+    425b:	b8 23 00 00 00       	mov    $0x23,%eax
+    4260:	cd 40                	int    $0x40
+    4262:	c3                   	ret
+
+00004263 <schedstat>:
+SYSCALL(schedstat)
+    4263:	b8 24 00 00 00       	mov    $0x24,%eax
+    4268:	cd 40                	int    $0x40
+    426a:	c3                   	ret
+
+0000426b <lockstat>:
+SYSCALL(lockstat)
+    426b:	b8 25 00 00 00       	mov    $0x25,%eax
+    4270:	cd 40                	int    $0x40
+    4272:	c3                   	ret
+
+00004273 <bcachestat>:
+SYSCALL(bcachestat)
+    4273:	b8 26 00 00 00       	mov    $0x26,%eax
+    4278:	cd 40                	int    $0x40
+    427a:	c3                   	ret
+
+0000427b <diskstat>:
+SYSCALL(diskstat)
+    427b:	b8 27 00 00 00       	mov    $0x27,%eax
+    4280:	cd 40                	int    $0x40
+    4282:	c3                   	ret
+
+00004283 <iosched>:
+SYSCALL(iosched)
+    4283:	b8 28 00 00 00       	mov    $0x28,%eax
+    4288:	cd 40                	int    $0x40
+    428a:	c3                   	ret
+    428b:	66 90                	xchg   %ax,%ax
+    428d:	66 90                	xchg   %ax,%ax
+    428f:	90                   	nop
+
+00004290 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4290:	55                   	push   %ebp
+    4291:	89 e5                	mov    %esp,%ebp
+    4293:	57                   	push   %edi
+    4294:	56                   	push   %esi
+    4295:	53                   	push   %ebx
+    4296:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4298:	89 d1                	mov    %edx,%ecx
+{
+    429a:	83 ec 3c             	sub    $0x3c,%esp
+    429d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    42a0:	85 d2                	test   %edx,%edx
+    42a2:	0f 89 80 00 00 00    	jns    4328 <printint+0x98>
+    42a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    42ac:	74 7a                	je     4328 <printint+0x98>
+    x = -xx;
+    42ae:	f7 d9                	neg    %ecx
+    neg = 1;
+    42b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    42b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    42b8:	31 f6                	xor    %esi,%esi
+    42ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    42c0:	89 c8                	mov    %ecx,%eax
+    42c2:	31 d2                	xor    %edx,%edx
+    42c4:	89 f7                	mov    %esi,%edi
+    42c6:	f7 f3                	div    %ebx
+    42c8:	8d 76 01             	lea    0x1(%esi),%esi
+    42cb:	0f b6 92 2c 60 00 00 	movzbl 0x602c(%edx),%edx
+    42d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    42d6:	89 ca                	mov    %ecx,%edx
+    42d8:	89 c1                	mov    %eax,%ecx
+    42da:	39 da                	cmp    %ebx,%edx
+    42dc:	73 e2                	jae    42c0 <printint+0x30>
+  if(neg)
+    42de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    42e1:	85 c0                	test   %eax,%eax
+    42e3:	74 07                	je     42ec <printint+0x5c>
+    buf[i++] = '-';
+    42e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    42ea:	89 f7                	mov    %esi,%edi
+    42ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    42ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    42f2:	01 df                	add    %ebx,%edi
+    42f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    42f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    42fb:	83 ec 04             	sub    $0x4,%esp
+    42fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+    4301:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    4304:	6a 01                	push   $0x1
+    4306:	50                   	push   %eax
+    4307:	56                   	push   %esi
+    4308:	e8 66 fe ff ff       	call   4173 <write>
+  while(--i >= 0)
+    430d:	89 f8                	mov    %edi,%eax
+    430f:	83 c4 10             	add    $0x10,%esp
+    4312:	83 ef 01             	sub    $0x1,%edi
+    4315:	39 d8                	cmp    %ebx,%eax
+    4317:	75 df                	jne    42f8 <printint+0x68>
+}
+    4319:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    431c:	5b                   	pop    %ebx
+    431d:	5e                   	pop    %esi
+    431e:	5f                   	pop    %edi
+    431f:	5d                   	pop    %ebp
+    4320:	c3                   	ret
+    4321:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    4328:	31 c0                	xor    %eax,%eax
+    432a:	eb 89                	jmp    42b5 <printint+0x25>
+    432c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004330 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...) {
+    4330:	55                   	push   %ebp
+    4331:	89 e5                	mov    %esp,%ebp
+    4333:	57                   	push   %edi
+    4334:	56                   	push   %esi
+    4335:	53                   	push   %ebx
+    4336:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    4339:	8b 75 0c             	mov    0xc(%ebp),%esi
+printf(int fd, char *fmt, ...) {
+    433c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    433f:	0f b6 1e             	movzbl (%esi),%ebx
+    4342:	83 c6 01             	add    $0x1,%esi
+    4345:	84 db                	test   %bl,%bl
+    4347:	74 67                	je     43b0 <printf+0x80>
+    4349:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    434c:	31 d2                	xor    %edx,%edx
+    434e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    4351:	eb 34                	jmp    4387 <printf+0x57>
+    4353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4357:	90                   	nop
+    4358:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    435b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    4360:	83 f8 25             	cmp    $0x25,%eax
+    4363:	74 18                	je     437d <printf+0x4d>
+  write(fd, &c, 1);
+    4365:	83 ec 04             	sub    $0x4,%esp
+    4368:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    436b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    436e:	6a 01                	push   $0x1
+    4370:	50                   	push   %eax
+    4371:	57                   	push   %edi
+    4372:	e8 fc fd ff ff       	call   4173 <write>
+    4377:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    437a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    437d:	0f b6 1e             	movzbl (%esi),%ebx
+    4380:	83 c6 01             	add    $0x1,%esi
+    4383:	84 db                	test   %bl,%bl
+    4385:	74 29                	je     43b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    4387:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    438a:	85 d2                	test   %edx,%edx
+    438c:	74 ca                	je     4358 <printf+0x28>
+      }
+    } else if(state == '%'){
+    438e:	83 fa 25             	cmp    $0x25,%edx
+    4391:	75 ea                	jne    437d <printf+0x4d>
+      if(c == 'd'){
+    4393:	83 f8 25             	cmp    $0x25,%eax
+    4396:	0f 84 24 01 00 00    	je     44c0 <printf+0x190>
+    439c:	83 e8 63             	sub    $0x63,%eax
+    439f:	83 f8 15             	cmp    $0x15,%eax
+    43a2:	77 1c                	ja     43c0 <printf+0x90>
+    43a4:	ff 24 85 d4 5f 00 00 	jmp    *0x5fd4(,%eax,4)
+    43ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    43af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    43b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    43b3:	5b                   	pop    %ebx
+    43b4:	5e                   	pop    %esi
+    43b5:	5f                   	pop    %edi
+    43b6:	5d                   	pop    %ebp
+    43b7:	c3                   	ret
+    43b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43bf:	90                   	nop
+  write(fd, &c, 1);
+    43c0:	83 ec 04             	sub    $0x4,%esp
+    43c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    43c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    43ca:	6a 01                	push   $0x1
+    43cc:	52                   	push   %edx
+    43cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    43d0:	57                   	push   %edi
+    43d1:	e8 9d fd ff ff       	call   4173 <write>
+    43d6:	83 c4 0c             	add    $0xc,%esp
+    43d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    43dc:	6a 01                	push   $0x1
+    43de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    43e1:	52                   	push   %edx
+    43e2:	57                   	push   %edi
+    43e3:	e8 8b fd ff ff       	call   4173 <write>
+        putc(fd, c);
+    43e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    43eb:	31 d2                	xor    %edx,%edx
+    43ed:	eb 8e                	jmp    437d <printf+0x4d>
+    43ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    43f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    43f3:	83 ec 0c             	sub    $0xc,%esp
+    43f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    43fb:	8b 13                	mov    (%ebx),%edx
+    43fd:	6a 00                	push   $0x0
+    43ff:	89 f8                	mov    %edi,%eax
+        ap++;
+    4401:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    4404:	e8 87 fe ff ff       	call   4290 <printint>
+        ap++;
+    4409:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    440c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    440f:	31 d2                	xor    %edx,%edx
+    4411:	e9 67 ff ff ff       	jmp    437d <printf+0x4d>
+    4416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    441d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    4420:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4423:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    4425:	83 c0 04             	add    $0x4,%eax
+    4428:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    442b:	85 db                	test   %ebx,%ebx
+    442d:	0f 84 9d 00 00 00    	je     44d0 <printf+0x1a0>
+        while(*s != 0){
+    4433:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    4436:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    4438:	84 c0                	test   %al,%al
+    443a:	0f 84 3d ff ff ff    	je     437d <printf+0x4d>
+    4440:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4443:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    4446:	89 de                	mov    %ebx,%esi
+    4448:	89 d3                	mov    %edx,%ebx
+    444a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    4450:	83 ec 04             	sub    $0x4,%esp
+    4453:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    4456:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    4459:	6a 01                	push   $0x1
+    445b:	53                   	push   %ebx
+    445c:	57                   	push   %edi
+    445d:	e8 11 fd ff ff       	call   4173 <write>
+        while(*s != 0){
+    4462:	0f b6 06             	movzbl (%esi),%eax
+    4465:	83 c4 10             	add    $0x10,%esp
+    4468:	84 c0                	test   %al,%al
+    446a:	75 e4                	jne    4450 <printf+0x120>
+      state = 0;
+    446c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    446f:	31 d2                	xor    %edx,%edx
+    4471:	e9 07 ff ff ff       	jmp    437d <printf+0x4d>
+    4476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    447d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4480:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4483:	83 ec 0c             	sub    $0xc,%esp
+    4486:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    448b:	8b 13                	mov    (%ebx),%edx
+    448d:	6a 01                	push   $0x1
+    448f:	e9 6b ff ff ff       	jmp    43ff <printf+0xcf>
+    4494:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4498:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    449b:	83 ec 04             	sub    $0x4,%esp
+    449e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    44a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    44a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    44a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    44a9:	6a 01                	push   $0x1
+    44ab:	52                   	push   %edx
+    44ac:	57                   	push   %edi
+    44ad:	e8 c1 fc ff ff       	call   4173 <write>
+        ap++;
+    44b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    44b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    44b8:	31 d2                	xor    %edx,%edx
+    44ba:	e9 be fe ff ff       	jmp    437d <printf+0x4d>
+    44bf:	90                   	nop
+  write(fd, &c, 1);
+    44c0:	83 ec 04             	sub    $0x4,%esp
+    44c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    44c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    44c9:	6a 01                	push   $0x1
+    44cb:	e9 11 ff ff ff       	jmp    43e1 <printf+0xb1>
+    44d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    44d5:	bb ca 5f 00 00       	mov    $0x5fca,%ebx
+    44da:	e9 61 ff ff ff       	jmp    4440 <printf+0x110>
+    44df:	90                   	nop
+
+000044e0 <pads>:
+
+// printf has no field widths.  Print s left-aligned in w columns.
+void
+pads(int fd, char *s, int w) {
+    44e0:	55                   	push   %ebp
+    44e1:	89 e5                	mov    %esp,%ebp
+    44e3:	57                   	push   %edi
+    44e4:	56                   	push   %esi
+    44e5:	53                   	push   %ebx
+    44e6:	83 ec 20             	sub    $0x20,%esp
+    44e9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    44ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  printf(fd, "%s", s);
+    44ef:	57                   	push   %edi
+    44f0:	68 d1 5f 00 00       	push   $0x5fd1
+    44f5:	53                   	push   %ebx
+    44f6:	e8 35 fe ff ff       	call   4330 <printf>
+  for(n = strlen(s); n < w; n++)
+    44fb:	89 3c 24             	mov    %edi,(%esp)
+    44fe:	e8 9d fa ff ff       	call   3fa0 <strlen>
+    4503:	83 c4 10             	add    $0x10,%esp
+    4506:	3b 45 10             	cmp    0x10(%ebp),%eax
+    4509:	7d 20                	jge    452b <pads+0x4b>
+    450b:	89 c6                	mov    %eax,%esi
+    450d:	8d 7d e7             	lea    -0x19(%ebp),%edi
+  write(fd, &c, 1);
+    4510:	83 ec 04             	sub    $0x4,%esp
+    4513:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(n = strlen(s); n < w; n++)
+    4517:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    451a:	6a 01                	push   $0x1
+    451c:	57                   	push   %edi
+    451d:	53                   	push   %ebx
+    451e:	e8 50 fc ff ff       	call   4173 <write>
+  for(n = strlen(s); n < w; n++)
+    4523:	83 c4 10             	add    $0x10,%esp
+    4526:	39 75 10             	cmp    %esi,0x10(%ebp)
+    4529:	75 e5                	jne    4510 <pads+0x30>
+    putc(fd, ' ');
+}
+    452b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    452e:	5b                   	pop    %ebx
+    452f:	5e                   	pop    %esi
+    4530:	5f                   	pop    %edi
+    4531:	5d                   	pop    %ebp
+    4532:	c3                   	ret
+    4533:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    453a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004540 <padd>:
+
+// Print v right-aligned in w columns.
+void
+padd(int fd, uint v, int w) {
+    4540:	55                   	push   %ebp
+  int n = 0;
+  uint x = v;
+
+  do{
+    n++;
+  }while((x /= 10) != 0);
+    4541:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+padd(int fd, uint v, int w) {
+    4546:	89 e5                	mov    %esp,%ebp
+    4548:	57                   	push   %edi
+    4549:	56                   	push   %esi
+    454a:	53                   	push   %ebx
+  int n = 0;
+    454b:	31 db                	xor    %ebx,%ebx
+padd(int fd, uint v, int w) {
+    454d:	83 ec 2c             	sub    $0x2c,%esp
+    4550:	8b 55 0c             	mov    0xc(%ebp),%edx
+    4553:	8b 45 10             	mov    0x10(%ebp),%eax
+    4556:	8b 75 08             	mov    0x8(%ebp),%esi
+    4559:	89 55 d0             	mov    %edx,-0x30(%ebp)
+    455c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    455f:	90                   	nop
+  }while((x /= 10) != 0);
+    4560:	89 d0                	mov    %edx,%eax
+    4562:	89 d7                	mov    %edx,%edi
+    n++;
+    4564:	83 c3 01             	add    $0x1,%ebx
+  }while((x /= 10) != 0);
+    4567:	f7 e1                	mul    %ecx
+    4569:	c1 ea 03             	shr    $0x3,%edx
+    456c:	83 ff 09             	cmp    $0x9,%edi
+    456f:	77 ef                	ja     4560 <padd+0x20>
+  for(; n < w; n++)
+    4571:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    4574:	39 c3                	cmp    %eax,%ebx
+    4576:	7d 23                	jge    459b <padd+0x5b>
+    4578:	8d 7d e7             	lea    -0x19(%ebp),%edi
+    457b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    457f:	90                   	nop
+  write(fd, &c, 1);
+    4580:	83 ec 04             	sub    $0x4,%esp
+    4583:	c6 45 e7 20          	movb   $0x20,-0x19(%ebp)
+  for(; n < w; n++)
+    4587:	83 c3 01             	add    $0x1,%ebx
+  write(fd, &c, 1);
+    458a:	6a 01                	push   $0x1
+    458c:	57                   	push   %edi
+    458d:	56                   	push   %esi
+    458e:	e8 e0 fb ff ff       	call   4173 <write>
+  for(; n < w; n++)
+    4593:	83 c4 10             	add    $0x10,%esp
+    4596:	39 5d d4             	cmp    %ebx,-0x2c(%ebp)
+    4599:	75 e5                	jne    4580 <padd+0x40>
+    putc(fd, ' ');
+  printint(fd, v, 10, 0);
+    459b:	c7 45 08 00 00 00 00 	movl   $0x0,0x8(%ebp)
+    45a2:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+    45a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  printint(fd, v, 10, 0);
+    45a8:	89 f0                	mov    %esi,%eax
+}
+    45aa:	5b                   	pop    %ebx
+  printint(fd, v, 10, 0);
+    45ab:	b9 0a 00 00 00       	mov    $0xa,%ecx
+}
+    45b0:	5e                   	pop    %esi
+    45b1:	5f                   	pop    %edi
+    45b2:	5d                   	pop    %ebp
+  printint(fd, v, 10, 0);
+    45b3:	e9 d8 fc ff ff       	jmp    4290 <printint>
+    45b8:	66 90                	xchg   %ax,%ax
+    45ba:	66 90                	xchg   %ax,%ax
+    45bc:	66 90                	xchg   %ax,%ax
+    45be:	66 90                	xchg   %ax,%ax
+
+000045c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    45c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    45c1:	a1 60 b1 00 00       	mov    0xb160,%eax
+{
+    45c6:	89 e5                	mov    %esp,%ebp
+    45c8:	57                   	push   %edi
+    45c9:	56                   	push   %esi
+    45ca:	53                   	push   %ebx
+    45cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    45ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    45d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    45d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    45da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    45dc:	39 ca                	cmp    %ecx,%edx
+    45de:	73 30                	jae    4610 <free+0x50>
+    45e0:	39 c1                	cmp    %eax,%ecx
+    45e2:	72 04                	jb     45e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    45e4:	39 c2                	cmp    %eax,%edx
+    45e6:	72 f0                	jb     45d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    45e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    45eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    45ee:	39 f8                	cmp    %edi,%eax
+    45f0:	74 2e                	je     4620 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    45f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    45f5:	8b 42 04             	mov    0x4(%edx),%eax
+    45f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    45fb:	39 f1                	cmp    %esi,%ecx
+    45fd:	74 38                	je     4637 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    45ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    4601:	5b                   	pop    %ebx
+  freep = p;
+    4602:	89 15 60 b1 00 00    	mov    %edx,0xb160
+}
+    4608:	5e                   	pop    %esi
+    4609:	5f                   	pop    %edi
+    460a:	5d                   	pop    %ebp
+    460b:	c3                   	ret
+    460c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4610:	39 c1                	cmp    %eax,%ecx
+    4612:	72 d0                	jb     45e4 <free+0x24>
+    4614:	eb c2                	jmp    45d8 <free+0x18>
+    4616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    461d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    4620:	03 70 04             	add    0x4(%eax),%esi
+    4623:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4626:	8b 02                	mov    (%edx),%eax
+    4628:	8b 00                	mov    (%eax),%eax
+    462a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    462d:	8b 42 04             	mov    0x4(%edx),%eax
+    4630:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4633:	39 f1                	cmp    %esi,%ecx
+    4635:	75 c8                	jne    45ff <free+0x3f>
+    p->s.size += bp->s.size;
+    4637:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    463a:	89 15 60 b1 00 00    	mov    %edx,0xb160
+    p->s.size += bp->s.size;
+    4640:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4643:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4646:	89 0a                	mov    %ecx,(%edx)
+}
+    4648:	5b                   	pop    %ebx
+    4649:	5e                   	pop    %esi
+    464a:	5f                   	pop    %edi
+    464b:	5d                   	pop    %ebp
+    464c:	c3                   	ret
+    464d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004650 <malloc>:
+  free((void*)(hp + 1));
+  return freep;
+}
+
+void*
+malloc(uint nbytes) {
+    4650:	55                   	push   %ebp
+    4651:	89 e5                	mov    %esp,%ebp
+    4653:	57                   	push   %edi
+    4654:	56                   	push   %esi
+    4655:	53                   	push   %ebx
+    4656:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4659:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    465c:	8b 15 60 b1 00 00    	mov    0xb160,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4662:	8d 78 07             	lea    0x7(%eax),%edi
+    4665:	c1 ef 03             	shr    $0x3,%edi
+    4668:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    466b:	85 d2                	test   %edx,%edx
+    466d:	0f 84 8d 00 00 00    	je     4700 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4673:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4675:	8b 48 04             	mov    0x4(%eax),%ecx
+    4678:	39 f9                	cmp    %edi,%ecx
+    467a:	73 64                	jae    46e0 <malloc+0x90>
+  if(nu < 4096)
+    467c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4681:	39 df                	cmp    %ebx,%edi
+    4683:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4686:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    468d:	eb 0a                	jmp    4699 <malloc+0x49>
+    468f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4690:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4692:	8b 48 04             	mov    0x4(%eax),%ecx
+    4695:	39 f9                	cmp    %edi,%ecx
+    4697:	73 47                	jae    46e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4699:	89 c2                	mov    %eax,%edx
+    469b:	39 05 60 b1 00 00    	cmp    %eax,0xb160
+    46a1:	75 ed                	jne    4690 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    46a3:	83 ec 0c             	sub    $0xc,%esp
+    46a6:	56                   	push   %esi
+    46a7:	e8 2f fb ff ff       	call   41db <sbrk>
+  if(p == (char*)-1)
+    46ac:	83 c4 10             	add    $0x10,%esp
+    46af:	83 f8 ff             	cmp    $0xffffffff,%eax
+    46b2:	74 1c                	je     46d0 <malloc+0x80>
+  hp->s.size = nu;
+    46b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    46b7:	83 ec 0c             	sub    $0xc,%esp
+    46ba:	83 c0 08             	add    $0x8,%eax
+    46bd:	50                   	push   %eax
+    46be:	e8 fd fe ff ff       	call   45c0 <free>
+  return freep;
+    46c3:	8b 15 60 b1 00 00    	mov    0xb160,%edx
+      if((p = morecore(nunits)) == 0)
+    46c9:	83 c4 10             	add    $0x10,%esp
+    46cc:	85 d2                	test   %edx,%edx
+    46ce:	75 c0                	jne    4690 <malloc+0x40>
+        return 0;
+  }
+}
+    46d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    46d3:	31 c0                	xor    %eax,%eax
+}
+    46d5:	5b                   	pop    %ebx
+    46d6:	5e                   	pop    %esi
+    46d7:	5f                   	pop    %edi
+    46d8:	5d                   	pop    %ebp
+    46d9:	c3                   	ret
+    46da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    46e0:	39 cf                	cmp    %ecx,%edi
+    46e2:	74 4c                	je     4730 <malloc+0xe0>
+        p->s.size -= nunits;
+    46e4:	29 f9                	sub    %edi,%ecx
+    46e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    46e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    46ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    46ef:	89 15 60 b1 00 00    	mov    %edx,0xb160
+}
+    46f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    46f8:	83 c0 08             	add    $0x8,%eax
+}
+    46fb:	5b                   	pop    %ebx
+    46fc:	5e                   	pop    %esi
+    46fd:	5f                   	pop    %edi
+    46fe:	5d                   	pop    %ebp
+    46ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    4700:	c7 05 60 b1 00 00 64 	movl   $0xb164,0xb160
+    4707:	b1 00 00 
+    base.s.size = 0;
+    470a:	b8 64 b1 00 00       	mov    $0xb164,%eax
+    base.s.ptr = freep = prevp = &base;
+    470f:	c7 05 64 b1 00 00 64 	movl   $0xb164,0xb164
+    4716:	b1 00 00 
+    base.s.size = 0;
+    4719:	c7 05 68 b1 00 00 00 	movl   $0x0,0xb168
+    4720:	00 00 00 
+    if(p->s.size >= nunits){
+    4723:	e9 54 ff ff ff       	jmp    467c <malloc+0x2c>
+    4728:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    472f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4730:	8b 08                	mov    (%eax),%ecx
+    4732:	89 0a                	mov    %ecx,(%edx)
+    4734:	eb b9                	jmp    46ef <malloc+0x9f>
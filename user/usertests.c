@@ -4,6 +4,7 @@
 #include "kernel/fs.h"
 #include "kernel/fcntl.h"
 #include "kernel/syscall.h"
+#include "kernel/bcache.h"
 #include "kernel/traps.h"
 #include "kernel/memlayout.h"
 #include "user.h"
@@ -302,6 +303,91 @@ exectest(void)
 
 // simple fork and pipe read/write
 
+// grow and shrink the buffer cache while another process
+// uses up all of memory, so that kalloc() fails under bget().
+#define BCGROWBLOCKS 256
+void
+bcachegrow(void)
+{
+  struct bcachestat st0, st;
+  int fd, i, j, pass, pid, n;
+
+  printf(1, "bcachegrow test\n");
+
+  fd = open("bcgrow", O_CREATE | O_RDWR);
+  if(fd < 0){
+    printf(1, "cannot create bcgrow\n");
+    exit(1);
+  }
+  for(i = 0; i < BCGROWBLOCKS; i++){
+    memset(buf, i, BSIZE);
+    if(write(fd, buf, BSIZE) != BSIZE){
+      printf(1, "write bcgrow failed\n");
+      exit(1);
+    }
+  }
+  close(fd);
+  if(bcachestat(&st0) < 0){
+    printf(1, "bcachestat failed\n");
+    exit(1);
+  }
+
+  // The child reads the file over and over, missing in the cache,
+  // while we take every free page and give them back.
+  if((pid = fork()) < 0){
+    printf(1, "fork failed\n");
+    exit(1);
+  }
+  for(pass = 0; pass < (pid == 0 ? 8 : 3); pass++){
+    if(pid == 0){
+      if((fd = open("bcgrow", 0)) < 0){
+        printf(1, "cannot open bcgrow\n");
+        exit(1);
+      }
+      for(i = 0; i < BCGROWBLOCKS; i++){
+        if(read(fd, buf, BSIZE) != BSIZE){
+          printf(1, "read bcgrow failed\n");
+          exit(1);
+        }
+        for(j = 0; j < BSIZE; j++){
+          if(buf[j] != (char)i){
+            printf(1, "bcgrow: wrong data in block %d\n", i);
+            exit(1);
+          }
+        }
+      }
+      close(fd);
+    } else {
+      for(n = 0; sbrk(4096) != (char*)-1; n++)
+        ;
+      sbrk(-n * 4096);
+    }
+  }
+  if(pid == 0)
+    exit(0);
+  wait(&estatus);
+  if(estatus != 0){
+    printf(1, "bcachegrow: reader failed\n");
+    exit(1);
+  }
+
+  // Memory is free again: a miss adds the pages back.
+  fd = open("bcgrow", 0);
+  while(read(fd, buf, BSIZE) == BSIZE)
+    ;
+  close(fd);
+  unlink("bcgrow");
+  if(bcachestat(&st) < 0){
+    printf(1, "bcachestat failed\n");
+    exit(1);
+  }
+  if(st.shrinks == st0.shrinks || st.grows == st0.grows){
+    printf(1, "bcachegrow: cache did not shrink and grow again\n");
+    exit(1);
+  }
+  printf(1, "bcachegrow ok\n");
+}
+
 void
 pipe1(void)
 {
@@ -1779,6 +1865,7 @@ main(int argc, char *argv[])
   iputtest();
 
   mem();
+  bcachegrow();
   pipe1();
   preempt();
   exitwait();